@@ -0,0 +1,548 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <thread>
+#include <random>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include "bvh.h"
+#include "instanceculler.h"
+#include "instancehandles.h"
+#include "meshopt.h"
+#include "mortonsort.h"
+#include "objloader.h"
+#include "threadpool.h"
+#include "transformstore.h"
+
+// CPU micro benchmarks, each returns a printable report
+
+inline double benchmarkSeconds(const std::chrono::steady_clock::time_point& start)
+{
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// 1, 2, 4, ... up to the hardware thread count
+inline std::vector<unsigned int> benchmarkThreadCounts()
+{
+	unsigned int maxThreads = std::thread::hardware_concurrency();
+	std::vector<unsigned int> counts;
+	for (unsigned int threads = 1; threads < maxThreads; threads *= 2)
+		counts.push_back(threads);
+	counts.push_back(maxThreads > 0 ? maxThreads : 1);
+	return counts;
+}
+
+// Parses the OBJ repeated `repeat` times in memory with 1..N threads and checks every run against the serial parse
+inline std::string benchmarkObjParse(const char* objPath, unsigned int repeat = 64)
+{
+	MappedFile file(objPath);
+	if (!file.isOpen())
+		return std::string("Failed to open ") + objPath + "\n";
+
+	std::string text;
+	text.reserve(file.getSize() * repeat + repeat);
+	for (unsigned int i = 0; i < repeat; ++i)
+	{
+		text.append(file.getData(), file.getSize());
+		text.push_back('\n');
+	}
+	const char* begin = text.data();
+	const char* end = begin + text.size();
+	double megabytes = static_cast<double>(text.size()) / (1024.0 * 1024.0);
+
+	ObjData reference;
+	auto start = std::chrono::steady_clock::now();
+	ObjLoader::parse(begin, end, reference);
+	double serialSeconds = benchmarkSeconds(start);
+
+	char line[160];
+	std::string report;
+	std::snprintf(line, sizeof(line), "OBJ parse %.1f MB, serial %.1f ms (%.1f MB/s)\n", megabytes, serialSeconds * 1000.0, megabytes / serialSeconds);
+	report += line;
+
+	for (unsigned int threads : benchmarkThreadCounts())
+	{
+		ThreadPool pool(threads);
+		double best = 1e30;
+		bool identical = true;
+
+		for (int run = 0; run < 3; ++run)
+		{
+			ObjData data;
+			start = std::chrono::steady_clock::now();
+			ObjLoader::parseParallel(begin, end, data, pool, 64 * 1024);
+			double seconds = benchmarkSeconds(start);
+			if (seconds < best)
+				best = seconds;
+
+			identical = identical &&
+				data.positions == reference.positions &&
+				data.texCoords == reference.texCoords &&
+				data.normals == reference.normals &&
+				data.corners.size() == reference.corners.size() &&
+				std::memcmp(data.corners.data(), reference.corners.data(), data.corners.size() * sizeof(ObjIndex)) == 0;
+		}
+
+		std::snprintf(line, sizeof(line), "  %2u threads: %7.1f ms %8.1f MB/s  x%.2f %s\n",
+			threads, best * 1000.0, megabytes / best, serialSeconds / best, identical ? "" : "MISMATCH");
+		report += line;
+	}
+
+	return report;
+}
+
+// Simulates the post-transform cache after each MeshOptimizer pass for a few cache sizes
+inline std::string benchmarkVertexCache(const char* objPath)
+{
+	std::vector<Vertex> sourceVertices;
+	std::vector<unsigned int> sourceIndices;
+	if (!ObjLoader::loadFile(objPath, sourceVertices, sourceIndices))
+		return std::string("Failed to open ") + objPath + "\n";
+
+	char line[160];
+	std::string report;
+	std::snprintf(line, sizeof(line), "Vertex cache, %zu triangles, ACMR / ATVR\n", sourceIndices.size() / 3);
+	report += line;
+
+	for (unsigned int cacheSize : { 8u, 16u, 32u })
+	{
+		std::vector<Vertex> vertices = sourceVertices;
+		std::vector<unsigned int> indices = sourceIndices;
+		VertexCacheStats original = MeshOptimizer::simulateCache(indices, vertices.size(), cacheSize);
+
+		auto start = std::chrono::steady_clock::now();
+		std::vector<size_t> clusters = MeshOptimizer::optimizeVertexCache(indices, vertices.size(), cacheSize);
+		VertexCacheStats reordered = MeshOptimizer::simulateCache(indices, vertices.size(), cacheSize);
+		MeshOptimizer::optimizeOverdraw(indices, vertices, clusters, 1.05f, cacheSize);
+		VertexCacheStats overdraw = MeshOptimizer::simulateCache(indices, vertices.size(), cacheSize);
+		MeshOptimizer::optimizeVertexFetch(vertices, indices);
+		double seconds = benchmarkSeconds(start);
+
+		std::snprintf(line, sizeof(line), "  cache %2u: %.3f / %.3f -> tipsify %.3f / %.3f, overdraw %.3f / %.3f (%zu clusters) %.2f ms\n",
+			cacheSize, original.acmr, original.atvr, reordered.acmr, reordered.atvr, overdraw.acmr, overdraw.atvr, clusters.size(), seconds * 1000.0);
+		report += line;
+	}
+
+	return report;
+}
+
+// Composes count random transforms with every supported TransformStore path and with a glm matrix chain
+inline std::string benchmarkTransformCompose(size_t count = 1000000, int repeat = 5)
+{
+	std::mt19937 random(1234);
+	std::uniform_real_distribution<float> unit(-1.f, 1.f);
+
+	TransformStore store;
+	store.reserve(count);
+	std::vector<glm::mat4> reference(count);
+	for (size_t i = 0; i < count; ++i)
+	{
+		glm::vec3 position(unit(random) * 100.f, unit(random) * 100.f, unit(random) * 100.f);
+		glm::quat rotation = glm::normalize(glm::quat(unit(random), unit(random), unit(random), unit(random)));
+		glm::vec3 scale(1.f + unit(random) * 0.5f, 1.f + unit(random) * 0.5f, 1.f + unit(random) * 0.5f);
+		store.add(position, rotation, scale);
+	}
+
+	// What Model did per instance before, three matrix products
+	double glmSeconds = 1e30;
+	for (int run = 0; run < repeat; ++run)
+	{
+		auto start = std::chrono::steady_clock::now();
+		for (size_t i = 0; i < count; ++i)
+			reference[i] = glm::scale(glm::translate(glm::mat4(1.f), store.getPosition(i)) * glm::mat4_cast(store.getRotation(i)), store.getScale(i));
+		glmSeconds = std::min(glmSeconds, benchmarkSeconds(start));
+	}
+
+	char line[160];
+	std::string report;
+	std::snprintf(line, sizeof(line), "Transform compose, %zu instances, best of %d\n", count, repeat);
+	report += line;
+	std::snprintf(line, sizeof(line), "  glm chain %7.2f ms (%6.1f M/s)\n", glmSeconds * 1000.0, count / glmSeconds / 1e6);
+	report += line;
+
+	for (TransformComposer composer : { TransformComposer::Scalar, TransformComposer::Sse, TransformComposer::Avx2 })
+	{
+		if (!TransformStore::supports(composer))
+			continue;
+		store.setComposer(composer);
+
+		double seconds = 1e30;
+		for (int run = 0; run < repeat; ++run)
+		{
+			store.markAllDirty();
+			auto start = std::chrono::steady_clock::now();
+			store.compose();
+			seconds = std::min(seconds, benchmarkSeconds(start));
+		}
+
+		float maxError = 0.f;
+		for (size_t i = 0; i < count; ++i)
+			for (int column = 0; column < 4; ++column)
+				for (int row = 0; row < 4; ++row)
+					maxError = std::max(maxError, std::abs(store.getMatrix(i)[column][row] - reference[i][column][row]));
+
+		std::snprintf(line, sizeof(line), "  %-9s %7.2f ms (%6.1f M/s, %.1fx glm) max error %.1e\n",
+			TransformStore::composerName(composer), seconds * 1000.0, count / seconds / 1e6, glmSeconds / seconds, maxError);
+		report += line;
+	}
+
+	// Only 1% of the instances changed, scattered over the whole store
+	store.setComposer(TransformStore::bestComposer());
+	for (size_t i = 0; i < count; i += 100)
+		store.setPosition(i, store.getPosition(i) + glm::vec3(1.f));
+	auto start = std::chrono::steady_clock::now();
+	ComposeRange range = store.compose();
+	double sparseSeconds = benchmarkSeconds(start);
+	std::snprintf(line, sizeof(line), "  1%% dirty %7.2f ms, %zu composed\n", sparseSeconds * 1000.0, range.composed);
+	report += line;
+
+	return report;
+}
+
+// Despawns and respawns random instances of stores of several sizes, through handles with swap and pop
+// and through the ordered vector erase every class used before. Swap and pop should cost the same at any size.
+inline std::string benchmarkInstanceChurn(size_t churn = 10000)
+{
+	std::mt19937 random(1234);
+	char line[160];
+	std::string report = "Instance churn, remove + add\n";
+
+	for (size_t count : { size_t(10000), size_t(100000), size_t(1000000) })
+	{
+		TransformStore store;
+		InstanceHandles handles;
+		store.reserve(count);
+		for (size_t i = 0; i < count; ++i)
+			store.add(glm::vec3(static_cast<float>(i), 0.f, 0.f));
+		handles.reset(count);
+		store.compose();
+
+		std::vector<InstanceHandle> live(count);
+		for (size_t i = 0; i < count; ++i)
+			live[i] = handles.handle(i);
+
+		auto start = std::chrono::steady_clock::now();
+		for (size_t i = 0; i < churn; ++i)
+		{
+			size_t pick = random() % live.size();
+			uint32_t slot = handles.slot(live[pick]);
+			handles.removeSlot(slot);
+			store.remove(slot);
+			store.add(glm::vec3(0.f));
+			live[pick] = handles.create();
+		}
+		ComposeRange range = store.compose();
+		double handleSeconds = benchmarkSeconds(start);
+
+		// The ordered erase moves everything behind the removed instance, a few hundred runs are enough to see it
+		std::vector<glm::mat4> matrices(count, glm::mat4(1.f));
+		size_t eraseChurn = std::min<size_t>(churn, 200);
+		start = std::chrono::steady_clock::now();
+		for (size_t i = 0; i < eraseChurn; ++i)
+		{
+			matrices.erase(matrices.begin() + random() % matrices.size());
+			matrices.push_back(glm::mat4(1.f));
+		}
+		double eraseSeconds = benchmarkSeconds(start);
+
+		std::snprintf(line, sizeof(line), "  %8zu instances: handles %6.3f us/op (%zu recomposed), erase %8.3f us/op\n",
+			count, handleSeconds * 1e6 / churn, range.composed, eraseSeconds * 1e6 / eraseChurn);
+		report += line;
+	}
+
+	return report;
+}
+
+// Frustum culls count randomly placed instances of a unit mesh with 1..N threads, the camera at the origin looking down -z
+inline std::string benchmarkInstanceCulling(size_t count = 1000000, int repeat = 5)
+{
+	std::mt19937 random(1234);
+	std::uniform_real_distribution<float> unit(-1.f, 1.f);
+	std::vector<glm::mat4> matrices(count);
+	for (glm::mat4& matrix : matrices)
+	{
+		glm::vec3 position(unit(random) * 500.f, unit(random) * 500.f, unit(random) * 500.f);
+		matrix = glm::scale(glm::translate(glm::mat4(1.f), position), glm::vec3(1.f + unit(random) * 0.5f));
+	}
+	glm::mat4 viewProjection = glm::perspective(glm::radians(45.f), 16.f / 9.f, 0.1f, 400.f) *
+		glm::lookAt(glm::vec3(0.f), glm::vec3(0.f, 0.f, -1.f), glm::vec3(0.f, 1.f, 0.f));
+
+	InstanceCuller culler;
+	culler.setBounds(glm::vec3(-1.f), glm::vec3(1.f));
+
+	char line[160];
+	std::string report;
+	double serialSeconds = 0.0;
+	size_t serialVisible = 0;
+	for (unsigned int threads : benchmarkThreadCounts())
+	{
+		ThreadPool pool(threads);
+		double best = 1e30;
+		for (int run = 0; run < repeat; ++run)
+		{
+			auto start = std::chrono::steady_clock::now();
+			culler.cull(matrices.data(), count, viewProjection, pool);
+			best = std::min(best, benchmarkSeconds(start));
+		}
+
+		const InstanceCullStats& stats = culler.getStats();
+		if (threads == 1)
+		{
+			serialSeconds = best;
+			serialVisible = stats.visible;
+			std::snprintf(line, sizeof(line), "Instance culling, %zu instances, %zu visible, %zu culled, best of %d\n", count, stats.visible, stats.culled, repeat);
+			report += line;
+		}
+		std::snprintf(line, sizeof(line), "  %2u threads: %7.2f ms %7.1f M/s  x%.2f %s\n",
+			threads, best * 1000.0, count / best / 1e6, serialSeconds / best, stats.visible == serialVisible ? "" : "MISMATCH");
+		report += line;
+	}
+
+	return report;
+}
+
+// Builds, refits and queries the instance BVH at each size and checks its queries against testing every box
+inline std::string benchmarkBvh(const std::vector<size_t>& counts = { 10000, 100000, 1000000 }, int repeat = 3)
+{
+	char line[192];
+	std::string report;
+	std::snprintf(line, sizeof(line), "Instance BVH, best of %d, %u threads\n", repeat, ThreadPool::shared().getThreadCount());
+	report += line;
+
+	for (size_t count : counts)
+	{
+		// Same density at every size
+		float extent = 500.f * std::cbrt(count / 1e6f);
+		std::mt19937 random(1234);
+		std::uniform_real_distribution<float> unit(-1.f, 1.f);
+		std::vector<glm::mat4> matrices(count);
+		for (glm::mat4& matrix : matrices)
+		{
+			glm::vec3 position(unit(random) * extent, unit(random) * extent, unit(random) * extent);
+			matrix = glm::scale(glm::translate(glm::mat4(1.f), position), glm::vec3(1.f + unit(random) * 0.5f));
+		}
+
+		InstanceBvh bvh;
+		bvh.setBounds(glm::vec3(-1.f), glm::vec3(1.f));
+		auto best = [&](const std::function<void()>& fn)
+		{
+			double seconds = 1e30;
+			for (int run = 0; run < repeat; ++run)
+			{
+				auto start = std::chrono::steady_clock::now();
+				fn();
+				seconds = std::min(seconds, benchmarkSeconds(start));
+			}
+			return seconds * 1000.0;
+		};
+
+		ThreadPool serial(1);
+		double serialBuild = best([&] { bvh.build(matrices.data(), count, serial); });
+		double parallelBuild = best([&] { bvh.build(matrices.data(), count); });
+		std::snprintf(line, sizeof(line), "  %zu instances, %zu nodes\n", count, bvh.getStats().nodes);
+		report += line;
+		std::snprintf(line, sizeof(line), "    build:        %8.2f ms 1 thread, %8.2f ms %u threads, %6.1f M/s\n",
+			serialBuild, parallelBuild, ThreadPool::shared().getThreadCount(), count / parallelBuild / 1e3);
+		report += line;
+
+		// A contiguous 1% moves a little, then everything refits
+		size_t moved = count / 100;
+		int step = 0;
+		double refitMoved = best([&]
+		{
+			++step;
+			for (size_t i = 0; i < moved; ++i)
+				matrices[i][3].x += (step & 1) ? 0.5f : -0.5f;
+			bvh.refit(matrices.data(), 0, moved);
+		});
+		double refitEverything = best([&] { bvh.refitAll(matrices.data()); });
+		std::snprintf(line, sizeof(line), "    refit:        %8.2f ms for %zu moved, %8.2f ms for all\n", refitMoved, moved, refitEverything);
+		report += line;
+
+		// Frustum against the same test on every box
+		glm::mat4 viewProjection = glm::perspective(glm::radians(45.f), 16.f / 9.f, 0.1f, extent * 0.8f) *
+			glm::lookAt(glm::vec3(0.f), glm::vec3(0.f, 0.f, -1.f), glm::vec3(0.f, 1.f, 0.f));
+		Frustum frustum(viewProjection);
+		std::vector<uint32_t> found;
+		double frustumBvh = best([&] { bvh.queryFrustum(frustum, found); });
+		size_t bruteVisible = 0;
+		double frustumBrute = best([&]
+		{
+			bruteVisible = 0;
+			for (size_t i = 0; i < count; ++i)
+				bruteVisible += frustum.intersectsBox(bvh.getBox(i).boxMin, bvh.getBox(i).boxMax) ? 1 : 0;
+		});
+		std::snprintf(line, sizeof(line), "    frustum:      %8.3f ms, %zu found, scan %8.3f ms %s\n",
+			frustumBvh, found.size(), frustumBrute, found.size() == bruteVisible ? "" : "MISMATCH");
+		report += line;
+
+		// Rays from the center and small boxes all over, the first few checked against a scan
+		const int queries = 1000;
+		const int checked = 8;
+		std::vector<glm::vec3> directions(queries), boxCenters(queries);
+		for (int i = 0; i < queries; ++i)
+		{
+			directions[i] = glm::normalize(glm::vec3(unit(random), unit(random), unit(random)) + glm::vec3(0.f, 0.f, 1e-3f));
+			boxCenters[i] = glm::vec3(unit(random), unit(random), unit(random)) * extent;
+		}
+
+		bool raysMatch = true;
+		BvhRayHit hit;
+		size_t hits = 0;
+		double rayMilliseconds = best([&]
+		{
+			hits = 0;
+			for (int i = 0; i < queries; ++i)
+				hits += bvh.raycast(glm::vec3(0.f), directions[i], extent * 2.f, hit) ? 1 : 0;
+		});
+		for (int i = 0; i < checked; ++i)
+		{
+			bvh.raycast(glm::vec3(0.f), directions[i], extent * 2.f, hit);
+			float nearest = extent * 2.f;
+			bool any = false;
+			glm::vec3 inverse = 1.f / directions[i];
+			for (size_t k = 0; k < count; ++k)
+			{
+				glm::vec3 t0 = bvh.getBox(k).boxMin * inverse, t1 = bvh.getBox(k).boxMax * inverse;
+				float enter = glm::max(glm::max(glm::min(t0.x, t1.x), glm::min(t0.y, t1.y)), glm::max(glm::min(t0.z, t1.z), 0.f));
+				float exit = glm::min(glm::min(glm::max(t0.x, t1.x), glm::max(t0.y, t1.y)), glm::min(glm::max(t0.z, t1.z), nearest));
+				if (enter <= exit)
+				{
+					nearest = enter;
+					any = true;
+				}
+			}
+			if (any != (hit.instance != BvhRayHit().instance) || (any && nearest != hit.distance))
+				raysMatch = false;
+		}
+		std::snprintf(line, sizeof(line), "    ray:          %8.2f us/ray, %zu of %d hit %s\n",
+			rayMilliseconds * 1000.0 / queries, hits, queries, raysMatch ? "" : "MISMATCH");
+		report += line;
+
+		bool boxesMatch = true;
+		size_t overlapping = 0;
+		glm::vec3 halfSize(4.f);
+		double boxMilliseconds = best([&]
+		{
+			overlapping = 0;
+			for (int i = 0; i < queries; ++i)
+				overlapping += bvh.queryBox(boxCenters[i] - halfSize, boxCenters[i] + halfSize, found);
+		});
+		for (int i = 0; i < checked; ++i)
+		{
+			glm::vec3 boxMin = boxCenters[i] - halfSize, boxMax = boxCenters[i] + halfSize;
+			size_t scanned = 0;
+			for (size_t k = 0; k < count; ++k)
+			{
+				const BvhBox& box = bvh.getBox(k);
+				scanned += glm::all(glm::lessThanEqual(box.boxMin, boxMax)) && glm::all(glm::greaterThanEqual(box.boxMax, boxMin)) ? 1 : 0;
+			}
+			if (scanned != bvh.queryBox(boxMin, boxMax, found))
+				boxesMatch = false;
+		}
+		std::snprintf(line, sizeof(line), "    box overlap:  %8.2f us/query, %.1f found on average %s\n",
+			boxMilliseconds * 1000.0 / queries, static_cast<double>(overlapping) / queries, boxesMatch ? "" : "MISMATCH");
+		report += line;
+	}
+
+	return report;
+}
+
+// Culls a scattered scene in insertion order and in Morton order. Visible runs counts the contiguous spans of
+// visible instance indices, the fewer the more of each cache line and instance fetch is used.
+inline std::string benchmarkMortonOrder(size_t count = 1000000, int repeat = 5)
+{
+	std::mt19937 random(1234);
+	std::uniform_real_distribution<float> unit(-1.f, 1.f);
+	std::vector<glm::vec3> positions(count);
+	for (glm::vec3& position : positions)
+		position = glm::vec3(unit(random), unit(random), unit(random)) * 500.f;
+	TransformStore transforms;
+	transforms.addMany(positions.data(), nullptr, nullptr, count);
+	transforms.compose();
+
+	glm::mat4 viewProjection = glm::perspective(glm::radians(45.f), 16.f / 9.f, 0.1f, 400.f) *
+		glm::lookAt(glm::vec3(0.f), glm::vec3(0.f, 0.f, -1.f), glm::vec3(0.f, 1.f, 0.f));
+	Frustum frustum(viewProjection);
+	InstanceCuller culler;
+	culler.setBounds(glm::vec3(-1.f), glm::vec3(1.f));
+	InstanceBvh bvh;
+	bvh.setBounds(glm::vec3(-1.f), glm::vec3(1.f));
+	std::vector<uint32_t> found;
+
+	char line[160];
+	std::string report;
+	std::snprintf(line, sizeof(line), "Morton order, %zu instances, best of %d\n", count, repeat);
+	report += line;
+
+	auto measure = [&](const char* name)
+	{
+		const glm::mat4* matrices = transforms.getMatrices().data();
+		double cullSeconds = 1e30, querySeconds = 1e30;
+		for (int run = 0; run < repeat; ++run)
+		{
+			auto start = std::chrono::steady_clock::now();
+			culler.cull(matrices, count, viewProjection);
+			cullSeconds = std::min(cullSeconds, benchmarkSeconds(start));
+		}
+		bvh.build(matrices, count);
+		for (int run = 0; run < repeat; ++run)
+		{
+			auto start = std::chrono::steady_clock::now();
+			bvh.queryFrustum(frustum, found);
+			querySeconds = std::min(querySeconds, benchmarkSeconds(start));
+		}
+
+		std::sort(found.begin(), found.end());
+		size_t runs = 0;
+		for (size_t i = 0; i < found.size(); ++i)
+			runs += i == 0 || found[i] != found[i - 1] + 1 ? 1 : 0;
+		std::snprintf(line, sizeof(line), "  %-10s cull %7.2f ms, BVH query %6.3f ms, BVH build %7.1f ms, %zu visible in %zu runs\n",
+			name, cullSeconds * 1000.0, querySeconds * 1000.0, bvh.getStats().buildMilliseconds, found.size(), runs);
+		report += line;
+	};
+
+	measure("insertion");
+
+	for (unsigned int threads : { 1u, ThreadPool::shared().getThreadCount() })
+	{
+		ThreadPool pool(threads);
+		MortonSorter fresh;
+		fresh.sort(transforms, pool);
+		std::snprintf(line, sizeof(line), "  full sort, %2u threads: %7.2f ms\n", threads, fresh.getStats().milliseconds);
+		report += line;
+	}
+
+	MortonSorter sorter;
+	sorter.sort(transforms);
+	auto start = std::chrono::steady_clock::now();
+	transforms.permute(sorter.getOrder().data());
+	transforms.compose();
+	std::snprintf(line, sizeof(line), "  permute and recompose: %7.2f ms\n", benchmarkSeconds(start) * 1000.0);
+	report += line;
+
+	measure("morton");
+
+	// A few instances wander off, only they get sorted again
+	size_t moved = count / 200;
+	for (size_t i = 0; i < moved; ++i)
+	{
+		size_t index = random() % count;
+		transforms.setPosition(index, transforms.getPosition(index) + glm::vec3(unit(random), unit(random), unit(random)) * 50.f);
+	}
+	sorter.sort(transforms);
+	const MortonSortStats& stats = sorter.getStats();
+	std::snprintf(line, sizeof(line), "  re-sort after moving %zu: %7.2f ms, %zu changed cell, %s\n",
+		moved, stats.milliseconds, stats.moved, stats.incremental ? "incremental" : "full");
+	report += line;
+	return report;
+}
@@ -0,0 +1,581 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cfloat>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "frustum.h"
+#include "threadpool.h"
+
+struct BvhBox
+{
+	glm::vec3 boxMin;
+	glm::vec3 boxMax;
+};
+
+// 32 bytes, two to a cache line
+struct BvhNode
+{
+	glm::vec3 boundsMin;
+	uint32_t first;		// leaf: first entry of its instances in the build order, internal: left child, the right one follows it
+	glm::vec3 boundsMax;
+	uint32_t count;		// leaf: instance count, internal: 0
+};
+
+struct BvhRayHit
+{
+	uint32_t instance = 0xffffffff;
+	float distance = 0.f;		// along the ray direction, 0 when the ray starts inside the box
+};
+
+struct BvhStats
+{
+	size_t instances = 0;
+	size_t nodes = 0;
+	size_t leaves = 0;
+	size_t builds = 0;
+	size_t refits = 0;
+	size_t refitted = 0;		// instances the last refit looked at
+	unsigned int threads = 1;	// last build
+	double buildMilliseconds = 0.0;
+	double refitMilliseconds = 0.0;
+};
+
+// Bounding volume hierarchy over the world space boxes of a mesh's instances, built top down by binned SAH.
+// The top levels are split on the calling thread until there is a subtree for every task of the pool, which
+// then builds them in parallel. Moving a few instances only refits their leaves' ancestors, update() picks
+// between that and a rebuild. Instances are named by their index in the matrix array, so removing one, which
+// moves another into its slot, needs a rebuild. Queries test instance boxes, a superset of the exact meshes.
+class InstanceBvh
+{
+public:
+	static const uint32_t maxLeafSize = 4;
+	static const unsigned int binCount = 16;
+	// Moving more than this fraction of the instances rebuilds instead of refitting the stretched tree
+	static constexpr float rebuildFraction = 0.25f;
+
+private:
+	static const uint32_t noParent = 0xffffffff;
+	static const size_t parallelGrain = 4096;	// smallest subtree built as a task of its own
+	static const int stackSize = 64;
+	// Nodes this deep become leaves whatever their size, so a traversal stack never holds more than stackSize
+	static const uint32_t maxDepth = stackSize - 2;
+
+	struct BuildTask
+	{
+		uint32_t node;
+		uint32_t first;
+		uint32_t count;
+		uint32_t depth;
+	};
+
+	// Instance boxes the build partitions in place, contiguous so a node's pass over them never misses the cache
+	struct BuildItem
+	{
+		glm::vec3 boxMin;
+		uint32_t instance;
+		glm::vec3 boxMax;
+	};
+
+	struct Bin
+	{
+		glm::vec3 boundsMin;
+		glm::vec3 boundsMax;
+		uint32_t count;
+	};
+
+	glm::vec3 meshMin;
+	glm::vec3 meshMax;
+	std::vector<BvhBox> boxes;			// per instance
+	std::vector<BuildItem> items;
+	std::vector<uint32_t> order;		// instances in leaf order, each node's instances are one range of it
+	std::vector<uint32_t> leafOf;		// per instance
+	std::vector<uint32_t> parents;		// per node
+	std::vector<BvhNode> nodes;
+	BvhStats stats;
+
+public:
+	InstanceBvh()
+		: meshMin(-0.5f), meshMax(0.5f)
+	{
+	}
+
+	// Mesh space bounds every instance matrix moves
+	void setBounds(const glm::vec3& boundsMin, const glm::vec3& boundsMax)
+	{
+		meshMin = boundsMin;
+		meshMax = boundsMax;
+	}
+
+	size_t size() const
+	{
+		return boxes.size();
+	}
+
+	const BvhStats& getStats() const
+	{
+		return stats;
+	}
+
+	const std::vector<BvhNode>& getNodes() const
+	{
+		return nodes;
+	}
+
+	const BvhBox& getBox(size_t instance) const
+	{
+		return boxes[instance];
+	}
+
+	// World box of the mesh bounds under matrix, the extents go through the absolute rotation and scale
+	BvhBox transformBox(const glm::mat4& matrix) const
+	{
+		glm::vec3 center = glm::vec3(matrix * glm::vec4((meshMin + meshMax) * 0.5f, 1.f));
+		glm::vec3 extent = (meshMax - meshMin) * 0.5f;
+		glm::vec3 worldExtent = glm::abs(glm::vec3(matrix[0])) * extent.x + glm::abs(glm::vec3(matrix[1])) * extent.y + glm::abs(glm::vec3(matrix[2])) * extent.z;
+		return { center - worldExtent, center + worldExtent };
+	}
+
+	void build(const glm::mat4* matrices, size_t count, ThreadPool& pool = ThreadPool::shared())
+	{
+		auto start = std::chrono::steady_clock::now();
+
+		boxes.resize(count);
+		items.resize(count);
+		order.resize(count);
+		leafOf.resize(count);
+		pool.parallelFor(count, parallelGrain, [&](size_t begin, size_t end)
+		{
+			for (size_t i = begin; i < end; ++i)
+			{
+				boxes[i] = transformBox(matrices[i]);
+				items[i] = { boxes[i].boxMin, static_cast<uint32_t>(i), boxes[i].boxMax };
+			}
+		});
+
+		// A binary tree with at least one instance per leaf never needs more than 2n - 1 nodes
+		nodes.resize(count > 0 ? count * 2 - 1 : 0);
+		parents.resize(nodes.size());
+		std::atomic<uint32_t> nodeCount(count > 0 ? 1 : 0);
+		if (count > 0)
+		{
+			parents[0] = noParent;
+			std::vector<BuildTask> tasks = { { 0, 0, static_cast<uint32_t>(count), 0 } };
+
+			// Breadth first on this thread until every task of the pool has a subtree of its own
+			size_t taskTarget = pool.getThreadCount() > 1 ? pool.getThreadCount() * 4 : 1;
+			std::vector<BuildTask> nextTasks;
+			while (tasks.size() < taskTarget)
+			{
+				bool split = false;
+				nextTasks.clear();
+				for (const BuildTask& task : tasks)
+				{
+					BuildTask left, right;
+					if (task.count < parallelGrain)
+						nextTasks.push_back(task);
+					else if (splitNode(task, nodeCount, left, right))
+					{
+						nextTasks.push_back(left);
+						nextTasks.push_back(right);
+						split = true;
+					}
+				}
+				tasks.swap(nextTasks);
+				if (!split)
+					break;
+			}
+
+			pool.run(tasks.size(), [&](size_t task)
+			{
+				buildSubtree(tasks[task], nodeCount);
+			});
+		}
+		nodes.resize(nodeCount);
+		parents.resize(nodeCount);
+
+		stats.instances = count;
+		stats.nodes = nodes.size();
+		stats.leaves = (nodes.size() + 1) / 2;
+		stats.threads = pool.getThreadCount();
+		++stats.builds;
+		stats.buildMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	}
+
+	// Moves the boxes of instances first to end and grows or shrinks their ancestors, stopping at the first one that keeps its bounds
+	void refit(const glm::mat4* matrices, size_t first, size_t end)
+	{
+		auto start = std::chrono::steady_clock::now();
+		end = glm::min(end, boxes.size());
+		for (size_t i = first; i < end; ++i)
+		{
+			BvhBox box = transformBox(matrices[i]);
+			if (box.boxMin == boxes[i].boxMin && box.boxMax == boxes[i].boxMax)
+				continue;
+			boxes[i] = box;
+			for (uint32_t node = leafOf[i]; node != noParent && refitNode(node); node = parents[node]);
+		}
+		finishRefit(start, first < end ? end - first : 0);
+	}
+
+	// Moves every box and refits every node, children always come after their parent so one backwards pass does it
+	void refitAll(const glm::mat4* matrices, ThreadPool& pool = ThreadPool::shared())
+	{
+		auto start = std::chrono::steady_clock::now();
+		pool.parallelFor(boxes.size(), parallelGrain, [&](size_t begin, size_t end)
+		{
+			for (size_t i = begin; i < end; ++i)
+				boxes[i] = transformBox(matrices[i]);
+		});
+		for (size_t node = nodes.size(); node-- > 0;)
+			refitNode(static_cast<uint32_t>(node));
+		finishRefit(start, boxes.size());
+	}
+
+	// Brings the tree in step with matrices after moved instances changed somewhere in [first, end): rebuilds when the
+	// count changed or more than rebuildFraction of them moved, refits otherwise
+	void update(const glm::mat4* matrices, size_t count, size_t first, size_t end, size_t moved, ThreadPool& pool = ThreadPool::shared())
+	{
+		if (count != boxes.size() || stats.builds == 0 || moved > count * rebuildFraction)
+			build(matrices, count, pool);
+		else if (first < end)
+			refit(matrices, first, end);
+	}
+
+	// Replaces out with every instance whose box touches the frustum, subtrees inside it are taken whole
+	size_t queryFrustum(const Frustum& frustum, std::vector<uint32_t>& out) const
+	{
+		out.clear();
+		if (nodes.empty())
+			return 0;
+
+		uint32_t stack[stackSize];
+		int top = 0;
+		stack[top++] = 0;
+		while (top > 0)
+		{
+			const BvhNode& node = nodes[stack[--top]];
+			if (!frustum.intersectsBox(node.boundsMin, node.boundsMax))
+				continue;
+			if (node.count > 0)
+			{
+				for (uint32_t i = node.first; i < node.first + node.count; ++i)
+					if (frustum.intersectsBox(boxes[order[i]].boxMin, boxes[order[i]].boxMax))
+						out.push_back(order[i]);
+			}
+			else if (frustum.containsBox(node.boundsMin, node.boundsMax))
+			{
+				uint32_t first, end;
+				subtreeRange(node, first, end);
+				out.insert(out.end(), order.begin() + first, order.begin() + end);
+			}
+			else
+			{
+				stack[top++] = node.first + 1;
+				stack[top++] = node.first;
+			}
+		}
+		return out.size();
+	}
+
+	// Replaces out with every instance whose box overlaps [boxMin, boxMax]
+	size_t queryBox(const glm::vec3& boxMin, const glm::vec3& boxMax, std::vector<uint32_t>& out) const
+	{
+		out.clear();
+		if (nodes.empty())
+			return 0;
+
+		uint32_t stack[stackSize];
+		int top = 0;
+		stack[top++] = 0;
+		while (top > 0)
+		{
+			const BvhNode& node = nodes[stack[--top]];
+			if (!overlaps(node.boundsMin, node.boundsMax, boxMin, boxMax))
+				continue;
+			if (node.count == 0)
+			{
+				stack[top++] = node.first + 1;
+				stack[top++] = node.first;
+				continue;
+			}
+			for (uint32_t i = node.first; i < node.first + node.count; ++i)
+				if (overlaps(boxes[order[i]].boxMin, boxes[order[i]].boxMax, boxMin, boxMax))
+					out.push_back(order[i]);
+		}
+		return out.size();
+	}
+
+	// Nearest instance box the ray enters within maxDistance, nearer children are visited first so farther ones are mostly skipped
+	bool raycast(const glm::vec3& origin, const glm::vec3& direction, float maxDistance, BvhRayHit& hit) const
+	{
+		hit = BvhRayHit();
+		if (nodes.empty())
+			return false;
+
+		glm::vec3 inverse = 1.f / direction;
+		float nearest = maxDistance;
+		uint32_t stack[stackSize];
+		int top = 0;
+		if (slab(origin, inverse, nodes[0].boundsMin, nodes[0].boundsMax, nearest) >= 0.f)
+			stack[top++] = 0;
+		while (top > 0)
+		{
+			const BvhNode& node = nodes[stack[--top]];
+			if (node.count > 0)
+			{
+				for (uint32_t i = node.first; i < node.first + node.count; ++i)
+				{
+					float distance = slab(origin, inverse, boxes[order[i]].boxMin, boxes[order[i]].boxMax, nearest);
+					if (distance >= 0.f)
+					{
+						nearest = distance;
+						hit.instance = order[i];
+						hit.distance = distance;
+					}
+				}
+				continue;
+			}
+
+			const BvhNode& left = nodes[node.first];
+			const BvhNode& right = nodes[node.first + 1];
+			float leftDistance = slab(origin, inverse, left.boundsMin, left.boundsMax, nearest);
+			float rightDistance = slab(origin, inverse, right.boundsMin, right.boundsMax, nearest);
+			bool leftFirst = leftDistance >= 0.f && (rightDistance < 0.f || leftDistance <= rightDistance);
+			// Pushed far first so the near one pops next
+			if (leftFirst)
+			{
+				if (rightDistance >= 0.f)
+					stack[top++] = node.first + 1;
+				stack[top++] = node.first;
+			}
+			else if (rightDistance >= 0.f)
+			{
+				if (leftDistance >= 0.f)
+					stack[top++] = node.first;
+				stack[top++] = node.first + 1;
+			}
+		}
+		return hit.instance != BvhRayHit().instance;
+	}
+
+private:
+	static float area(const glm::vec3& boundsMin, const glm::vec3& boundsMax)
+	{
+		glm::vec3 size = boundsMax - boundsMin;
+		return size.x * size.y + size.y * size.z + size.z * size.x;
+	}
+
+	static bool overlaps(const glm::vec3& aMin, const glm::vec3& aMax, const glm::vec3& bMin, const glm::vec3& bMax)
+	{
+		return aMin.x <= bMax.x && aMax.x >= bMin.x && aMin.y <= bMax.y && aMax.y >= bMin.y && aMin.z <= bMax.z && aMax.z >= bMin.z;
+	}
+
+	// Entry distance of the ray into the box if it enters before maxDistance, -1 otherwise
+	static float slab(const glm::vec3& origin, const glm::vec3& inverse, const glm::vec3& boxMin, const glm::vec3& boxMax, float maxDistance)
+	{
+		glm::vec3 t0 = (boxMin - origin) * inverse;
+		glm::vec3 t1 = (boxMax - origin) * inverse;
+		glm::vec3 tMin = glm::min(t0, t1);
+		glm::vec3 tMax = glm::max(t0, t1);
+		float enter = glm::max(glm::max(tMin.x, tMin.y), glm::max(tMin.z, 0.f));
+		float exit = glm::min(glm::min(tMax.x, tMax.y), glm::min(tMax.z, maxDistance));
+		return enter <= exit ? enter : -1.f;
+	}
+
+	// Every internal node has two children, so its instances run from its leftmost leaf to its rightmost one
+	void subtreeRange(const BvhNode& node, uint32_t& first, uint32_t& end) const
+	{
+		const BvhNode* leftmost = &node;
+		while (leftmost->count == 0)
+			leftmost = &nodes[leftmost->first];
+		const BvhNode* rightmost = &node;
+		while (rightmost->count == 0)
+			rightmost = &nodes[rightmost->first + 1];
+		first = leftmost->first;
+		end = rightmost->first + rightmost->count;
+	}
+
+	// Recomputes the bounds from the children or instances, returns whether they changed
+	bool refitNode(uint32_t index)
+	{
+		BvhNode& node = nodes[index];
+		glm::vec3 boundsMin(FLT_MAX), boundsMax(-FLT_MAX);
+		if (node.count > 0)
+		{
+			for (uint32_t i = node.first; i < node.first + node.count; ++i)
+			{
+				boundsMin = glm::min(boundsMin, boxes[order[i]].boxMin);
+				boundsMax = glm::max(boundsMax, boxes[order[i]].boxMax);
+			}
+		}
+		else
+		{
+			boundsMin = glm::min(nodes[node.first].boundsMin, nodes[node.first + 1].boundsMin);
+			boundsMax = glm::max(nodes[node.first].boundsMax, nodes[node.first + 1].boundsMax);
+		}
+		if (boundsMin == node.boundsMin && boundsMax == node.boundsMax)
+			return false;
+		node.boundsMin = boundsMin;
+		node.boundsMax = boundsMax;
+		return true;
+	}
+
+	void finishRefit(const std::chrono::steady_clock::time_point& start, size_t refitted)
+	{
+		++stats.refits;
+		stats.refitted = refitted;
+		stats.refitMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	}
+
+	void buildSubtree(const BuildTask& root, std::atomic<uint32_t>& nodeCount)
+	{
+		std::vector<BuildTask> pending = { root };
+		while (!pending.empty())
+		{
+			BuildTask task = pending.back();
+			pending.pop_back();
+			BuildTask left, right;
+			if (splitNode(task, nodeCount, left, right))
+			{
+				pending.push_back(right);
+				pending.push_back(left);
+			}
+		}
+	}
+
+	void makeLeaf(const BuildTask& task)
+	{
+		nodes[task.node].first = task.first;
+		nodes[task.node].count = task.count;
+		for (uint32_t i = task.first; i < task.first + task.count; ++i)
+		{
+			order[i] = items[i].instance;
+			leafOf[order[i]] = task.node;
+		}
+	}
+
+	// Sets the node's bounds and either makes it a leaf or splits its instances at the cheapest of binCount - 1
+	// planes on each axis, by surface area times instance count, then returns true with the two children
+	bool splitNode(const BuildTask& task, std::atomic<uint32_t>& nodeCount, BuildTask& left, BuildTask& right)
+	{
+		// Centroids are kept doubled, min + max, they only get compared and binned
+		BuildItem* instances = items.data() + task.first;
+		glm::vec3 boundsMin(FLT_MAX), boundsMax(-FLT_MAX);
+		glm::vec3 centroidMin(FLT_MAX), centroidMax(-FLT_MAX);
+		for (uint32_t i = 0; i < task.count; ++i)
+		{
+			const BuildItem& item = instances[i];
+			boundsMin = glm::min(boundsMin, item.boxMin);
+			boundsMax = glm::max(boundsMax, item.boxMax);
+			centroidMin = glm::min(centroidMin, item.boxMin + item.boxMax);
+			centroidMax = glm::max(centroidMax, item.boxMin + item.boxMax);
+		}
+		BvhNode& node = nodes[task.node];
+		node.boundsMin = boundsMin;
+		node.boundsMax = boundsMax;
+
+		if (task.count <= maxLeafSize || task.depth >= maxDepth)
+		{
+			makeLeaf(task);
+			return false;
+		}
+
+		glm::vec3 extent = centroidMax - centroidMin;
+		Bin bins[3][binCount];
+		for (int axis = 0; axis < 3; ++axis)
+			for (Bin& bin : bins[axis])
+				bin = { glm::vec3(FLT_MAX), glm::vec3(-FLT_MAX), 0 };
+
+		glm::vec3 scale(0.f);
+		for (int axis = 0; axis < 3; ++axis)
+			if (extent[axis] > 0.f)
+				scale[axis] = binCount / extent[axis];
+		auto binOf = [&](const BuildItem& item, int axis)
+		{
+			int bin = static_cast<int>((item.boxMin[axis] + item.boxMax[axis] - centroidMin[axis]) * scale[axis]);
+			return glm::min(bin, static_cast<int>(binCount) - 1);
+		};
+
+		for (uint32_t i = 0; i < task.count; ++i)
+		{
+			const BuildItem& item = instances[i];
+			for (int axis = 0; axis < 3; ++axis)
+			{
+				if (scale[axis] == 0.f)
+					continue;
+				Bin& bin = bins[axis][binOf(item, axis)];
+				bin.boundsMin = glm::min(bin.boundsMin, item.boxMin);
+				bin.boundsMax = glm::max(bin.boundsMax, item.boxMax);
+				++bin.count;
+			}
+		}
+
+		// Sweep each axis from the right for the area and count past every plane, then from the left
+		float bestCost = FLT_MAX;
+		int bestAxis = -1;
+		int bestPlane = 0;
+		for (int axis = 0; axis < 3; ++axis)
+		{
+			if (scale[axis] == 0.f)
+				continue;
+			float rightCost[binCount];
+			glm::vec3 sweepMin(FLT_MAX), sweepMax(-FLT_MAX);
+			uint32_t sweepCount = 0;
+			for (int plane = binCount - 1; plane > 0; --plane)
+			{
+				const Bin& bin = bins[axis][plane];
+				sweepMin = glm::min(sweepMin, bin.boundsMin);
+				sweepMax = glm::max(sweepMax, bin.boundsMax);
+				sweepCount += bin.count;
+				rightCost[plane] = sweepCount > 0 ? area(sweepMin, sweepMax) * sweepCount : -1.f;
+			}
+			sweepMin = glm::vec3(FLT_MAX);
+			sweepMax = glm::vec3(-FLT_MAX);
+			sweepCount = 0;
+			for (int plane = 1; plane < static_cast<int>(binCount); ++plane)
+			{
+				const Bin& bin = bins[axis][plane - 1];
+				sweepMin = glm::min(sweepMin, bin.boundsMin);
+				sweepMax = glm::max(sweepMax, bin.boundsMax);
+				sweepCount += bin.count;
+				if (sweepCount == 0 || rightCost[plane] < 0.f)
+					continue;
+				float cost = area(sweepMin, sweepMax) * sweepCount + rightCost[plane];
+				if (cost < bestCost)
+				{
+					bestCost = cost;
+					bestAxis = axis;
+					bestPlane = plane;
+				}
+			}
+		}
+
+		uint32_t leftCount;
+		if (bestAxis < 0)
+		{
+			// Every centroid in one spot, no plane separates them
+			leftCount = task.count / 2;
+		}
+		else
+		{
+			BuildItem* middle = std::partition(instances, instances + task.count,
+				[&](const BuildItem& item) { return binOf(item, bestAxis) < bestPlane; });
+			leftCount = static_cast<uint32_t>(middle - instances);
+		}
+
+		uint32_t child = nodeCount.fetch_add(2);
+		node.first = child;
+		node.count = 0;
+		parents[child] = task.node;
+		parents[child + 1] = task.node;
+		left = { child, task.first, leftCount, task.depth + 1 };
+		right = { child + 1, task.first + leftCount, task.count - leftCount, task.depth + 1 };
+		return true;
+	}
+};
@@ -0,0 +1,148 @@
+#pragma once
+
+#include <glad/glad.h>
+
+#include <cstddef>
+
+#include <glm/glm.hpp>
+
+// std140 layout of the Camera uniform block, declare it in a shader as
+//
+//     layout (std140) uniform Camera
+//     {
+//         mat4 view;
+//         mat4 projection;
+//         mat4 viewProjection;
+//         vec4 cameraPosition;
+//         float time;
+//     };
+struct CameraBlock
+{
+	glm::mat4 view;
+	glm::mat4 projection;
+	glm::mat4 viewProjection;
+	glm::vec4 position;			// w unused
+	float time;
+	float padding[3];
+};
+static_assert(sizeof(CameraBlock) == 224, "CameraBlock has to match the std140 layout of the Camera block");
+
+// Camera block written once per frame and read by every program declaring it, at binding point
+// CameraBuffer::binding. GLSL 330 cannot pick a block's binding, Shader binds it after linking.
+// update() writes the next of segmentCount slots of one buffer with an unsynchronized mapping, a fence
+// per slot makes sure the GPU is done with it first. An update only waits when the GPU is segmentCount
+// frames behind, getWaits() counts those.
+class CameraBuffer
+{
+public:
+	static const GLuint binding = 0;
+	static const unsigned int segmentCount = 3;
+
+private:
+	unsigned int buffer;
+	GLsizeiptr stride;
+	unsigned int segment;
+	GLsync fences[segmentCount];
+	size_t waits;
+	CameraBlock block;
+
+public:
+	CameraBuffer()
+		: buffer(0), stride(0), segment(0), fences(), waits(0), block()
+	{
+	}
+
+	~CameraBuffer()
+	{
+		for (GLsync sync : fences)
+			if (sync)
+				glDeleteSync(sync);
+		if (buffer)
+			glDeleteBuffers(1, &buffer);
+	}
+
+	CameraBuffer(const CameraBuffer&) = delete;
+	CameraBuffer& operator=(const CameraBuffer&) = delete;
+
+	// Never destroyed, static destruction would run after the context is gone
+	static CameraBuffer& shared()
+	{
+		static CameraBuffer* camera = new CameraBuffer();
+		return *camera;
+	}
+
+	// Points the program's Camera block, if it has one, at the binding
+	static void bindBlock(unsigned int program)
+	{
+		GLuint index = glGetUniformBlockIndex(program, "Camera");
+		if (index != GL_INVALID_INDEX)
+			glUniformBlockBinding(program, index, binding);
+	}
+
+	const CameraBlock& getBlock() const
+	{
+		return block;
+	}
+
+	// Updates that found their slot still in use by the GPU and had to wait for it
+	size_t getWaits() const
+	{
+		return waits;
+	}
+
+	// Writes the camera for the draws that follow, the position comes from the inverse view
+	void update(const glm::mat4& view, const glm::mat4& projection, float time)
+	{
+		if (!buffer)
+			allocate();
+		else
+		{
+			// Every draw reading the current slot has been issued by now
+			fences[segment] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+			segment = (segment + 1) % segmentCount;
+		}
+
+		if (fences[segment])
+		{
+			if (glClientWaitSync(fences[segment], 0, 0) == GL_TIMEOUT_EXPIRED)
+			{
+				++waits;
+				glClientWaitSync(fences[segment], GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);
+			}
+			glDeleteSync(fences[segment]);
+			fences[segment] = nullptr;
+		}
+
+		block.view = view;
+		block.projection = projection;
+		block.viewProjection = projection * view;
+		block.position = glm::vec4(glm::vec3(glm::inverse(view)[3]), 1.f);
+		block.time = time;
+
+		glBindBuffer(GL_UNIFORM_BUFFER, buffer);
+		void* data = glMapBufferRange(GL_UNIFORM_BUFFER, segment * stride, sizeof(CameraBlock),
+			GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_INVALIDATE_RANGE_BIT);
+		if (data)
+		{
+			*static_cast<CameraBlock*>(data) = block;
+			glUnmapBuffer(GL_UNIFORM_BUFFER);
+		}
+		glBindBuffer(GL_UNIFORM_BUFFER, 0);
+		glBindBufferRange(GL_UNIFORM_BUFFER, binding, buffer, segment * stride, sizeof(CameraBlock));
+	}
+
+private:
+	void allocate()
+	{
+		// Every slot starts on the offset alignment glBindBufferRange asks for
+		GLint alignment = 256;
+		glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+		stride = (sizeof(CameraBlock) + alignment - 1) / alignment * alignment;
+
+		glGenBuffers(1, &buffer);
+		glBindBuffer(GL_UNIFORM_BUFFER, buffer);
+		glBufferData(GL_UNIFORM_BUFFER, stride * segmentCount, nullptr, GL_DYNAMIC_DRAW);
+		glBindBuffer(GL_UNIFORM_BUFFER, 0);
+		segment = 0;
+	}
+};
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+// Six planes pointing inwards, extracted from a projection * view (* model) matrix.
+// Planes of a matrix that includes a model transform are in that model's space.
+struct Frustum
+{
+	glm::vec4 planes[6];
+
+	Frustum(const glm::mat4& matrix)
+	{
+		glm::vec4 rows[4];
+		for (int row = 0; row < 4; ++row)
+			rows[row] = glm::vec4(matrix[0][row], matrix[1][row], matrix[2][row], matrix[3][row]);
+
+		planes[0] = rows[3] + rows[0];	// left
+		planes[1] = rows[3] - rows[0];	// right
+		planes[2] = rows[3] + rows[1];	// bottom
+		planes[3] = rows[3] - rows[1];	// top
+		planes[4] = rows[3] + rows[2];	// near
+		planes[5] = rows[3] - rows[2];	// far
+
+		for (glm::vec4& plane : planes)
+		{
+			float length = glm::length(glm::vec3(plane));
+			if (length > 0.f)
+				plane /= length;
+		}
+	}
+
+	bool intersectsSphere(const glm::vec3& center, float radius) const
+	{
+		for (const glm::vec4& plane : planes)
+			if (glm::dot(glm::vec3(plane), center) + plane.w < -radius)
+				return false;
+		return true;
+	}
+
+	bool intersectsBox(const glm::vec3& boxMin, const glm::vec3& boxMax) const
+	{
+		for (const glm::vec4& plane : planes)
+		{
+			// Corner furthest along the plane normal
+			glm::vec3 corner(
+				plane.x >= 0.f ? boxMax.x : boxMin.x,
+				plane.y >= 0.f ? boxMax.y : boxMin.y,
+				plane.z >= 0.f ? boxMax.z : boxMin.z);
+			if (glm::dot(glm::vec3(plane), corner) + plane.w < 0.f)
+				return false;
+		}
+		return true;
+	}
+
+	// Whole box on the inner side of every plane
+	bool containsBox(const glm::vec3& boxMin, const glm::vec3& boxMax) const
+	{
+		for (const glm::vec4& plane : planes)
+		{
+			// Corner furthest against the plane normal
+			glm::vec3 corner(
+				plane.x >= 0.f ? boxMin.x : boxMax.x,
+				plane.y >= 0.f ? boxMin.y : boxMax.y,
+				plane.z >= 0.f ? boxMin.z : boxMax.z);
+			if (glm::dot(glm::vec3(plane), corner) + plane.w < 0.f)
+				return false;
+		}
+		return true;
+	}
+};
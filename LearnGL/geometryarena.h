@@ -0,0 +1,246 @@
+#pragma once
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+#include <cstdint>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "instancebuffer.h"
+#include "instancering.h"
+#include "objloader.h"
+#include "vertexformat.h"
+
+// Layout glMultiDrawElementsIndirect reads from GL_DRAW_INDIRECT_BUFFER
+struct DrawElementsIndirectCommand
+{
+	GLuint count;
+	GLuint instanceCount;
+	GLuint firstIndex;
+	GLint baseVertex;
+	GLuint baseInstance;
+};
+
+// Where one mesh lives inside the arena
+struct ArenaMesh
+{
+	GLuint firstIndex;
+	GLuint indexCount;
+	GLint baseVertex;
+};
+
+struct GeometryArenaStats
+{
+	size_t meshes = 0;
+	size_t vertices = 0;
+	size_t indices = 0;
+	size_t commands = 0;		// last draw()
+	size_t instances = 0;		// last draw()
+	size_t drawCalls = 0;		// last draw()
+};
+
+// Static geometry of every mesh in one vertex and one index buffer, each mesh addressed by its base vertex
+// and first index, plus one instance buffer shared by all of them. Meshes queue their instances with submit()
+// and draw() sends the whole queue as one glMultiDrawElementsIndirect, so call it once per shader and texture
+// combination. Needs GL 4.3 or GL_ARB_multi_draw_indirect with GL_ARB_base_instance, enable() fails otherwise
+// and the classes keep drawing themselves.
+class GeometryArena
+{
+private:
+	bool enabled;
+	unsigned int VAO;
+	unsigned int VBO;
+	unsigned int EBO;
+	unsigned int instanceVBO;
+	unsigned int indirectBuffer;
+	std::vector<Vertex> vertices;
+	std::vector<uint32_t> indices;
+	std::vector<ArenaMesh> meshes;
+	bool geometryDirty;
+	std::vector<glm::mat4> instanceMatrices;
+	std::vector<DrawElementsIndirectCommand> commands;
+	size_t instanceCapacity;
+	size_t commandCapacity;
+	GeometryArenaStats stats;
+
+public:
+	GeometryArena()
+		: enabled(false), VAO(0), VBO(0), EBO(0), instanceVBO(0), indirectBuffer(0), geometryDirty(false), instanceCapacity(0), commandCapacity(0)
+	{
+	}
+
+	~GeometryArena()
+	{
+		if (!VAO)
+			return;
+		glDeleteVertexArrays(1, &VAO);
+		glDeleteBuffers(1, &VBO);
+		glDeleteBuffers(1, &EBO);
+		glDeleteBuffers(1, &instanceVBO);
+		glDeleteBuffers(1, &indirectBuffer);
+	}
+
+	GeometryArena(const GeometryArena&) = delete;
+	GeometryArena& operator=(const GeometryArena&) = delete;
+
+	// The arena the primitive classes add their geometry to, enable it before creating them.
+	// Never destroyed, static destruction would run after the context is gone.
+	static GeometryArena& shared()
+	{
+		static GeometryArena* arena = new GeometryArena();
+		return *arena;
+	}
+
+	static bool supported()
+	{
+		if (!glad_glMultiDrawElementsIndirect && glfwExtensionSupported("GL_ARB_multi_draw_indirect"))
+			glad_glMultiDrawElementsIndirect = reinterpret_cast<PFNGLMULTIDRAWELEMENTSINDIRECTPROC>(glfwGetProcAddress("glMultiDrawElementsIndirect"));
+		return glad_glMultiDrawElementsIndirect != nullptr && InstanceRing::hasBaseInstance();
+	}
+
+	bool enable()
+	{
+		if (enabled)
+			return true;
+		if (!supported())
+			return false;
+
+		glGenVertexArrays(1, &VAO);
+		glGenBuffers(1, &VBO);
+		glGenBuffers(1, &EBO);
+		glGenBuffers(1, &instanceVBO);
+		glGenBuffers(1, &indirectBuffer);
+
+		glBindVertexArray(VAO);
+		glBindBuffer(GL_ARRAY_BUFFER, VBO);
+		setVertexAttributes(VertexFormat::Full);
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
+		// Each command's base instance offsets these, so they always start at the beginning
+		glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
+		setInstanceAttributes();
+		glBindVertexArray(0);
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+		enabled = true;
+		return true;
+	}
+
+	bool isEnabled() const
+	{
+		return enabled;
+	}
+
+	const GeometryArenaStats& getStats() const
+	{
+		return stats;
+	}
+
+	const ArenaMesh& getMesh(size_t mesh) const
+	{
+		return meshes[mesh];
+	}
+
+	// Appends a mesh and returns its id, or -1 while the arena is not enabled. Indices are indexSize (2 or 4) bytes
+	// each. Nothing is sent before the next draw().
+	int addMesh(const Vertex* meshVertices, size_t vertexCount, const void* meshIndices, size_t indexSize, size_t indexCount)
+	{
+		if (!enabled)
+			return -1;
+
+		ArenaMesh mesh;
+		mesh.firstIndex = static_cast<GLuint>(indices.size());
+		mesh.indexCount = static_cast<GLuint>(indexCount);
+		mesh.baseVertex = static_cast<GLint>(vertices.size());
+		vertices.insert(vertices.end(), meshVertices, meshVertices + vertexCount);
+		for (size_t i = 0; i < indexCount; ++i)
+			indices.push_back(indexSize == sizeof(uint16_t) ? static_cast<const uint16_t*>(meshIndices)[i] : static_cast<const uint32_t*>(meshIndices)[i]);
+
+		meshes.push_back(mesh);
+		geometryDirty = true;
+		stats.meshes = meshes.size();
+		stats.vertices = vertices.size();
+		stats.indices = indices.size();
+		return static_cast<int>(meshes.size() - 1);
+	}
+
+	// For the hard coded primitives, three position and two texCoord floats per vertex and no normals
+	int addMesh(const float* positions, const float* texCoords, size_t vertexCount, const unsigned int* meshIndices, size_t indexCount)
+	{
+		std::vector<Vertex> meshVertices(vertexCount);
+		for (size_t i = 0; i < vertexCount; ++i)
+		{
+			meshVertices[i].position = glm::vec3(positions[i * 3], positions[i * 3 + 1], positions[i * 3 + 2]);
+			meshVertices[i].texCoord = glm::vec2(texCoords[i * 2], texCoords[i * 2 + 1]);
+			meshVertices[i].normal = glm::vec3(0.f);
+		}
+		return addMesh(meshVertices.data(), vertexCount, meshIndices, sizeof(unsigned int), indexCount);
+	}
+
+	// Queues count instances of mesh for the next draw(), which sends them together with every other mesh
+	// here. False for a mesh that is not in the arena, such as the -1 of one added while it was disabled,
+	// the primitives' drawBatched() then draws it right away.
+	bool submit(int mesh, const glm::mat4* matrices, size_t count)
+	{
+		if (mesh < 0 || static_cast<size_t>(mesh) >= meshes.size())
+			return false;
+		if (count == 0)
+			return true;
+
+		DrawElementsIndirectCommand command;
+		command.count = meshes[mesh].indexCount;
+		command.instanceCount = static_cast<GLuint>(count);
+		command.firstIndex = meshes[mesh].firstIndex;
+		command.baseVertex = meshes[mesh].baseVertex;
+		command.baseInstance = static_cast<GLuint>(instanceMatrices.size());
+		commands.push_back(command);
+		instanceMatrices.insert(instanceMatrices.end(), matrices, matrices + count);
+		return true;
+	}
+
+	// Draws everything submitted since the last draw() with the bound shader and textures
+	void draw()
+	{
+		stats.commands = commands.size();
+		stats.instances = instanceMatrices.size();
+		stats.drawCalls = 0;
+		if (!enabled || commands.empty())
+			return;
+
+		// The element buffer binding belongs to the VAO
+		glBindVertexArray(VAO);
+		if (geometryDirty)
+		{
+			glBindBuffer(GL_ARRAY_BUFFER, VBO);
+			glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(Vertex), vertices.data(), GL_STATIC_DRAW);
+			glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
+			glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(uint32_t), indices.data(), GL_STATIC_DRAW);
+			geometryDirty = false;
+		}
+
+		// Orphaned every draw, the queue is rebuilt every frame
+		bool grown = instanceMatrices.size() > instanceCapacity;
+		if (grown)
+			instanceCapacity = instanceMatrices.size() + instanceMatrices.size() / 2;
+		glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
+		glBufferData(GL_ARRAY_BUFFER, instanceCapacity * sizeof(glm::mat4), nullptr, GL_STREAM_DRAW);
+		glBufferSubData(GL_ARRAY_BUFFER, 0, instanceMatrices.size() * sizeof(glm::mat4), instanceMatrices.data());
+		InstanceBuffer::recordUpload(instanceMatrices.size() * sizeof(glm::mat4), grown);
+
+		if (commands.size() > commandCapacity)
+			commandCapacity = commands.size() + commands.size() / 2;
+		glBindBuffer(GL_DRAW_INDIRECT_BUFFER, indirectBuffer);
+		glBufferData(GL_DRAW_INDIRECT_BUFFER, commandCapacity * sizeof(DrawElementsIndirectCommand), nullptr, GL_STREAM_DRAW);
+		glBufferSubData(GL_DRAW_INDIRECT_BUFFER, 0, commands.size() * sizeof(DrawElementsIndirectCommand), commands.data());
+
+		glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT, nullptr, static_cast<GLsizei>(commands.size()), 0);
+		glBindVertexArray(0);
+		glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+		stats.drawCalls = 1;
+
+		commands.clear();
+		instanceMatrices.clear();
+	}
+};
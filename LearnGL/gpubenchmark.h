@@ -0,0 +1,443 @@
+#pragma once
+
+#include <glad/glad.h>
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "primitives.h"
+#include "shader.h"
+
+// GPU benchmarks, run inside a frame with a current context and return a printable report
+
+// Small offscreen target so draws cost vertex work rather than fill rate
+class BenchmarkTarget
+{
+private:
+	unsigned int FBO;
+	unsigned int colorRBO;
+	unsigned int depthRBO;
+	int previousViewport[4];
+	int previousFramebuffer;
+	int size;
+
+public:
+	BenchmarkTarget(int size = 64)
+		: size(size)
+	{
+		glGetIntegerv(GL_VIEWPORT, previousViewport);
+		glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &previousFramebuffer);
+
+		glGenRenderbuffers(1, &colorRBO);
+		glBindRenderbuffer(GL_RENDERBUFFER, colorRBO);
+		glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, size, size);
+		glGenRenderbuffers(1, &depthRBO);
+		glBindRenderbuffer(GL_RENDERBUFFER, depthRBO);
+		glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, size, size);
+		glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+		glGenFramebuffers(1, &FBO);
+		glBindFramebuffer(GL_FRAMEBUFFER, FBO);
+		glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, colorRBO);
+		glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, depthRBO);
+		glViewport(0, 0, size, size);
+	}
+
+	~BenchmarkTarget()
+	{
+		glBindFramebuffer(GL_FRAMEBUFFER, previousFramebuffer);
+		glViewport(previousViewport[0], previousViewport[1], previousViewport[2], previousViewport[3]);
+		glDeleteFramebuffers(1, &FBO);
+		glDeleteRenderbuffers(1, &colorRBO);
+		glDeleteRenderbuffers(1, &depthRBO);
+	}
+
+	BenchmarkTarget(const BenchmarkTarget&) = delete;
+	BenchmarkTarget& operator=(const BenchmarkTarget&) = delete;
+
+	void clear()
+	{
+		glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+	}
+};
+
+// GPU time of everything issued by fn, measured with a GL_TIME_ELAPSED query
+template<typename Fn>
+double gpuMilliseconds(Fn fn)
+{
+	unsigned int query;
+	glGenQueries(1, &query);
+	glBeginQuery(GL_TIME_ELAPSED, query);
+	fn();
+	glEndQuery(GL_TIME_ELAPSED);
+
+	GLuint64 nanoseconds = 0;
+	glGetQueryObjectui64v(query, GL_QUERY_RESULT, &nanoseconds);
+	glDeleteQueries(1, &query);
+	return static_cast<double>(nanoseconds) / 1e6;
+}
+
+// Draws the same mesh stored as Vertex and as CompactVertex and compares triangle throughput
+inline std::string benchmarkVertexFormats(const char* objPath, Shader& fullShader, Shader& compactShader,
+	const glm::mat4& view, const glm::mat4& projection, unsigned int instanceCount = 512, int frames = 16)
+{
+	Object full(objPath, instanceCount, VertexFormat::Full);
+	Object compact(objPath, instanceCount, VertexFormat::Compact);
+
+	char line[160];
+	std::string report;
+	const QuantizationError& error = compact.getQuantizationError();
+	std::snprintf(line, sizeof(line), "Vertex formats, %u instances x %zu triangles\n", instanceCount, full.getMeshStats().indexCount / 3);
+	report += line;
+	std::snprintf(line, sizeof(line), "  compact error: position %.2e, normal %.3f deg, texCoord %.2e\n", error.position, error.normalDegrees, error.texCoord);
+	report += line;
+
+	BenchmarkTarget target;
+	Object* objects[] = { &full, &compact };
+	Shader* shaders[] = { &fullShader, &compactShader };
+	const char* names[] = { "full", "compact" };
+	size_t vertexSizes[] = { sizeof(Vertex), sizeof(CompactVertex) };
+
+	for (int i = 0; i < 2; ++i)
+	{
+		shaders[i]->use();
+		CameraBuffer::shared().update(view, projection, static_cast<float>(glfwGetTime()));
+
+		// Warm up once so driver side validation is not timed
+		target.clear();
+		objects[i]->draw();
+
+		double milliseconds = gpuMilliseconds([&]
+		{
+			for (int frame = 0; frame < frames; ++frame)
+			{
+				target.clear();
+				objects[i]->draw();
+			}
+		}) / frames;
+
+		double triangles = static_cast<double>(objects[i]->getMeshStats().indexCount / 3) * instanceCount;
+		std::snprintf(line, sizeof(line), "  %-7s %2zu B/vertex, %.1f KB: %7.3f ms %8.1f Mtri/s\n",
+			names[i], vertexSizes[i], objects[i]->getMeshStats().vertexCount * vertexSizes[i] / 1024.0, milliseconds, triangles / (milliseconds * 1000.0));
+		report += line;
+	}
+
+	return report;
+}
+
+// Draws a grid of instances receding from the camera at full detail and with per instance levels of detail
+inline std::string benchmarkLodCrowd(const char* objPath, Shader& shader, const glm::mat4& view, const glm::mat4& projection,
+	int columns = 32, int rows = 32, float spacing = 4.f, int frames = 16)
+{
+	// Grid on the camera's ground plane, starting just in front of it
+	glm::mat4 cameraToWorld = glm::inverse(view);
+	glm::vec3 cameraPosition = glm::vec3(cameraToWorld[3]);
+	glm::vec3 forward = -glm::normalize(glm::vec3(cameraToWorld[2]));
+	glm::vec3 right = glm::normalize(glm::vec3(cameraToWorld[0]));
+
+	std::vector<glm::mat4> matrices;
+	matrices.reserve(static_cast<size_t>(columns) * rows);
+	for (int row = 0; row < rows; ++row)
+		for (int column = 0; column < columns; ++column)
+		{
+			glm::vec3 position = cameraPosition + forward * (5.f + row * spacing) + right * ((column - columns * 0.5f) * spacing);
+			matrices.push_back(glm::translate(glm::mat4(1.f), position));
+		}
+	Model crowd(objPath, matrices);
+
+	// Levels are picked for the window's resolution, so render at its height
+	int viewport[4];
+	glGetIntegerv(GL_VIEWPORT, viewport);
+	BenchmarkTarget target(viewport[3] > 0 ? viewport[3] : 64);
+
+	shader.use();
+	CameraBuffer::shared().update(view, projection, static_cast<float>(glfwGetTime()));
+
+	char line[160];
+	std::string report;
+	std::snprintf(line, sizeof(line), "LOD crowd, %zu instances, %zu levels\n", matrices.size(), crowd.getLodCount());
+	report += line;
+
+	target.clear();
+	crowd.draw();
+	double fullMilliseconds = gpuMilliseconds([&]
+	{
+		for (int frame = 0; frame < frames; ++frame)
+		{
+			target.clear();
+			crowd.draw();
+		}
+	}) / frames;
+
+	target.clear();
+	crowd.drawLod(view, projection);
+	double lodMilliseconds = gpuMilliseconds([&]
+	{
+		for (int frame = 0; frame < frames; ++frame)
+		{
+			target.clear();
+			crowd.drawLod(view, projection);
+		}
+	}) / frames;
+
+	const LodStats& stats = crowd.getLodStats();
+	std::snprintf(line, sizeof(line), "  full: %7.3f ms, %zu triangles\n", fullMilliseconds, stats.fullTriangles);
+	report += line;
+	std::snprintf(line, sizeof(line), "  lod:  %7.3f ms, %zu triangles in %zu draws\n", lodMilliseconds, stats.submittedTriangles, stats.drawCalls);
+	report += line;
+	for (size_t level = 0; level < stats.levelCount; ++level)
+	{
+		std::snprintf(line, sizeof(line), "  level %zu: %6zu triangles, error %.2e, %zu instances\n",
+			level, static_cast<size_t>(crowd.getLod(level).indexCount / 3), crowd.getLod(level).error, stats.instances[level]);
+		report += line;
+	}
+	return report;
+}
+
+// Moves every instance every frame and uploads them through updateMatrices() and through the streaming ring
+inline std::string benchmarkInstanceStreaming(const char* objPath, Shader& shader, const glm::mat4& view, const glm::mat4& projection,
+	unsigned int instanceCount = 4096, int frames = 32)
+{
+	std::vector<glm::mat4> matrices(instanceCount, glm::mat4(1.f));
+	Model model(objPath, matrices);
+	model.updateMatrices(true);
+
+	BenchmarkTarget target;
+	shader.use();
+	CameraBuffer::shared().update(view, projection, static_cast<float>(glfwGetTime()));
+
+	auto placement = [](unsigned int instance, int frame)
+	{
+		glm::vec3 position(static_cast<float>(instance % 64) * 2.f, static_cast<float>(frame) * 0.01f, static_cast<float>(instance / 64) * -2.f);
+		return glm::translate(glm::mat4(1.f), position);
+	};
+
+	char line[160];
+	std::string report;
+	std::snprintf(line, sizeof(line), "Instance streaming, %u instances moving every frame, %d frames\n", instanceCount, frames);
+	report += line;
+
+	const char* names[] = { "updateMatrices", "ring" };
+	for (int mode = 0; mode < 2; ++mode)
+	{
+		model.setStreaming(mode == 1);
+		glFinish();
+
+		double gpuTotal = 0.0;
+		auto start = std::chrono::steady_clock::now();
+		for (int frame = 0; frame < frames; ++frame)
+		{
+			if (mode == 0)
+			{
+				for (unsigned int i = 0; i < instanceCount; ++i)
+					model.changeTransform(i, placement(i, frame));
+				model.updateMatrices();
+			}
+			else
+			{
+				glm::mat4* data = model.writeInstances(instanceCount);
+				for (unsigned int i = 0; data && i < instanceCount; ++i)
+					data[i] = placement(i, frame);
+			}
+
+			gpuTotal += gpuMilliseconds([&]
+			{
+				target.clear();
+				model.draw();
+			});
+		}
+		double cpuMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / frames;
+
+		std::snprintf(line, sizeof(line), "  %-15s %7.3f ms/frame wall, %7.3f ms GPU\n", names[mode], cpuMilliseconds, gpuTotal / frames);
+		report += line;
+	}
+
+	const InstanceRingStats& stats = model.getStreamingStats();
+	std::snprintf(line, sizeof(line), "  ring: %s, %s, waited on %zu busy segments, %zu reallocations\n",
+		stats.persistent ? "persistent mapping" : "unsynchronized map", stats.baseInstance ? "base instance" : "attribute offsets",
+		stats.busySegments, stats.reallocations);
+	report += line;
+	model.setStreaming(false);
+	return report;
+}
+
+// Moves every instance every frame and sends it in each instance format, with the matching shader variant
+inline std::string benchmarkInstanceFormats(const char* objPath, const glm::mat4& view, const glm::mat4& projection,
+	unsigned int instanceCount = 16384, int frames = 32)
+{
+	std::vector<glm::mat4> matrices(instanceCount, glm::mat4(1.f));
+	Model model(objPath, matrices);
+	BenchmarkTarget target;
+
+	char line[160];
+	std::string report;
+	std::snprintf(line, sizeof(line), "Instance formats, %u instances moving every frame, %d frames\n", instanceCount, frames);
+	report += line;
+
+	for (InstanceFormat format : { InstanceFormat::Matrix, InstanceFormat::Affine, InstanceFormat::QuatScale, InstanceFormat::QuatScaleHalf })
+	{
+		// Model takes any vertex format with any instance format, so the compact vertex shader has to build too
+		std::string compactSource = instanceVertexShader(vshaderCompact, format);
+		Shader compactShader(compactSource, fshader);
+		if (!compactShader.isReady())
+		{
+			std::snprintf(line, sizeof(line), "  %-18s does not compile with compact vertices\n", instanceFormatName(format));
+			report += line;
+		}
+		glDeleteProgram(compactShader.ID);
+
+		std::string vertexSource = instanceVertexShader(vshader, format);
+		Shader shader(vertexSource, fshader);
+		shader.use();
+		CameraBuffer::shared().update(view, projection, static_cast<float>(glfwGetTime()));
+		model.setInstanceFormat(format);
+		glFinish();
+
+		double gpuTotal = 0.0;
+		auto start = std::chrono::steady_clock::now();
+		for (int frame = 0; frame < frames; ++frame)
+		{
+			for (unsigned int i = 0; i < instanceCount; ++i)
+				model.setPosition(i, glm::vec3(static_cast<float>(i % 128) * 2.f, static_cast<float>(frame) * 0.01f, static_cast<float>(i / 128) * -2.f));
+			model.updateMatrices();
+
+			gpuTotal += gpuMilliseconds([&]
+			{
+				target.clear();
+				model.draw();
+			});
+		}
+		double cpuMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / frames;
+
+		std::snprintf(line, sizeof(line), "  %-18s %3zu B/instance, %7.1f KB/frame, %7.3f ms/frame wall, %7.3f ms GPU\n", instanceFormatName(format),
+			instanceStride(format), instanceCount * instanceStride(format) / 1024.0, cpuMilliseconds, gpuTotal / frames);
+		report += line;
+		glDeleteProgram(shader.ID);
+	}
+
+	return report;
+}
+
+// Instances scattered around the camera, drawn whole, culled on the CPU and culled on the GPU
+inline std::string benchmarkGpuCulling(const char* objPath, Shader& shader, const glm::mat4& view, const glm::mat4& projection,
+	unsigned int instanceCount = 65536, float extent = 400.f, int frames = 16)
+{
+	glm::vec3 cameraPosition = glm::vec3(glm::inverse(view)[3]);
+	std::vector<glm::mat4> matrices;
+	matrices.reserve(instanceCount);
+	uint32_t seed = 1;
+	auto next = [&seed]()
+	{
+		seed = seed * 1664525u + 1013904223u;
+		return static_cast<float>(seed >> 8) / 16777216.f * 2.f - 1.f;
+	};
+	for (unsigned int i = 0; i < instanceCount; ++i)
+		matrices.push_back(glm::translate(glm::mat4(1.f), cameraPosition + glm::vec3(next(), next(), next()) * extent));
+	Model model(objPath, matrices);
+	model.updateMatrices(true);
+
+	BenchmarkTarget target;
+	shader.use();
+	CameraBuffer::shared().update(view, projection, static_cast<float>(glfwGetTime()));
+
+	char line[160];
+	std::string report;
+	std::snprintf(line, sizeof(line), "GPU culling, %u instances, %d frames\n", instanceCount, frames);
+	report += line;
+
+	const char* names[] = { "all", "CPU culled", "GPU culled" };
+	for (int mode = 0; mode < 3; ++mode)
+	{
+		auto drawFrame = [&]
+		{
+			target.clear();
+			if (mode == 0)
+				model.draw();
+			else if (mode == 1)
+				model.drawCulled(view, projection);
+			else
+				model.drawGpuCulled(view, projection);
+		};
+		drawFrame();
+		glFinish();
+
+		double gpuTotal = 0.0;
+		auto start = std::chrono::steady_clock::now();
+		for (int frame = 0; frame < frames; ++frame)
+			gpuTotal += gpuMilliseconds(drawFrame);
+		double cpuMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / frames;
+
+		std::snprintf(line, sizeof(line), "  %-11s %7.3f ms/frame wall, %7.3f ms GPU\n", names[mode], cpuMilliseconds, gpuTotal / frames);
+		report += line;
+	}
+
+	const GpuCullStats& stats = model.getGpuCullStats();
+	std::snprintf(line, sizeof(line), "  CPU kept %zu, GPU kept %zu, count %s\n", model.getCullStats().visible, stats.visible,
+		stats.indirect ? "stays on the GPU (indirect)" : "read back");
+	report += line;
+	return report;
+}
+
+// CPU time per frame to set uniformCount float uniforms: through glGetUniformLocation with a std::string built
+// per call as the setters used to, through the reflected table by name, and through typed handles
+inline std::string benchmarkUniforms(unsigned int uniformCount = 256, int frames = 200)
+{
+	std::vector<std::string> names(uniformCount);
+	std::string declarations, sum = "0.0";
+	for (unsigned int i = 0; i < uniformCount; ++i)
+	{
+		names[i] = "u" + std::to_string(i);
+		declarations += "uniform float " + names[i] + ";\n";
+		sum += " + " + names[i];
+	}
+	std::string vertexSource = "#version 330 core\n" + declarations + "void main()\n{\n    gl_Position = vec4(" + sum + ");\n}\n";
+	std::string fragmentSource = "#version 330 core\nout vec4 FragColor;\nvoid main()\n{\n    FragColor = vec4(1.0);\n}\n";
+	Shader shader(vertexSource, fragmentSource);
+	shader.use();
+
+	std::vector<Uniform<float>> handles(uniformCount);
+	for (unsigned int i = 0; i < uniformCount; ++i)
+		handles[i] = shader.uniform<float>(names[i]);
+
+	char line[160];
+	std::string report;
+	std::snprintf(line, sizeof(line), "Uniforms, %u floats set per frame, %zu reflected, %d frames\n", uniformCount, shader.getUniforms().size(), frames);
+	report += line;
+
+	const char* modes[] = { "glGetUniformLocation", "hashed name", "typed handle" };
+	double baseline = 0.0;
+	for (int mode = 0; mode < 3; ++mode)
+	{
+		glFinish();
+		auto start = std::chrono::steady_clock::now();
+		for (int frame = 0; frame < frames; ++frame)
+		{
+			float value = static_cast<float>(frame) * 1e-3f;
+			for (unsigned int i = 0; i < uniformCount; ++i)
+			{
+				if (mode == 0)
+				{
+					std::string name(names[i].c_str());
+					glUniform1f(glGetUniformLocation(shader.ID, name.c_str()), value);
+				}
+				else if (mode == 1)
+					shader.setFloat(names[i].c_str(), value);
+				else
+					shader.set(handles[i], value);
+			}
+		}
+		double microseconds = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / frames;
+		if (mode == 0)
+			baseline = microseconds;
+		std::snprintf(line, sizeof(line), "  %-21s %8.2f us/frame, saves %8.2f us\n", modes[mode], microseconds, baseline - microseconds);
+		report += line;
+	}
+
+	shader.unuse();
+	glDeleteProgram(shader.ID);
+	return report;
+}
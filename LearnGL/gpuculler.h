@@ -0,0 +1,326 @@
+#pragma once
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+#include <cstddef>
+#include <iostream>
+#include <string>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/type_ptr.hpp>
+
+#include "frustum.h"
+#include "geometryarena.h"
+#include "instancebuffer.h"
+#include "instanceformat.h"
+#include "vertexformat.h"
+
+struct GpuCullStats
+{
+	size_t instances = 0;
+	size_t visible = 0;			// as of the last query result that was ready, never waited for on the indirect path
+	bool indirect = false;		// the instance count went from the query straight into an indirect draw
+};
+
+// Frustum culls instances on the GPU with GL 3.3 features only: every instance is one point through a vertex
+// shader testing its bounding sphere, with rasterization disabled, and a geometry shader emits the survivors'
+// matrices into a second buffer through transform feedback. The draw reads that buffer as its instances.
+//
+// glDrawTransformFeedbackInstanced would take the captured count as the vertex count rather than the instance
+// count, so the count comes from a GL_TRANSFORM_FEEDBACK_PRIMITIVES_WRITTEN query instead. With GL 4.4 or
+// GL_ARB_query_buffer_object and GL_ARB_draw_indirect the GPU writes it into an indirect command and the
+// CPU never sees it; otherwise the query result is read back before glDrawElementsInstanced.
+class GpuCuller
+{
+private:
+	unsigned int program;
+	InstanceFormat programFormat;
+	GLint planesLocation;
+	GLint sphereLocation;
+	unsigned int cullVAO;
+	unsigned int drawVAO;
+	unsigned int culledVBO;
+	unsigned int indirectBuffer;
+	unsigned int query;
+	bool queryPending;
+	size_t capacity;
+	glm::vec4 sphere;
+	GpuCullStats stats;
+
+public:
+	GpuCuller()
+		: program(0), programFormat(InstanceFormat::Matrix), planesLocation(-1), sphereLocation(-1),
+		cullVAO(0), drawVAO(0), culledVBO(0), indirectBuffer(0), query(0), queryPending(false), capacity(0), sphere(0.f)
+	{
+	}
+
+	~GpuCuller()
+	{
+		if (!drawVAO)
+			return;
+		glDeleteProgram(program);
+		glDeleteVertexArrays(1, &cullVAO);
+		glDeleteVertexArrays(1, &drawVAO);
+		glDeleteBuffers(1, &culledVBO);
+		glDeleteBuffers(1, &indirectBuffer);
+		glDeleteQueries(1, &query);
+	}
+
+	GpuCuller(const GpuCuller&) = delete;
+	GpuCuller& operator=(const GpuCuller&) = delete;
+
+	// GL 4.4 or GL_ARB_query_buffer_object, plus GL_ARB_draw_indirect
+	static bool hasIndirectCount()
+	{
+		if (!glad_glDrawElementsIndirect && glfwExtensionSupported("GL_ARB_draw_indirect"))
+			glad_glDrawElementsIndirect = reinterpret_cast<PFNGLDRAWELEMENTSINDIRECTPROC>(glfwGetProcAddress("glDrawElementsIndirect"));
+		return glad_glDrawElementsIndirect != nullptr && (GLAD_GL_VERSION_4_4 || glfwExtensionSupported("GL_ARB_query_buffer_object"));
+	}
+
+	const GpuCullStats& getStats() const
+	{
+		return stats;
+	}
+
+	void setup(unsigned int VBO, unsigned int EBO, VertexFormat format, const glm::vec3& boundsMin, const glm::vec3& boundsMax)
+	{
+		sphere = glm::vec4((boundsMin + boundsMax) * 0.5f, glm::length(boundsMax - boundsMin) * 0.5f);
+		stats.indirect = hasIndirectCount();
+
+		glGenBuffers(1, &culledVBO);
+		glGenQueries(1, &query);
+		glGenVertexArrays(1, &cullVAO);
+
+		glGenVertexArrays(1, &drawVAO);
+		glBindVertexArray(drawVAO);
+		glBindBuffer(GL_ARRAY_BUFFER, VBO);
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
+		setVertexAttributes(format);
+		glBindBuffer(GL_ARRAY_BUFFER, culledVBO);
+		setInstanceAttributes();
+		glBindVertexArray(0);
+
+		if (stats.indirect)
+		{
+			DrawElementsIndirectCommand command = {};
+			glGenBuffers(1, &indirectBuffer);
+			glBindBuffer(GL_DRAW_INDIRECT_BUFFER, indirectBuffer);
+			glBufferData(GL_DRAW_INDIRECT_BUFFER, sizeof(command), &command, GL_DYNAMIC_DRAW);
+			glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+		}
+	}
+
+	// Culls count instances read from instanceBuffer in the given format, then draws the survivors as full matrices
+	// with the shader bound before the call. Leaves the shader bound again afterwards.
+	void draw(unsigned int instanceBuffer, InstanceFormat format, size_t count, const glm::mat4& viewProjection,
+		GLsizei indexCount, GLenum indexType, VertexFormat vertexFormat, const VertexDequantization& dequantization)
+	{
+		stats.instances = count;
+		readQuery(false);
+		if (count == 0 || !drawVAO || !prepareProgram(format))
+			return;
+
+		// Point the cull VAO at the instances, one vertex each
+		glBindVertexArray(cullVAO);
+		glBindBuffer(GL_ARRAY_BUFFER, instanceBuffer);
+		setInstanceAttributes(format);
+		for (unsigned int i = 0; i < 4; ++i)
+			glVertexAttribDivisor(3 + i, 0);
+
+		if (count > capacity)
+		{
+			capacity = count + count / 2;
+			glBindBuffer(GL_ARRAY_BUFFER, culledVBO);
+			glBufferData(GL_ARRAY_BUFFER, capacity * sizeof(glm::mat4), nullptr, GL_DYNAMIC_COPY);
+			InstanceBuffer::recordUpload(0, true);
+		}
+
+		GLint previousProgram = 0;
+		glGetIntegerv(GL_CURRENT_PROGRAM, &previousProgram);
+		Frustum frustum(viewProjection);
+		glUseProgram(program);
+		glUniform4fv(planesLocation, 6, glm::value_ptr(frustum.planes[0]));
+		glUniform4fv(sphereLocation, 1, glm::value_ptr(sphere));
+
+		glEnable(GL_RASTERIZER_DISCARD);
+		glBindBufferBase(GL_TRANSFORM_FEEDBACK_BUFFER, 0, culledVBO);
+		glBeginQuery(GL_TRANSFORM_FEEDBACK_PRIMITIVES_WRITTEN, query);
+		glBeginTransformFeedback(GL_POINTS);
+		glDrawArrays(GL_POINTS, 0, static_cast<GLsizei>(count));
+		glEndTransformFeedback();
+		glEndQuery(GL_TRANSFORM_FEEDBACK_PRIMITIVES_WRITTEN);
+		glBindBufferBase(GL_TRANSFORM_FEEDBACK_BUFFER, 0, 0);
+		glDisable(GL_RASTERIZER_DISCARD);
+		queryPending = true;
+
+		glUseProgram(previousProgram);
+		glBindVertexArray(drawVAO);
+		if (vertexFormat == VertexFormat::Compact)
+			setDequantization(dequantization);
+
+		if (stats.indirect)
+		{
+			// The query result lands in the command's instanceCount without leaving the GPU
+			glBindBuffer(GL_DRAW_INDIRECT_BUFFER, indirectBuffer);
+			glBufferSubData(GL_DRAW_INDIRECT_BUFFER, offsetof(DrawElementsIndirectCommand, count), sizeof(GLuint), &indexCount);
+			glBindBuffer(GL_QUERY_BUFFER, indirectBuffer);
+			glGetQueryObjectuiv(query, GL_QUERY_RESULT, reinterpret_cast<GLuint*>(offsetof(DrawElementsIndirectCommand, instanceCount)));
+			glBindBuffer(GL_QUERY_BUFFER, 0);
+			glDrawElementsIndirect(GL_TRIANGLES, indexType, nullptr);
+			glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+		}
+		else
+		{
+			readQuery(true);
+			if (stats.visible > 0)
+				glDrawElementsInstanced(GL_TRIANGLES, indexCount, indexType, 0, static_cast<GLsizei>(stats.visible));
+		}
+
+		glBindVertexArray(0);
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+	}
+
+private:
+	// Picks up the survivor count for the stats, only waits for it when asked to
+	void readQuery(bool wait)
+	{
+		if (!queryPending)
+			return;
+		GLuint available = GL_TRUE;
+		if (!wait)
+			glGetQueryObjectuiv(query, GL_QUERY_RESULT_AVAILABLE, &available);
+		if (!available)
+			return;
+		GLuint visible = 0;
+		glGetQueryObjectuiv(query, GL_QUERY_RESULT, &visible);
+		stats.visible = visible;
+		queryPending = false;
+	}
+
+	bool prepareProgram(InstanceFormat format)
+	{
+		if (program && programFormat == format)
+			return true;
+		if (program)
+			glDeleteProgram(program);
+		program = 0;
+		programFormat = format;
+
+		static const char* vertexSource = R"(
+#version 330 core
+
+layout (location = 3) in mat4 aModelMatrix;
+
+flat out int vVisible;
+out vec4 vColumn0;
+out vec4 vColumn1;
+out vec4 vColumn2;
+out vec4 vColumn3;
+
+uniform vec4 planes[6];
+uniform vec4 boundingSphere;    // mesh space center, radius
+
+void main()
+{
+    mat4 model = aModelMatrix;
+    vec3 center = (model * vec4(boundingSphere.xyz, 1.0)).xyz;
+    float scale = sqrt(max(dot(model[0].xyz, model[0].xyz), max(dot(model[1].xyz, model[1].xyz), dot(model[2].xyz, model[2].xyz))));
+    float radius = boundingSphere.w * scale;
+
+    vVisible = 1;
+    for (int i = 0; i < 6; ++i)
+        if (dot(planes[i].xyz, center) + planes[i].w < -radius)
+            vVisible = 0;
+    vColumn0 = model[0];
+    vColumn1 = model[1];
+    vColumn2 = model[2];
+    vColumn3 = model[3];
+}
+)";
+
+		static const char* geometrySource = R"(
+#version 330 core
+
+layout (points) in;
+layout (points, max_vertices = 1) out;
+
+flat in int vVisible[];
+in vec4 vColumn0[];
+in vec4 vColumn1[];
+in vec4 vColumn2[];
+in vec4 vColumn3[];
+
+out vec4 culledColumn0;
+out vec4 culledColumn1;
+out vec4 culledColumn2;
+out vec4 culledColumn3;
+
+void main()
+{
+    if (vVisible[0] == 0)
+        return;
+    culledColumn0 = vColumn0[0];
+    culledColumn1 = vColumn1[0];
+    culledColumn2 = vColumn2[0];
+    culledColumn3 = vColumn3[0];
+    EmitVertex();
+}
+)";
+
+		// The compact instance formats rebuild aModelMatrix the same way the drawing shaders do
+		std::string vertexCode = instanceVertexShader(vertexSource, format);
+		unsigned int vertex = compile(GL_VERTEX_SHADER, vertexCode.c_str());
+		unsigned int geometry = compile(GL_GEOMETRY_SHADER, geometrySource);
+		if (!vertex || !geometry)
+		{
+			glDeleteShader(vertex);
+			glDeleteShader(geometry);
+			return false;
+		}
+
+		program = glCreateProgram();
+		glAttachShader(program, vertex);
+		glAttachShader(program, geometry);
+		const char* varyings[] = { "culledColumn0", "culledColumn1", "culledColumn2", "culledColumn3" };
+		glTransformFeedbackVaryings(program, 4, varyings, GL_INTERLEAVED_ATTRIBS);
+		glLinkProgram(program);
+		glDeleteShader(vertex);
+		glDeleteShader(geometry);
+
+		int success;
+		glGetProgramiv(program, GL_LINK_STATUS, &success);
+		if (!success)
+		{
+			char infoLog[512];
+			glGetProgramInfoLog(program, 512, nullptr, infoLog);
+			std::cerr << "GPU cull program linking failed\n" << infoLog << std::endl;
+			glDeleteProgram(program);
+			program = 0;
+			return false;
+		}
+
+		planesLocation = glGetUniformLocation(program, "planes");
+		sphereLocation = glGetUniformLocation(program, "boundingSphere");
+		return true;
+	}
+
+	static unsigned int compile(GLenum type, const char* source)
+	{
+		unsigned int shader = glCreateShader(type);
+		glShaderSource(shader, 1, &source, nullptr);
+		glCompileShader(shader);
+
+		int success;
+		glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+		if (!success)
+		{
+			char infoLog[512];
+			glGetShaderInfoLog(shader, 512, nullptr, infoLog);
+			std::cerr << "GPU cull shader compilation failed\n" << infoLog << std::endl;
+			glDeleteShader(shader);
+			return 0;
+		}
+		return shader;
+	}
+};
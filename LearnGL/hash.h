@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+// 64 bit hash of a byte range, eight bytes a step, for naming cache files after their contents
+inline uint64_t hashBytes(const char* data, size_t size)
+{
+	const uint64_t prime = 0x9E3779B97F4A7C15ull;
+	uint64_t h = 0xCBF29CE484222325ull ^ (size * prime);
+
+	size_t i = 0;
+	for (; i + 8 <= size; i += 8)
+	{
+		uint64_t word;
+		std::memcpy(&word, data + i, 8);
+		word *= 0xC2B2AE3D27D4EB4Full;
+		word ^= word >> 31;
+		h = (h ^ word) * prime;
+	}
+	for (; i < size; ++i)
+		h = (h ^ static_cast<unsigned char>(data[i])) * 0x100000001B3ull;
+
+	h ^= h >> 33;
+	h *= 0xFF51AFD7ED558CCDull;
+	h ^= h >> 33;
+	return h;
+}
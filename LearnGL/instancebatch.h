@@ -0,0 +1,29 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+// Checks a whole batch of instance ids at once, prints a single error for the first bad one
+inline bool validInstanceIds(const uint32_t* ids, size_t count, size_t instanceCount, const char* operation)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		if (ids[i] >= instanceCount)
+		{
+			std::cerr << operation << ": invalid index " << ids[i] << " in a batch of " << count << std::endl;
+			return false;
+		}
+	}
+	return true;
+}
+
+// Ids sorted ascending with duplicates dropped, the order batch removals walk the instances in
+inline std::vector<uint32_t> sortedInstanceIds(const uint32_t* ids, size_t count)
+{
+	std::vector<uint32_t> sorted(ids, ids + count);
+	std::sort(sorted.begin(), sorted.end());
+	sorted.erase(std::unique(sorted.begin(), sorted.end()), sorted.end());
+	return sorted;
+}
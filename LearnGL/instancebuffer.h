@@ -0,0 +1,141 @@
+#pragma once
+
+#include <glad/glad.h>
+
+#include <vector>
+
+#include <glm/glm.hpp>
+
+// Instance data sent to the GPU, summed over every InstanceBuffer
+struct InstanceUploadStats
+{
+	size_t bytes = 0;
+	size_t uploads = 0;
+	size_t reallocations = 0;
+};
+
+// GL buffer mirroring a vector of model matrices. Edits only mark a range dirty, flush() sends that
+// range with glBufferSubData and reallocates with geometric growth once the vector outgrows it.
+class InstanceBuffer
+{
+private:
+	unsigned int buffer;
+	size_t capacity;
+	size_t dirtyBegin;
+	size_t dirtyEnd;
+
+public:
+	InstanceBuffer()
+		: buffer(0), capacity(0), dirtyBegin(0), dirtyEnd(0)
+	{
+	}
+
+	~InstanceBuffer()
+	{
+		if (buffer)
+			glDeleteBuffers(1, &buffer);
+	}
+
+	InstanceBuffer(const InstanceBuffer&) = delete;
+	InstanceBuffer& operator=(const InstanceBuffer&) = delete;
+
+	// Creates the buffer sized for matrices and leaves it bound to GL_ARRAY_BUFFER
+	void create(const std::vector<glm::mat4>& matrices)
+	{
+		glGenBuffers(1, &buffer);
+		glBindBuffer(GL_ARRAY_BUFFER, buffer);
+		capacity = matrices.size();
+		glBufferData(GL_ARRAY_BUFFER, capacity * sizeof(glm::mat4), matrices.empty() ? nullptr : matrices.data(), GL_DYNAMIC_DRAW);
+		dirtyBegin = dirtyEnd = 0;
+		recordUpload(capacity * sizeof(glm::mat4), true);
+	}
+
+	unsigned int getBuffer() const
+	{
+		return buffer;
+	}
+
+	size_t getCapacity() const
+	{
+		return capacity;
+	}
+
+	bool isDirty() const
+	{
+		return dirtyBegin < dirtyEnd;
+	}
+
+	void markDirty(size_t first, size_t count = 1)
+	{
+		if (count == 0)
+			return;
+		if (dirtyBegin == dirtyEnd)
+		{
+			dirtyBegin = first;
+			dirtyEnd = first + count;
+			return;
+		}
+		dirtyBegin = glm::min(dirtyBegin, first);
+		dirtyEnd = glm::max(dirtyEnd, first + count);
+	}
+
+	// Uploads whatever changed since the last flush, call once per frame before drawing
+	void flush(const std::vector<glm::mat4>& matrices)
+	{
+		if (matrices.size() > capacity)
+		{
+			// Doubling keeps a stream of add() calls at amortized constant upload cost
+			capacity = glm::max(matrices.size(), capacity * 2);
+			glBindBuffer(GL_ARRAY_BUFFER, buffer);
+			glBufferData(GL_ARRAY_BUFFER, capacity * sizeof(glm::mat4), nullptr, GL_DYNAMIC_DRAW);
+			glBufferSubData(GL_ARRAY_BUFFER, 0, matrices.size() * sizeof(glm::mat4), matrices.data());
+			dirtyBegin = dirtyEnd = 0;
+			recordUpload(matrices.size() * sizeof(glm::mat4), true);
+			return;
+		}
+
+		// Ranges past the end belong to instances removed since they were marked
+		size_t end = glm::min(dirtyEnd, matrices.size());
+		if (dirtyBegin < end)
+		{
+			glBindBuffer(GL_ARRAY_BUFFER, buffer);
+			glBufferSubData(GL_ARRAY_BUFFER, dirtyBegin * sizeof(glm::mat4), (end - dirtyBegin) * sizeof(glm::mat4), &matrices[dirtyBegin]);
+			recordUpload((end - dirtyBegin) * sizeof(glm::mat4), false);
+		}
+		dirtyBegin = dirtyEnd = 0;
+	}
+
+	static void recordUpload(size_t bytes, bool reallocated)
+	{
+		InstanceUploadStats& stats = currentFrame();
+		stats.bytes += bytes;
+		++stats.uploads;
+		if (reallocated)
+			++stats.reallocations;
+	}
+
+	// Totals of the last finished frame
+	static const InstanceUploadStats& getFrameStats()
+	{
+		return lastFrame();
+	}
+
+	static void endFrame()
+	{
+		lastFrame() = currentFrame();
+		currentFrame() = InstanceUploadStats();
+	}
+
+private:
+	static InstanceUploadStats& currentFrame()
+	{
+		static InstanceUploadStats stats;
+		return stats;
+	}
+
+	static InstanceUploadStats& lastFrame()
+	{
+		static InstanceUploadStats stats;
+		return stats;
+	}
+};
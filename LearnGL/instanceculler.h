@@ -0,0 +1,176 @@
+#pragma once
+
+#include <glad/glad.h>
+
+#include <chrono>
+#include <cmath>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "frustum.h"
+#include "instancebuffer.h"
+#include "threadpool.h"
+#include "vertexformat.h"
+
+struct InstanceCullStats
+{
+	size_t instances = 0;
+	size_t visible = 0;
+	size_t culled = 0;
+	unsigned int threads = 1;
+	double milliseconds = 0.0;
+};
+
+// Tests every instance's bounding sphere, the mesh bounds' sphere moved by the instance matrix, against the
+// view frustum on a thread pool and compacts the visible matrices in their original order. draw() sends only
+// those through a VAO of its own over the owner's vertex and index buffers.
+class InstanceCuller
+{
+private:
+	static const size_t minRange = 4096;
+
+	unsigned int VAO;
+	unsigned int instanceVBO;
+	size_t instanceCapacity;
+	glm::vec3 center;
+	float radius;
+	std::vector<unsigned char> flags;
+	std::vector<size_t> rangeOffsets;
+	std::vector<glm::mat4> visible;
+	InstanceCullStats stats;
+
+public:
+	InstanceCuller()
+		: VAO(0), instanceVBO(0), instanceCapacity(0), center(0.f), radius(0.f)
+	{
+	}
+
+	~InstanceCuller()
+	{
+		if (VAO)
+			glDeleteVertexArrays(1, &VAO);
+		if (instanceVBO)
+			glDeleteBuffers(1, &instanceVBO);
+	}
+
+	InstanceCuller(const InstanceCuller&) = delete;
+	InstanceCuller& operator=(const InstanceCuller&) = delete;
+
+	// Enough for cull(), setup() also calls it
+	void setBounds(const glm::vec3& boundsMin, const glm::vec3& boundsMax)
+	{
+		center = (boundsMin + boundsMax) * 0.5f;
+		radius = glm::length(boundsMax - boundsMin) * 0.5f;
+	}
+
+	void setup(unsigned int VBO, unsigned int EBO, VertexFormat format, const glm::vec3& boundsMin, const glm::vec3& boundsMax)
+	{
+		setBounds(boundsMin, boundsMax);
+
+		glGenVertexArrays(1, &VAO);
+		glBindVertexArray(VAO);
+		glBindBuffer(GL_ARRAY_BUFFER, VBO);
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
+		setVertexAttributes(format);
+
+		glGenBuffers(1, &instanceVBO);
+		glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
+		setInstanceAttributes();
+		glBindVertexArray(0);
+	}
+
+	const InstanceCullStats& getStats() const
+	{
+		return stats;
+	}
+
+	// Visible matrices of the last cull()
+	const std::vector<glm::mat4>& getVisible() const
+	{
+		return visible;
+	}
+
+	// Two passes over the same ranges: test and count, then copy each range's survivors to its prefix sum offset
+	size_t cull(const glm::mat4* matrices, size_t count, const glm::mat4& viewProjection, ThreadPool& pool = ThreadPool::shared())
+	{
+		auto start = std::chrono::steady_clock::now();
+		Frustum frustum(viewProjection);
+
+		size_t rangeCount = pool.getThreadCount() * 4;
+		if (rangeCount > (count + minRange - 1) / minRange)
+			rangeCount = (count + minRange - 1) / minRange;
+		if (rangeCount == 0)
+			rangeCount = 1;
+		size_t rangeSize = (count + rangeCount - 1) / rangeCount;
+
+		flags.resize(count);
+		rangeOffsets.assign(rangeCount + 1, 0);
+		pool.run(rangeCount, [&](size_t range)
+		{
+			size_t begin = glm::min(range * rangeSize, count);
+			size_t end = glm::min(begin + rangeSize, count);
+			size_t survivors = 0;
+			for (size_t i = begin; i < end; ++i)
+			{
+				flags[i] = isVisible(frustum, matrices[i]) ? 1 : 0;
+				survivors += flags[i];
+			}
+			rangeOffsets[range + 1] = survivors;
+		});
+
+		for (size_t range = 0; range < rangeCount; ++range)
+			rangeOffsets[range + 1] += rangeOffsets[range];
+		visible.resize(rangeOffsets[rangeCount]);
+
+		pool.run(rangeCount, [&](size_t range)
+		{
+			size_t begin = glm::min(range * rangeSize, count);
+			size_t end = glm::min(begin + rangeSize, count);
+			glm::mat4* out = visible.data() + rangeOffsets[range];
+			for (size_t i = begin; i < end; ++i)
+				if (flags[i])
+					*out++ = matrices[i];
+		});
+
+		stats.instances = count;
+		stats.visible = visible.size();
+		stats.culled = count - visible.size();
+		stats.threads = pool.getThreadCount();
+		stats.milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		return visible.size();
+	}
+
+	// Culls, then sends and draws the visible instances, needs setup()
+	void draw(const glm::mat4* matrices, size_t count, const glm::mat4& viewProjection, GLsizei indexCount, GLenum indexType,
+		VertexFormat format, const VertexDequantization& dequantization)
+	{
+		if (cull(matrices, count, viewProjection) == 0)
+			return;
+
+		// Orphan the buffer every frame so the driver never waits on last frame's draw
+		glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
+		bool grown = visible.size() > instanceCapacity;
+		if (grown)
+			instanceCapacity = visible.size() + visible.size() / 2;
+		glBufferData(GL_ARRAY_BUFFER, instanceCapacity * sizeof(glm::mat4), nullptr, GL_STREAM_DRAW);
+		glBufferSubData(GL_ARRAY_BUFFER, 0, visible.size() * sizeof(glm::mat4), visible.data());
+		InstanceBuffer::recordUpload(visible.size() * sizeof(glm::mat4), grown);
+
+		glBindVertexArray(VAO);
+		if (format == VertexFormat::Compact)
+			setDequantization(dequantization);
+		glDrawElementsInstanced(GL_TRIANGLES, indexCount, indexType, 0, static_cast<GLsizei>(visible.size()));
+		glBindVertexArray(0);
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+	}
+
+private:
+	bool isVisible(const Frustum& frustum, const glm::mat4& model) const
+	{
+		glm::vec3 worldCenter = glm::vec3(model * glm::vec4(center, 1.f));
+		float scale = glm::max(glm::dot(glm::vec3(model[0]), glm::vec3(model[0])),
+			glm::max(glm::dot(glm::vec3(model[1]), glm::vec3(model[1])), glm::dot(glm::vec3(model[2]), glm::vec3(model[2]))));
+		return frustum.intersectsSphere(worldCenter, radius * std::sqrt(scale));
+	}
+};
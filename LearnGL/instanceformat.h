@@ -0,0 +1,208 @@
+#pragma once
+
+#include <glad/glad.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/packing.hpp>
+
+#include "transformstore.h"
+#include "vertexformat.h"
+
+enum class InstanceFormat
+{
+	Matrix,				// mat4, 64 bytes
+	Affine,				// AffineInstance, 48 bytes
+	QuatScale,			// QuatInstance, 32 bytes
+	QuatScaleHalf		// HalfQuatInstance, 16 bytes
+};
+
+// Top three rows of the model matrix, the fourth is always 0 0 0 1
+struct AffineInstance
+{
+	glm::vec4 rows[3];
+};
+
+// Translation, unit quaternion and one scale for all axes
+struct QuatInstance
+{
+	glm::vec4 positionScale;	// xyz translation, w scale
+	glm::vec4 rotation;			// xyzw
+};
+
+// QuatInstance with half float translation and scale and an snorm16 quaternion, which is finer than
+// half precision over [-1, 1]. Halves keep about three decimal digits, so translations far from the
+// origin move in visible steps.
+struct HalfQuatInstance
+{
+	uint16_t positionScale[4];
+	int16_t rotation[4];
+};
+
+inline size_t instanceStride(InstanceFormat format)
+{
+	switch (format)
+	{
+	case InstanceFormat::Affine: return sizeof(AffineInstance);
+	case InstanceFormat::QuatScale: return sizeof(QuatInstance);
+	case InstanceFormat::QuatScaleHalf: return sizeof(HalfQuatInstance);
+	default: return sizeof(glm::mat4);
+	}
+}
+
+inline const char* instanceFormatName(InstanceFormat format)
+{
+	switch (format)
+	{
+	case InstanceFormat::Affine: return "3x4 affine";
+	case InstanceFormat::QuatScale: return "quat + scale";
+	case InstanceFormat::QuatScaleHalf: return "quat + scale half";
+	default: return "mat4";
+	}
+}
+
+// Per instance attributes 3-6 in the given format, read from the bound GL_ARRAY_BUFFER starting at firstInstance.
+// Slots a format leaves unused are disabled so a VAO can switch formats.
+inline void setInstanceAttributes(InstanceFormat format, size_t firstInstance = 0)
+{
+	if (format == InstanceFormat::Matrix)
+	{
+		setInstanceAttributes(firstInstance);
+		return;
+	}
+
+	GLsizei stride = static_cast<GLsizei>(instanceStride(format));
+	size_t base = firstInstance * stride;
+	unsigned int used = 0;
+	if (format == InstanceFormat::Affine)
+	{
+		for (unsigned int i = 0; i < 3; ++i)
+			glVertexAttribPointer(3 + i, 4, GL_FLOAT, GL_FALSE, stride, (void*)(base + sizeof(glm::vec4) * i));
+		used = 3;
+	}
+	else if (format == InstanceFormat::QuatScale)
+	{
+		glVertexAttribPointer(3, 4, GL_FLOAT, GL_FALSE, stride, (void*)(base + offsetof(QuatInstance, positionScale)));
+		glVertexAttribPointer(4, 4, GL_FLOAT, GL_FALSE, stride, (void*)(base + offsetof(QuatInstance, rotation)));
+		used = 2;
+	}
+	else
+	{
+		glVertexAttribPointer(3, 4, GL_HALF_FLOAT, GL_FALSE, stride, (void*)(base + offsetof(HalfQuatInstance, positionScale)));
+		glVertexAttribPointer(4, 4, GL_SHORT, GL_TRUE, stride, (void*)(base + offsetof(HalfQuatInstance, rotation)));
+		used = 2;
+	}
+
+	for (unsigned int i = 0; i < 4; ++i)
+	{
+		if (i < used)
+		{
+			glEnableVertexAttribArray(3 + i);
+			glVertexAttribDivisor(3 + i, 1);
+		}
+		else
+			glDisableVertexAttribArray(3 + i);
+	}
+}
+
+// Encodes instances first to end of a composed store into out, instanceStride(format) bytes each.
+// The quaternion formats keep the x scale only.
+inline void encodeInstances(const TransformStore& transforms, size_t first, size_t end, InstanceFormat format, std::vector<unsigned char>& out)
+{
+	size_t stride = instanceStride(format);
+	out.resize((end - first) * stride);
+	unsigned char* data = out.data();
+
+	for (size_t i = first; i < end; ++i, data += stride)
+	{
+		if (format == InstanceFormat::Matrix)
+		{
+			*reinterpret_cast<glm::mat4*>(data) = transforms.getMatrix(i);
+			continue;
+		}
+		if (format == InstanceFormat::Affine)
+		{
+			const glm::mat4& m = transforms.getMatrix(i);
+			AffineInstance& instance = *reinterpret_cast<AffineInstance*>(data);
+			for (int row = 0; row < 3; ++row)
+				instance.rows[row] = glm::vec4(m[0][row], m[1][row], m[2][row], m[3][row]);
+			continue;
+		}
+
+		glm::vec4 positionScale(transforms.getPosition(i), transforms.getScale(i).x);
+		glm::quat q = transforms.getRotation(i);
+		glm::vec4 rotation(q.x, q.y, q.z, q.w);
+		if (format == InstanceFormat::QuatScale)
+		{
+			QuatInstance& instance = *reinterpret_cast<QuatInstance*>(data);
+			instance.positionScale = positionScale;
+			instance.rotation = rotation;
+			continue;
+		}
+
+		HalfQuatInstance& instance = *reinterpret_cast<HalfQuatInstance*>(data);
+		for (int k = 0; k < 4; ++k)
+		{
+			instance.positionScale[k] = glm::packHalf1x16(positionScale[k]);
+			instance.rotation[k] = static_cast<int16_t>(glm::round(glm::clamp(rotation[k], -1.f, 1.f) * 32767.f));
+		}
+	}
+}
+
+// InstanceFormat::QuatScale(Half) attributes and instanceModelMatrix() rebuilding the matrix from them, shared
+// by instanceVertexShader() and the COMPACT_TRANSFORM shader variants
+inline const char* const quatScaleInstanceGlsl = R"(layout (location = 3) in vec4 aInstancePositionScale;  // xyz translation, w scale
+layout (location = 4) in vec4 aInstanceRotation;       // quaternion xyzw
+
+mat4 instanceModelMatrix()
+{
+    vec4 q = normalize(aInstanceRotation);
+    vec3 q2 = q.xyz * 2.0;
+    float xx = q.x * q2.x, yy = q.y * q2.y, zz = q.z * q2.z;
+    float xy = q.x * q2.y, xz = q.x * q2.z, yz = q.y * q2.z;
+    float wx = q.w * q2.x, wy = q.w * q2.y, wz = q.w * q2.z;
+    float s = aInstancePositionScale.w;
+    return mat4(
+        vec4(1.0 - yy - zz, xy + wz, xz - wy, 0.0) * s,
+        vec4(xy - wz, 1.0 - xx - zz, yz + wx, 0.0) * s,
+        vec4(xz + wy, yz - wx, 1.0 - xx - yy, 0.0) * s,
+        vec4(aInstancePositionScale.xyz, 1.0));
+}
+)";
+
+// Swaps the mat4 aModelMatrix input of a vertex shader for the given format's attributes plus a function
+// rebuilding the matrix, the rest of the shader keeps reading aModelMatrix
+inline std::string instanceVertexShader(const std::string& source, InstanceFormat format)
+{
+	static const char* declaration = "layout (location = 3) in mat4 aModelMatrix;";
+	size_t at = source.find(declaration);
+	if (format == InstanceFormat::Matrix || at == std::string::npos)
+		return source;
+
+	std::string decode;
+	if (format == InstanceFormat::Affine)
+	{
+		decode = R"(layout (location = 3) in vec4 aModelRow0;
+layout (location = 4) in vec4 aModelRow1;
+layout (location = 5) in vec4 aModelRow2;
+
+mat4 instanceModelMatrix()
+{
+    return transpose(mat4(aModelRow0, aModelRow1, aModelRow2, vec4(0.0, 0.0, 0.0, 1.0)));
+}
+#define aModelMatrix instanceModelMatrix()
+)";
+	}
+	else
+	{
+		decode = std::string(quatScaleInstanceGlsl) + "#define aModelMatrix instanceModelMatrix()\n";
+	}
+
+	std::string result = source;
+	result.replace(at, std::string(declaration).size(), decode);
+	return result;
+}
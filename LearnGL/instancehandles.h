@@ -0,0 +1,141 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+// Names one instance for as long as it lives. Its slot in the instance array may change when other
+// instances are removed, the handle does not, and once the instance is removed the handle stops resolving.
+struct InstanceHandle
+{
+	uint32_t id = 0xffffffff;
+	uint32_t generation = 0;
+
+	bool operator==(const InstanceHandle& other) const
+	{
+		return id == other.id && generation == other.generation;
+	}
+
+	bool operator!=(const InstanceHandle& other) const
+	{
+		return !(*this == other);
+	}
+};
+
+// Sparse handle table over a dense instance array. Removal moves the last instance into the hole
+// (swap and pop) so it costs the same at any size, and bumps the handle's generation so copies of
+// it held elsewhere no longer resolve. Freed handle ids are reused.
+class InstanceHandles
+{
+public:
+	static constexpr uint32_t invalidSlot = 0xffffffff;
+
+private:
+	std::vector<uint32_t> slots;		// per handle id, the slot while alive
+	std::vector<uint32_t> generations;	// per handle id
+	std::vector<uint32_t> owners;		// per slot, the handle id living there
+	std::vector<uint32_t> freeIds;
+
+public:
+	size_t size() const
+	{
+		return owners.size();
+	}
+
+	void reserve(size_t capacity)
+	{
+		slots.reserve(capacity);
+		generations.reserve(capacity);
+		owners.reserve(capacity);
+	}
+
+	// Starts over with count instances in slots 0 to count - 1, every earlier handle stops resolving
+	void reset(size_t count)
+	{
+		for (uint32_t& generation : generations)
+			++generation;
+		if (generations.size() < count)
+			generations.resize(count, 0);
+		slots.assign(generations.size(), invalidSlot);
+		owners.resize(count);
+		freeIds.clear();
+		for (size_t i = generations.size(); i-- > count;)
+			freeIds.push_back(static_cast<uint32_t>(i));
+		for (size_t i = 0; i < count; ++i)
+		{
+			slots[i] = static_cast<uint32_t>(i);
+			owners[i] = static_cast<uint32_t>(i);
+		}
+	}
+
+	// Handle for a new instance appended at slot size()
+	InstanceHandle create()
+	{
+		uint32_t id;
+		if (!freeIds.empty())
+		{
+			id = freeIds.back();
+			freeIds.pop_back();
+		}
+		else
+		{
+			id = static_cast<uint32_t>(slots.size());
+			slots.push_back(invalidSlot);
+			generations.push_back(0);
+		}
+		slots[id] = static_cast<uint32_t>(owners.size());
+		owners.push_back(id);
+		return { id, generations[id] };
+	}
+
+	bool valid(InstanceHandle handle) const
+	{
+		return handle.id < slots.size() && generations[handle.id] == handle.generation && slots[handle.id] != invalidSlot;
+	}
+
+	// Current slot of a live handle, invalidSlot otherwise
+	uint32_t slot(InstanceHandle handle) const
+	{
+		return valid(handle) ? slots[handle.id] : invalidSlot;
+	}
+
+	InstanceHandle handle(size_t slot) const
+	{
+		if (slot >= owners.size())
+			return InstanceHandle();
+		return { owners[slot], generations[owners[slot]] };
+	}
+
+	// Frees the instance at slot and moves the last one into it, the caller moves its own data the same way with swapRemove()
+	void removeSlot(size_t slot)
+	{
+		uint32_t id = owners[slot];
+		uint32_t moved = owners.back();
+		owners[slot] = moved;
+		slots[moved] = static_cast<uint32_t>(slot);
+		owners.pop_back();
+
+		slots[id] = invalidSlot;
+		++generations[id];
+		freeIds.push_back(id);
+	}
+
+	// Follows a reorder of the instances where slot i takes old slot order[i], every handle keeps resolving to its instance
+	void permute(const uint32_t* order)
+	{
+		std::vector<uint32_t> moved(owners.size());
+		for (size_t i = 0; i < owners.size(); ++i)
+			moved[i] = owners[order[i]];
+		owners.swap(moved);
+		for (size_t i = 0; i < owners.size(); ++i)
+			slots[owners[i]] = static_cast<uint32_t>(i);
+	}
+};
+
+// Moves the last element into slot and drops the last, the data side of InstanceHandles::removeSlot()
+template<typename T>
+void swapRemove(std::vector<T>& values, size_t slot)
+{
+	if (slot + 1 < values.size())
+		values[slot] = values.back();
+	values.pop_back();
+}
@@ -0,0 +1,223 @@
+#pragma once
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+#include <iostream>
+
+#include <glm/glm.hpp>
+
+#include "instancebuffer.h"
+#include "vertexformat.h"
+
+struct InstanceRingStats
+{
+	size_t capacity = 0;			// matrices per segment
+	size_t reallocations = 0;
+	size_t busySegments = 0;		// segments still read by the GPU when their turn came, the upload waited for them
+	bool persistent = false;
+	bool baseInstance = false;
+};
+
+// Instance matrices streamed through segmentCount segments of one buffer, the CPU writes one segment
+// while the GPU still reads the previous ones. Each segment is guarded by a fence and is only written
+// again once that fence has signaled, so uploads only wait when the GPU is segmentCount frames behind.
+// Uses a persistent coherent mapping where glBufferStorage is available and unsynchronized
+// glMapBufferRange otherwise.
+class InstanceRing
+{
+public:
+	static const unsigned int segmentCount = 3;
+
+private:
+	unsigned int buffer;
+	size_t capacity;
+	unsigned int segment;
+	glm::mat4* persistentData;
+	glm::mat4* mapped;
+	GLsync fences[segmentCount];
+	// Bumped on every allocation, a deleted buffer's name may come back from glGenBuffers
+	size_t generation;
+	size_t attributeGeneration;
+	InstanceRingStats stats;
+
+public:
+	InstanceRing()
+		: buffer(0), capacity(0), segment(0), persistentData(nullptr), mapped(nullptr), fences(), generation(0), attributeGeneration(0)
+	{
+		stats.persistent = hasBufferStorage();
+		stats.baseInstance = hasBaseInstance();
+	}
+
+	~InstanceRing()
+	{
+		release();
+	}
+
+	InstanceRing(const InstanceRing&) = delete;
+	InstanceRing& operator=(const InstanceRing&) = delete;
+
+	unsigned int getBuffer() const
+	{
+		return buffer;
+	}
+
+	const InstanceRingStats& getStats() const
+	{
+		return stats;
+	}
+
+	// Index of the first matrix of the current segment, the base instance of draws reading it
+	size_t getFirstInstance() const
+	{
+		return segment * capacity;
+	}
+
+	// The VAO's instance attributes were pointed elsewhere, rebind them on the next draw
+	void attributesChanged()
+	{
+		attributeGeneration = 0;
+	}
+
+	// Where to write count matrices for this frame, valid until unmap()
+	glm::mat4* map(size_t count)
+	{
+		if (count > capacity)
+			allocate(glm::max(count, capacity * 2));
+		else if (fences[segment] && !signaled(fences[segment]))
+		{
+			// Segments are taken in turn, so this one holds the oldest fence and no other is free either
+			++stats.busySegments;
+			glClientWaitSync(fences[segment], GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);
+		}
+
+		if (fences[segment])
+		{
+			glDeleteSync(fences[segment]);
+			fences[segment] = nullptr;
+		}
+
+		if (persistentData)
+			mapped = persistentData + getFirstInstance();
+		else
+		{
+			// The fence already guarantees the GPU is done with this range
+			glBindBuffer(GL_ARRAY_BUFFER, buffer);
+			mapped = static_cast<glm::mat4*>(glMapBufferRange(GL_ARRAY_BUFFER, getFirstInstance() * sizeof(glm::mat4), count * sizeof(glm::mat4),
+				GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_INVALIDATE_RANGE_BIT));
+		}
+		InstanceBuffer::recordUpload(count * sizeof(glm::mat4), false);
+		return mapped;
+	}
+
+	void unmap()
+	{
+		if (mapped && !persistentData)
+		{
+			glBindBuffer(GL_ARRAY_BUFFER, buffer);
+			glUnmapBuffer(GL_ARRAY_BUFFER);
+		}
+		mapped = nullptr;
+	}
+
+	// Call after the last draw reading the current segment, then moves on to the next one
+	void fence()
+	{
+		fences[segment] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+		segment = (segment + 1) % segmentCount;
+	}
+
+	// Draws the current segment, expects the one VAO reading this ring bound. With base instance the
+	// attributes only move when the buffer was reallocated, otherwise they point at the segment every draw.
+	void drawElements(GLenum mode, GLsizei indexCount, GLenum indexType, const void* indices, GLsizei instanceCount)
+	{
+		if (stats.baseInstance)
+		{
+			if (attributeGeneration != generation)
+			{
+				glBindBuffer(GL_ARRAY_BUFFER, buffer);
+				setInstanceAttributes();
+				attributeGeneration = generation;
+			}
+			glDrawElementsInstancedBaseInstance(mode, indexCount, indexType, indices, instanceCount, static_cast<GLuint>(getFirstInstance()));
+			return;
+		}
+
+		glBindBuffer(GL_ARRAY_BUFFER, buffer);
+		setInstanceAttributes(getFirstInstance());
+		glDrawElementsInstanced(mode, indexCount, indexType, indices, instanceCount);
+	}
+
+	// GL 4.4 or GL_ARB_buffer_storage, glad only loads the entry point for contexts reporting 4.4
+	static bool hasBufferStorage()
+	{
+		if (!glad_glBufferStorage && glfwExtensionSupported("GL_ARB_buffer_storage"))
+			glad_glBufferStorage = reinterpret_cast<PFNGLBUFFERSTORAGEPROC>(glfwGetProcAddress("glBufferStorage"));
+		return glad_glBufferStorage != nullptr;
+	}
+
+	// GL 4.2 or GL_ARB_base_instance
+	static bool hasBaseInstance()
+	{
+		if (!glad_glDrawElementsInstancedBaseInstance && glfwExtensionSupported("GL_ARB_base_instance"))
+			glad_glDrawElementsInstancedBaseInstance = reinterpret_cast<PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC>(
+				glfwGetProcAddress("glDrawElementsInstancedBaseInstance"));
+		return glad_glDrawElementsInstancedBaseInstance != nullptr;
+	}
+
+private:
+	static bool signaled(GLsync sync)
+	{
+		GLenum result = glClientWaitSync(sync, 0, 0);
+		return result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED;
+	}
+
+	void release()
+	{
+		for (GLsync& sync : fences)
+		{
+			if (sync)
+				glDeleteSync(sync);
+			sync = nullptr;
+		}
+		if (buffer)
+		{
+			// Deleting unmaps it, the GPU keeps the storage alive until pending draws are done
+			glDeleteBuffers(1, &buffer);
+			buffer = 0;
+		}
+		persistentData = nullptr;
+		mapped = nullptr;
+	}
+
+	void allocate(size_t newCapacity)
+	{
+		release();
+		capacity = newCapacity;
+		segment = 0;
+		stats.capacity = capacity;
+		++stats.reallocations;
+		++generation;
+		InstanceBuffer::recordUpload(0, true);
+
+		GLsizeiptr size = static_cast<GLsizeiptr>(capacity * segmentCount * sizeof(glm::mat4));
+		glGenBuffers(1, &buffer);
+		glBindBuffer(GL_ARRAY_BUFFER, buffer);
+		if (stats.persistent)
+		{
+			GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+			glBufferStorage(GL_ARRAY_BUFFER, size, nullptr, flags);
+			persistentData = static_cast<glm::mat4*>(glMapBufferRange(GL_ARRAY_BUFFER, 0, size, flags));
+			if (persistentData)
+				return;
+
+			// Mapping failed, the storage is immutable so start over with a plain buffer
+			std::cerr << "Persistent instance mapping failed, using glMapBufferRange" << std::endl;
+			stats.persistent = false;
+			glDeleteBuffers(1, &buffer);
+			glGenBuffers(1, &buffer);
+			glBindBuffer(GL_ARRAY_BUFFER, buffer);
+		}
+		glBufferData(GL_ARRAY_BUFFER, size, nullptr, GL_STREAM_DRAW);
+	}
+};
@@ -0,0 +1,171 @@
+#pragma once
+
+#include <glad/glad.h>
+
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "instancebuffer.h"
+#include "simplify.h"
+#include "vertexformat.h"
+
+struct LodStats
+{
+	static const unsigned int maxLevels = 8;
+
+	size_t levelCount = 0;
+	size_t instances[maxLevels] = {};
+	size_t submittedTriangles = 0;
+	size_t fullTriangles = 0;
+	size_t drawCalls = 0;
+};
+
+// Buckets instances by the level whose simplification error stays under a pixel budget on screen and
+// draws every bucket with one instanced call. Owns a second VAO over the owner's vertex and index
+// buffers whose instance attributes point into a per frame buffer of matrices sorted by level.
+class LodRenderer
+{
+private:
+	unsigned int VAO;
+	unsigned int instanceVBO;
+	size_t instanceCapacity;
+	std::vector<MeshLod> lods;
+	glm::vec3 center;
+	float radius;
+	std::vector<unsigned char> levels;
+	std::vector<glm::mat4> sorted;
+	LodStats stats;
+
+public:
+	LodRenderer()
+		: VAO(0), instanceVBO(0), instanceCapacity(0), center(0.f), radius(0.f)
+	{
+	}
+
+	~LodRenderer()
+	{
+		if (VAO)
+			glDeleteVertexArrays(1, &VAO);
+		if (instanceVBO)
+			glDeleteBuffers(1, &instanceVBO);
+	}
+
+	LodRenderer(const LodRenderer&) = delete;
+	LodRenderer& operator=(const LodRenderer&) = delete;
+
+	void setup(unsigned int VBO, unsigned int EBO, VertexFormat format, const std::vector<MeshLod>& meshLods, const glm::vec3& boundsMin, const glm::vec3& boundsMax)
+	{
+		lods.assign(meshLods.begin(), meshLods.begin() + (meshLods.size() < LodStats::maxLevels ? meshLods.size() : LodStats::maxLevels));
+		center = (boundsMin + boundsMax) * 0.5f;
+		radius = glm::length(boundsMax - boundsMin) * 0.5f;
+
+		glGenVertexArrays(1, &VAO);
+		glBindVertexArray(VAO);
+		glBindBuffer(GL_ARRAY_BUFFER, VBO);
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
+		setVertexAttributes(format);
+
+		glGenBuffers(1, &instanceVBO);
+		glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
+		setInstanceAttributes();
+		glBindVertexArray(0);
+	}
+
+	size_t getLevelCount() const
+	{
+		return lods.size();
+	}
+
+	const MeshLod& getLevel(size_t level) const
+	{
+		return lods[level];
+	}
+
+	const LodStats& getStats() const
+	{
+		return stats;
+	}
+
+	// Coarsest level whose error, projected at the nearest point of the bounding sphere, stays under maxPixelError.
+	// pixelScale is projection[1][1] * viewportHeight / 2.
+	size_t selectLevel(const glm::mat4& model, const glm::mat4& view, float pixelScale, float maxPixelError) const
+	{
+		float scale = glm::max(glm::length(glm::vec3(model[0])), glm::max(glm::length(glm::vec3(model[1])), glm::length(glm::vec3(model[2]))));
+		glm::vec3 viewCenter = glm::vec3(view * model * glm::vec4(center, 1.f));
+		float distance = glm::length(viewCenter) - radius * scale;
+		if (distance <= 0.f)
+			return 0;
+
+		for (size_t level = lods.size() - 1; level > 0; --level)
+			if (lods[level].error * scale * pixelScale / distance <= maxPixelError)
+				return level;
+		return 0;
+	}
+
+	void draw(const glm::mat4* modelMatrices, size_t instanceCount, const glm::mat4& view, const glm::mat4& projection,
+		GLenum indexType, VertexFormat format, const VertexDequantization& dequantization, float maxPixelError = 1.f)
+	{
+		stats = LodStats();
+		stats.levelCount = lods.size();
+		if (instanceCount == 0 || lods.empty())
+			return;
+
+		int viewport[4];
+		glGetIntegerv(GL_VIEWPORT, viewport);
+		float pixelScale = projection[1][1] * static_cast<float>(viewport[3]) * 0.5f;
+
+		levels.resize(instanceCount);
+		for (size_t i = 0; i < instanceCount; ++i)
+		{
+			levels[i] = static_cast<unsigned char>(selectLevel(modelMatrices[i], view, pixelScale, maxPixelError));
+			++stats.instances[levels[i]];
+		}
+
+		// Counting sort, so each level's instances are contiguous
+		size_t firstInstance[LodStats::maxLevels];
+		size_t offset = 0;
+		for (size_t level = 0; level < lods.size(); ++level)
+		{
+			firstInstance[level] = offset;
+			offset += stats.instances[level];
+		}
+		sorted.resize(instanceCount);
+		size_t next[LodStats::maxLevels];
+		for (size_t level = 0; level < lods.size(); ++level)
+			next[level] = firstInstance[level];
+		for (size_t i = 0; i < instanceCount; ++i)
+			sorted[next[levels[i]]++] = modelMatrices[i];
+
+		// Orphan the buffer every frame so the driver never waits on last frame's draws
+		glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
+		bool grown = instanceCount > instanceCapacity;
+		if (grown)
+			instanceCapacity = instanceCount + instanceCount / 2;
+		glBufferData(GL_ARRAY_BUFFER, instanceCapacity * sizeof(glm::mat4), nullptr, GL_STREAM_DRAW);
+		glBufferSubData(GL_ARRAY_BUFFER, 0, instanceCount * sizeof(glm::mat4), sorted.data());
+		InstanceBuffer::recordUpload(instanceCount * sizeof(glm::mat4), grown);
+
+		size_t indexSize = indexType == GL_UNSIGNED_SHORT ? sizeof(unsigned short) : sizeof(unsigned int);
+		glBindVertexArray(VAO);
+		if (format == VertexFormat::Compact)
+			setDequantization(dequantization);
+
+		for (size_t level = 0; level < lods.size(); ++level)
+		{
+			size_t count = stats.instances[level];
+			if (count == 0)
+				continue;
+
+			setInstanceAttributes(firstInstance[level]);
+			glDrawElementsInstanced(GL_TRIANGLES, lods[level].indexCount, indexType, (void*)(lods[level].firstIndex * indexSize), static_cast<GLsizei>(count));
+
+			stats.submittedTriangles += count * (lods[level].indexCount / 3);
+			++stats.drawCalls;
+		}
+		stats.fullTriangles = instanceCount * (lods[0].indexCount / 3);
+
+		glBindVertexArray(0);
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+	}
+};
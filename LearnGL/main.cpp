@@ -14,9 +14,12 @@
 
 #include "window.h"
 #include "shader.h"
+#include "shadervariants.h"
 #include "camera.h"
 #include "texture.h"
 #include "primitives.h"
+#include "benchmark.h"
+#include "gpubenchmark.h"
 
 #include "fonts\roboto_font.h"
 
@@ -66,12 +69,28 @@ int main(void)
 	ImGui_ImplGlfw_InitForOpenGL(window.getWindow(), true);
 	ImGui_ImplOpenGL3_Init("#version 330");
 
-	// Load and compile shaders
-	Shader shader(vshader, fshader);
+	// Load and compile shaders, the real ones compile while the models load and draw as a placeholder until ready
+	Shader placeholderShader(vshaderPlaceholder, fshaderPlaceholder);
+	ShaderBatch shaderBatch;
+	ShaderVariants modelVariants(vshaderVariants, fshaderVariants);
+	Shader& shader = modelVariants.precompile(ShaderFeature::Textured | ShaderFeature::Instanced, shaderBatch);
+	Shader& compactShader = modelVariants.precompile(ShaderFeature::Textured | ShaderFeature::Instanced | ShaderFeature::CompactVertices, shaderBatch);
+
+	// Meshes created from here on also go into the shared arena when multi draw indirect is available
+	bool geometryArena = GeometryArena::shared().enable();
+	bool multiDrawIndirect = false;
 
 	Object alliance("resources/models/alliance.obj");
 	alliance.rotate(0, glm::vec3(0.f, 180.f, 0.f));
 	alliance.scale(0, glm::vec3(2.f));
+	Object allianceCompact("resources/models/alliance.obj", 1, VertexFormat::Compact);
+	allianceCompact.rotate(0, glm::vec3(0.f, 180.f, 0.f));
+	allianceCompact.scale(0, glm::vec3(2.f));
+	bool compactVertices = false;
+	bool meshletCulling = true;
+	bool levelOfDetail = false;
+	bool instanceCulling = false;
+	float lodPixelError = 1.f;
 	Texture alliance_tex("resources/images/alliance.png");
 
 	// Main loop...
@@ -90,17 +109,38 @@ int main(void)
 
 		window.clear(0.1f, 0.1f, 0.1f, 1.0f);
 
+		// Programs still compiling draw with the placeholder
+		shaderBatch.poll();
+
+		// The arena holds full vertices whatever format the Object uses
+		Shader& modelShader = compactVertices && !multiDrawIndirect ? compactShader : shader;
+		Shader& activeShader = modelShader.isReady() ? modelShader : placeholderShader;
+		Object& model = compactVertices ? allianceCompact : alliance;
+
 		// Activate the shader
-		shader.use();
+		activeShader.use();
+		if (&activeShader == &placeholderShader)
+			activeShader.setBool("compactPositions", &modelShader == &compactShader);
 
-		// Set camera view and projection matrices
+		// Camera matrices go to the shared uniform block once a frame, every shader declaring it reads them
 		glm::mat4 view = camera.GetViewMatrix();
 		glm::mat4 projection = glm::perspective(glm::radians(45.0f), static_cast<float>(WIDTH) / HEIGHT, 0.1f, 100.0f);
-		shader.setMat4("view", view);
-		shader.setMat4("projection", projection);
+		CameraBuffer::shared().update(view, projection, currentFrame);
 
 		alliance_tex.bind();
-		alliance.draw();
+		if (multiDrawIndirect)
+		{
+			model.drawBatched();
+			GeometryArena::shared().draw();
+		}
+		else if (levelOfDetail)
+			model.drawLod(view, projection, lodPixelError);
+		else if (instanceCulling)
+			model.drawCulled(view, projection);
+		else if (meshletCulling)
+			model.draw(view, projection, camera.position);
+		else
+			model.draw();
 
 
 		static bool enable_docking = false;
@@ -122,9 +162,9 @@ int main(void)
 			ImGui::SliderFloat("Rotation Y", &rotationAngle.y, 0.f, 360.f);
 			ImGui::SliderFloat("Rotation Z", &rotationAngle.z, 0.f, 360.f);
 			ImGui::SeparatorText("");
-			alliance.setPosition(0, modelPos);
-			alliance.rotate(0, rotationAngle);
-			alliance.scale(0, glm::vec3(modelScale));
+			const uint32_t modelId = 0;
+			glm::vec3 modelScale3(modelScale);
+			model.setTransforms(&modelId, 1, &modelPos, &rotationAngle, &modelScale3);
 
 			if (ImGui::Button("Activate KBM"))
 			{
@@ -160,7 +200,144 @@ int main(void)
 			ImGui::Checkbox("Docking", &enable_docking);
 
 			ImGui::Text("Camera Position %.3f %.3f %.3f", camera.position.x, camera.position.y, camera.position.z);
-			ImGui::Text("Model Position %.3f %.3f %.3f", alliance.getPosition(0).x, alliance.getPosition(0).y, alliance.getPosition(0).z);
+			ImGui::Text("Model Position %.3f %.3f %.3f", model.getPosition(0).x, model.getPosition(0).y, model.getPosition(0).z);
+			if (model.getLoadStats().fromCache)
+				ImGui::Text("OBJ Load %.2f ms (mesh cache)", model.getLoadStats().seconds * 1000.0);
+			else
+				ImGui::Text("OBJ Load %.2f ms (%.1f MB/s)", model.getLoadStats().seconds * 1000.0, model.getLoadStats().megabytesPerSecond());
+			const InstanceUploadStats& uploadStats = InstanceBuffer::getFrameStats();
+			ImGui::Text("Instance uploads %.2f KB/frame in %zu calls, %zu reallocations", uploadStats.bytes / 1024.0, uploadStats.uploads, uploadStats.reallocations);
+			ImGui::Text("Vertices %zu (%.2fx reuse, %.1f KB saved)", model.getMeshStats().vertexCount, model.getMeshStats().vertexReductionRatio(), model.getMeshStats().bytesSaved() / 1024.0);
+			ImGui::Checkbox("Compact vertices", &compactVertices);
+			if (model.getVertexFormat() == VertexFormat::Compact)
+				ImGui::Text("Compact error %.1e, %.2f deg, %.1f KB saved", model.getQuantizationError().position,
+					model.getQuantizationError().normalDegrees, model.getQuantizationError().bytesSaved / 1024.0);
+			ImGui::Checkbox("Meshlet culling", &meshletCulling);
+			if (meshletCulling)
+			{
+				const MeshletStats& meshletStats = model.getMeshletStats();
+				ImGui::Text("Meshlets %zu/%zu (%zu frustum, %zu backface culled)", meshletStats.visible, meshletStats.meshletCount,
+					meshletStats.frustumCulled, meshletStats.backfaceCulled);
+				ImGui::Text("Submitted %zu triangles, %zu runs in %zu draws", meshletStats.submittedTriangles, meshletStats.runs, meshletStats.drawCalls);
+			}
+			ImGui::Checkbox("Level of detail", &levelOfDetail);
+			if (levelOfDetail)
+			{
+				const LodStats& lodStats = model.getLodStats();
+				ImGui::SliderFloat("Max pixel error", &lodPixelError, 0.25f, 8.f);
+				ImGui::Text("Levels %zu, instances per level %zu %zu %zu %zu %zu", lodStats.levelCount,
+					lodStats.instances[0], lodStats.instances[1], lodStats.instances[2], lodStats.instances[3], lodStats.instances[4]);
+				ImGui::Text("Submitted %zu of %zu triangles in %zu draws", lodStats.submittedTriangles, lodStats.fullTriangles, lodStats.drawCalls);
+			}
+			ImGui::Checkbox("Instance culling", &instanceCulling);
+			if (instanceCulling)
+			{
+				const InstanceCullStats& cullStats = model.getCullStats();
+				ImGui::Text("Instances %zu visible, %zu culled in %.3f ms on %u threads", cullStats.visible, cullStats.culled, cullStats.milliseconds, cullStats.threads);
+			}
+			if (geometryArena)
+			{
+				ImGui::Checkbox("Multi draw indirect", &multiDrawIndirect);
+				const GeometryArenaStats& arenaStats = GeometryArena::shared().getStats();
+				if (multiDrawIndirect)
+					ImGui::Text("Arena %zu meshes, %zu commands in %zu draws", arenaStats.meshes, arenaStats.commands, arenaStats.drawCalls);
+			}
+			if (model.getLoadStats().optimized)
+				ImGui::Text("Vertex cache ACMR %.3f ATVR %.3f (was %.3f / %.3f)", model.getMeshStats().vertexCache.acmr, model.getMeshStats().vertexCache.atvr,
+					model.getLoadStats().unoptimizedCache.acmr, model.getLoadStats().unoptimizedCache.atvr);
+			else
+				ImGui::Text("Vertex cache ACMR %.3f ATVR %.3f", model.getMeshStats().vertexCache.acmr, model.getMeshStats().vertexCache.atvr);
+			const ShaderBatchStats& batchStats = shaderBatch.getStats();
+			if (shaderBatch.done())
+				ImGui::Text("Shaders %zu ready, %zu failed in %.2f ms (%s)", batchStats.ready, batchStats.failed, batchStats.milliseconds,
+					batchStats.parallel ? "parallel" : "serial");
+			else
+				ImGui::Text("Shaders compiling, %zu of %zu ready", batchStats.ready, batchStats.submitted);
+			const ProgramCacheStats& programStats = ProgramCache::shared().getStats();
+			ImGui::Text("Program cache %zu hits, %zu misses (%zu rejected), %.1f ms saved", programStats.hits, programStats.misses,
+				programStats.rejected, programStats.savedSeconds * 1000.0);
+
+			if (ImGui::CollapsingHeader("Benchmarks"))
+			{
+				// The benchmarks draw with the real programs
+				shaderBatch.finish();
+				static std::string benchmarkReport;
+				if (ImGui::Button("OBJ Parse"))
+				{
+					benchmarkReport = benchmarkObjParse("resources/models/alliance.obj");
+					std::cout << benchmarkReport;
+				}
+				ImGui::SameLine();
+				if (ImGui::Button("Vertex Cache"))
+				{
+					benchmarkReport = benchmarkVertexCache("resources/models/alliance.obj");
+					std::cout << benchmarkReport;
+				}
+				ImGui::SameLine();
+				if (ImGui::Button("Vertex Formats"))
+				{
+					benchmarkReport = benchmarkVertexFormats("resources/models/alliance.obj", shader, compactShader, view, projection);
+					std::cout << benchmarkReport;
+				}
+				ImGui::SameLine();
+				if (ImGui::Button("LOD Crowd"))
+				{
+					benchmarkReport = benchmarkLodCrowd("resources/models/alliance.obj", shader, view, projection);
+					std::cout << benchmarkReport;
+				}
+				if (ImGui::Button("Instance Streaming"))
+				{
+					benchmarkReport = benchmarkInstanceStreaming("resources/models/alliance.obj", shader, view, projection);
+					std::cout << benchmarkReport;
+				}
+				ImGui::SameLine();
+				if (ImGui::Button("Transforms"))
+				{
+					benchmarkReport = benchmarkTransformCompose();
+					std::cout << benchmarkReport;
+				}
+				ImGui::SameLine();
+				if (ImGui::Button("Instance Churn"))
+				{
+					benchmarkReport = benchmarkInstanceChurn();
+					std::cout << benchmarkReport;
+				}
+				if (ImGui::Button("Instance Culling"))
+				{
+					benchmarkReport = benchmarkInstanceCulling();
+					std::cout << benchmarkReport;
+				}
+				ImGui::SameLine();
+				if (ImGui::Button("Instance Formats"))
+				{
+					benchmarkReport = benchmarkInstanceFormats("resources/models/alliance.obj", view, projection);
+					std::cout << benchmarkReport;
+				}
+				ImGui::SameLine();
+				if (ImGui::Button("GPU Culling"))
+				{
+					benchmarkReport = benchmarkGpuCulling("resources/models/alliance.obj", shader, view, projection);
+					std::cout << benchmarkReport;
+				}
+				if (ImGui::Button("BVH"))
+				{
+					benchmarkReport = benchmarkBvh();
+					std::cout << benchmarkReport;
+				}
+				ImGui::SameLine();
+				if (ImGui::Button("Morton Order"))
+				{
+					benchmarkReport = benchmarkMortonOrder();
+					std::cout << benchmarkReport;
+				}
+				ImGui::SameLine();
+				if (ImGui::Button("Uniforms"))
+				{
+					benchmarkReport = benchmarkUniforms();
+					std::cout << benchmarkReport;
+				}
+				ImGui::TextUnformatted(benchmarkReport.c_str());
+			}
 
 			ImGui::End();
 		}
@@ -175,6 +352,7 @@ int main(void)
 			ImGui::RenderPlatformWindowsDefault();
 			glfwMakeContextCurrent(backup_current_context);
 		}
+		InstanceBuffer::endFrame();
 		// Swap the front and back buffers
 		window.swapBuffers();
 		// Poll for events
@@ -0,0 +1,399 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "hash.h"
+#include "meshopt.h"
+#include "objloader.h"
+#include "simplify.h"
+
+// Processed mesh data ready for upload, either owned by the caller or mapped from a cache file
+struct MeshView
+{
+	const Vertex* vertices = nullptr;
+	size_t vertexCount = 0;
+	const void* indices = nullptr;
+	size_t indexCount = 0;
+	size_t indexSize = sizeof(unsigned int);
+	glm::vec3 boundsMin = glm::vec3(0.f);
+	glm::vec3 boundsMax = glm::vec3(0.f);
+	// Ranges of indices, finest first. Without any the whole index buffer is the only level.
+	const MeshLod* lods = nullptr;
+	size_t lodCount = 0;
+};
+
+// Index buffer stored as 16-bit when every vertex can be addressed, 32-bit otherwise
+struct PackedIndices
+{
+	std::vector<unsigned short> shortIndices;
+	const std::vector<unsigned int>* longIndices = nullptr;
+
+	PackedIndices(const std::vector<unsigned int>& indices, size_t vertexCount)
+	{
+		if (vertexCount <= 65536)
+			shortIndices.assign(indices.begin(), indices.end());
+		else
+			longIndices = &indices;
+	}
+
+	const void* data() const
+	{
+		return longIndices ? static_cast<const void*>(longIndices->data()) : static_cast<const void*>(shortIndices.data());
+	}
+
+	size_t indexSize() const
+	{
+		return longIndices ? sizeof(unsigned int) : sizeof(unsigned short);
+	}
+};
+
+inline void computeBounds(const Vertex* vertices, size_t vertexCount, glm::vec3& boundsMin, glm::vec3& boundsMax)
+{
+	boundsMin = vertexCount == 0 ? glm::vec3(0.f) : vertices[0].position;
+	boundsMax = boundsMin;
+	for (size_t i = 0; i < vertexCount; ++i)
+	{
+		boundsMin = glm::min(boundsMin, vertices[i].position);
+		boundsMax = glm::max(boundsMax, vertices[i].position);
+	}
+}
+
+inline MeshView makeMeshView(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices, const PackedIndices& packed,
+	const std::vector<MeshLod>& lods = std::vector<MeshLod>())
+{
+	MeshView mesh;
+	mesh.vertices = vertices.data();
+	mesh.vertexCount = vertices.size();
+	mesh.indices = packed.data();
+	mesh.indexCount = indices.size();
+	mesh.indexSize = packed.indexSize();
+	mesh.lods = lods.data();
+	mesh.lodCount = lods.size();
+	computeBounds(vertices.data(), vertices.size(), mesh.boundsMin, mesh.boundsMax);
+	return mesh;
+}
+
+// Levels of a mesh, a single one covering every index when it has none
+inline std::vector<MeshLod> getMeshLods(const MeshView& mesh)
+{
+	if (mesh.lodCount == 0)
+		return std::vector<MeshLod>(1, MeshLod{ 0, static_cast<uint32_t>(mesh.indexCount), 0.f });
+	return std::vector<MeshLod>(mesh.lods, mesh.lods + mesh.lodCount);
+}
+
+// Simulated vertex cache behaviour of the finest level of a mesh about to be drawn
+inline VertexCacheStats measureVertexCache(const MeshView& mesh)
+{
+	size_t indexCount = mesh.lodCount ? mesh.lods[0].indexCount : mesh.indexCount;
+	if (mesh.indexSize == sizeof(unsigned short))
+		return MeshOptimizer::simulateCache(static_cast<const unsigned short*>(mesh.indices), indexCount, mesh.vertexCount);
+	return MeshOptimizer::simulateCache(static_cast<const unsigned int*>(mesh.indices), indexCount, mesh.vertexCount);
+}
+
+// Reorders a freshly parsed mesh before it is uploaded and cached
+inline void optimizeLoadedMesh(std::vector<Vertex>& vertices, std::vector<unsigned int>& indices, ObjLoadStats& stats)
+{
+	auto start = std::chrono::steady_clock::now();
+	MeshOptimizer::optimize(vertices, indices, &stats.unoptimizedCache);
+	stats.optimized = true;
+	stats.optimizeSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Appends the simplified levels of a freshly optimized mesh to its indices
+inline std::vector<MeshLod> buildLoadedLods(const std::vector<Vertex>& vertices, std::vector<unsigned int>& indices, ObjLoadStats& stats)
+{
+	auto start = std::chrono::steady_clock::now();
+	std::vector<MeshLod> lods = MeshSimplifier::buildLodChain(vertices, indices);
+	stats.lodSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	return lods;
+}
+
+// Wraps arrays baked by ObjBake, 8 floats (position, texCoord, normal) per vertex and the levels of detail
+// stored one after the other in indexData
+template<typename Index>
+MeshView makeBakedMeshView(const float* vertexData, size_t floatCount, const Index* indexData, size_t indexCount,
+	const MeshLod* lods, size_t lodCount)
+{
+	static_assert(sizeof(Vertex) == 8 * sizeof(float), "Baked meshes assume a tightly packed Vertex");
+	static_assert(sizeof(Index) == sizeof(unsigned short) || sizeof(Index) == sizeof(unsigned int), "Baked indices are 16 or 32 bit");
+
+	MeshView mesh;
+	mesh.vertices = reinterpret_cast<const Vertex*>(vertexData);
+	mesh.vertexCount = floatCount / 8;
+	mesh.indices = indexData;
+	mesh.indexCount = indexCount;
+	mesh.indexSize = sizeof(Index);
+	mesh.lods = lods;
+	mesh.lodCount = lodCount;
+	computeBounds(mesh.vertices, mesh.vertexCount, mesh.boundsMin, mesh.boundsMax);
+	return mesh;
+}
+
+// On-disk layout: header, lodCount MeshLods, vertices, then indices of indexSize bytes each
+struct MeshCacheHeader
+{
+	char magic[4];
+	uint32_t version;
+	uint32_t vertexSize;
+	uint32_t indexSize;
+	uint64_t vertexCount;
+	uint64_t indexCount;
+	float boundsMin[3];
+	float boundsMax[3];
+	uint64_t sourceHash;
+	uint64_t sourceSize;
+	int64_t sourceTime;
+	uint32_t lodCount;
+	uint32_t reserved;
+};
+
+class MeshCache
+{
+public:
+	// 2: indices and vertices are stored in MeshOptimizer order
+	// 3: simplified levels of detail follow the full index range
+	static const uint32_t version = 3;
+
+	// Cache for an OBJ file lives next to it
+	static std::string pathFor(const char* objPath)
+	{
+		return std::string(objPath) + ".meshcache";
+	}
+
+	// Cache for in-memory OBJ data is named after its hash
+	static std::string pathFor(uint64_t sourceHash)
+	{
+		char name[64];
+		std::snprintf(name, sizeof(name), "cache/%016llx.meshcache", static_cast<unsigned long long>(sourceHash));
+		return name;
+	}
+
+	// Size and modification time of the source, kept in the header for reference, the content hash decides a match
+	static bool sourceInfo(const char* objPath, uint64_t& size, int64_t& time)
+	{
+		std::error_code error;
+		size = static_cast<uint64_t>(std::filesystem::file_size(objPath, error));
+		if (error)
+			return false;
+		time = static_cast<int64_t>(std::filesystem::last_write_time(objPath, error).time_since_epoch().count());
+		return !error;
+	}
+
+	static bool write(const std::string& cachePath, const MeshView& mesh, uint64_t sourceHash, uint64_t sourceSize, int64_t sourceTime)
+	{
+		std::error_code error;
+		std::filesystem::path parent = std::filesystem::path(cachePath).parent_path();
+		if (!parent.empty())
+			std::filesystem::create_directories(parent, error);
+
+		// Write to a temporary name first so a crash never leaves a truncated cache behind
+		std::string tempPath = cachePath + ".tmp";
+		FILE* file = std::fopen(tempPath.c_str(), "wb");
+		if (!file)
+		{
+			std::cerr << "Failed to write mesh cache: " << cachePath << std::endl;
+			return false;
+		}
+
+		MeshCacheHeader header = {};
+		std::memcpy(header.magic, "LGLM", 4);
+		header.version = version;
+		header.vertexSize = sizeof(Vertex);
+		header.indexSize = static_cast<uint32_t>(mesh.indexSize);
+		header.vertexCount = mesh.vertexCount;
+		header.indexCount = mesh.indexCount;
+		for (int i = 0; i < 3; ++i)
+		{
+			header.boundsMin[i] = mesh.boundsMin[i];
+			header.boundsMax[i] = mesh.boundsMax[i];
+		}
+		header.sourceHash = sourceHash;
+		header.sourceSize = sourceSize;
+		header.sourceTime = sourceTime;
+		header.lodCount = static_cast<uint32_t>(mesh.lodCount);
+
+		bool written =
+			std::fwrite(&header, sizeof(header), 1, file) == 1 &&
+			std::fwrite(mesh.lods, sizeof(MeshLod), mesh.lodCount, file) == mesh.lodCount &&
+			std::fwrite(mesh.vertices, sizeof(Vertex), mesh.vertexCount, file) == mesh.vertexCount &&
+			std::fwrite(mesh.indices, mesh.indexSize, mesh.indexCount, file) == mesh.indexCount;
+		written = std::fclose(file) == 0 && written;
+
+		if (written)
+		{
+			std::filesystem::remove(cachePath, error);
+			std::filesystem::rename(tempPath, cachePath, error);
+			written = !error;
+		}
+		if (!written)
+		{
+			std::filesystem::remove(tempPath, error);
+			std::cerr << "Failed to write mesh cache: " << cachePath << std::endl;
+		}
+		return written;
+	}
+};
+
+// Memory-mapped cache file, the mesh points straight into the mapping
+class MeshCacheFile
+{
+private:
+	MappedFile file;
+	const MeshCacheHeader* header;
+
+public:
+	MeshCacheFile(const std::string& cachePath)
+		: file(cachePath.c_str()), header(nullptr)
+	{
+		if (!file.isOpen() || file.getSize() < sizeof(MeshCacheHeader))
+			return;
+
+		const MeshCacheHeader* candidate = reinterpret_cast<const MeshCacheHeader*>(file.getData());
+		if (std::memcmp(candidate->magic, "LGLM", 4) != 0 ||
+			candidate->version != MeshCache::version ||
+			candidate->vertexSize != sizeof(Vertex) ||
+			(candidate->indexSize != sizeof(unsigned short) && candidate->indexSize != sizeof(unsigned int)))
+			return;
+
+		uint64_t expectedSize = sizeof(MeshCacheHeader) + candidate->lodCount * sizeof(MeshLod) +
+			candidate->vertexCount * sizeof(Vertex) + candidate->indexCount * candidate->indexSize;
+		if (expectedSize != file.getSize())
+			return;
+
+		const MeshLod* lods = reinterpret_cast<const MeshLod*>(file.getData() + sizeof(MeshCacheHeader));
+		for (uint32_t i = 0; i < candidate->lodCount; ++i)
+			if (static_cast<uint64_t>(lods[i].firstIndex) + lods[i].indexCount > candidate->indexCount)
+				return;
+
+		header = candidate;
+	}
+
+	bool isValid() const
+	{
+		return header != nullptr;
+	}
+
+	bool matchesSource(uint64_t sourceSize, uint64_t sourceHash) const
+	{
+		return header && header->sourceSize == sourceSize && header->sourceHash == sourceHash;
+	}
+
+	bool matchesHash(uint64_t sourceHash) const
+	{
+		return header && header->sourceHash == sourceHash;
+	}
+
+	size_t getSize() const
+	{
+		return file.getSize();
+	}
+
+	MeshView getMesh() const
+	{
+		MeshView mesh;
+		const char* data = file.getData() + sizeof(MeshCacheHeader);
+		mesh.lods = reinterpret_cast<const MeshLod*>(data);
+		mesh.lodCount = header->lodCount;
+		data += header->lodCount * sizeof(MeshLod);
+		mesh.vertices = reinterpret_cast<const Vertex*>(data);
+		mesh.vertexCount = static_cast<size_t>(header->vertexCount);
+		mesh.indices = data + header->vertexCount * sizeof(Vertex);
+		mesh.indexCount = static_cast<size_t>(header->indexCount);
+		mesh.indexSize = header->indexSize;
+		mesh.boundsMin = glm::vec3(header->boundsMin[0], header->boundsMin[1], header->boundsMin[2]);
+		mesh.boundsMax = glm::vec3(header->boundsMax[0], header->boundsMax[1], header->boundsMax[2]);
+		return mesh;
+	}
+};
+
+// Loads an OBJ file through its mesh cache and passes the result to upload(const MeshView&).
+// On a miss the OBJ is parsed into vertices/indices, optimized, simplified into levels of detail and the cache is rewritten.
+template<typename Upload>
+bool loadCachedObj(const char* objPath, std::vector<Vertex>& vertices, std::vector<unsigned int>& indices, ObjLoadStats& stats, Upload upload)
+{
+	auto start = std::chrono::steady_clock::now();
+
+	std::string cachePath = MeshCache::pathFor(objPath);
+	uint64_t sourceSize = 0;
+	int64_t sourceTime = 0;
+	bool sourceExists = MeshCache::sourceInfo(objPath, sourceSize, sourceTime);
+
+	MappedFile file(objPath);
+	if (!file.isOpen())
+	{
+		std::cerr << "Failed to open OBJ file: " << objPath << std::endl;
+		upload(MeshView());
+		return false;
+	}
+
+	// Size and time can match a file that changed since, only a matching content hash serves the cache.
+	// Hashing the mapped text is still far cheaper than parsing it.
+	uint64_t sourceHash = hashBytes(file.getData(), file.getSize());
+	if (sourceExists)
+	{
+		MeshCacheFile cache(cachePath);
+		if (cache.isValid() && cache.matchesSource(sourceSize, sourceHash))
+		{
+			upload(cache.getMesh());
+			stats.bytes = cache.getSize();
+			stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+			stats.threadCount = 1;
+			stats.fromCache = true;
+			return true;
+		}
+	}
+
+	ObjLoader::loadMemory(file.getData(), file.getSize(), vertices, indices, &stats);
+	optimizeLoadedMesh(vertices, indices, stats);
+	std::vector<MeshLod> lods = buildLoadedLods(vertices, indices, stats);
+
+	PackedIndices packed(indices, vertices.size());
+	MeshView mesh = makeMeshView(vertices, indices, packed, lods);
+
+	upload(mesh);
+	MeshCache::write(cachePath, mesh, sourceHash, sourceSize, sourceTime);
+	return true;
+}
+
+// Same for OBJ text held in memory, the cache is keyed by the hash of the text
+template<typename Upload>
+bool loadCachedObj(const std::string& objData, std::vector<Vertex>& vertices, std::vector<unsigned int>& indices, ObjLoadStats& stats, Upload upload)
+{
+	auto start = std::chrono::steady_clock::now();
+
+	uint64_t sourceHash = hashBytes(objData.data(), objData.size());
+	std::string cachePath = MeshCache::pathFor(sourceHash);
+
+	{
+		MeshCacheFile cache(cachePath);
+		if (cache.isValid() && cache.matchesHash(sourceHash))
+		{
+			upload(cache.getMesh());
+			stats.bytes = cache.getSize();
+			stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+			stats.threadCount = 1;
+			stats.fromCache = true;
+			return true;
+		}
+	}
+
+	ObjLoader::loadMemory(objData.data(), objData.size(), vertices, indices, &stats);
+	optimizeLoadedMesh(vertices, indices, stats);
+	std::vector<MeshLod> lods = buildLoadedLods(vertices, indices, stats);
+
+	PackedIndices packed(indices, vertices.size());
+	MeshView mesh = makeMeshView(vertices, indices, packed, lods);
+
+	upload(mesh);
+	MeshCache::write(cachePath, mesh, sourceHash, objData.size(), 0);
+	return true;
+}
@@ -0,0 +1,353 @@
+#pragma once
+
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "frustum.h"
+#include "meshopt.h"
+#include "objloader.h"
+
+// Contiguous run of triangles in the index buffer, culled as a unit
+struct Meshlet
+{
+	unsigned int firstIndex = 0;
+	unsigned int indexCount = 0;
+	unsigned int vertexCount = 0;
+	glm::vec3 center = glm::vec3(0.f);
+	float radius = 0.f;
+	// Every triangle faces away from a camera where dot(normalize(coneApex - camera), coneAxis) >= coneCutoff
+	glm::vec3 coneApex = glm::vec3(0.f);
+	glm::vec3 coneAxis = glm::vec3(0.f, 0.f, 1.f);
+	float coneCutoff = 2.f;
+};
+
+// Range of indices handed to one draw call
+struct MeshletRun
+{
+	unsigned int firstIndex;
+	unsigned int indexCount;
+};
+
+struct MeshletStats
+{
+	size_t meshletCount = 0;
+	size_t visible = 0;
+	size_t frustumCulled = 0;
+	size_t backfaceCulled = 0;
+	size_t submittedTriangles = 0;
+	size_t runs = 0;			// ranges of contiguous visible meshlets
+	size_t drawCalls = 0;
+};
+
+class MeshletBuilder
+{
+public:
+	static const unsigned int maxVertices = 64;
+	static const unsigned int maxTriangles = 124;
+	// About 45 degrees between a triangle and the meshlet's average normal
+	static constexpr float minNormalAlignment = 0.7f;
+
+	// Grows each meshlet from a seed triangle, always adding the neighbouring triangle that needs the fewest
+	// new vertices and best matches the meshlet's average normal, until nothing fits or faces close enough. meshletIndices receives the triangles in
+	// meshlet order so every meshlet is one contiguous index range.
+	template<typename Index>
+	static std::vector<Meshlet> build(const Vertex* vertices, size_t vertexCount, const Index* indices, size_t indexCount, std::vector<Index>& meshletIndices)
+	{
+		std::vector<Meshlet> meshlets;
+		size_t triangleCount = indexCount / 3;
+		meshletIndices.clear();
+		meshletIndices.reserve(triangleCount * 3);
+		if (vertexCount == 0 || triangleCount == 0)
+			return meshlets;
+
+		// Triangles around every position, flattened into one array. Going by position rather than
+		// vertex keeps triangles connected across UV seams and hard edges.
+		std::vector<unsigned int> positionIds = MeshOptimizer::weldPositions(vertices, vertexCount);
+		std::vector<size_t> adjacencyStart(vertexCount + 1, 0);
+		for (size_t i = 0; i < triangleCount * 3; ++i)
+			++adjacencyStart[positionIds[indices[i]] + 1];
+		for (size_t position = 0; position < vertexCount; ++position)
+			adjacencyStart[position + 1] += adjacencyStart[position];
+		std::vector<unsigned int> adjacency(triangleCount * 3);
+		std::vector<size_t> fill(adjacencyStart.begin(), adjacencyStart.end() - 1);
+		for (size_t i = 0; i < triangleCount * 3; ++i)
+			adjacency[fill[positionIds[indices[i]]]++] = static_cast<unsigned int>(i / 3);
+
+		std::vector<glm::vec3> normals(triangleCount);
+		for (size_t triangle = 0; triangle < triangleCount; ++triangle)
+			normals[triangle] = triangleNormal(vertices, indices + triangle * 3);
+
+		std::vector<char> emitted(triangleCount, 0);
+		std::vector<unsigned int> owner(vertexCount, 0xffffffffu);
+		std::vector<Index> meshletVertices;
+		size_t seed = 0;
+
+		while (true)
+		{
+			while (seed < triangleCount && emitted[seed])
+				++seed;
+			if (seed == triangleCount)
+				break;
+
+			unsigned int current = static_cast<unsigned int>(meshlets.size());
+			Meshlet meshlet;
+			meshlet.firstIndex = static_cast<unsigned int>(meshletIndices.size());
+			meshletVertices.clear();
+			glm::vec3 normalSum(0.f);
+			long long next = static_cast<long long>(seed);
+
+			while (next >= 0)
+			{
+				const Index* corners = indices + next * 3;
+				for (int corner = 0; corner < 3; ++corner)
+				{
+					meshletIndices.push_back(corners[corner]);
+					if (owner[corners[corner]] != current)
+					{
+						owner[corners[corner]] = current;
+						meshletVertices.push_back(corners[corner]);
+					}
+				}
+				emitted[next] = 1;
+				normalSum += normals[next];
+				meshlet.indexCount += 3;
+				if (meshlet.indexCount / 3 == maxTriangles)
+					break;
+
+				float sumLength = glm::length(normalSum);
+				glm::vec3 axis = sumLength > 0.f ? normalSum / sumLength : glm::vec3(0.f);
+
+				next = -1;
+				float bestScore = 0.f;
+				for (Index vertex : meshletVertices)
+				{
+					unsigned int position = positionIds[vertex];
+					for (size_t a = adjacencyStart[position]; a < adjacencyStart[position + 1]; ++a)
+					{
+						unsigned int triangle = adjacency[a];
+						if (emitted[triangle])
+							continue;
+
+						const Index* candidate = indices + triangle * 3;
+						unsigned int newVertices =
+							(owner[candidate[0]] != current) + (owner[candidate[1]] != current) + (owner[candidate[2]] != current);
+						if (meshletVertices.size() + newVertices > maxVertices)
+							continue;
+
+						// A wide normal cone can never be culled, so strongly bent triangles wait for another meshlet
+						float alignment = glm::dot(normals[triangle], axis);
+						if (alignment < minNormalAlignment)
+							continue;
+
+						// Vertices first, the normal only breaks ties within one new vertex
+						float score = static_cast<float>(newVertices) + 0.5f * (1.f - alignment);
+						if (next < 0 || score < bestScore)
+						{
+							next = triangle;
+							bestScore = score;
+						}
+					}
+				}
+			}
+
+			meshlet.vertexCount = static_cast<unsigned int>(meshletVertices.size());
+			meshlets.push_back(meshlet);
+		}
+
+		// Growing meshlets undoes the vertex cache order within them, so each one is reordered again
+		std::vector<unsigned int> localIndices;
+		for (Meshlet& built : meshlets)
+		{
+			optimizeVertexCache(built, meshletIndices.data(), localIndices, meshletVertices);
+			computeBounds(built, vertices, meshletIndices.data());
+		}
+		return meshlets;
+	}
+
+	// Runs the cache optimizer over one meshlet's triangles, renumbered to its own vertices so the
+	// optimizer's tables stay meshlet sized
+	template<typename Index>
+	static void optimizeVertexCache(const Meshlet& meshlet, Index* indices, std::vector<unsigned int>& localIndices, std::vector<Index>& meshletVertices)
+	{
+		Index* first = indices + meshlet.firstIndex;
+		meshletVertices.clear();
+		localIndices.resize(meshlet.indexCount);
+		for (unsigned int i = 0; i < meshlet.indexCount; ++i)
+		{
+			size_t local = 0;
+			while (local < meshletVertices.size() && meshletVertices[local] != first[i])
+				++local;
+			if (local == meshletVertices.size())
+				meshletVertices.push_back(first[i]);
+			localIndices[i] = static_cast<unsigned int>(local);
+		}
+
+		MeshOptimizer::optimizeVertexCache(localIndices, meshletVertices.size());
+		for (unsigned int i = 0; i < meshlet.indexCount; ++i)
+			first[i] = meshletVertices[localIndices[i]];
+	}
+
+	// Bounding sphere around the AABB centre and a normal cone with an apex behind every triangle plane
+	template<typename Index>
+	static void computeBounds(Meshlet& meshlet, const Vertex* vertices, const Index* indices)
+	{
+		const Index* first = indices + meshlet.firstIndex;
+		size_t triangleCount = meshlet.indexCount / 3;
+
+		glm::vec3 boundsMin = vertices[first[0]].position;
+		glm::vec3 boundsMax = boundsMin;
+		for (unsigned int i = 0; i < meshlet.indexCount; ++i)
+		{
+			boundsMin = glm::min(boundsMin, vertices[first[i]].position);
+			boundsMax = glm::max(boundsMax, vertices[first[i]].position);
+		}
+		meshlet.center = (boundsMin + boundsMax) * 0.5f;
+		meshlet.radius = 0.f;
+		for (unsigned int i = 0; i < meshlet.indexCount; ++i)
+			meshlet.radius = glm::max(meshlet.radius, glm::length(vertices[first[i]].position - meshlet.center));
+
+		std::vector<glm::vec3> normals(triangleCount, glm::vec3(0.f));
+		glm::vec3 normalSum(0.f);
+		for (size_t triangle = 0; triangle < triangleCount; ++triangle)
+		{
+			normals[triangle] = triangleNormal(vertices, first + triangle * 3);
+			normalSum += normals[triangle];
+		}
+
+		// Without a clear common direction no camera position can see only back faces
+		meshlet.coneCutoff = 2.f;
+		float sumLength = glm::length(normalSum);
+		if (sumLength <= 0.f)
+			return;
+		glm::vec3 axis = normalSum / sumLength;
+
+		float minDot = 1.f;
+		for (const glm::vec3& normal : normals)
+			if (normal != glm::vec3(0.f))
+				minDot = glm::min(minDot, glm::dot(normal, axis));
+		if (minDot <= 0.1f)
+			return;
+
+		// Move the apex back along the axis until it is behind every triangle plane
+		float apexDistance = 0.f;
+		for (size_t triangle = 0; triangle < triangleCount; ++triangle)
+		{
+			if (normals[triangle] == glm::vec3(0.f))
+				continue;
+			const glm::vec3& a = vertices[first[triangle * 3]].position;
+			float distance = glm::dot(meshlet.center - a, normals[triangle]) / glm::dot(axis, normals[triangle]);
+			apexDistance = glm::max(apexDistance, distance);
+		}
+
+		meshlet.coneAxis = axis;
+		meshlet.coneApex = meshlet.center - axis * apexDistance;
+		meshlet.coneCutoff = std::sqrt(1.f - minDot * minDot);
+	}
+
+private:
+	// Unit normal, zero for degenerate triangles
+	template<typename Index>
+	static glm::vec3 triangleNormal(const Vertex* vertices, const Index* corners)
+	{
+		const glm::vec3& a = vertices[corners[0]].position;
+		const glm::vec3& b = vertices[corners[1]].position;
+		const glm::vec3& c = vertices[corners[2]].position;
+		glm::vec3 normal = glm::cross(b - a, c - a);
+		float length = glm::length(normal);
+		return length > 0.f ? normal / length : glm::vec3(0.f);
+	}
+};
+
+// Selects meshlets visible from at least one instance and merges neighbours into runs,
+// so every run can still be drawn with all instances in one instanced call
+class MeshletCuller
+{
+private:
+	std::vector<char> visible;
+	std::vector<char> insideFrustum;
+
+public:
+	void cull(const std::vector<Meshlet>& meshlets, const glm::mat4* modelMatrices, size_t instanceCount,
+		const glm::mat4& viewProjection, const glm::vec3& cameraPosition, bool backfaceCulling,
+		std::vector<MeshletRun>& runs, MeshletStats& stats)
+	{
+		visible.assign(meshlets.size(), 0);
+		insideFrustum.assign(meshlets.size(), 0);
+		size_t remaining = meshlets.size();
+
+		for (size_t instance = 0; instance < instanceCount && remaining > 0; ++instance)
+		{
+			const glm::mat4& model = modelMatrices[instance];
+
+			// Tested in model space, the normal cone only survives rotation, translation and uniform scale
+			Frustum frustum(viewProjection * model);
+			glm::vec3 camera = glm::vec3(glm::inverse(model) * glm::vec4(cameraPosition, 1.f));
+			bool coneTest = backfaceCulling && hasUniformScale(model);
+
+			for (size_t i = 0; i < meshlets.size(); ++i)
+			{
+				if (visible[i])
+					continue;
+
+				const Meshlet& meshlet = meshlets[i];
+				if (!frustum.intersectsSphere(meshlet.center, meshlet.radius))
+					continue;
+				insideFrustum[i] = 1;
+
+				if (coneTest && glm::dot(glm::normalize(meshlet.coneApex - camera), meshlet.coneAxis) >= meshlet.coneCutoff)
+					continue;
+
+				visible[i] = 1;
+				--remaining;
+			}
+		}
+
+		runs.clear();
+		stats = MeshletStats();
+		stats.meshletCount = meshlets.size();
+		for (size_t i = 0; i < meshlets.size(); ++i)
+		{
+			if (!visible[i])
+			{
+				if (insideFrustum[i])
+					++stats.backfaceCulled;
+				else
+					++stats.frustumCulled;
+				continue;
+			}
+
+			++stats.visible;
+			stats.submittedTriangles += meshlets[i].indexCount / 3;
+			if (!runs.empty() && runs.back().firstIndex + runs.back().indexCount == meshlets[i].firstIndex)
+				runs.back().indexCount += meshlets[i].indexCount;
+			else
+				runs.push_back({ meshlets[i].firstIndex, meshlets[i].indexCount });
+		}
+		stats.runs = runs.size();
+	}
+
+private:
+	static bool hasUniformScale(const glm::mat4& model)
+	{
+		float x = glm::length(glm::vec3(model[0]));
+		float y = glm::length(glm::vec3(model[1]));
+		float z = glm::length(glm::vec3(model[2]));
+		float largest = glm::max(x, glm::max(y, z));
+		return largest > 0.f && glm::min(x, glm::min(y, z)) >= largest * 0.999f;
+	}
+};
+
+// Builds the meshlets of a mesh about to be uploaded, indexData receives its indices in meshlet order
+template<typename Index>
+std::vector<Meshlet> buildMeshlets(const Vertex* vertices, size_t vertexCount, const void* indices, size_t indexCount, std::vector<unsigned char>& indexData)
+{
+	std::vector<Index> meshletIndices;
+	std::vector<Meshlet> meshlets = MeshletBuilder::build(vertices, vertexCount, static_cast<const Index*>(indices), indexCount, meshletIndices);
+	indexData.resize(meshletIndices.size() * sizeof(Index));
+	if (!indexData.empty())
+		std::memcpy(indexData.data(), meshletIndices.data(), indexData.size());
+	return meshlets;
+}
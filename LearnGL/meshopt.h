@@ -0,0 +1,293 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "objloader.h"
+
+// Reorders indexed triangle lists for the post-transform vertex cache, overdraw and vertex fetch
+class MeshOptimizer
+{
+public:
+	// Small enough to hold on every GPU still in use
+	static const unsigned int defaultCacheSize = 16;
+
+	// Runs the index buffer through a FIFO cache of cacheSize entries and counts the vertex shader runs
+	template<typename Index>
+	static VertexCacheStats simulateCache(const Index* indices, size_t indexCount, size_t vertexCount, unsigned int cacheSize = defaultCacheSize)
+	{
+		VertexCacheStats stats;
+		if (indexCount < 3 || vertexCount == 0)
+			return stats;
+
+		// A vertex is still cached while fewer than cacheSize others were loaded after it
+		std::vector<size_t> loadedAt(vertexCount, 0);
+		size_t time = cacheSize + 1;
+		size_t misses = 0;
+		size_t referenced = 0;
+
+		for (size_t i = 0; i < indexCount; ++i)
+		{
+			size_t vertex = indices[i];
+			if (vertex >= vertexCount || time - loadedAt[vertex] <= cacheSize)
+				continue;
+			if (loadedAt[vertex] == 0)
+				++referenced;
+			loadedAt[vertex] = time++;
+			++misses;
+		}
+
+		stats.acmr = static_cast<double>(misses) / static_cast<double>(indexCount / 3);
+		stats.atvr = static_cast<double>(misses) / static_cast<double>(referenced);
+		return stats;
+	}
+
+	static VertexCacheStats simulateCache(const std::vector<unsigned int>& indices, size_t vertexCount, unsigned int cacheSize = defaultCacheSize)
+	{
+		return simulateCache(indices.data(), indices.size(), vertexCount, cacheSize);
+	}
+
+	// Same id for every vertex at the same position, the id is the first such vertex
+	static std::vector<unsigned int> weldPositions(const Vertex* vertices, size_t vertexCount)
+	{
+		struct PositionKey
+		{
+			uint32_t bits[3];
+			bool operator==(const PositionKey& other) const
+			{
+				return bits[0] == other.bits[0] && bits[1] == other.bits[1] && bits[2] == other.bits[2];
+			}
+		};
+		struct PositionHash
+		{
+			size_t operator()(const PositionKey& key) const
+			{
+				uint64_t h = (key.bits[0] * 0x9E3779B97F4A7C15ull) ^ (key.bits[1] * 0xC2B2AE3D27D4EB4Full) ^ key.bits[2];
+				return static_cast<size_t>(h ^ (h >> 29));
+			}
+		};
+
+		std::vector<unsigned int> ids(vertexCount);
+		std::unordered_map<PositionKey, unsigned int, PositionHash> first;
+		first.reserve(vertexCount);
+		for (size_t vertex = 0; vertex < vertexCount; ++vertex)
+		{
+			PositionKey key;
+			std::memcpy(key.bits, &vertices[vertex].position[0], sizeof(key.bits));
+			ids[vertex] = first.emplace(key, static_cast<unsigned int>(vertex)).first->second;
+		}
+		return ids;
+	}
+
+	// Runs all passes in order, before/after receive the simulated cache stats.
+	// An overdrawThreshold of 0 skips the overdraw pass.
+	static void optimize(std::vector<Vertex>& vertices, std::vector<unsigned int>& indices,
+		VertexCacheStats* before = nullptr, VertexCacheStats* after = nullptr,
+		float overdrawThreshold = 1.05f, unsigned int cacheSize = defaultCacheSize)
+	{
+		if (before)
+			*before = simulateCache(indices, vertices.size(), cacheSize);
+
+		std::vector<size_t> clusters = optimizeVertexCache(indices, vertices.size(), cacheSize);
+		if (overdrawThreshold > 0.f)
+			optimizeOverdraw(indices, vertices, clusters, overdrawThreshold, cacheSize);
+		optimizeVertexFetch(vertices, indices);
+
+		if (after)
+			*after = simulateCache(indices, vertices.size(), cacheSize);
+	}
+
+	// Tipsify (Sander et al. 2007): emits every triangle around a fanning vertex, then moves on to the
+	// neighbour most likely still in the cache. Returns the first triangle of each run that starts
+	// with a cold cache, optimizeOverdraw can move those runs around almost for free.
+	static std::vector<size_t> optimizeVertexCache(std::vector<unsigned int>& indices, size_t vertexCount, unsigned int cacheSize = defaultCacheSize)
+	{
+		std::vector<size_t> clusters;
+		size_t triangleCount = indices.size() / 3;
+		if (triangleCount == 0 || vertexCount == 0)
+			return clusters;
+
+		// Triangles around every vertex, flattened into one array
+		std::vector<unsigned int> liveTriangles(vertexCount, 0);
+		for (size_t i = 0; i < triangleCount * 3; ++i)
+			++liveTriangles[indices[i]];
+
+		std::vector<size_t> adjacencyStart(vertexCount + 1, 0);
+		for (size_t vertex = 0; vertex < vertexCount; ++vertex)
+			adjacencyStart[vertex + 1] = adjacencyStart[vertex] + liveTriangles[vertex];
+
+		std::vector<unsigned int> adjacency(triangleCount * 3);
+		std::vector<size_t> fill(adjacencyStart.begin(), adjacencyStart.end() - 1);
+		for (size_t i = 0; i < triangleCount * 3; ++i)
+			adjacency[fill[indices[i]]++] = static_cast<unsigned int>(i / 3);
+
+		std::vector<size_t> loadedAt(vertexCount, 0);
+		std::vector<char> emitted(triangleCount, 0);
+		std::vector<unsigned int> deadEnds;
+		std::vector<unsigned int> candidates;
+		std::vector<unsigned int> result;
+		result.reserve(indices.size());
+
+		size_t time = cacheSize + 1;
+		size_t cursor = 0;
+		bool coldStart = true;
+		long long fan = indices[0];
+
+		while (fan >= 0)
+		{
+			candidates.clear();
+			for (size_t a = adjacencyStart[fan]; a < adjacencyStart[fan + 1]; ++a)
+			{
+				unsigned int triangle = adjacency[a];
+				if (emitted[triangle])
+					continue;
+
+				if (coldStart)
+				{
+					clusters.push_back(result.size() / 3);
+					coldStart = false;
+				}
+
+				for (int corner = 0; corner < 3; ++corner)
+				{
+					unsigned int vertex = indices[triangle * 3 + corner];
+					result.push_back(vertex);
+					deadEnds.push_back(vertex);
+					candidates.push_back(vertex);
+					--liveTriangles[vertex];
+					if (time - loadedAt[vertex] > cacheSize)
+						loadedAt[vertex] = time++;
+				}
+				emitted[triangle] = 1;
+			}
+
+			// Prefer the oldest candidate whose remaining triangles still fit before it gets evicted
+			fan = -1;
+			size_t bestPriority = 0;
+			for (unsigned int vertex : candidates)
+			{
+				if (liveTriangles[vertex] == 0)
+					continue;
+				size_t age = time - loadedAt[vertex];
+				size_t priority = age + 2 * liveTriangles[vertex] <= cacheSize ? age + 1 : 1;
+				if (priority > bestPriority)
+				{
+					fan = vertex;
+					bestPriority = priority;
+				}
+			}
+
+			if (fan >= 0)
+				continue;
+
+			// Dead end, back up to a recently used vertex or scan for any that is left
+			while (!deadEnds.empty() && fan < 0)
+			{
+				unsigned int vertex = deadEnds.back();
+				deadEnds.pop_back();
+				if (liveTriangles[vertex] > 0)
+					fan = vertex;
+			}
+			while (cursor < vertexCount && fan < 0)
+			{
+				if (liveTriangles[cursor] > 0)
+					fan = static_cast<long long>(cursor);
+				++cursor;
+			}
+			if (fan >= 0 && time - loadedAt[fan] > cacheSize)
+				coldStart = true;
+		}
+
+		std::copy(result.begin(), result.end(), indices.begin());
+		return clusters;
+	}
+
+	// Draws clusters facing away from the mesh centre first, they tend to occlude the rest
+	// (Sander et al. 2007). Keeps the previous order if the ACMR grows past threshold times.
+	static void optimizeOverdraw(std::vector<unsigned int>& indices, const std::vector<Vertex>& vertices,
+		const std::vector<size_t>& clusters, float threshold = 1.05f, unsigned int cacheSize = defaultCacheSize)
+	{
+		size_t triangleCount = indices.size() / 3;
+		if (clusters.size() < 2)
+			return;
+
+		std::vector<glm::vec3> centroids(clusters.size(), glm::vec3(0.f));
+		std::vector<glm::vec3> normals(clusters.size(), glm::vec3(0.f));
+		std::vector<float> areas(clusters.size(), 0.f);
+		glm::vec3 meshCentroid(0.f);
+		float meshArea = 0.f;
+
+		for (size_t cluster = 0; cluster < clusters.size(); ++cluster)
+		{
+			size_t end = cluster + 1 < clusters.size() ? clusters[cluster + 1] : triangleCount;
+			for (size_t triangle = clusters[cluster]; triangle < end; ++triangle)
+			{
+				const glm::vec3& a = vertices[indices[triangle * 3 + 0]].position;
+				const glm::vec3& b = vertices[indices[triangle * 3 + 1]].position;
+				const glm::vec3& c = vertices[indices[triangle * 3 + 2]].position;
+				glm::vec3 normal = glm::cross(b - a, c - a);
+				float area = glm::length(normal);
+
+				centroids[cluster] += (a + b + c) * (area / 3.f);
+				normals[cluster] += normal;
+				areas[cluster] += area;
+			}
+			meshCentroid += centroids[cluster];
+			meshArea += areas[cluster];
+			if (areas[cluster] > 0.f)
+				centroids[cluster] /= areas[cluster];
+		}
+		if (meshArea > 0.f)
+			meshCentroid /= meshArea;
+
+		std::vector<float> sortKeys(clusters.size(), 0.f);
+		std::vector<size_t> order(clusters.size());
+		for (size_t cluster = 0; cluster < clusters.size(); ++cluster)
+		{
+			float length = glm::length(normals[cluster]);
+			if (length > 0.f)
+				sortKeys[cluster] = glm::dot(centroids[cluster] - meshCentroid, normals[cluster] / length);
+			order[cluster] = cluster;
+		}
+		std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) { return sortKeys[a] > sortKeys[b]; });
+
+		std::vector<unsigned int> sorted;
+		sorted.reserve(indices.size());
+		for (size_t cluster : order)
+		{
+			size_t end = cluster + 1 < clusters.size() ? clusters[cluster + 1] : triangleCount;
+			sorted.insert(sorted.end(), indices.begin() + clusters[cluster] * 3, indices.begin() + end * 3);
+		}
+		sorted.insert(sorted.end(), indices.begin() + triangleCount * 3, indices.end());
+
+		double current = simulateCache(indices, vertices.size(), cacheSize).acmr;
+		if (simulateCache(sorted, vertices.size(), cacheSize).acmr <= current * threshold)
+			indices.swap(sorted);
+	}
+
+	// Renumbers vertices in order of first use so fetches walk the vertex buffer forward, unused vertices are dropped
+	static void optimizeVertexFetch(std::vector<Vertex>& vertices, std::vector<unsigned int>& indices)
+	{
+		const unsigned int unused = 0xffffffffu;
+		std::vector<unsigned int> remap(vertices.size(), unused);
+		std::vector<Vertex> reordered;
+		reordered.reserve(vertices.size());
+
+		for (unsigned int& index : indices)
+		{
+			if (remap[index] == unused)
+			{
+				remap[index] = static_cast<unsigned int>(reordered.size());
+				reordered.push_back(vertices[index]);
+			}
+			index = remap[index];
+		}
+
+		vertices.swap(reordered);
+	}
+};
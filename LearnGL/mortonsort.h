@@ -0,0 +1,250 @@
+#pragma once
+
+#include <algorithm>
+#include <cfloat>
+#include <chrono>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "threadpool.h"
+#include "transformstore.h"
+
+// Spreads the low 10 bits of v two bits apart
+inline uint32_t mortonSpread(uint32_t v)
+{
+	v &= 0x3ff;
+	v = (v | (v << 16)) & 0x030000ff;
+	v = (v | (v << 8)) & 0x0300f00f;
+	v = (v | (v << 4)) & 0x030c30c3;
+	v = (v | (v << 2)) & 0x09249249;
+	return v;
+}
+
+// 30 bit code of a position in [0, 1]^3, 10 bits per axis interleaved zyx
+inline uint32_t mortonCode(const glm::vec3& unit)
+{
+	glm::uvec3 cell = glm::uvec3(glm::clamp(unit, 0.f, 1.f) * 1023.f);
+	return mortonSpread(cell.x) | (mortonSpread(cell.y) << 1) | (mortonSpread(cell.z) << 2);
+}
+
+// Stable LSD radix sort of keys carrying values, 8 bits a pass. Each pool task counts and then scatters its
+// own contiguous chunk, so equal keys keep their order. Passes where every key has the same digit are skipped.
+inline void radixSort(std::vector<uint32_t>& keys, std::vector<uint32_t>& values, std::vector<uint32_t>& keyScratch,
+	std::vector<uint32_t>& valueScratch, ThreadPool& pool = ThreadPool::shared())
+{
+	const size_t minChunk = 16384;
+	size_t count = keys.size();
+	size_t taskCount = glm::max<size_t>(1, glm::min<size_t>(pool.getThreadCount(), count / minChunk));
+	size_t chunk = (count + taskCount - 1) / taskCount;
+	keyScratch.resize(count);
+	valueScratch.resize(count);
+	std::vector<size_t> offsets(taskCount * 256);
+
+	for (unsigned int shift = 0; shift < 32; shift += 8)
+	{
+		std::fill(offsets.begin(), offsets.end(), 0);
+		pool.run(taskCount, [&](size_t task)
+		{
+			size_t* histogram = offsets.data() + task * 256;
+			size_t end = glm::min(count, (task + 1) * chunk);
+			for (size_t i = task * chunk; i < end; ++i)
+				++histogram[(keys[i] >> shift) & 0xff];
+		});
+
+		// Digit major, task minor, so each task's keys of a digit land after the earlier tasks' ones
+		size_t running = 0;
+		bool oneDigit = false;
+		for (size_t digit = 0; digit < 256; ++digit)
+		{
+			size_t digitStart = running;
+			for (size_t task = 0; task < taskCount; ++task)
+			{
+				size_t tally = offsets[task * 256 + digit];
+				offsets[task * 256 + digit] = running;
+				running += tally;
+			}
+			oneDigit = oneDigit || running - digitStart == count;
+		}
+		if (oneDigit)
+			continue;
+
+		pool.run(taskCount, [&](size_t task)
+		{
+			size_t* offset = offsets.data() + task * 256;
+			size_t end = glm::min(count, (task + 1) * chunk);
+			for (size_t i = task * chunk; i < end; ++i)
+			{
+				size_t target = offset[(keys[i] >> shift) & 0xff]++;
+				keyScratch[target] = keys[i];
+				valueScratch[target] = values[i];
+			}
+		});
+		keys.swap(keyScratch);
+		values.swap(valueScratch);
+	}
+}
+
+struct MortonSortStats
+{
+	size_t instances = 0;
+	size_t moved = 0;			// instances whose code changed since the last sort, all of them on a full sort
+	size_t sorts = 0;
+	bool incremental = false;	// last sort merged the moved instances into the rest
+	double milliseconds = 0.0;
+};
+
+// Orders instance slots by the Morton code of their position within the bounds of the last full sort, so
+// instances close in space sit close in memory. Remembers every slot's code, the next sort only re-sorts
+// the slots whose code changed and merges them back into the rest when there are few of them, otherwise
+// radix sorts everything again with fresh bounds.
+class MortonSorter
+{
+public:
+	// Re-sorting more than this fraction of the instances is done as a full sort
+	static constexpr float incrementalFraction = 1.f / 16.f;
+
+private:
+	glm::vec3 boundsMin;
+	glm::vec3 scale;
+	std::vector<uint32_t> codes;		// per slot, ascending after the permutation of the last sort
+	std::vector<uint32_t> freshCodes;
+	std::vector<uint32_t> order;
+	std::vector<uint32_t> keyScratch;
+	std::vector<uint32_t> valueScratch;
+	std::vector<uint32_t> keptSlots;
+	std::vector<std::pair<uint32_t, uint32_t>> movedSlots;	// code, slot
+	MortonSortStats stats;
+
+public:
+	MortonSorter()
+		: boundsMin(0.f), scale(0.f)
+	{
+	}
+
+	const MortonSortStats& getStats() const
+	{
+		return stats;
+	}
+
+	// Permutation of the last sort() that returned true, new slot i takes old slot order[i]
+	const std::vector<uint32_t>& getOrder() const
+	{
+		return order;
+	}
+
+	// Returns false when the instances are already in order, otherwise apply getOrder() to every per instance array
+	bool sort(const TransformStore& transforms, ThreadPool& pool = ThreadPool::shared())
+	{
+		auto start = std::chrono::steady_clock::now();
+		size_t count = transforms.size();
+		bool full = codes.size() != count;
+		if (full)
+			fitBounds(transforms, pool);
+		encode(transforms, pool);
+
+		stats.moved = count;
+		if (!full)
+		{
+			stats.moved = 0;
+			for (size_t i = 0; i < count; ++i)
+				stats.moved += freshCodes[i] != codes[i] ? 1 : 0;
+			if (stats.moved > count * incrementalFraction)
+			{
+				full = true;
+				fitBounds(transforms, pool);
+				encode(transforms, pool);
+			}
+		}
+
+		if (full)
+		{
+			order.resize(count);
+			for (size_t i = 0; i < count; ++i)
+				order[i] = static_cast<uint32_t>(i);
+			codes.swap(freshCodes);
+			radixSort(codes, order, keyScratch, valueScratch, pool);
+		}
+		else
+			merge();
+
+		stats.instances = count;
+		stats.incremental = !full;
+		++stats.sorts;
+		stats.milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+		for (size_t i = 0; i < count; ++i)
+			if (order[i] != i)
+				return true;
+		return false;
+	}
+
+private:
+	void fitBounds(const TransformStore& transforms, ThreadPool& pool)
+	{
+		size_t count = transforms.size();
+		size_t rangeCount = glm::max<size_t>(1, glm::min<size_t>(pool.getThreadCount(), count / 16384));
+		size_t rangeSize = (count + rangeCount - 1) / rangeCount;
+		std::vector<glm::vec3> rangeMin(rangeCount, glm::vec3(FLT_MAX)), rangeMax(rangeCount, glm::vec3(-FLT_MAX));
+		pool.run(rangeCount, [&](size_t range)
+		{
+			size_t end = glm::min(count, (range + 1) * rangeSize);
+			for (size_t i = range * rangeSize; i < end; ++i)
+			{
+				glm::vec3 position = transforms.getPosition(i);
+				rangeMin[range] = glm::min(rangeMin[range], position);
+				rangeMax[range] = glm::max(rangeMax[range], position);
+			}
+		});
+
+		glm::vec3 boundsMax(-FLT_MAX);
+		boundsMin = glm::vec3(FLT_MAX);
+		for (size_t range = 0; range < rangeCount; ++range)
+		{
+			boundsMin = glm::min(boundsMin, rangeMin[range]);
+			boundsMax = glm::max(boundsMax, rangeMax[range]);
+		}
+		glm::vec3 size = boundsMax - boundsMin;
+		scale = glm::vec3(
+			size.x > 0.f ? 1.f / size.x : 0.f,
+			size.y > 0.f ? 1.f / size.y : 0.f,
+			size.z > 0.f ? 1.f / size.z : 0.f);
+	}
+
+	// Positions outside the bounds clamp to its faces until the next full sort
+	void encode(const TransformStore& transforms, ThreadPool& pool)
+	{
+		freshCodes.resize(transforms.size());
+		pool.parallelFor(transforms.size(), 16384, [&](size_t begin, size_t end)
+		{
+			for (size_t i = begin; i < end; ++i)
+				freshCodes[i] = mortonCode((transforms.getPosition(i) - boundsMin) * scale);
+		});
+	}
+
+	// The unchanged slots are still ascending, sorts the moved ones and merges both, unchanged first among equal codes
+	void merge()
+	{
+		keptSlots.clear();
+		movedSlots.clear();
+		for (size_t i = 0; i < codes.size(); ++i)
+		{
+			if (freshCodes[i] == codes[i])
+				keptSlots.push_back(static_cast<uint32_t>(i));
+			else
+				movedSlots.emplace_back(freshCodes[i], static_cast<uint32_t>(i));
+		}
+		std::sort(movedSlots.begin(), movedSlots.end());
+
+		order.resize(codes.size());
+		size_t kept = 0, moved = 0;
+		for (size_t i = 0; i < order.size(); ++i)
+		{
+			bool takeKept = moved == movedSlots.size() || (kept < keptSlots.size() && freshCodes[keptSlots[kept]] <= movedSlots[moved].first);
+			order[i] = takeKept ? keptSlots[kept++] : movedSlots[moved++].second;
+			codes[i] = freshCodes[order[i]];
+		}
+	}
+};
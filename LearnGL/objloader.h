@@ -0,0 +1,639 @@
+#pragma once
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "threadpool.h"
+
+struct Vertex
+{
+	glm::vec3 position;
+	glm::vec2 texCoord;
+	glm::vec3 normal;
+};
+
+// Read-only memory mapping of a whole file
+class MappedFile
+{
+private:
+	const char* data;
+	size_t size;
+#ifdef _WIN32
+	HANDLE file;
+	HANDLE mapping;
+#else
+	int file;
+#endif
+
+public:
+	MappedFile(const char* path)
+		: data(nullptr), size(0)
+	{
+#ifdef _WIN32
+		mapping = nullptr;
+		file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if (file == INVALID_HANDLE_VALUE)
+			return;
+
+		LARGE_INTEGER fileSize;
+		if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0)
+			return;
+		size = static_cast<size_t>(fileSize.QuadPart);
+
+		mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (!mapping)
+		{
+			size = 0;
+			return;
+		}
+		data = static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+		if (!data)
+			size = 0;
+#else
+		file = open(path, O_RDONLY);
+		if (file < 0)
+			return;
+
+		struct stat st;
+		if (fstat(file, &st) != 0 || st.st_size == 0)
+			return;
+		size = static_cast<size_t>(st.st_size);
+
+		void* view = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, 0);
+		if (view == MAP_FAILED)
+		{
+			size = 0;
+			return;
+		}
+		madvise(view, size, MADV_SEQUENTIAL);
+		data = static_cast<const char*>(view);
+#endif
+	}
+
+	~MappedFile()
+	{
+#ifdef _WIN32
+		if (data)
+			UnmapViewOfFile(data);
+		if (mapping)
+			CloseHandle(mapping);
+		if (file != INVALID_HANDLE_VALUE)
+			CloseHandle(file);
+#else
+		if (data)
+			munmap(const_cast<char*>(data), size);
+		if (file >= 0)
+			close(file);
+#endif
+	}
+
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+
+	bool isOpen() const
+	{
+		return data != nullptr;
+	}
+
+	const char* getData() const
+	{
+		return data;
+	}
+
+	size_t getSize() const
+	{
+		return size;
+	}
+};
+
+// Post-transform vertex cache efficiency of an index buffer, lower is better for both
+struct VertexCacheStats
+{
+	// Average cache miss ratio, vertex shader runs per triangle (0.5 at best, 3 at worst)
+	double acmr = 0.0;
+	// Average transform to vertex ratio, vertex shader runs per vertex (1 at best)
+	double atvr = 0.0;
+};
+
+struct ObjLoadStats
+{
+	size_t bytes = 0;
+	double seconds = 0.0;
+	unsigned int threadCount = 1;
+	bool fromCache = false;
+
+	// Filled when the mesh went through MeshOptimizer while loading
+	bool optimized = false;
+	double optimizeSeconds = 0.0;
+	VertexCacheStats unoptimizedCache;
+	// Filled when levels of detail were generated while loading
+	double lodSeconds = 0.0;
+
+	double megabytesPerSecond() const
+	{
+		if (seconds <= 0.0)
+			return 0.0;
+		return (static_cast<double>(bytes) / (1024.0 * 1024.0)) / seconds;
+	}
+};
+
+struct MeshStats
+{
+	size_t vertexCount = 0;
+	size_t indexCount = 0;
+	size_t indexSize = sizeof(unsigned int);
+	VertexCacheStats vertexCache;
+
+	// How many face corners share each stored vertex
+	double vertexReductionRatio() const
+	{
+		if (vertexCount == 0)
+			return 0.0;
+		return static_cast<double>(indexCount) / static_cast<double>(vertexCount);
+	}
+
+	// Bytes saved against one vertex and one 32-bit index per face corner
+	long long bytesSaved() const
+	{
+		long long unindexed = static_cast<long long>(indexCount * (sizeof(Vertex) + sizeof(unsigned int)));
+		long long indexed = static_cast<long long>(vertexCount * sizeof(Vertex) + indexCount * indexSize);
+		return unindexed - indexed;
+	}
+};
+
+// One face corner, 0-based; -1 when the attribute is missing
+struct ObjIndex
+{
+	int position;
+	int texCoord;
+	int normal;
+};
+
+// Corner that used negative OBJ indices, which were resolved against the counts of its own chunk
+struct ObjRelativeCorner
+{
+	size_t corner;
+	unsigned int components; // bit 0 position, bit 1 texCoord, bit 2 normal
+};
+
+// Raw OBJ attribute streams and triangulated face corners
+struct ObjData
+{
+	std::vector<glm::vec3> positions;
+	std::vector<glm::vec2> texCoords;
+	std::vector<glm::vec3> normals;
+	std::vector<ObjIndex> corners;
+	std::vector<ObjRelativeCorner> relativeCorners;
+};
+
+// OBJ parser that scans the bytes in place without allocating per line
+class ObjLoader
+{
+public:
+	static bool loadFile(const char* objPath, std::vector<Vertex>& vertices, std::vector<unsigned int>& indices, ObjLoadStats* stats = nullptr)
+	{
+		auto start = std::chrono::steady_clock::now();
+
+		MappedFile file(objPath);
+		if (!file.isOpen())
+		{
+			std::cerr << "Failed to open OBJ file: " << objPath << std::endl;
+			return false;
+		}
+
+		ObjData data;
+		unsigned int threadCount = parseBuffer(file.getData(), file.getSize(), data);
+		buildVertices(data, vertices, indices);
+
+		if (stats)
+		{
+			stats->bytes = file.getSize();
+			stats->threadCount = threadCount;
+			stats->seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		}
+		return true;
+	}
+
+	static bool loadMemory(const char* objData, size_t size, std::vector<Vertex>& vertices, std::vector<unsigned int>& indices, ObjLoadStats* stats = nullptr)
+	{
+		auto start = std::chrono::steady_clock::now();
+
+		ObjData data;
+		unsigned int threadCount = parseBuffer(objData, size, data);
+		buildVertices(data, vertices, indices);
+
+		if (stats)
+		{
+			stats->bytes = size;
+			stats->threadCount = threadCount;
+			stats->seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		}
+		return true;
+	}
+
+	// Buffers at least this large are parsed on ThreadPool::shared()
+	static const size_t parallelThreshold = 4 * 1024 * 1024;
+
+	// Parses serially or in parallel depending on the size, returns the number of threads used
+	static unsigned int parseBuffer(const char* objData, size_t size, ObjData& data)
+	{
+		ThreadPool& pool = ThreadPool::shared();
+		if (size < parallelThreshold || pool.getThreadCount() == 1)
+		{
+			parse(objData, objData + size, data);
+			return 1;
+		}
+
+		parseParallel(objData, objData + size, data, pool);
+		return pool.getThreadCount();
+	}
+
+	// Splits the buffer at line boundaries, parses the chunks on the pool and stitches them
+	// together with prefix sums. The result is identical to parse() over the whole buffer.
+	static void parseParallel(const char* begin, const char* end, ObjData& data, ThreadPool& pool, size_t minChunkSize = 1024 * 1024)
+	{
+		size_t size = static_cast<size_t>(end - begin);
+		size_t chunkCount = pool.getThreadCount() * 4;
+		if (chunkCount > size / minChunkSize)
+			chunkCount = size / minChunkSize;
+		if (chunkCount < 2)
+		{
+			parse(begin, end, data);
+			return;
+		}
+
+		std::vector<const char*> bounds(chunkCount + 1);
+		bounds[0] = begin;
+		bounds[chunkCount] = end;
+		for (size_t i = 1; i < chunkCount; ++i)
+		{
+			const char* p = begin + size / chunkCount * i;
+			if (p < bounds[i - 1])
+				p = bounds[i - 1];
+			bounds[i] = skipLine(p, end);
+		}
+
+		std::vector<ObjData> chunks(chunkCount);
+		pool.run(chunkCount, [&](size_t i)
+		{
+			parse(bounds[i], bounds[i + 1], chunks[i]);
+		});
+
+		// Exclusive prefix sums give every chunk its global offsets
+		std::vector<ObjCounts> offsets(chunkCount + 1);
+		for (size_t i = 0; i < chunkCount; ++i)
+		{
+			offsets[i + 1].positions = offsets[i].positions + chunks[i].positions.size();
+			offsets[i + 1].texCoords = offsets[i].texCoords + chunks[i].texCoords.size();
+			offsets[i + 1].normals = offsets[i].normals + chunks[i].normals.size();
+			offsets[i + 1].corners = offsets[i].corners + chunks[i].corners.size();
+		}
+
+		data.positions.resize(offsets[chunkCount].positions);
+		data.texCoords.resize(offsets[chunkCount].texCoords);
+		data.normals.resize(offsets[chunkCount].normals);
+		data.corners.resize(offsets[chunkCount].corners);
+
+		pool.run(chunkCount, [&](size_t i)
+		{
+			const ObjData& chunk = chunks[i];
+			const ObjCounts& offset = offsets[i];
+
+			std::copy(chunk.positions.begin(), chunk.positions.end(), data.positions.begin() + offset.positions);
+			std::copy(chunk.texCoords.begin(), chunk.texCoords.end(), data.texCoords.begin() + offset.texCoords);
+			std::copy(chunk.normals.begin(), chunk.normals.end(), data.normals.begin() + offset.normals);
+			std::copy(chunk.corners.begin(), chunk.corners.end(), data.corners.begin() + offset.corners);
+
+			for (const ObjRelativeCorner& relative : chunk.relativeCorners)
+			{
+				ObjIndex& corner = data.corners[offset.corners + relative.corner];
+				if (relative.components & 1)
+					corner.position += static_cast<int>(offset.positions);
+				if (relative.components & 2)
+					corner.texCoord += static_cast<int>(offset.texCoords);
+				if (relative.components & 4)
+					corner.normal += static_cast<int>(offset.normals);
+			}
+		});
+	}
+
+	static void parse(const char* p, const char* end, ObjData& data)
+	{
+		while (p < end)
+		{
+			p = skipSpaces(p, end);
+			if (p >= end)
+				break;
+
+			if (p[0] == 'v' && p + 1 < end)
+			{
+				if (isSpace(p[1]))
+				{
+					glm::vec3 position;
+					p = parseFloat(p + 1, end, position.x);
+					p = parseFloat(p, end, position.y);
+					p = parseFloat(p, end, position.z);
+					data.positions.push_back(position);
+				}
+				else if (p[1] == 't' && p + 2 < end && isSpace(p[2]))
+				{
+					glm::vec2 texCoord;
+					p = parseFloat(p + 2, end, texCoord.x);
+					p = parseFloat(p, end, texCoord.y);
+					data.texCoords.push_back(texCoord);
+				}
+				else if (p[1] == 'n' && p + 2 < end && isSpace(p[2]))
+				{
+					glm::vec3 normal;
+					p = parseFloat(p + 2, end, normal.x);
+					p = parseFloat(p, end, normal.y);
+					p = parseFloat(p, end, normal.z);
+					data.normals.push_back(normal);
+				}
+			}
+			else if (p[0] == 'f' && p + 1 < end && isSpace(p[1]))
+			{
+				p = parseFace(p + 1, end, data);
+			}
+
+			p = skipLine(p, end);
+		}
+	}
+
+	// Emits one vertex per unique (position, texCoord, normal) triplet and indexes the face corners into them
+	static void buildVertices(const ObjData& data, std::vector<Vertex>& vertices, std::vector<unsigned int>& indices)
+	{
+		struct Slot
+		{
+			ObjIndex key;
+			unsigned int vertex;
+		};
+		const unsigned int empty = 0xffffffffu;
+
+		// Open addressing with linear probing, kept at most half full
+		size_t capacity = 64;
+		while (capacity < data.corners.size() * 2)
+			capacity <<= 1;
+		const size_t mask = capacity - 1;
+		std::vector<Slot> table(capacity, Slot{ { -1, -1, -1 }, empty });
+
+		indices.reserve(indices.size() + data.corners.size());
+
+		for (const ObjIndex& corner : data.corners)
+		{
+			size_t slot = hashIndex(corner) & mask;
+			while (table[slot].vertex != empty &&
+				(table[slot].key.position != corner.position || table[slot].key.texCoord != corner.texCoord || table[slot].key.normal != corner.normal))
+				slot = (slot + 1) & mask;
+
+			if (table[slot].vertex == empty)
+			{
+				table[slot].key = corner;
+				table[slot].vertex = static_cast<unsigned int>(vertices.size());
+				vertices.push_back(makeVertex(data, corner));
+			}
+			indices.push_back(table[slot].vertex);
+		}
+	}
+
+	static Vertex makeVertex(const ObjData& data, const ObjIndex& corner)
+	{
+		Vertex vertex;
+		vertex.position = static_cast<size_t>(corner.position) < data.positions.size() ? data.positions[corner.position] : glm::vec3(0.f);
+		vertex.texCoord = static_cast<size_t>(corner.texCoord) < data.texCoords.size() ? data.texCoords[corner.texCoord] : glm::vec2(0.f);
+		vertex.normal = static_cast<size_t>(corner.normal) < data.normals.size() ? data.normals[corner.normal] : glm::vec3(0.f);
+		return vertex;
+	}
+
+private:
+	struct ObjCounts
+	{
+		size_t positions = 0;
+		size_t texCoords = 0;
+		size_t normals = 0;
+		size_t corners = 0;
+	};
+
+	static size_t hashIndex(const ObjIndex& index)
+	{
+		unsigned long long h = static_cast<unsigned int>(index.position) * 0x9E3779B97F4A7C15ull;
+		h ^= static_cast<unsigned int>(index.texCoord) * 0xC2B2AE3D27D4EB4Full;
+		h ^= static_cast<unsigned int>(index.normal) * 0x165667B19E3779F9ull;
+		return static_cast<size_t>(h ^ (h >> 32));
+	}
+
+	static bool isSpace(char c)
+	{
+		return c == ' ' || c == '\t' || c == '\r';
+	}
+
+	static bool isDigit(char c)
+	{
+		return static_cast<unsigned char>(c - '0') < 10;
+	}
+
+	static const char* skipSpaces(const char* p, const char* end)
+	{
+		while (p < end && isSpace(*p))
+			++p;
+		return p;
+	}
+
+	static const char* skipLine(const char* p, const char* end)
+	{
+		while (p < end && *p != '\n')
+			++p;
+		return p < end ? p + 1 : end;
+	}
+
+	static const char* parseFloat(const char* p, const char* end, float& out)
+	{
+		static const double powers[] =
+		{
+			1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10,
+			1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+		};
+
+		p = skipSpaces(p, end);
+
+		bool negative = false;
+		if (p < end && (*p == '-' || *p == '+'))
+			negative = *p++ == '-';
+
+		// Up to 19 significant digits fit in the mantissa, the rest only shift the exponent
+		unsigned long long mantissa = 0;
+		int digits = 0;
+		int exponent = 0;
+
+		while (p < end && isDigit(*p))
+		{
+			if (digits < 19)
+			{
+				mantissa = mantissa * 10 + (*p - '0');
+				if (mantissa)
+					++digits;
+			}
+			else
+				++exponent;
+			++p;
+		}
+
+		if (p < end && *p == '.')
+		{
+			++p;
+			while (p < end && isDigit(*p))
+			{
+				if (digits < 19)
+				{
+					mantissa = mantissa * 10 + (*p - '0');
+					if (mantissa)
+						++digits;
+					--exponent;
+				}
+				++p;
+			}
+		}
+
+		if (p < end && (*p == 'e' || *p == 'E'))
+		{
+			++p;
+			bool negativeExponent = false;
+			if (p < end && (*p == '-' || *p == '+'))
+				negativeExponent = *p++ == '-';
+
+			int value = 0;
+			while (p < end && isDigit(*p))
+			{
+				if (value < 10000)
+					value = value * 10 + (*p - '0');
+				++p;
+			}
+			exponent += negativeExponent ? -value : value;
+		}
+
+		double result = static_cast<double>(mantissa);
+		if (exponent < 0)
+		{
+			while (exponent < -22)
+			{
+				result /= 1e22;
+				exponent += 22;
+			}
+			result /= powers[-exponent];
+		}
+		else
+		{
+			while (exponent > 22)
+			{
+				result *= 1e22;
+				exponent -= 22;
+			}
+			result *= powers[exponent];
+		}
+
+		out = static_cast<float>(negative ? -result : result);
+		return p;
+	}
+
+	static const char* parseInt(const char* p, const char* end, int& out)
+	{
+		bool negative = false;
+		if (p < end && (*p == '-' || *p == '+'))
+			negative = *p++ == '-';
+
+		int value = 0;
+		while (p < end && isDigit(*p))
+			value = value * 10 + (*p++ - '0');
+
+		out = negative ? -value : value;
+		return p;
+	}
+
+	// Converts a 1-based OBJ index to 0-based and a negative one relative to the current count.
+	// Out of range results are kept here and turned into defaults by makeVertex().
+	static int resolveIndex(int index, size_t count)
+	{
+		if (index > 0)
+			return index - 1;
+		if (index < 0)
+			return static_cast<int>(count) + index;
+		return -1;
+	}
+
+	static void pushCorner(ObjData& data, const ObjIndex& corner, unsigned int relativeComponents)
+	{
+		if (relativeComponents)
+			data.relativeCorners.push_back({ data.corners.size(), relativeComponents });
+		data.corners.push_back(corner);
+	}
+
+	// Reads one face line and fan-triangulates it into data.corners
+	static const char* parseFace(const char* p, const char* end, ObjData& data)
+	{
+		ObjIndex first = {}, previous = {};
+		unsigned int firstRelative = 0, previousRelative = 0;
+		int cornerCount = 0;
+
+		while (true)
+		{
+			p = skipSpaces(p, end);
+			if (p >= end || !(isDigit(*p) || *p == '-' || *p == '+'))
+				break;
+
+			int position = 0, texCoord = 0, normal = 0;
+			p = parseInt(p, end, position);
+			if (p < end && *p == '/')
+			{
+				++p;
+				if (p < end && *p != '/')
+					p = parseInt(p, end, texCoord);
+				if (p < end && *p == '/')
+					p = parseInt(p + 1, end, normal);
+			}
+
+			ObjIndex corner;
+			corner.position = resolveIndex(position, data.positions.size());
+			corner.texCoord = resolveIndex(texCoord, data.texCoords.size());
+			corner.normal = resolveIndex(normal, data.normals.size());
+			unsigned int relative = (position < 0 ? 1u : 0u) | (texCoord < 0 ? 2u : 0u) | (normal < 0 ? 4u : 0u);
+
+			if (cornerCount == 0)
+			{
+				first = corner;
+				firstRelative = relative;
+			}
+			else if (cornerCount >= 2)
+			{
+				pushCorner(data, first, firstRelative);
+				pushCorner(data, previous, previousRelative);
+				pushCorner(data, corner, relative);
+			}
+			previous = corner;
+			previousRelative = relative;
+			++cornerCount;
+		}
+
+		return p;
+	}
+};
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+// GL_KHR_parallel_shader_compile, the ARB extension has the same values
+#ifndef GL_MAX_SHADER_COMPILER_THREADS_KHR
+#define GL_MAX_SHADER_COMPILER_THREADS_KHR 0x91B0
+#endif
+#ifndef GL_COMPLETION_STATUS_KHR
+#define GL_COMPLETION_STATUS_KHR 0x91B1
+#endif
+
+typedef void (APIENTRYP PFNGLMAXSHADERCOMPILERTHREADSKHRPROC)(GLuint count);
+
+// Whether GL_COMPLETION_STATUS_KHR can be asked of shaders and programs. The first call lets the driver use as
+// many compiler threads as it likes, needs a current context.
+inline bool parallelShaderCompileSupported()
+{
+	static int supported = -1;
+	if (supported < 0)
+	{
+		const char* name = nullptr;
+		if (glfwExtensionSupported("GL_KHR_parallel_shader_compile"))
+			name = "glMaxShaderCompilerThreadsKHR";
+		else if (glfwExtensionSupported("GL_ARB_parallel_shader_compile"))
+			name = "glMaxShaderCompilerThreadsARB";
+		PFNGLMAXSHADERCOMPILERTHREADSKHRPROC maxThreads = name ? reinterpret_cast<PFNGLMAXSHADERCOMPILERTHREADSKHRPROC>(glfwGetProcAddress(name)) : nullptr;
+		if (maxThreads)
+			maxThreads(0xFFFFFFFF);
+		supported = maxThreads ? 1 : 0;
+	}
+	return supported == 1;
+}
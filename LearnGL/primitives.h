@@ -3,6 +3,7 @@
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
 
+#include <algorithm>
 #include <iostream>
 #include <vector>
 
@@ -10,18 +11,29 @@
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
 
-struct Vertex
-{
-	glm::vec3 position;
-	glm::vec2 texCoord;
-	glm::vec3 normal;
-};
+#include "objloader.h"
+#include "geometryarena.h"
+#include "bvh.h"
+#include "gpuculler.h"
+#include "instancebuffer.h"
+#include "instanceculler.h"
+#include "instanceformat.h"
+#include "instancehandles.h"
+#include "instancering.h"
+#include "lod.h"
+#include "meshcache.h"
+#include "meshlet.h"
+#include "mortonsort.h"
+#include "transformstore.h"
+#include "vertexformat.h"
 
 class Triangle
 {
 private:
 	std::vector<glm::mat4> modelMatrices;
-	unsigned int instanceVBO;
+	InstanceBuffer instances;
+	InstanceHandles handles;
+	int arenaMesh = -1;
 	unsigned int VAO;
 	unsigned int VBO;
 	unsigned int EBO;
@@ -65,14 +77,15 @@ public:
 		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
 		glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW);
 
+		arenaMesh = GeometryArena::shared().addMesh(vertices, texCoords, sizeof(vertices) / (3 * sizeof(float)), indices, sizeof(indices) / sizeof(unsigned int));
+
 		// Set up instance model matrices
 		modelMatrices.resize(instanceCount, glm::mat4(1.0f));
+		handles.reset(instanceCount);
 
 
 		// Create instance matrix buffer object
-		glGenBuffers(1, &instanceVBO);
-		glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
-		glBufferData(GL_ARRAY_BUFFER, modelMatrices.size() * sizeof(glm::mat4), &modelMatrices[0], GL_DYNAMIC_DRAW);
+		instances.create(modelMatrices);
 
 		// Set up vertex array object
 		glGenVertexArrays(1, &VAO);
@@ -92,7 +105,7 @@ public:
 		glVertexAttribDivisor(1, 0);
 
 		// Set up instance matrix attribute
-		glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
+		glBindBuffer(GL_ARRAY_BUFFER, instances.getBuffer());
 		for (unsigned int i = 0; i < 4; ++i)
 		{
 			glEnableVertexAttribArray(3 + i);
@@ -117,11 +130,7 @@ public:
 		}
 
 		modelMatrices[index] = glm::translate(glm::mat4(1.0f), position);
-		if (modelMatrices.size() > 0)
-		{
-			glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
-			glBufferData(GL_ARRAY_BUFFER, modelMatrices.size() * sizeof(glm::mat4), &modelMatrices[0], GL_STATIC_DRAW);
-		}
+		instances.markDirty(index);
 	}
 
 	glm::vec3 getPosition(unsigned int index)
@@ -149,11 +158,7 @@ public:
 		modelMatrices[index] = glm::rotate(modelMatrices[index], glm::radians(rotationAngle.x), glm::vec3(1.0f, 0.0f, 0.0f));
 		modelMatrices[index] = glm::rotate(modelMatrices[index], glm::radians(rotationAngle.y), glm::vec3(0.0f, 1.0f, 0.0f));
 		modelMatrices[index] = glm::rotate(modelMatrices[index], glm::radians(rotationAngle.z), glm::vec3(0.0f, 0.0f, 1.0f));
-		if (modelMatrices.size() > 0)
-		{
-			glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
-			glBufferData(GL_ARRAY_BUFFER, modelMatrices.size() * sizeof(glm::mat4), &modelMatrices[0], GL_STATIC_DRAW);
-		}
+		instances.markDirty(index);
 	}
 
 	void scale(unsigned int index, const glm::vec3& scale)
@@ -165,40 +170,57 @@ public:
 		}
 
 		modelMatrices[index] = glm::scale(modelMatrices[index], scale);
-		if (modelMatrices.size() > 0)
-		{
-			glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
-			glBufferData(GL_ARRAY_BUFFER, modelMatrices.size() * sizeof(glm::mat4), &modelMatrices[0], GL_STATIC_DRAW);
-		}
+		instances.markDirty(index);
 	}
 
-	void add(const glm::vec3& position = glm::vec3(0.f, 0.f, 0.f))
+	InstanceHandle add(const glm::vec3& position = glm::vec3(0.f, 0.f, 0.f))
 	{
 		glm::mat4 model = glm::translate(glm::mat4(1.0f), position);
 		modelMatrices.push_back(model);
 		instanceCount = static_cast<int>(modelMatrices.size());
-
-		if (modelMatrices.size() > 0)
-		{
-			glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
-			glBufferData(GL_ARRAY_BUFFER, modelMatrices.size() * sizeof(glm::mat4), &modelMatrices[0], GL_STATIC_DRAW);
-		}
+		instances.markDirty(modelMatrices.size() - 1);
+		return handles.create();
 	}
 
+	// The last instance moves into index, so only that slot is uploaded again
 	void remove(unsigned int index)
 	{
 		if (index >= 0 && index < instanceCount)
 		{
-			modelMatrices.erase(modelMatrices.begin() + index);
+			handles.removeSlot(index);
+			swapRemove(modelMatrices, index);
+			if (index < modelMatrices.size())
+				instances.markDirty(index);
 		}
 
 		instanceCount = static_cast<int>(modelMatrices.size());
+	}
 
-		if (modelMatrices.size() > 0)
+	void remove(InstanceHandle handle)
+	{
+		if (!handles.valid(handle))
 		{
-			glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
-			glBufferData(GL_ARRAY_BUFFER, modelMatrices.size() * sizeof(glm::mat4), &modelMatrices[0], GL_STATIC_DRAW);
+			std::cerr << "Invalid instance handle: " << handle.id << std::endl;
+			return;
 		}
+		remove(handles.slot(handle));
+	}
+
+	// Index the handle's instance currently lives at, InstanceHandles::invalidSlot once it was removed
+	unsigned int getIndex(InstanceHandle handle) const
+	{
+		return handles.slot(handle);
+	}
+
+	InstanceHandle getHandle(unsigned int index) const
+	{
+		return handles.handle(index);
+	}
+
+	void drawBatched()
+	{
+		if (!GeometryArena::shared().submit(arenaMesh, modelMatrices.data(), modelMatrices.size()))
+			draw();
 	}
 
 	unsigned int getInstanceCount()
@@ -210,6 +232,7 @@ public:
 	{
 		if (modelMatrices.size() > 0)
 		{
+			instances.flush(modelMatrices);
 			glBindVertexArray(VAO);
 			glDrawElementsInstanced(GL_TRIANGLES, 3, GL_UNSIGNED_INT, 0, instanceCount);
 			glBindVertexArray(0);
@@ -221,7 +244,9 @@ class Square
 {
 private:
 	std::vector<glm::mat4> modelMatrices;
-	unsigned int instanceVBO;
+	InstanceBuffer instances;
+	InstanceHandles handles;
+	int arenaMesh = -1;
 	unsigned int VAO;
 	unsigned int VBO;
 	unsigned int EBO;
@@ -266,13 +291,14 @@ public:
 		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
 		glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW);
 
+		arenaMesh = GeometryArena::shared().addMesh(vertices, texCoords, sizeof(vertices) / (3 * sizeof(float)), indices, sizeof(indices) / sizeof(unsigned int));
+
 		// Set up instance model matrices
 		modelMatrices.resize(instanceCount, glm::mat4(1.0f));
+		handles.reset(instanceCount);
 
 		// Create instance matrix buffer object
-		glGenBuffers(1, &instanceVBO);
-		glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
-		glBufferData(GL_ARRAY_BUFFER, modelMatrices.size() * sizeof(glm::mat4), &modelMatrices[0], GL_DYNAMIC_DRAW);
+		instances.create(modelMatrices);
 
 		// Set up vertex array object
 		glGenVertexArrays(1, &VAO);
@@ -292,7 +318,7 @@ public:
 		glVertexAttribDivisor(1, 0);
 
 		// Set up instance matrix attribute
-		glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
+		glBindBuffer(GL_ARRAY_BUFFER, instances.getBuffer());
 		for (unsigned int i = 0; i < 4; ++i)
 		{
 			glEnableVertexAttribArray(3 + i);
@@ -317,11 +343,7 @@ public:
 		}
 
 		modelMatrices[index] = glm::translate(glm::mat4(1.0f), position);
-		if (modelMatrices.size() > 0)
-		{
-			glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
-			glBufferData(GL_ARRAY_BUFFER, modelMatrices.size() * sizeof(glm::mat4), &modelMatrices[0], GL_STATIC_DRAW);
-		}
+		instances.markDirty(index);
 	}
 
 	glm::vec3 getPosition(unsigned int index)
@@ -349,11 +371,7 @@ public:
 		modelMatrices[index] = glm::rotate(modelMatrices[index], glm::radians(rotationAngle.x), glm::vec3(1.0f, 0.0f, 0.0f));
 		modelMatrices[index] = glm::rotate(modelMatrices[index], glm::radians(rotationAngle.y), glm::vec3(0.0f, 1.0f, 0.0f));
 		modelMatrices[index] = glm::rotate(modelMatrices[index], glm::radians(rotationAngle.z), glm::vec3(0.0f, 0.0f, 1.0f));
-		if (modelMatrices.size() > 0)
-		{
-			glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
-			glBufferData(GL_ARRAY_BUFFER, modelMatrices.size() * sizeof(glm::mat4), &modelMatrices[0], GL_STATIC_DRAW);
-		}
+		instances.markDirty(index);
 	}
 
 	void scale(unsigned int index, const glm::vec3& scale)
@@ -365,40 +383,57 @@ public:
 		}
 
 		modelMatrices[index] = glm::scale(modelMatrices[index], scale);
-		if (modelMatrices.size() > 0)
-		{
-			glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
-			glBufferData(GL_ARRAY_BUFFER, modelMatrices.size() * sizeof(glm::mat4), &modelMatrices[0], GL_STATIC_DRAW);
-		}
+		instances.markDirty(index);
 	}
 
-	void add(const glm::vec3& position = glm::vec3(0.f, 0.f, 0.f))
+	InstanceHandle add(const glm::vec3& position = glm::vec3(0.f, 0.f, 0.f))
 	{
 		glm::mat4 model = glm::translate(glm::mat4(1.0f), position);
 		modelMatrices.push_back(model);
 		instanceCount = static_cast<int>(modelMatrices.size());
-
-		if (modelMatrices.size() > 0)
-		{
-			glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
-			glBufferData(GL_ARRAY_BUFFER, modelMatrices.size() * sizeof(glm::mat4), &modelMatrices[0], GL_STATIC_DRAW);
-		}
+		instances.markDirty(modelMatrices.size() - 1);
+		return handles.create();
 	}
 
+	// The last instance moves into index, so only that slot is uploaded again
 	void remove(unsigned int index)
 	{
 		if (index >= 0 && index < instanceCount)
 		{
-			modelMatrices.erase(modelMatrices.begin() + index);
+			handles.removeSlot(index);
+			swapRemove(modelMatrices, index);
+			if (index < modelMatrices.size())
+				instances.markDirty(index);
 		}
 
 		instanceCount = static_cast<int>(modelMatrices.size());
+	}
 
-		if (modelMatrices.size() > 0)
+	void remove(InstanceHandle handle)
+	{
+		if (!handles.valid(handle))
 		{
-			glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
-			glBufferData(GL_ARRAY_BUFFER, modelMatrices.size() * sizeof(glm::mat4), &modelMatrices[0], GL_STATIC_DRAW);
+			std::cerr << "Invalid instance handle: " << handle.id << std::endl;
+			return;
 		}
+		remove(handles.slot(handle));
+	}
+
+	// Index the handle's instance currently lives at, InstanceHandles::invalidSlot once it was removed
+	unsigned int getIndex(InstanceHandle handle) const
+	{
+		return handles.slot(handle);
+	}
+
+	InstanceHandle getHandle(unsigned int index) const
+	{
+		return handles.handle(index);
+	}
+
+	void drawBatched()
+	{
+		if (!GeometryArena::shared().submit(arenaMesh, modelMatrices.data(), modelMatrices.size()))
+			draw();
 	}
 
 	unsigned int getInstanceCount()
@@ -410,6 +445,7 @@ public:
 	{
 		if (modelMatrices.size() > 0)
 		{
+			instances.flush(modelMatrices);
 			glBindVertexArray(VAO);
 			glDrawElementsInstanced(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0, instanceCount);
 			glBindVertexArray(0);
@@ -421,7 +457,9 @@ class Cube
 {
 private:
 	std::vector<glm::mat4> modelMatrices;
-	unsigned int instanceVBO;
+	InstanceBuffer instances;
+	InstanceHandles handles;
+	int arenaMesh = -1;
 	unsigned int VAO;
 	unsigned int VBO;
 	unsigned int EBO;
@@ -533,13 +571,14 @@ public:
 		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
 		glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW);
 
+		arenaMesh = GeometryArena::shared().addMesh(vertices, texCoords, sizeof(vertices) / (3 * sizeof(float)), indices, sizeof(indices) / sizeof(unsigned int));
+
 		// Set up instance model matrices
 		modelMatrices.resize(instanceCount, glm::mat4(1.0f));
+		handles.reset(instanceCount);
 
 		// Create instance matrix buffer object
-		glGenBuffers(1, &instanceVBO);
-		glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
-		glBufferData(GL_ARRAY_BUFFER, modelMatrices.size() * sizeof(glm::mat4), &modelMatrices[0], GL_DYNAMIC_DRAW);
+		instances.create(modelMatrices);
 
 		// Set up vertex array object
 		glGenVertexArrays(1, &VAO);
@@ -559,7 +598,7 @@ public:
 		glVertexAttribDivisor(1, 0);
 
 		// Set up instance matrix attribute
-		glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
+		glBindBuffer(GL_ARRAY_BUFFER, instances.getBuffer());
 		for (unsigned int i = 0; i < 4; ++i)
 		{
 			glEnableVertexAttribArray(3 + i);
@@ -585,11 +624,7 @@ public:
 		}
 
 		modelMatrices[index] = glm::translate(glm::mat4(1.0f), position);
-		if (modelMatrices.size() > 0)
-		{
-			glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
-			glBufferData(GL_ARRAY_BUFFER, modelMatrices.size() * sizeof(glm::mat4), &modelMatrices[0], GL_STATIC_DRAW);
-		}
+		instances.markDirty(index);
 	}
 
 	glm::vec3 getPosition(unsigned int index)
@@ -617,11 +652,7 @@ public:
 		modelMatrices[index] = glm::rotate(modelMatrices[index], glm::radians(rotationAngle.x), glm::vec3(1.0f, 0.0f, 0.0f));
 		modelMatrices[index] = glm::rotate(modelMatrices[index], glm::radians(rotationAngle.y), glm::vec3(0.0f, 1.0f, 0.0f));
 		modelMatrices[index] = glm::rotate(modelMatrices[index], glm::radians(rotationAngle.z), glm::vec3(0.0f, 0.0f, 1.0f));
-		if (modelMatrices.size() > 0)
-		{
-			glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
-			glBufferData(GL_ARRAY_BUFFER, modelMatrices.size() * sizeof(glm::mat4), &modelMatrices[0], GL_STATIC_DRAW);
-		}
+		instances.markDirty(index);
 	}
 
 	void scale(unsigned int index, const glm::vec3& scale)
@@ -633,40 +664,57 @@ public:
 		}
 
 		modelMatrices[index] = glm::scale(modelMatrices[index], scale);
-		if (modelMatrices.size() > 0)
-		{
-			glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
-			glBufferData(GL_ARRAY_BUFFER, modelMatrices.size() * sizeof(glm::mat4), &modelMatrices[0], GL_STATIC_DRAW);
-		}
+		instances.markDirty(index);
 	}
 
-	void add(const glm::vec3& position = glm::vec3(0.f, 0.f, 0.f))
+	InstanceHandle add(const glm::vec3& position = glm::vec3(0.f, 0.f, 0.f))
 	{
 		glm::mat4 model = glm::translate(glm::mat4(1.0f), position);
 		modelMatrices.push_back(model);
 		instanceCount = static_cast<int>(modelMatrices.size());
-
-		if (modelMatrices.size() > 0)
-		{
-			glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
-			glBufferData(GL_ARRAY_BUFFER, modelMatrices.size() * sizeof(glm::mat4), &modelMatrices[0], GL_STATIC_DRAW);
-		}
+		instances.markDirty(modelMatrices.size() - 1);
+		return handles.create();
 	}
 
+	// The last instance moves into index, so only that slot is uploaded again
 	void remove(unsigned int index)
 	{
 		if (index >= 0 && index < instanceCount)
 		{
-			modelMatrices.erase(modelMatrices.begin() + index);
+			handles.removeSlot(index);
+			swapRemove(modelMatrices, index);
+			if (index < modelMatrices.size())
+				instances.markDirty(index);
 		}
 
 		instanceCount = static_cast<int>(modelMatrices.size());
+	}
 
-		if (modelMatrices.size() > 0)
+	void remove(InstanceHandle handle)
+	{
+		if (!handles.valid(handle))
 		{
-			glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
-			glBufferData(GL_ARRAY_BUFFER, modelMatrices.size() * sizeof(glm::mat4), &modelMatrices[0], GL_STATIC_DRAW);
+			std::cerr << "Invalid instance handle: " << handle.id << std::endl;
+			return;
 		}
+		remove(handles.slot(handle));
+	}
+
+	// Index the handle's instance currently lives at, InstanceHandles::invalidSlot once it was removed
+	unsigned int getIndex(InstanceHandle handle) const
+	{
+		return handles.slot(handle);
+	}
+
+	InstanceHandle getHandle(unsigned int index) const
+	{
+		return handles.handle(index);
+	}
+
+	void drawBatched()
+	{
+		if (!GeometryArena::shared().submit(arenaMesh, modelMatrices.data(), modelMatrices.size()))
+			draw();
 	}
 
 	unsigned int getInstanceCount()
@@ -678,6 +726,7 @@ public:
 	{
 		if (modelMatrices.size() > 0)
 		{
+			instances.flush(modelMatrices);
 			glBindVertexArray(VAO);
 			glDrawElementsInstanced(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0, instanceCount);
 			glBindVertexArray(0);
@@ -689,7 +738,9 @@ class Pyramid
 {
 private:
 	std::vector<glm::mat4> modelMatrices;
-	unsigned int instanceVBO;
+	InstanceBuffer instances;
+	InstanceHandles handles;
+	int arenaMesh = -1;
 	unsigned int VAO;
 	unsigned int VBO;
 	unsigned int EBO;
@@ -782,13 +833,14 @@ public:
 		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
 		glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW);
 
+		arenaMesh = GeometryArena::shared().addMesh(vertices, texCoords, sizeof(vertices) / (3 * sizeof(float)), indices, sizeof(indices) / sizeof(unsigned int));
+
 		// Set up instance model matrices
 		modelMatrices.resize(instanceCount, glm::mat4(1.0f));
+		handles.reset(instanceCount);
 
 		// Create instance matrix buffer object
-		glGenBuffers(1, &instanceVBO);
-		glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
-		glBufferData(GL_ARRAY_BUFFER, modelMatrices.size() * sizeof(glm::mat4), &modelMatrices[0], GL_DYNAMIC_DRAW);
+		instances.create(modelMatrices);
 
 		// Set up vertex array object
 		glGenVertexArrays(1, &VAO);
@@ -808,7 +860,7 @@ public:
 		glVertexAttribDivisor(1, 0);
 
 		// Set up instance matrix attribute
-		glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
+		glBindBuffer(GL_ARRAY_BUFFER, instances.getBuffer());
 		for (unsigned int i = 0; i < 4; ++i)
 		{
 			glEnableVertexAttribArray(3 + i);
@@ -833,11 +885,7 @@ public:
 		}
 
 		modelMatrices[index] = glm::translate(glm::mat4(1.0f), position);
-		if (modelMatrices.size() > 0)
-		{
-			glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
-			glBufferData(GL_ARRAY_BUFFER, modelMatrices.size() * sizeof(glm::mat4), &modelMatrices[0], GL_STATIC_DRAW);
-		}
+		instances.markDirty(index);
 	}
 
 	glm::vec3 getPosition(unsigned int index)
@@ -865,11 +913,7 @@ public:
 		modelMatrices[index] = glm::rotate(modelMatrices[index], glm::radians(rotationAngle.x), glm::vec3(1.0f, 0.0f, 0.0f));
 		modelMatrices[index] = glm::rotate(modelMatrices[index], glm::radians(rotationAngle.y), glm::vec3(0.0f, 1.0f, 0.0f));
 		modelMatrices[index] = glm::rotate(modelMatrices[index], glm::radians(rotationAngle.z), glm::vec3(0.0f, 0.0f, 1.0f));
-		if (modelMatrices.size() > 0)
-		{
-			glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
-			glBufferData(GL_ARRAY_BUFFER, modelMatrices.size() * sizeof(glm::mat4), &modelMatrices[0], GL_STATIC_DRAW);
-		}
+		instances.markDirty(index);
 	}
 
 	void scale(unsigned int index, const glm::vec3& scale)
@@ -881,40 +925,57 @@ public:
 		}
 
 		modelMatrices[index] = glm::scale(modelMatrices[index], scale);
-		if (modelMatrices.size() > 0)
-		{
-			glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
-			glBufferData(GL_ARRAY_BUFFER, modelMatrices.size() * sizeof(glm::mat4), &modelMatrices[0], GL_STATIC_DRAW);
-		}
+		instances.markDirty(index);
 	}
 
-	void add(const glm::vec3& position = glm::vec3(0.f, 0.f, 0.f))
+	InstanceHandle add(const glm::vec3& position = glm::vec3(0.f, 0.f, 0.f))
 	{
 		glm::mat4 model = glm::translate(glm::mat4(1.0f), position);
 		modelMatrices.push_back(model);
 		instanceCount = static_cast<int>(modelMatrices.size());
-
-		if (modelMatrices.size() > 0)
-		{
-			glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
-			glBufferData(GL_ARRAY_BUFFER, modelMatrices.size() * sizeof(glm::mat4), &modelMatrices[0], GL_STATIC_DRAW);
-		}
+		instances.markDirty(modelMatrices.size() - 1);
+		return handles.create();
 	}
 
+	// The last instance moves into index, so only that slot is uploaded again
 	void remove(unsigned int index)
 	{
 		if (index >= 0 && index < instanceCount)
 		{
-			modelMatrices.erase(modelMatrices.begin() + index);
+			handles.removeSlot(index);
+			swapRemove(modelMatrices, index);
+			if (index < modelMatrices.size())
+				instances.markDirty(index);
 		}
 
 		instanceCount = static_cast<int>(modelMatrices.size());
+	}
 
-		if (modelMatrices.size() > 0)
+	void remove(InstanceHandle handle)
+	{
+		if (!handles.valid(handle))
 		{
-			glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
-			glBufferData(GL_ARRAY_BUFFER, modelMatrices.size() * sizeof(glm::mat4), &modelMatrices[0], GL_STATIC_DRAW);
+			std::cerr << "Invalid instance handle: " << handle.id << std::endl;
+			return;
 		}
+		remove(handles.slot(handle));
+	}
+
+	// Index the handle's instance currently lives at, InstanceHandles::invalidSlot once it was removed
+	unsigned int getIndex(InstanceHandle handle) const
+	{
+		return handles.slot(handle);
+	}
+
+	InstanceHandle getHandle(unsigned int index) const
+	{
+		return handles.handle(index);
+	}
+
+	void drawBatched()
+	{
+		if (!GeometryArena::shared().submit(arenaMesh, modelMatrices.data(), modelMatrices.size()))
+			draw();
 	}
 
 	unsigned int getInstanceCount()
@@ -926,6 +987,7 @@ public:
 	{
 		if (modelMatrices.size() > 0)
 		{
+			instances.flush(modelMatrices);
 			glBindVertexArray(VAO);
 			glDrawElementsInstanced(GL_TRIANGLES, 12, GL_UNSIGNED_INT, 0, instanceCount);
 			glBindVertexArray(0);
@@ -942,116 +1004,48 @@ private:
 	unsigned int vertexCount;
 	unsigned int indexCount;
 	std::vector<glm::mat4> modelMatrices;
-	unsigned int instanceVBO;
+	InstanceBuffer instances;
+	InstanceHandles handles;
+	int arenaMesh = -1;
 	unsigned int instanceCount;
 	std::vector<Vertex> vertices;
 	std::vector<unsigned int> indices;
+	GLenum indexType;
+	glm::vec3 boundsMin;
+	glm::vec3 boundsMax;
+	ObjLoadStats loadStats;
+	MeshStats meshStats;
+	VertexFormat vertexFormat;
+	VertexDequantization dequantization;
+	QuantizationError quantizationError;
+	std::vector<Meshlet> meshlets;
+	std::vector<MeshletRun> meshletRuns;
+	std::vector<GLsizei> runCounts;
+	std::vector<const void*> runOffsets;
+	MeshletCuller meshletCuller;
+	MeshletStats meshletStats;
+	LodRenderer lodRenderer;
+	InstanceCuller instanceCuller;
 public:
-	Object(const char* objPath, unsigned int count = 1)
-		: instanceCount(count)
+	Object(const char* objPath, unsigned int count = 1, VertexFormat format = VertexFormat::Full)
+		: instanceCount(count), vertexFormat(format)
 	{
 		loadObj(objPath);
-
-		// Create vertex array object
-		glGenVertexArrays(1, &VAO);
-		glBindVertexArray(VAO);
-
-		// Create vertex buffer object
-		glGenBuffers(1, &VBO);
-		glBindBuffer(GL_ARRAY_BUFFER, VBO);
-		glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(Vertex), vertices.data(), GL_STATIC_DRAW);
-
-		// Create element buffer object
-		glGenBuffers(1, &EBO);
-		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
-		glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(unsigned int), indices.data(), GL_STATIC_DRAW);
-
-		// Set vertex attribute pointers
-		glEnableVertexAttribArray(0);
-		glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, position));
-
-		glEnableVertexAttribArray(1);
-		glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, texCoord));
-
-		glEnableVertexAttribArray(2);
-		glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, normal));
-
-		// Set up instance model matrices
-		modelMatrices.resize(instanceCount, glm::mat4(1.0f));
-
-		// Create instance matrix buffer object
-		glGenBuffers(1, &instanceVBO);
-		glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
-		glBufferData(GL_ARRAY_BUFFER, modelMatrices.size() * sizeof(glm::mat4), &modelMatrices[0], GL_DYNAMIC_DRAW);
-
-		// Set up instance matrix attribute
-		for (unsigned int i = 0; i < 4; ++i)
-		{
-			glEnableVertexAttribArray(3 + i);
-			glVertexAttribPointer(3 + i, 4, GL_FLOAT, GL_FALSE, sizeof(glm::mat4), (void*)(sizeof(glm::vec4) * i));
-			glVertexAttribDivisor(3 + i, 1);
-		}
-
-		// Unbind VAO
-		glBindVertexArray(0);
-
-		// Store the number of vertices and indices
-		vertexCount = static_cast<int>(vertices.size());
-		indexCount = static_cast<int>(indices.size());
 	}
 
-	Object(std::string& objData, unsigned int count = 1)
-		: instanceCount(count)
+	Object(std::string& objData, unsigned int count = 1, VertexFormat format = VertexFormat::Full)
+		: instanceCount(count), vertexFormat(format)
 	{
 		loadObjStr(objData);
+	}
 
-
-		// Create vertex array object
-		glGenVertexArrays(1, &VAO);
-		glBindVertexArray(VAO);
-
-		// Create vertex buffer object
-		glGenBuffers(1, &VBO);
-		glBindBuffer(GL_ARRAY_BUFFER, VBO);
-		glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(Vertex), vertices.data(), GL_STATIC_DRAW);
-
-		// Create element buffer object
-		glGenBuffers(1, &EBO);
-		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
-		glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(unsigned int), indices.data(), GL_STATIC_DRAW);
-
-		// Set vertex attribute pointers
-		glEnableVertexAttribArray(0);
-		glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, position));
-
-		glEnableVertexAttribArray(1);
-		glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, texCoord));
-
-		glEnableVertexAttribArray(2);
-		glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, normal));
-
-		// Set up instance model matrices
-		modelMatrices.resize(instanceCount, glm::mat4(1.0f));
-
-		// Create instance matrix buffer object
-		glGenBuffers(1, &instanceVBO);
-		glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
-		glBufferData(GL_ARRAY_BUFFER, modelMatrices.size() * sizeof(glm::mat4), &modelMatrices[0], GL_DYNAMIC_DRAW);
-
-		// Set up instance matrix attribute
-		for (unsigned int i = 0; i < 4; ++i)
-		{
-			glEnableVertexAttribArray(3 + i);
-			glVertexAttribPointer(3 + i, 4, GL_FLOAT, GL_FALSE, sizeof(glm::mat4), (void*)(sizeof(glm::vec4) * i));
-			glVertexAttribDivisor(3 + i, 1);
-		}
-
-		// Unbind VAO
-		glBindVertexArray(0);
-
-		// Store the number of vertices and indices
-		vertexCount = static_cast<int>(vertices.size());
-		indexCount = static_cast<int>(indices.size());
+	// From the <name>_vertices, _indices and _lods arrays baked by ObjBake, uploaded without any parsing
+	template<typename Index, size_t FloatCount, size_t IndexCount, size_t LodCount>
+	Object(const float (&vertexData)[FloatCount], const Index (&indexData)[IndexCount], const MeshLod (&lodData)[LodCount],
+		unsigned int count = 1, VertexFormat format = VertexFormat::Full)
+		: instanceCount(count), vertexFormat(format)
+	{
+		setupMesh(makeBakedMeshView(vertexData, FloatCount, indexData, IndexCount, lodData, LodCount));
 	}
 
 	~Object()
@@ -1070,11 +1064,7 @@ public:
 		}
 
 		modelMatrices[index] = glm::translate(glm::mat4(1.0f), position);
-		if (modelMatrices.size() > 0)
-		{
-			glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
-			glBufferData(GL_ARRAY_BUFFER, modelMatrices.size() * sizeof(glm::mat4), &modelMatrices[0], GL_STATIC_DRAW);
-		}
+		instances.markDirty(index);
 	}
 
 	glm::vec3 getPosition(unsigned int index)
@@ -1102,11 +1092,7 @@ public:
 		modelMatrices[index] = glm::rotate(modelMatrices[index], glm::radians(rotationAngle.x), glm::vec3(1.0f, 0.0f, 0.0f));
 		modelMatrices[index] = glm::rotate(modelMatrices[index], glm::radians(rotationAngle.y), glm::vec3(0.0f, 1.0f, 0.0f));
 		modelMatrices[index] = glm::rotate(modelMatrices[index], glm::radians(rotationAngle.z), glm::vec3(0.0f, 0.0f, 1.0f));
-		if (modelMatrices.size() > 0)
-		{
-			glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
-			glBufferData(GL_ARRAY_BUFFER, modelMatrices.size() * sizeof(glm::mat4), &modelMatrices[0], GL_STATIC_DRAW);
-		}
+		instances.markDirty(index);
 	}
 
 	void scale(unsigned int index, const glm::vec3& scale)
@@ -1118,255 +1104,255 @@ public:
 		}
 
 		modelMatrices[index] = glm::scale(modelMatrices[index], scale);
-		if (modelMatrices.size() > 0)
-		{
-			glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
-			glBufferData(GL_ARRAY_BUFFER, modelMatrices.size() * sizeof(glm::mat4), &modelMatrices[0], GL_STATIC_DRAW);
-		}
+		instances.markDirty(index);
 	}
 
-	void add(const glm::vec3& position = glm::vec3(0.f, 0.f, 0.f))
+	InstanceHandle add(const glm::vec3& position = glm::vec3(0.f, 0.f, 0.f))
 	{
 		glm::mat4 model = glm::translate(glm::mat4(1.0f), position);
 		modelMatrices.push_back(model);
 		instanceCount = static_cast<int>(modelMatrices.size());
-
-		if (modelMatrices.size() > 0)
-		{
-			glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
-			glBufferData(GL_ARRAY_BUFFER, modelMatrices.size() * sizeof(glm::mat4), &modelMatrices[0], GL_STATIC_DRAW);
-		}
+		instances.markDirty(modelMatrices.size() - 1);
+		return handles.create();
 	}
 
+	// The last instance moves into index, so only that slot is uploaded again
 	void remove(unsigned int index)
 	{
 		if (index >= 0 && index < instanceCount)
 		{
-			modelMatrices.erase(modelMatrices.begin() + index);
+			handles.removeSlot(index);
+			swapRemove(modelMatrices, index);
+			if (index < modelMatrices.size())
+				instances.markDirty(index);
 		}
 
 		instanceCount = static_cast<int>(modelMatrices.size());
+	}
 
-		if (modelMatrices.size() > 0)
+	void remove(InstanceHandle handle)
+	{
+		if (!handles.valid(handle))
 		{
-			glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
-			glBufferData(GL_ARRAY_BUFFER, modelMatrices.size() * sizeof(glm::mat4), &modelMatrices[0], GL_STATIC_DRAW);
+			std::cerr << "Invalid instance handle: " << handle.id << std::endl;
+			return;
 		}
+		remove(handles.slot(handle));
 	}
 
-	unsigned int getInstanceCount()
+	// Index the handle's instance currently lives at, InstanceHandles::invalidSlot once it was removed
+	unsigned int getIndex(InstanceHandle handle) const
 	{
-		return instanceCount;
+		return handles.slot(handle);
 	}
 
-	void draw()
+	InstanceHandle getHandle(unsigned int index) const
 	{
-		if (modelMatrices.size() > 0)
-		{
-			glBindVertexArray(VAO);
-			glDrawElementsInstanced(GL_TRIANGLES, indexCount, GL_UNSIGNED_INT, 0, instanceCount);
-			glBindVertexArray(0);
-		}
+		return handles.handle(index);
 	}
 
-private:
-	void loadObj(const char* objPath)
+	// Sets every id to the matrix setPosition, rotate and scale build from positions[i], rotations[i] (degrees
+	// about the local x, y then z axis) and scales[i]. Null rotations or scales mean none. The batch is checked
+	// once up front and only the span from the lowest to the highest id is uploaded.
+	void setTransforms(const uint32_t* ids, size_t count, const glm::vec3* positions, const glm::vec3* rotations = nullptr, const glm::vec3* scales = nullptr)
 	{
-		std::ifstream file(objPath);
-		std::string line;
-
-		std::vector<glm::vec3> positions;
-		std::vector<glm::vec2> texCoords;
-		std::vector<glm::vec3> normals;
+		if (count == 0 || !validInstanceIds(ids, count, instanceCount, "setTransforms"))
+			return;
 
-		while (std::getline(file, line))
+		uint32_t first = ids[0], last = ids[0];
+		for (size_t i = 0; i < count; ++i)
 		{
-			std::istringstream iss(line);
-			std::string type;
-			iss >> type;
-
-			if (type == "v")
-			{
-				glm::vec3 position;
-				iss >> position.x >> position.y >> position.z;
-				positions.push_back(position);
-			}
-			else if (type == "vt")
-			{
-				glm::vec2 texCoord;
-				iss >> texCoord.x >> texCoord.y;
-				texCoords.push_back(texCoord);
-			}
-			else if (type == "vn")
-			{
-				glm::vec3 normal;
-				iss >> normal.x >> normal.y >> normal.z;
-				normals.push_back(normal);
-			}
-			else if (type == "f")
+			glm::mat4 model = glm::translate(glm::mat4(1.0f), positions[i]);
+			if (rotations)
 			{
-				for (int i = 0; i < 3; ++i)
-				{
-					std::string vertexData;
-					iss >> vertexData;
-					std::istringstream vdiss(vertexData);
-
-					std::string positionIndex, texCoordIndex, normalIndex;
-					std::getline(vdiss, positionIndex, '/');
-					std::getline(vdiss, texCoordIndex, '/');
-					std::getline(vdiss, normalIndex, '/');
-
-					unsigned int posIndex = std::stoi(positionIndex) - 1;
-					unsigned int texIndex = std::stoi(texCoordIndex) - 1;
-					unsigned int normIndex = std::stoi(normalIndex) - 1;
-
-					Vertex vertex;
-					vertex.position = positions[posIndex];
-					vertex.texCoord = texCoords[texIndex];
-					vertex.normal = normals[normIndex];
-
-					vertices.push_back(vertex);
-					indices.push_back(static_cast<unsigned int>(indices.size()));
-				}
+				model = glm::rotate(model, glm::radians(rotations[i].x), glm::vec3(1.0f, 0.0f, 0.0f));
+				model = glm::rotate(model, glm::radians(rotations[i].y), glm::vec3(0.0f, 1.0f, 0.0f));
+				model = glm::rotate(model, glm::radians(rotations[i].z), glm::vec3(0.0f, 0.0f, 1.0f));
 			}
+			if (scales)
+				model = glm::scale(model, scales[i]);
+			modelMatrices[ids[i]] = model;
+			first = std::min(first, ids[i]);
+			last = std::max(last, ids[i]);
 		}
+		instances.markDirty(first, last - first + 1);
 	}
 
-	void loadObjStr(std::string& objData)
+	// Appends count instances, the next draw uploads them with at most one reallocation. Their handles
+	// follow each other, getHandle(getInstanceCount() - count + i) names the i-th one.
+	void addMany(const glm::vec3* positions, size_t count)
 	{
-		std::istringstream file(objData);
-		std::string line;
+		size_t first = modelMatrices.size();
+		modelMatrices.reserve(first + count);
+		handles.reserve(first + count);
+		for (size_t i = 0; i < count; ++i)
+		{
+			modelMatrices.push_back(glm::translate(glm::mat4(1.0f), positions[i]));
+			handles.create();
+		}
+		instanceCount = static_cast<int>(modelMatrices.size());
+		instances.markDirty(first, count);
+	}
 
-		std::vector<glm::vec3> positions;
-		std::vector<glm::vec2> texCoords;
-		std::vector<glm::vec3> normals;
+	// Removes every id with swap and pop, highest first so the ids still to go never move. Duplicates are ignored.
+	void removeMany(const uint32_t* ids, size_t count)
+	{
+		if (count == 0 || !validInstanceIds(ids, count, instanceCount, "removeMany"))
+			return;
 
-		while (std::getline(file, line))
+		std::vector<uint32_t> sorted = sortedInstanceIds(ids, count);
+		for (size_t i = sorted.size(); i-- > 0;)
 		{
-			std::istringstream iss(line);
-			std::string type;
-			iss >> type;
+			handles.removeSlot(sorted[i]);
+			swapRemove(modelMatrices, sorted[i]);
+			if (sorted[i] < modelMatrices.size())
+				instances.markDirty(sorted[i]);
+		}
+		instanceCount = static_cast<int>(modelMatrices.size());
+	}
 
-			if (type == "v")
-			{
-				glm::vec3 position;
-				iss >> position.x >> position.y >> position.z;
-				positions.push_back(position);
-			}
-			else if (type == "vt")
-			{
-				glm::vec2 texCoord;
-				iss >> texCoord.x >> texCoord.y;
-				texCoords.push_back(texCoord);
-			}
-			else if (type == "vn")
-			{
-				glm::vec3 normal;
-				iss >> normal.x >> normal.y >> normal.z;
-				normals.push_back(normal);
-			}
-			else if (type == "f")
-			{
-				for (int i = 0; i < 3; ++i)
-				{
-					std::string vertexData;
-					iss >> vertexData;
-					std::istringstream vdiss(vertexData);
-
-					std::string positionIndex, texCoordIndex, normalIndex;
-					std::getline(vdiss, positionIndex, '/');
-					std::getline(vdiss, texCoordIndex, '/');
-					std::getline(vdiss, normalIndex, '/');
-
-					unsigned int posIndex = std::stoi(positionIndex) - 1;
-					unsigned int texIndex = std::stoi(texCoordIndex) - 1;
-					unsigned int normIndex = std::stoi(normalIndex) - 1;
-
-					Vertex vertex;
-					vertex.position = positions[posIndex];
-					vertex.texCoord = texCoords[texIndex];
-					vertex.normal = normals[normIndex];
-
-					vertices.push_back(vertex);
-					indices.push_back(static_cast<unsigned int>(indices.size()));
-				}
-			}
-		}
+	void drawBatched()
+	{
+		if (!GeometryArena::shared().submit(arenaMesh, modelMatrices.data(), modelMatrices.size()))
+			draw();
 	}
-};
 
-class Model
-{
-private:
-	unsigned int VAO;
-	unsigned int VBO;
-	unsigned int EBO;
-	unsigned int vertexCount;
-	unsigned int indexCount;
-	std::vector<glm::mat4> modelMatrices;
-	unsigned int instanceVBO;
-	std::vector<Vertex> vertices;
-	std::vector<unsigned int> indices;
-	int updateCall;
+	unsigned int getInstanceCount()
+	{
+		return instanceCount;
+	}
 
-	bool somethingChanged = false;
-public:
-	Model(const char* objPath, std::vector<glm::mat4>& modelMatrices)
-		: modelMatrices(modelMatrices)
+	const ObjLoadStats& getLoadStats() const
 	{
-		loadObj(objPath);
+		return loadStats;
+	}
 
-		// Create vertex array object
-		glGenVertexArrays(1, &VAO);
-		glBindVertexArray(VAO);
+	const MeshStats& getMeshStats() const
+	{
+		return meshStats;
+	}
 
-		// Create vertex buffer object
-		glGenBuffers(1, &VBO);
-		glBindBuffer(GL_ARRAY_BUFFER, VBO);
-		glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(Vertex), vertices.data(), GL_STATIC_DRAW);
+	VertexFormat getVertexFormat() const
+	{
+		return vertexFormat;
+	}
 
-		// Create element buffer object
-		glGenBuffers(1, &EBO);
-		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
-		glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(unsigned int), indices.data(), GL_STATIC_DRAW);
+	const QuantizationError& getQuantizationError() const
+	{
+		return quantizationError;
+	}
 
-		// Set vertex attribute pointers
-		glEnableVertexAttribArray(0);
-		glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, position));
+	glm::vec3 getBoundsMin() const
+	{
+		return boundsMin;
+	}
 
-		glEnableVertexAttribArray(1);
-		glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, texCoord));
+	glm::vec3 getBoundsMax() const
+	{
+		return boundsMax;
+	}
 
-		glEnableVertexAttribArray(2);
-		glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, normal));
+	void draw()
+	{
+		if (modelMatrices.size() > 0)
+		{
+			instances.flush(modelMatrices);
+			glBindVertexArray(VAO);
+			if (vertexFormat == VertexFormat::Compact)
+				setDequantization(dequantization);
+			glDrawElementsInstanced(GL_TRIANGLES, indexCount, indexType, 0, instanceCount);
+			glBindVertexArray(0);
+		}
+	}
 
-		// Create instance matrix buffer object
-		glGenBuffers(1, &instanceVBO);
-		glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
-		glBufferData(GL_ARRAY_BUFFER, modelMatrices.size() * sizeof(glm::mat4), &modelMatrices[0], GL_DYNAMIC_DRAW);
-		updateCall = 1;
+	// Most instanced draw calls spent on runs of visible meshlets, past that one call draws the whole mesh
+	static const size_t maxInstancedRuns = 8;
 
-		// Set up instance matrix attribute
-		for (unsigned int i = 0; i < 4; ++i)
+	// Draws only the meshlets that some instance shows to the camera. A single instance draws every run of
+	// visible meshlets with one glMultiDrawElements, several instances need a call per run and draw the whole
+	// mesh instead once there are too many. Back face culling relies on the mesh being closed, turn it off
+	// for open geometry.
+	void draw(const glm::mat4& view, const glm::mat4& projection, const glm::vec3& cameraPosition, bool backfaceCulling = true)
+	{
+		if (modelMatrices.size() > 0)
 		{
-			glEnableVertexAttribArray(3 + i);
-			glVertexAttribPointer(3 + i, 4, GL_FLOAT, GL_FALSE, sizeof(glm::mat4), (void*)(sizeof(glm::vec4) * i));
-			glVertexAttribDivisor(3 + i, 1);
+			instances.flush(modelMatrices);
+			meshletCuller.cull(meshlets, modelMatrices.data(), instanceCount, projection * view, cameraPosition, backfaceCulling, meshletRuns, meshletStats);
+
+			size_t indexSize = indexType == GL_UNSIGNED_SHORT ? sizeof(unsigned short) : sizeof(unsigned int);
+			glBindVertexArray(VAO);
+			if (vertexFormat == VertexFormat::Compact)
+				setDequantization(dequantization);
+			if (instanceCount == 1)
+			{
+				// Instance attributes still come from the first matrix without an instanced call
+				runCounts.clear();
+				runOffsets.clear();
+				for (const MeshletRun& run : meshletRuns)
+				{
+					runCounts.push_back(static_cast<GLsizei>(run.indexCount));
+					runOffsets.push_back(reinterpret_cast<const void*>(run.firstIndex * indexSize));
+				}
+				if (!runCounts.empty())
+					glMultiDrawElements(GL_TRIANGLES, runCounts.data(), indexType, runOffsets.data(), static_cast<GLsizei>(runCounts.size()));
+				meshletStats.drawCalls = runCounts.empty() ? 0 : 1;
+			}
+			else if (meshletRuns.size() > maxInstancedRuns)
+			{
+				glDrawElementsInstanced(GL_TRIANGLES, indexCount, indexType, 0, instanceCount);
+				meshletStats.submittedTriangles = indexCount / 3;
+				meshletStats.drawCalls = 1;
+			}
+			else
+			{
+				for (const MeshletRun& run : meshletRuns)
+					glDrawElementsInstanced(GL_TRIANGLES, run.indexCount, indexType, (void*)(run.firstIndex * indexSize), instanceCount);
+				meshletStats.drawCalls = meshletRuns.size();
+			}
+			glBindVertexArray(0);
 		}
+	}
 
-		// Unbind VAO
-		glBindVertexArray(0);
+	const MeshletStats& getMeshletStats() const
+	{
+		return meshletStats;
+	}
 
-		// Store the number of vertices and indices
-		vertexCount = static_cast<int>(vertices.size());
-		indexCount = static_cast<int>(indices.size());
+	// Draws only the instances whose bounding sphere touches the view frustum, tested on the shared thread pool
+	void drawCulled(const glm::mat4& view, const glm::mat4& projection)
+	{
+		instanceCuller.draw(modelMatrices.data(), instanceCount, projection * view, indexCount, indexType, vertexFormat, dequantization);
 	}
 
-	Model(std::string& objData, std::vector<glm::mat4>& modelMatrices)
-		: modelMatrices(modelMatrices)
+	const InstanceCullStats& getCullStats() const
 	{
-		loadObjStr(objData);
+		return instanceCuller.getStats();
+	}
+
+	// Draws every instance at the coarsest level whose error stays under maxPixelError pixels, one call per level in use
+	void drawLod(const glm::mat4& view, const glm::mat4& projection, float maxPixelError = 1.f)
+	{
+		lodRenderer.draw(modelMatrices.data(), instanceCount, view, projection, indexType, vertexFormat, dequantization, maxPixelError);
+	}
+
+	const LodStats& getLodStats() const
+	{
+		return lodRenderer.getStats();
+	}
+
+	size_t getLodCount() const
+	{
+		return lodRenderer.getLevelCount();
+	}
 
+	const MeshLod& getLod(size_t level) const
+	{
+		return lodRenderer.getLevel(level);
+	}
+
+private:
+	void setupMesh(const MeshView& mesh)
+	{
 		// Create vertex array object
 		glGenVertexArrays(1, &VAO);
 		glBindVertexArray(VAO);
@@ -1374,43 +1360,137 @@ public:
 		// Create vertex buffer object
 		glGenBuffers(1, &VBO);
 		glBindBuffer(GL_ARRAY_BUFFER, VBO);
-		glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(Vertex), vertices.data(), GL_STATIC_DRAW);
+		dequantization = uploadVertices(mesh.vertices, mesh.vertexCount, mesh.boundsMin, mesh.boundsMax, vertexFormat, &quantizationError);
+
+		// Split the finest level into meshlets, their triangles are stored contiguously so each one is an index range.
+		// Meshlet order costs vertex cache hits, so it is a second copy after every level in the optimized order.
+		std::vector<MeshLod> lods = getMeshLods(mesh);
+		std::vector<unsigned char> meshletIndices;
+		if (mesh.indexSize == sizeof(unsigned short))
+			meshlets = buildMeshlets<unsigned short>(mesh.vertices, mesh.vertexCount, mesh.indices, lods[0].indexCount, meshletIndices);
+		else
+			meshlets = buildMeshlets<unsigned int>(mesh.vertices, mesh.vertexCount, mesh.indices, lods[0].indexCount, meshletIndices);
+		for (Meshlet& meshlet : meshlets)
+			meshlet.firstIndex += static_cast<unsigned int>(mesh.indexCount);
+		const unsigned char* indexBytes = static_cast<const unsigned char*>(mesh.indices);
+		meshletIndices.insert(meshletIndices.begin(), indexBytes, indexBytes + mesh.indexCount * mesh.indexSize);
 
 		// Create element buffer object
 		glGenBuffers(1, &EBO);
 		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
-		glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(unsigned int), indices.data(), GL_STATIC_DRAW);
+		glBufferData(GL_ELEMENT_ARRAY_BUFFER, meshletIndices.size(), meshletIndices.data(), GL_STATIC_DRAW);
+		indexType = mesh.indexSize == sizeof(unsigned short) ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
 
 		// Set vertex attribute pointers
-		glEnableVertexAttribArray(0);
-		glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, position));
+		setVertexAttributes(vertexFormat);
 
-		glEnableVertexAttribArray(1);
-		glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, texCoord));
-
-		glEnableVertexAttribArray(2);
-		glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, normal));
+		// Set up instance model matrices
+		modelMatrices.resize(instanceCount, glm::mat4(1.0f));
+		handles.reset(instanceCount);
 
 		// Create instance matrix buffer object
-		glGenBuffers(1, &instanceVBO);
-		glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
-		glBufferData(GL_ARRAY_BUFFER, modelMatrices.size() * sizeof(glm::mat4), &modelMatrices[0], GL_DYNAMIC_DRAW);
-		updateCall = 1;
+		instances.create(modelMatrices);
 
 		// Set up instance matrix attribute
-		for (unsigned int i = 0; i < 4; ++i)
-		{
-			glEnableVertexAttribArray(3 + i);
-			glVertexAttribPointer(3 + i, 4, GL_FLOAT, GL_FALSE, sizeof(glm::mat4), (void*)(sizeof(glm::vec4) * i));
-			glVertexAttribDivisor(3 + i, 1);
-		}
+		setInstanceAttributes();
 
 		// Unbind VAO
 		glBindVertexArray(0);
+		lodRenderer.setup(VBO, EBO, vertexFormat, lods, mesh.boundsMin, mesh.boundsMax);
+		instanceCuller.setup(VBO, EBO, vertexFormat, mesh.boundsMin, mesh.boundsMax);
+
+		// Store the number of vertices and indices, draw() always uses the finest level
+		vertexCount = static_cast<int>(mesh.vertexCount);
+		indexCount = static_cast<int>(lods[0].indexCount);
+		boundsMin = mesh.boundsMin;
+		boundsMax = mesh.boundsMax;
+
+		meshStats.vertexCount = mesh.vertexCount;
+		meshStats.indexCount = indexCount;
+		meshStats.indexSize = mesh.indexSize;
+		meshStats.vertexCache = measureVertexCache(mesh);
+		meshletStats = MeshletStats();
+		meshletStats.meshletCount = meshlets.size();
+
+		// The arena only takes the finest level
+		arenaMesh = GeometryArena::shared().addMesh(mesh.vertices, mesh.vertexCount, mesh.indices, mesh.indexSize, lods[0].indexCount);
+	}
+
+	void loadObj(const char* objPath)
+	{
+		loadCachedObj(objPath, vertices, indices, loadStats, [this](const MeshView& mesh) { setupMesh(mesh); });
+	}
 
-		// Store the number of vertices and indices
-		vertexCount = static_cast<int>(vertices.size());
-		indexCount = static_cast<int>(indices.size());
+	void loadObjStr(std::string& objData)
+	{
+		loadCachedObj(objData, vertices, indices, loadStats, [this](const MeshView& mesh) { setupMesh(mesh); });
+	}
+};
+
+class Model
+{
+private:
+	unsigned int VAO;
+	unsigned int VBO;
+	unsigned int EBO;
+	unsigned int vertexCount;
+	unsigned int indexCount;
+	TransformStore transforms;
+	InstanceHandles handles;
+	int arenaMesh = -1;
+	size_t uploadedCount = 0;
+	size_t instanceCapacity = 0;
+	unsigned int instanceVBO;
+	std::vector<Vertex> vertices;
+	std::vector<unsigned int> indices;
+	GLenum indexType;
+	glm::vec3 boundsMin;
+	glm::vec3 boundsMax;
+	ObjLoadStats loadStats;
+	MeshStats meshStats;
+	VertexFormat vertexFormat;
+	InstanceFormat instanceFormat;
+	std::vector<unsigned char> encodedInstances;
+	VertexDequantization dequantization;
+	QuantizationError quantizationError;
+	LodRenderer lodRenderer;
+	InstanceCuller instanceCuller;
+	GpuCuller gpuCuller;
+	InstanceBvh bvh;
+	MortonSorter mortonSorter;
+	unsigned int spatialSortInterval = 0;
+	unsigned int updatesSinceSort = 0;
+	// Instances composed since the last updateBvh()
+	size_t bvhFirst = 0;
+	size_t bvhEnd = 0;
+	size_t bvhMoved = 0;
+	InstanceRing instanceRing;
+	bool streaming = false;
+	size_t streamedCount = 0;
+	int updateCall;
+public:
+	Model(const char* objPath, std::vector<glm::mat4>& modelMatrices, VertexFormat format = VertexFormat::Full, InstanceFormat instanceEncoding = InstanceFormat::Matrix)
+		: vertexFormat(format), instanceFormat(instanceEncoding)
+	{
+		setTransforms(modelMatrices);
+		loadObj(objPath);
+	}
+
+	Model(std::string& objData, std::vector<glm::mat4>& modelMatrices, VertexFormat format = VertexFormat::Full, InstanceFormat instanceEncoding = InstanceFormat::Matrix)
+		: vertexFormat(format), instanceFormat(instanceEncoding)
+	{
+		setTransforms(modelMatrices);
+		loadObjStr(objData);
+	}
+
+	// From the <name>_vertices, _indices and _lods arrays baked by ObjBake, uploaded without any parsing
+	template<typename Index, size_t FloatCount, size_t IndexCount, size_t LodCount>
+	Model(const float (&vertexData)[FloatCount], const Index (&indexData)[IndexCount], const MeshLod (&lodData)[LodCount],
+		std::vector<glm::mat4>& modelMatrices, VertexFormat format = VertexFormat::Full, InstanceFormat instanceEncoding = InstanceFormat::Matrix)
+		: vertexFormat(format), instanceFormat(instanceEncoding)
+	{
+		setTransforms(modelMatrices);
+		setupMesh(makeBakedMeshView(vertexData, FloatCount, indexData, IndexCount, lodData, LodCount));
 	}
 
 	~Model()
@@ -1420,30 +1500,122 @@ public:
 		glDeleteBuffers(1, &EBO);
 	}
 
+	// Composes the matrices of changed instances and uploads the range they span
 	void updateMatrices(bool force = false)
 	{
-		if(!force)
-			if (!somethingChanged) return;
-		somethingChanged = false;
+		if (streaming)
+			return;
+		if (spatialSortInterval > 0 && ++updatesSinceSort >= spatialSortInterval)
+		{
+			updatesSinceSort = 0;
+			sortInstances();
+		}
+		if (force)
+			transforms.markAllDirty();
+		// Removing the last instance dirties nothing but still has to shrink the draw
+		if (!transforms.isDirty() && uploadedCount == transforms.size())
+			return;
+
+		ComposeRange range = composeTransforms();
 
 		updateCall++;
 		glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
-		glBufferData(GL_ARRAY_BUFFER, modelMatrices.size() * sizeof(glm::mat4), &modelMatrices[0], GL_STATIC_DRAW);
+		uploadedCount = transforms.size();
+		if (uploadedCount > instanceCapacity)
+		{
+			// Doubling keeps a stream of add() calls at amortized constant upload cost
+			instanceCapacity = glm::max(uploadedCount, instanceCapacity * 2);
+			glBufferData(GL_ARRAY_BUFFER, instanceCapacity * instanceStride(instanceFormat), nullptr, GL_DYNAMIC_DRAW);
+			uploadInstances(0, uploadedCount);
+			InstanceBuffer::recordUpload(uploadedCount * instanceStride(instanceFormat), true);
+		}
+		else if (range.first < range.end)
+		{
+			uploadInstances(range.first, range.end);
+			InstanceBuffer::recordUpload((range.end - range.first) * instanceStride(instanceFormat), false);
+		}
 		glBindBuffer(GL_ARRAY_BUFFER, 0);
 	}
 
 	int getMatricesSize()
 	{
-		return static_cast<int>(modelMatrices.size());
+		return static_cast<int>(transforms.size());
 	}
 
-	void add(const glm::vec3& position = glm::vec3(0.f), const glm::vec3& scale = glm::vec3(0.f))
+	// Replaces every instance, matrices that are not translation * rotation * scale are kept exactly
+	void setTransforms(const std::vector<glm::mat4>& matrices)
 	{
-		glm::mat4 model = glm::translate(glm::mat4(1.f), position);
-		model = glm::scale(model, scale);
+		transforms.clear();
+		transforms.reserve(matrices.size());
+		for (const glm::mat4& matrix : matrices)
+			transforms.add(matrix);
+		handles.reset(matrices.size());
+	}
 
-		modelMatrices.push_back(model);
+	InstanceHandle add(const glm::vec3& position = glm::vec3(0.f), const glm::vec3& scale = glm::vec3(0.f))
+	{
+		transforms.add(position, glm::quat(1.f, 0.f, 0.f, 0.f), scale);
 		updateMatrices();
+		return handles.create();
+	}
+
+	// Overwrites the given components of every id, null arrays leave that component alone. The batch is
+	// checked once up front and the next updateMatrices() uploads the span from the lowest to the highest id.
+	void setTransforms(const uint32_t* ids, size_t count, const glm::vec3* positions, const glm::quat* rotations = nullptr, const glm::vec3* scales = nullptr)
+	{
+		if (count == 0 || !validInstanceIds(ids, count, transforms.size(), "setTransforms"))
+			return;
+		transforms.setMany(ids, count, positions, rotations, scales);
+	}
+
+	// Appends count instances and uploads them in one go, null rotations or scales mean identity and unit scale.
+	// Their handles follow each other, getHandle(getMatricesSize() - count + i) names the i-th one.
+	void addMany(const glm::vec3* positions, size_t count, const glm::quat* rotations = nullptr, const glm::vec3* scales = nullptr)
+	{
+		if (count == 0)
+			return;
+		transforms.reserve(transforms.size() + count);
+		handles.reserve(transforms.size() + count);
+		transforms.addMany(positions, rotations, scales, count);
+		for (size_t i = 0; i < count; ++i)
+			handles.create();
+		updateMatrices();
+	}
+
+	// Removes every id with swap and pop, highest first so the ids still to go never move. Duplicates are ignored.
+	void removeMany(const uint32_t* ids, size_t count)
+	{
+		if (count == 0 || !validInstanceIds(ids, count, transforms.size(), "removeMany"))
+			return;
+		std::vector<uint32_t> sorted = sortedInstanceIds(ids, count);
+		for (size_t i = sorted.size(); i-- > 0;)
+			handles.removeSlot(sorted[i]);
+		transforms.removeMany(sorted);
+		updateMatrices();
+	}
+
+	// How draw() sends the instances, draw with a shader from instanceVertexShader() for the same format.
+	// drawLod() and streaming always send full matrices and need the plain mat4 shader.
+	void setInstanceFormat(InstanceFormat format)
+	{
+		if (instanceFormat == format)
+			return;
+		instanceFormat = format;
+		// The stride changed, the next update reallocates and sends every instance
+		instanceCapacity = 0;
+		if (streaming)
+			return;
+
+		glBindVertexArray(VAO);
+		glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
+		setInstanceAttributes(instanceFormat);
+		glBindVertexArray(0);
+		updateMatrices(true);
+	}
+
+	InstanceFormat getInstanceFormat() const
+	{
+		return instanceFormat;
 	}
 
 	int updateCallAmount()
@@ -1451,50 +1623,268 @@ public:
 		return updateCall;
 	}
 
-	void add(glm::mat4& model)
+	const ObjLoadStats& getLoadStats() const
 	{
-		modelMatrices.push_back(model);
+		return loadStats;
+	}
+
+	const MeshStats& getMeshStats() const
+	{
+		return meshStats;
+	}
+
+	VertexFormat getVertexFormat() const
+	{
+		return vertexFormat;
+	}
+
+	const QuantizationError& getQuantizationError() const
+	{
+		return quantizationError;
+	}
+
+	glm::vec3 getBoundsMin() const
+	{
+		return boundsMin;
+	}
+
+	glm::vec3 getBoundsMax() const
+	{
+		return boundsMax;
+	}
+
+	InstanceHandle add(glm::mat4& model)
+	{
+		transforms.add(model);
 		updateMatrices();
+		return handles.create();
 	}
 
+	// The last instance moves into index, so only that slot is uploaded again
 	void remove(int index)
 	{
-		if (index >= 0 && index < modelMatrices.size())
+		if (!validIndex(index))
+			return;
+		handles.removeSlot(index);
+		transforms.remove(index);
+		updateMatrices();
+	}
+
+	void remove(InstanceHandle handle)
+	{
+		if (!handles.valid(handle))
 		{
-			modelMatrices.erase(modelMatrices.begin() + index);
+			std::cerr << "Invalid instance handle: " << handle.id << std::endl;
+			return;
 		}
-		somethingChanged = true;
+		remove(static_cast<int>(handles.slot(handle)));
+	}
+
+	// Index the handle's instance currently lives at, -1 once it was removed
+	int getIndex(InstanceHandle handle) const
+	{
+		return handles.valid(handle) ? static_cast<int>(handles.slot(handle)) : -1;
+	}
+
+	InstanceHandle getHandle(int index) const
+	{
+		return validIndex(index) ? handles.handle(index) : InstanceHandle();
+	}
+
+	// Sorts the instances by the Morton code of their position so neighbours in space are neighbours in the
+	// instance buffer. Indices change, handles keep resolving. Returns whether anything moved.
+	bool sortInstances()
+	{
+		if (!mortonSorter.sort(transforms))
+			return false;
+		transforms.permute(mortonSorter.getOrder().data());
+		handles.permute(mortonSorter.getOrder().data());
+		return true;
+	}
+
+	// Calls sortInstances() every interval updateMatrices() calls, 0 turns it off. Cheap once sorted,
+	// only instances that moved to another Morton cell are sorted again.
+	void setSpatialSortInterval(unsigned int interval)
+	{
+		spatialSortInterval = interval;
+		updatesSinceSort = 0;
+	}
+
+	const MortonSortStats& getSpatialSortStats() const
+	{
+		return mortonSorter.getStats();
 	}
 
 	void draw()
 	{
-		if (modelMatrices.size() > 0)
+		if (streaming)
+		{
+			drawStreamed();
+			return;
+		}
+
+		if (uploadedCount > 0)
 		{
 			glBindVertexArray(VAO);
-			glDrawElementsInstanced(GL_TRIANGLES, indexCount, GL_UNSIGNED_INT, 0, static_cast<GLsizei>(modelMatrices.size()));
+			if (vertexFormat == VertexFormat::Compact)
+				setDequantization(dequantization);
+			glDrawElementsInstanced(GL_TRIANGLES, indexCount, indexType, 0, static_cast<GLsizei>(uploadedCount));
 			glBindVertexArray(0);
 		}
 	}
 
-	glm::mat4* operator[](int i)
+	void drawBatched()
 	{
-		if (modelMatrices.size() > 0)
-			return &modelMatrices[i];
+		// Keeps the instance buffer in step, composing alone would consume the dirty range it uploads
+		updateMatrices();
+		composeTransforms();
+		if (!GeometryArena::shared().submit(arenaMesh, transforms.getMatrices().data(), transforms.size()))
+			draw();
+	}
+
+	// Streams the instance matrices through a triple buffered ring every frame instead of reallocating
+	// the instance buffer whenever something changed, for scenes where most instances move every frame
+	void setStreaming(bool enabled)
+	{
+		if (streaming == enabled)
+			return;
+		streaming = enabled;
+		streamedCount = 0;
+		if (streaming)
+		{
+			instanceRing.attributesChanged();
+			return;
+		}
+
+		// Point the instance attributes back at the regular buffer and bring it up to date
+		glBindVertexArray(VAO);
+		glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
+		setInstanceAttributes(instanceFormat);
+		glBindVertexArray(0);
+		updateMatrices(true);
+	}
+
+	bool isStreaming() const
+	{
+		return streaming;
+	}
+
+	const InstanceRingStats& getStreamingStats() const
+	{
+		return instanceRing.getStats();
+	}
+
+	// Streaming only: this frame's ring segment to write count matrices into directly, the next draw()
+	// uses them instead of the composed transforms
+	glm::mat4* writeInstances(size_t count)
+	{
+		if (!streaming)
+		{
+			std::cerr << "writeInstances needs streaming enabled" << std::endl;
+			return nullptr;
+		}
+		glm::mat4* data = count > 0 ? instanceRing.map(count) : nullptr;
+		streamedCount = data ? count : 0;
+		return data;
+	}
+
+	// Draws only the instances whose bounding sphere touches the view frustum, tested on the shared thread pool
+	void drawCulled(const glm::mat4& view, const glm::mat4& projection)
+	{
+		// Keeps the instance buffer in step, composing alone would consume the dirty range it uploads
+		updateMatrices();
+		composeTransforms();
+		instanceCuller.draw(transforms.getMatrices().data(), transforms.size(), projection * view, indexCount, indexType, vertexFormat, dequantization);
+	}
+
+	const InstanceCullStats& getCullStats() const
+	{
+		return instanceCuller.getStats();
+	}
+
+	// Culls the instance buffer on the GPU with transform feedback and draws the survivors as full matrices, so draw
+	// with the plain mat4 shader whatever the instance format. Streaming has no persistent buffer to cull and draws everything.
+	void drawGpuCulled(const glm::mat4& view, const glm::mat4& projection)
+	{
+		if (streaming)
+		{
+			drawStreamed();
+			return;
+		}
+		updateMatrices();
+		gpuCuller.draw(instanceVBO, instanceFormat, uploadedCount, projection * view, indexCount, indexType, vertexFormat, dequantization);
+	}
+
+	const GpuCullStats& getGpuCullStats() const
+	{
+		return gpuCuller.getStats();
+	}
+
+	// Brings the instance BVH in step with the transforms and returns it for queries, which name instances by
+	// index like getIndex(). Refits what moved since the last call, rebuilds on the shared thread pool when
+	// most of it did or instances were added or removed.
+	const InstanceBvh& updateBvh()
+	{
+		updateMatrices();
+		composeTransforms();
+		bvh.update(transforms.getMatrices().data(), transforms.size(), bvhFirst, bvhEnd, bvhMoved);
+		bvhFirst = bvhEnd = bvhMoved = 0;
+		return bvh;
+	}
+
+	// Draws every instance at the coarsest level whose error stays under maxPixelError pixels, one call per level in use
+	void drawLod(const glm::mat4& view, const glm::mat4& projection, float maxPixelError = 1.f)
+	{
+		updateMatrices();
+		composeTransforms();
+		lodRenderer.draw(transforms.getMatrices().data(), transforms.size(), view, projection, indexType, vertexFormat, dequantization, maxPixelError);
+	}
+
+	const LodStats& getLodStats() const
+	{
+		return lodRenderer.getStats();
+	}
+
+	size_t getLodCount() const
+	{
+		return lodRenderer.getLevelCount();
+	}
+
+	const MeshLod& getLod(size_t level) const
+	{
+		return lodRenderer.getLevel(level);
+	}
+
+	// Matrix as of the last updateMatrices() or draw, change instances through the setters
+	const glm::mat4* operator[](int i) const
+	{
+		if (validIndex(i))
+			return &transforms.getMatrix(i);
 		else
 			return nullptr;
 	}
 
 	bool validIndex(int index) const
 	{
-		if (index >= 0 && index < modelMatrices.size())
+		if (index >= 0 && static_cast<size_t>(index) < transforms.size())
 			return true;
 		return false;
 	}
 
+	const TransformStore& getTransforms() const
+	{
+		return transforms;
+	}
+
+	void setComposer(TransformComposer composer)
+	{
+		transforms.setComposer(composer);
+	}
+
 	glm::vec3 getPosition(int i)
 	{
 		if (validIndex(i))
-			return getPositionFromModelMatrix(modelMatrices[i]);
+			return transforms.getPosition(i);
 		return { 0.f, 0.f, 0.f };
 	}
 
@@ -1502,45 +1892,22 @@ public:
 	{
 		if (!validIndex(i))
 			return { 0.f, 0.f, 0.f };
-		glm::vec3 scale;
-		glm::vec3 position = modelMatrices[i][3]; // 4th column of the model matrix
-		glm::mat4 model = modelMatrices[i];
+		return transforms.getScale(i);
+	}
 
-		scale.x = glm::length(glm::vec3(model[0])); // Basis vector X
-		scale.y = glm::length(glm::vec3(model[1])); // Basis vector Y
-		scale.z = glm::length(glm::vec3(model[2])); // Basis vector Z
-		return scale;
+	glm::quat getOrientation(int i) const
+	{
+		if (!validIndex(i))
+			return glm::quat(1.f, 0.f, 0.f, 0.f);
+		return transforms.getRotation(i);
 	}
 
+	// Euler angles in degrees, x then y then z
 	glm::vec3 getRotation(int i) const
 	{
 		if (!validIndex(i))
 			return { 0.f, 0.f, 0.f };
-
-		const glm::vec3 left = glm::normalize(glm::vec3(modelMatrices[i][0])); // Normalized left axis
-		const glm::vec3 up = glm::normalize(glm::vec3(modelMatrices[i][1])); // Normalized up axis
-		const glm::vec3 forward = glm::normalize(glm::vec3(modelMatrices[i][2])); // Normalized forward axis
-
-		// Obtain the "unscaled" transform matrix
-		glm::mat4 m(0.0f);
-		m[0][0] = left.x;
-		m[0][1] = left.y;
-		m[0][2] = left.z;
-
-		m[1][0] = up.x;
-		m[1][1] = up.y;
-		m[1][2] = up.z;
-
-		m[2][0] = forward.x;
-		m[2][1] = forward.y;
-		m[2][2] = forward.z;
-
-		glm::vec3 rot;
-		rot.x = atan2f(m[1][2], m[2][2]);
-		rot.y = atan2f(-m[0][2], sqrtf(m[1][2] * m[1][2] + m[2][2] * m[2][2]));
-		rot.z = atan2f(m[0][1], m[0][0]);
-		rot = glm::degrees(rot); // Convert to degrees, or you could multiply it by (180.f / 3.14159265358979323846f)
-		return rot;
+		return glm::degrees(glm::eulerAngles(transforms.getRotation(i)));
 	}
 
 	void setPosition(unsigned int index, const glm::vec3& position)
@@ -1550,35 +1917,32 @@ public:
 			std::cerr << "Position Invalid index: " << index << std::endl;
 			return;
 		}
-		if (modelMatrices[index] == glm::translate(glm::mat4(1.0f), position))
+		if (transforms.getPosition(index) == position)
 			return;
 
-		somethingChanged = true;
-		modelMatrices[index] = glm::translate(glm::mat4(1.0f), position);
+		transforms.setPosition(index, position);
 	}
 
+	// getMatrix() may predate edits not composed yet, so the matrix is always written
 	void changeTransform(int i, const glm::mat4& model)
 	{
-		if (modelMatrices[i] == model || !validIndex(i))
+		if (!validIndex(i))
 			return;
-		somethingChanged = true;
-		modelMatrices[i] = model;
+		transforms.setMatrix(i, model);
 	}
 
+	// translate * scale * rotate, with a non-uniform scale that is a sheared matrix and is kept exactly
 	void changeTransform(int i, const glm::vec3& position, const glm::vec3& rotation, const float rotAngle, const glm::vec3& scale)
 	{
 		if (!validIndex(i))
 			return;
-		if (modelMatrices[i] == glm::translate(glm::mat4(1.f), position) &&
-			modelMatrices[i] == glm::scale(modelMatrices[i], glm::vec3(scale)) &&
-			modelMatrices[i] == glm::rotate(modelMatrices[i], glm::radians(rotAngle), rotation))
-			return;
-		somethingChanged = true;
-		modelMatrices[i] = glm::translate(glm::mat4(1.f), position);
-		modelMatrices[i] = glm::scale(modelMatrices[i], glm::vec3(scale));
-		modelMatrices[i] = glm::rotate(modelMatrices[i], glm::radians(rotAngle), rotation);
+		glm::mat4 model = glm::translate(glm::mat4(1.f), position);
+		model = glm::scale(model, scale);
+		model = glm::rotate(model, glm::radians(rotAngle), rotation);
+		transforms.setMatrix(i, model);
 	}
 
+	// Rotates further about the local x, then y, then z axis
 	void setRotation(unsigned int index, const glm::vec3& rotationAngle)
 	{
 		if (!validIndex(index))
@@ -1586,17 +1950,17 @@ public:
 			std::cerr << "Rotate Invalid index: " << index << std::endl;
 			return;
 		}
-		if (modelMatrices[index] == glm::rotate(modelMatrices[index], glm::radians(rotationAngle.x), glm::vec3(1.0f, 0.0f, 0.0f)) &&
-			modelMatrices[index] == glm::rotate(modelMatrices[index], glm::radians(rotationAngle.y), glm::vec3(1.0f, 0.0f, 0.0f)) && 
-			modelMatrices[index] == glm::rotate(modelMatrices[index], glm::radians(rotationAngle.z), glm::vec3(1.0f, 0.0f, 0.0f)))
+		if (rotationAngle == glm::vec3(0.f))
 			return;
 
-		somethingChanged = true;
-		modelMatrices[index] = glm::rotate(modelMatrices[index], glm::radians(rotationAngle.x), glm::vec3(1.0f, 0.0f, 0.0f));
-		modelMatrices[index] = glm::rotate(modelMatrices[index], glm::radians(rotationAngle.y), glm::vec3(0.0f, 1.0f, 0.0f));
-		modelMatrices[index] = glm::rotate(modelMatrices[index], glm::radians(rotationAngle.z), glm::vec3(0.0f, 0.0f, 1.0f));
+		glm::quat rotation = transforms.getRotation(index) *
+			glm::angleAxis(glm::radians(rotationAngle.x), glm::vec3(1.0f, 0.0f, 0.0f)) *
+			glm::angleAxis(glm::radians(rotationAngle.y), glm::vec3(0.0f, 1.0f, 0.0f)) *
+			glm::angleAxis(glm::radians(rotationAngle.z), glm::vec3(0.0f, 0.0f, 1.0f));
+		transforms.setRotation(index, glm::normalize(rotation));
 	}
 
+	// Rotates further by rotAngle degrees about a local axis
 	void setRotation(unsigned int index, const float rotAngle, const glm::vec3& rotationAxis)
 	{
 		if (!validIndex(index))
@@ -1604,13 +1968,13 @@ public:
 			std::cerr << "Rotate Invalid index: " << index << std::endl;
 			return;
 		}
-		if (modelMatrices[index] == glm::rotate(modelMatrices[index], glm::radians(rotAngle), rotationAxis))
+		if (rotAngle == 0.f)
 			return;
 
-		somethingChanged = true;
-		modelMatrices[index] == glm::rotate(modelMatrices[index], rotAngle, rotationAxis);
+		transforms.setRotation(index, glm::normalize(transforms.getRotation(index) * glm::angleAxis(glm::radians(rotAngle), glm::normalize(rotationAxis))));
 	}
 
+	// Multiplies the current scale
 	void setScale(unsigned int index, const glm::vec3& scale)
 	{
 		if (!validIndex(index))
@@ -1618,154 +1982,131 @@ public:
 			std::cerr << "Scale Invalid index: " << index << std::endl;
 			return;
 		}
-		if (modelMatrices[index] == glm::scale(modelMatrices[index], scale))
+		if (scale == glm::vec3(1.f))
 			return;
 
-		somethingChanged = true;
-		modelMatrices[index] = glm::scale(modelMatrices[index], scale);
+		transforms.setScale(index, transforms.getScale(index) * scale);
 	}
 
 	void setScale(unsigned int index, const float& scale)
 	{
-		if (!validIndex(index))
-		{
-			std::cerr << "Scale Invalid index: " << index << std::endl;
-			return;
-		}
-		if (modelMatrices[index] == glm::scale(modelMatrices[index], glm::vec3(scale)))
-			return;
-
-		somethingChanged = true;
-		modelMatrices[index] = glm::scale(modelMatrices[index], glm::vec3(scale));
+		setScale(index, glm::vec3(scale));
 	}
 
 private:
-	void loadObj(const char* objPath)
+	// Sends composed instances first to end to the bound instance buffer in the instance format
+	void uploadInstances(size_t first, size_t end)
 	{
-		std::ifstream file(objPath);
-		std::string line;
-
-		std::vector<glm::vec3> positions;
-		std::vector<glm::vec2> texCoords;
-		std::vector<glm::vec3> normals;
+		if (first >= end)
+			return;
+		size_t stride = instanceStride(instanceFormat);
+		const void* data = &transforms.getMatrix(first);
+		if (instanceFormat != InstanceFormat::Matrix)
+		{
+			encodeInstances(transforms, first, end, instanceFormat, encodedInstances);
+			data = encodedInstances.data();
+		}
+		glBufferSubData(GL_ARRAY_BUFFER, first * stride, (end - first) * stride, data);
+	}
 
-		while (std::getline(file, line))
+	// compose() that also widens the range the next updateBvh() refits
+	ComposeRange composeTransforms()
+	{
+		ComposeRange range = transforms.compose();
+		if (range.first < range.end)
 		{
-			std::istringstream iss(line);
-			std::string type;
-			iss >> type;
+			bvhFirst = bvhFirst < bvhEnd ? glm::min(bvhFirst, range.first) : range.first;
+			bvhEnd = glm::max(bvhEnd, range.end);
+			bvhMoved += range.composed;
+		}
+		return range;
+	}
 
-			if (type == "v")
-			{
-				glm::vec3 position;
-				iss >> position.x >> position.y >> position.z;
-				positions.push_back(position);
-			}
-			else if (type == "vt")
-			{
-				glm::vec2 texCoord;
-				iss >> texCoord.x >> texCoord.y;
-				texCoords.push_back(texCoord);
-			}
-			else if (type == "vn")
-			{
-				glm::vec3 normal;
-				iss >> normal.x >> normal.y >> normal.z;
-				normals.push_back(normal);
-			}
-			else if (type == "f")
-			{
-				for (int i = 0; i < 3; ++i)
-				{
-					std::string vertexData;
-					iss >> vertexData;
-					std::istringstream vdiss(vertexData);
-
-					std::string positionIndex, texCoordIndex, normalIndex;
-					std::getline(vdiss, positionIndex, '/');
-					std::getline(vdiss, texCoordIndex, '/');
-					std::getline(vdiss, normalIndex, '/');
-
-					unsigned int posIndex = std::stoi(positionIndex) - 1;
-					unsigned int texIndex = std::stoi(texCoordIndex) - 1;
-					unsigned int normIndex = std::stoi(normalIndex) - 1;
-
-					Vertex vertex;
-					vertex.position = positions[posIndex];
-					vertex.texCoord = texCoords[texIndex];
-					vertex.normal = normals[normIndex];
-
-					vertices.push_back(vertex);
-					indices.push_back(static_cast<unsigned int>(indices.size()));
-				}
-			}
+	void drawStreamed()
+	{
+		size_t count = streamedCount;
+		if (count == 0)
+		{
+			composeTransforms();
+			glm::mat4* data = transforms.size() == 0 ? nullptr : instanceRing.map(transforms.size());
+			if (!data)
+				return;
+			std::copy(transforms.getMatrices().begin(), transforms.getMatrices().begin() + transforms.size(), data);
+			count = transforms.size();
 		}
+		instanceRing.unmap();
+		streamedCount = 0;
+
+		glBindVertexArray(VAO);
+		if (vertexFormat == VertexFormat::Compact)
+			setDequantization(dequantization);
+		instanceRing.drawElements(GL_TRIANGLES, indexCount, indexType, 0, static_cast<GLsizei>(count));
+		glBindVertexArray(0);
+		instanceRing.fence();
 	}
 
-	void loadObjStr(std::string& objData)
+	void setupMesh(const MeshView& mesh)
 	{
-		std::istringstream file(objData);
-		std::string line;
+		// Create vertex array object
+		glGenVertexArrays(1, &VAO);
+		glBindVertexArray(VAO);
 
-		std::vector<glm::vec3> positions;
-		std::vector<glm::vec2> texCoords;
-		std::vector<glm::vec3> normals;
+		// Create vertex buffer object
+		glGenBuffers(1, &VBO);
+		glBindBuffer(GL_ARRAY_BUFFER, VBO);
+		dequantization = uploadVertices(mesh.vertices, mesh.vertexCount, mesh.boundsMin, mesh.boundsMax, vertexFormat, &quantizationError);
 
-		while (std::getline(file, line))
-		{
-			std::istringstream iss(line);
-			std::string type;
-			iss >> type;
+		// Create element buffer object, every level of detail shares it
+		std::vector<MeshLod> lods = getMeshLods(mesh);
+		glGenBuffers(1, &EBO);
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
+		glBufferData(GL_ELEMENT_ARRAY_BUFFER, mesh.indexCount * mesh.indexSize, mesh.indices, GL_STATIC_DRAW);
+		indexType = mesh.indexSize == sizeof(unsigned short) ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
 
-			if (type == "v")
-			{
-				glm::vec3 position;
-				iss >> position.x >> position.y >> position.z;
-				positions.push_back(position);
-			}
-			else if (type == "vt")
-			{
-				glm::vec2 texCoord;
-				iss >> texCoord.x >> texCoord.y;
-				texCoords.push_back(texCoord);
-			}
-			else if (type == "vn")
-			{
-				glm::vec3 normal;
-				iss >> normal.x >> normal.y >> normal.z;
-				normals.push_back(normal);
-			}
-			else if (type == "f")
-			{
-				for (int i = 0; i < 3; ++i)
-				{
-					std::string vertexData;
-					iss >> vertexData;
-					std::istringstream vdiss(vertexData);
-
-					std::string positionIndex, texCoordIndex, normalIndex;
-					std::getline(vdiss, positionIndex, '/');
-					std::getline(vdiss, texCoordIndex, '/');
-					std::getline(vdiss, normalIndex, '/');
-
-					unsigned int posIndex = std::stoi(positionIndex) - 1;
-					unsigned int texIndex = std::stoi(texCoordIndex) - 1;
-					unsigned int normIndex = std::stoi(normalIndex) - 1;
-
-					Vertex vertex;
-					vertex.position = positions[posIndex];
-					vertex.texCoord = texCoords[texIndex];
-					vertex.normal = normals[normIndex];
-
-					vertices.push_back(vertex);
-					indices.push_back(static_cast<unsigned int>(indices.size()));
-				}
-			}
-		}
+		// Set vertex attribute pointers
+		setVertexAttributes(vertexFormat);
+
+		// Create instance matrix buffer object
+		composeTransforms();
+		uploadedCount = transforms.size();
+		instanceCapacity = uploadedCount;
+		glGenBuffers(1, &instanceVBO);
+		glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
+		glBufferData(GL_ARRAY_BUFFER, instanceCapacity * instanceStride(instanceFormat), nullptr, GL_DYNAMIC_DRAW);
+		uploadInstances(0, uploadedCount);
+		updateCall = 1;
+
+		// Set up instance transform attributes
+		setInstanceAttributes(instanceFormat);
+
+		// Unbind VAO
+		glBindVertexArray(0);
+		lodRenderer.setup(VBO, EBO, vertexFormat, lods, mesh.boundsMin, mesh.boundsMax);
+		instanceCuller.setup(VBO, EBO, vertexFormat, mesh.boundsMin, mesh.boundsMax);
+		gpuCuller.setup(VBO, EBO, vertexFormat, mesh.boundsMin, mesh.boundsMax);
+		bvh.setBounds(mesh.boundsMin, mesh.boundsMax);
+
+		// Store the number of vertices and indices, draw() always uses the finest level
+		vertexCount = static_cast<int>(mesh.vertexCount);
+		indexCount = static_cast<int>(lods[0].indexCount);
+		boundsMin = mesh.boundsMin;
+		boundsMax = mesh.boundsMax;
+
+		meshStats.vertexCount = mesh.vertexCount;
+		meshStats.indexCount = indexCount;
+		meshStats.indexSize = mesh.indexSize;
+		meshStats.vertexCache = measureVertexCache(mesh);
+
+		arenaMesh = GeometryArena::shared().addMesh(mesh.vertices, mesh.vertexCount, mesh.indices, mesh.indexSize, lods[0].indexCount);
+	}
+
+	void loadObj(const char* objPath)
+	{
+		loadCachedObj(objPath, vertices, indices, loadStats, [this](const MeshView& mesh) { setupMesh(mesh); });
 	}
 
-	glm::vec3 getPositionFromModelMatrix(const glm::mat4& modelMatrix) const
+	void loadObjStr(std::string& objData)
 	{
-		return glm::vec3(modelMatrix[3][0], modelMatrix[3][1], modelMatrix[3][2]);
+		loadCachedObj(objData, vertices, indices, loadStats, [this](const MeshView& mesh) { setupMesh(mesh); });
 	}
 };
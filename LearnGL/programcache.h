@@ -0,0 +1,231 @@
+#pragma once
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "hash.h"
+
+// On-disk layout: header, then binarySize bytes of glGetProgramBinary output
+struct ProgramCacheHeader
+{
+	char magic[4];
+	uint32_t version;
+	uint64_t key;
+	uint32_t format;
+	uint32_t binarySize;
+	double compileSeconds;		// what the program took to build from source, a hit saves that minus its load time
+};
+
+struct ProgramCacheStats
+{
+	size_t hits = 0;
+	size_t misses = 0;
+	size_t rejected = 0;		// binaries the driver refused, counted as misses too
+	double loadSeconds = 0.0;
+	double compileSeconds = 0.0;
+	double savedSeconds = 0.0;
+};
+
+// Linked program binaries on disk, named after a hash of the shader sources and the GL vendor, renderer and
+// version strings, so a driver update or another GPU misses instead of loading a foreign binary. Shader
+// tries load() before compiling and store()s what it had to build. A binary the driver rejects is deleted
+// and the caller compiles as if there had been no cache. Needs GL 4.1 or GL_ARB_get_program_binary.
+class ProgramCache
+{
+public:
+	static const uint32_t version = 1;
+
+private:
+	bool enabled;
+	ProgramCacheStats stats;
+
+public:
+	ProgramCache()
+		: enabled(true)
+	{
+	}
+
+	static ProgramCache& shared()
+	{
+		static ProgramCache cache;
+		return cache;
+	}
+
+	static bool supported()
+	{
+		if (!glad_glProgramBinary && glfwExtensionSupported("GL_ARB_get_program_binary"))
+		{
+			glad_glGetProgramBinary = reinterpret_cast<PFNGLGETPROGRAMBINARYPROC>(glfwGetProcAddress("glGetProgramBinary"));
+			glad_glProgramBinary = reinterpret_cast<PFNGLPROGRAMBINARYPROC>(glfwGetProcAddress("glProgramBinary"));
+			glad_glProgramParameteri = reinterpret_cast<PFNGLPROGRAMPARAMETERIPROC>(glfwGetProcAddress("glProgramParameteri"));
+		}
+		if (!glad_glGetProgramBinary || !glad_glProgramBinary || !glad_glProgramParameteri)
+			return false;
+		// Some drivers expose the entry points but no format to store
+		GLint formats = 0;
+		glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+		return formats > 0;
+	}
+
+	bool isEnabled() const
+	{
+		return enabled && supported();
+	}
+
+	void setEnabled(bool enable)
+	{
+		enabled = enable;
+	}
+
+	const ProgramCacheStats& getStats() const
+	{
+		return stats;
+	}
+
+	// Sources in stage order, plus anything else that changes the program such as injected defines
+	static uint64_t key(const std::vector<std::string>& parts)
+	{
+		std::string text;
+		for (GLenum name : { GL_VENDOR, GL_RENDERER, GL_VERSION })
+		{
+			const GLubyte* value = glGetString(name);
+			text += value ? reinterpret_cast<const char*>(value) : "";
+			text += '\n';
+		}
+		for (const std::string& part : parts)
+		{
+			// Lengths keep "ab" + "c" apart from "a" + "bc"
+			text += std::to_string(part.size());
+			text += ':';
+			text += part;
+		}
+		return hashBytes(text.data(), text.size());
+	}
+
+	static std::string pathFor(uint64_t key)
+	{
+		char name[64];
+		std::snprintf(name, sizeof(name), "cache/%016llx.programcache", static_cast<unsigned long long>(key));
+		return name;
+	}
+
+	// Linked program for key, 0 on a miss
+	unsigned int load(uint64_t key)
+	{
+		if (!isEnabled())
+			return 0;
+		auto start = std::chrono::steady_clock::now();
+		std::string path = pathFor(key);
+
+		ProgramCacheHeader header = {};
+		std::vector<char> binary;
+		FILE* file = std::fopen(path.c_str(), "rb");
+		if (file)
+		{
+			bool valid = std::fread(&header, sizeof(header), 1, file) == 1 && std::memcmp(header.magic, "LGLP", 4) == 0 &&
+				header.version == version && header.key == key;
+			if (valid)
+			{
+				binary.resize(header.binarySize);
+				valid = std::fread(binary.data(), 1, binary.size(), file) == binary.size();
+			}
+			std::fclose(file);
+			if (!valid)
+				binary.clear();
+		}
+		if (binary.empty())
+		{
+			++stats.misses;
+			return 0;
+		}
+
+		unsigned int program = glCreateProgram();
+		glProgramBinary(program, header.format, binary.data(), static_cast<GLsizei>(binary.size()));
+		GLint success = 0;
+		glGetProgramiv(program, GL_LINK_STATUS, &success);
+		if (!success)
+		{
+			glDeleteProgram(program);
+			std::error_code error;
+			std::filesystem::remove(path, error);
+			++stats.rejected;
+			++stats.misses;
+			std::cerr << "Program cache: driver rejected " << path << ", compiling" << std::endl;
+			return 0;
+		}
+
+		double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		++stats.hits;
+		stats.loadSeconds += seconds;
+		stats.savedSeconds += header.compileSeconds - seconds;
+		return program;
+	}
+
+	// Call between glCreateProgram and glLinkProgram so the driver keeps a binary to hand out
+	void prepare(unsigned int program)
+	{
+		if (isEnabled())
+			glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+	}
+
+	// Writes a program that was just linked from source
+	bool store(uint64_t key, unsigned int program, double compileSeconds)
+	{
+		stats.compileSeconds += compileSeconds;
+		if (!isEnabled())
+			return false;
+
+		GLint length = 0;
+		glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+		if (length <= 0)
+			return false;
+		std::vector<char> binary(length);
+		GLenum format = 0;
+		glGetProgramBinary(program, length, &length, &format, binary.data());
+
+		std::string path = pathFor(key);
+		std::error_code error;
+		std::filesystem::create_directories(std::filesystem::path(path).parent_path(), error);
+
+		// Write to a temporary name first so a crash never leaves a truncated binary behind
+		std::string tempPath = path + ".tmp";
+		FILE* file = std::fopen(tempPath.c_str(), "wb");
+		if (!file)
+		{
+			std::cerr << "Failed to write program cache: " << path << std::endl;
+			return false;
+		}
+
+		ProgramCacheHeader header = {};
+		std::memcpy(header.magic, "LGLP", 4);
+		header.version = version;
+		header.key = key;
+		header.format = format;
+		header.binarySize = static_cast<uint32_t>(length);
+		header.compileSeconds = compileSeconds;
+		bool written = std::fwrite(&header, sizeof(header), 1, file) == 1 && std::fwrite(binary.data(), 1, length, file) == static_cast<size_t>(length);
+		written = std::fclose(file) == 0 && written;
+
+		if (written)
+		{
+			std::filesystem::remove(path, error);
+			std::filesystem::rename(tempPath, path, error);
+			written = !error;
+		}
+		if (!written)
+		{
+			std::filesystem::remove(tempPath, error);
+			std::cerr << "Failed to write program cache: " << path << std::endl;
+		}
+		return written;
+	}
+};
@@ -0,0 +1,7624 @@
+#pragma once
+
+// ObjBake format 2
+// Generated by ObjBake from alliance.obj, do not edit
+// 6128 vertices, 35370 indices in 5 levels of detail
+
+#include "simplify.h"
+
+inline const float alliance_mesh_vertices[] = {
+	0.000132000001f, 1.03286505f, 0.154082f, 0.555400014f, 0.977900028f, -0.00039999999f, 0.458999991f, 0.888400018f,
+	0.00210099993f, 1.054304f, 0.143004999f, 0.544499993f, 0.978299975f, -0.00039999999f, 0.602800012f, 0.797900021f,
+	-0.00209999993f, 1.05430198f, 0.143004f, 0.544499993f, 0.976400018f, -0.00039999999f, 0.603200018f, 0.797599971f,
+	0.00300600007f, 1.06922197f, 0.127526f, 0.534699976f, 0.978399992f, -0.000500000024f, 0.808200002f, 0.588800013f,
+	-0.00300500006f, 1.06921899f, 0.127524003f, 0.534799993f, 0.975600004f, 0.00249999994f, 0.807500005f, 0.5898f,
+	0.004954f, 1.07731497f, 0.112898f, 0.527100027f, 0.978999972f, 0.0147000002f, 0.943899989f, 0.330000013f,
+	-0.00504799979f, 1.07746696f, 0.112965003f, 0.5273f, 0.974399984f, 0.0311999992f, 0.941200018f, 0.336400002f,
+	0.00518399989f, 1.08071196f, 0.0937440023f, 0.518299997f, 0.978799999f, 0.0891999975f, 0.995999992f, 0.0107000005f,
+	-0.00583499996f, 1.08183897f, 0.0937760025f, 0.518400013f, 0.973800004f, 0.0855000019f, 0.996299982f, 0.00899999961f,
+	0.00685699983f, 1.07652104f, 0.0709839985f, 0.507799983f, 0.979499996f, 0.0183000006f, 0.895900011f, -0.443899989f,
+	-0.00660800003f, 1.07659602f, 0.0709889978f, 0.507799983f, 0.973399997f, -0.00449999981f, 0.891900003f, -0.452300012f,
+	0.00688300002f, 1.064502f, 0.0565860011f, 0.499300003f, 0.979499996f, -0.0263f, 0.662599981f, -0.748600006f,
+	-0.00655099982f, 1.06414199f, 0.0570150018f, 0.499300003f, 0.973500013f, -0.0417000018f, 0.659300029f, -0.750699997f,
+	-0.00341599993f, 1.05227005f, 0.0491040014f, 0.492799997f, 0.974799991f, -0.0116999997f, 0.35679999f, -0.934099972f,
+	0.00341599993f, 1.05227005f, 0.0491049998f, 0.492799997f, 0.977900028f, 9.99999975e-05f, 0.350300014f, -0.936699986f,
+	0.0f, 1.04215205f, 0.0483059995f, 0.488200009f, 0.976300001f, 9.99999975e-05f, 0.0786999986f, -0.996900022f,
+	0.0f, 0.944896996f, 0.160304993f, 0.574500024f, 0.953499973f, -0.0102000004f, -0.0046000001f, 0.999899983f,
+	0.003241f, 0.999319017f, 0.160288006f, 0.550599992f, 0.94749999f, 0.0725999996f, 0.0961999968f, 0.992699981f,
+	0.0f, 0.999031007f, 0.160552993f, 0.551199973f, 0.946200013f, -0.0110999998f, 0.0834000036f, 0.996500015f,
+	-0.00320699997f, 0.999315023f, 0.160223007f, 0.551500022f, 0.944800019f, -0.0934000015f, 0.0983999968f, 0.990800023f,
+	0.00476199994f, 1.03099501f, 0.154420003f, 0.536499977f, 0.943799973f, 0.0535000004f, 0.300000012f, 0.952400029f,
+	0.000132000001f, 1.03286505f, 0.154082f, 0.53640002f, 0.941399992f, -0.0185000002f, 0.347600013f, 0.9375f,
+	-0.00466400012f, 1.03093195f, 0.154198006f, 0.537899971f, 0.939599991f, -0.0966000035f, 0.294400007f, 0.950800002f,
+	0.008715f, 1.05081797f, 0.143855006f, 0.526300013f, 0.942499995f, 0.181700006f, 0.578299999f, 0.795400023f,
+	0.00210099993f, 1.054304f, 0.143004999f, 0.525600016f, 0.939199984f, 0.238600001f, 0.632600009f, 0.736800015f,
+	-0.00209999993f, 1.05430198f, 0.143004f, 0.526499987f, 0.936500013f, -0.244900003f, 0.629899979f, 0.736999989f,
+	-0.00868999958f, 1.05079198f, 0.143814996f, 0.529100001f, 0.934300005f, -0.192200005f, 0.575200021f, 0.795099974f,
+	0.0120010003f, 1.06384897f, 0.128815994f, 0.517099977f, 0.942099988f, 0.158700004f, 0.805299997f, 0.571200013f,
+	0.00514499983f, 1.06571603f, 0.127869993f, 0.516900003f, 0.938799977f, 0.165000007f, 0.812600017f, 0.559000015f,
+	0.00765200006f, 1.07316196f, 0.113150001f, 0.50940001f, 0.93870002f, 0.350499988f, 0.895200014f, 0.275299996f,
+	0.0143339997f, 1.06993997f, 0.114669003f, 0.510100007f, 0.941999972f, 0.353399992f, 0.886799991f, 0.297699988f,
+	0.0106239999f, 1.07465303f, 0.0951040015f, 0.501100004f, 0.939599991f, 0.398600012f, 0.916000009f, -0.0441999994f,
+	0.0174770001f, 1.07178903f, 0.0964979976f, 0.501699984f, 0.943000019f, 0.396800011f, 0.917500019f, -0.0289999992f,
+	0.0112760002f, 1.06938899f, 0.0756250024f, 0.492000014f, 0.940800011f, 0.542400002f, 0.745299995f, -0.387800008f,
+	0.017678f, 1.06721199f, 0.0805059969f, 0.494199991f, 0.943899989f, 0.5273f, 0.787299991f, -0.319599986f,
+	0.010892f, 1.05919802f, 0.0605939999f, 0.484100014f, 0.942799985f, 0.714100003f, 0.452199996f, -0.534300029f,
+	0.014285f, 1.05621505f, 0.0628319979f, 0.484699994f, 0.944999993f, 0.731899977f, 0.445800006f, -0.515299976f,
+	0.00856500026f, 1.05048299f, 0.0526160002f, 0.478899986f, 0.944400012f, 0.713199973f, 0.360100001f, -0.601400018f,
+	-0.0051409998f, 1.06571102f, 0.127866f, 0.519500017f, 0.931299984f, -0.183699995f, 0.808799982f, 0.558700025f,
+	-0.0119169997f, 1.06374097f, 0.128726006f, 0.521700025f, 0.928900003f, -0.159799993f, 0.80250001f, 0.574800014f,
+	-0.00766200013f, 1.07317495f, 0.113155998f, 0.513599992f, 0.926500022f, -0.254999995f, 0.923600018f, 0.286199987f,
+	-0.0148820002f, 1.07062995f, 0.114952996f, 0.51639998f, 0.924300015f, -0.253399998f, 0.913600028f, 0.318100005f,
+	-0.0106250001f, 1.07465398f, 0.0951040015f, 0.507700026f, 0.920599997f, -0.407000005f, 0.91109997f, -0.0649999976f,
+	-0.0173530001f, 1.071661f, 0.0965040028f, 0.510299981f, 0.91839999f, -0.416099995f, 0.907700002f, -0.0538999997f,
+	-0.0114559997f, 1.06914604f, 0.0754529983f, 0.50150001f, 0.913800001f, -0.515600026f, 0.763400018f, -0.389099985f,
+	-0.0174150001f, 1.06712496f, 0.0794019997f, 0.504700005f, 0.912699997f, -0.505299985f, 0.800000012f, -0.323500007f,
+	-0.0108829997f, 1.05919302f, 0.0606000014f, 0.496600002f, 0.907299995f, -0.709399998f, 0.451999992f, -0.540799975f,
+	-0.0142890001f, 1.056216f, 0.0628290027f, 0.49849999f, 0.906000018f, -0.728799999f, 0.442499995f, -0.522499979f,
+	-0.00856100023f, 1.05048299f, 0.052618999f, 0.493600011f, 0.902800024f, -0.711099982f, 0.362399995f, -0.602400005f,
+	0.0f, 1.03447902f, 0.0578619987f, 0.555999994f, 0.990999997f, -0.00710000005f, -0.233899996f, 0.972199976f,
+	0.0f, 1.02884698f, 0.0566430017f, 0.55400002f, 0.989400029f, -0.00810000021f, -0.211500004f, 0.977299988f,
+	0.00423000008f, 1.02939296f, 0.0555519983f, 0.555400014f, 0.987900019f, 0.575200021f, -0.101999998f, 0.811699986f,
+	0.003272f, 1.03456497f, 0.0571050011f, 0.556900024f, 0.989799976f, 0.608200014f, -0.1228f, 0.784200013f,
+	0.00595499994f, 1.03913498f, 0.0525069982f, 0.559899986f, 0.988900006f, 0.899299979f, 0.433099985f, 0.060800001f,
+	0.00817599986f, 1.03304899f, 0.0501689985f, 0.558399975f, 0.986100018f, 0.935899973f, 0.243699998f, 0.254599988f,
+	0.00513899978f, 1.036165f, 0.0444389991f, 0.561600029f, 0.985300004f, 0.635500014f, 0.648899972f, -0.41839999f,
+	0.0f, 1.04215205f, 0.0483059995f, 0.563300014f, 0.989000022f, 0.00779999979f, 0.838500023f, -0.5449f,
+	0.0f, 1.03747904f, 0.0429989994f, 0.56400001f, 0.985800028f, -0.0118000004f, 0.750400007f, -0.660899997f,
+	-0.00502499985f, 1.03611302f, 0.0445399992f, 0.566299975f, 0.986500025f, -0.639299989f, 0.621299982f, -0.453099996f,
+	-0.00577200018f, 1.03986096f, 0.0520830005f, 0.566100001f, 0.990400016f, -0.888400018f, 0.458700001f, -0.0174000002f,
+	-0.00811500009f, 1.03305197f, 0.0501659997f, 0.568899989f, 0.988499999f, -0.930100024f, 0.242300004f, 0.276199996f,
+	-0.00417899992f, 1.02942801f, 0.0554939993f, 0.57099998f, 0.99119997f, -0.586499989f, -0.0900000036f, 0.804899991f,
+	-0.00324300001f, 1.03458905f, 0.0570800006f, 0.568899989f, 0.992399991f, -0.637600005f, -0.1184f, 0.761200011f,
+	0.0f, 1.02884698f, 0.0566430017f, 0.571799994f, 0.992999971f, -0.00810000021f, -0.211500004f, 0.977299988f,
+	0.0f, 1.03447902f, 0.0578619987f, 0.569299996f, 0.993799984f, -0.00710000005f, -0.233899996f, 0.972199976f,
+	-0.0302419998f, 0.977991998f, 0.00253099995f, 0.150600001f, 0.655900002f, 0.610800028f, 0.701099992f, -0.368000001f,
+	-0.0218739994f, 0.976288974f, -0.0126470001f, 0.157399997f, 0.651799977f, 0.226099998f, 0.974099994f, -0.00680000009f,
+	-0.0257089995f, 0.977208972f, -0.0169459991f, 0.159400001f, 0.653599977f, 0.246299997f, 0.969200015f, -0.00380000006f,
+	-0.00389500009f, 0.972181022f, -0.0311299991f, 0.165399998f, 0.64319998f, 0.140300006f, 0.986599982f, -0.0829000026f,
+	-0.00885299966f, 0.972424984f, -0.0366149992f, 0.167999998f, 0.645399988f, 0.156900004f, 0.984899998f, -0.0736000016f,
+	0.0310309995f, 0.990347028f, 0.00300900009f, 0.174600005f, 0.669200003f, 0.573800027f, 0.774600029f, 0.265799999f,
+	0.0394209996f, 0.969419003f, 0.0183589999f, 0.187000006f, 0.670099974f, 0.970399976f, -0.158700004f, 0.182099998f,
+	0.0396809988f, 0.974398971f, 0.0129079996f, 0.183799997f, 0.671199977f, 0.495499998f, 0.635900021f, 0.591600001f,
+	0.03235f, 0.990242004f, 0.00026999999f, 0.174099997f, 0.67049998f, 0.463699996f, 0.869700015f, 0.169200003f,
+	0.0197710004f, 0.994508028f, -0.0126919998f, 0.165700004f, 0.66960001f, 0.488400012f, 0.782800019f, -0.385600001f,
+	0.0208340008f, 0.993192971f, -0.013878f, 0.165700004f, 0.670599997f, 0.487899989f, 0.775300026f, -0.401199996f,
+	0.0109160002f, 0.993683994f, -0.0213590004f, 0.160099998f, 0.670000017f, 0.259299994f, 0.855099976f, -0.449000001f,
+	0.0125940004f, 0.992393017f, -0.0229630005f, 0.1602f, 0.671199977f, 0.25029999f, 0.865100026f, -0.434599996f,
+	-0.0f, 0.989410996f, -0.0325709991f, 0.152899995f, 0.671400011f, 0.250400007f, 0.798099995f, -0.547999978f,
+	-0.0f, 0.992344022f, -0.028438f, 0.154200003f, 0.669499993f, 0.265399992f, 0.786199987f, -0.558099985f,
+	-0.0310309995f, 0.990347028f, 0.00300900009f, 0.112899996f, 0.733399987f, -0.573800027f, 0.774600029f, 0.265799999f,
+	-0.03235f, 0.990242004f, 0.00026999999f, 0.112999998f, 0.731999993f, -0.463699996f, 0.869700015f, 0.169200003f,
+	-0.0396809988f, 0.974398971f, 0.0129079996f, 0.121799998f, 0.736199975f, -0.495499998f, 0.635900021f, 0.591600001f,
+	-0.0394209996f, 0.969419003f, 0.0183589999f, 0.1241f, 0.738699973f, -0.970399976f, -0.158700004f, 0.182099998f,
+	-0.0197710004f, 0.994508028f, -0.0126919998f, 0.105300002f, 0.728600025f, -0.488400012f, 0.782800019f, -0.385600001f,
+	-0.0208340008f, 0.993192971f, -0.013878f, 0.105800003f, 0.727800012f, -0.487899989f, 0.775300026f, -0.401199996f,
+	-0.0109160002f, 0.993683994f, -0.0213590004f, 0.100599997f, 0.725499988f, -0.259200007f, 0.855099976f, -0.449000001f,
+	-0.0125940004f, 0.992393017f, -0.0229630005f, 0.101300001f, 0.7245f, -0.250200003f, 0.865199983f, -0.434599996f,
+	-0.0f, 0.992344022f, -0.028438f, 0.0952000022f, 0.723100007f, -0.265399992f, 0.786199987f, -0.558099985f,
+	-0.0f, 0.989410996f, -0.0325709991f, 0.0949999988f, 0.720799983f, -0.250400007f, 0.798099995f, -0.547999978f,
+	-0.00632000016f, 1.00852799f, 0.0696040019f, 0.0901999995f, 0.61500001f, -0.376399994f, 0.533900023f, 0.757099986f,
+	0.0f, 1.00926197f, 0.0702679977f, 0.0930000022f, 0.616400003f, 0.0f, 0.55430001f, 0.832300007f,
+	0.0f, 1.02584803f, 0.0533110015f, 0.0860000029f, 0.627600014f, 0.0f, 0.890799999f, 0.454400003f,
+	-0.0357280001f, 0.995664001f, 0.0413060002f, 0.0698999986f, 0.608799994f, -0.921999991f, 0.302100003f, 0.242300004f,
+	-0.0378829986f, 0.962288976f, 0.0444599986f, 0.0676999986f, 0.592299998f, -0.941600025f, 0.125300005f, 0.312700003f,
+	-0.0284620002f, 0.963199973f, 0.0600170009f, 0.0773999989f, 0.591300011f, -0.725899994f, 0.0820000023f, 0.682900012f,
+	-0.028593f, 0.98910898f, 0.0595280007f, 0.0788000003f, 0.604200006f, -0.760999978f, 0.184599996f, 0.621999979f,
+	-0.035298001f, 0.994645f, 0.0223629996f, 0.060800001f, 0.611199975f, -0.949500024f, 0.283600003f, -0.133900002f,
+	-0.0267030001f, 1.01525104f, 0.0363080017f, 0.0711999983f, 0.619400024f, -0.782500029f, 0.597199976f, 0.176100001f,
+	-0.0397339985f, 0.973984003f, 0.0282049999f, 0.0606999993f, 0.600199997f, -0.993200004f, 0.113899998f, 0.0244999994f,
+	-0.0412870012f, 0.949240983f, 0.0226760004f, 0.0549999997f, 0.58859998f, -0.981700003f, 0.130700007f, -0.138300002f,
+	-0.0450639986f, 0.932771981f, 0.0268959999f, 0.0551999994f, 0.579699993f, -0.975300014f, 0.208800003f, -0.0724999979f,
+	-0.0371289998f, 0.938893974f, 0.0575589985f, 0.071800001f, 0.579299986f, -0.829699993f, 0.189999998f, 0.524900019f,
+	-0.014525f, 0.955425024f, 0.0694980025f, 0.0860000029f, 0.586799979f, -0.368200004f, 0.116099998f, 0.922500014f,
+	-0.0147409998f, 0.977303028f, 0.0712570027f, 0.0874999985f, 0.598100007f, -0.470699996f, -0.0153999999f, 0.882200003f,
+	-0.0221929997f, 1.00845098f, 0.0568300001f, 0.0803999975f, 0.614199996f, -0.69599998f, 0.487399995f, 0.5273f,
+	-0.0273950007f, 1.01222599f, 0.0148440003f, 0.060800001f, 0.621299982f, -0.830500007f, 0.512199998f, -0.218600005f,
+	-0.0142609999f, 1.02820897f, 0.0295180008f, 0.0716999993f, 0.628799975f, -0.509899974f, 0.85680002f, 0.0766000003f,
+	-0.00886000041f, 1.02209997f, 0.0534470007f, 0.0833000019f, 0.623600006f, -0.451999992f, 0.763000011f, 0.462099999f,
+	-0.0117659997f, 0.998274982f, 0.072453998f, 0.0892999992f, 0.608900011f, -0.521300018f, 0.242699996f, 0.818099976f,
+	0.0f, 0.994329989f, 0.0764020011f, 0.0956000015f, 0.607599974f, 0.0f, 0.137500003f, 0.990499973f,
+	0.0f, 0.976907015f, 0.0755989999f, 0.0952999964f, 0.597800016f, 0.0f, -0.108599998f, 0.994099975f,
+	0.0f, 0.954675019f, 0.0717390031f, 0.0936999992f, 0.586099982f, -0.0f, 0.109200001f, 0.994000018f,
+	-0.0191740002f, 0.939770997f, 0.0735300034f, 0.0839999989f, 0.578299999f, -0.426699996f, 0.350899994f, 0.833500028f,
+	0.0f, 0.938894987f, 0.0772709996f, 0.0939000025f, 0.577600002f, -0.0f, 0.330900013f, 0.943700016f,
+	0.0f, 1.03333604f, 0.0248050001f, 0.072300002f, 0.637199998f, -0.0f, 0.999899983f, -0.0118000004f,
+	-0.0146019999f, 1.02227294f, 0.00491699995f, 0.0590999983f, 0.629899979f, -0.595200002f, 0.722299993f, -0.352299988f,
+	-0.0f, 1.027619f, -0.00266100001f, 0.0573999994f, 0.636900008f, -0.0f, 0.871599972f, -0.490200013f,
+	0.0146019999f, 1.02227294f, 0.00491699995f, 0.0588000007f, 0.64410001f, 0.595200002f, 0.722299993f, -0.352299988f,
+	0.0142609999f, 1.02820897f, 0.0295180008f, 0.0714000016f, 0.645699978f, 0.509899974f, 0.85680002f, 0.0766000003f,
+	0.0f, 1.02584803f, 0.0533110015f, 0.0855000019f, 0.647499979f, 0.0f, 0.890799999f, 0.454400003f,
+	0.00886000041f, 1.02209997f, 0.0534459986f, 0.0826999992f, 0.651499987f, 0.451999992f, 0.763000011f, 0.462099999f,
+	-0.0124430005f, 1.00837505f, -0.0128309997f, 0.0476000011f, 0.629899979f, -0.591000021f, 0.491400003f, -0.639699996f,
+	-0.0227310006f, 1.00300097f, -0.0042849998f, 0.0498999991f, 0.622799993f, -0.77640003f, 0.388399988f, -0.496399999f,
+	-0.0f, 1.01099598f, -0.0196390003f, 0.0458000004f, 0.636699975f, 0.0f, 0.576900005f, -0.816799998f,
+	0.0124430005f, 1.00837505f, -0.0128309997f, 0.0472999997f, 0.643599987f, 0.591000021f, 0.491400003f, -0.639699996f,
+	0.0273950007f, 1.01222599f, 0.0148440003f, 0.0601999983f, 0.652700007f, 0.830600023f, 0.512199998f, -0.218600005f,
+	0.0227310006f, 1.00300097f, -0.0042849998f, 0.0494000018f, 0.65079999f, 0.77640003f, 0.388399988f, -0.496399999f,
+	0.022194f, 1.00845098f, 0.0568300001f, 0.079400003f, 0.660700023f, 0.69599998f, 0.487399995f, 0.5273f,
+	0.0267030001f, 1.01525104f, 0.0363080017f, 0.0705000013f, 0.655099988f, 0.782500029f, 0.597199976f, 0.176100001f,
+	0.0117659997f, 0.998274982f, 0.072453998f, 0.0881000012f, 0.666299999f, 0.521300018f, 0.242699996f, 0.818099976f,
+	0.00632000016f, 1.00852799f, 0.0696040019f, 0.0891999975f, 0.660300016f, 0.376399994f, 0.533900023f, 0.757099986f,
+	0.0f, 1.00926197f, 0.0702679977f, 0.0921000019f, 0.658900023f, 0.0f, 0.55430001f, 0.832300007f,
+	0.0147409998f, 0.977303028f, 0.0712570027f, 0.0859000012f, 0.676999986f, 0.470699996f, -0.0153999999f, 0.882200003f,
+	0.0f, 0.994329989f, 0.0764020011f, 0.0943000019f, 0.667900026f, 0.0f, 0.137500003f, 0.990499973f,
+	0.028593f, 0.98910898f, 0.0595280007f, 0.0773999989f, 0.670599997f, 0.760999978f, 0.184599996f, 0.621999979f,
+	0.035298001f, 0.994645f, 0.0223629996f, 0.059700001f, 0.662800014f, 0.949500024f, 0.283600003f, -0.133900002f,
+	0.0357280001f, 0.995664001f, 0.0413060002f, 0.0687000006f, 0.665600002f, 0.921999991f, 0.302100003f, 0.242300004f,
+	0.0310309995f, 0.990347028f, 0.00300900009f, 0.0494999997f, 0.65990001f, 0.899800003f, 0.270999998f, -0.341800004f,
+	0.0197710004f, 0.994508028f, -0.0126919998f, 0.0430999994f, 0.650699973f, 0.718500018f, 0.315100014f, -0.620000005f,
+	0.0394209996f, 0.969419003f, 0.0183589999f, 0.0537f, 0.674399972f, 0.976899981f, 0.0947000012f, -0.191599995f,
+	0.0397339985f, 0.973984003f, 0.0282049999f, 0.0592f, 0.673799992f, 0.993200004f, 0.113899998f, 0.0244999994f,
+	0.0284620002f, 0.963199973f, 0.0600170009f, 0.0754999965f, 0.683399975f, 0.725899994f, 0.0820000023f, 0.682900012f,
+	0.0378829986f, 0.962288976f, 0.0444599986f, 0.0658000037f, 0.681999981f, 0.941600025f, 0.125300005f, 0.312700003f,
+	0.014525f, 0.955425024f, 0.0694980025f, 0.0839999989f, 0.688300014f, 0.368200004f, 0.116099998f, 0.922500014f,
+	0.0371289998f, 0.938893974f, 0.0575589985f, 0.0693999976f, 0.695100009f, 0.829699993f, 0.189999998f, 0.524900019f,
+	0.0412870012f, 0.949240983f, 0.0226760004f, 0.0531000011f, 0.685199976f, 0.981700003f, 0.130700007f, -0.138300002f,
+	0.0450639986f, 0.932771981f, 0.0268959999f, 0.0529000014f, 0.694100022f, 0.975300014f, 0.208800003f, -0.0724999979f,
+	0.0289849993f, 0.966597021f, -0.0112490002f, 0.0381999984f, 0.671000004f, 0.897099972f, 0.0966000035f, -0.431100011f,
+	0.0322149992f, 0.940494001f, -0.0110539999f, 0.0346000008f, 0.684000015f, 0.88410002f, 0.164800003f, -0.437400013f,
+	0.0433860011f, 0.92631799f, 0.00583699998f, 0.0417000018f, 0.694400012f, 0.881399989f, 0.370499998f, -0.293199986f,
+	0.0150520001f, 0.930729985f, -0.0385369994f, 0.0173000004f, 0.682799995f, 0.815400004f, 0.137999997f, -0.56220001f,
+	0.0154400002f, 0.922834992f, -0.0401230007f, 0.0153000001f, 0.68629998f, 0.783399999f, 0.181500003f, -0.594399989f,
+	0.0304150004f, 0.919274986f, -0.0222839992f, 0.0255999994f, 0.692499995f, 0.775900006f, 0.282200009f, -0.564300001f,
+	0.0161979999f, 0.962503016f, -0.0301300008f, 0.0265999995f, 0.668900013f, 0.809199989f, 0.1228f, -0.574599981f,
+	0.01664f, 0.901744008f, -0.0444520004f, 0.00989999995f, 0.695900023f, 0.690900028f, 0.25150001f, -0.6778f,
+	0.0340240002f, 0.912106991f, -0.0222139992f, 0.0252f, 0.69660002f, 0.7227f, 0.352400005f, -0.594500005f,
+	0.0227889996f, 0.890493989f, -0.0430909991f, 0.00999999978f, 0.702499986f, 0.623000026f, 0.2509f, -0.74089998f,
+	0.0179350004f, 0.885589004f, -0.0480379984f, 0.0057000001f, 0.703299999f, 0.577799976f, 0.220799997f, -0.78579998f,
+	0.0191740002f, 0.939770997f, 0.0735300034f, 0.0816000029f, 0.69660002f, 0.426699996f, 0.350899994f, 0.833500028f,
+	0.0f, 0.954675019f, 0.0717390031f, 0.0916000009f, 0.689300001f, -0.0f, 0.109200001f, 0.994000018f,
+	0.0f, 0.938894987f, 0.0772709996f, 0.0914999992f, 0.697799981f, -0.0f, 0.330900013f, 0.943700016f,
+	0.0f, 0.976907015f, 0.0755989999f, 0.0935999975f, 0.677699983f, 0.0f, -0.108599998f, 0.994099975f,
+	0.0180719998f, 0.880135f, -0.0521389991f, 0.0168999992f, 0.732299984f, 0.244800001f, 0.5722f, -0.782700002f,
+	0.0179350004f, 0.885589004f, -0.0480379984f, 0.0198999997f, 0.731400013f, 0.197699994f, 0.592199981f, -0.781099975f,
+	0.0227889996f, 0.890493989f, -0.0430909991f, 0.0234999992f, 0.732599974f, 0.327399999f, 0.551199973f, -0.767400026f,
+	0.0244270004f, 0.887017012f, -0.0448459983f, 0.0220999997f, 0.733900011f, 0.321999997f, 0.542999983f, -0.7755f,
+	0.0340240002f, 0.912106991f, -0.0222139992f, 0.0379999988f, 0.734099984f, 0.386000007f, 0.657400012f, -0.647099972f,
+	0.0376060009f, 0.909964025f, -0.0222420003f, 0.0377000012f, 0.735899985f, 0.387600005f, 0.655200005f, -0.648500025f,
+	0.0433860011f, 0.92631799f, 0.00583699998f, 0.0526000001f, 0.736500025f, 0.477800012f, 0.79400003f, -0.375800014f,
+	0.0469449982f, 0.923785985f, 0.00491600018f, 0.0518999994f, 0.738399982f, 0.45539999f, 0.787899971f, -0.414600015f,
+	0.048932001f, 0.929942012f, 0.0277939998f, 0.0627000034f, 0.739199996f, 0.602100015f, 0.775399983f, -0.190300003f,
+	0.0450639986f, 0.932771981f, 0.0268959999f, 0.0626000017f, 0.736999989f, 0.583999991f, 0.789200008f, -0.190099999f,
+	0.0463260002f, 0.934391022f, 0.0462229997f, 0.0713f, 0.738499999f, 0.388300002f, 0.918600023f, -0.0738999993f,
+	0.0371289998f, 0.938893974f, 0.0575589985f, 0.0771000013f, 0.734600008f, 0.451700002f, 0.87620002f, 0.167999998f,
+	0.0397100002f, 0.936262012f, 0.0626709983f, 0.0790999979f, 0.736599982f, 0.415100008f, 0.876999974f, 0.2421f,
+	0.0191740002f, 0.939770997f, 0.0735300034f, 0.0860000029f, 0.728399992f, 0.196500003f, 0.881799996f, 0.4287f,
+	0.026904f, 0.936782002f, 0.0753170028f, 0.0860999972f, 0.732299984f, 0.274399996f, 0.899399996f, 0.340200007f,
+	0.0126130003f, 0.936568975f, 0.0813950002f, 0.0905999988f, 0.726899981f, 0.0604000017f, 0.895799994f, 0.440400004f,
+	0.0f, 0.938894987f, 0.0772709996f, 0.0904999971f, 0.720799983f, 0.0142999999f, 0.888999999f, 0.457700014f,
+	0.0f, 0.934903026f, 0.0845279992f, 0.0939999968f, 0.722100019f, 0.00400000019f, 0.87620002f, 0.481999993f,
+	-0.0180719998f, 0.880135f, -0.0521389991f, 0.115800001f, 0.705200016f, -0.244800001f, 0.5722f, -0.782800019f,
+	-0.0244270004f, 0.887017012f, -0.0448459983f, 0.120899998f, 0.703599989f, -0.321999997f, 0.542999983f, -0.7755f,
+	-0.0227889996f, 0.890493989f, -0.0430909991f, 0.122299999f, 0.704900026f, -0.327499986f, 0.551199973f, -0.767400026f,
+	-0.0179350004f, 0.885589004f, -0.0480379984f, 0.118699998f, 0.706099987f, -0.197699994f, 0.592199981f, -0.781199992f,
+	-0.0376060009f, 0.909964025f, -0.0222420003f, 0.136500001f, 0.701600015f, -0.387600005f, 0.655200005f, -0.648500025f,
+	-0.0340240002f, 0.912106991f, -0.0222139992f, 0.136800006f, 0.703400016f, -0.386000007f, 0.657400012f, -0.647099972f,
+	-0.0469449982f, 0.923785985f, 0.00491600018f, 0.150700003f, 0.699100018f, -0.45539999f, 0.787899971f, -0.414600015f,
+	-0.0433860011f, 0.92631799f, 0.00583699998f, 0.151500002f, 0.700999975f, -0.477800012f, 0.79400003f, -0.375800014f,
+	-0.048932001f, 0.929942012f, 0.0277939998f, 0.161500007f, 0.698300004f, -0.602100015f, 0.775399983f, -0.190300003f,
+	-0.0450639986f, 0.932771981f, 0.0268959999f, 0.161500007f, 0.700500011f, -0.583999991f, 0.789200008f, -0.190099999f,
+	-0.0463260002f, 0.934391022f, 0.0462229997f, 0.170100003f, 0.699000001f, -0.388300002f, 0.918600023f, -0.0738999993f,
+	-0.0371289998f, 0.938893974f, 0.0575589985f, 0.175899997f, 0.702899992f, -0.451700002f, 0.87620002f, 0.167999998f,
+	-0.0397100002f, 0.936262012f, 0.0626709983f, 0.178000003f, 0.700900018f, -0.415100008f, 0.876999974f, 0.2421f,
+	-0.026904f, 0.936782002f, 0.0753170028f, 0.184900001f, 0.705200016f, -0.274399996f, 0.899399996f, 0.340200007f,
+	-0.0191740002f, 0.939770997f, 0.0735300034f, 0.184799999f, 0.709100008f, -0.196500003f, 0.881799996f, 0.4287f,
+	-0.0126130003f, 0.936568975f, 0.0813950002f, 0.189400002f, 0.710600019f, -0.0604000017f, 0.895699978f, 0.440400004f,
+	0.0f, 0.938894987f, 0.0772709996f, 0.189300001f, 0.716700017f, -0.0142999999f, 0.888999999f, 0.457700014f,
+	0.0f, 0.934903026f, 0.0845279992f, 0.192900002f, 0.715399981f, -0.00400000019f, 0.87620002f, 0.481999993f,
+	0.186473995f, 0.875155985f, 0.0585849993f, 0.337900013f, 0.0186999999f, 0.772499979f, 0.582499981f, -0.252900004f,
+	0.180607006f, 0.878477991f, 0.0483129993f, 0.343199998f, 0.0187999997f, 0.665600002f, 0.734300017f, -0.133499995f,
+	0.176456004f, 0.881605983f, 0.0509250015f, 0.343600005f, 0.0163000003f, 0.573199987f, 0.816699982f, -0.0671999976f,
+	0.185668007f, 0.871241987f, 0.0513739996f, 0.340200007f, 0.0214000009f, 0.839699984f, 0.479099989f, -0.255699992f,
+	0.172901005f, 0.88340801f, 0.0428030007f, 0.34740001f, 0.0168999992f, 0.572300017f, 0.817099988f, -0.0692000017f,
+	0.187013f, 0.867810011f, 0.0483359993f, 0.340600014f, 0.0234999992f, 0.840600014f, 0.504299998f, -0.197699994f,
+	-0.134210005f, 0.918964982f, 0.0420360006f, 0.0691f, 0.0452000014f, -0.657599986f, 0.74089998f, -0.136299998f,
+	-0.131793007f, 0.916468978f, 0.0304780006f, 0.0640999973f, 0.0465000011f, -0.593900025f, 0.681200027f, -0.42809999f,
+	-0.165869996f, 0.881599009f, 0.0200900007f, 0.0542000011f, 0.0267999992f, -0.547200024f, 0.681299984f, -0.486200005f,
+	-0.17475f, 0.883328974f, 0.0430309996f, 0.064000003f, 0.0219000001f, -0.676800013f, 0.735899985f, -0.0176999997f,
+	-0.134608001f, 0.918052018f, 0.053975001f, 0.0741000026f, 0.0436000004f, -0.654500008f, 0.729300022f, 0.199200004f,
+	-0.149112001f, 0.868040979f, -0.004526f, 0.0405000001f, 0.0320999995f, -0.428000003f, 0.555899978f, -0.712499976f,
+	-0.120330997f, 0.902402997f, 0.00412000017f, 0.0504000001f, 0.0498000011f, -0.486000001f, 0.573099971f, -0.65990001f,
+	-0.109171003f, 0.892206013f, -0.00832900032f, 0.0423999988f, 0.0529000014f, -0.386799991f, 0.508700013f, -0.76910001f,
+	-0.129685998f, 0.853986025f, -0.0221059993f, 0.0285999998f, 0.0379999988f, -0.33039999f, 0.472000003f, -0.817300022f,
+	-0.0812869966f, 0.91714102f, -0.00359299988f, 0.0491000004f, 0.068599999f, -0.414900005f, 0.629100025f, -0.657299995f,
+	-0.0798569992f, 0.892690003f, -0.023387f, 0.0350000001f, 0.065700002f, -0.398400009f, 0.489499986f, -0.775699973f,
+	-0.107894003f, 0.905642986f, 0.0023670001f, 0.0496999994f, 0.0551999994f, -0.41960001f, 0.6347f, -0.648899972f,
+	-0.103758f, 0.838729978f, -0.0399800017f, 0.0152000003f, 0.0465000011f, -0.335599989f, 0.409999996f, -0.848100007f,
+	-0.0851449966f, 0.938552022f, 0.0230129994f, 0.0649000034f, 0.0689999983f, -0.467400014f, 0.724399984f, -0.506699979f,
+	-0.110086001f, 0.922626972f, 0.0234750006f, 0.061999999f, 0.0557999983f, -0.461299986f, 0.714600027f, -0.525900006f,
+	-0.113412999f, 0.929506004f, 0.0391689986f, 0.0697000027f, 0.054299999f, -0.513599992f, 0.817499995f, -0.260600001f,
+	-0.0877040029f, 0.945443988f, 0.0385599993f, 0.072800003f, 0.0678000003f, -0.513999999f, 0.819500029f, -0.253300011f,
+	-0.114871003f, 0.930339992f, 0.0551399998f, 0.0764999986f, 0.052099999f, -0.487699986f, 0.85650003f, 0.168799996f,
+	-0.0891579986f, 0.946012974f, 0.054680001f, 0.0798999965f, 0.0653999969f, -0.513199985f, 0.841000021f, 0.171399996f,
+	-0.087797001f, 0.937865973f, 0.0695360005f, 0.0869999975f, 0.061999999f, -0.417199999f, 0.79369998f, 0.442600012f,
+	-0.113569997f, 0.923074007f, 0.0739680007f, 0.0847999975f, 0.0485000014f, -0.430000007f, 0.728500009f, 0.533200026f,
+	-0.0862200037f, 0.928431988f, 0.0867390037f, 0.0951000005f, 0.0577999987f, -0.396200001f, 0.637199998f, 0.66109997f,
+	-0.107735999f, 0.90229398f, 0.0927560031f, 0.0960000008f, 0.0423000008f, -0.381900012f, 0.478899986f, 0.790499985f,
+	-0.0801509991f, 0.879432023f, 0.117624998f, 0.115599997f, 0.0410000011f, -0.386099994f, 0.323700011f, 0.863799989f,
+	-0.108970001f, 0.877390981f, 0.105209f, 0.104099996f, 0.0329000019f, -0.390500009f, 0.307599992f, 0.867699981f,
+	-0.0827599987f, 0.843131006f, 0.125043005f, 0.124300003f, 0.0266999993f, -0.365799993f, 0.190400004f, 0.911000013f,
+	-0.122962996f, 0.893841982f, 0.0927229971f, 0.0935999975f, 0.0357000008f, -0.451799989f, 0.38530001f, 0.8046f,
+	-0.164606005f, 0.868561983f, 0.0814440027f, 0.0825999975f, 0.0164999999f, -0.520299971f, 0.45449999f, 0.72299999f,
+	-0.136207998f, 0.840604007f, 0.104796998f, 0.102799997f, 0.0126999998f, -0.367199987f, 0.261900008f, 0.892499983f,
+	-0.113640003f, 0.822704017f, 0.117181003f, 0.116899997f, 0.0114000002f, -0.33919999f, 0.189199999f, 0.921500027f,
+	-0.0880139992f, 0.811546981f, 0.126930997f, 0.129999995f, 0.0135000004f, -0.312000006f, 0.1083f, 0.943899989f,
+	-0.131363004f, 0.908369005f, 0.0771780014f, 0.0842999965f, 0.0395000018f, -0.577799976f, 0.601499975f, 0.551599979f,
+	-0.173002005f, 0.878521979f, 0.0627740026f, 0.0727000013f, 0.0189999994f, -0.643599987f, 0.651199996f, 0.402099997f,
+	0.113640003f, 0.822704017f, 0.117181003f, 0.317999989f, 0.0231999997f, 0.33919999f, 0.189199999f, 0.921500027f,
+	0.0827599987f, 0.843131006f, 0.125043005f, 0.319400012f, 0.0395999998f, 0.365799993f, 0.190400004f, 0.911000013f,
+	0.0880139992f, 0.811546981f, 0.126930997f, 0.329100013f, 0.0296f, 0.312000006f, 0.1083f, 0.943899989f,
+	0.108970001f, 0.877390981f, 0.105209f, 0.298999995f, 0.0383000001f, 0.390500009f, 0.307599992f, 0.867699981f,
+	0.136207998f, 0.840604007f, 0.104796998f, 0.304899991f, 0.0194000006f, 0.367199987f, 0.261900008f, 0.892499983f,
+	0.0801509991f, 0.879432023f, 0.117624998f, 0.306499988f, 0.0494000018f, 0.386099994f, 0.323700011f, 0.863799989f,
+	0.164606005f, 0.868561983f, 0.0814440027f, 0.285100013f, 0.0159000009f, 0.543799996f, 0.470999986f, 0.694599986f,
+	0.122962996f, 0.893841982f, 0.0927229971f, 0.288500011f, 0.0372000001f, 0.451799989f, 0.38530001f, 0.8046f,
+	0.107736997f, 0.90229398f, 0.0927560031f, 0.288500011f, 0.0441000015f, 0.381799996f, 0.478899986f, 0.790499985f,
+	0.0862200037f, 0.928431988f, 0.0867390037f, 0.282400012f, 0.057599999f, 0.396200001f, 0.637199998f, 0.66109997f,
+	0.113569997f, 0.923074007f, 0.0739680007f, 0.276300013f, 0.0458000004f, 0.430000007f, 0.728500009f, 0.533200026f,
+	0.087797001f, 0.937865973f, 0.0695360005f, 0.273699999f, 0.058600001f, 0.417199999f, 0.79369998f, 0.442600012f,
+	0.114871003f, 0.930339992f, 0.0551399998f, 0.2676f, 0.0463000014f, 0.487699986f, 0.85650003f, 0.168799996f,
+	0.0891579986f, 0.946012974f, 0.054680001f, 0.266200006f, 0.0593000017f, 0.513199985f, 0.841000021f, 0.171399996f,
+	0.113412999f, 0.929506004f, 0.0391689986f, 0.260600001f, 0.0458999984f, 0.513599992f, 0.817499995f, -0.260600001f,
+	0.0877040029f, 0.945443988f, 0.0385599993f, 0.258899987f, 0.0588999987f, 0.513999999f, 0.819500029f, -0.253300011f,
+	0.110086001f, 0.922626972f, 0.0234750006f, 0.253199995f, 0.0447000004f, 0.461299986f, 0.714600027f, -0.525900006f,
+	0.0851449966f, 0.938552022f, 0.0230129994f, 0.25150001f, 0.0573000014f, 0.467400014f, 0.724399984f, -0.506699979f,
+	0.0812869966f, 0.91714102f, -0.00359299988f, 0.237499997f, 0.0518000014f, 0.414900005f, 0.629100025f, -0.657299995f,
+	0.107894003f, 0.905642986f, 0.0023670001f, 0.242400005f, 0.0399999991f, 0.41960001f, 0.6347f, -0.648899972f,
+	0.109171003f, 0.892206013f, -0.00832900032f, 0.236399993f, 0.0355000012f, 0.386799991f, 0.508700013f, -0.76910001f,
+	0.0798569992f, 0.892690003f, -0.023387f, 0.225600004f, 0.0447000004f, 0.398400009f, 0.489499986f, -0.775699973f,
+	0.120330997f, 0.902402997f, 0.00412000017f, 0.2447f, 0.0355000012f, 0.486000001f, 0.573099971f, -0.65990001f,
+	0.149112001f, 0.868040979f, -0.004526f, 0.241600007f, 0.0160000008f, 0.430799991f, 0.556699991f, -0.710300028f,
+	0.129685998f, 0.853986025f, -0.0221059993f, 0.228699997f, 0.0174000002f, 0.33039999f, 0.472000003f, -0.817300022f,
+	0.103758f, 0.838729978f, -0.0399800017f, 0.2139f, 0.0208000001f, 0.335599989f, 0.409999996f, -0.848100007f,
+	0.0832559988f, 0.858021021f, -0.0392859988f, 0.213799998f, 0.0329999998f, 0.351000011f, 0.403400004f, -0.845000029f,
+	0.0868960023f, 0.833433986f, -0.0479569994f, 0.206300005f, 0.0242999997f, 0.305599988f, 0.356599987f, -0.882799983f,
+	0.131793007f, 0.916468024f, 0.0304780006f, 0.25819999f, 0.0370999984f, 0.603699982f, 0.710300028f, -0.361999989f,
+	0.168323994f, 0.881820977f, 0.0224179998f, 0.257099986f, 0.0149999997f, 0.565900028f, 0.698599994f, -0.437900007f,
+	0.134609997f, 0.918052971f, 0.053975001f, 0.268099993f, 0.0377999991f, 0.657000005f, 0.744499981f, 0.118699998f,
+	0.176456004f, 0.881605983f, 0.0509250015f, 0.270000011f, 0.0137999998f, 0.669700027f, 0.709999979f, 0.217700005f,
+	0.172901005f, 0.88340801f, 0.0428030007f, 0.266200006f, 0.0149999997f, 0.646099985f, 0.749300003f, -0.145199999f,
+	0.131363004f, 0.908369005f, 0.0771780014f, 0.278899997f, 0.0375999995f, 0.584699988f, 0.596899986f, 0.549399972f,
+	-0.116913997f, 0.81439501f, 0.122366004f, 0.464300007f, 0.176400006f, -0.0498000011f, 0.540099978f, 0.84009999f,
+	-0.0772640035f, 0.799160004f, 0.135657996f, 0.469799995f, 0.157199994f, -0.0820000023f, 0.5255f, 0.846800029f,
+	-0.0880139992f, 0.811546981f, 0.126930997f, 0.471500009f, 0.165399998f, -0.0813999996f, 0.528699994f, 0.844900012f,
+	-0.113640003f, 0.822704017f, 0.117181003f, 0.468499988f, 0.178200006f, -0.0322999991f, 0.545000017f, 0.837800026f,
+	-0.144188002f, 0.835646987f, 0.108792998f, 0.464300007f, 0.193000004f, -0.0013f, 0.619599998f, 0.78490001f,
+	-0.136207998f, 0.840604007f, 0.104796998f, 0.468800008f, 0.192300007f, 0.000300000014f, 0.617900014f, 0.786199987f,
+	-0.173847005f, 0.862152994f, 0.0851449966f, 0.467000008f, 0.213499993f, -0.162100002f, 0.698899984f, 0.69660002f,
+	-0.164606005f, 0.868561983f, 0.0814440027f, 0.472200006f, 0.212599993f, -0.210500002f, 0.698499978f, 0.684000015f,
+	-0.173002005f, 0.878521979f, 0.0627740026f, 0.475899994f, 0.222100005f, -0.231900007f, 0.88410002f, 0.405699998f,
+	-0.185765997f, 0.874008f, 0.0661730021f, 0.470099986f, 0.224399999f, -0.198300004f, 0.882300019f, 0.426899999f,
+	-0.188434005f, 0.879311025f, 0.042764999f, 0.476000011f, 0.233500004f, -0.279799998f, 0.958199978f, 0.0592f,
+	-0.17475f, 0.883328974f, 0.0430309996f, 0.481099993f, 0.229699999f, -0.276800007f, 0.960500002f, 0.0287999995f,
+	-0.180427998f, 0.877388f, 0.0173199996f, 0.485300004f, 0.240999997f, -0.204600006f, 0.922500014f, -0.327399999f,
+	-0.165869996f, 0.881599009f, 0.0200900007f, 0.490099996f, 0.236000001f, -0.187099993f, 0.9023f, -0.388300002f,
+	-0.149112001f, 0.868040979f, -0.004526f, 0.502699971f, 0.243499994f, -0.0485000014f, 0.8301f, -0.555499971f,
+	-0.157866001f, 0.86469698f, -0.00869700033f, 0.50029999f, 0.247500002f, -0.0590999983f, 0.835799992f, -0.545899987f,
+	-0.138834f, 0.851675987f, -0.0267440006f, 0.512499988f, 0.252200007f, 0.0819000006f, 0.803200006f, -0.589999974f,
+	-0.129685998f, 0.853986025f, -0.0221059993f, 0.515100002f, 0.248300001f, 0.0854000002f, 0.793299973f, -0.602800012f,
+	-0.108502999f, 0.833047986f, -0.0448919982f, 0.530099988f, 0.255800009f, -0.0819000006f, 0.708599985f, -0.700900018f,
+	-0.103758f, 0.838729978f, -0.0399800017f, 0.530300021f, 0.251899987f, -0.0992000028f, 0.69690001f, -0.710300028f,
+	-0.0868960023f, 0.833433986f, -0.0479569994f, 0.538999975f, 0.251899987f, -0.111199997f, 0.710799992f, -0.694500029f,
+	-0.0812380016f, 0.824496984f, -0.058056999f, 0.544099987f, 0.256000012f, -0.111000001f, 0.712599993f, -0.692700028f,
+	-0.0280809999f, 0.901315987f, 0.0122880004f, 0.225099996f, 0.367300004f, 0.208900005f, 0.900600016f, -0.381099999f,
+	-0.0327589996f, 0.90942198f, 0.0309030004f, 0.2271f, 0.376300007f, 0.219400004f, 0.947399974f, -0.233099997f,
+	-0.0f, 0.902233005f, 0.0329059996f, 0.211899996f, 0.3759f, -0.00300000003f, 0.973200023f, -0.230000004f,
+	-0.0f, 0.896713972f, 0.0160579998f, 0.212099999f, 0.367599994f, 0.00270000007f, 0.914399981f, -0.404900014f,
+	-0.0198090002f, 0.886995971f, -0.0119909998f, 0.221799999f, 0.354600012f, 0.27790001f, 0.792900026f, -0.542299986f,
+	-0.0305850003f, 0.910768986f, 0.0454120003f, 0.225899994f, 0.382699996f, 0.212799996f, 0.972000003f, -0.0997999981f,
+	-0.0f, 0.90417999f, 0.0464439988f, 0.211700007f, 0.382200003f, -0.00200000009f, 0.994099975f, -0.1083f,
+	0.0305840001f, 0.910768986f, 0.0454120003f, 0.197500005f, 0.381900012f, -0.212300003f, 0.971499979f, -0.1052f,
+	0.0327589996f, 0.90942198f, 0.0309030004f, 0.196700007f, 0.375400007f, -0.214499995f, 0.950100005f, -0.226500005f,
+	-0.0f, 0.881376028f, -0.00985400006f, 0.212500006f, 0.353799999f, 0.0260000005f, 0.799899995f, -0.5995f,
+	0.0280809999f, 0.901315987f, 0.0122880004f, 0.199200004f, 0.366600007f, -0.215000004f, 0.890500009f, -0.400999993f,
+	-0.00969099998f, 0.870092988f, -0.0238889996f, 0.216900006f, 0.345499992f, 0.297199994f, 0.662100017f, -0.687900007f,
+	-0.0155109996f, 0.871927023f, -0.0286490005f, 0.220200002f, 0.344399989f, 0.584599972f, 0.671000004f, -0.456099987f,
+	-0.0f, 0.869183004f, -0.0235590003f, 0.212699994f, 0.345400006f, 0.0452000014f, 0.71420002f, -0.698400021f,
+	0.0198090002f, 0.886995971f, -0.0119909998f, 0.203099996f, 0.354200006f, -0.318500012f, 0.79549998f, -0.515399992f,
+	0.00969099998f, 0.870092988f, -0.0238889996f, 0.208399996f, 0.345299989f, -0.346500009f, 0.711300015f, -0.611599982f,
+	0.0155100003f, 0.871927023f, -0.0286490005f, 0.2051f, 0.344000012f, -0.584599972f, 0.671000004f, -0.456099987f,
+	-0.0f, 0.905682027f, 0.0644700006f, 0.211500004f, 0.390399992f, -0.00689999992f, 0.997099996f, -0.0756999999f,
+	0.0177590009f, 0.908704996f, 0.0592270009f, 0.203400001f, 0.388099998f, -0.171200007f, 0.985199988f, -0.0118000004f,
+	-0.0177590009f, 0.908704996f, 0.0592270009f, 0.219699994f, 0.388599992f, 0.204699993f, 0.976899981f, -0.0615000017f,
+	0.190919995f, 0.817399025f, 0.0266810004f, 0.0588999987f, 0.101199999f, 0.864899993f, 0.4472f, -0.227799997f,
+	0.171421006f, 0.820327997f, 0.00329599995f, 0.0454000011f, 0.0938000008f, 0.643700004f, 0.455300003f, -0.615100026f,
+	0.158473998f, 0.848273993f, 0.0108080003f, 0.0368999988f, 0.105400003f, 0.604200006f, 0.519800007f, -0.603999972f,
+	0.176262006f, 0.850022972f, 0.0333530009f, 0.0474000014f, 0.112599999f, 0.792599976f, 0.58160001f, -0.182999998f,
+	0.188834995f, 0.814899027f, 0.0529690012f, 0.066399999f, 0.112599999f, 0.855199993f, 0.349900007f, 0.382400006f,
+	0.141021997f, 0.841623008f, -0.00668699993f, 0.0277999993f, 0.0983000025f, 0.532299995f, 0.435900003f, -0.725700021f,
+	0.140304998f, 0.827305973f, -0.0145800002f, 0.0283000004f, 0.0908999965f, 0.529100001f, 0.389200002f, -0.754000008f,
+	0.155295998f, 0.872451007f, 0.0416180007f, 0.0379999988f, 0.122599997f, 0.637700021f, 0.769800007f, -0.0263999999f,
+	0.145235002f, 0.869531989f, 0.0168760009f, 0.0297999997f, 0.114600003f, 0.565699995f, 0.671899974f, -0.478199989f,
+	0.154739007f, 0.861823976f, 0.068223998f, 0.0467999987f, 0.131099999f, 0.620999992f, 0.5801f, 0.527199984f,
+	0.174107999f, 0.842051029f, 0.0600630008f, 0.0555000007f, 0.121699996f, 0.775600016f, 0.414400011f, 0.476099998f,
+	0.158975005f, 0.827229977f, 0.078896001f, 0.0627999976f, 0.131999999f, 0.597500026f, 0.229800001f, 0.76819998f,
+	0.167376995f, 0.810957015f, 0.0774220005f, 0.0702999979f, 0.128099993f, 0.637099981f, 0.263300002f, 0.724399984f,
+	0.143592f, 0.843111992f, 0.0860349983f, 0.055399999f, 0.139799997f, 0.528100014f, 0.273099989f, 0.804099977f,
+	0.127103001f, 0.875939012f, 0.0766469985f, 0.0381999984f, 0.142499998f, 0.447600007f, 0.6778f, 0.583299994f,
+	0.121128999f, 0.854849994f, 0.0939740017f, 0.0483999997f, 0.149900004f, 0.424400002f, 0.39230001f, 0.816100001f,
+	0.128756002f, 0.888917983f, 0.0506549999f, 0.0287999995f, 0.133499995f, 0.451900005f, 0.878499985f, 0.154699996f,
+	0.130694002f, 0.860830009f, -0.00224100007f, 0.0218000002f, 0.106799997f, 0.48120001f, 0.54339999f, -0.687900007f,
+	0.121799f, 0.888391018f, 0.0239070002f, 0.0203000009f, 0.124700002f, 0.394600004f, 0.853100002f, -0.341300011f,
+	0.100817002f, 0.897126973f, 0.0321139991f, 0.0131999999f, 0.1329f, 0.287400007f, 0.942700028f, -0.169599995f,
+	0.101195f, 0.895018995f, 0.0585989989f, 0.0208999999f, 0.143800005f, 0.303499997f, 0.915199995f, 0.264999986f,
+	0.100461997f, 0.884540021f, 0.0841389969f, 0.0309999995f, 0.153400004f, 0.393400013f, 0.714600027f, 0.578499973f,
+	0.104276001f, 0.856544018f, 0.101098001f, 0.0461999997f, 0.158000007f, 0.391200006f, 0.411900014f, 0.823000014f,
+	0.114488997f, 0.828450978f, 0.104971997f, 0.0603f, 0.156100005f, 0.455300003f, 0.197500005f, 0.868099988f,
+	0.129293993f, 0.815638006f, 0.0981229991f, 0.0671999976f, 0.148900002f, 0.484400004f, 0.168699995f, 0.858399987f,
+	0.143056005f, 0.811200976f, 0.0931669995f, 0.070100002f, 0.141800001f, 0.443800002f, 0.308400005f, 0.841400027f,
+	0.117128998f, 0.876973987f, 0.002415f, 0.0154999997f, 0.114600003f, 0.459399998f, 0.680100024f, -0.571399987f,
+	0.102964997f, 0.882559001f, -0.00088800001f, 0.00870000012f, 0.116499998f, 0.415300012f, 0.741299987f, -0.5273f,
+	0.105324998f, 0.864775002f, -0.0138929999f, 0.00899999961f, 0.105999999f, 0.478899986f, 0.500699997f, -0.721099973f,
+	0.1127f, 0.849355996f, -0.0188359991f, 0.0130000003f, 0.0984999985f, 0.392800003f, 0.524900019f, -0.755100012f,
+	0.120673999f, 0.838371992f, -0.0228899997f, 0.0171000008f, 0.0930000022f, 0.457899988f, 0.471199989f, -0.753899992f,
+	-0.190919995f, 0.817399025f, 0.0266810004f, 0.0588999987f, 0.179100007f, -0.864899993f, 0.4472f, -0.227799997f,
+	-0.176262006f, 0.850022972f, 0.0333530009f, 0.0474000014f, 0.190500006f, -0.792599976f, 0.58160001f, -0.182999998f,
+	-0.158473998f, 0.848273993f, 0.0108080003f, 0.0368999988f, 0.183300003f, -0.604200006f, 0.519800007f, -0.603999972f,
+	-0.171421006f, 0.820327997f, 0.00329599995f, 0.0454000011f, 0.171700001f, -0.643700004f, 0.455300003f, -0.615100026f,
+	-0.188834995f, 0.814899027f, 0.0529690012f, 0.066399999f, 0.190500006f, -0.855199993f, 0.349900007f, 0.382400006f,
+	-0.155295998f, 0.872451007f, 0.0416180007f, 0.0379999988f, 0.200599998f, -0.637700021f, 0.769800007f, -0.0263999999f,
+	-0.154739007f, 0.861823976f, 0.068223998f, 0.0467999987f, 0.209000006f, -0.620999992f, 0.5801f, 0.527199984f,
+	-0.174107999f, 0.842051029f, 0.0600630008f, 0.0555000007f, 0.199599996f, -0.775600016f, 0.414400011f, 0.476099998f,
+	-0.145235002f, 0.869531989f, 0.0168760009f, 0.0297999997f, 0.192499995f, -0.565699995f, 0.671899974f, -0.478199989f,
+	-0.141021997f, 0.841623008f, -0.00668699993f, 0.0277999993f, 0.176300004f, -0.532299995f, 0.435900003f, -0.725700021f,
+	-0.140304998f, 0.827305973f, -0.0145800002f, 0.0283000004f, 0.168799996f, -0.529100001f, 0.389200002f, -0.754000008f,
+	-0.130694002f, 0.860830009f, -0.00224100007f, 0.0218000002f, 0.184699997f, -0.48120001f, 0.54339999f, -0.687900007f,
+	-0.120673999f, 0.838371992f, -0.0228899997f, 0.0171000008f, 0.170900002f, -0.457899988f, 0.471199989f, -0.753899992f,
+	-0.128756002f, 0.888917983f, 0.0506549999f, 0.0287999995f, 0.211400002f, -0.451900005f, 0.878499985f, 0.154699996f,
+	-0.121799f, 0.888391018f, 0.0239070002f, 0.0203000009f, 0.202600002f, -0.394600004f, 0.853100002f, -0.341300011f,
+	-0.127103001f, 0.875939012f, 0.0766469985f, 0.0381999984f, 0.220400006f, -0.447600007f, 0.6778f, 0.583299994f,
+	-0.143592f, 0.843111992f, 0.0860349983f, 0.055399999f, 0.217700005f, -0.528100014f, 0.273099989f, 0.804099977f,
+	-0.121128999f, 0.854849994f, 0.0939740017f, 0.0483999997f, 0.227799997f, -0.424400002f, 0.39230001f, 0.816100001f,
+	-0.158975005f, 0.827229977f, 0.078896001f, 0.0627999976f, 0.209999993f, -0.597500026f, 0.229800001f, 0.76819998f,
+	-0.129293993f, 0.815638006f, 0.0981229991f, 0.0671999976f, 0.226799995f, -0.484400004f, 0.168699995f, 0.858399987f,
+	-0.114488997f, 0.828450978f, 0.104971997f, 0.0603f, 0.234099999f, -0.455300003f, 0.197500005f, 0.868099988f,
+	-0.104276001f, 0.856544018f, 0.101098001f, 0.0461999997f, 0.2359f, -0.391200006f, 0.411900014f, 0.823000014f,
+	-0.101195f, 0.895018995f, 0.0585989989f, 0.0208999999f, 0.221699998f, -0.303499997f, 0.915199995f, 0.264999986f,
+	-0.100461997f, 0.884540021f, 0.0841389969f, 0.0309999995f, 0.231299996f, -0.393400013f, 0.714600027f, 0.578499973f,
+	-0.100817002f, 0.897126973f, 0.0321139991f, 0.0131999999f, 0.210899994f, -0.287400007f, 0.942700028f, -0.169599995f,
+	-0.117128998f, 0.876973987f, 0.002415f, 0.0154999997f, 0.192499995f, -0.459399998f, 0.680100024f, -0.571399987f,
+	-0.102964997f, 0.882559001f, -0.00088800001f, 0.00870000012f, 0.194399998f, -0.415300012f, 0.741299987f, -0.5273f,
+	-0.105324998f, 0.864775002f, -0.0138929999f, 0.00899999961f, 0.184f, -0.478899986f, 0.500699997f, -0.721099973f,
+	-0.1127f, 0.849355996f, -0.0188359991f, 0.0130000003f, 0.176400006f, -0.392800003f, 0.524900019f, -0.755100012f,
+	-0.143056005f, 0.811200976f, 0.0931669995f, 0.070100002f, 0.219699994f, -0.443800002f, 0.308400005f, 0.841400027f,
+	-0.167376995f, 0.810957015f, 0.0774220005f, 0.0702999979f, 0.206f, -0.637099981f, 0.263300002f, 0.724399984f,
+	-0.00969099998f, 0.870092988f, -0.0238889996f, 0.469300002f, 0.474099994f, 0.131999999f, 0.975600004f, 0.175300002f,
+	-0.0f, 0.869183004f, -0.0235590003f, 0.464899987f, 0.47420001f, -0.0200999994f, 0.992500007f, 0.120700002f,
+	-0.0f, 0.869835019f, -0.0297519993f, 0.464899987f, 0.471399993f, -0.0165999997f, 0.992699981f, 0.1197f,
+	-0.0155109996f, 0.871927023f, -0.0286490005f, 0.472000003f, 0.471899986f, 0.144800007f, 0.969699979f, 0.196799994f,
+	0.0155100003f, 0.871927023f, -0.0286490005f, 0.457800001f, 0.471599996f, -0.111599997f, 0.976199985f, 0.186199993f,
+	0.00969099998f, 0.870092988f, -0.0238889996f, 0.460500002f, 0.47389999f, -0.0807000026f, 0.959200025f, 0.270999998f,
+	0.180607006f, 0.878477991f, 0.0483129993f, 0.326200008f, 0.0137f, 0.450100005f, 0.691399992f, 0.565199971f,
+	0.187013f, 0.867810011f, 0.0483359993f, 0.321099997f, 0.0119000003f, 0.619700015f, 0.373600006f, 0.690199971f,
+	0.187989995f, 0.875773013f, 0.0431470014f, 0.322699994f, 0.0156999994f, 0.619199991f, 0.403200001f, 0.673799992f,
+	0.185007006f, 0.87956202f, 0.0433069989f, 0.324699998f, 0.0162000004f, 0.513000011f, 0.626699984f, 0.586600006f,
+	0.172901005f, 0.88340801f, 0.0428030007f, 0.330199987f, 0.0159000009f, 0.259499997f, 0.871299982f, 0.416599989f,
+	-0.0312070008f, 0.824925005f, -0.0598709993f, 0.277200013f, 0.388999999f, -0.728999972f, 0.229499996f, -0.644900024f,
+	-0.026935f, 0.82534802f, -0.064538002f, 0.275700003f, 0.391400009f, -0.725000024f, 0.231000006f, -0.648899972f,
+	-0.0359110013f, 0.784107029f, -0.068204999f, 0.261299998f, 0.378600001f, -0.75849998f, 0.216499999f, -0.614600003f,
+	-0.0387759991f, 0.787706971f, -0.0635470003f, 0.264099985f, 0.377700001f, -0.751299977f, 0.210999995f, -0.62529999f,
+	-0.0316069983f, 0.848169029f, -0.050675001f, 0.287900001f, 0.39289999f, -0.685199976f, 0.307000011f, -0.660399973f,
+	-0.0283470005f, 0.851198018f, -0.0526099987f, 0.288100004f, 0.395099998f, -0.677900016f, 0.329600006f, -0.657100022f,
+	-0.037016999f, 0.872690976f, -0.0310520008f, 0.302300006f, 0.393400013f, -0.601300001f, 0.464399993f, -0.650200009f,
+	-0.0311580002f, 0.87707299f, -0.0332549997f, 0.302700013f, 0.396800011f, -0.601999998f, 0.467200011f, -0.647599995f,
+	-0.0401719995f, 0.887338996f, -0.0162719991f, 0.31189999f, 0.393099993f, -0.659699976f, 0.461400002f, -0.593200028f,
+	-0.0360779986f, 0.891546011f, -0.0176330004f, 0.312599987f, 0.395799994f, -0.660600007f, 0.464599997f, -0.5898f,
+	-0.0488720015f, 0.901863992f, 0.00616100011f, 0.324099988f, 0.389499992f, -0.657100022f, 0.605099976f, -0.449499995f,
+	-0.0430799983f, 0.907396019f, 0.00525799999f, 0.325300008f, 0.393000007f, -0.668200016f, 0.598999977f, -0.441300005f,
+	-0.0516100004f, 0.911669016f, 0.032869f, 0.336600006f, 0.386000007f, -0.845200002f, 0.517400026f, -0.134100005f,
+	-0.0479910001f, 0.917016029f, 0.0309679992f, 0.337300003f, 0.388900012f, -0.843100011f, 0.5097f, -0.171599999f,
+	-0.0478879996f, 0.912289023f, 0.0585910007f, 0.347299993f, 0.381000012f, -0.768400013f, 0.412400007f, 0.489399999f,
+	-0.0461019985f, 0.918967009f, 0.0557690002f, 0.3477f, 0.384299994f, -0.827799976f, 0.401800007f, 0.391600013f,
+	-0.0263100006f, 0.908200979f, 0.0789280012f, 0.360199988f, 0.376599997f, -0.394699991f, 0.335999995f, 0.855199993f,
+	-0.0249620005f, 0.918026984f, 0.0755510032f, 0.360500008f, 0.381399989f, -0.448199987f, 0.344900012f, 0.824699998f,
+	-0.0f, 0.913836002f, 0.0823530033f, 0.372200012f, 0.379299998f, 0.0304000005f, 0.200599998f, 0.979200006f,
+	-0.0f, 0.904209971f, 0.0841339976f, 0.372399986f, 0.374900013f, 0.0214000009f, 0.202900007f, 0.978999972f,
+	0.0249610003f, 0.918026984f, 0.0755510032f, 0.383700013f, 0.382299989f, 0.416900009f, 0.33860001f, 0.843500018f,
+	0.0263100006f, 0.908200979f, 0.0789280012f, 0.38440001f, 0.377600014f, 0.358700007f, 0.347000003f, 0.866599977f,
+	0.0478870012f, 0.912289023f, 0.0585910007f, 0.396899998f, 0.383100003f, 0.791800022f, 0.412299991f, 0.450599998f,
+	0.0461010002f, 0.918967009f, 0.0557690002f, 0.396200001f, 0.386400014f, 0.860700011f, 0.375499994f, 0.343800008f,
+	0.0479900017f, 0.917016029f, 0.0309679992f, 0.406100005f, 0.391900003f, 0.842499971f, 0.527199984f, -0.111100003f,
+	0.0516100004f, 0.911669016f, 0.032869f, 0.407099992f, 0.388999999f, 0.837199986f, 0.542699993f, -0.0676999986f,
+	0.0488720015f, 0.901863992f, 0.00616100011f, 0.419200003f, 0.393599987f, 0.657400012f, 0.583299994f, -0.476999998f,
+	0.043079f, 0.907396019f, 0.00525799999f, 0.417699993f, 0.397000015f, 0.650200009f, 0.594200015f, -0.473399997f,
+	0.0401710011f, 0.887338996f, -0.0162719991f, 0.431100011f, 0.398299992f, 0.667200029f, 0.474599987f, -0.574100018f,
+	0.0360779986f, 0.891546011f, -0.0176330004f, 0.430200011f, 0.400900006f, 0.667400002f, 0.475499988f, -0.573199987f,
+	0.037016999f, 0.872690976f, -0.0310520008f, 0.440600008f, 0.399300009f, 0.595600009f, 0.451499999f, -0.664399981f,
+	0.031157f, 0.87707299f, -0.0332549997f, 0.439900011f, 0.402700007f, 0.59799999f, 0.455300003f, -0.659600019f,
+	0.0316069983f, 0.848169029f, -0.050675001f, 0.455000013f, 0.400099993f, 0.674399972f, 0.315699995f, -0.667500019f,
+	0.0283470005f, 0.851198018f, -0.0526099987f, 0.454699993f, 0.402200013f, 0.694500029f, 0.330599993f, -0.639100015f,
+	0.0312070008f, 0.824925005f, -0.0598709993f, 0.465999991f, 0.397100002f, 0.724799991f, 0.235300004f, -0.647499979f,
+	0.0269339997f, 0.82534802f, -0.064538002f, 0.467299998f, 0.399599999f, 0.728600025f, 0.233400002f, -0.643899977f,
+	0.0387759991f, 0.787706971f, -0.0635470003f, 0.480100006f, 0.386999995f, 0.748099983f, 0.229000002f, -0.622900009f,
+	0.0359099992f, 0.784107029f, -0.068204999f, 0.482800007f, 0.388200015f, 0.737600029f, 0.232999995f, -0.63380003f,
+	0.049637001f, 0.759334028f, -0.0597640015f, 0.488799989f, 0.376199991f, 0.872699976f, 0.280800015f, -0.399300009f,
+	0.0501459986f, 0.751406014f, -0.0642260015f, 0.492799997f, 0.375400007f, 0.845600009f, 0.273400009f, -0.458499998f,
+	-2.30000005e-05f, 0.851688027f, -0.141606003f, 0.982800007f, 0.260399997f, 0.0142999999f, 0.840499997f, 0.541700006f,
+	-5.40000001e-05f, 0.854080021f, -0.146359995f, 0.982800007f, 0.25819999f, 0.000500000024f, 0.997500002f, 0.0710000023f,
+	-0.00322000007f, 0.851530015f, -0.142609f, 0.984399974f, 0.259900004f, -0.362599999f, 0.831499994f, 0.421000004f,
+	-0.00653799996f, 0.848572016f, -0.140183002f, 0.986299992f, 0.261000007f, -0.427599996f, 0.812699974f, 0.395900011f,
+	-0.0f, 0.848627985f, -0.137474999f, 0.983099997f, 0.262600005f, 0.00400000019f, 0.806599975f, 0.591000021f,
+	0.00370400003f, 0.851749003f, -0.143437997f, 0.981000006f, 0.259600013f, 0.420700014f, 0.841000021f, 0.340000004f,
+	-0.00481900014f, 0.851818979f, -0.146359995f, 0.985000014f, 0.258100003f, -0.553900003f, 0.829900026f, 0.0671999976f,
+	-0.00924799964f, 0.848452985f, -0.146721005f, 0.987399995f, 0.257499993f, -0.591499984f, 0.806100011f, -0.0205000006f,
+	-0.0037440001f, 0.852052987f, -0.149975002f, 0.984399974f, 0.256399989f, -0.471100003f, 0.816699982f, -0.333200008f,
+	-0.00654199999f, 0.848218024f, -0.153263003f, 0.985800028f, 0.254299998f, -0.449800014f, 0.764999986f, -0.460900009f,
+	-0.000633999996f, 0.852306008f, -0.151566997f, 0.98299998f, 0.255800009f, -0.0780000016f, 0.830299973f, -0.551800013f,
+	-0.0f, 0.848159015f, -0.155974001f, 0.982299984f, 0.253199995f, -9.99999975e-05f, 0.742200017f, -0.67019999f,
+	0.00334400008f, 0.852115989f, -0.150300995f, 0.98119998f, 0.256399989f, 0.386000007f, 0.8398f, -0.381799996f,
+	0.00654199999f, 0.848218024f, -0.153263003f, 0.979200006f, 0.254900008f, 0.459399998f, 0.747799993f, -0.479200006f,
+	0.00488999998f, 0.851656973f, -0.147202f, 0.980400026f, 0.257800013f, 0.548300028f, 0.836300015f, -9.99999975e-05f,
+	0.00924899988f, 0.848389983f, -0.146721005f, 0.977999985f, 0.258300006f, 0.610800028f, 0.791800022f, -0.00430000015f,
+	0.00653799996f, 0.848571002f, -0.140183002f, 0.979700029f, 0.261500001f, 0.425799996f, 0.810800016f, 0.40169999f,
+	0.00801900029f, 0.850596011f, -0.154673994f, 0.969600022f, 0.282799989f, 0.119900003f, 0.98119998f, -0.1514f,
+	0.0111830002f, 0.850591004f, -0.146629006f, 0.966000021f, 0.281300008f, 0.2333f, 0.971700013f, 0.0379999988f,
+	0.0146770002f, 0.849761009f, -0.146449f, 0.965900004f, 0.279700011f, 0.223199993f, 0.973699987f, 0.0460000001f,
+	0.0106960004f, 0.849929988f, -0.156973004f, 0.970700026f, 0.281599998f, 0.119800001f, 0.984000027f, -0.132100001f,
+	3.30000003e-05f, 0.850022972f, -0.158426002f, 0.971300006f, 0.28639999f, 0.0168999992f, 0.988900006f, -0.147799999f,
+	0.00739700021f, 0.850225985f, -0.138787001f, 0.962400019f, 0.282900006f, 0.209099993f, 0.951200008f, 0.226899996f,
+	0.00990399998f, 0.849063993f, -0.136272997f, 0.961199999f, 0.281699985f, 0.206900001f, 0.951799989f, 0.226300001f,
+	-0.000117000003f, 0.850560009f, -0.136049002f, 0.961099982f, 0.286300004f, 0.0329999998f, 0.965900004f, 0.256599993f,
+	-7.00000019e-05f, 0.849515021f, -0.132230997f, 0.959399998f, 0.286300004f, 0.0395999998f, 0.963f, 0.2667f,
+	-0.00776699977f, 0.850584984f, -0.138958007f, 0.962400019f, 0.289799988f, -0.0992999971f, 0.986199975f, 0.132300004f,
+	-0.0105299996f, 0.849964976f, -0.136610001f, 0.961300015f, 0.291099995f, -0.109300002f, 0.983399987f, 0.144899994f,
+	-0.011008f, 0.850583971f, -0.147162005f, 0.966099977f, 0.291399986f, -0.102600001f, 0.993900001f, -0.0403999984f,
+	-0.0147620002f, 0.85026598f, -0.147055f, 0.966000021f, 0.293099999f, -0.0943000019f, 0.995199978f, -0.0275999997f,
+	-0.00782699976f, 0.850592017f, -0.154622003f, 0.969500005f, 0.289999992f, -0.193499997f, 0.963699996f, -0.183899999f,
+	-0.0102779996f, 0.849543989f, -0.157272995f, 0.970700026f, 0.291099995f, -0.169f, 0.965799987f, -0.196500003f,
+	1.80000006e-05f, 0.84958303f, -0.161532f, 0.9727f, 0.28639999f, -0.00190000003f, 0.987200022f, -0.159600005f,
+	-0.0367190018f, 0.814215004f, -0.140313998f, 0.146799996f, 0.271899998f, -0.0370999984f, 0.749100029f, -0.661499977f,
+	-0.0425890014f, 0.803160012f, -0.156826004f, 0.141299993f, 0.279500008f, -0.4454f, 0.809099972f, -0.383300006f,
+	-0.0476589985f, 0.801846981f, -0.153705999f, 0.1391f, 0.277799994f, -0.353500009f, 0.813199997f, -0.462300003f,
+	-0.0436809994f, 0.814132988f, -0.141302004f, 0.143700004f, 0.271100014f, 0.0935000032f, 0.692200005f, -0.715600014f,
+	0.00654199999f, 0.848218024f, -0.153263003f, 0.961799979f, 0.296200007f, -0.538999975f, 0.651899993f, 0.533399999f,
+	0.00924899988f, 0.848389983f, -0.146721005f, 0.960600019f, 0.299400002f, -0.75120002f, 0.660000026f, -0.00620000018f,
+	0.0111830002f, 0.850591004f, -0.146629006f, 0.959399998f, 0.299800009f, -0.751299977f, 0.659799993f, -0.0116999997f,
+	0.00801900029f, 0.850596011f, -0.154673994f, 0.960500002f, 0.29550001f, -0.546000004f, 0.669099987f, 0.504100025f,
+	-0.0f, 0.848159015f, -0.155974001f, 0.964699984f, 0.294699997f, -0.0346999988f, 0.783200026f, 0.620800018f,
+	0.00653799996f, 0.848571002f, -0.140183002f, 0.961899996f, 0.302599996f, -0.519900024f, 0.681999981f, -0.514299989f,
+	0.00739700021f, 0.850225985f, -0.138787001f, 0.961600006f, 0.303600013f, -0.464399993f, 0.699699998f, -0.542900026f,
+	-0.0f, 0.848627985f, -0.137474999f, 0.964999974f, 0.3037f, -0.0201999992f, 0.597100019f, -0.801900029f,
+	-0.000117000003f, 0.850560009f, -0.136049002f, 0.965399981f, 0.304699987f, 0.0120999999f, 0.608799994f, -0.793200016f,
+	-0.00653799996f, 0.848572016f, -0.140183002f, 0.967899978f, 0.30219999f, 0.542400002f, 0.647700012f, -0.535099983f,
+	-0.00776699977f, 0.850584984f, -0.138958007f, 0.968999982f, 0.3028f, 0.539699972f, 0.648599982f, -0.53670001f,
+	-0.00924799964f, 0.848452985f, -0.146721005f, 0.968999982f, 0.298999995f, 0.779799998f, 0.624899983f, -0.0375000015f,
+	-0.011008f, 0.850583971f, -0.147162005f, 0.970200002f, 0.298500001f, 0.763300002f, 0.645500004f, 0.0269000009f,
+	-0.00654199999f, 0.848218024f, -0.153263003f, 0.967599988f, 0.296000004f, 0.582199991f, 0.635500014f, 0.507099986f,
+	-0.00782699976f, 0.850592017f, -0.154622003f, 0.968400002f, 0.294800013f, 0.585099995f, 0.624800026f, 0.51700002f,
+	3.30000003e-05f, 0.850022972f, -0.158426002f, 0.964399993f, 0.293300003f, -0.0210999995f, 0.779500008f, 0.625999987f,
+	-0.0942910016f, 0.81023699f, -0.106573999f, 0.144500002f, 0.386599988f, -0.192599997f, 0.894200027f, -0.404199988f,
+	-0.0908370018f, 0.812026024f, -0.10447f, 0.142900005f, 0.38530001f, -0.236300007f, 0.896600008f, -0.374500006f,
+	-0.0546090007f, 0.816160977f, -0.129393995f, 0.148100004f, 0.365999997f, -0.146799996f, 0.989199996f, 0.00139999995f,
+	-0.0625500008f, 0.815204978f, -0.129252002f, 0.149200007f, 0.369399995f, -0.118500002f, 0.991599977f, 0.0513000004f,
+	-0.132146999f, 0.824958026f, -0.0706859976f, 0.131600007f, 0.407400012f, -0.0215000007f, 0.916800022f, -0.398699999f,
+	-0.131600007f, 0.821362019f, -0.0792689994f, 0.135499999f, 0.406100005f, -0.00820000004f, 0.922100008f, -0.386900008f,
+	-0.000960999983f, 0.914286971f, 0.155880004f, 0.612299979f, 0.898500025f, 0.00109999999f, 0.4551f, 0.890399992f,
+	0.000959000026f, 0.914286017f, 0.155876994f, 0.613099992f, 0.898599982f, 0.00139999995f, 0.454899997f, 0.890500009f,
+	0.00128700002f, 0.918574989f, 0.154517993f, 0.612800002f, 0.900699973f, -9.99999975e-05f, 0.151800007f, 0.988399982f,
+	-0.00128600001f, 0.918574989f, 0.154516995f, 0.611699998f, 0.900600016f, -0.000300000014f, 0.151999995f, 0.988399982f,
+	-0.000690000015f, 0.91000402f, 0.159143999f, 0.612900019f, 0.896099985f, 0.00139999995f, 0.606299996f, 0.795300007f,
+	0.000688f, 0.91000402f, 0.159141004f, 0.613499999f, 0.896200001f, 0.00139999995f, 0.60619998f, 0.795300007f,
+	0.187189996f, 0.804762006f, 0.0103900004f, 0.372299999f, 0.0895999968f, 0.799700022f, 0.0294000003f, -0.599699974f,
+	0.186220005f, 0.813996971f, 0.00956400018f, 0.368099988f, 0.0894000009f, 0.773899972f, 0.0280000009f, -0.632700026f,
+	0.195724994f, 0.812008977f, 0.0258889999f, 0.369800001f, 0.0974999964f, 0.936399996f, 0.0142999999f, -0.350600004f,
+	0.195859f, 0.803425014f, 0.0254250001f, 0.373699993f, 0.0975999981f, 0.945500016f, 0.0322000012f, -0.324000001f,
+	0.172438994f, 0.806366026f, -0.00383100007f, 0.370599985f, 0.0800999999f, 0.64380002f, 0.0340999998f, -0.764400005f,
+	0.173204005f, 0.815909982f, -0.00272600004f, 0.36649999f, 0.0816000029f, 0.648199975f, 0.0269000009f, -0.760999978f,
+	0.156666994f, 0.807847977f, -0.0155429998f, 0.366400003f, 0.072300002f, 0.541599989f, -0.00520000001f, -0.840600014f,
+	0.157497004f, 0.818260014f, -0.015137f, 0.362199992f, 0.0742999986f, 0.540099978f, -0.0102000004f, -0.841600001f,
+	0.138200998f, 0.812170029f, -0.0249690004f, 0.361600012f, 0.0631999969f, 0.369899988f, 0.0107000005f, -0.92900002f,
+	0.142892003f, 0.822744012f, -0.0228649992f, 0.358200014f, 0.067400001f, 0.385199994f, 0.0168999992f, -0.922699988f,
+	0.119813003f, 0.837046981f, -0.0295599997f, 0.34740001f, 0.0614f, 0.119900003f, 0.0956000015f, -0.988200009f,
+	0.114201002f, 0.827929974f, -0.0310340002f, 0.34920001f, 0.0568999983f, 0.162499994f, 0.0755999982f, -0.983799994f,
+	0.109523997f, 0.849636018f, -0.0275010001f, 0.340299994f, 0.061900001f, 0.0722000003f, 0.241600007f, -0.967700005f,
+	0.100909002f, 0.846328974f, -0.0292760003f, 0.338400006f, 0.0579999983f, 0.0951000005f, 0.26699999f, -0.958999991f,
+	0.0942400023f, 0.863291025f, -0.0236740001f, 0.330799997f, 0.0632999986f, -0.0434000008f, 0.462500006f, -0.885500014f,
+	0.102507003f, 0.864728987f, -0.0234789997f, 0.333900005f, 0.0654999986f, -0.0671999976f, 0.415800005f, -0.907000005f,
+	0.0894050002f, 0.887139022f, -0.00476399995f, 0.323700011f, 0.0760999992f, -0.289299995f, 0.737100005f, -0.610800028f,
+	0.0970849991f, 0.889254987f, -0.00608099997f, 0.327199996f, 0.077200003f, -0.317200005f, 0.70599997f, -0.63319999f,
+	0.0871590003f, 0.901452005f, 0.0293439999f, 0.319700003f, 0.0932999998f, -0.521600008f, 0.822300017f, -0.227599993f,
+	0.0950289965f, 0.907193005f, 0.0315439999f, 0.323700011f, 0.0952999964f, -0.55339998f, 0.822600007f, -0.130799994f,
+	0.0896760002f, 0.901220024f, 0.0629900023f, 0.318800002f, 0.109399997f, -0.530300021f, 0.809700012f, 0.251100004f,
+	0.0953489989f, 0.904462993f, 0.0642590001f, 0.321700007f, 0.109499998f, -0.520399988f, 0.810500026f, 0.268900007f,
+	0.0887719989f, 0.885532022f, 0.0884890035f, 0.320100009f, 0.1237f, -0.458200008f, 0.631500006f, 0.625500023f,
+	0.0965079963f, 0.889989972f, 0.0896300003f, 0.323900014f, 0.122100003f, -0.455599993f, 0.665400028f, 0.591400027f,
+	0.0912209973f, 0.859221995f, 0.108484f, 0.324699998f, 0.138799995f, -0.136000007f, 0.328399986f, 0.934700012f,
+	0.0976750031f, 0.861566007f, 0.108470999f, 0.326999992f, 0.136800006f, -0.130600005f, 0.358999997f, 0.924199998f,
+	0.100789003f, 0.827219009f, 0.113343f, 0.337700009f, 0.148399994f, 0.0406000018f, -0.0155999996f, 0.999100029f,
+	0.109373003f, 0.831954002f, 0.11332f, 0.339100003f, 0.144099995f, 0.0250000004f, -0.0403000005f, 0.998899996f,
+	0.125590995f, 0.813260019f, 0.107437f, 0.350300014f, 0.144099995f, 0.2368f, -0.0876000002f, 0.967599988f,
+	0.117604002f, 0.805629015f, 0.108907998f, 0.350800008f, 0.149100006f, 0.239099994f, -0.0942000002f, 0.966400027f,
+	0.139369994f, 0.805503011f, 0.102681004f, 0.356700003f, 0.140699998f, 0.36590001f, -0.249899998f, 0.896499991f,
+	0.137362003f, 0.79599297f, 0.100327f, 0.360700011f, 0.1435f, 0.373400003f, -0.296400011f, 0.879000008f,
+	0.163985997f, 0.794156015f, 0.0850350037f, 0.368000001f, 0.130999997f, 0.571399987f, -0.131899998f, 0.810000002f,
+	0.167919993f, 0.805221975f, 0.0837249979f, 0.363900006f, 0.127299994f, 0.611699998f, -0.111699998f, 0.783200026f,
+	0.173107997f, 0.794614017f, 0.0777269974f, 0.369300008f, 0.125799999f, 0.665499985f, -0.0932999998f, 0.740499973f,
+	0.181842998f, 0.796338975f, 0.0696619973f, 0.370599985f, 0.120499998f, 0.72299999f, -0.151899993f, 0.673900008f,
+	0.184732005f, 0.807102025f, 0.0692109987f, 0.3662f, 0.117899999f, 0.756099999f, -0.153799996f, 0.636099994f,
+	0.194125995f, 0.798985004f, 0.0531819984f, 0.372900009f, 0.111000001f, 0.905099988f, -0.0962999985f, 0.414200008f,
+	0.194867998f, 0.809394002f, 0.0534409992f, 0.368200004f, 0.1096f, 0.915300012f, -0.0982000008f, 0.390700012f,
+	0.197949007f, 0.801783979f, 0.0387060009f, 0.373299986f, 0.104000002f, 0.994799972f, -0.0989999995f, 0.0253999997f,
+	0.199178994f, 0.810599983f, 0.0407340005f, 0.368999988f, 0.104000002f, 0.987100005f, -0.150399998f, 0.0549999997f,
+	-0.187189996f, 0.804762006f, 0.0103900004f, 0.251800001f, 0.254500002f, -0.799700022f, 0.0294000003f, -0.599699974f,
+	-0.195859f, 0.803425014f, 0.0254250001f, 0.253199995f, 0.262400001f, -0.945500016f, 0.0322000012f, -0.324000001f,
+	-0.195724994f, 0.812008977f, 0.0258889999f, 0.249300003f, 0.262300014f, -0.936399996f, 0.0142999999f, -0.350600004f,
+	-0.186220005f, 0.813996971f, 0.00956400018f, 0.247600004f, 0.254200011f, -0.773899972f, 0.0280000009f, -0.632700026f,
+	-0.172438994f, 0.806366026f, -0.00383100007f, 0.250099987f, 0.244900003f, -0.64380002f, 0.0340999998f, -0.764400005f,
+	-0.197949007f, 0.801783979f, 0.0387060009f, 0.252799988f, 0.26879999f, -0.994799972f, -0.0989999995f, 0.0253999997f,
+	-0.199178994f, 0.810599983f, 0.0407340005f, 0.248500004f, 0.26879999f, -0.987100005f, -0.150399998f, 0.0549999997f,
+	-0.194867998f, 0.809394002f, 0.0534409992f, 0.247700006f, 0.274399996f, -0.915300012f, -0.0982000008f, 0.390700012f,
+	-0.194125995f, 0.798985004f, 0.0531819984f, 0.252400011f, 0.27579999f, -0.905099988f, -0.0962999985f, 0.414200008f,
+	-0.184732005f, 0.807102025f, 0.0692109987f, 0.245700002f, 0.282700002f, -0.756099999f, -0.153799996f, 0.636099994f,
+	-0.181842998f, 0.796338975f, 0.0696630031f, 0.250099987f, 0.285299987f, -0.72299999f, -0.151899993f, 0.673900008f,
+	-0.167919993f, 0.805221975f, 0.0837249979f, 0.243399993f, 0.292100012f, -0.611699998f, -0.111699998f, 0.783200026f,
+	-0.173107997f, 0.794614017f, 0.0777269974f, 0.248799995f, 0.290699989f, -0.665499985f, -0.0932999998f, 0.740499973f,
+	-0.163985997f, 0.794156015f, 0.0850350037f, 0.247500002f, 0.2958f, -0.571399987f, -0.131899998f, 0.810000002f,
+	-0.139369994f, 0.805503011f, 0.102682002f, 0.236200005f, 0.305500001f, -0.36590001f, -0.249899998f, 0.896499991f,
+	-0.137362003f, 0.79599297f, 0.100327f, 0.240199998f, 0.308400005f, -0.373400003f, -0.296400011f, 0.879000008f,
+	-0.117604002f, 0.805629015f, 0.108907998f, 0.230299994f, 0.313899994f, -0.239099994f, -0.0942000002f, 0.966400027f,
+	-0.125590995f, 0.813260019f, 0.107437f, 0.229800001f, 0.308899999f, -0.2368f, -0.0876000002f, 0.967599988f,
+	-0.100789003f, 0.827219009f, 0.113343999f, 0.217199996f, 0.313199997f, -0.0406000018f, -0.0155999996f, 0.999100029f,
+	-0.109373003f, 0.831954002f, 0.11332f, 0.218600005f, 0.308999985f, -0.0250000004f, -0.0403000005f, 0.998899996f,
+	-0.0976750031f, 0.861566007f, 0.108470999f, 0.206499994f, 0.301600009f, 0.130600005f, 0.358999997f, 0.924199998f,
+	-0.0912209973f, 0.859221995f, 0.108484f, 0.2042f, 0.303600013f, 0.135900006f, 0.328399986f, 0.934700012f,
+	-0.0965079963f, 0.889989972f, 0.0896300003f, 0.203400001f, 0.286900014f, 0.455599993f, 0.665400028f, 0.591400027f,
+	-0.0887719989f, 0.885532022f, 0.0884890035f, 0.199599996f, 0.288500011f, 0.458200008f, 0.631500006f, 0.625500023f,
+	-0.0953489989f, 0.904462993f, 0.0642590001f, 0.201199993f, 0.274300009f, 0.520399988f, 0.810500026f, 0.268900007f,
+	-0.0896760002f, 0.901220024f, 0.0629900023f, 0.198300004f, 0.274199992f, 0.530300021f, 0.809700012f, 0.251100004f,
+	-0.0950289965f, 0.907193005f, 0.0315439999f, 0.203199998f, 0.260100007f, 0.55339998f, 0.822600007f, -0.130799994f,
+	-0.0871590003f, 0.901452005f, 0.0293439999f, 0.199200004f, 0.258100003f, 0.521600008f, 0.822300017f, -0.227599993f,
+	-0.0970849991f, 0.889254987f, -0.00608099997f, 0.206699997f, 0.241999999f, 0.317200005f, 0.70599997f, -0.63319999f,
+	-0.0894050002f, 0.887139022f, -0.00476399995f, 0.203199998f, 0.240899995f, 0.289299995f, 0.737100005f, -0.610800028f,
+	-0.102507003f, 0.864728987f, -0.0234789997f, 0.213400006f, 0.230299994f, 0.0671999976f, 0.415800005f, -0.907000005f,
+	-0.0942400023f, 0.863291025f, -0.0236740001f, 0.210299999f, 0.228100002f, 0.0434000008f, 0.462500006f, -0.885500014f,
+	-0.109523997f, 0.849636018f, -0.0275010001f, 0.219799995f, 0.226699993f, -0.0722000003f, 0.241600007f, -0.967700005f,
+	-0.100909002f, 0.846328974f, -0.0292760003f, 0.217899993f, 0.222800002f, -0.0951000005f, 0.26699999f, -0.958999991f,
+	-0.114201002f, 0.827929974f, -0.0310340002f, 0.228699997f, 0.221699998f, -0.162499994f, 0.0755999982f, -0.983799994f,
+	-0.119813003f, 0.837046981f, -0.0295599997f, 0.226899996f, 0.226199999f, -0.119900003f, 0.0956000015f, -0.988200009f,
+	-0.138200998f, 0.812170029f, -0.0249690004f, 0.241099998f, 0.228100002f, -0.369899988f, 0.0107000005f, -0.92900002f,
+	-0.142892003f, 0.822744012f, -0.0228649992f, 0.2377f, 0.232199997f, -0.385199994f, 0.0168999992f, -0.922699988f,
+	-0.156666994f, 0.807847977f, -0.0155429998f, 0.245900005f, 0.237100005f, -0.541599989f, -0.00520000001f, -0.840600014f,
+	-0.157497004f, 0.818260014f, -0.0151359998f, 0.241699994f, 0.239099994f, -0.540099978f, -0.0102000004f, -0.841600001f,
+	-0.173204005f, 0.815909982f, -0.00272600004f, 0.246000007f, 0.246399999f, -0.648199975f, 0.0269000009f, -0.760999978f,
+	0.186220005f, 0.813996971f, 0.00956400018f, 0.142399997f, 0.176100001f, 0.512099981f, 0.798099995f, -0.317600012f,
+	0.171421006f, 0.820327997f, 0.00329599995f, 0.136500001f, 0.171700001f, 0.473699987f, 0.784799993f, -0.399599999f,
+	0.190919995f, 0.817399025f, 0.0266810004f, 0.143000007f, 0.183799997f, 0.65170002f, 0.736400008f, -0.181899995f,
+	0.195724994f, 0.812008977f, 0.0258889999f, 0.146300003f, 0.183699995f, 0.717000008f, 0.668299973f, -0.198300004f,
+	0.173204005f, 0.815909982f, -0.00272600004f, 0.138699993f, 0.168899998f, 0.475699991f, 0.770399988f, -0.424400002f,
+	0.157497004f, 0.818260014f, -0.015137f, 0.132400006f, 0.162900001f, 0.423500001f, 0.815400004f, -0.394600004f,
+	0.140304998f, 0.827305973f, -0.0145800002f, 0.123999998f, 0.160899997f, 0.493299991f, 0.813199997f, -0.308899999f,
+	0.142892003f, 0.822744012f, -0.0228649992f, 0.126499996f, 0.157299995f, 0.49059999f, 0.819800019f, -0.295300007f,
+	0.120673999f, 0.838371992f, -0.0228899997f, 0.114299998f, 0.156200007f, 0.659600019f, 0.715499997f, -0.230299994f,
+	0.119813003f, 0.837046981f, -0.0295599997f, 0.114600003f, 0.153099999f, 0.657299995f, 0.716899991f, -0.2324f,
+	0.1127f, 0.849355996f, -0.0188359991f, 0.108099997f, 0.157900006f, 0.7852f, 0.559300005f, -0.265799999f,
+	0.109523997f, 0.849636018f, -0.0275010001f, 0.107199997f, 0.153799996f, 0.78670001f, 0.558700025f, -0.262800008f,
+	0.105324998f, 0.864775002f, -0.0138929999f, 0.100299999f, 0.1602f, 0.863499999f, 0.42050001f, -0.278400004f,
+	0.102507003f, 0.864728987f, -0.0234789997f, 0.0997999981f, 0.155699998f, 0.864700019f, 0.432000011f, -0.256300002f,
+	0.0970849991f, 0.889254987f, -0.00608099997f, 0.0886000022f, 0.163699999f, 0.828400016f, 0.480399996f, -0.287900001f,
+	0.102964997f, 0.882559001f, -0.00088800001f, 0.0922999978f, 0.166500002f, 0.824899971f, 0.471599996f, -0.311699986f,
+	0.0950289965f, 0.907193005f, 0.0315439999f, 0.0793000013f, 0.180099994f, 0.863099992f, 0.50150001f, -0.059799999f,
+	0.100817002f, 0.897126973f, 0.0321139991f, 0.0844999999f, 0.180899993f, 0.865700006f, 0.495799989f, -0.0689999983f,
+	0.0953489989f, 0.904462993f, 0.0642590001f, 0.0788000003f, 0.194900006f, 0.876800001f, 0.46329999f, 0.129099995f,
+	0.101195f, 0.895018995f, 0.0585989989f, 0.0841000006f, 0.193000004f, 0.871699989f, 0.479299992f, 0.1021f,
+	0.0965079963f, 0.889989972f, 0.0896300003f, 0.0830999985f, 0.207300007f, 0.889800012f, 0.355500013f, 0.2861f,
+	0.100461997f, 0.884540021f, 0.0841389969f, 0.0864999965f, 0.205300003f, 0.882200003f, 0.369599998f, 0.291599989f,
+	0.0976750031f, 0.861566007f, 0.108470999f, 0.0927999988f, 0.2192f, 0.811699986f, 0.377400011f, 0.445800006f,
+	0.104276001f, 0.856544018f, 0.101098001f, 0.0969000012f, 0.216199994f, 0.807600021f, 0.386000007f, 0.445800006f,
+	0.109373003f, 0.831954002f, 0.11332f, 0.106200002f, 0.224800006f, 0.821200013f, 0.446200013f, 0.355800003f,
+	0.114488997f, 0.828450978f, 0.104971997f, 0.109499998f, 0.221499994f, 0.754199982f, 0.625500023f, 0.199699998f,
+	0.129293993f, 0.815638006f, 0.0981229991f, 0.118799999f, 0.219899997f, 0.532999992f, 0.754299998f, 0.383399993f,
+	0.125590995f, 0.813260019f, 0.107437f, 0.117700003f, 0.224399999f, 0.653900027f, 0.60710001f, 0.451599985f,
+	0.143056005f, 0.811200976f, 0.0931669995f, 0.125200003f, 0.217500001f, 0.429500014f, 0.707599998f, 0.561100006f,
+	0.139369994f, 0.805503011f, 0.102681004f, 0.125f, 0.2227f, 0.499599993f, 0.64410001f, 0.579299986f,
+	0.167919993f, 0.805221975f, 0.0837249979f, 0.136299998f, 0.212099999f, 0.407200009f, 0.694599986f, 0.593100011f,
+	0.167376995f, 0.810957015f, 0.0774220005f, 0.134800002f, 0.208499998f, 0.413599998f, 0.705299973f, 0.575699985f,
+	0.184732005f, 0.807102025f, 0.0692109987f, 0.141399994f, 0.203700006f, 0.432000011f, 0.755800009f, 0.4921f,
+	0.188834995f, 0.814899027f, 0.0529690012f, 0.142199993f, 0.195700005f, 0.557500005f, 0.749100029f, 0.357899994f,
+	0.194867998f, 0.809394002f, 0.0534409992f, 0.145899996f, 0.1963f, 0.611800015f, 0.701699972f, 0.365200013f,
+	0.199178994f, 0.810599983f, 0.0407340005f, 0.1461f, 0.190500006f, 0.569700003f, 0.813399971f, 0.117899999f,
+	-0.186220005f, 0.813996971f, 0.00956400018f, 0.143800005f, 0.0904999971f, -0.512000024f, 0.798099995f, -0.317600012f,
+	-0.195724994f, 0.812008977f, 0.0258889999f, 0.147699997f, 0.0980999991f, -0.717000008f, 0.668299973f, -0.198300004f,
+	-0.190919995f, 0.817399025f, 0.0266810004f, 0.144400001f, 0.0982000008f, -0.65170002f, 0.736400008f, -0.181899995f,
+	-0.171421006f, 0.820327997f, 0.00329599995f, 0.137999997f, 0.0860999972f, -0.473699987f, 0.784799993f, -0.399599999f,
+	-0.173204005f, 0.815909982f, -0.00272600004f, 0.140100002f, 0.0833000019f, -0.475699991f, 0.770399988f, -0.424400002f,
+	-0.199178994f, 0.810599983f, 0.0407340005f, 0.147499993f, 0.104900002f, -0.569700003f, 0.813399971f, 0.117899999f,
+	-0.188834995f, 0.814899027f, 0.0529690012f, 0.143600002f, 0.110100001f, -0.557500005f, 0.749100029f, 0.357899994f,
+	-0.194867998f, 0.809394002f, 0.0534409992f, 0.147300005f, 0.110699996f, -0.611800015f, 0.701699972f, 0.365200013f,
+	-0.167376995f, 0.810957015f, 0.0774220005f, 0.136199996f, 0.122900002f, -0.413599998f, 0.705299973f, 0.575699985f,
+	-0.184732005f, 0.807102025f, 0.0692109987f, 0.142800003f, 0.118100002f, -0.432000011f, 0.755800009f, 0.492000014f,
+	-0.167919993f, 0.805221975f, 0.0837249979f, 0.137700006f, 0.126499996f, -0.407200009f, 0.694599986f, 0.593100011f,
+	-0.143056005f, 0.811200976f, 0.0931669995f, 0.126599997f, 0.131899998f, -0.429500014f, 0.707599998f, 0.561100006f,
+	-0.139369994f, 0.805503011f, 0.102682002f, 0.126399994f, 0.137099996f, -0.499599993f, 0.64410001f, 0.579299986f,
+	-0.125590995f, 0.813260019f, 0.107437f, 0.119099997f, 0.138799995f, -0.653900027f, 0.60710001f, 0.451599985f,
+	-0.129293993f, 0.815638006f, 0.0981229991f, 0.120200001f, 0.134299994f, -0.532999992f, 0.754299998f, 0.383399993f,
+	-0.109373003f, 0.831954002f, 0.11332f, 0.107600003f, 0.139200002f, -0.821200013f, 0.446200013f, 0.355800003f,
+	-0.114488997f, 0.828450978f, 0.104971997f, 0.111000001f, 0.135900006f, -0.754199982f, 0.625500023f, 0.199699998f,
+	-0.104276001f, 0.856544018f, 0.101098001f, 0.0983000025f, 0.130600005f, -0.807600021f, 0.386000007f, 0.445800006f,
+	-0.0976750031f, 0.861566007f, 0.108470999f, 0.0942000002f, 0.133599997f, -0.811699986f, 0.377400011f, 0.445800006f,
+	-0.100461997f, 0.884540021f, 0.0841389969f, 0.0878999978f, 0.1197f, -0.882200003f, 0.369599998f, 0.291599989f,
+	-0.0965079963f, 0.889989972f, 0.0896300003f, 0.0844999999f, 0.121699996f, -0.889800012f, 0.355500013f, 0.2861f,
+	-0.101195f, 0.895018995f, 0.0585989989f, 0.0855000019f, 0.1074f, -0.871699989f, 0.479299992f, 0.1021f,
+	-0.0953489989f, 0.904462993f, 0.0642590001f, 0.0802000016f, 0.109300002f, -0.876800001f, 0.46329999f, 0.129099995f,
+	-0.100817002f, 0.897126973f, 0.0321139991f, 0.0859000012f, 0.0952999964f, -0.865700006f, 0.495799989f, -0.0689999983f,
+	-0.0950289965f, 0.907193005f, 0.0315439999f, 0.0807000026f, 0.0944999978f, -0.863099992f, 0.50150001f, -0.059799999f,
+	-0.102964997f, 0.882559001f, -0.00088800001f, 0.0938000008f, 0.0808999985f, -0.824899971f, 0.471599996f, -0.311699986f,
+	-0.0970849991f, 0.889254987f, -0.00608099997f, 0.0900000036f, 0.0781000033f, -0.828400016f, 0.480399996f, -0.287900001f,
+	-0.105324998f, 0.864775002f, -0.0138929999f, 0.1017f, 0.0746000037f, -0.863499999f, 0.42050001f, -0.278400004f,
+	-0.102507003f, 0.864728987f, -0.0234789997f, 0.101199999f, 0.070100002f, -0.864700019f, 0.432000011f, -0.256300002f,
+	-0.109523997f, 0.849636018f, -0.0275010001f, 0.108599998f, 0.0681999996f, -0.78670001f, 0.558700025f, -0.262800008f,
+	-0.1127f, 0.849355996f, -0.0188359991f, 0.109499998f, 0.072300002f, -0.7852f, 0.559300005f, -0.265799999f,
+	-0.119813003f, 0.837046981f, -0.0295599997f, 0.115999997f, 0.0675000027f, -0.657299995f, 0.716899991f, -0.2324f,
+	-0.120673999f, 0.838371992f, -0.0228899997f, 0.115699999f, 0.070600003f, -0.659600019f, 0.715499997f, -0.230299994f,
+	-0.142892003f, 0.822744012f, -0.0228649992f, 0.127900004f, 0.0716999993f, -0.49059999f, 0.819800019f, -0.295300007f,
+	-0.140304998f, 0.827305973f, -0.0145800002f, 0.125400007f, 0.0753000006f, -0.493299991f, 0.813199997f, -0.308899999f,
+	-0.157497004f, 0.818260014f, -0.0151359998f, 0.1338f, 0.0772999972f, -0.423500001f, 0.815400004f, -0.394600004f,
+	-0.0902649984f, 0.220442995f, -0.0407189988f, 0.358099997f, 0.971499979f, -0.0238000005f, -0.999499977f, -0.0197000001f,
+	-0.0850939974f, 0.218863994f, -0.00947999954f, 0.356000006f, 0.957300007f, -0.00159999996f, -0.99970001f, -0.0229000002f,
+	-0.0907580033f, 0.218949005f, -0.0132670002f, 0.358599991f, 0.959100008f, 0.0210999995f, -0.998300016f, -0.0538999997f,
+	-0.0839549974f, 0.219995007f, -0.0574669987f, 0.354999989f, 0.978999972f, -0.0276999995f, -0.999599993f, -0.00289999996f,
+	-0.0422150008f, 0.218858004f, -0.0647120029f, 0.336100012f, 0.981899977f, 0.0104999999f, -0.99879998f, -0.0472999997f,
+	-0.0423399992f, 0.218926996f, -0.0352649987f, 0.336400002f, 0.968599975f, 0.0148f, -0.999899983f, -0.00350000011f,
+	-0.0424260013f, 0.218825996f, -0.0149929998f, 0.336699992f, 0.959399998f, 0.0294000003f, -0.999599993f, 0.00380000006f,
+	-0.0425940007f, 0.219371006f, 0.0244340003f, 0.337099999f, 0.941500008f, 0.0489000008f, -0.998700023f, 0.0157999992f,
+	-0.0763750002f, 0.218994007f, 0.0299549997f, 0.352499992f, 0.939400017f, 0.0120000001f, -0.999899983f, 0.00490000006f,
+	0.000743000011f, 0.220869005f, -0.0401559994f, 0.316900015f, 0.970300019f, 0.0559f, -0.998399973f, -0.0114000002f,
+	-0.00422299979f, 0.221111f, -0.0108890003f, 0.319400012f, 0.957099974f, 0.0505999997f, -0.99849999f, 0.0186000001f,
+	-0.0427620001f, 0.219520003f, 0.0638469979f, 0.337599993f, 0.923699975f, 0.061999999f, -0.998000026f, 0.0154999997f,
+	-0.0722640008f, 0.219339997f, 0.0628150031f, 0.351000011f, 0.924399972f, 0.0126f, -0.999899983f, 0.00749999983f,
+	-0.00539200008f, 0.223124996f, 0.0306490008f, 0.320300013f, 0.938300014f, 0.0944000036f, -0.994899988f, 0.0357999988f,
+	-0.00896099955f, 0.223578006f, 0.0656839982f, 0.3222f, 0.922500014f, 0.111500002f, -0.993600011f, 0.0182000007f,
+	0.000269000011f, 0.221132994f, -0.0129789999f, 0.317299992f, 0.958000004f, 0.00949999969f, -0.999899983f, 0.00989999995f,
+	-0.00500599993f, 0.221716002f, -0.0581750013f, 0.319200009f, 0.978600025f, 0.0857999995f, -0.994899988f, -0.0533999987f,
+	-0.0178299993f, 0.220723003f, -0.078530997f, 0.324900001f, 0.987900019f, 0.0549000017f, -0.997799993f, -0.0379000008f,
+	-0.0421259999f, 0.221300006f, -0.0861779973f, 0.335799992f, 0.991699994f, 0.00139999995f, -0.993600011f, -0.112999998f,
+	-0.0664850026f, 0.220676005f, -0.0787369981f, 0.346899986f, 0.988499999f, -0.0287999995f, -0.996399999f, -0.079400003f,
+	-0.0428650007f, 0.220183f, 0.0885360017f, 0.337900013f, 0.912500024f, 0.0749000013f, -0.996999979f, 0.0175000001f,
+	-0.0567170009f, 0.219468996f, 0.0823320001f, 0.344099998f, 0.915400028f, 0.0751999989f, -0.995700002f, -0.0533000007f,
+	-0.0253829993f, 0.222158998f, 0.0854170024f, 0.329899997f, 0.913699985f, 0.116899997f, -0.992799997f, 0.0259000007f,
+	0.0902649984f, 0.220442995f, -0.0407189988f, 0.327300012f, 0.683300018f, 0.0238000005f, -0.999499977f, -0.0197000001f,
+	0.0907580033f, 0.218949005f, -0.0132670002f, 0.326799989f, 0.695800006f, -0.0210999995f, -0.998300016f, -0.0538999997f,
+	0.0850939974f, 0.218863994f, -0.00947999954f, 0.329299986f, 0.69749999f, 0.00159999996f, -0.99970001f, -0.0229000002f,
+	0.0423399992f, 0.218926996f, -0.0352649987f, 0.349000007f, 0.68629998f, -0.0148f, -0.999899983f, -0.00350000011f,
+	0.0422150008f, 0.218858004f, -0.0647120029f, 0.349299997f, 0.672999978f, -0.0172000006f, -0.99849999f, -0.0524999984f,
+	0.0839549974f, 0.219995007f, -0.0574669987f, 0.330300003f, 0.675800025f, 0.0276999995f, -0.999599993f, -0.00289999996f,
+	0.0424260013f, 0.218825996f, -0.0149929998f, 0.348699987f, 0.695500016f, -0.0294000003f, -0.999599993f, 0.00380000006f,
+	0.0425940007f, 0.219371006f, 0.0244340003f, 0.348199993f, 0.71329999f, -0.0489000008f, -0.998700023f, 0.0157999992f,
+	0.0763750002f, 0.218994007f, 0.0299549997f, 0.332899988f, 0.715499997f, -0.0120000001f, -0.999899983f, 0.00490000006f,
+	-0.000743000011f, 0.220869005f, -0.0401559994f, 0.368499994f, 0.684499979f, -0.0559f, -0.998399973f, -0.0114000002f,
+	0.00422299979f, 0.221111f, -0.0108890003f, 0.365999997f, 0.697700024f, -0.0505999997f, -0.99849999f, 0.0186000001f,
+	0.0722640008f, 0.219339997f, 0.0628150031f, 0.334399998f, 0.730400026f, -0.0126f, -0.999899983f, 0.00749999983f,
+	0.0427620001f, 0.219520003f, 0.0638469979f, 0.3477f, 0.73119998f, -0.061999999f, -0.998000026f, 0.0154999997f,
+	0.00896099955f, 0.223578006f, 0.0656839982f, 0.363099992f, 0.7324f, -0.111500002f, -0.993600011f, 0.0182000007f,
+	0.00539200008f, 0.223124996f, 0.0306490008f, 0.365099996f, 0.716499984f, -0.0944000036f, -0.994899988f, 0.0357999988f,
+	-0.000269000011f, 0.221132994f, -0.0129789999f, 0.368000001f, 0.696799994f, -0.00949999969f, -0.999899983f, 0.00989999995f,
+	0.00500599993f, 0.221716002f, -0.0581750013f, 0.3662f, 0.676299989f, -0.0881000012f, -0.993900001f, -0.0670000017f,
+	0.0185310002f, 0.221458003f, -0.0776230022f, 0.360199988f, 0.667299986f, -0.0720999986f, -0.995100021f, -0.0680999979f,
+	0.0421259999f, 0.221300006f, -0.0861779973f, 0.349599987f, 0.663200021f, -0.0187999997f, -0.993399978f, -0.112999998f,
+	0.0664850026f, 0.220676005f, -0.0787369981f, 0.338499993f, 0.666299999f, 0.0287999995f, -0.996399999f, -0.079400003f,
+	0.0428650007f, 0.220183f, 0.0885360017f, 0.347499996f, 0.742299974f, -0.0749000013f, -0.996999979f, 0.0175000001f,
+	0.0253829993f, 0.222158998f, 0.0854170024f, 0.355500013f, 0.741100013f, -0.116899997f, -0.992799997f, 0.0259000007f,
+	0.0567170009f, 0.219468996f, 0.0823320001f, 0.341199994f, 0.739400029f, -0.0751999989f, -0.995700002f, -0.0533000007f,
+	-0.0344530009f, 0.810434997f, -0.138524994f, 0.154499993f, 0.344199985f, -0.377299994f, 0.913299978f, -0.153300002f,
+	-0.0215119999f, 0.814032018f, -0.143361002f, 0.161200002f, 0.344599992f, -0.181899995f, 0.930800021f, -0.317000002f,
+	-0.010822f, 0.809059978f, -0.169975996f, 0.168200001f, 0.355800003f, -0.0218000002f, 0.677900016f, -0.734899998f,
+	-0.0410429984f, 0.797589004f, -0.159654006f, 0.152700007f, 0.355800003f, -0.432300001f, 0.694000006f, -0.575800002f,
+	-0.0143510001f, 0.812552989f, -0.142772004f, 0.164700001f, 0.343499988f, 0.432900012f, 0.794099987f, -0.426600009f,
+	-0.00687800022f, 0.813127995f, -0.153209001f, 0.168699995f, 0.347200006f, -0.0326000005f, 0.994199991f, 0.1021f,
+	0.0171959996f, 0.811125994f, -0.153715998f, 0.179299995f, 0.346399993f, 0.480699986f, 0.71329999f, -0.50999999f,
+	-0.00980400015f, 0.805359006f, -0.143309996f, 0.167899996f, 0.341800004f, 0.39379999f, 0.918200016f, -0.0430000015f,
+	-0.00257300003f, 0.813464999f, -0.133598998f, 0.165999994f, 0.336699992f, 0.529399991f, -0.157199994f, -0.833599985f,
+	0.00974499993f, 0.811739981f, -0.145392999f, 0.175699994f, 0.342900008f, -0.0878999978f, 0.976599991f, 0.196099997f,
+	-0.00517799985f, 0.807763994f, -0.147668004f, 0.169499993f, 0.343600005f, -0.104500003f, 0.871399999f, 0.479200006f,
+	0.0199549999f, 0.811455011f, -0.149122f, 0.180000007f, 0.344700009f, 0.680700004f, 0.727999985f, -0.0811000019f,
+	0.00379500003f, 0.808084011f, -0.143915996f, 0.172900006f, 0.341600001f, -0.226799995f, 0.935899973f, 0.269400001f,
+	0.0102319997f, 0.808845997f, -0.131334007f, 0.175600007f, 0.335999995f, 0.0201999992f, 0.978600025f, 0.204699993f,
+	-0.00316100009f, 0.809256971f, -0.132087007f, 0.168699995f, 0.335900009f, 0.791700006f, 0.550100029f, -0.265599996f,
+	-0.000959999976f, 0.809571981f, -0.127133995f, 0.167699993f, 0.333000004f, 0.479699999f, -0.862699986f, -0.1602f,
+	0.00738300011f, 0.816404998f, -0.134265006f, 0.162699997f, 0.335700005f, -0.0113000004f, -0.403100014f, -0.915099978f,
+	-0.00428400002f, 0.806940019f, -0.125828996f, 0.169699997f, 0.331999987f, 0.57190001f, -0.405600011f, 0.713100016f,
+	0.0154670002f, 0.80687499f, -0.125603005f, 0.178599998f, 0.333999991f, 0.472900003f, 0.530900002f, 0.703199983f,
+	-0.0115369996f, 0.806209981f, -0.116291001f, 0.172499999f, 0.327300012f, 0.498400003f, -0.27610001f, 0.821799994f,
+	-0.00189800002f, 0.810217977f, -0.120832004f, 0.167799994f, 0.32949999f, 0.430400014f, -0.662299991f, 0.613300025f,
+	0.0112399999f, 0.813648999f, -0.129786998f, 0.161799997f, 0.333400011f, 0.202399999f, -0.915099978f, -0.34889999f,
+	0.0139910001f, 0.813793004f, -0.123777002f, 0.160300002f, 0.330900013f, 0.38530001f, -0.756799996f, 0.527999997f,
+	0.0197269991f, 0.819325984f, -0.137085006f, 0.157499999f, 0.336600006f, 0.0529999994f, -0.332500011f, -0.941600025f,
+	0.0235210005f, 0.817475021f, -0.132765993f, 0.156100005f, 0.335000008f, 0.4736f, -0.811399996f, -0.342599988f,
+	0.0247409996f, 0.818078995f, -0.127263993f, 0.155100003f, 0.333200008f, 0.653500021f, -0.566799998f, 0.501699984f,
+	0.0278309993f, 0.821965992f, -0.132752001f, 0.153600007f, 0.336299986f, 0.940699995f, 0.0289999992f, -0.338099986f,
+	0.0256900005f, 0.822878003f, -0.135830998f, 0.154599994f, 0.337300003f, 0.6505f, 0.291000009f, -0.701499999f,
+	0.0279799998f, 0.821543992f, -0.130513996f, 0.153400004f, 0.335399985f, 0.979799986f, -0.0960000008f, 0.1752f,
+	0.181089997f, 0.877655983f, 0.0196439996f, 0.393700004f, 0.00999999978f, 0.228300005f, 0.919700027f, -0.319400012f,
+	0.157866001f, 0.86469698f, -0.00869700033f, 0.377799988f, 0.0152000003f, 0.0653000027f, 0.840900004f, -0.537199974f,
+	0.149112001f, 0.868040979f, -0.004526f, 0.378699988f, 0.0196000002f, 0.0535999984f, 0.834800005f, -0.547999978f,
+	0.168323994f, 0.881820977f, 0.0224179998f, 0.39379999f, 0.0160000008f, 0.218700007f, 0.908100009f, -0.35710001f,
+	0.172901005f, 0.88340801f, 0.0428030007f, 0.402799994f, 0.0161000006f, 0.297199994f, 0.945900023f, -0.129899994f,
+	0.185007006f, 0.87956202f, 0.0433069989f, 0.404100001f, 0.0107000005f, 0.305200011f, 0.943899989f, -0.126499996f,
+	0.138834f, 0.851675987f, -0.0267440006f, 0.365999997f, 0.0197999999f, -0.0819000006f, 0.803200006f, -0.589999974f,
+	0.129685998f, 0.853986025f, -0.0221059993f, 0.36680001f, 0.0242999997f, -0.0854000002f, 0.793299973f, -0.602800012f,
+	0.108502999f, 0.833047986f, -0.0448919982f, 0.351099998f, 0.0285999998f, 0.0819000006f, 0.708599985f, -0.700900018f,
+	0.103758f, 0.838729978f, -0.0399800017f, 0.353500009f, 0.0315999985f, 0.0992000028f, 0.69690001f, -0.710300028f,
+	0.0868960023f, 0.833433986f, -0.0479569994f, 0.347299993f, 0.0373000018f, 0.111199997f, 0.710799992f, -0.694500029f,
+	0.0812380016f, 0.824496984f, -0.058056999f, 0.340999991f, 0.0377000012f, 0.111000001f, 0.712599993f, -0.692700028f,
+	0.116913997f, 0.81439501f, 0.122366004f, 0.533500016f, 0.0746999979f, 0.0498000011f, 0.540099978f, 0.84009999f,
+	0.113640003f, 0.822704017f, 0.117181003f, 0.530399978f, 0.0780000016f, 0.0322999991f, 0.545000017f, 0.837800026f,
+	0.0880139992f, 0.811546981f, 0.126930997f, 0.541199982f, 0.0847999975f, 0.0813999996f, 0.528699994f, 0.844900012f,
+	0.0772640035f, 0.799160004f, 0.135657996f, 0.549099982f, 0.0857999995f, 0.0820000023f, 0.5255f, 0.846800029f,
+	0.144188002f, 0.835646987f, 0.108792998f, 0.518299997f, 0.0693999976f, 0.0013f, 0.619599998f, 0.78490001f,
+	0.136207998f, 0.840604007f, 0.104796998f, 0.517499983f, 0.0737999976f, -0.000300000014f, 0.617900014f, 0.786199987f,
+	0.173847005f, 0.862152994f, 0.0851449966f, 0.498699993f, 0.0653000027f, 0.194900006f, 0.718500018f, 0.667699993f,
+	0.164606005f, 0.868561983f, 0.0814440027f, 0.497799993f, 0.0703999996f, 0.238499999f, 0.720099986f, 0.651600003f,
+	0.186473995f, 0.875155985f, 0.0585849993f, 0.484800011f, 0.065200001f, 0.168300003f, 0.851400018f, 0.496800005f,
+	0.176456004f, 0.881605983f, 0.0509250015f, 0.482600003f, 0.0709000006f, 0.218400002f, 0.841099977f, 0.494800001f,
+	-0.0495360009f, 0.790401995f, -0.163360998f, 0.159899995f, 0.328599989f, -0.0201999992f, 0.646600008f, -0.762600005f,
+	-0.0476589985f, 0.801846981f, -0.153705999f, 0.153099999f, 0.328599989f, -0.0201999992f, 0.646600008f, -0.762600005f,
+	-0.0456760004f, 0.795267999f, -0.159336999f, 0.156900004f, 0.327300012f, -0.0201999992f, 0.646600008f, -0.762600005f,
+	-0.0311580002f, 0.87707299f, -0.0332549997f, 0.473199993f, 0.251700014f, 0.0500000007f, 0.665799975f, -0.744499981f,
+	-0.0360779986f, 0.891546011f, -0.0176330004f, 0.482800007f, 0.254200011f, -0.0784000009f, 0.759000003f, -0.646399975f,
+	-0.0261160005f, 0.892561972f, -0.0174700003f, 0.481099993f, 0.258399993f, -0.0456999987f, 0.749899983f, -0.660000026f,
+	-0.0207630005f, 0.876492977f, -0.0327470005f, 0.471100003f, 0.255899996f, 0.0732999966f, 0.653999984f, -0.752900004f,
+	-0.0188410003f, 0.849937022f, -0.053371001f, 0.456999987f, 0.249899998f, -0.00380000006f, 0.467000008f, -0.884299994f,
+	-0.0283470005f, 0.851198018f, -0.0526099987f, 0.459500015f, 0.246399999f, 0.0185000002f, 0.503799975f, -0.863600016f,
+	-0.0344600007f, 0.909777999f, 0.00564499991f, 0.494599998f, 0.260800004f, -0.205400005f, 0.83920002f, -0.503499985f,
+	-0.0430799983f, 0.907396019f, 0.00525799999f, 0.495599985f, 0.256799996f, -0.211899996f, 0.846099973f, -0.488999993f,
+	-0.0479910001f, 0.917016029f, 0.0309679992f, 0.508000016f, 0.259499997f, -0.257499993f, 0.94569999f, -0.198200002f,
+	-0.040213f, 0.918631017f, 0.0281949993f, 0.505699992f, 0.262600005f, -0.301600009f, 0.911599994f, -0.279500008f,
+	-0.0461019985f, 0.918967009f, 0.0557690002f, 0.51849997f, 0.263700008f, -0.245900005f, 0.965600014f, 0.0847999975f,
+	-0.0375399999f, 0.921698987f, 0.0509640016f, 0.515200019f, 0.26699999f, -0.263999999f, 0.962000012f, 0.0702999979f,
+	-0.0249620005f, 0.918026984f, 0.0755510032f, 0.524800003f, 0.275200009f, -0.0124000004f, 0.965900004f, 0.25850001f,
+	-0.0223420002f, 0.920647025f, 0.0657709986f, 0.520099998f, 0.275299996f, -0.0612000003f, 0.96420002f, 0.257999986f,
+	-0.0f, 0.913836002f, 0.0823530033f, 0.525600016f, 0.287099987f, -0.0175999999f, 0.9199f, 0.391799986f,
+	-0.0f, 0.917850018f, 0.073439002f, 0.521300018f, 0.2861f, -0.0326999985f, 0.918200016f, 0.394800007f,
+	0.0249610003f, 0.918026984f, 0.0755510032f, 0.519400001f, 0.297300011f, 0.0450000018f, 0.962400019f, 0.267800003f,
+	0.0223420002f, 0.920647025f, 0.0657709986f, 0.515299976f, 0.294999987f, 0.0822999999f, 0.967100024f, 0.240500003f,
+	0.0461010002f, 0.918967009f, 0.0557690002f, 0.50849998f, 0.3046f, 0.247199997f, 0.963800013f, 0.100100003f,
+	0.0375390016f, 0.921698987f, 0.0509640016f, 0.507200003f, 0.300199986f, 0.245199993f, 0.965399981f, 0.0892999992f,
+	0.0479900017f, 0.917016029f, 0.0309679992f, 0.497299999f, 0.3037f, 0.284799993f, 0.935899973f, -0.207399994f,
+	0.0402120017f, 0.918631017f, 0.0281949993f, 0.496699989f, 0.299899995f, 0.278699994f, 0.919799984f, -0.276199996f,
+	0.043079f, 0.907396019f, 0.00525799999f, 0.485000014f, 0.300399989f, 0.204300001f, 0.834299982f, -0.512099981f,
+	0.0344600007f, 0.909777999f, 0.00564499991f, 0.485900015f, 0.296499997f, 0.2042f, 0.824500024f, -0.527700007f,
+	0.0360779986f, 0.891546011f, -0.0176330004f, 0.472499996f, 0.296900004f, 0.0498000011f, 0.762300014f, -0.645299971f,
+	0.0261160005f, 0.892561972f, -0.0174700003f, 0.472900003f, 0.292400002f, 0.0744000003f, 0.734799981f, -0.674099982f,
+	0.0207630005f, 0.876492977f, -0.0327470005f, 0.462799996f, 0.289900005f, -0.050999999f, 0.66109997f, -0.74849999f,
+	0.031157f, 0.87707299f, -0.0332549997f, 0.462799996f, 0.29460001f, -0.0736000016f, 0.683000028f, -0.726700008f,
+	0.0283470005f, 0.851198018f, -0.0526099987f, 0.448199987f, 0.293099999f, -0.0083999997f, 0.532199979f, -0.846599996f,
+	0.0188410003f, 0.849937022f, -0.053371001f, 0.447600007f, 0.288800001f, -0.0210999995f, 0.501600027f, -0.864899993f,
+	0.0269339997f, 0.82534802f, -0.064538002f, 0.435299993f, 0.292299986f, -0.141000003f, 0.239199996f, -0.960699975f,
+	0.0183300003f, 0.821973026f, -0.0638850033f, 0.433999985f, 0.288300008f, -0.143299997f, 0.188600004f, -0.971499979f,
+	0.0359099992f, 0.784107029f, -0.068204999f, 0.416299999f, 0.29519999f, 0.0113000004f, 0.0430999994f, -0.999000013f,
+	0.0290290006f, 0.778268993f, -0.0684330016f, 0.413800001f, 0.291900009f, 0.0116999997f, 0.0253999997f, -0.999599993f,
+	0.0501459986f, 0.751406014f, -0.0642260015f, 0.40110001f, 0.300900012f, 0.0895999968f, -0.0817999989f, -0.992600024f,
+	0.0444669984f, 0.741358995f, -0.0639109984f, 0.396600008f, 0.298200011f, 0.133399993f, -0.0725999996f, -0.988399982f,
+	0.0337200016f, 0.766076028f, -0.0680560023f, 0.408199996f, 0.29370001f, 0.239600003f, -0.0370999984f, -0.970200002f,
+	-0.0721049979f, 0.796908021f, -0.144231007f, 0.181899995f, 0.367300004f, -0.589600027f, 0.613900006f, -0.524900019f,
+	-0.069081001f, 0.796294987f, -0.148601994f, 0.179800004f, 0.366100013f, -0.654200017f, 0.540899992f, -0.528599977f,
+	-0.0723899975f, 0.776905f, -0.158650994f, 0.180999994f, 0.356099993f, -0.656400025f, 0.447299987f, -0.607500017f,
+	-0.0774519965f, 0.775426984f, -0.154413f, 0.184f, 0.3565f, -0.646499991f, 0.452199996f, -0.614499986f,
+	-0.0585660003f, 0.813409984f, -0.133511007f, 0.177699998f, 0.377200007f, -0.267699987f, 0.784300029f, -0.559599996f,
+	-0.0625500008f, 0.815204978f, -0.129252002f, 0.180000007f, 0.378699988f, -0.254000008f, 0.783100009f, -0.567700028f,
+	-0.0546090007f, 0.816160977f, -0.129393995f, 0.176599994f, 0.379900008f, -0.113600001f, 0.873000026f, -0.47420001f,
+	-0.154667005f, 0.797011018f, -0.0872260034f, 0.128299996f, 0.381999999f, -0.392699987f, 0.49849999f, -0.772800028f,
+	-0.177435994f, 0.761258006f, -0.0947809964f, 0.130799994f, 0.401199996f, -0.528500021f, 0.483999997f, -0.697399974f,
+	-0.182879001f, 0.760116994f, -0.0914480016f, 0.128600001f, 0.402999997f, -0.513700008f, 0.474599987f, -0.7148f,
+	-0.161151007f, 0.800812006f, -0.0815420002f, 0.123999998f, 0.382200003f, -0.405400008f, 0.521700025f, -0.75059998f,
+	-0.131600007f, 0.821362019f, -0.0792689994f, 0.128399998f, 0.366400003f, -0.497599989f, 0.761500001f, -0.415499985f,
+	-0.132146999f, 0.824958026f, -0.0706859976f, 0.124700002f, 0.364399999f, -0.514100015f, 0.778900027f, -0.359100014f,
+	-0.0650750026f, 0.792056024f, -0.147843003f, 0.0956000015f, 0.371899992f, -0.468800008f, 0.56220001f, -0.681299984f,
+	-0.0568219982f, 0.80687499f, -0.135544002f, 0.0908999965f, 0.380100012f, -0.449000001f, 0.70539999f, -0.548500001f,
+	-0.0468729995f, 0.808965981f, -0.140998006f, 0.0860000029f, 0.378399998f, -0.435600013f, 0.698700011f, -0.567600012f,
+	-0.0511699989f, 0.794661999f, -0.154568002f, 0.0888999999f, 0.369800001f, -0.438800007f, 0.587899983f, -0.6796f,
+	-0.0534979999f, 0.778228998f, -0.163409993f, 0.0917999968f, 0.361799985f, -0.503300011f, 0.425399989f, -0.752200007f,
+	-0.0658259988f, 0.776278019f, -0.155417994f, 0.0979999974f, 0.364300013f, -0.54430002f, 0.384000003f, -0.745899975f,
+	-0.0432199985f, 0.790292978f, -0.165006995f, 0.143299997f, 0.3204f, -0.241899997f, 0.458000004f, -0.855400026f,
+	-0.0495360009f, 0.790401995f, -0.163360998f, 0.140499994f, 0.319400012f, -0.218400002f, 0.448000014f, -0.866999984f,
+	-0.0464619994f, 0.794050992f, -0.162263006f, 0.142299995f, 0.318100005f, -0.218700007f, 0.4454f, -0.868200004f,
+	-0.0441909991f, 0.778945982f, -0.171664998f, 0.1417f, 0.326200008f, -0.341500014f, 0.497200012f, -0.797599971f,
+	-0.0500649996f, 0.778689027f, -0.169309005f, 0.138999999f, 0.325199991f, -0.306899995f, 0.484699994f, -0.819100022f,
+	-0.152637005f, 0.788985014f, -0.089515999f, 0.1109f, 0.273099989f, -0.416200012f, 0.496300012f, -0.761900008f,
+	-0.132404f, 0.815711975f, -0.0816759989f, 0.101199999f, 0.260800004f, -0.382400006f, 0.514599979f, -0.767499983f,
+	-0.0958660021f, 0.804917991f, -0.107116997f, 0.1153f, 0.245499998f, -0.462000012f, 0.566600025f, -0.682299972f,
+	-0.109425001f, 0.768712997f, -0.126936004f, 0.132100001f, 0.255699992f, -0.480399996f, 0.524200022f, -0.703100026f,
+	-0.170645997f, 0.762421012f, -0.0949869975f, 0.119999997f, 0.28459999f, -0.447299987f, 0.461100012f, -0.76639998f,
+	-0.0759370029f, 0.791961014f, -0.137816995f, 0.130500004f, 0.236699998f, -0.533999979f, 0.561699986f, -0.631900012f,
+	-0.0679439977f, 0.807694972f, -0.126332f, 0.122299999f, 0.231800005f, -0.467700005f, 0.663699985f, -0.583800018f,
+	-0.0801410004f, 0.773739994f, -0.146456003f, 0.138699993f, 0.240999997f, -0.54610002f, 0.458499998f, -0.701099992f,
+	0.111332998f, 0.798021972f, -0.0816560015f, 0.149100006f, 0.509299994f, 0.331f, 0.72329998f, -0.606100023f,
+	0.149565995f, 0.774999022f, -0.0887570009f, 0.149499997f, 0.488799989f, 0.408399999f, 0.582000017f, -0.703100026f,
+	0.145539001f, 0.773230016f, -0.0925609991f, 0.151899993f, 0.489800006f, 0.378600001f, 0.615499973f, -0.691200018f,
+	0.111279003f, 0.792159975f, -0.0887679979f, 0.152799994f, 0.507600009f, 0.334600002f, 0.725899994f, -0.600899994f,
+	0.177437007f, 0.743104994f, -0.0918760002f, 0.152799994f, 0.469900012f, 0.421600014f, 0.428299993f, -0.799300015f,
+	0.170285001f, 0.741571009f, -0.0963490009f, 0.156100005f, 0.472000003f, 0.414499998f, 0.42050001f, -0.807099998f,
+	0.0876799971f, 0.777109027f, -0.101507001f, 0.114699997f, 0.523400009f, 0.0175000001f, 0.803300023f, -0.595300019f,
+	0.0918610021f, 0.774688005f, -0.104443997f, 0.1171f, 0.522700012f, 0.0364999995f, 0.795799971f, -0.604399979f,
+	0.0770799965f, 0.767152011f, -0.115257002f, 0.118699998f, 0.531599998f, 0.0403000005f, 0.893000007f, -0.448300004f,
+	0.074248001f, 0.768736005f, -0.112212002f, 0.116700001f, 0.531899989f, 0.0153000001f, 0.905399978f, -0.424299985f,
+	0.0486200005f, 0.764515996f, -0.136078998f, 0.1197f, 0.547699988f, -0.133100003f, 0.99059999f, -0.0322000012f,
+	0.0395569988f, 0.763171017f, -0.135042995f, 0.117200002f, 0.550999999f, -0.148599997f, 0.988799989f, -0.0153000001f,
+	0.0877749994f, 0.777058005f, -0.0974640027f, 0.165600002f, 0.508899987f, 0.4903f, 0.871500015f, -0.00889999978f,
+	0.0946130008f, 0.773253024f, -0.103013001f, 0.167099997f, 0.513000011f, 0.471700013f, 0.881500006f, -0.0231999997f,
+	0.0918610021f, 0.774688005f, -0.104443997f, 0.165600002f, 0.512700021f, 0.477499992f, 0.878400028f, -0.0186999999f,
+	0.0876799971f, 0.777109027f, -0.101507001f, 0.164499998f, 0.510399997f, 0.500899971f, 0.865499973f, -0.000600000028f,
+	-0.0476589985f, 0.801846981f, -0.153705999f, 0.164299995f, 0.339700013f, -0.462199986f, 0.392500013f, -0.79519999f,
+	-0.0425890014f, 0.803160012f, -0.156826004f, 0.161899999f, 0.340999991f, -0.553600013f, 0.249599993f, -0.794499993f,
+	-0.0410429984f, 0.797589004f, -0.159654006f, 0.159899995f, 0.3389f, -0.419f, 0.450300008f, -0.788500011f,
+	-0.0456760004f, 0.795267999f, -0.159336999f, 0.161300004f, 0.337000012f, -0.330000013f, 0.554499984f, -0.763999999f,
+	0.0578759983f, 0.748085022f, -0.149847999f, 0.159600005f, 0.547599971f, 0.380600005f, 0.563199997f, -0.733500004f,
+	0.0616220012f, 0.749347985f, -0.146996006f, 0.157399997f, 0.547500014f, 0.374300003f, 0.573700011f, -0.728600025f,
+	0.0733620003f, 0.723267972f, -0.154785007f, 0.159199998f, 0.534200013f, 0.530200005f, 0.471100003f, -0.704999983f,
+	0.068200998f, 0.722720981f, -0.159167007f, 0.162200004f, 0.534799993f, 0.539699972f, 0.475100011f, -0.694999993f,
+	0.0467789993f, 0.761232018f, -0.141223997f, 0.159199998f, 0.556400001f, 0.166299999f, 0.797800004f, -0.57950002f,
+	0.0486200005f, 0.764515996f, -0.136078998f, 0.1567f, 0.557799995f, 0.0480999984f, 0.833999991f, -0.549600005f,
+	0.0395569988f, 0.763171017f, -0.135042995f, 0.159700006f, 0.560699999f, -0.182300001f, 0.85710001f, -0.481900007f,
+	0.0400869995f, 0.742426991f, -0.162207007f, 0.150199994f, 0.557600021f, 0.123999998f, 0.561100006f, -0.818400025f,
+	0.0468659997f, 0.71815598f, -0.169614002f, 0.149100006f, 0.545700014f, 0.355599999f, 0.362300009f, -0.861599982f,
+	0.0414390005f, 0.717481971f, -0.172135994f, 0.151800007f, 0.54549998f, 0.336899996f, 0.363900006f, -0.868300021f,
+	0.034802001f, 0.741180003f, -0.163980007f, 0.152700007f, 0.557299972f, 0.139300004f, 0.565800011f, -0.812699974f,
+	0.0242040008f, 0.758969009f, -0.145393997f, 0.154699996f, 0.569800019f, -0.221599996f, 0.582300007f, -0.782199979f,
+	0.0304109994f, 0.760356009f, -0.146577001f, 0.151800007f, 0.569199979f, -0.272799999f, 0.54430002f, -0.793299973f,
+	-0.11868f, 0.905547023f, 0.0976639986f, 0.485399991f, 0.185200006f, 0.490399987f, 0.547399998f, 0.678200006f,
+	-0.108970001f, 0.877390981f, 0.105209f, 0.4903f, 0.172399998f, 0.469900012f, 0.376100004f, 0.798600018f,
+	-0.107735999f, 0.90229398f, 0.0927560031f, 0.490999997f, 0.184799999f, 0.473399997f, 0.521600008f, 0.709800005f,
+	-0.113569997f, 0.923074007f, 0.0739680007f, 0.490500003f, 0.197600007f, 0.534200013f, 0.728200018f, 0.42930001f,
+	-0.125529006f, 0.928412974f, 0.0802970007f, 0.483999997f, 0.198300004f, 0.555700004f, 0.712000012f, 0.42930001f,
+	-0.114871003f, 0.930339992f, 0.0551399998f, 0.493400007f, 0.206100002f, 0.560299993f, 0.813799977f, 0.154599994f,
+	-0.128004998f, 0.939473987f, 0.0555570014f, 0.487399995f, 0.209999993f, 0.568199992f, 0.810599983f, 0.141900003f,
+	-0.113412999f, 0.929506004f, 0.0391689986f, 0.498100013f, 0.211600006f, 0.563399971f, 0.815199971f, -0.1338f,
+	-0.127072006f, 0.93897903f, 0.0388870016f, 0.492000014f, 0.215900004f, 0.568700016f, 0.816299975f, -0.100699998f,
+	-0.110086001f, 0.922626972f, 0.0234750006f, 0.504599988f, 0.215900004f, 0.504499972f, 0.750699997f, -0.426600009f,
+	-0.124076001f, 0.932154f, 0.0235699993f, 0.498299986f, 0.220100001f, 0.532299995f, 0.776899993f, -0.336199999f,
+	-0.114643998f, 0.90772599f, -0.000414999988f, 0.513400018f, 0.225099996f, 0.458099991f, 0.643400013f, -0.613399982f,
+	-0.107894003f, 0.905642986f, 0.0023670001f, 0.515100002f, 0.222100005f, 0.453900009f, 0.633000016f, -0.627099991f,
+	-0.109171003f, 0.892206013f, -0.00832900032f, 0.521499991f, 0.226300001f, 0.457800001f, 0.52670002f, -0.716199994f,
+	0.11868f, 0.905547023f, 0.0976639986f, 0.418099999f, 0.116499998f, -0.490399987f, 0.547399998f, 0.678200006f,
+	0.107736997f, 0.90229398f, 0.0927560031f, 0.41839999f, 0.121799998f, -0.473399997f, 0.521600008f, 0.709800005f,
+	0.108970001f, 0.877390981f, 0.105209f, 0.430400014f, 0.1215f, -0.469900012f, 0.376100004f, 0.798600018f,
+	0.113569997f, 0.923074007f, 0.0739680007f, 0.405999988f, 0.120999999f, -0.534200013f, 0.728200018f, 0.42930001f,
+	0.125529006f, 0.928412974f, 0.0802970007f, 0.405499995f, 0.114799999f, -0.555700004f, 0.712000012f, 0.42930001f,
+	0.114871003f, 0.930339992f, 0.0551399998f, 0.397700012f, 0.1237f, -0.560299993f, 0.813799977f, 0.154599994f,
+	0.128004998f, 0.939473987f, 0.0555570014f, 0.39410001f, 0.117799997f, -0.568199992f, 0.810599983f, 0.141900003f,
+	0.127072006f, 0.93897903f, 0.0388870016f, 0.388300002f, 0.122100003f, -0.568700016f, 0.816299975f, -0.100699998f,
+	0.113412999f, 0.929506004f, 0.0391689986f, 0.39230001f, 0.128099993f, -0.563399971f, 0.815199971f, -0.1338f,
+	0.124076001f, 0.932154f, 0.0235699993f, 0.38409999f, 0.128099993f, -0.532299995f, 0.776899993f, -0.336199999f,
+	0.110086001f, 0.922626972f, 0.0234750006f, 0.388000011f, 0.134299994f, -0.504499972f, 0.750699997f, -0.426600009f,
+	0.114643998f, 0.90772599f, -0.000414999988f, 0.378899992f, 0.1426f, -0.458099991f, 0.643400013f, -0.613399982f,
+	0.107894003f, 0.905642986f, 0.0023670001f, 0.381700009f, 0.144199997f, -0.453900009f, 0.633000016f, -0.627099991f,
+	0.109171003f, 0.892206013f, -0.00832900032f, 0.377499998f, 0.150299996f, -0.457800001f, 0.52670002f, -0.716199994f,
+	-0.0100830002f, 0.274574995f, 0.0357020013f, 0.453399986f, 0.987999976f, 0.683899999f, -0.728999972f, 0.0295000002f,
+	-0.0121320002f, 0.275638014f, 0.0268300008f, 0.457300007f, 0.989400029f, 0.518899977f, -0.826399982f, -0.218899995f,
+	-0.00819199998f, 0.279983014f, 0.0197640005f, 0.458999991f, 0.993200004f, 0.599600017f, -0.776799977f, -0.192499995f,
+	-0.00242800009f, 0.282256991f, 0.0308519993f, 0.453200012f, 0.993399978f, 0.650399983f, -0.744199991f, -0.152199998f,
+	-0.0177340005f, 0.272994012f, 0.0606030002f, 0.444299996f, 0.980400026f, 0.686100006f, -0.649200022f, 0.328299999f,
+	-0.0063029998f, 0.278393f, 0.0351979993f, 0.452499986f, 0.9903f, 0.715300024f, -0.69569999f, 0.0662999973f,
+	-0.0274209995f, 0.275160998f, 0.0784349963f, 0.43720001f, 0.974399984f, 0.454899997f, -0.740400016f, 0.494899988f,
+	-0.0302510001f, 0.271275997f, 0.0749180019f, 0.439599991f, 0.973100007f, 0.416799992f, -0.7579f, 0.501900017f,
+	-0.0133250002f, 0.278322011f, 0.0615530014f, 0.442499995f, 0.98299998f, 0.709200025f, -0.639800012f, 0.296200007f,
+	-0.042874001f, 0.268896013f, 0.0783950016f, 0.439099997f, 0.967100024f, -0.00200000009f, -0.759800017f, 0.650099993f,
+	-0.0428999998f, 0.273283005f, 0.0834039971f, 0.436100006f, 0.967100024f, -0.00200000009f, -0.752300024f, 0.658800006f,
+	-0.0583389997f, 0.275130004f, 0.0783040002f, 0.437400013f, 0.959800005f, -0.486299992f, -0.744599998f, 0.457300007f,
+	-0.0554720014f, 0.27125001f, 0.0748120025f, 0.439700007f, 0.961099982f, -0.453799993f, -0.757600009f, 0.469099998f,
+	-0.0700619966f, 0.278041989f, 0.0601870008f, 0.443399996f, 0.952000022f, -0.748899996f, -0.648699999f, 0.135600001f,
+	-0.0666000023f, 0.273828f, 0.0591499992f, 0.444900006f, 0.953999996f, -0.755500019f, -0.631299973f, 0.1752f,
+	-0.071062997f, 0.280622989f, 0.0400790013f, 0.451099992f, 0.947000027f, -0.920099974f, -0.3838f, 0.0785999969f,
+	-0.0688590035f, 0.274342f, 0.0410410017f, 0.451999992f, 0.949800014f, -0.943099976f, -0.314200014f, 0.108800001f,
+	0.0100830002f, 0.274574995f, 0.0357020013f, 0.453599989f, 0.711199999f, -0.683899999f, -0.728999972f, 0.0295000002f,
+	0.00242800009f, 0.282256991f, 0.0308519993f, 0.453799993f, 0.705900013f, -0.650399983f, -0.744199991f, -0.152199998f,
+	0.00819199998f, 0.279983014f, 0.0197640005f, 0.448000014f, 0.70599997f, -0.599600017f, -0.776799977f, -0.192499995f,
+	0.0121320002f, 0.275638014f, 0.0268300008f, 0.449699998f, 0.709800005f, -0.518899977f, -0.826399982f, -0.218899995f,
+	0.0063029998f, 0.278393f, 0.0351979993f, 0.45449999f, 0.708999991f, -0.715300024f, -0.69569999f, 0.0662999973f,
+	0.0177340005f, 0.272994012f, 0.0606030002f, 0.462700009f, 0.718900025f, -0.686100006f, -0.649200022f, 0.328299999f,
+	0.0133250002f, 0.278322011f, 0.0615530014f, 0.46450001f, 0.716300011f, -0.709200025f, -0.639800012f, 0.296200007f,
+	0.0274209995f, 0.275160998f, 0.0784349963f, 0.469799995f, 0.724799991f, -0.454899997f, -0.740400016f, 0.494899988f,
+	0.0302510001f, 0.271275997f, 0.0749180019f, 0.467400014f, 0.726100028f, -0.416799992f, -0.7579f, 0.501900017f,
+	0.042874001f, 0.268896013f, 0.0783950016f, 0.467900008f, 0.73210001f, 0.00200000009f, -0.759800017f, 0.650099993f,
+	0.0428999998f, 0.273283005f, 0.0834039971f, 0.470899999f, 0.732200027f, 0.00200000009f, -0.752300024f, 0.658800006f,
+	0.0554720014f, 0.27125001f, 0.0748120025f, 0.467299998f, 0.738200009f, 0.453799993f, -0.757600009f, 0.469099998f,
+	0.0583389997f, 0.275130004f, 0.0783040002f, 0.469700009f, 0.739499986f, 0.486299992f, -0.744599998f, 0.457300007f,
+	0.0666000023f, 0.273828f, 0.0591499992f, 0.462099999f, 0.745199978f, 0.755500019f, -0.631299973f, 0.1752f,
+	0.0700619966f, 0.278041989f, 0.0601870008f, 0.46360001f, 0.747300029f, 0.748899996f, -0.648699999f, 0.135600001f,
+	0.071062997f, 0.280622989f, 0.0400790013f, 0.455799997f, 0.752200007f, 0.920099974f, -0.3838f, 0.0785999969f,
+	0.0688590035f, 0.274342f, 0.0410410017f, 0.454899997f, 0.749300003f, 0.943099976f, -0.314200014f, 0.108800001f,
+	0.0637089983f, 0.808007002f, 0.127832994f, 0.560199976f, 0.0697000027f, -0.583500028f, -0.197099999f, 0.787800014f,
+	0.0772640035f, 0.799160004f, 0.135657996f, 0.565699995f, 0.0650999993f, -0.581099987f, -0.257200003f, 0.772099972f,
+	0.059071999f, 0.843195975f, 0.129954994f, 0.54549998f, 0.0644999966f, -0.335200012f, 0.0184000004f, 0.941999972f,
+	0.0721520036f, 0.780730009f, 0.121287003f, 0.57160002f, 0.0737000033f, -0.631500006f, -0.360199988f, 0.686600029f,
+	0.0730329975f, 0.847470999f, 0.134332001f, 0.54549998f, 0.0593999997f, -0.310099989f, 0.0401000008f, 0.949899971f,
+	0.0713919997f, 0.889182985f, 0.130649f, 0.528199971f, 0.0542000011f, -0.328099996f, 0.219699994f, 0.91869998f,
+	0.0575239994f, 0.887435019f, 0.126114994f, 0.526600003f, 0.0603f, -0.318300009f, 0.207399994f, 0.925000012f,
+	0.0741280019f, 0.928480029f, 0.115819998f, 0.510800004f, 0.0487000011f, -0.248400003f, 0.448000014f, 0.858799994f,
+	0.0587150007f, 0.928113997f, 0.111727998f, 0.508700013f, 0.0551999994f, -0.236900002f, 0.453099996f, 0.859399974f,
+	0.0749220029f, 0.949402988f, 0.101278f, 0.5f, 0.0463000014f, -0.214699998f, 0.684700012f, 0.696500003f,
+	0.059675999f, 0.947431028f, 0.098559998f, 0.498800009f, 0.0529999994f, -0.206799999f, 0.680700004f, 0.702700019f,
+	0.0766270012f, 0.965075016f, 0.0804560035f, 0.488900006f, 0.0443000011f, -0.176499993f, 0.877099991f, 0.446700007f,
+	0.0600440018f, 0.962734997f, 0.0787390023f, 0.488099992f, 0.0515000001f, -0.170300007f, 0.875899971f, 0.451499999f,
+	0.060442999f, 0.969549f, 0.0569039993f, 0.478199989f, 0.0507000014f, -0.164800003f, 0.983099997f, 0.0797000006f,
+	0.0772119984f, 0.972323f, 0.057438001f, 0.478500009f, 0.0434000008f, -0.165099993f, 0.982800007f, 0.0825999975f,
+	0.0604359992f, 0.965992987f, 0.0309459995f, 0.466899991f, 0.0509000011f, -0.164900005f, 0.929400027f, -0.3301f,
+	0.0769150034f, 0.96846801f, 0.0296870004f, 0.466399997f, 0.0436999984f, -0.173299998f, 0.930899978f, -0.32159999f,
+	0.0595850013f, 0.951085985f, 0.00679499982f, 0.454699993f, 0.0522000007f, -0.231199995f, 0.761900008f, -0.605000019f,
+	0.0743089989f, 0.953275979f, 0.00389500009f, 0.453599989f, 0.0458000004f, -0.231999993f, 0.765900016f, -0.599699974f,
+	0.0726839975f, 0.930278003f, -0.0170719996f, 0.440400004f, 0.0483999997f, -0.31189999f, 0.558899999f, -0.768400013f,
+	0.0592829995f, 0.930130005f, -0.0115870005f, 0.442799985f, 0.0540999994f, -0.322899997f, 0.568300009f, -0.756799996f,
+	0.0719790012f, 0.898384988f, -0.0361200012f, 0.424800009f, 0.0520000011f, -0.380100012f, 0.367799997f, -0.848699987f,
+	0.0590520017f, 0.892261982f, -0.0332110003f, 0.424499989f, 0.0582999997f, -0.34920001f, 0.318599999f, -0.881200016f,
+	0.0627529994f, 0.848022997f, -0.0447949991f, 0.405200005f, 0.0628999993f, -0.518599987f, 0.125f, -0.845799983f,
+	0.0743039995f, 0.857825994f, -0.0498859994f, 0.406800002f, 0.0562000014f, -0.528199971f, 0.192900002f, -0.826900005f,
+	0.0812380016f, 0.824496984f, -0.058056999f, 0.391900003f, 0.0584000014f, -0.615400016f, -0.0397999994f, -0.787199974f,
+	0.0731180012f, 0.804139018f, -0.0490510017f, 0.386099994f, 0.0667999983f, -0.645299971f, -0.0786999986f, -0.759800017f,
+	-0.0634440035f, 0.810927987f, 0.128120005f, 0.549899995f, 0.0434999987f, 0.579699993f, -0.170399994f, 0.796800017f,
+	-0.0594069995f, 0.846185982f, 0.129954994f, 0.537699997f, 0.0395999998f, 0.333400011f, 0.0253999997f, 0.942399979f,
+	-0.0772640035f, 0.799160004f, 0.135657996f, 0.558600008f, 0.0397000015f, 0.603699982f, -0.254599988f, 0.755400002f,
+	-0.0721520036f, 0.780730009f, 0.121287003f, 0.564899981f, 0.0483999997f, 0.657299995f, -0.341500014f, 0.671800017f,
+	-0.0713910013f, 0.889182985f, 0.130649f, 0.519500017f, 0.0293000005f, 0.327399999f, 0.220699996f, 0.91869998f,
+	-0.0730329975f, 0.847470999f, 0.134332001f, 0.537599981f, 0.0342999995f, 0.308699995f, 0.0357000008f, 0.950500011f,
+	-0.0575239994f, 0.887435019f, 0.126114994f, 0.518100023f, 0.0357000008f, 0.318399996f, 0.209199995f, 0.924600005f,
+	-0.0741280019f, 0.928480029f, 0.115819998f, 0.501399994f, 0.0241f, 0.248400003f, 0.448000014f, 0.858799994f,
+	-0.0587150007f, 0.928113997f, 0.111727998f, 0.499300003f, 0.0308999997f, 0.236900002f, 0.453099996f, 0.859399974f,
+	-0.0749220029f, 0.949402988f, 0.101278f, 0.490200013f, 0.0219000001f, 0.214699998f, 0.684700012f, 0.696500003f,
+	-0.059675999f, 0.947431028f, 0.098559998f, 0.489100009f, 0.0287999995f, 0.206799999f, 0.680700004f, 0.702700019f,
+	-0.0766270012f, 0.965075016f, 0.0804560035f, 0.478599995f, 0.0200999994f, 0.176499993f, 0.877099991f, 0.446700007f,
+	-0.0600440018f, 0.962734997f, 0.0787390023f, 0.477899998f, 0.0275999997f, 0.170300007f, 0.875800014f, 0.451499999f,
+	-0.060442999f, 0.969549f, 0.0569039993f, 0.467700005f, 0.0270000007f, 0.164800003f, 0.983099997f, 0.0797000006f,
+	-0.0772119984f, 0.972323f, 0.057438001f, 0.467799991f, 0.0194000006f, 0.165099993f, 0.982800007f, 0.0825999975f,
+	-0.0604359992f, 0.965992987f, 0.0309459995f, 0.456f, 0.0274f, 0.164900005f, 0.929400027f, -0.3301f,
+	-0.0769150034f, 0.96846801f, 0.0296870004f, 0.455300003f, 0.0199999996f, 0.173299998f, 0.930899978f, -0.32159999f,
+	-0.0595850013f, 0.951085985f, 0.00679499982f, 0.443399996f, 0.0291000009f, 0.231199995f, 0.761900008f, -0.605000019f,
+	-0.0743089989f, 0.953275979f, 0.00389500009f, 0.442099988f, 0.0225000009f, 0.231999993f, 0.765900016f, -0.599699974f,
+	-0.0726839975f, 0.930278003f, -0.0170719996f, 0.428499997f, 0.0254999995f, 0.31189999f, 0.558899999f, -0.768400013f,
+	-0.0592829995f, 0.930130005f, -0.0115870005f, 0.431199998f, 0.0313999988f, 0.322899997f, 0.568300009f, -0.756799996f,
+	-0.0719790012f, 0.898384988f, -0.0361200012f, 0.412499994f, 0.0296f, 0.380100012f, 0.367799997f, -0.848699987f,
+	-0.0590520017f, 0.892261982f, -0.0332110003f, 0.412299991f, 0.0362000018f, 0.34920001f, 0.318599999f, -0.881200016f,
+	-0.0627529994f, 0.848022997f, -0.0447949991f, 0.392500013f, 0.0414000005f, 0.518599987f, 0.125f, -0.845799983f,
+	-0.0743039995f, 0.857825994f, -0.0498859994f, 0.393900007f, 0.0344000012f, 0.528199971f, 0.192900002f, -0.826900005f,
+	-0.0812380016f, 0.824496984f, -0.058056999f, 0.378500015f, 0.0370999984f, 0.615400016f, -0.0397999994f, -0.787199974f,
+	-0.0731180012f, 0.804139018f, -0.0490510017f, 0.372799993f, 0.0460000001f, 0.645299971f, -0.0786999986f, -0.759800017f,
+	-0.0456760004f, 0.795267999f, -0.159336999f, 0.1787f, 0.294999987f, 0.492300004f, 0.74879998f, -0.443699986f,
+	-0.0432199985f, 0.790292978f, -0.165006995f, 0.1787f, 0.291399986f, 0.492300004f, 0.74879998f, -0.443699986f,
+	-0.0464619994f, 0.794050992f, -0.162263006f, 0.179499999f, 0.293799996f, 0.492300004f, 0.74879998f, -0.443699986f,
+	0.0688590035f, 0.274342f, 0.0410410017f, 0.470800012f, 0.541700006f, 0.301499993f, -0.925300002f, -0.230000004f,
+	0.0670330003f, 0.276053011f, 0.0299190003f, 0.473399997f, 0.537199974f, 0.372999996f, -0.905900002f, -0.200599998f,
+	0.0742039979f, 0.280286014f, 0.0241369996f, 0.471100003f, 0.533200026f, 0.291900009f, -0.927399993f, -0.233799994f,
+	0.0773850009f, 0.278719008f, 0.0325190015f, 0.468499988f, 0.536300004f, 0.222499996f, -0.939599991f, -0.25999999f,
+	-0.0688590035f, 0.274342f, 0.0410410017f, 0.481900007f, 0.90259999f, -0.301499993f, -0.925300002f, -0.230000004f,
+	-0.0773850009f, 0.278719008f, 0.0325190015f, 0.484299988f, 0.907899976f, -0.222499996f, -0.939599991f, -0.25999999f,
+	-0.0742039979f, 0.280286014f, 0.0241369996f, 0.481700003f, 0.91109997f, -0.291900009f, -0.927399993f, -0.233799994f,
+	-0.0670330003f, 0.276053011f, 0.0299190003f, 0.479400009f, 0.907100022f, -0.372999996f, -0.905900002f, -0.200599998f,
+	0.0129699996f, 0.924311996f, -0.0420419984f, 0.137600005f, 0.653299987f, 0.467299998f, 0.541800022f, -0.698599994f,
+	0.0136700002f, 0.921651006f, -0.0437990017f, 0.136800006f, 0.65200001f, 0.431800008f, 0.573400021f, -0.69630003f,
+	0.0098679997f, 0.921154022f, -0.0465659983f, 0.1382f, 0.6505f, 0.477699995f, 0.532100022f, -0.699000001f,
+	0.00795300025f, 0.925500989f, -0.0447609983f, 0.139899999f, 0.65200001f, 0.5f, 0.510800004f, -0.699400008f,
+	0.0f, 1.04215205f, 0.0483059995f, 0.57130003f, 0.975300014f, 0.533500016f, -0.113899998f, -0.838100016f,
+	0.00341599993f, 1.05227005f, 0.0491049998f, 0.575800002f, 0.973500013f, 0.578299999f, 0.067900002f, -0.813000023f,
+	0.00595499994f, 1.03913498f, 0.0525069982f, 0.572399974f, 0.978699982f, 0.533100009f, -0.114100002f, -0.83829999f,
+	0.00856500026f, 1.05048299f, 0.0526160002f, 0.577000022f, 0.976199985f, 0.62529999f, 0.0956000015f, -0.774500012f,
+	0.00688300002f, 1.064502f, 0.0565860011f, 0.582300007f, 0.972199976f, 0.824199975f, 0.337099999f, -0.455000013f,
+	0.010892f, 1.05919802f, 0.0605939999f, 0.582400024f, 0.975700021f, 0.853100002f, 0.318699986f, -0.413100004f,
+	0.00685699983f, 1.07652104f, 0.0709839985f, 0.590799987f, 0.971599996f, 0.869899988f, 0.451200008f, -0.199100003f,
+	0.0112760002f, 1.06938899f, 0.0756250024f, 0.590699971f, 0.975899994f, 0.884500027f, 0.430000007f, -0.181299999f,
+	0.00518399989f, 1.08071196f, 0.0937440023f, 0.600700021f, 0.975000024f, 0.748600006f, 0.661899984f, 0.0373999998f,
+	0.0106239999f, 1.07465303f, 0.0951040015f, 0.599399984f, 0.978500009f, 0.753899992f, 0.654900014f, 0.0522999987f,
+	0.00765200006f, 1.07316196f, 0.113150001f, 0.606899977f, 0.982200027f, 0.787100017f, 0.552100003f, 0.275099993f,
+	0.004954f, 1.07731497f, 0.112898f, 0.607800007f, 0.980199993f, 0.81190002f, 0.539699972f, 0.222599998f,
+	0.00514499983f, 1.06571603f, 0.127869993f, 0.612200022f, 0.987600029f, 0.734399974f, 0.494700015f, 0.464700013f,
+	0.00300600007f, 1.06922197f, 0.127526f, 0.612999976f, 0.985800028f, 0.754599988f, 0.501699984f, 0.422899991f,
+	0.00210099993f, 1.054304f, 0.143004999f, 0.617600024f, 0.994400024f, 0.712199986f, 0.484200001f, 0.508300006f,
+	0.0537399985f, 0.74327898f, -0.147800997f, 0.121600002f, 0.558300018f, 0.48179999f, 0.577700019f, -0.658800006f,
+	0.0621040016f, 0.721415997f, -0.155851007f, 0.124399997f, 0.547500014f, 0.457899988f, 0.456099987f, -0.763100028f,
+	0.0499290004f, 0.719610989f, -0.164234996f, 0.130999997f, 0.549000025f, 0.514299989f, 0.431699991f, -0.740999997f,
+	0.0425000004f, 0.740522027f, -0.159136996f, 0.128900006f, 0.559099972f, 0.532599986f, 0.532800019f, -0.657700002f,
+	0.0358380005f, 0.755589008f, -0.145217001f, 0.124399997f, 0.567799985f, 0.400299996f, 0.704999983f, -0.585399985f,
+	0.043889001f, 0.75505197f, -0.140497997f, 0.1206f, 0.565900028f, 0.395300001f, 0.699800014f, -0.595000029f,
+	0.0877749994f, 0.777058005f, -0.0974640027f, 0.0885000005f, 0.450800002f, -0.0399999991f, 0.900200009f, -0.433499992f,
+	0.0901459977f, 0.778419971f, -0.0937639996f, 0.0868000016f, 0.449699998f, -0.00899999961f, 0.940299988f, -0.340299994f,
+	0.0983999968f, 0.776040971f, -0.100556001f, 0.0900999978f, 0.446099997f, 0.134299994f, 0.611899972f, -0.779500008f,
+	0.0946130008f, 0.773253024f, -0.103013001f, 0.0917000026f, 0.447899997f, 0.120499998f, 0.605599999f, -0.786599994f,
+	0.120196998f, 0.732282996f, -0.120130002f, 0.111900002f, 0.436399996f, 0.333900005f, 0.488299996f, -0.806299984f,
+	0.112438001f, 0.784964979f, -0.0908889994f, 0.0844999999f, 0.439399987f, 0.240799993f, 0.497900009f, -0.833100021f,
+	0.0912759975f, 0.726282001f, -0.137528002f, 0.118000001f, 0.450700015f, 0.396600008f, 0.526499987f, -0.751999974f,
+	0.0782919973f, 0.762013972f, -0.115976997f, 0.0988000035f, 0.455799997f, 0.326799989f, 0.572399974f, -0.752099991f,
+	0.141261995f, 0.767503977f, -0.0934880003f, 0.0922999978f, 0.426099986f, 0.316700011f, 0.444400012f, -0.838f,
+	0.161338001f, 0.739367008f, -0.0953629985f, 0.104199998f, 0.415899992f, 0.433499992f, 0.364199996f, -0.824299991f,
+	0.0744189993f, 0.722761989f, -0.147847995f, 0.121799998f, 0.458999991f, 0.422800004f, 0.383100003f, -0.82130003f,
+	0.0646400005f, 0.744266987f, -0.142849997f, 0.112199999f, 0.464300007f, 0.540799975f, 0.639199972f, -0.546800017f,
+	0.052480001f, 0.759465992f, -0.134802997f, 0.104099996f, 0.469300002f, 0.479099989f, 0.611800015f, -0.629400015f,
+	-0.00856100023f, 1.05048299f, 0.052618999f, 0.489800006f, 0.984000027f, -0.621900022f, 0.128900006f, -0.772400022f,
+	-0.0108829997f, 1.05919302f, 0.0606000014f, 0.494599998f, 0.986599982f, -0.814700007f, 0.357899994f, -0.45629999f,
+	-0.00655099982f, 1.06414199f, 0.0570150018f, 0.493200004f, 0.989600003f, -0.784300029f, 0.375800014f, -0.493600011f,
+	-0.00341599993f, 1.05227005f, 0.0491040014f, 0.487599999f, 0.986000001f, -0.579299986f, 0.0930000022f, -0.809800029f,
+	-0.00577200018f, 1.03986096f, 0.0520830005f, 0.486499995f, 0.980199993f, -0.522599995f, -0.1039f, -0.846199989f,
+	-0.00660800003f, 1.07659602f, 0.0709889978f, 0.500500023f, 0.993799984f, -0.862600029f, 0.457399994f, -0.216000006f,
+	-0.0114559997f, 1.06914604f, 0.0754529983f, 0.502099991f, 0.989600003f, -0.871399999f, 0.450100005f, -0.195299998f,
+	-0.0106250001f, 1.07465398f, 0.0951040015f, 0.511300027f, 0.99089998f, -0.830900013f, 0.554799974f, 0.0419999994f,
+	-0.00583499996f, 1.08183897f, 0.0937760025f, 0.511099994f, 0.994899988f, -0.832199991f, 0.553799987f, 0.0265999995f,
+	-0.00766200013f, 1.07317495f, 0.113155998f, 0.519599974f, 0.990199983f, -0.808799982f, 0.513999999f, 0.285600007f,
+	-0.00504799979f, 1.07746696f, 0.112965003f, 0.519699991f, 0.992500007f, -0.822000027f, 0.513100028f, 0.247099996f,
+	-0.0051409998f, 1.06571102f, 0.127866f, 0.526499987f, 0.987299979f, -0.735199988f, 0.491600007f, 0.466600001f,
+	-0.00300500006f, 1.06921899f, 0.127524003f, 0.526600003f, 0.989099979f, -0.751999974f, 0.499799997f, 0.429800004f,
+	-0.00209999993f, 1.05430198f, 0.143004f, 0.533999979f, 0.982900023f, -0.713f, 0.483599991f, 0.507700026f,
+	0.0f, 1.04215205f, 0.0483059995f, 0.484200001f, 0.982599974f, -0.514500022f, -0.106600001f, -0.850899994f,
+	0.111279003f, 0.792159975f, -0.0887679979f, 0.0870999992f, 0.563000023f, -0.261799991f, 0.755599976f, -0.600399971f,
+	0.0984909981f, 0.780884981f, -0.098679997f, 0.0844999999f, 0.554400027f, -0.330500007f, 0.806200027f, -0.49059999f,
+	0.0940369964f, 0.781509995f, -0.0946509987f, 0.0870999992f, 0.55339998f, -0.315899998f, 0.796400011f, -0.515699983f,
+	0.111332998f, 0.798021972f, -0.0816560015f, 0.0905999988f, 0.565199971f, -0.252200007f, 0.747699976f, -0.614300013f,
+	-0.0568219982f, 0.80687499f, -0.135544002f, 0.0520000011f, 0.407099992f, -0.523599982f, 0.322299987f, -0.788600028f,
+	-0.0565930009f, 0.810491979f, -0.134139001f, 0.0504000001f, 0.406500012f, -0.52759999f, 0.336199999f, -0.780099988f,
+	-0.0436809994f, 0.814132988f, -0.141302004f, 0.0522000007f, 0.399800003f, -0.512499988f, 0.285299987f, -0.809899986f,
+	-0.0468729995f, 0.808965981f, -0.140998006f, 0.0537f, 0.402200013f, -0.505699992f, 0.263999999f, -0.82130003f,
+	-0.0456760004f, 0.795267999f, -0.159336999f, 0.0281000007f, 0.385899991f, -0.752600014f, 0.654799998f, -0.0700000003f,
+	-0.0464619994f, 0.794050992f, -0.162263006f, 0.0296f, 0.385899991f, -0.752600014f, 0.654799998f, -0.0700000003f,
+	-0.0495360009f, 0.790401995f, -0.163360998f, 0.0309999995f, 0.387600005f, -0.752600014f, 0.654799998f, -0.0700000003f,
+	-0.108970001f, 0.877390981f, 0.105209f, 0.522800028f, 0.208499998f, -0.695800006f, -0.0478999987f, 0.716600001f,
+	-0.11868f, 0.905547023f, 0.0976639986f, 0.511399984f, 0.200900003f, -0.821399987f, 0.0612000003f, 0.566999972f,
+	-0.122962996f, 0.893841982f, 0.0927229971f, 0.517099977f, 0.199000001f, -0.768899977f, 0.0278999992f, 0.638800025f,
+	-0.125529006f, 0.928412974f, 0.0802970007f, 0.502699971f, 0.191f, -0.921899974f, 0.209299996f, 0.325899988f,
+	-0.131363004f, 0.908369005f, 0.0771780014f, 0.512099981f, 0.189999998f, -0.878400028f, 0.194299996f, 0.436500013f,
+	-0.128004998f, 0.939473987f, 0.0555570014f, 0.498699993f, 0.179499999f, -0.95660001f, 0.282700002f, 0.0709000006f,
+	-0.134608001f, 0.918052018f, 0.053975001f, 0.50880003f, 0.179199994f, -0.948000014f, 0.29519999f, 0.118699998f,
+	-0.127072006f, 0.93897903f, 0.0388870016f, 0.4991f, 0.172000006f, -0.93690002f, 0.307099998f, -0.167099997f,
+	-0.134210005f, 0.918964982f, 0.0420360006f, 0.508599997f, 0.173800007f, -0.940699995f, 0.316199988f, -0.122400001f,
+	-0.124076001f, 0.932154f, 0.0235699993f, 0.501900017f, 0.164900005f, -0.874000013f, 0.268400013f, -0.405000001f,
+	-0.131793007f, 0.916468978f, 0.0304780006f, 0.509500027f, 0.168500006f, -0.891700029f, 0.2579f, -0.371899992f,
+	-0.114643998f, 0.90772599f, -0.000414999988f, 0.511600018f, 0.152400002f, -0.722000003f, 0.209700003f, -0.659300029f,
+	-0.120330997f, 0.902402997f, 0.00412000017f, 0.514500022f, 0.155100003f, -0.749599993f, 0.216399997f, -0.625500023f,
+	-0.109171003f, 0.892206013f, -0.00832900032f, 0.517700016f, 0.147f, -0.686600029f, 0.123300001f, -0.716499984f,
+	-0.00791900046f, 0.905834019f, -0.0476760007f, 0.134599999f, 0.660399973f, -0.565400004f, 0.511300027f, -0.647199988f,
+	-0.00980199967f, 0.902072012f, -0.0495150015f, 0.136299998f, 0.659200013f, -0.615199983f, 0.572700024f, -0.541800022f,
+	-0.0154149998f, 0.898483992f, -0.0469340011f, 0.139300004f, 0.660399973f, -0.513599992f, 0.449999988f, -0.730599999f,
+	-0.01664f, 0.901744008f, -0.0444520004f, 0.138799995f, 0.662199974f, -0.479299992f, 0.41049999f, -0.775699973f,
+	-0.0565930009f, 0.810491979f, -0.134139001f, 0.154499993f, 0.399800003f, -0.0632999986f, 0.931599975f, 0.357899994f,
+	-0.0511859991f, 0.810029984f, -0.131969005f, 0.152700007f, 0.397799999f, -0.0636000037f, 0.931900024f, 0.356999993f,
+	-0.0367190018f, 0.814215004f, -0.140313998f, 0.154499993f, 0.390199989f, -0.0626000017f, 0.930999994f, 0.359600008f,
+	-0.0436809994f, 0.814132988f, -0.141302004f, 0.155900002f, 0.393099993f, -0.0621999986f, 0.930499971f, 0.360900015f,
+	-0.0f, 0.765776992f, -0.0681020021f, 0.50999999f, 0.336499989f, 0.225099996f, 0.7245f, -0.65140003f,
+	-0.0f, 0.759781003f, -0.0747160017f, 0.50999999f, 0.332500011f, 0.223900005f, 0.722100019f, -0.654600024f,
+	-0.027524f, 0.77620101f, -0.0660180002f, 0.522800028f, 0.34040001f, 0.234400004f, 0.744199991f, -0.625500023f,
+	-0.0238380004f, 0.778095007f, -0.0623110011f, 0.521099985f, 0.342299998f, 0.236900002f, 0.749199986f, -0.618499994f,
+	0.0238380004f, 0.778095007f, -0.0623110011f, 0.476099998f, 0.488599986f, -0.241500005f, 0.739799976f, -0.628000021f,
+	0.027524f, 0.77620101f, -0.0660180002f, 0.474400014f, 0.486799985f, -0.2456f, 0.7421f, -0.623600006f,
+	-0.0f, 0.759781003f, -0.0747160017f, 0.487199992f, 0.478899986f, -0.219699994f, 0.726800025f, -0.65079999f,
+	-0.0f, 0.765776992f, -0.0681020021f, 0.487199992f, 0.482899994f, -0.214599997f, 0.72359997f, -0.656000018f,
+	0.108970001f, 0.877390981f, 0.105209f, 0.378800005f, 0.113200001f, 0.695800006f, -0.0478999987f, 0.716600001f,
+	0.122962996f, 0.893841982f, 0.0927229971f, 0.388200015f, 0.107799999f, 0.768899977f, 0.0278999992f, 0.638800025f,
+	0.11868f, 0.905547023f, 0.0976639986f, 0.386400014f, 0.102300003f, 0.821399987f, 0.0612000003f, 0.566999972f,
+	0.125529006f, 0.928412974f, 0.0802970007f, 0.396200001f, 0.0940999985f, 0.921899974f, 0.209299996f, 0.325899988f,
+	0.131363004f, 0.908369005f, 0.0771780014f, 0.396899998f, 0.103200004f, 0.878400028f, 0.194299996f, 0.4366f,
+	0.128004998f, 0.939473987f, 0.0555570014f, 0.407299995f, 0.0905999988f, 0.95660001f, 0.282799989f, 0.0710000023f,
+	0.134609997f, 0.918052971f, 0.053975001f, 0.409999996f, 0.100199997f, 0.958599985f, 0.273699999f, 0.0788000003f,
+	0.127072006f, 0.93897903f, 0.0388870016f, 0.414499998f, 0.0912000015f, 0.944100022f, 0.285899997f, -0.164299995f,
+	0.131793007f, 0.916468024f, 0.0304780006f, 0.417600006f, 0.101199999f, 0.911899984f, 0.247299999f, -0.327600002f,
+	0.124076001f, 0.932154f, 0.0235699993f, 0.421299994f, 0.0939999968f, 0.874000013f, 0.268299997f, -0.405000001f,
+	0.120330997f, 0.902402997f, 0.00412000017f, 0.430400014f, 0.106399998f, 0.749599993f, 0.216399997f, -0.625500023f,
+	0.114643998f, 0.90772599f, -0.000414999988f, 0.433200002f, 0.103600003f, 0.722000003f, 0.209700003f, -0.659300029f,
+	0.109171003f, 0.892206013f, -0.00832900032f, 0.438199997f, 0.109700002f, 0.686600029f, 0.123199999f, -0.716499984f,
+	-0.00707500009f, 0.994929016f, 0.156100005f, 0.586799979f, 0.923799992f, -0.69749999f, -0.0227000006f, 0.716199994f,
+	-0.00320699997f, 0.999315023f, 0.160223007f, 0.586799979f, 0.9278f, -0.755200028f, 0.0326000005f, 0.654699981f,
+	-0.00466400012f, 1.03093195f, 0.154198006f, 0.574000001f, 0.934199989f, -0.667900026f, 0.180000007f, 0.722199976f,
+	-0.0117419995f, 1.02196205f, 0.150064006f, 0.574999988f, 0.928600013f, -0.609899998f, 0.136600003f, 0.780600011f,
+	-0.00868999958f, 1.05079198f, 0.143814996f, 0.56400001f, 0.93629998f, -0.725300014f, 0.342799991f, 0.597000003f,
+	-0.0175979994f, 1.03808105f, 0.140518993f, 0.566100001f, 0.92930001f, -0.664699972f, 0.308699995f, 0.680400014f,
+	-0.0119169997f, 1.06374097f, 0.128726006f, 0.555000007f, 0.936200023f, -0.771700025f, 0.447600007f, 0.451900005f,
+	-0.0212900005f, 1.04637599f, 0.130328998f, 0.559800029f, 0.92869997f, -0.7245f, 0.442499995f, 0.528400004f,
+	-0.0148820002f, 1.07062995f, 0.114952996f, 0.547999978f, 0.935100019f, -0.836099982f, 0.484400004f, 0.257400006f,
+	-0.0245820004f, 1.05308795f, 0.116664f, 0.552699983f, 0.927299976f, -0.824199975f, 0.480100006f, 0.300399989f,
+	-0.0173530001f, 1.071661f, 0.0965040028f, 0.540499985f, 0.931400001f, -0.895299971f, 0.4454f, 9.99999975e-05f,
+	-0.0256280005f, 1.05484998f, 0.102270998f, 0.546500027f, 0.924899995f, -0.913500011f, 0.406800002f, -0.00159999996f,
+	-0.0174150001f, 1.06712496f, 0.0794019997f, 0.534099996f, 0.926500022f, -0.938399971f, 0.270599991f, -0.2148f,
+	-0.0225549992f, 1.05190694f, 0.0881239995f, 0.540700018f, 0.921500027f, -0.95389998f, 0.188299999f, -0.233500004f,
+	-0.0186379999f, 1.04997802f, 0.0688389987f, 0.532599986f, 0.917500019f, -0.890399992f, 0.126499996f, -0.437299997f,
+	-0.0142890001f, 1.056216f, 0.0628290027f, 0.528599977f, 0.91930002f, -0.875699997f, 0.0339000002f, -0.481700003f,
+	-0.0116149997f, 1.04407895f, 0.061751999f, 0.529100001f, 0.913600028f, -0.854900002f, -0.162400007f, -0.492700011f,
+	-0.00856100023f, 1.05048299f, 0.052618999f, 0.524200022f, 0.915400028f, -0.885599971f, -0.185000002f, -0.425900012f,
+	-0.00577200018f, 1.03986096f, 0.0520830005f, 0.524699986f, 0.910399973f, -0.87470001f, -0.207499996f, -0.437999994f,
+	0.0652030036f, 0.284025997f, 0.00593699981f, 0.4824f, 0.588f, 0.327600002f, -0.810299993f, -0.485900015f,
+	0.0708649978f, 0.28165701f, 0.0168609992f, 0.48269999f, 0.593699992f, 0.464399993f, -0.784600019f, -0.410899997f,
+	0.0667359978f, 0.279110014f, 0.0170569997f, 0.484800011f, 0.593100011f, 0.443800002f, -0.795400023f, -0.412800014f,
+	0.0614780001f, 0.280689001f, 0.00910899974f, 0.485000014f, 0.588699996f, 0.330799997f, -0.815199971f, -0.475499988f,
+	0.042498f, 0.290962994f, -0.0153980004f, 0.485500008f, 0.573899984f, 0.309599996f, -0.767400026f, -0.561500013f,
+	0.0425049998f, 0.28728801f, -0.0104900002f, 0.487100005f, 0.576200008f, 0.322899997f, -0.757399976f, -0.567600012f,
+	-0.0652030036f, 0.284025997f, 0.00593699981f, 0.454699993f, 0.847199976f, -0.327600002f, -0.810299993f, -0.485900015f,
+	-0.0614780001f, 0.280689001f, 0.00910899974f, 0.452100009f, 0.846499979f, -0.330799997f, -0.815199971f, -0.475499988f,
+	-0.0667359978f, 0.279110014f, 0.0170569997f, 0.452300012f, 0.842199981f, -0.443800002f, -0.795400023f, -0.412800014f,
+	-0.0708649978f, 0.28165701f, 0.0168609992f, 0.454400003f, 0.841499984f, -0.464399993f, -0.784600019f, -0.410899997f,
+	-0.042498f, 0.290962994f, -0.0153980004f, 0.451700002f, 0.861299992f, -0.309599996f, -0.767400026f, -0.561500013f,
+	-0.0425049998f, 0.28728801f, -0.0104900002f, 0.450100005f, 0.859099984f, -0.322899997f, -0.757399976f, -0.567600012f,
+	-0.0214869995f, 0.327082008f, 0.0834000036f, 0.40200001f, 0.859499991f, 0.280699998f, -0.863600016f, 0.418799996f,
+	-0.0246600006f, 0.324027002f, 0.078873001f, 0.404500008f, 0.858099997f, 0.270399988f, -0.872900009f, 0.405999988f,
+	-0.0088449996f, 0.322391003f, 0.0553920008f, 0.414099991f, 0.866699994f, 0.702099979f, -0.702199996f, 0.118199997f,
+	-0.0038089999f, 0.327964008f, 0.0575329997f, 0.412f, 0.869599998f, 0.69569999f, -0.698800027f, 0.166700006f,
+	-0.0429919995f, 0.328377008f, 0.0918300003f, 0.398799986f, 0.8495f, -0.0252f, -0.845399976f, 0.533599973f,
+	-0.0429619998f, 0.324528992f, 0.0856529996f, 0.402099997f, 0.849600017f, -0.0196000002f, -0.848699987f, 0.528500021f,
+	-0.0634550005f, 0.327789992f, 0.0813269988f, 0.403400004f, 0.84009999f, -0.435400009f, -0.81279999f, 0.386999995f,
+	-0.0587700009f, 0.323917001f, 0.0784580037f, 0.405400008f, 0.842400014f, -0.395300001f, -0.813199997f, 0.427100003f,
+	-0.0747110024f, 0.328799009f, 0.0576899983f, 0.412999988f, 0.833000004f, -0.600899994f, -0.797699988f, 0.0513000004f,
+	-0.0701970011f, 0.325206012f, 0.0555430017f, 0.414600015f, 0.835300028f, -0.621100008f, -0.783699989f, 0.00480000023f,
+	-0.0716930032f, 0.331405014f, 0.0326899998f, 0.424100012f, 0.83039999f, -0.588500023f, -0.793799996f, -0.153799996f,
+	-0.0678900033f, 0.328108996f, 0.0351510011f, 0.423700005f, 0.832899988f, -0.59799999f, -0.786000013f, -0.156900004f,
+	-0.0116940001f, 0.323058009f, 0.0338059999f, 0.423599988f, 0.869499981f, 0.730000019f, -0.675599992f, -0.102899998f,
+	-0.00801199954f, 0.327243f, 0.0319169983f, 0.423500001f, 0.872200012f, 0.724300027f, -0.682299972f, -0.0996000022f,
+	0.0214869995f, 0.327082008f, 0.0834000036f, 0.394699991f, 0.566100001f, -0.280699998f, -0.863600016f, 0.418799996f,
+	0.0038089999f, 0.327964008f, 0.0575329997f, 0.384799987f, 0.555999994f, -0.69569999f, -0.698800027f, 0.166700006f,
+	0.0088449996f, 0.322391003f, 0.0553920008f, 0.382699996f, 0.558799982f, -0.702099979f, -0.702199996f, 0.118199997f,
+	0.0246600006f, 0.324027002f, 0.078873001f, 0.392199993f, 0.567399979f, -0.270399988f, -0.872900009f, 0.405999988f,
+	0.0429919995f, 0.328377008f, 0.0918300003f, 0.397899985f, 0.575999975f, 0.0252f, -0.845399976f, 0.533599973f,
+	0.00801199954f, 0.327243f, 0.0319169983f, 0.373299986f, 0.553300023f, -0.724300027f, -0.682299972f, -0.0996000022f,
+	0.0116940001f, 0.323058009f, 0.0338059999f, 0.373199999f, 0.555899978f, -0.730000019f, -0.675599992f, -0.102899998f,
+	0.0429619998f, 0.324528992f, 0.0856529996f, 0.394600004f, 0.575900018f, 0.0196000002f, -0.848699987f, 0.528500021f,
+	0.0587700009f, 0.323917001f, 0.0784580037f, 0.391400009f, 0.583100021f, 0.395300001f, -0.813199997f, 0.427100003f,
+	0.0634550005f, 0.327789992f, 0.0813269988f, 0.393299997f, 0.585399985f, 0.435400009f, -0.81279999f, 0.386999995f,
+	0.0701970011f, 0.325206012f, 0.0555430017f, 0.382200003f, 0.590200007f, 0.621100008f, -0.783699989f, 0.00480000023f,
+	0.0747110024f, 0.328799009f, 0.0576899983f, 0.3838f, 0.592400014f, 0.600899994f, -0.797699988f, 0.0513000004f,
+	0.0678900033f, 0.328108996f, 0.0351510011f, 0.373100013f, 0.592599988f, 0.59799999f, -0.786000013f, -0.156900004f,
+	0.0716930032f, 0.331405014f, 0.0326899998f, 0.372599989f, 0.595099986f, 0.588500023f, -0.793799996f, -0.153799996f,
+	-0.0942910016f, 0.81023699f, -0.106573999f, 0.173800007f, 0.373600006f, -0.539300025f, 0.240500003f, -0.806999981f,
+	-0.0958660021f, 0.804917991f, -0.107116997f, 0.176300004f, 0.373899996f, -0.535000026f, 0.241099998f, -0.809700012f,
+	-0.132404f, 0.815711975f, -0.0816759989f, 0.172900006f, 0.394400001f, -0.462900013f, 0.392399997f, -0.794799984f,
+	-0.131600007f, 0.821362019f, -0.0792689994f, 0.170100003f, 0.394899994f, -0.459300011f, 0.402799994f, -0.791700006f,
+	-0.0679439977f, 0.807694972f, -0.126332f, 0.174099997f, 0.358700007f, -0.588f, 0.121699996f, -0.799700022f,
+	-0.0625500008f, 0.815204978f, -0.129252002f, 0.170499995f, 0.356099993f, -0.58920002f, 0.112099998f, -0.800100029f,
+	-0.0280809999f, 0.901315987f, 0.0122880004f, 0.50999999f, 0.476200014f, 0.81400001f, 0.575299978f, -0.0800999999f,
+	-0.0198090002f, 0.886995971f, -0.0119909998f, 0.499199986f, 0.468400002f, 0.749599993f, 0.619300008f, -0.233700007f,
+	-0.0261160005f, 0.892561972f, -0.0174700003f, 0.501800001f, 0.464700013f, 0.761500001f, 0.609200001f, -0.221399993f,
+	-0.0344600007f, 0.909777999f, 0.00564499991f, 0.513499975f, 0.471700013f, 0.818899989f, 0.568899989f, -0.0755999982f,
+	-0.0327589996f, 0.90942198f, 0.0309030004f, 0.516799986f, 0.48269999f, 0.792500019f, 0.600000024f, -0.108900003f,
+	-0.0155109996f, 0.871927023f, -0.0286490005f, 0.490200013f, 0.463200003f, 0.761399984f, 0.470899999f, -0.445600003f,
+	-0.0207630005f, 0.876492977f, -0.0327470005f, 0.492399991f, 0.460299999f, 0.771700025f, 0.487300009f, -0.408800006f,
+	-0.0142679997f, 0.844323993f, -0.0468549989f, 0.476500005f, 0.456900001f, 0.872699976f, 0.252200007f, -0.418099999f,
+	-0.0188410003f, 0.849937022f, -0.053371001f, 0.478899986f, 0.453099996f, 0.881900012f, 0.266200006f, -0.388999999f,
+	-0.0142550003f, 0.817873001f, -0.0576220006f, 0.463999987f, 0.453399986f, 0.841099977f, 0.0110999998f, -0.540700018f,
+	-0.0183300003f, 0.821973026f, -0.0638850033f, 0.465700001f, 0.449900001f, 0.851400018f, 0.0568999983f, -0.521300018f,
+	-0.0238380004f, 0.778095007f, -0.0623110011f, 0.445600003f, 0.450100005f, 0.757499993f, -0.133000001f, -0.639100015f,
+	-0.0290290006f, 0.778268993f, -0.0684330016f, 0.445499986f, 0.446500003f, 0.730099976f, -0.196199998f, -0.654500008f,
+	-0.027524f, 0.77620101f, -0.0660180002f, 0.444599986f, 0.44780001f, 0.717899978f, -0.241699994f, -0.652899981f,
+	-0.0337200016f, 0.766076028f, -0.0680560023f, 0.439599991f, 0.4454f, 0.683700025f, -0.353899986f, -0.638199985f,
+	-0.0317890011f, 0.766843975f, -0.0663489997f, 0.439999998f, 0.44659999f, 0.695599973f, -0.317299992f, -0.644599974f,
+	-0.0212949999f, 0.764362991f, -0.0535579994f, 0.43900001f, 0.453999996f, 0.716300011f, -0.497200012f, -0.489600003f,
+	-0.0444680005f, 0.741358995f, -0.0639109984f, 0.427399993f, 0.443599999f, 0.718200028f, -0.510900021f, -0.47240001f,
+	-0.0317960009f, 0.754328012f, -0.0536449999f, 0.433200002f, 0.451000005f, 0.689300001f, -0.721899986f, 0.0610999987f,
+	-0.040213f, 0.918631017f, 0.0281949993f, 0.521499991f, 0.479799986f, 0.788100004f, 0.60589999f, -0.1087f,
+	-0.0375399999f, 0.921698987f, 0.0509640016f, 0.525399983f, 0.489499986f, 0.67750001f, 0.626600027f, -0.38530001f,
+	-0.0305850003f, 0.910768986f, 0.0454120003f, 0.518999994f, 0.489100009f, 0.715699971f, 0.606100023f, -0.34709999f,
+	-0.0223420002f, 0.920647025f, 0.0657709986f, 0.523599982f, 0.499000013f, 0.494700015f, 0.574199975f, -0.6523f,
+	-0.0177590009f, 0.908704996f, 0.0592270009f, 0.517199993f, 0.497500002f, 0.488200009f, 0.558799982f, -0.670400023f,
+	-0.0f, 0.917850018f, 0.073439002f, 0.51849997f, 0.508599997f, -0.0027999999f, 0.590799987f, -0.806800008f,
+	-0.0f, 0.905682027f, 0.0644700006f, 0.512799978f, 0.504800022f, -0.00359999994f, 0.590699971f, -0.806900024f,
+	0.0223420002f, 0.920647025f, 0.0657709986f, 0.511799991f, 0.51700002f, -0.480800003f, 0.558499992f, -0.675899982f,
+	0.0177590009f, 0.908704996f, 0.0592270009f, 0.5079f, 0.511799991f, -0.460599989f, 0.572099984f, -0.678600013f,
+	0.0375390016f, 0.921698987f, 0.0509640016f, 0.503799975f, 0.522400022f, -0.701399982f, 0.60589999f, -0.375400007f,
+	0.0305840001f, 0.910768986f, 0.0454120003f, 0.500800014f, 0.516700029f, -0.718800008f, 0.618399978f, -0.317600012f,
+	0.0402120017f, 0.918631017f, 0.0281949993f, 0.493299991f, 0.522800028f, -0.792999983f, 0.598399997f, -0.114f,
+	0.0327589996f, 0.90942198f, 0.0309030004f, 0.494199991f, 0.51730001f, -0.788699985f, 0.602500021f, -0.122000001f,
+	0.0280809999f, 0.901315987f, 0.0122880004f, 0.485399991f, 0.513700008f, -0.810199976f, 0.584299982f, -0.0478000008f,
+	0.0344600007f, 0.909777999f, 0.00564499991f, 0.48269999f, 0.518700004f, -0.806400001f, 0.588500023f, -0.0579999983f,
+	0.0198090002f, 0.886995971f, -0.0119909998f, 0.47389999f, 0.506900012f, -0.766499996f, 0.592899978f, -0.247099996f,
+	0.0261160005f, 0.892561972f, -0.0174700003f, 0.471599996f, 0.510900021f, -0.755599976f, 0.601999998f, -0.25819999f,
+	0.0207630005f, 0.876492977f, -0.0327470005f, 0.463699996f, 0.504100025f, -0.760900021f, 0.512799978f, -0.397700012f,
+	0.0155100003f, 0.871927023f, -0.0286490005f, 0.46540001f, 0.500899971f, -0.772599995f, 0.486499995f, -0.407999992f,
+	0.0188410003f, 0.849937022f, -0.053371001f, 0.451700002f, 0.494700015f, -0.871399999f, 0.256000012f, -0.418500006f,
+	0.0142679997f, 0.844323993f, -0.0468549989f, 0.454100013f, 0.490999997f, -0.878799975f, 0.229800001f, -0.418199986f,
+	0.0183300003f, 0.821973026f, -0.0638850033f, 0.443300009f, 0.483999997f, -0.851899981f, 0.052099999f, -0.521099985f,
+	0.014254f, 0.817873001f, -0.0576220006f, 0.445800006f, 0.481000006f, -0.837800026f, 0.00620000018f, -0.545899987f,
+	0.0290290006f, 0.778268993f, -0.0684330016f, 0.431899995f, 0.466800004f, -0.73299998f, -0.193900004f, -0.65200001f,
+	0.0238380004f, 0.778095007f, -0.0623110011f, 0.435299993f, 0.465499997f, -0.755200028f, -0.123099998f, -0.64380002f,
+	0.0337200016f, 0.766076028f, -0.0680560023f, 0.428799987f, 0.461800009f, -0.701200008f, -0.414900005f, -0.57980001f,
+	0.031787999f, 0.766843975f, -0.0663489997f, 0.430000007f, 0.461800009f, -0.694999993f, -0.314599991f, -0.646600008f,
+	0.027524f, 0.77620101f, -0.0660180002f, 0.432799995f, 0.465499997f, -0.716300011f, -0.242699996f, -0.654200017f,
+	0.0317960009f, 0.754328012f, -0.0536449999f, 0.432700008f, 0.4542f, -0.702600002f, -0.502699971f, -0.503600001f,
+	0.0212949999f, 0.764362991f, -0.0535579994f, 0.437000006f, 0.459100008f, -0.581399977f, -0.583299994f, -0.567200005f,
+	0.0444669984f, 0.741358995f, -0.0639109984f, 0.424199998f, 0.450300008f, -0.790600002f, -0.41870001f, -0.44690001f,
+	-0.042555999f, 0.227514997f, -0.147214994f, 0.819100022f, 0.240899995f, -0.405699998f, -0.241899997f, -0.881399989f,
+	-0.0305819996f, 0.227125004f, -0.153015003f, 0.819299996f, 0.246999994f, -0.427899987f, -0.258300006f, -0.866100013f,
+	-0.000814000028f, 0.168145999f, -0.150135994f, 0.792400002f, 0.260100007f, -0.26879999f, -0.142100006f, -0.952700019f,
+	0.000497000001f, 0.141154006f, -0.146702006f, 0.780099988f, 0.260500014f, -0.2579f, -0.134200007f, -0.956799984f,
+	-0.0721049979f, 0.796908021f, -0.144231007f, 0.0394000001f, 0.396499991f, -0.877200007f, 0.448000014f, -0.172800004f,
+	-0.0774519965f, 0.775426984f, -0.154413f, 0.0421000011f, 0.385899991f, -0.91079998f, 0.33860001f, -0.236100003f,
+	-0.0801410004f, 0.773739994f, -0.146456003f, 0.0456999987f, 0.387400001f, -0.908599973f, 0.33860001f, -0.244399995f,
+	-0.0759370029f, 0.791961014f, -0.137816995f, 0.0434000008f, 0.396400005f, -0.882300019f, 0.422399998f, -0.207399994f,
+	-0.0625500008f, 0.815204978f, -0.129252002f, 0.0381999984f, 0.407999992f, -0.835600019f, 0.531899989f, -0.1373f,
+	-0.0679439977f, 0.807694972f, -0.126332f, 0.0419999994f, 0.405800015f, -0.829999983f, 0.53549999f, -0.156100005f,
+	0.000497000001f, 0.141154006f, -0.146702006f, 0.84920001f, 0.307000011f, 0.237000003f, -0.1523f, -0.959500015f,
+	-0.000814000028f, 0.168145999f, -0.150135994f, 0.858799994f, 0.299100012f, 0.128299996f, -0.119000003f, -0.984600008f,
+	0.0289580002f, 0.228930995f, -0.153605998f, 0.888999999f, 0.293500006f, 0.456800014f, -0.216000006f, -0.862999976f,
+	0.0421230011f, 0.228530005f, -0.146038994f, 0.892499983f, 0.299499989f, 0.480699986f, -0.222599998f, -0.848200023f,
+	0.112438001f, 0.784964979f, -0.0908889994f, 0.124499999f, 0.466500014f, 0.389499992f, 0.318699986f, -0.864099979f,
+	0.0983999968f, 0.776040971f, -0.100556001f, 0.122400001f, 0.458000004f, 0.386299998f, 0.326700002f, -0.862600029f,
+	0.0984909981f, 0.780884981f, -0.098679997f, 0.124499999f, 0.458999991f, 0.386900008f, 0.325199991f, -0.862900019f,
+	0.111279003f, 0.792159975f, -0.0887679979f, 0.127800003f, 0.467299998f, 0.389999986f, 0.317600012f, -0.864300013f,
+	0.0425000004f, 0.740522027f, -0.159136996f, 0.0544000007f, 0.554400027f, 0.809199989f, 0.462599993f, -0.362300009f,
+	0.0499290004f, 0.719610989f, -0.164234996f, 0.0511000007f, 0.54460001f, 0.747900009f, 0.395700008f, -0.532999992f,
+	0.0468659997f, 0.71815598f, -0.169614002f, 0.0535000004f, 0.542999983f, 0.759299994f, 0.391600013f, -0.519599974f,
+	0.0400869995f, 0.742426991f, -0.162207007f, 0.056400001f, 0.5546f, 0.797500014f, 0.499300003f, -0.33860001f,
+	0.0358380005f, 0.755589008f, -0.145217001f, 0.0535000004f, 0.564100027f, 0.677699983f, 0.653699994f, -0.336899996f,
+	0.0304109994f, 0.760356009f, -0.146577001f, 0.0560999997f, 0.566200018f, 0.666700006f, 0.660600007f, -0.344999999f,
+	0.00629300019f, 0.820904016f, -0.153014004f, 0.933099985f, 0.240899995f, 0.705600023f, 0.00850000046f, -0.708599985f,
+	0.00904699974f, 0.821255982f, -0.146643996f, 0.93629998f, 0.240799993f, 0.999899983f, 0.00730000017f, 0.00749999983f,
+	0.010179f, 0.668109f, -0.146754995f, 0.934499979f, 0.310299993f, 0.999899983f, 0.00820000004f, 0.0148f,
+	0.00733100018f, 0.668111026f, -0.154024005f, 0.930999994f, 0.310200006f, 0.71390003f, 0.00970000029f, -0.700200021f,
+	0.00631899992f, 0.821422994f, -0.140239f, 0.939300001f, 0.240799993f, 0.692399979f, 0.00620000018f, 0.721499979f,
+	0.00716400007f, 0.668121994f, -0.139716998f, 0.93809998f, 0.310400009f, 0.690599978f, 0.00630000001f, 0.723200023f,
+	4.19999997e-05f, 0.821211994f, -0.137874007f, 0.942200005f, 0.240999997f, -0.0254999995f, 0.00730000017f, 0.999599993f,
+	-0.000627000001f, 0.668121994f, -0.136807993f, 0.941999972f, 0.310400009f, -0.0388999991f, 0.00719999988f, 0.999199986f,
+	-0.00591900013f, 0.820694029f, -0.140702993f, 0.945100009f, 0.2412f, -0.704699993f, 0.0100999996f, 0.709399998f,
+	-0.007369f, 0.668121994f, -0.139926001f, 0.9454f, 0.310400009f, -0.712400019f, 0.0100999996f, 0.701699972f,
+	-0.00845499989f, 0.820629001f, -0.146240994f, 0.948000014f, 0.241300002f, -0.99879998f, 0.0119000003f, 0.0474999994f,
+	-0.0101229995f, 0.668121994f, -0.146098003f, 0.948300004f, 0.310400009f, -0.998000026f, 0.0111999996f, 0.0626000017f,
+	-0.00611199997f, 0.820789993f, -0.153024003f, 0.951399982f, 0.2412f, -0.720000029f, 0.0125000002f, -0.693799973f,
+	-0.00793899968f, 0.668121994f, -0.153292f, 0.951499999f, 0.310400009f, -0.764100015f, 0.00930000003f, -0.644999981f,
+	0.000163999997f, 0.820711017f, -0.155481994f, 0.954599977f, 0.2412f, 0.00760000013f, 0.0105999997f, -0.999899983f,
+	-0.000195999994f, 0.668121994f, -0.157140002f, 0.955299973f, 0.310400009f, -0.0333999991f, 0.00889999978f, -0.99940002f,
+	0.00629300019f, 0.820904016f, -0.153014004f, 0.957499981f, 0.240999997f, 0.705600023f, 0.00850000046f, -0.708599985f,
+	0.00733100018f, 0.668111026f, -0.154024005f, 0.959100008f, 0.310299993f, 0.71390003f, 0.00970000029f, -0.700200021f,
+	0.0304109994f, 0.760356009f, -0.146577001f, 0.0296f, 0.569500029f, 0.487500012f, 0.298599988f, -0.820500016f,
+	0.0430889986f, 0.759548008f, -0.139596999f, 0.0276999995f, 0.563199997f, 0.478899986f, 0.253699988f, -0.840399981f,
+	0.043889001f, 0.75505197f, -0.140497997f, 0.0296f, 0.562399983f, 0.482199997f, 0.270200014f, -0.833400011f,
+	0.0358380005f, 0.755589008f, -0.145217001f, 0.0308999997f, 0.566399992f, 0.493299991f, 0.332300007f, -0.803900003f,
+	0.0430889986f, 0.759548008f, -0.139596999f, 0.164199993f, 0.543200016f, -0.0667999983f, 0.990700006f, 0.118600003f,
+	0.0304109994f, 0.760356009f, -0.146577001f, 0.162799999f, 0.536800027f, -0.138099998f, 0.923500001f, 0.35769999f,
+	0.0242040008f, 0.758969009f, -0.145393997f, 0.164199993f, 0.534200013f, -0.0995000005f, 0.968699992f, 0.227300003f,
+	0.0370149985f, 0.758846998f, -0.133838996f, 0.167500004f, 0.541299999f, -0.0511999987f, 0.996399999f, 0.0672999993f,
+	0.00249299989f, 0.932918012f, 0.154342994f, 0.611699998f, 0.907299995f, 0.0812000036f, -0.125100002f, 0.988799989f,
+	-0.00249299989f, 0.932918012f, 0.154342994f, 0.609300017f, 0.906799972f, -0.0812999979f, -0.125f, 0.988799989f,
+	0.0f, 0.940712988f, 0.1567f, 0.608200014f, 0.91109997f, -0.00039999999f, -0.126599997f, 0.991900027f,
+	0.00373900007f, 0.942960978f, 0.154653996f, 0.611400008f, 0.911899984f, 0.509800017f, -0.067400001f, 0.857599974f,
+	-0.00373600004f, 0.942961991f, 0.154651001f, 0.606100023f, 0.910099983f, -0.510800004f, -0.067400001f, 0.85710001f,
+	0.00706999982f, 0.994929016f, 0.156094998f, 0.619099975f, 0.932099998f, 0.706099987f, -0.0254999995f, 0.707700014f,
+	0.003241f, 0.999319017f, 0.160288006f, 0.619499981f, 0.934300005f, 0.761399984f, 0.0278999992f, 0.647599995f,
+	0.0f, 0.944896996f, 0.160304993f, 0.605799973f, 0.913800001f, 0.00209999993f, -0.652700007f, 0.757600009f,
+	0.00476199994f, 1.03099501f, 0.154420003f, 0.628099978f, 0.94569999f, 0.685500026f, 0.175400004f, 0.70660001f,
+	0.0117419995f, 1.02196205f, 0.150064006f, 0.629199982f, 0.940699995f, 0.6347f, 0.130799994f, 0.761600018f,
+	0.008715f, 1.05081797f, 0.143855006f, 0.6347f, 0.953199983f, 0.757499993f, 0.317499995f, 0.5704f,
+	0.0169910006f, 1.037956f, 0.140145004f, 0.636699975f, 0.94630003f, 0.697600007f, 0.292600006f, 0.654100001f,
+	0.0120010003f, 1.06384897f, 0.128815994f, 0.641700029f, 0.958700001f, 0.796800017f, 0.440699995f, 0.413399994f,
+	0.0212849993f, 1.04637599f, 0.130327001f, 0.642199993f, 0.949599981f, 0.710799992f, 0.440400004f, 0.548399985f,
+	0.0143339997f, 1.06993997f, 0.114669003f, 0.648000002f, 0.961700022f, 0.815299988f, 0.510299981f, 0.273699999f,
+	0.02458f, 1.05308795f, 0.116663001f, 0.648599982f, 0.952700019f, 0.801100016f, 0.506799996f, 0.318300009f,
+	0.0174770001f, 1.07178903f, 0.0964979976f, 0.656099975f, 0.963199973f, 0.89230001f, 0.451099992f, 0.0153999999f,
+	0.0256270003f, 1.05484998f, 0.102270998f, 0.654900014f, 0.954400003f, 0.919799984f, 0.392199993f, -0.00899999961f,
+	0.017678f, 1.06721199f, 0.0805059969f, 0.663600028f, 0.962599993f, 0.941299975f, 0.264400005f, -0.209999993f,
+	0.0225859992f, 1.05105698f, 0.0883729979f, 0.661599994f, 0.954400003f, 0.95599997f, 0.175999999f, -0.234899998f,
+	0.0186359994f, 1.04997802f, 0.0688399971f, 0.670400023f, 0.956099987f, 0.892400026f, 0.128299996f, -0.432599992f,
+	0.014285f, 1.05621505f, 0.0628319979f, 0.672699988f, 0.959800005f, 0.876100004f, 0.0340000018f, -0.481000006f,
+	0.0116149997f, 1.04407895f, 0.061751999f, 0.675499976f, 0.954900026f, 0.857299984f, -0.160099998f, -0.489300013f,
+	0.00856500026f, 1.05048299f, 0.0526160002f, 0.678600013f, 0.959100008f, 0.888400018f, -0.1796f, -0.422500014f,
+	0.00595499994f, 1.03913498f, 0.0525069982f, 0.680899978f, 0.954400003f, 0.879599988f, -0.198100001f, -0.432500005f,
+	0.149565995f, 0.774999022f, -0.0887570009f, 0.148300007f, 0.489100009f, 0.594099998f, 0.615800023f, 0.517499983f,
+	0.111332998f, 0.798021972f, -0.0816560015f, 0.143399999f, 0.509000003f, 0.508400023f, 0.682200015f, 0.5255f,
+	0.107911997f, 0.793259025f, -0.0721630007f, 0.138400003f, 0.508700013f, 0.508400023f, 0.681599975f, 0.526300013f,
+	0.147029996f, 0.769749999f, -0.0796099976f, 0.1435f, 0.488400012f, 0.59859997f, 0.6153f, 0.512899995f,
+	0.177437007f, 0.743104994f, -0.0918760002f, 0.148499995f, 0.469900012f, 0.683399975f, 0.569700003f, 0.45660001f,
+	0.171208993f, 0.742564976f, -0.0815870017f, 0.143399999f, 0.471899986f, 0.685000002f, 0.576900005f, 0.444900006f,
+	-0.0511699989f, 0.794661999f, -0.154568002f, 0.0820999965f, 0.391299993f, -0.84890002f, 0.41870001f, -0.322600007f,
+	-0.0468729995f, 0.808965981f, -0.140998006f, 0.0810000002f, 0.400299996f, -0.828100026f, 0.496199995f, -0.260899991f,
+	-0.0436809994f, 0.814132988f, -0.141302004f, 0.0788000003f, 0.40200001f, -0.841400027f, 0.485500008f, -0.237599999f,
+	-0.0476589985f, 0.801846981f, -0.153705999f, 0.0795999989f, 0.393900007f, -0.869300008f, 0.449499995f, -0.205699995f,
+	-0.0495360009f, 0.790401995f, -0.163360998f, 0.0803000033f, 0.387100011f, -0.880999982f, 0.318399996f, -0.349900007f,
+	-0.0534979999f, 0.778228998f, -0.163409993f, 0.0846000016f, 0.383100003f, -0.860000014f, 0.281699985f, -0.425599992f,
+	-0.0500649996f, 0.778689027f, -0.169309005f, 0.0820000023f, 0.381399989f, -0.84009999f, 0.275400013f, -0.467400014f,
+	-0.0943169966f, 0.722589016f, -0.0247419998f, 0.234799996f, 0.945200026f, -0.758400023f, 0.589299977f, -0.278499991f,
+	-0.0923769996f, 0.720806003f, -0.0319969989f, 0.231700003f, 0.946799994f, -0.689599991f, 0.638599992f, -0.341399997f,
+	-0.0961230025f, 0.717413008f, -0.0307759997f, 0.231199995f, 0.944500029f, -0.73180002f, 0.609899998f, -0.304100007f,
+	-0.0970479995f, 0.718715012f, -0.0244689994f, 0.233899996f, 0.943300009f, -0.802699983f, 0.549700022f, -0.231199995f,
+	-0.0832559988f, 0.858021021f, -0.0392859988f, 0.0194000006f, 0.0584999993f, -0.351000011f, 0.403400004f, -0.845000029f,
+	-0.0868960023f, 0.833433986f, -0.0479569994f, 0.00910000037f, 0.0526000001f, -0.305599988f, 0.356599987f, -0.882799983f,
+	0.0946130008f, 0.773253024f, -0.103013001f, 0.135399997f, 0.507799983f, 0.518100023f, 0.186499998f, -0.834800005f,
+	0.0782919973f, 0.762013972f, -0.115976997f, 0.137500003f, 0.518299997f, 0.533399999f, 0.238499999f, -0.811600029f,
+	0.0770799965f, 0.767152011f, -0.115257002f, 0.135100007f, 0.517799973f, 0.528299987f, 0.236499995f, -0.815500021f,
+	0.0918610021f, 0.774688005f, -0.104443997f, 0.134299994f, 0.508899987f, 0.523299992f, 0.171399996f, -0.834699988f,
+	0.052480001f, 0.759465992f, -0.134802997f, 0.134399995f, 0.532400012f, 0.559300005f, 0.226199999f, -0.797500014f,
+	0.0486200005f, 0.764515996f, -0.136078998f, 0.131600007f, 0.533399999f, 0.559199989f, 0.228599995f, -0.796899974f,
+	-0.0174519997f, 0.284833997f, 0.00315500004f, 0.449099988f, 0.808399975f, 0.268400013f, -0.808899999f, -0.523100019f,
+	-0.0120780002f, 0.280761003f, 0.013429f, 0.445800006f, 0.812900007f, 0.216499999f, -0.863499999f, -0.455599993f,
+	-0.0162289999f, 0.279047012f, 0.0147050004f, 0.444099993f, 0.811600029f, 0.260399997f, -0.851899981f, -0.454400003f,
+	-0.0204249993f, 0.281410009f, 0.00674800016f, 0.446500003f, 0.808099985f, 0.324099988f, -0.80339998f, -0.499500006f,
+	-0.042498f, 0.290962994f, -0.0153980004f, 0.451999992f, 0.79430002f, 0.242899999f, -0.778900027f, -0.578100026f,
+	-0.0425049998f, 0.28728801f, -0.0104900002f, 0.449400008f, 0.79549998f, 0.246700004f, -0.775900006f, -0.580600023f,
+	0.0174519997f, 0.284833997f, 0.00315500004f, 0.326599985f, 0.743499994f, -0.268400013f, -0.808899999f, -0.523100019f,
+	0.0204249993f, 0.281410009f, 0.00674800016f, 0.328799993f, 0.7421f, -0.324099988f, -0.80339998f, -0.499500006f,
+	0.0162289999f, 0.279047012f, 0.0147050004f, 0.328299999f, 0.737900019f, -0.260399997f, -0.851899981f, -0.454400003f,
+	0.0120780002f, 0.280761003f, 0.013429f, 0.326200008f, 0.737999976f, -0.216499999f, -0.863499999f, -0.455599993f,
+	0.042498f, 0.290962994f, -0.0153980004f, 0.333499998f, 0.756099999f, -0.242899999f, -0.778900027f, -0.578100026f,
+	0.0425049998f, 0.28728801f, -0.0104900002f, 0.334699988f, 0.753600001f, -0.246700004f, -0.775900006f, -0.580600023f,
+	0.0768899992f, 0.710335016f, -0.000362999999f, 0.747200012f, 0.734200001f, 0.0142000001f, 0.999899983f, -0.00490000006f,
+	0.0845730007f, 0.710223973f, -0.00432599988f, 0.748600006f, 0.730499983f, 0.0282000005f, 0.999599993f, -0.00170000002f,
+	0.0728320032f, 0.709994018f, -0.0336989984f, 0.762399971f, 0.734300017f, 0.0292000007f, 0.99940002f, -0.0173000004f,
+	0.0653679967f, 0.710349023f, -0.0269670002f, 0.7597f, 0.737999976f, 0.0428000018f, 0.99879998f, -0.0231999997f,
+	0.0771690011f, 0.710323989f, 0.0203820001f, 0.737800002f, 0.735199988f, 0.207200006f, 0.97420001f, 0.0888999999f,
+	0.0823599994f, 0.708997011f, 0.0216470007f, 0.736999989f, 0.732900023f, 0.219600007f, 0.971599996f, 0.0885000005f,
+	0.0625260025f, 0.710195005f, 0.0473559983f, 0.726499975f, 0.743200004f, 0.0706999972f, 0.994400024f, 0.0781999975f,
+	0.0659089983f, 0.709771991f, 0.0500649996f, 0.725099981f, 0.74180001f, 0.0656000003f, 0.995700002f, 0.0659999996f,
+	0.0396680012f, 0.70915699f, 0.0628890023f, 0.720399976f, 0.754199982f, 0.00860000029f, 0.999300003f, 0.0362000018f,
+	0.0411209986f, 0.708989978f, 0.0676610023f, 0.718200028f, 0.753799975f, 0.0105999997f, 0.999199986f, 0.0392000005f,
+	0.0173080005f, 0.709450006f, 0.0697809979f, 0.718200028f, 0.764599979f, 0.0109000001f, 0.995000005f, 0.0996999964f,
+	0.0188929997f, 0.70875901f, 0.0758059993f, 0.715399981f, 0.764100015f, 0.0144999996f, 0.993799984f, 0.110100001f,
+	0.0f, 0.70875901f, 0.0726369992f, 0.717499971f, 0.772499979f, -0.0269000009f, 0.99879998f, 0.0403000005f,
+	0.0f, 0.708567977f, 0.0773790032f, 0.715300024f, 0.772700012f, -0.0243999995f, 0.998399973f, 0.050999999f,
+	-0.0173020009f, 0.708518982f, 0.069728002f, 0.719399989f, 0.780300021f, -0.00829999987f, 0.997799993f, 0.0653000027f,
+	-0.0187589992f, 0.708127022f, 0.0751660019f, 0.716899991f, 0.781099975f, -0.00829999987f, 0.997500002f, 0.069600001f,
+	-0.0396680012f, 0.70915699f, 0.0628890023f, 0.723200023f, 0.790199995f, 0.00879999995f, 0.999100029f, 0.0414000005f,
+	-0.0411209986f, 0.708989978f, 0.0676610023f, 0.721000016f, 0.791000009f, 0.0113000004f, 0.999100029f, 0.0414999984f,
+	-0.0625260025f, 0.710195005f, 0.0473559983f, 0.730799973f, 0.800100029f, -0.0706999972f, 0.994400024f, 0.0781999975f,
+	-0.0659079999f, 0.709771991f, 0.0500649996f, 0.729700029f, 0.801699996f, -0.0656000003f, 0.995700002f, 0.0659999996f,
+	-0.0771690011f, 0.710323989f, 0.0203820001f, 0.743300021f, 0.806299984f, -0.207200006f, 0.97420001f, 0.0888999999f,
+	-0.0823599994f, 0.708997011f, 0.0216470007f, 0.742799997f, 0.808700025f, -0.219600007f, 0.971599996f, 0.0885000005f,
+	-0.0768899992f, 0.710335016f, -0.000362999999f, 0.752699971f, 0.805899978f, -0.0148f, 0.999899983f, -0.00749999983f,
+	-0.0845730007f, 0.710223973f, -0.00432599988f, 0.754599988f, 0.809199989f, -0.0263999999f, 0.999599993f, -0.00529999984f,
+	-0.0726549998f, 0.709793985f, -0.033578001f, 0.7676f, 0.803300023f, -0.0465000011f, 0.998600006f, -0.0267999992f,
+	-0.0653679967f, 0.710349023f, -0.0269670002f, 0.764500022f, 0.800100029f, -0.0603f, 0.997699976f, -0.0315999985f,
+	-0.0495820008f, 0.71024102f, -0.0552459992f, 0.776899993f, 0.792299986f, -0.123999998f, 0.99150002f, -0.0390000008f,
+	-0.0336120017f, 0.712539017f, -0.0514939986f, 0.774699986f, 0.785099983f, -0.310000002f, 0.950600028f, 0.0188999996f,
+	-0.0339009985f, 0.713074028f, -0.0637539998f, 0.780300021f, 0.784799993f, -0.396600008f, 0.917900026f, 0.0137999998f,
+	-0.0173870008f, 0.723375022f, -0.0539930016f, 0.775399983f, 0.776199996f, -0.432599992f, 0.901499987f, 0.0109000001f,
+	-0.025378f, 0.717599988f, -0.0668070018f, 0.781400025f, 0.780399978f, -0.528400004f, 0.84740001f, -0.0524000004f,
+	-0.0163620003f, 0.724250972f, -0.0683329999f, 0.781899989f, 0.775300026f, -0.409200013f, 0.912100017f, 0.0264999997f,
+	-0.0f, 0.728576005f, -0.0694179982f, 0.781799972f, 0.7676f, 0.00100000005f, 0.99970001f, 0.0223999992f,
+	-0.0f, 0.72842598f, -0.055652f, 0.775600016f, 0.768000007f, -0.0f, 0.999899983f, 0.0109000001f,
+	0.0173879992f, 0.723376989f, -0.0539930016f, 0.774200022f, 0.759899974f, 0.440299988f, 0.897899985f, -0.00359999994f,
+	0.0162969995f, 0.724147022f, -0.0682319999f, 0.780700028f, 0.759899974f, 0.422300011f, 0.906300008f, 0.0165999997f,
+	0.0337399989f, 0.712885976f, -0.0635600016f, 0.77759999f, 0.750699997f, 0.394199997f, 0.91900003f, -0.00980000012f,
+	0.0250739995f, 0.717298985f, -0.0664639995f, 0.779399991f, 0.754999995f, 0.532400012f, 0.842400014f, -0.0824000016f,
+	0.0336130001f, 0.712543011f, -0.0514939986f, 0.772199988f, 0.751299977f, 0.309100002f, 0.950999975f, 0.0046000001f,
+	0.0495820008f, 0.71024102f, -0.0552459992f, 0.773199975f, 0.743799984f, 0.120899998f, 0.99180001f, -0.0423999988f,
+	-0.0585660003f, 0.813409984f, -0.133511007f, 0.0229000002f, 0.387199998f, 0.514800012f, 0.430999994f, -0.741100013f,
+	-0.0568219982f, 0.80687499f, -0.135544002f, 0.0228000004f, 0.390500009f, 0.463400006f, 0.373699993f, -0.803499997f,
+	-0.0650750026f, 0.792056024f, -0.147843003f, 0.0164999999f, 0.397599995f, 0.502300024f, 0.346300006f, -0.792299986f,
+	-0.069081001f, 0.796294987f, -0.148601994f, 0.0148f, 0.395399988f, 0.515600026f, 0.34709999f, -0.783299983f,
+	-0.0546090007f, 0.816160977f, -0.129393995f, 0.0253999997f, 0.385899991f, 0.640299976f, 0.192000002f, -0.743799984f,
+	-0.0511309989f, 0.808984995f, -0.128252998f, 0.0274f, 0.388900012f, 0.593500018f, 0.799300015f, -0.0942000002f,
+	-0.0511859991f, 0.810029984f, -0.131969005f, 0.0258000009f, 0.389600009f, 0.432099998f, 0.89410001f, 0.1175f,
+	-0.0565930009f, 0.810491979f, -0.134139001f, 0.0232999995f, 0.388799995f, 0.286000013f, 0.382699996f, -0.878499985f,
+	-0.0658259988f, 0.776278019f, -0.155417994f, 0.0142000001f, 0.405299991f, 0.438499987f, 0.371899992f, -0.818199992f,
+	-0.0723899975f, 0.776905f, -0.158650994f, 0.0109000001f, 0.404799998f, 0.451099992f, 0.363599986f, -0.815100014f,
+	-0.049922999f, 0.808959007f, -0.130824998f, 0.0265999995f, 0.389800012f, 0.501800001f, 0.834599972f, 0.227400005f,
+	0.0827599987f, 0.843131006f, 0.125043005f, 0.166299999f, 0.194900006f, 0.697099984f, 0.130999997f, 0.704900026f,
+	0.0730329975f, 0.847470999f, 0.134332001f, 0.161400005f, 0.191200003f, 0.738499999f, 0.1303f, 0.661499977f,
+	0.0772640035f, 0.799160004f, 0.135657996f, 0.155499995f, 0.211300001f, 0.587700009f, 0.1197f, 0.800199986f,
+	0.0880139992f, 0.811546981f, 0.126930997f, 0.162900001f, 0.208299994f, 0.523999989f, 0.137400001f, 0.840499997f,
+	0.0801509991f, 0.879432023f, 0.117624998f, 0.172900006f, 0.180299997f, 0.851400018f, 0.134599999f, 0.507000029f,
+	0.0713919997f, 0.889182985f, 0.130649f, 0.167699993f, 0.174199998f, 0.87650001f, 0.123999998f, 0.465200007f,
+	0.0862200037f, 0.928431988f, 0.0867390037f, 0.191599995f, 0.163399994f, 0.914200008f, 0.236599997f, 0.328999996f,
+	0.0741280019f, 0.928480029f, 0.115819998f, 0.178499997f, 0.159600005f, 0.915600002f, 0.1303f, 0.380499989f,
+	0.0749220029f, 0.949402988f, 0.101278f, 0.186700001f, 0.1523f, 0.912599981f, 0.259000003f, 0.316399992f,
+	0.087797001f, 0.937865973f, 0.0695360005f, 0.199699998f, 0.160999998f, 0.923099995f, 0.288700014f, 0.254299998f,
+	0.0766270012f, 0.965075016f, 0.0804560035f, 0.196999997f, 0.147699997f, 0.921299994f, 0.316000015f, 0.226699993f,
+	0.0891579986f, 0.946012974f, 0.054680001f, 0.206799999f, 0.158899993f, 0.926500022f, 0.369399995f, 0.0715999976f,
+	0.0772119984f, 0.972323f, 0.057438001f, 0.207399994f, 0.146400005f, 0.91140002f, 0.409399986f, 0.0419000015f,
+	0.0877040029f, 0.945443988f, 0.0385599993f, 0.213699996f, 0.159899995f, 0.915400028f, 0.3583f, -0.183300003f,
+	0.0769150034f, 0.96846801f, 0.0296870004f, 0.219099998f, 0.149599999f, 0.914099991f, 0.361600012f, -0.183500007f,
+	0.0851449966f, 0.938552022f, 0.0230129994f, 0.220400006f, 0.163200006f, 0.910000026f, 0.28639999f, -0.300000012f,
+	0.0743089989f, 0.953275979f, 0.00389500009f, 0.229800001f, 0.156900004f, 0.911000013f, 0.272799999f, -0.309199989f,
+	0.0812869966f, 0.91714102f, -0.00359299988f, 0.231600001f, 0.172999993f, 0.908299983f, 0.238800004f, -0.343499988f,
+	0.0726839975f, 0.930278003f, -0.0170719996f, 0.238399997f, 0.167199999f, 0.902499974f, 0.240500003f, -0.357199997f,
+	0.0798569992f, 0.892690003f, -0.023387f, 0.239600003f, 0.184f, 0.86559999f, 0.234400004f, -0.442600012f,
+	0.0719790012f, 0.898384988f, -0.0361200012f, 0.246000007f, 0.181400001f, 0.870500028f, 0.220300004f, -0.440100014f,
+	0.0832559988f, 0.858021021f, -0.0392859988f, 0.245100006f, 0.199599996f, 0.716000021f, 0.337799996f, -0.610899985f,
+	0.0743039995f, 0.857825994f, -0.0498859994f, 0.251100004f, 0.199200004f, 0.735199988f, 0.315499991f, -0.599900007f,
+	0.0868960023f, 0.833433986f, -0.0479569994f, 0.247799993f, 0.210600004f, 0.697000027f, 0.308600008f, -0.647300005f,
+	0.0812380016f, 0.824496984f, -0.058056999f, 0.252999991f, 0.214200005f, 0.690400004f, 0.304500014f, -0.656199992f,
+	-0.0827599987f, 0.843131006f, 0.125043005f, 0.588500023f, 0.575999975f, -0.697099984f, 0.130999997f, 0.704900026f,
+	-0.0880139992f, 0.811546981f, 0.126930997f, 0.602500021f, 0.572600007f, -0.523999989f, 0.137400001f, 0.840499997f,
+	-0.0772640035f, 0.799160004f, 0.135657996f, 0.608799994f, 0.578000009f, -0.587700009f, 0.1197f, 0.800199986f,
+	-0.0730329975f, 0.847470999f, 0.134332001f, 0.587499976f, 0.582199991f, -0.738499999f, 0.1303f, 0.661499977f,
+	-0.0801509991f, 0.879432023f, 0.117624998f, 0.57190001f, 0.577000022f, -0.851400018f, 0.134599999f, 0.507000029f,
+	-0.0713910013f, 0.889182985f, 0.130649f, 0.568899989f, 0.584699988f, -0.87650001f, 0.123999998f, 0.465200007f,
+	-0.0862200037f, 0.928431988f, 0.0867390037f, 0.547399998f, 0.568099976f, -0.914200008f, 0.236599997f, 0.328999996f,
+	-0.0741280019f, 0.928480029f, 0.115819998f, 0.550300002f, 0.581900001f, -0.915600002f, 0.130400002f, 0.380499989f,
+	-0.0749220029f, 0.949402988f, 0.101278f, 0.539699972f, 0.577799976f, -0.912599981f, 0.259000003f, 0.316399992f,
+	-0.087797001f, 0.937865973f, 0.0695360005f, 0.541299999f, 0.561800003f, -0.923099995f, 0.288700014f, 0.254299998f,
+	-0.0766270012f, 0.965075016f, 0.0804560035f, 0.530499995f, 0.570599973f, -0.921299994f, 0.316000015f, 0.226699993f,
+	-0.0891579986f, 0.946012974f, 0.054680001f, 0.536000013f, 0.556299984f, -0.926500022f, 0.369399995f, 0.0715999976f,
+	-0.0772119984f, 0.972323f, 0.057438001f, 0.524299979f, 0.561800003f, -0.91140002f, 0.409399986f, 0.0419000015f,
+	-0.0769150034f, 0.96846801f, 0.0296870004f, 0.521499991f, 0.549600005f, -0.914099991f, 0.361600012f, -0.183500007f,
+	-0.0877040029f, 0.945443988f, 0.0385599993f, 0.533599973f, 0.549499989f, -0.915400028f, 0.3583f, -0.183300003f,
+	-0.0851449966f, 0.938552022f, 0.0230129994f, 0.533399999f, 0.541800022f, -0.910000026f, 0.28639999f, -0.300000012f,
+	-0.0743089989f, 0.953275979f, 0.00389500009f, 0.523000002f, 0.536199987f, -0.911000013f, 0.272799999f, -0.309199989f,
+	-0.0812869966f, 0.91714102f, -0.00359299988f, 0.536899984f, 0.526799977f, -0.908299983f, 0.238800004f, -0.343499988f,
+	-0.0726839975f, 0.930278003f, -0.0170719996f, 0.528400004f, 0.523299992f, -0.902499974f, 0.240500003f, -0.357199997f,
+	-0.0798569992f, 0.892690003f, -0.023387f, 0.543099999f, 0.514199972f, -0.86559999f, 0.234400004f, -0.442600012f,
+	-0.0719790012f, 0.898384988f, -0.0361200012f, 0.537599981f, 0.509500027f, -0.870500028f, 0.220300004f, -0.440100014f,
+	-0.0743039995f, 0.857825994f, -0.0498859994f, 0.551500022f, 0.496300012f, -0.735199988f, 0.315499991f, -0.599900007f,
+	-0.0832559988f, 0.858021021f, -0.0392859988f, 0.554700017f, 0.501600027f, -0.716000021f, 0.337799996f, -0.610899985f,
+	-0.0868960023f, 0.833433986f, -0.0479569994f, 0.563600004f, 0.493800014f, -0.697000027f, 0.308600008f, -0.647300005f,
+	-0.0812380016f, 0.824496984f, -0.058056999f, 0.564300001f, 0.487300009f, -0.690400004f, 0.304500014f, -0.656199992f,
+	-0.0771709979f, 0.686587989f, 0.064861998f, 0.2324f, 0.903100014f, -0.573300004f, 0.792800009f, 0.206799999f,
+	-0.0796139985f, 0.686480999f, 0.0589630008f, 0.2315f, 0.905900002f, -0.587499976f, 0.776000023f, 0.229200006f,
+	-0.0884430036f, 0.681316972f, 0.0538170002f, 0.226899996f, 0.908200026f, -0.558300018f, 0.809000015f, 0.183699995f,
+	-0.088082999f, 0.680458009f, 0.0591350012f, 0.226799995f, 0.905799985f, -0.548699975f, 0.818700016f, 0.169300005f,
+	-0.049637001f, 0.759334028f, -0.0597640015f, 0.343800008f, 0.177000001f, -0.736800015f, -0.1017f, -0.66839999f,
+	-0.0683529973f, 0.81733501f, -0.0459240004f, 0.316599995f, 0.187600002f, -0.626399994f, 0.0555999987f, -0.777499974f,
+	-0.0387759991f, 0.787706971f, -0.0635470003f, 0.330599993f, 0.172499999f, -0.435799986f, 0.0970999971f, -0.894800007f,
+	-0.0634189993f, 0.757934988f, -0.0337480009f, 0.344700009f, 0.190400004f, -0.906099975f, -0.226899996f, -0.356999993f,
+	-0.0688690022f, 0.783535004f, -0.0361890011f, 0.332599998f, 0.191100001f, -0.867999971f, -0.228400007f, -0.440800011f,
+	-0.0312070008f, 0.824925005f, -0.0598709993f, 0.312599987f, 0.169699997f, -0.345699996f, 0.232500002f, -0.909099996f,
+	-0.0665659979f, 0.84552902f, -0.040874999f, 0.30340001f, 0.188299999f, -0.449800014f, 0.318399996f, -0.834500015f,
+	-0.0889659971f, 0.821510971f, -0.021373f, 0.314799994f, 0.202199996f, -0.772099972f, -0.120800003f, -0.624000013f,
+	-0.0742110014f, 0.757174015f, 0.0076700002f, 0.348199993f, 0.210899994f, -0.952400029f, -0.302100003f, -0.0403000005f,
+	-0.0803000033f, 0.775484025f, 0.00543999998f, 0.339100003f, 0.210800007f, -0.915600002f, -0.37439999f, -0.146300003f,
+	-0.086292997f, 0.788055003f, 0.00876899995f, 0.333000004f, 0.213100001f, -0.887700021f, -0.427300006f, -0.171499997f,
+	-0.0868839994f, 0.801980972f, -0.00943099987f, 0.324900001f, 0.206300005f, -0.868399978f, -0.371100008f, -0.328799993f,
+	-0.0896819979f, 0.844485998f, -0.0240189992f, 0.304399997f, 0.201299995f, -0.589299977f, 0.0960000008f, -0.802200019f,
+	-0.091421999f, 0.862316012f, -0.0163020007f, 0.296900004f, 0.203899994f, -0.439900011f, 0.513199985f, -0.736899972f,
+	-0.0316069983f, 0.848169029f, -0.050675001f, 0.299699992f, 0.172099993f, -0.272399992f, 0.449499995f, -0.850700021f,
+	-0.037016999f, 0.872690976f, -0.0310520008f, 0.284999996f, 0.180399999f, -0.224800006f, 0.60799998f, -0.761500001f,
+	-0.0653719977f, 0.866549015f, -0.0283690002f, 0.292499989f, 0.191400006f, -0.312000006f, 0.580900013f, -0.751800001f,
+	-0.0926299989f, 0.876241982f, -0.00432999991f, 0.291200012f, 0.207300007f, -0.333900005f, 0.689400017f, -0.64289999f,
+	-0.066967003f, 0.882553995f, -0.0114270002f, 0.283499986f, 0.197699994f, -0.302899987f, 0.73119998f, -0.611199975f,
+	-0.0401719995f, 0.887338996f, -0.0162719991f, 0.2755f, 0.188199997f, -0.247500002f, 0.722299993f, -0.645799994f,
+	-0.0708570033f, 0.894041002f, 0.00769500015f, 0.277700007f, 0.206400007f, -0.314200014f, 0.839699984f, -0.442900002f,
+	-0.0934100002f, 0.888607025f, 0.0122020002f, 0.28639999f, 0.211999997f, -0.291200012f, 0.858699977f, -0.421799988f,
+	-0.0488720015f, 0.901863992f, 0.00616100011f, 0.26820001f, 0.202600002f, -0.333900005f, 0.81220001f, -0.478399992f,
+	-0.0721649975f, 0.903891981f, 0.0367569998f, 0.273400009f, 0.220100001f, -0.347600013f, 0.933600008f, -0.0864000022f,
+	-0.094302997f, 0.896898985f, 0.0415600017f, 0.283300012f, 0.221100003f, -0.288300008f, 0.957499981f, 0.000600000028f,
+	-0.0516100004f, 0.911669016f, 0.032869f, 0.263999999f, 0.219400004f, -0.401800007f, 0.904900014f, -0.140599996f,
+	-0.0691310018f, 0.900178015f, 0.0684019998f, 0.277700007f, 0.234099999f, -0.293199986f, 0.856000006f, 0.425900012f,
+	-0.0947680026f, 0.889514029f, 0.0714320019f, 0.288300008f, 0.228400007f, -0.261099994f, 0.854700029f, 0.448700011f,
+	-0.0478879996f, 0.912289023f, 0.0585910007f, 0.266499996f, 0.236000001f, -0.3935f, 0.849799991f, 0.350699991f,
+	-0.0425259992f, 0.887731016f, 0.0905970037f, 0.281599998f, 0.250400007f, -0.111900002f, 0.5079f, 0.854099989f,
+	-0.0931309983f, 0.875151992f, 0.0902329981f, 0.293799996f, 0.230199993f, -0.107299998f, 0.589299977f, 0.800700009f,
+	-0.0263100006f, 0.908200979f, 0.0789280012f, 0.269199997f, 0.254099995f, -0.214499995f, 0.568899989f, 0.793900013f,
+	-0.0f, 0.875989974f, 0.0956609994f, 0.28549999f, 0.270500004f, -0.0430999994f, 0.263099998f, 0.963800013f,
+	-0.0f, 0.838882029f, 0.100213997f, 0.30399999f, 0.270999998f, -0.0208999999f, 0.00899999961f, 0.99970001f,
+	-0.0483179986f, 0.848362029f, 0.102918997f, 0.301099986f, 0.25f, 0.0170000009f, 0.102200001f, 0.994599998f,
+	-0.0916799977f, 0.851592004f, 0.102596f, 0.301899999f, 0.230800003f, 0.0331999995f, 0.224299997f, 0.973999977f,
+	-0.0480809994f, 0.809144974f, 0.0973900035f, 0.319299996f, 0.25029999f, -0.00150000001f, -0.27610001f, 0.961099982f,
+	-0.0f, 0.808206975f, 0.0970280021f, 0.319400012f, 0.271400005f, 0.0175000001f, -0.215599999f, 0.976300001f,
+	0.0483179986f, 0.848362029f, 0.102918997f, 0.300099999f, 0.291799992f, -0.0219999999f, 0.0848999992f, 0.996100008f,
+	-0.0f, 0.904209971f, 0.0841339976f, 0.270900011f, 0.270099998f, -0.0461999997f, 0.407400012f, 0.912100017f,
+	0.0425259992f, 0.887731016f, 0.0905970037f, 0.280699998f, 0.290300012f, 0.122000001f, 0.499799997f, 0.857500017f,
+	0.0480809994f, 0.809144974f, 0.0973900035f, 0.318300009f, 0.292400002f, -0.00960000046f, -0.325700015f, 0.9454f,
+	0.0884639993f, 0.812834024f, 0.101131998f, 0.314799994f, 0.310299993f, -0.0272000004f, -0.32159999f, 0.946500003f,
+	0.0916789994f, 0.851592004f, 0.102596f, 0.299800009f, 0.31099999f, 0.0395999998f, 0.200000003f, 0.978999972f,
+	-0.0f, 0.775663972f, 0.0875440016f, 0.335799992f, 0.271800011f, 0.00730000017f, -0.386799991f, 0.922100008f,
+	0.0568820015f, 0.776144028f, 0.0799940005f, 0.334800005f, 0.298299998f, 0.289400011f, -0.602999985f, 0.743399978f,
+	-0.0568820015f, 0.776144028f, 0.0799940005f, 0.336100012f, 0.245299995f, -0.269600004f, -0.638400018f, 0.721000016f,
+	-0.0884639993f, 0.812834024f, 0.101131998f, 0.316799998f, 0.2324f, 0.0274999999f, -0.257999986f, 0.965699971f,
+	-0.0420240015f, 0.752071023f, 0.0659300014f, 0.349999994f, 0.249500006f, -0.354000002f, -0.586799979f, 0.728299975f,
+	-0.0f, 0.750571012f, 0.0753019974f, 0.349000007f, 0.272199988f, -0.0337999985f, -0.462000012f, 0.886200011f,
+	-0.0766550004f, 0.769991994f, 0.0469879992f, 0.344700009f, 0.229599997f, -0.71509999f, -0.667699993f, 0.206799999f,
+	-0.0854490027f, 0.791159987f, 0.084691003f, 0.326900005f, 0.233600006f, -0.291299999f, -0.711899996f, 0.638999999f,
+	-0.0671830028f, 0.753969014f, 0.0415420011f, 0.352400005f, 0.229599997f, -0.7773f, -0.531099975f, 0.337300003f,
+	-0.0847750008f, 0.778137982f, 0.049612999f, 0.340799987f, 0.229000002f, -0.690999985f, -0.717400014f, 0.0887999982f,
+	0.0420240015f, 0.752071023f, 0.0659300014f, 0.348800004f, 0.2949f, 0.360799998f, -0.626399994f, 0.690900028f,
+	0.067181997f, 0.753969014f, 0.0415420011f, 0.350100011f, 0.314999998f, 0.741699994f, -0.583299994f, 0.331f,
+	0.0766550004f, 0.769991994f, 0.0469879992f, 0.342400014f, 0.314500004f, 0.723200023f, -0.634199977f, 0.273499995f,
+	0.074210003f, 0.757174015f, 0.0076700002f, 0.344700009f, 0.333400011f, 0.930400014f, -0.358500004f, -0.0763000026f,
+	0.0847750008f, 0.778137982f, 0.049612999f, 0.338499993f, 0.314900011f, 0.630599976f, -0.743799984f, 0.221599996f,
+	0.0803000033f, 0.775484025f, 0.00543999998f, 0.335700005f, 0.333000004f, 0.916100025f, -0.367799997f, -0.159899995f,
+	0.0634189993f, 0.757934988f, -0.0337480009f, 0.340000004f, 0.353700012f, 0.895200014f, -0.2421f, -0.3741f,
+	0.0862919986f, 0.788055003f, 0.00876899995f, 0.329699993f, 0.330300003f, 0.906400025f, -0.387699991f, -0.167699993f,
+	0.0868839994f, 0.801980972f, -0.00943099987f, 0.321099997f, 0.336699992f, 0.850700021f, -0.33070001f, -0.408699989f,
+	0.0688679963f, 0.783535004f, -0.0361890011f, 0.328000009f, 0.352200001f, 0.874100029f, -0.200900003f, -0.442200005f,
+	0.0854490027f, 0.791159987f, 0.084691003f, 0.324900001f, 0.309500009f, 0.178900003f, -0.697300017f, 0.694100022f,
+	0.0683529973f, 0.81733501f, -0.0459240004f, 0.311800003f, 0.354799986f, 0.621100008f, 0.0295000002f, -0.783200026f,
+	0.049637001f, 0.759334028f, -0.0597640015f, 0.33829999f, 0.367000014f, 0.736800015f, -0.1017f, -0.66839999f,
+	0.0889659971f, 0.821510971f, -0.021373f, 0.310900003f, 0.34009999f, 0.760200024f, -0.264899999f, -0.593200028f,
+	0.0896809995f, 0.844485998f, -0.0240189992f, 0.300399989f, 0.340499997f, 0.598200023f, 0.219500005f, -0.770699978f,
+	0.0665659979f, 0.84552902f, -0.040874999f, 0.298599988f, 0.353399992f, 0.421600014f, 0.332899988f, -0.843500018f,
+	0.0387759991f, 0.787706971f, -0.0635470003f, 0.324800014f, 0.370700002f, 0.435799986f, 0.0970999971f, -0.894800007f,
+	0.0312070008f, 0.824925005f, -0.0598709993f, 0.306800008f, 0.372399986f, 0.385600001f, 0.261599988f, -0.884800017f,
+	0.0316069983f, 0.848169029f, -0.050675001f, 0.294f, 0.369300008f, 0.300000012f, 0.402700007f, -0.864799976f,
+	0.0653719977f, 0.866549015f, -0.0283690002f, 0.287900001f, 0.349700004f, 0.334899992f, 0.572399974f, -0.74849999f,
+	0.091421999f, 0.862316012f, -0.0163020007f, 0.293000013f, 0.337500006f, 0.433400005f, 0.462700009f, -0.773299992f,
+	0.037016999f, 0.872690976f, -0.0310520008f, 0.279900014f, 0.360300004f, 0.216700003f, 0.631399989f, -0.744599998f,
+	0.066967003f, 0.882553995f, -0.0114270002f, 0.279300004f, 0.342999995f, 0.29370001f, 0.726400018f, -0.621399999f,
+	0.0926299989f, 0.876241982f, -0.00432999991f, 0.287600011f, 0.333799988f, 0.365399987f, 0.685199976f, -0.630100012f,
+	0.0401710011f, 0.887338996f, -0.0162719991f, 0.270799994f, 0.351999998f, 0.246099994f, 0.707799971f, -0.662199974f,
+	0.0934100002f, 0.888607025f, 0.0122020002f, 0.282999992f, 0.328900009f, 0.317799985f, 0.848200023f, -0.423700005f,
+	0.0708559975f, 0.894041002f, 0.00769500015f, 0.273999989f, 0.333900005f, 0.315600008f, 0.840600014f, -0.440100014f,
+	0.0488720015f, 0.901863992f, 0.00616100011f, 0.264299989f, 0.337199986f, 0.306600004f, 0.827199996f, -0.470899999f,
+	0.0721649975f, 0.903891981f, 0.0367569998f, 0.270599991f, 0.320100009f, 0.351799995f, 0.930800021f, -0.0991000012f,
+	0.094302997f, 0.896898985f, 0.0415600017f, 0.280499995f, 0.319700003f, 0.330900013f, 0.943499982f, -0.0168999992f,
+	0.0516100004f, 0.911669016f, 0.032869f, 0.261200011f, 0.320199996f, 0.364100009f, 0.917100012f, -0.162599996f,
+	0.0691310018f, 0.900178015f, 0.0684019998f, 0.27579999f, 0.306300014f, 0.307700008f, 0.850700021f, 0.426299989f,
+	0.0478870012f, 0.912289023f, 0.0585910007f, 0.264699996f, 0.303799987f, 0.343699992f, 0.894699991f, 0.2852f,
+	0.0947680026f, 0.889514029f, 0.0714320019f, 0.286000013f, 0.312700003f, 0.297500014f, 0.842700005f, 0.448799998f,
+	0.0931309983f, 0.875151992f, 0.0902329981f, 0.291700006f, 0.311199993f, 0.167799994f, 0.605199993f, 0.778199971f,
+	0.0263100006f, 0.908200979f, 0.0789280012f, 0.268400013f, 0.286000013f, 0.176899999f, 0.634199977f, 0.752600014f,
+	0.0796660036f, 0.686500013f, -0.0469090007f, 0.234599993f, 0.887700021f, 0.457399994f, 0.887600005f, -0.0535999984f,
+	0.0873640031f, 0.682563007f, -0.0428999998f, 0.230599999f, 0.889299989f, 0.657800019f, 0.752699971f, -0.0266999993f,
+	0.0870990008f, 0.682523012f, -0.0493279994f, 0.230900005f, 0.886399984f, 0.580799997f, 0.81309998f, -0.0379999988f,
+	0.0779590011f, 0.686878026f, -0.0534499995f, 0.235599995f, 0.884800017f, 0.453599989f, 0.888700008f, -0.0670000017f,
+	0.0947220027f, 0.674024999f, -0.0453360006f, 0.225600004f, 0.887700021f, 0.755400002f, 0.655099988f, -0.0142000001f,
+	0.0953190029f, 0.673397005f, -0.0391100012f, 0.224999994f, 0.890500009f, 0.756600022f, 0.653900027f, -0.00659999996f,
+	-0.0727489963f, 0.253497988f, -0.0196509995f, 0.360900015f, 0.795300007f, -0.814599991f, -0.277999997f, -0.509000003f,
+	-0.0758860037f, 0.258029997f, -0.0172070004f, 0.3583f, 0.795799971f, -0.808000028f, -0.3565f, -0.469099998f,
+	-0.0635119975f, 0.262080014f, -0.0347959995f, 0.361299992f, 0.786300004f, -0.819000006f, -0.111599997f, -0.56279999f,
+	-0.0613459982f, 0.258563012f, -0.0373900011f, 0.363400012f, 0.785700023f, -0.824500024f, -0.0965000018f, -0.557600021f,
+	-0.0788780004f, 0.244664997f, 0.0033760001f, 0.360700011f, 0.806800008f, -0.718900025f, -0.530600011f, -0.449099988f,
+	-0.0847709998f, 0.253535986f, 0.00132200005f, 0.356099993f, 0.805100024f, -0.684300005f, -0.562099993f, -0.46450001f,
+	-0.00371400011f, 0.378616989f, 0.0540070012f, 0.343300015f, 0.602900028f, -0.752799988f, -0.64380002f, 0.137500003f,
+	0.00140199997f, 0.372373015f, 0.0539860018f, 0.341300011f, 0.60589999f, -0.767499983f, -0.617799997f, 0.171200007f,
+	0.0184920002f, 0.371746987f, 0.0801839978f, 0.349400014f, 0.617600024f, -0.494700015f, -0.675100029f, 0.547200024f,
+	0.0114160003f, 0.379978001f, 0.0845519975f, 0.353599995f, 0.614400029f, -0.50819999f, -0.701900005f, 0.4991f,
+	0.0038350001f, 0.37659201f, 0.0216090009f, 0.329400003f, 0.597000003f, -0.826399982f, -0.547100008f, -0.133399993f,
+	0.00719100004f, 0.370020002f, 0.0263749994f, 0.329400003f, 0.601000011f, -0.840900004f, -0.524900019f, -0.131600007f,
+	0.0430880003f, 0.380618006f, 0.101767004f, 0.3583f, 0.630100012f, -0.00800000038f, -0.617999971f, 0.786199987f,
+	0.0430460013f, 0.370757014f, 0.0944650024f, 0.352699995f, 0.629999995f, 0.0111999996f, -0.595099986f, 0.803600013f,
+	0.0671759993f, 0.369049013f, 0.0785629973f, 0.3477f, 0.642099977f, 0.558899999f, -0.627200007f, 0.542400002f,
+	0.0729319975f, 0.378538013f, 0.0834779963f, 0.352400005f, 0.644800007f, 0.549399972f, -0.622099996f, 0.557699978f,
+	0.0866030008f, 0.375532001f, 0.0531769991f, 0.341899991f, 0.655700028f, 0.670700014f, -0.736800015f, 0.0854000002f,
+	0.0778459981f, 0.367823005f, 0.0534510016f, 0.33919999f, 0.65109998f, 0.672900021f, -0.732299984f, 0.104599997f,
+	0.0803719983f, 0.375667006f, 0.0219209995f, 0.328599989f, 0.66140002f, 0.754299998f, -0.648800015f, -0.101000004f,
+	0.0743089989f, 0.367220998f, 0.0259610005f, 0.327800006f, 0.656400025f, 0.788800001f, -0.608399987f, -0.0881000012f,
+	0.00371400011f, 0.378616989f, 0.0540070012f, 0.34040001f, 0.899600029f, 0.752799988f, -0.64380002f, 0.137500003f,
+	-0.0114160003f, 0.379978001f, 0.0845519975f, 0.3301f, 0.888100028f, 0.50819999f, -0.701900005f, 0.4991f,
+	-0.0184920002f, 0.371746987f, 0.0801839978f, 0.334300011f, 0.884899974f, 0.494700015f, -0.675100029f, 0.547200024f,
+	-0.00140199997f, 0.372373015f, 0.0539860018f, 0.342400014f, 0.896499991f, 0.767499983f, -0.617799997f, 0.171200007f,
+	-0.0038350001f, 0.37659201f, 0.0216090009f, 0.354400009f, 0.905399978f, 0.826399982f, -0.547100008f, -0.133399993f,
+	-0.0430880003f, 0.380618006f, 0.101767004f, 0.325399995f, 0.872399986f, 0.00800000038f, -0.617999971f, 0.786199987f,
+	-0.0430460013f, 0.370757014f, 0.0944650024f, 0.330900013f, 0.872500002f, -0.0111999996f, -0.595099986f, 0.803600013f,
+	-0.0671759993f, 0.369049013f, 0.0785629973f, 0.335999995f, 0.860400021f, -0.558899999f, -0.627200007f, 0.542400002f,
+	-0.0729319975f, 0.378538013f, 0.0834779963f, 0.33129999f, 0.857599974f, -0.549399972f, -0.622099996f, 0.557699978f,
+	-0.0866030008f, 0.375532001f, 0.0531769991f, 0.341800004f, 0.846800029f, -0.670700014f, -0.736800015f, 0.0854000002f,
+	-0.0778459981f, 0.367823005f, 0.0534510016f, 0.344500005f, 0.851300001f, -0.672900021f, -0.732299984f, 0.104599997f,
+	-0.0803719983f, 0.375667006f, 0.0219209995f, 0.355100006f, 0.841000021f, -0.754299998f, -0.648800015f, -0.101000004f,
+	-0.0743089989f, 0.367220998f, 0.0259610005f, 0.35589999f, 0.846000016f, -0.788800001f, -0.608399987f, -0.0881000012f,
+	-0.00719100004f, 0.370020002f, 0.0263749994f, 0.354299992f, 0.90140003f, 0.840900004f, -0.524900019f, -0.131600007f,
+	-0.0410429984f, 0.797589004f, -0.159654006f, 0.123899996f, 0.325800002f, -0.432300001f, 0.694000006f, -0.575800002f,
+	-0.0432199985f, 0.790292978f, -0.165006995f, 0.127700001f, 0.323599994f, -0.344399989f, 0.403400004f, -0.8477f,
+	-0.0456760004f, 0.795267999f, -0.159336999f, 0.126000002f, 0.326900005f, -0.358099997f, 0.619499981f, -0.698599994f,
+	-0.010822f, 0.809059978f, -0.169975996f, 0.112599999f, 0.315200001f, -0.0218000002f, 0.677900016f, -0.734899998f,
+	-0.0407500006f, 0.779991984f, -0.167689994f, 0.131300002f, 0.319799989f, -0.270799994f, -0.0474999994f, -0.961499989f,
+	-0.00660399999f, 0.786603987f, -0.175558999f, 0.120300002f, 0.308299989f, 0.171299994f, 0.0614f, -0.983299971f,
+	0.0171959996f, 0.811125994f, -0.153715998f, 0.102799997f, 0.30340001f, 0.480699986f, 0.71329999f, -0.50999999f,
+	-0.0027699999f, 0.752542019f, -0.170245007f, 0.132100001f, 0.298099995f, 0.0785000026f, -0.556900024f, -0.826900005f,
+	-0.0354080014f, 0.760326028f, -0.160337001f, 0.138699993f, 0.312900007f, -0.351999998f, -0.617200017f, -0.703700006f,
+	0.0225060005f, 0.788828015f, -0.155390993f, 0.110799998f, 0.296000004f, 0.740199983f, 0.0910999998f, -0.666199982f,
+	0.0199549999f, 0.811455011f, -0.149122f, 0.101199999f, 0.300999999f, 0.680700004f, 0.727999985f, -0.0811000019f,
+	0.0213690009f, 0.750258982f, -0.155697003f, 0.126000002f, 0.286599994f, 0.65990001f, -0.60650003f, -0.443500012f,
+	0.0247530006f, 0.789179981f, -0.151176006f, 0.109800003f, 0.294699997f, 0.987399995f, 0.0863000005f, -0.132499993f,
+	0.0220960006f, 0.750316978f, -0.151490003f, 0.124899998f, 0.284999996f, 0.744300008f, -0.667100012f, 0.0328000002f,
+	-0.0910440013f, 0.67485702f, 0.0546449982f, 0.201499999f, 0.798799992f, -0.187399998f, 0.955900013f, 0.226199999f,
+	-0.0935249999f, 0.675348997f, 0.0505129993f, 0.202900007f, 0.800499976f, -0.187399998f, 0.955900013f, 0.226199999f,
+	-0.0955160037f, 0.67375201f, 0.0556100011f, 0.200299993f, 0.800499976f, -0.187399998f, 0.955900013f, 0.226199999f,
+	-0.152637005f, 0.788985014f, -0.089515999f, 0.158700004f, 0.373199999f, -0.0559f, 0.260399997f, -0.96390003f,
+	-0.170645997f, 0.762421012f, -0.0949869975f, 0.163200006f, 0.387199998f, -0.0716999993f, 0.247600004f, -0.966199994f,
+	-0.177435994f, 0.761258006f, -0.0947809964f, 0.161699995f, 0.389899999f, -0.0733999982f, 0.248999998f, -0.965699971f,
+	-0.154667005f, 0.797011018f, -0.0872260034f, 0.155200005f, 0.371499985f, -0.0208000001f, 0.275900006f, -0.961000025f,
+	-0.132404f, 0.815711975f, -0.0816759989f, 0.154699996f, 0.358099997f, -0.1021f, 0.392800003f, -0.913900018f,
+	-0.131600007f, 0.821362019f, -0.0792689994f, 0.152700007f, 0.356099993f, -0.112099998f, 0.402999997f, -0.908299983f,
+	-0.102532998f, 0.723322988f, -0.0204869993f, 0.142399997f, 0.975099981f, -0.571099997f, 0.555100024f, -0.604700029f,
+	-0.115997002f, 0.733229995f, 0.00604300015f, 0.128299996f, 0.973200023f, -0.802900016f, 0.295399994f, -0.517799973f,
+	-0.112874001f, 0.741365016f, 0.00584100001f, 0.128299996f, 0.969200015f, -0.774999976f, 0.336499989f, -0.535000026f,
+	-0.0984689966f, 0.727272987f, -0.0200769994f, 0.142800003f, 0.972599983f, -0.518299997f, 0.596800029f, -0.612600029f,
+	0.0744189993f, 0.722761989f, -0.147847995f, 0.166700006f, 0.492900014f, 0.894599974f, 0.433999985f, -0.106200002f,
+	0.0733620003f, 0.723267972f, -0.154785007f, 0.163499996f, 0.493299991f, 0.894800007f, 0.434100002f, -0.104699999f,
+	0.0616220012f, 0.749347985f, -0.146996006f, 0.163900003f, 0.479799986f, 0.836099982f, 0.54519999f, 0.060800001f,
+	0.0646400005f, 0.744266987f, -0.142849997f, 0.1664f, 0.481999993f, 0.872799993f, 0.486000001f, -0.0454000011f,
+	0.0486200005f, 0.764515996f, -0.136078998f, 0.166700006f, 0.469900012f, 0.79369998f, 0.604099989f, 0.0715000033f,
+	0.052480001f, 0.759465992f, -0.134802997f, 0.167899996f, 0.472600013f, 0.789499998f, 0.612600029f, 0.0359000005f,
+	-0.0970479995f, 0.718715012f, -0.0244689994f, 0.232099995f, 0.929799974f, -0.899500012f, 0.382699996f, -0.210999995f,
+	-0.0961230025f, 0.717413008f, -0.0307759997f, 0.234599993f, 0.931400001f, -0.899500012f, 0.382699996f, -0.210999995f,
+	-0.0990469977f, 0.714682996f, -0.023263f, 0.230800003f, 0.931400001f, -0.899500012f, 0.382699996f, -0.210999995f,
+	0.0975169986f, 0.667984009f, -0.0381239988f, 0.111900002f, 0.901799977f, 0.287699997f, 0.886699975f, -0.361900002f,
+	0.0987560004f, 0.665507019f, -0.0432059988f, 0.109300002f, 0.901799977f, 0.287699997f, 0.886699975f, -0.361900002f,
+	0.0957610011f, 0.666691005f, -0.0426869988f, 0.109999999f, 0.9005f, 0.287699997f, 0.886699975f, -0.361900002f,
+	0.0138590001f, 0.864067018f, -0.0617050007f, 0.0168999992f, 0.719799995f, 0.622500002f, 0.269600004f, -0.734799981f,
+	0.0180719998f, 0.880135f, -0.0521389991f, 0.0243999995f, 0.715399981f, 0.5977f, 0.285699993f, -0.749100029f,
+	0.0244270004f, 0.887017012f, -0.0448459983f, 0.0297999997f, 0.7148f, 0.680999994f, 0.275099993f, -0.678600013f,
+	0.0266529992f, 0.880288005f, -0.0454099998f, 0.0286999997f, 0.717899978f, 0.646099985f, 0.273499995f, -0.712499976f,
+	0.00938300043f, 0.911463022f, -0.0490670018f, 0.0298999995f, 0.701699972f, 0.545799971f, 0.210800007f, -0.81099999f,
+	0.0149729997f, 0.905485988f, -0.0469859987f, 0.0307f, 0.70539999f, 0.541199982f, 0.224099994f, -0.810500026f,
+	0.0136700002f, 0.921651006f, -0.0437990017f, 0.0348999985f, 0.699199975f, 0.550000012f, 0.189199999f, -0.813399971f,
+	0.0098679997f, 0.921154022f, -0.0465659983f, 0.0329999998f, 0.698300004f, 0.563300014f, 0.179900005f, -0.806400001f,
+	0.0405020006f, 0.904145002f, -0.0193109997f, 0.0454999991f, 0.713999987f, 0.8477f, 0.184699997f, -0.497299999f,
+	0.0376060009f, 0.909964025f, -0.0222420003f, 0.0450000018f, 0.710799992f, 0.852699995f, 0.167899996f, -0.494599998f,
+	0.0491000004f, 0.915948987f, 0.00647199992f, 0.0588999987f, 0.714100003f, 0.939199984f, 0.202099994f, -0.27759999f,
+	0.0469449982f, 0.923785985f, 0.00491600018f, 0.0593999997f, 0.710399985f, 0.941900015f, 0.206400007f, -0.264899999f,
+	0.048932001f, 0.929942012f, 0.0277939998f, 0.070100002f, 0.711600006f, 0.977100015f, 0.212099999f, -0.0146000003f,
+	0.0507230014f, 0.921562016f, 0.0293109994f, 0.0694999993f, 0.715499997f, 0.978299975f, 0.206300005f, -0.0177999996f,
+	0.0463260002f, 0.934391022f, 0.0462229997f, 0.0788000003f, 0.712300003f, 0.945299983f, 0.253699988f, 0.2051f,
+	0.0483499989f, 0.924672008f, 0.0489379987f, 0.0784000009f, 0.717000008f, 0.943099976f, 0.2509f, 0.218099996f,
+	0.0397100002f, 0.936262012f, 0.0626709983f, 0.0868000016f, 0.713500023f, 0.810100019f, 0.273099989f, 0.518899977f,
+	0.0417199992f, 0.926696002f, 0.0642760023f, 0.0860000029f, 0.717999995f, 0.822099984f, 0.257999986f, 0.507600009f,
+	0.0306499992f, 0.928318024f, 0.0754799992f, 0.0930999964f, 0.718299985f, 0.577099979f, 0.273900002f, 0.769400001f,
+	0.026904f, 0.936782002f, 0.0753170028f, 0.0948999971f, 0.71450001f, 0.507200003f, 0.240400001f, 0.827600002f,
+	0.0126130003f, 0.936568975f, 0.0813950002f, 0.101899996f, 0.714900017f, 0.302599996f, 0.269600004f, 0.914200008f,
+	0.01456f, 0.926208973f, 0.0839840025f, 0.101300001f, 0.719799995f, 0.316199988f, 0.293300003f, 0.902199984f,
+	0.0f, 0.934903026f, 0.0845279992f, 0.107799999f, 0.715699971f, 0.0f, 0.305999994f, 0.952000022f,
+	0.0f, 0.926307023f, 0.0874719992f, 0.108099997f, 0.719799995f, 0.0f, 0.324000001f, 0.94599998f,
+	-0.01456f, 0.926208973f, 0.0839840025f, 0.114799999f, 0.718800008f, -0.316199988f, 0.293300003f, 0.902199984f,
+	-0.0126130003f, 0.936568975f, 0.0813950002f, 0.113499999f, 0.714100003f, -0.302599996f, 0.269600004f, 0.914200008f,
+	0.0351990014f, 0.649784982f, -0.156809002f, 0.817600012f, 0.317999989f, 0.205599993f, 0.0373000018f, -0.977900028f,
+	-0.000288999989f, 0.651832998f, -0.161567003f, 0.801400006f, 0.317400008f, -0.0131000001f, 0.00639999984f, -0.999899983f,
+	0.00142900005f, 0.667782009f, -0.161487997f, 0.801999986f, 0.310200006f, 0.0164000001f, 0.00669999979f, -0.999800026f,
+	0.0427520014f, 0.666508973f, -0.154409006f, 0.82099998f, 0.310400009f, 0.0900999978f, 0.0590000004f, -0.994199991f,
+	0.0402150005f, 0.644514024f, -0.155662f, 0.819999993f, 0.3204f, 0.0896999985f, 0.00650000013f, -0.995899975f,
+	-0.0347499996f, 0.648921013f, -0.156802997f, 0.785600007f, 0.319000006f, -0.131099999f, -0.0790999979f, -0.988200009f,
+	-0.0427829996f, 0.666441023f, -0.156607002f, 0.781899989f, 0.311100006f, -0.0964000002f, -0.0329999998f, -0.994799972f,
+	-0.0518499985f, 0.659135997f, -0.155621007f, 0.777800024f, 0.314500004f, -0.074500002f, -0.061999999f, -0.995299995f,
+	-0.0394610018f, 0.645196021f, -0.155210003f, 0.783500016f, 0.320800006f, -0.0980999991f, -0.0898000002f, -0.991100013f,
+	-0.0581029989f, 0.648805022f, -0.154734001f, 0.774999976f, 0.319200009f, -0.0348000005f, -0.0406000018f, -0.998600006f,
+	-0.0439409986f, 0.638121009f, -0.155328006f, 0.781400025f, 0.324000001f, -0.0557000004f, -0.0183000006f, -0.998300016f,
+	-0.0496889986f, 0.604649007f, -0.153078005f, 0.778900027f, 0.33919999f, 0.0177999996f, -0.0340999998f, -0.999300003f,
+	-0.0695480034f, 0.60028702f, -0.153744996f, 0.769900024f, 0.341199994f, 0.0401000008f, -0.0297999997f, -0.99879998f,
+	0.0523729995f, 0.659680009f, -0.155279994f, 0.825399995f, 0.313499987f, 0.0373999998f, 0.0137999998f, -0.999199986f,
+	0.0445739999f, 0.636669993f, -0.155276f, 0.822000027f, 0.323900014f, 0.070100002f, 0.00899999961f, -0.997500002f,
+	0.0568899997f, 0.650636971f, -0.153830007f, 0.827600002f, 0.317600012f, 0.147699997f, -0.0278999992f, -0.988600016f,
+	0.0713260025f, 0.598375976f, -0.155039996f, 0.834200025f, 0.341199994f, 0.0214000009f, 0.00879999995f, -0.99970001f,
+	0.0494720004f, 0.604250014f, -0.155039996f, 0.824299991f, 0.33860001f, -0.00200000009f, -0.00760000013f, -1.0f,
+	-0.0325249992f, 0.680666029f, -0.0630950034f, 0.631299973f, 0.449699998f, -0.112800002f, 0.772199988f, -0.62529999f,
+	-0.0301099997f, 0.682989001f, -0.0606620014f, 0.633099973f, 0.449299991f, -0.1087f, 0.77670002f, -0.620500028f,
+	-0.0243759993f, 0.678017974f, -0.0670799986f, 0.632600009f, 0.453799993f, -0.072300002f, 0.756200016f, -0.650300026f,
+	-0.049761001f, 0.683485985f, -0.0552540012f, 0.627699971f, 0.441799998f, -0.220400006f, 0.859700024f, -0.460799992f,
+	-0.0486930013f, 0.685099006f, -0.052689001f, 0.629000008f, 0.441100001f, -0.248799995f, 0.862699986f, -0.440200001f,
+	-0.0734779984f, 0.683903992f, -0.0328220017f, 0.62470001f, 0.427300006f, -0.462399989f, 0.820900023f, -0.335099995f,
+	-0.0721170008f, 0.685303986f, -0.0312770009f, 0.625800014f, 0.426999986f, -0.489600003f, 0.815800011f, -0.307799995f,
+	-0.082987003f, 0.685545981f, -0.00164300005f, 0.628000021f, 0.412900001f, -0.640600026f, 0.765999973f, -0.0531000011f,
+	-0.0851399973f, 0.683691025f, -0.00240599993f, 0.626699984f, 0.412699997f, -0.631699979f, 0.770299971f, -0.0872000009f,
+	-0.080167003f, 0.68514502f, 0.0235259999f, 0.63349998f, 0.402799994f, -0.634500027f, 0.733099997f, 0.245000005f,
+	-0.0818379968f, 0.683758974f, 0.0233319998f, 0.632499993f, 0.402500004f, -0.639699996f, 0.745299995f, 0.187900007f,
+	-0.0664400011f, 0.683588982f, 0.0506010018f, 0.642700016f, 0.3926f, -0.439500004f, 0.794399977f, 0.419200003f,
+	-0.0652289987f, 0.685087025f, 0.0490179993f, 0.64319998f, 0.393599987f, -0.457300007f, 0.792699993f, 0.403200001f,
+	-0.0412960015f, 0.683435023f, 0.0685710013f, 0.655499995f, 0.386700004f, -0.294499993f, 0.753499985f, 0.587800026f,
+	-0.0403800011f, 0.685171008f, 0.0668160021f, 0.655799985f, 0.387899995f, -0.29519999f, 0.75f, 0.591899991f,
+	-0.0192389991f, 0.683377028f, 0.0755589977f, 0.665700018f, 0.3847f, -0.159899995f, 0.693799973f, 0.702199996f,
+	-0.0189890005f, 0.685329974f, 0.0736979991f, 0.665799975f, 0.385899991f, -0.159299999f, 0.708199978f, 0.68779999f,
+	0.0f, 0.684001982f, 0.077572003f, 0.674499989f, 0.38440001f, -0.000199999995f, 0.927200019f, 0.374599993f,
+	0.0f, 0.685136974f, 0.0743990019f, 0.674399972f, 0.385899991f, -0.0f, 0.941600025f, 0.336699992f,
+	0.0192510001f, 0.683407009f, 0.0756160021f, 0.683200002f, 0.385399997f, 0.155699998f, 0.709800005f, 0.686999977f,
+	0.0189890005f, 0.685329974f, 0.0736979991f, 0.683000028f, 0.386700004f, 0.155000001f, 0.72359997f, 0.672599971f,
+	0.0412960015f, 0.683435023f, 0.0685719997f, 0.693300009f, 0.388399988f, 0.303900003f, 0.753400028f, 0.583100021f,
+	0.0403769985f, 0.685167015f, 0.0668089986f, 0.692799985f, 0.389499992f, 0.303200006f, 0.752600014f, 0.584599972f,
+	0.0658319965f, 0.683180988f, 0.0500519983f, 0.705299973f, 0.395500004f, 0.508599997f, 0.716600001f, 0.477200001f,
+	0.0648299977f, 0.684819996f, 0.0486570001f, 0.70480001f, 0.396400005f, 0.526799977f, 0.7148f, 0.460000008f,
+	0.0818379968f, 0.683758974f, 0.0233319998f, 0.714900017f, 0.405900002f, 0.639299989f, 0.743700027f, 0.195600003f,
+	0.080167003f, 0.68514502f, 0.0235259999f, 0.71390003f, 0.406199992f, 0.635699987f, 0.726199985f, 0.261700004f,
+	0.0849940032f, 0.683619022f, -0.00238800002f, 0.720000029f, 0.416500002f, 0.663999975f, 0.739099979f, -0.113300003f,
+	0.082987003f, 0.685545981f, -0.00164300005f, 0.718699992f, 0.416599989f, 0.677100003f, 0.732200027f, -0.0741999969f,
+	0.0724020004f, 0.683224976f, -0.0321010016f, 0.721199989f, 0.431100011f, 0.55369997f, 0.734700024f, -0.39199999f,
+	0.0713180006f, 0.684786975f, -0.0307390001f, 0.720200002f, 0.430700004f, 0.583500028f, 0.724699974f, -0.36649999f,
+	0.0497939996f, 0.683522999f, -0.0553079993f, 0.718200028f, 0.4454f, 0.251599997f, 0.837100029f, -0.485799998f,
+	0.0488060005f, 0.685220003f, -0.0528779998f, 0.717000008f, 0.444700003f, 0.293000013f, 0.834399998f, -0.466800004f,
+	0.0300980005f, 0.682982028f, -0.0606469996f, 0.712800026f, 0.452899992f, 0.0828000009f, 0.799199998f, -0.595399976f,
+	0.0325819999f, 0.68076098f, -0.063267f, 0.714699984f, 0.453399986f, 0.0864000022f, 0.798900008f, -0.595300019f,
+	0.0243759993f, 0.678017974f, -0.0670809969f, 0.713199973f, 0.457399994f, 0.0322000012f, 0.7773f, -0.628300011f,
+	-0.0179130007f, 0.493243992f, -0.152253002f, 0.682900012f, 0.207699999f, -0.00039999999f, 0.00249999994f, -1.0f,
+	-0.021706f, 0.650507987f, -0.152368993f, 0.754100025f, 0.204400003f, 0.00350000011f, -0.000699999975f, -1.0f,
+	0.0230749995f, 0.650759995f, -0.152215004f, 0.754700005f, 0.224600002f, 0.00300000003f, -0.000500000024f, -1.0f,
+	0.0179130007f, 0.493243992f, -0.152253002f, 0.683300018f, 0.223900005f, 0.0f, 0.00270000007f, -1.0f,
+	0.0289580002f, 0.228930995f, -0.153605998f, 0.56370002f, 0.2315f, -0.00879999995f, -0.0197000001f, -0.999800026f,
+	-0.0305819996f, 0.227125004f, -0.153015003f, 0.562300026f, 0.204600006f, -0.00930000003f, -0.0209999997f, -0.99970001f,
+	-0.000814000028f, 0.168145999f, -0.150135994f, 0.535899997f, 0.218600005f, -0.00829999987f, -0.0529000014f, -0.998600006f,
+	-0.049637001f, 0.759334028f, -0.0597640015f, 0.411599994f, 0.410100013f, -0.859700024f, 0.28459999f, -0.424199998f,
+	-0.0501470007f, 0.751406014f, -0.0642260015f, 0.414900005f, 0.412600011f, -0.858699977f, 0.292199999f, -0.421099991f,
+	-0.0646229982f, 0.751037002f, -0.0349610001f, 0.401800007f, 0.41960001f, -0.906300008f, 0.226999998f, -0.3565f,
+	-0.0634189993f, 0.757934988f, -0.0337480009f, 0.400099993f, 0.416799992f, -0.90990001f, 0.224900007f, -0.3486f,
+	-0.0762929991f, 0.750374973f, 0.00728400005f, 0.3838f, 0.428200006f, -0.957300007f, 0.288800001f, -0.0133999996f,
+	-0.0742110014f, 0.757174015f, 0.0076700002f, 0.382600009f, 0.425300002f, -0.954999983f, 0.296400011f, -0.0131000001f,
+	-0.0695130005f, 0.747568011f, 0.0411100015f, 0.369199991f, 0.433999985f, -0.852199972f, 0.276600003f, 0.444200009f,
+	-0.0671830028f, 0.753969014f, 0.0415420011f, 0.367900014f, 0.431199998f, -0.826499999f, 0.282599986f, 0.486999989f,
+	-0.045818001f, 0.745124996f, 0.0664020032f, 0.353799999f, 0.437400013f, -0.487699986f, 0.285299987f, 0.825100005f,
+	-0.0420240015f, 0.752071023f, 0.0659300014f, 0.352200001f, 0.434100002f, -0.387600005f, 0.271600008f, 0.880900025f,
+	-0.0f, 0.742838979f, 0.0736510009f, 0.332700014f, 0.4375f, 0.0259000007f, -0.190300003f, 0.981400013f,
+	-0.0f, 0.750571012f, 0.0753019974f, 0.332700014f, 0.433999985f, 0.0262000002f, -0.190300003f, 0.981400013f,
+	0.0420240015f, 0.752071023f, 0.0659300014f, 0.31310001f, 0.433999985f, 0.371600002f, 0.229300007f, 0.899600029f,
+	0.0458169989f, 0.745124996f, 0.0664020032f, 0.311500013f, 0.43720001f, 0.479600012f, 0.317499995f, 0.818000019f,
+	0.0695130005f, 0.747568011f, 0.0411100015f, 0.296099991f, 0.433800012f, 0.842400014f, 0.291099995f, 0.453500003f,
+	0.067181997f, 0.753969014f, 0.0415420011f, 0.297399998f, 0.430999994f, 0.822899997f, 0.262300014f, 0.504100025f,
+	0.0762929991f, 0.750374973f, 0.00728400005f, 0.281500012f, 0.428000003f, 0.954900026f, 0.296600014f, -0.0153000001f,
+	0.074210003f, 0.757174015f, 0.0076700002f, 0.282799989f, 0.425099999f, 0.957199991f, 0.289099991f, -0.0161000006f,
+	0.0646229982f, 0.751037002f, -0.0349619985f, 0.263599992f, 0.419400007f, 0.912f, 0.224299997f, -0.343499988f,
+	0.0634189993f, 0.757934988f, -0.0337480009f, 0.265199989f, 0.416599989f, 0.915199995f, 0.224399999f, -0.334600002f,
+	0.0501459986f, 0.751406014f, -0.0642260015f, 0.250400007f, 0.412499994f, 0.854600012f, 0.2861f, -0.433400005f,
+	0.049637001f, 0.759334028f, -0.0597640015f, 0.253699988f, 0.40990001f, 0.849799991f, 0.298900008f, -0.434100002f,
+	-0.0425890014f, 0.803160012f, -0.156826004f, 0.171800002f, 0.323199987f, 0.740499973f, 0.443100005f, -0.505299985f,
+	-0.0367190018f, 0.814215004f, -0.140313998f, 0.174999997f, 0.314399987f, 0.834100008f, 0.273099989f, -0.479299992f,
+	-0.0344530009f, 0.810434997f, -0.138524994f, 0.177100003f, 0.315100014f, 0.822300017f, 0.298900008f, -0.484299988f,
+	-0.0410429984f, 0.797589004f, -0.159654006f, 0.172900006f, 0.325899988f, 0.729200006f, 0.459600002f, -0.506900012f,
+	-0.0205349997f, 0.779150009f, -0.118828997f, 0.167600006f, 0.286199987f, 0.589100003f, -0.398799986f, 0.702799976f,
+	-0.0172320008f, 0.783069015f, -0.132467002f, 0.171499997f, 0.291900009f, 0.543799996f, -0.466800004f, 0.697399974f,
+	-0.00428400002f, 0.806940019f, -0.125828996f, 0.162f, 0.300500005f, 0.57190001f, -0.405600011f, 0.713100016f,
+	-0.0115369996f, 0.806209981f, -0.116291001f, 0.158800006f, 0.296200007f, 0.498400003f, -0.27610001f, 0.821799994f,
+	-0.0288970005f, 0.796916008f, -0.113922f, 0.158299997f, 0.28670001f, -0.1303f, 0.00899999961f, 0.991400003f,
+	-0.0161199998f, 0.814948022f, -0.112924002f, 0.154499993f, 0.295899987f, -0.0105999997f, 0.244800001f, 0.969500005f,
+	-0.00189800002f, 0.810217977f, -0.120832004f, 0.158700004f, 0.301999986f, 0.430400014f, -0.662299991f, 0.613300025f,
+	-0.0394660011f, 0.806881011f, -0.121738002f, 0.150399998f, 0.284999996f, -0.218999997f, 0.765799999f, 0.604600012f,
+	-0.00299099996f, 0.820339978f, -0.116469003f, 0.153699994f, 0.30219999f, 0.166500002f, 0.29460001f, 0.940999985f,
+	-0.0198500007f, 0.819705009f, -0.117983997f, 0.151500002f, 0.295399994f, -0.380299985f, 0.800800025f, 0.462700009f,
+	0.0139910001f, 0.813793004f, -0.123777002f, 0.157499999f, 0.310099989f, 0.38530001f, -0.756799996f, 0.527999997f,
+	-0.00574199995f, 0.825133026f, -0.122218996f, 0.150099993f, 0.301899999f, -0.187700003f, 0.95450002f, 0.231900007f,
+	0.0123420004f, 0.823045015f, -0.120661996f, 0.153099999f, 0.309199989f, 0.290399998f, 0.305900007f, 0.906700015f,
+	-0.0248349998f, 0.817678988f, -0.124971002f, 0.148599997f, 0.293099999f, -0.462099999f, 0.885800004f, -0.0434000008f,
+	-0.0344530009f, 0.810434997f, -0.138524994f, 0.142700002f, 0.287800014f, -0.377299994f, 0.913299978f, -0.153300002f,
+	-0.0215119999f, 0.814032018f, -0.143361002f, 0.140200004f, 0.293900013f, -0.181899995f, 0.930800021f, -0.317000002f,
+	-0.00505599985f, 0.822660029f, -0.131843001f, 0.145300001f, 0.302599996f, -0.1215f, 0.771700025f, -0.624300003f,
+	0.00913299993f, 0.828172982f, -0.125455007f, 0.149900004f, 0.308499992f, 0.0109000001f, 0.977900028f, 0.209000006f,
+	0.0245769992f, 0.82368201f, -0.126939997f, 0.152099997f, 0.315100014f, 0.575299978f, 0.434199989f, 0.693199992f,
+	0.0247409996f, 0.818078995f, -0.127263993f, 0.154699996f, 0.315499991f, 0.653500021f, -0.566799998f, 0.501699984f,
+	0.0242619999f, 0.826102018f, -0.130832002f, 0.150199994f, 0.315400004f, 0.448399991f, 0.89380002f, 0.000899999985f,
+	0.00636299979f, 0.825001001f, -0.133221999f, 0.146200001f, 0.307999998f, -0.163299993f, 0.643700004f, -0.747600019f,
+	-0.0143510001f, 0.812552989f, -0.142772004f, 0.138999999f, 0.297300011f, 0.432900012f, 0.794099987f, -0.426600009f,
+	-0.00257300003f, 0.813464999f, -0.133598998f, 0.140799999f, 0.304100007f, 0.529399991f, -0.157199994f, -0.833599985f,
+	0.00738300011f, 0.816404998f, -0.134265006f, 0.142399997f, 0.309199989f, -0.0113000004f, -0.403100014f, -0.915099978f,
+	0.0215290003f, 0.82495302f, -0.135776997f, 0.147599995f, 0.314900011f, 0.0851999968f, 0.699599981f, -0.709399998f,
+	0.0279799998f, 0.821543992f, -0.130513996f, 0.152199998f, 0.317400008f, 0.979799986f, -0.0960000008f, 0.1752f,
+	0.0278309993f, 0.821965992f, -0.132752001f, 0.1505f, 0.317799985f, 0.940699995f, 0.0289999992f, -0.338099986f,
+	0.0256900005f, 0.822878003f, -0.135830998f, 0.148200005f, 0.316900015f, 0.6505f, 0.291000009f, -0.701499999f,
+	0.0197269991f, 0.819325984f, -0.137085006f, 0.145199999f, 0.314999998f, 0.0529999994f, -0.332500011f, -0.941600025f,
+	-0.0138590001f, 0.864067018f, -0.0617050007f, 0.105599999f, 0.676599979f, -0.609899998f, 0.2773f, -0.742399991f,
+	-0.0266529992f, 0.880288005f, -0.0454099998f, 0.117299996f, 0.678499997f, -0.646099985f, 0.273499995f, -0.712499976f,
+	-0.0244270004f, 0.887017012f, -0.0448459983f, 0.1184f, 0.681599975f, -0.680999994f, 0.275099993f, -0.678600013f,
+	-0.0180719998f, 0.880135f, -0.0521389991f, 0.112999998f, 0.680999994f, -0.588400006f, 0.293000013f, -0.753600001f,
+	-0.010861f, 0.897421002f, -0.0520960018f, 0.115000002f, 0.689300001f, -0.631900012f, 0.392699987f, -0.668200016f,
+	-0.0405020006f, 0.904145002f, -0.0193109997f, 0.134100005f, 0.682399988f, -0.8477f, 0.184699997f, -0.497299999f,
+	-0.0376060009f, 0.909964025f, -0.0222420003f, 0.133599997f, 0.685599983f, -0.852699995f, 0.167899996f, -0.494599998f,
+	-0.0491000004f, 0.915948987f, 0.00647199992f, 0.147499993f, 0.682299972f, -0.939199984f, 0.202099994f, -0.27759999f,
+	-0.0469449982f, 0.923785985f, 0.00491600018f, 0.148100004f, 0.68599999f, -0.941900015f, 0.206400007f, -0.264899999f,
+	-0.048932001f, 0.929942012f, 0.0277939998f, 0.158800006f, 0.684800029f, -0.977100015f, 0.212099999f, -0.0146000003f,
+	-0.0507230014f, 0.921562016f, 0.0293109994f, 0.158099994f, 0.680899978f, -0.978299975f, 0.206300005f, -0.0177999996f,
+	-0.0463260002f, 0.934391022f, 0.0462229997f, 0.167400002f, 0.684099972f, -0.945299983f, 0.253699988f, 0.2051f,
+	-0.0483499989f, 0.924672008f, 0.0489379987f, 0.166999996f, 0.679400027f, -0.943099976f, 0.2509f, 0.218099996f,
+	-0.0397100002f, 0.936262012f, 0.0626709983f, 0.175400004f, 0.682900012f, -0.810100019f, 0.273099989f, 0.518899977f,
+	-0.0417199992f, 0.926696002f, 0.0642760023f, 0.174600005f, 0.678499997f, -0.822099984f, 0.257999986f, 0.507600009f,
+	-0.0306499992f, 0.928318024f, 0.0754799992f, 0.181700006f, 0.67809999f, -0.577099979f, 0.273900002f, 0.769400001f,
+	-0.026904f, 0.936782002f, 0.0753170028f, 0.183500007f, 0.681900024f, -0.507200003f, 0.240400001f, 0.827600002f,
+	-0.0126130003f, 0.936568975f, 0.0813950002f, 0.190500006f, 0.681500018f, -0.302599996f, 0.269600004f, 0.914200008f,
+	-0.01456f, 0.926208973f, 0.0839840025f, 0.189899996f, 0.676599979f, -0.316199988f, 0.293300003f, 0.902199984f,
+	-0.0154600004f, 0.895206988f, -0.0490740016f, 0.116599999f, 0.687099993f, -0.615999997f, 0.348800004f, -0.70630002f,
+	-0.00980199967f, 0.902072012f, -0.0495150015f, 0.116499998f, 0.691100001f, -0.6171f, 0.467999995f, -0.632600009f,
+	-0.0154149998f, 0.898483992f, -0.0469340011f, 0.117899999f, 0.688199997f, -0.593200028f, 0.445899993f, -0.670300007f,
+	0.0257089995f, 0.977208972f, -0.0169459991f, 0.0892999992f, 0.755400002f, 0.796800017f, 0.197300002f, -0.571099997f,
+	0.0286720004f, 0.970465004f, -0.0149029996f, 0.0877000019f, 0.758400023f, 0.832599998f, 0.172999993f, -0.526199996f,
+	0.0146700004f, 0.965285003f, -0.033427f, 0.0795999989f, 0.751399994f, 0.668099999f, 0.210500002f, -0.713699996f,
+	0.00885299966f, 0.972424984f, -0.0366149992f, 0.0807000026f, 0.747099996f, 0.662599981f, 0.226899996f, -0.713800013f,
+	0.0339200012f, 0.979272008f, -0.00124400004f, 0.0949999988f, 0.761099994f, 0.917100012f, 0.115199998f, -0.381700009f,
+	0.0396520011f, 0.972180009f, 0.0110940002f, 0.0964000002f, 0.76789999f, 0.929799974f, 0.184400007f, -0.318599999f,
+	0.0338889994f, 0.980599999f, -0.000739999989f, 0.0956000015f, 0.760900021f, 0.926500022f, 0.175400004f, -0.332800001f,
+	0.0396809988f, 0.974398971f, 0.0129079996f, 0.0976999998f, 0.76789999f, 0.930299997f, 0.215299994f, -0.296999991f,
+	0.03235f, 0.990242004f, 0.00026999999f, 0.0992000028f, 0.75819999f, 0.86589998f, 0.26910001f, -0.421700001f,
+	0.0311110001f, 0.983915985f, -0.00608099997f, 0.0951000005f, 0.757799983f, 0.826399982f, 0.325700015f, -0.459300011f,
+	0.0208340008f, 0.993192971f, -0.013878f, 0.0956000015f, 0.75059998f, 0.695100009f, 0.452199996f, -0.558899999f,
+	0.0239819996f, 0.986284018f, -0.0158259999f, 0.0927999988f, 0.752699971f, 0.70569998f, 0.470800012f, -0.529500008f,
+	0.0148949996f, 0.985889971f, -0.0252609998f, 0.0895999968f, 0.747699976f, 0.553900003f, 0.447400004f, -0.702099979f,
+	0.0125940004f, 0.992393017f, -0.0229630005f, 0.0925000012f, 0.746100008f, 0.567499995f, 0.444299996f, -0.693199992f,
+	-0.0f, 0.981324971f, -0.037103001f, 0.0839999989f, 0.74089998f, 0.479099989f, 0.431400001f, -0.764400005f,
+	-0.0f, 0.989410996f, -0.0325709991f, 0.0881000012f, 0.740199983f, 0.481700003f, 0.428499997f, -0.764400005f,
+	0.0138050001f, 0.932164013f, -0.0415909998f, 0.0654999986f, 0.757600009f, 0.532700002f, 0.167699993f, -0.82950002f,
+	0.00860800035f, 0.933458984f, -0.044941999f, 0.0644999966f, 0.754899979f, 0.559599996f, 0.127000004f, -0.819000006f,
+	0.0088320002f, 0.927682996f, -0.0453189984f, 0.0623000003f, 0.756299973f, 0.494800001f, 0.161200002f, -0.853900015f,
+	0.0132149998f, 0.927555978f, -0.0433249995f, 0.0632999986f, 0.75819999f, 0.404500008f, 0.276199996f, -0.871800005f,
+	-0.000123999998f, 0.81565702f, -0.0588879995f, 0.402399987f, 0.471100003f, 9.99999975e-05f, 0.253899992f, -0.967199981f,
+	-0.0142550003f, 0.817873001f, -0.0576220006f, 0.408800006f, 0.470200002f, -0.0454999991f, 0.260899991f, -0.964299977f,
+	-0.0142679997f, 0.844323993f, -0.0468549989f, 0.412800014f, 0.482499987f, -0.00510000018f, 0.473500013f, -0.880800009f,
+	-0.0f, 0.843237996f, -0.0474979989f, 0.406500012f, 0.483900011f, 0.00150000001f, 0.46419999f, -0.885699987f,
+	0.0238380004f, 0.778095007f, -0.0623110011f, 0.386700004f, 0.458299994f, 0.129500002f, 0.171599999f, -0.976599991f,
+	-0.0f, 0.765776992f, -0.0681020021f, 0.395300001f, 0.449200004f, 9.99999975e-05f, 0.181700006f, -0.983399987f,
+	0.014254f, 0.817873001f, -0.0576220006f, 0.396499991f, 0.474099994f, 0.0428999998f, 0.262400001f, -0.963999987f,
+	-0.0238380004f, 0.778095007f, -0.0623110011f, 0.407499999f, 0.451599985f, -0.130199999f, 0.171200007f, -0.976599991f,
+	-0.0155109996f, 0.871927023f, -0.0286490005f, 0.418000013f, 0.496600002f, 0.0125000002f, 0.553799987f, -0.832599998f,
+	-0.0f, 0.869835019f, -0.0297519993f, 0.410899997f, 0.497700006f, 0.00170000002f, 0.553499997f, -0.832799971f,
+	0.0142679997f, 0.844323993f, -0.0468549989f, 0.4005f, 0.486499995f, 0.00200000009f, 0.473800004f, -0.880599976f,
+	0.0155100003f, 0.871927023f, -0.0286490005f, 0.404599994f, 0.500899971f, -0.0149999997f, 0.550999999f, -0.834399998f,
+	0.0273400005f, 0.49317801f, -0.147338003f, 0.606400013f, 0.305999994f, 0.465200007f, 0.00359999994f, -0.885200024f,
+	0.0179130007f, 0.493243992f, -0.152253002f, 0.60619998f, 0.310799986f, 0.463f, 0.00319999992f, -0.886300027f,
+	0.0230749995f, 0.650759995f, -0.152215004f, 0.535000026f, 0.305999994f, 0.598100007f, -0.00860000029f, -0.801400006f,
+	0.0307330005f, 0.649707973f, -0.146396995f, 0.535600007f, 0.301600009f, 0.604200006f, -0.00829999987f, -0.796800017f,
+	0.0421230011f, 0.228530005f, -0.146038994f, 0.726400018f, 0.304399997f, 0.497799993f, 0.0252f, -0.866999984f,
+	0.0289580002f, 0.228930995f, -0.153605998f, 0.726000011f, 0.311300009f, 0.498699993f, 0.0252999999f, -0.866400003f,
+	0.0670330003f, 0.276053011f, 0.0299190003f, 0.3398f, 0.531799972f, 0.663200021f, -0.185000002f, 0.725199997f,
+	0.0714209974f, 0.258497f, 0.0207029991f, 0.339599997f, 0.522599995f, 0.659399986f, -0.315699995f, 0.682299972f,
+	0.0776769966f, 0.263550997f, 0.0169949997f, 0.335700005f, 0.523299992f, 0.675599992f, -0.305000007f, 0.671199977f,
+	0.0742039979f, 0.280286014f, 0.0241369996f, 0.335200012f, 0.531599998f, 0.676500022f, -0.165800005f, 0.717499971f,
+	0.0788780004f, 0.244664997f, 0.0033760001f, 0.335799992f, 0.512700021f, 0.725899994f, -0.371300012f, 0.57889998f,
+	0.0847709998f, 0.253535986f, 0.00132200005f, 0.33160001f, 0.515200019f, 0.740999997f, -0.361099988f, 0.566100001f,
+	-0.0670330003f, 0.276053011f, 0.0299190003f, 0.379400015f, 0.774299979f, -0.663200021f, -0.185000002f, 0.725199997f,
+	-0.0742039979f, 0.280286014f, 0.0241369996f, 0.374799997f, 0.774200022f, -0.676500022f, -0.165800005f, 0.717499971f,
+	-0.0776769966f, 0.263550997f, 0.0169949997f, 0.375200003f, 0.765799999f, -0.675599992f, -0.305000007f, 0.671199977f,
+	-0.0714209974f, 0.258497f, 0.0207029991f, 0.379200011f, 0.765100002f, -0.659399986f, -0.315699995f, 0.682299972f,
+	-0.0788780004f, 0.244664997f, 0.0033760001f, 0.37529999f, 0.755299985f, -0.725899994f, -0.371300012f, 0.57889998f,
+	-0.0847709998f, 0.253535986f, 0.00132200005f, 0.371100008f, 0.757799983f, -0.740999997f, -0.361099988f, 0.566100001f,
+	0.0727489963f, 0.253497988f, -0.0196509995f, 0.481299996f, 0.621800005f, 0.815400004f, -0.288700014f, -0.501800001f,
+	0.0613459982f, 0.258563012f, -0.0373900011f, 0.48269999f, 0.612100005f, 0.713800013f, -0.0799999982f, -0.695800006f,
+	0.0642559975f, 0.263244003f, -0.0348360017f, 0.480100006f, 0.612800002f, 0.759199977f, -0.129199997f, -0.637899995f,
+	0.0758860037f, 0.258029997f, -0.0172070004f, 0.478700012f, 0.622600019f, 0.809000015f, -0.3574f, -0.466699988f,
+	0.0788780004f, 0.244664997f, 0.0033760001f, 0.48210001f, 0.633300006f, 0.718900025f, -0.530600011f, -0.449099988f,
+	0.0445559993f, 0.259599f, -0.0511210002f, 0.486200005f, 0.602900028f, 0.62440002f, -0.116999999f, -0.772300005f,
+	0.0443050005f, 0.268182993f, -0.0526250005f, 0.482800007f, 0.600799978f, 0.632000029f, -0.0979999974f, -0.76880002f,
+	0.0847709998f, 0.253535986f, 0.00132200005f, 0.477299988f, 0.632000029f, 0.684300005f, -0.562099993f, -0.46450001f,
+	0.034802001f, 0.741180003f, -0.163980007f, 0.0450000018f, 0.554899991f, -0.505800009f, 0.341100007f, -0.792299986f,
+	0.0414390005f, 0.717481971f, -0.172135994f, 0.0452000014f, 0.542999983f, -0.707599998f, 0.0445000008f, -0.705200016f,
+	0.0365110002f, 0.717706025f, -0.167177007f, 0.0480000004f, 0.544399977f, -0.673500001f, 0.0513999984f, -0.737399995f,
+	0.0321470015f, 0.737771988f, -0.164118007f, 0.0465999991f, 0.553900003f, -0.2949f, 0.26699999f, -0.917500019f,
+	0.0213990007f, 0.754553974f, -0.143205002f, 0.0505000018f, 0.566600025f, -0.753199995f, 0.212200001f, -0.622600019f,
+	0.0242040008f, 0.758969009f, -0.145393997f, 0.0480999984f, 0.567300022f, -0.76789999f, 0.183599994f, -0.613600016f,
+	-0.0306579992f, 0.649673998f, -0.146937996f, 0.750699997f, 0.334600002f, -0.520099998f, -0.0133999996f, -0.853999972f,
+	-0.021706f, 0.650507987f, -0.152368993f, 0.75150001f, 0.339300007f, -0.517700016f, -0.0131000001f, -0.855400026f,
+	-0.0179130007f, 0.493243992f, -0.152253002f, 0.680599988f, 0.346799999f, -0.580799997f, 0.00480000023f, -0.81400001f,
+	-0.025564f, 0.493075013f, -0.146775007f, 0.680199981f, 0.342599988f, -0.579999983f, 0.0055999998f, -0.814599991f,
+	-0.0305819996f, 0.227125004f, -0.153015003f, 0.560199976f, 0.352800012f, -0.4384f, 0.0293000005f, -0.898299992f,
+	-0.042555999f, 0.227514997f, -0.147214994f, 0.559800029f, 0.346799999f, -0.435000002f, 0.0293000005f, -0.899999976f,
+	-0.0257089995f, 0.977208972f, -0.0169459991f, 0.0518000014f, 0.753499985f, -0.796800017f, 0.1972f, -0.571099997f,
+	-0.00885299966f, 0.972424984f, -0.0366149992f, 0.0441000015f, 0.762600005f, -0.666999996f, 0.226600006f, -0.709699988f,
+	-0.0146700004f, 0.965285003f, -0.033427f, 0.0425000004f, 0.758400023f, -0.668099999f, 0.210500002f, -0.713699996f,
+	-0.0286720004f, 0.970465004f, -0.0149029996f, 0.0498999991f, 0.75059998f, -0.832599998f, 0.172999993f, -0.526199996f,
+	-0.0339200012f, 0.979272008f, -0.00124400004f, 0.0568000004f, 0.747200012f, -0.917100012f, 0.115199998f, -0.381599993f,
+	-0.0086319996f, 0.93334502f, -0.0455790013f, 0.0269000009f, 0.756600022f, -0.625199974f, 0.158099994f, -0.764299989f,
+	-0.0138050001f, 0.932164013f, -0.0415909998f, 0.0277999993f, 0.753700018f, -0.616599977f, 0.161200002f, -0.770600021f,
+	-0.00938300043f, 0.911463022f, -0.0490670018f, 0.0176999997f, 0.752600014f, -0.524200022f, 0.187999994f, -0.830600023f,
+	-0.0141660003f, 0.907132983f, -0.0471750014f, 0.0168999992f, 0.749599993f, -0.508000016f, 0.194499999f, -0.839100003f,
+	-0.0396520011f, 0.972180009f, 0.0110940002f, 0.057500001f, 0.7403f, -0.929799974f, 0.184400007f, -0.318599999f,
+	-0.0338889994f, 0.980599999f, -0.000739999989f, 0.057500001f, 0.747300029f, -0.926500022f, 0.175400004f, -0.332800001f,
+	-0.0396809988f, 0.974398971f, 0.0129079996f, 0.0588000007f, 0.740199983f, -0.930299997f, 0.215299994f, -0.296999991f,
+	-0.03235f, 0.990242004f, 0.00026999999f, 0.0612999983f, 0.749599993f, -0.86589998f, 0.26910001f, -0.421700001f,
+	-0.0311110001f, 0.983915985f, -0.00608099997f, 0.0573000014f, 0.750400007f, -0.826399982f, 0.325700015f, -0.459300011f,
+	-0.0208340008f, 0.993192971f, -0.013878f, 0.0584999993f, 0.757499993f, -0.695100009f, 0.452199996f, -0.558899999f,
+	-0.0239819996f, 0.986284018f, -0.0158259999f, 0.0555000007f, 0.755699992f, -0.70569998f, 0.470800012f, -0.529500008f,
+	-0.0125940004f, 0.992393017f, -0.0229630005f, 0.0557999983f, 0.762399971f, -0.567600012f, 0.444200009f, -0.693199992f,
+	-0.0148949996f, 0.985889971f, -0.0252609998f, 0.0527999997f, 0.760999978f, -0.55400002f, 0.447400004f, -0.702099979f,
+	-0.0f, 0.989410996f, -0.0325709991f, 0.052099999f, 0.768700004f, -0.481700003f, 0.428499997f, -0.764400005f,
+	-0.0f, 0.981324971f, -0.037103001f, 0.0478999987f, 0.768400013f, -0.479099989f, 0.431400001f, -0.764400005f,
+	-0.112874001f, 0.741365016f, 0.00584100001f, 0.0579999983f, 0.985000014f, -0.775699973f, 0.309500009f, 0.550000012f,
+	-0.115997002f, 0.733229995f, 0.00604300015f, 0.0555999987f, 0.988099992f, -0.774600029f, 0.311100006f, 0.550599992f,
+	-0.098240003f, 0.718578994f, 0.0393019989f, 0.0392000005f, 0.979900002f, -0.721099973f, 0.236300007f, 0.651300013f,
+	-0.0953650028f, 0.723814011f, 0.0405949987f, 0.0401999988f, 0.977400005f, -0.726300001f, 0.245100006f, 0.642199993f,
+	-0.0846860036f, 0.699069977f, 0.0559820011f, 0.0262000002f, 0.977900028f, -0.582099974f, 0.192599997f, 0.790000021f,
+	-0.0799119994f, 0.703352988f, 0.0586180016f, 0.0263f, 0.974699974f, -0.58859998f, 0.169799998f, 0.790400028f,
+	-0.069325f, 0.687463999f, 0.0686369985f, 0.0165999997f, 0.973800004f, -0.471899986f, 0.210299999f, 0.85619998f,
+	-0.0771709979f, 0.686587989f, 0.064861998f, 0.0185000002f, 0.977299988f, -0.448799998f, 0.187600002f, 0.873700023f,
+	-0.0859180018f, 0.677586019f, 0.0611979999f, 0.0174000002f, 0.983099997f, -0.523699999f, 0.169f, 0.834999979f,
+	-0.088082999f, 0.680458009f, 0.0591350012f, 0.0193000007f, 0.983500004f, -0.53670001f, 0.186499998f, 0.822899997f,
+	-0.0895719975f, 0.676898003f, 0.0552939996f, 0.226899996f, 0.984499991f, -0.953599989f, 0.280400008f, 0.109800003f,
+	-0.088082999f, 0.680458009f, 0.0591350012f, 0.225400001f, 0.982500017f, -0.953599989f, 0.280400008f, 0.109800003f,
+	-0.0884430036f, 0.681316972f, 0.0538170002f, 0.227799997f, 0.982500017f, -0.953599989f, 0.280400008f, 0.109800003f,
+	-0.049637001f, 0.759334028f, -0.0597640015f, 0.256500006f, 0.365999997f, -0.830500007f, 0.300300002f, -0.469099998f,
+	-0.0501470007f, 0.751406014f, -0.0642260015f, 0.252600014f, 0.364800006f, -0.836099982f, 0.308899999f, -0.453299999f,
+	0.124177001f, 0.764702976f, -0.0867080018f, 0.907199979f, 0.198599994f, 0.382699996f, 0.743799984f, -0.547999978f,
+	0.0940669999f, 0.752345979f, -0.114247002f, 0.925899982f, 0.204400003f, 0.2403f, 0.628600001f, -0.739700019f,
+	0.078034997f, 0.758870006f, -0.104254998f, 0.923300028f, 0.213799998f, -0.303900003f, 0.925999999f, -0.223900005f,
+	0.0671340004f, 0.739714026f, -0.128544003f, 0.939700007f, 0.210199997f, 0.202600002f, 0.625f, -0.753899992f,
+	0.0984570011f, 0.769950986f, -0.0805160031f, 0.907800019f, 0.2104f, -0.268000007f, 0.960699975f, -0.071800001f,
+	0.136005998f, 0.768073022f, -0.0678780004f, 0.897499979f, 0.195700005f, 0.434199989f, 0.779500008f, -0.451599985f,
+	0.0580339991f, 0.749028027f, -0.120595999f, 0.935400009f, 0.218199998f, -0.298700005f, 0.915700018f, -0.268700004f,
+	0.0665939972f, 0.746272981f, -0.0889080018f, 0.92019999f, 0.224199995f, -0.754599988f, 0.531400025f, 0.38499999f,
+	0.109665997f, 0.77125901f, -0.0644420013f, 0.897300005f, 0.209199995f, -0.319900006f, 0.93690002f, -0.141200006f,
+	0.0850479975f, 0.753786981f, -0.0648540035f, 0.905399978f, 0.222100005f, -0.690299988f, 0.595099986f, 0.411500007f,
+	0.135377005f, 0.777751982f, -0.046484001f, 0.886799991f, 0.1963f, 0.309199989f, 0.747799993f, -0.587599993f,
+	0.112830997f, 0.780456007f, -0.0524789989f, 0.888599992f, 0.208800003f, -0.409200013f, 0.733699977f, -0.542500019f,
+	0.0971880034f, 0.755446017f, -0.0510089993f, 0.896300018f, 0.221599996f, -0.777899981f, 0.551900029f, 0.300500005f,
+	0.0783419982f, 0.734812021f, -0.0588349998f, 0.905900002f, 0.231900007f, -0.836600006f, 0.0760999992f, 0.542599976f,
+	0.0651429966f, 0.727919996f, -0.0824019983f, 0.91869998f, 0.233199999f, -0.841300011f, -0.0582000017f, 0.537400007f,
+	0.0521669984f, 0.737770021f, -0.108511999f, 0.931999981f, 0.226699993f, -0.828599989f, 0.397300005f, 0.394499987f,
+	0.0497270003f, 0.72092402f, -0.108906999f, 0.933099985f, 0.234999999f, -0.839699984f, -0.196899995f, 0.505999982f,
+	0.0905949995f, 0.738762021f, -0.0447270013f, 0.897400022f, 0.231099993f, -0.774200022f, 0.0965000018f, 0.625500023f,
+	0.103593998f, 0.763835013f, -0.0423559994f, 0.889500022f, 0.219999999f, -0.933499992f, 0.33829999f, -0.118900001f,
+	0.138475001f, 0.796685994f, -0.0306919999f, 0.875999987f, 0.195299998f, 0.458799988f, 0.487599999f, -0.742799997f,
+	0.115041003f, 0.792914987f, -0.040031001f, 0.878899992f, 0.2086f, -0.255499989f, 0.532400012f, -0.806999981f,
+	0.100652002f, 0.750473022f, -0.0321099982f, 0.889400005f, 0.2289f, -0.8574f, -0.0278999992f, 0.513800025f,
+	0.0995379984f, 0.776037991f, -0.0327229984f, 0.880800009f, 0.220300004f, -0.965499997f, 0.0183000006f, -0.259600013f,
+	0.109696999f, 0.763275981f, -0.0167159997f, 0.880699992f, 0.231099993f, -0.853100002f, -0.351399988f, 0.385699987f,
+	0.0942249969f, 0.795911014f, -0.0248119999f, 0.868600011f, 0.220699996f, -0.853399992f, -0.0678000003f, -0.516799986f,
+	0.102908f, 0.784346998f, 0.00132599997f, 0.868099988f, 0.233500004f, -0.814899981f, -0.579400003f, 0.0146000003f,
+	0.0909660012f, 0.797425985f, 0.00726900017f, 0.859399974f, 0.234999999f, -0.00499999989f, -0.924899995f, -0.380199999f,
+	0.0876799971f, 0.810608029f, -0.0123009998f, 0.855199993f, 0.224800006f, -0.0494000018f, -0.204899997f, -0.977500021f,
+	0.0775519982f, 0.816030025f, -0.0309360009f, 0.840200007f, 0.224700004f, 0.895699978f, 0.0878999978f, -0.435799986f,
+	0.0832900032f, 0.784249008f, 0.000934000011f, 0.851999998f, 0.240799993f, 0.885200024f, -0.409299999f, -0.221300006f,
+	0.0787520036f, 0.848087013f, 0.00257600006f, 0.844799995f, 0.210600004f, -0.133699998f, 0.584800005f, -0.800100029f,
+	-0.0984689966f, 0.727272987f, -0.0200769994f, 0.235100001f, 0.971000016f, -0.377499998f, 0.372500002f, -0.847800016f,
+	-0.0943169966f, 0.722589016f, -0.0247419998f, 0.231600001f, 0.970600009f, -0.527899981f, 0.316799998f, -0.787999988f,
+	-0.0970479995f, 0.718715012f, -0.0244689994f, 0.2315f, 0.968500018f, -0.438199997f, 0.351799995f, -0.827199996f,
+	-0.102532998f, 0.723322988f, -0.0204869993f, 0.235200003f, 0.968400002f, -0.297600001f, 0.396400005f, -0.868499994f,
+	0.00940900017f, 0.752592027f, -0.142882004f, 0.101800002f, 0.531799972f, -0.33860001f, 0.882799983f, -0.325700015f,
+	0.0213990007f, 0.754553974f, -0.143205002f, 0.101599999f, 0.526199996f, -0.210700005f, 0.971199989f, 0.111100003f,
+	0.0156679992f, 0.752102017f, -0.150039002f, 0.105300002f, 0.529100001f, -0.0925000012f, 0.924499989f, -0.369800001f,
+	0.0261640009f, 0.751932979f, -0.128425002f, 0.0939999968f, 0.524900019f, -0.212599993f, 0.831700027f, 0.512899995f,
+	0.00617399998f, 0.753979027f, -0.125098005f, 0.0939999968f, 0.533699989f, -0.157499999f, 0.83039999f, 0.534399986f,
+	0.00580300018f, 0.745087981f, -0.146412f, 0.1043f, 0.534699976f, -0.495400012f, 0.793500006f, -0.353500009f,
+	-0.0113519998f, 0.74634397f, -0.134370998f, 0.0983000025f, 0.541999996f, -0.561999977f, 0.79430002f, -0.230499998f,
+	0.000308999995f, 0.742679f, -0.160529003f, 0.110600002f, 0.537299991f, -0.552600026f, 0.789499998f, 0.267199993f,
+	-0.000302f, 0.745540977f, -0.16719f, 0.113799997f, 0.536899984f, -0.223399997f, 0.955299973f, -0.193499997f,
+	-0.0053030001f, 0.743763983f, -0.143141001f, 0.102600001f, 0.539799988f, -0.224900007f, 0.904500008f, -0.362399995f,
+	-0.0062950002f, 0.737954021f, -0.157787994f, 0.109399997f, 0.540499985f, -0.0943000019f, 0.967100024f, 0.236300007f,
+	-0.0111969998f, 0.746547997f, -0.126837999f, 0.0952000022f, 0.541599989f, -0.545899987f, 0.671999991f, 0.500400007f,
+	-0.014769f, 0.741717994f, -0.137298003f, 0.0998999998f, 0.544499993f, -0.521700025f, 0.852999985f, 0.0126f,
+	-0.0204990003f, 0.734988987f, -0.134165004f, 0.0973000005f, 0.548600018f, -0.801599979f, 0.497799993f, 0.331099987f,
+	0.0323279984f, 0.736738026f, -0.118419997f, 0.0851000026f, 0.522700012f, -0.519999981f, 0.0342000015f, 0.853500009f,
+	0.0115419999f, 0.744014978f, -0.121807002f, 0.0891000032f, 0.532800019f, -0.161899999f, -0.0296f, 0.986400008f,
+	-0.00793999992f, 0.740244985f, -0.123332001f, 0.0917999968f, 0.541899979f, -0.128900006f, -0.00870000012f, 0.991599977f,
+	-0.018739f, 0.734938979f, -0.127841994f, 0.0943000019f, 0.547500014f, -0.694999993f, 0.416700006f, 0.585900009f,
+	-0.0258179996f, 0.728190005f, -0.134461001f, 0.0961000025f, 0.552600026f, -0.970300019f, 0.0326000005f, -0.239700004f,
+	-0.0246740002f, 0.727391005f, -0.129351005f, 0.0936999992f, 0.551900029f, -0.85799998f, -0.252999991f, 0.446999997f,
+	-0.0141240004f, 0.730938971f, -0.123907f, 0.0909999982f, 0.546899974f, 0.0469999984f, -0.287699997f, 0.95660001f,
+	-0.00249499991f, 0.734520018f, -0.127479002f, 0.0878000036f, 0.541599989f, 0.0390000008f, -0.438499987f, 0.897899985f,
+	-0.0101190004f, 0.727872014f, -0.130312994f, 0.0873000026f, 0.546899974f, 0.140200004f, -0.449400008f, 0.882300019f,
+	0.0120919999f, 0.735004008f, -0.127779007f, 0.0844999999f, 0.535399973f, -0.327699989f, -0.421999991f, 0.845300019f,
+	-0.0203380007f, 0.727003992f, -0.125979006f, 0.0914999992f, 0.550300002f, -0.323700011f, -0.377999991f, 0.867399991f,
+	-0.0183819998f, 0.723891973f, -0.131210998f, 0.0886000022f, 0.551100016f, -0.268700004f, -0.610899985f, 0.744700015f,
+	-0.0180099998f, 0.74198103f, -0.144529f, 0.103600003f, 0.545799971f, -0.171700001f, 0.985099971f, -0.00689999992f,
+	-0.0183450002f, 0.742597997f, -0.158176005f, 0.1105f, 0.54610002f, -0.170200005f, 0.985099971f, 0.0236000009f,
+	-0.0122370003f, 0.740707994f, -0.147374004f, 0.104900002f, 0.543200016f, 0.0255999994f, 0.949899971f, -0.311399996f,
+	-0.0130580002f, 0.738551021f, -0.153421f, 0.107799999f, 0.54339999f, 0.351300001f, 0.9278f, -0.125499994f,
+	0.0109160002f, 0.993683994f, -0.0213590004f, 0.0386999995f, 0.644500017f, 0.541700006f, 0.367300004f, -0.756099999f,
+	-0.0f, 0.992344022f, -0.028438f, 0.0355999991f, 0.636500001f, 0.0f, 0.426699996f, -0.904399991f,
+	-0.0109160002f, 0.993683994f, -0.0213590004f, 0.0390000008f, 0.628700018f, -0.541700006f, 0.367300004f, -0.756099999f,
+	-0.0197710004f, 0.994508028f, -0.0126919998f, 0.0436999984f, 0.622699976f, -0.718500018f, 0.315100014f, -0.620000005f,
+	-0.0310309995f, 0.990347028f, 0.00300900009f, 0.0504000001f, 0.613699973f, -0.899800003f, 0.270999998f, -0.341800004f,
+	-0.0394209996f, 0.969419003f, 0.0183589999f, 0.0551999994f, 0.599399984f, -0.976899981f, 0.0947000012f, -0.191599995f,
+	-0.0289849993f, 0.966597021f, -0.0112490002f, 0.0395000018f, 0.602100015f, -0.897099972f, 0.0966000035f, -0.431100011f,
+	-0.0322149992f, 0.940494001f, -0.0110539999f, 0.0364999995f, 0.588999987f, -0.883400023f, 0.162499994f, -0.439599991f,
+	-0.0161979999f, 0.962503016f, -0.0301300008f, 0.0278999992f, 0.603699982f, -0.809199989f, 0.1228f, -0.574599981f,
+	-0.0150520001f, 0.930729985f, -0.0385369994f, 0.0192000009f, 0.589399993f, -0.814199984f, 0.142299995f, -0.562900007f,
+	-0.01664f, 0.901744008f, -0.0444520004f, 0.0124000004f, 0.575900018f, -0.706900001f, 0.269899994f, -0.653800011f,
+	-0.0304150004f, 0.919274986f, -0.0222839992f, 0.0280000009f, 0.5801f, -0.745700002f, 0.309399992f, -0.590200007f,
+	-0.0433860011f, 0.92631799f, 0.00583699998f, 0.0441000015f, 0.57889998f, -0.881399989f, 0.370499998f, -0.293199986f,
+	-0.0169130005f, 0.89505899f, -0.0469949991f, 0.0104f, 0.572899997f, -0.660399973f, 0.242300004f, -0.710699975f,
+	-0.0227889996f, 0.890493989f, -0.0430909991f, 0.0127999997f, 0.569299996f, -0.660600007f, 0.234799996f, -0.713100016f,
+	-0.0340240002f, 0.912106991f, -0.0222139992f, 0.0276999995f, 0.575999975f, -0.7227f, 0.352400005f, -0.594500005f,
+	-0.0179350004f, 0.885589004f, -0.0480379984f, 0.00860000029f, 0.568300009f, -0.626100004f, 0.151800007f, -0.764800012f,
+	0.131610006f, 0.539537013f, -0.0127560003f, 0.228400007f, 0.871399999f, 0.98210001f, -0.180899993f, 0.0526000001f,
+	0.127847999f, 0.528237998f, -0.0181329995f, 0.230399996f, 0.865700006f, 0.924199998f, -0.363599986f, 0.117299996f,
+	0.131465003f, 0.534970999f, -0.0257619992f, 0.234300002f, 0.868799984f, 0.995199978f, -0.0949999988f, 0.0221999995f,
+	0.130449995f, 0.540444016f, -0.0246009994f, 0.233899996f, 0.871200025f, 0.976899981f, 0.198200002f, -0.0804999992f,
+	0.0621040016f, 0.721415997f, -0.155851007f, 0.0140000004f, 0.563600004f, -0.498899996f, 0.114299998f, -0.859099984f,
+	0.0537399985f, 0.74327898f, -0.147800997f, 0.0211999994f, 0.555100024f, -0.529699981f, 0.0970000029f, -0.842599988f,
+	0.0578759983f, 0.748085022f, -0.149847999f, 0.0240000002f, 0.556100011f, -0.522300005f, 0.102399997f, -0.846599996f,
+	0.068200998f, 0.722720981f, -0.159167007f, 0.0156999994f, 0.566299975f, -0.493699998f, 0.115699999f, -0.861899972f,
+	0.043889001f, 0.75505197f, -0.140497997f, 0.0240000002f, 0.547900021f, -0.48969999f, 0.119400002f, -0.863699973f,
+	0.0467789993f, 0.761232018f, -0.141223997f, 0.0271000005f, 0.547999978f, -0.519800007f, 0.196999997f, -0.831200004f,
+	0.0430889986f, 0.759548008f, -0.139596999f, 0.0256999992f, 0.546599984f, -0.530200005f, 0.501900017f, -0.683399975f,
+	0.0370149985f, 0.758846998f, -0.133838996f, 0.0243999995f, 0.542999983f, -0.622200012f, 0.244499996f, -0.743700027f,
+	0.0395569988f, 0.763171017f, -0.135042995f, 0.0266999993f, 0.54369998f, -0.619499981f, 0.149499997f, -0.770699978f,
+	0.0426249988f, 0.66652298f, -0.137933001f, 0.834599972f, 0.376899987f, 0.309100002f, 0.950999975f, -0.00520000001f,
+	0.0427520014f, 0.666508973f, -0.154409006f, 0.834699988f, 0.384299994f, 0.311699986f, 0.950200021f, 0.00159999996f,
+	0.00142900005f, 0.667782009f, -0.161487997f, 0.815999985f, 0.387699991f, 0.0055999998f, 0.999599993f, -0.0286999997f,
+	-0.000308999995f, 0.668733001f, -0.132488996f, 0.815100014f, 0.374500006f, 0.00340000005f, 0.999599993f, -0.0296f,
+	0.0523729995f, 0.659680009f, -0.155279994f, 0.839999974f, 0.3847f, 0.754499972f, 0.656300008f, 0.000300000014f,
+	0.0524690002f, 0.659579992f, -0.137851f, 0.839999974f, 0.376800001f, 0.755699992f, 0.654900014f, -0.00249999994f,
+	-0.0427829996f, 0.666441023f, -0.156607002f, 0.795899987f, 0.385600001f, -0.337300003f, 0.941299975f, -0.00980000012f,
+	-0.0420869999f, 0.666719019f, -0.137945995f, 0.796199977f, 0.377200007f, -0.324099988f, 0.94599998f, -0.00200000009f,
+	-0.0523689985f, 0.658751011f, -0.138321996f, 0.790300012f, 0.377400011f, -0.771700025f, 0.635900021f, -0.00499999989f,
+	-0.0518499985f, 0.659135997f, -0.155621007f, 0.790700018f, 0.385199994f, -0.753199995f, 0.657700002f, 0.00730000017f,
+	-0.0573339984f, 0.648882985f, -0.139265999f, 0.785300016f, 0.377900004f, -0.931100011f, 0.364300013f, 0.0177999996f,
+	-0.0581029989f, 0.648805022f, -0.154734001f, 0.7852f, 0.384900004f, -0.923200011f, 0.381900012f, 0.0439999998f,
+	-0.0695480034f, 0.60028702f, -0.153744996f, 0.762600005f, 0.384499997f, -0.967899978f, 0.25029999f, -0.0237000007f,
+	-0.0701749995f, 0.600175023f, -0.139311001f, 0.762499988f, 0.377900004f, -0.966199994f, 0.254799992f, -0.0399999991f,
+	0.0568899997f, 0.650636971f, -0.153830007f, 0.844600022f, 0.384000003f, 0.927900016f, 0.372200012f, -0.0204000007f,
+	0.0581340007f, 0.648504019f, -0.138302997f, 0.845700026f, 0.376899987f, 0.935000002f, 0.353899986f, -0.0220999997f,
+	0.0713260025f, 0.598375976f, -0.155039996f, 0.869199991f, 0.384499997f, 0.966400027f, 0.256900012f, -0.00760000013f,
+	0.0713260025f, 0.598375976f, -0.138402998f, 0.869199991f, 0.377000004f, 0.967100024f, 0.254500002f, 0.0f,
+	0.112438001f, 0.784964979f, -0.0908889994f, 0.143099993f, 0.542500019f, 0.0502999984f, 0.278400004f, -0.959100008f,
+	0.111279003f, 0.792159975f, -0.0887679979f, 0.140699998f, 0.5449f, 0.0546999983f, 0.290399998f, -0.955299973f,
+	0.145539001f, 0.773230016f, -0.0925609991f, 0.138400003f, 0.5273f, 0.0187999997f, 0.156800002f, -0.987500012f,
+	0.141261995f, 0.767503977f, -0.0934880003f, 0.141599998f, 0.527199984f, 0.00870000012f, 0.138099998f, -0.990400016f,
+	0.170285001f, 0.741571009f, -0.0963490009f, 0.143099993f, 0.509599984f, -0.0863000005f, 0.0132999998f, -0.996200025f,
+	0.161338001f, 0.739367008f, -0.0953629985f, 0.146400005f, 0.512300014f, -0.107100002f, -0.0100999996f, -0.994199991f,
+	0.136983007f, 0.531576991f, -0.0139579996f, 0.149599999f, 0.958500028f, 0.868200004f, 0.225400001f, -0.442000002f,
+	0.137382001f, 0.537485003f, -0.0109970002f, 0.151299998f, 0.95599997f, 0.884500027f, 0.159999996f, -0.438300014f,
+	0.146274f, 0.535014987f, 0.00604300015f, 0.159799993f, 0.958500028f, 0.815599978f, 0.372399986f, -0.442900002f,
+	0.149912f, 0.527886987f, 0.00604300015f, 0.159999996f, 0.962100029f, 0.799199998f, 0.407999992f, -0.441399992f,
+	0.0947220027f, 0.674024999f, -0.0453360006f, 0.197999999f, 0.840200007f, 0.486799985f, 0.00380000006f, -0.87349999f,
+	0.0887669995f, 0.669040024f, -0.0485399999f, 0.194299996f, 0.83920002f, 0.482300013f, -0.0131999999f, -0.875899971f,
+	0.0818509981f, 0.678415f, -0.0524890013f, 0.1954f, 0.833700001f, 0.468699992f, 0.0669f, -0.880800009f,
+	0.0870990008f, 0.682523012f, -0.0493279994f, 0.198599994f, 0.834699988f, 0.479799986f, 0.0615000017f, -0.875199974f,
+	0.0693359971f, 0.687550008f, -0.0577960014f, 0.194900006f, 0.826300025f, 0.453000009f, 0.193599999f, -0.870199978f,
+	0.0779590011f, 0.686878026f, -0.0534499995f, 0.197300002f, 0.829999983f, 0.472299993f, 0.166299999f, -0.86559999f,
+	0.0799290016f, 0.704151988f, -0.0475939997f, 0.204999998f, 0.826900005f, 0.621699989f, 0.189700007f, -0.759899974f,
+	0.0852110013f, 0.699020982f, -0.0442759991f, 0.204799995f, 0.830500007f, 0.645399988f, 0.185200006f, -0.740999997f,
+	0.0955390036f, 0.724671006f, -0.0292349998f, 0.219099998f, 0.82980001f, 0.752399981f, 0.199000001f, -0.628000021f,
+	0.0986189991f, 0.718555987f, -0.0274410006f, 0.217800006f, 0.832700014f, 0.745400012f, 0.194600001f, -0.637600005f,
+	0.116016001f, 0.733229995f, 0.00604300015f, 0.233999997f, 0.841499984f, 0.791599989f, 0.299899995f, -0.532299995f,
+	0.113195002f, 0.740530014f, 0.00604300015f, 0.236200005f, 0.838699996f, 0.789600015f, 0.305000007f, -0.532400012f,
+	0.077234f, 0.607232988f, -0.0545019992f, 0.185399994f, 0.90140003f, 0.58160001f, 0.534600019f, -0.613099992f,
+	0.0755650029f, 0.613143027f, -0.0511440001f, 0.182999998f, 0.899399996f, 0.588800013f, 0.518599987f, -0.620000005f,
+	0.0830499977f, 0.607396007f, -0.0488439985f, 0.187199995f, 0.898299992f, 0.572799981f, 0.553499997f, -0.604600012f,
+	0.0863220021f, 0.60206902f, -0.0508249998f, 0.189999998f, 0.899399996f, 0.565100014f, 0.569299996f, -0.597100019f,
+	-0.105201997f, 0.887820005f, 0.0352180004f, 0.945900023f, 0.0934000015f, -0.0370000005f, 0.968599975f, -0.246000007f,
+	-0.0731260031f, 0.883719027f, 0.0552599989f, 0.961899996f, 0.0962999985f, 0.170399994f, 0.969900012f, -0.173700005f,
+	-0.0662449971f, 0.860768974f, 0.0328469984f, 0.948300004f, 0.110799998f, 0.673099995f, 0.564100027f, -0.478300005f,
+	-0.0777859986f, 0.860243976f, 0.0120719997f, 0.93599999f, 0.108599998f, 0.592800021f, 0.521700025f, -0.613499999f,
+	-0.124507003f, 0.876518011f, 0.0768700019f, 0.953100026f, 0.0772999972f, -0.448900014f, 0.669099987f, 0.592299998f,
+	-0.132128f, 0.869243979f, 0.00893600006f, 0.9296f, 0.0892999992f, -0.386400014f, 0.72359997f, -0.57190001f,
+	-0.0785820037f, 0.881214023f, 0.0824149996f, 0.969900012f, 0.0803000033f, -0.148399994f, 0.756200016f, 0.637300014f,
+	-0.123535998f, 0.83476299f, 0.0869430006f, 0.950299978f, 0.0601999983f, -0.372700006f, -0.106799997f, 0.921800017f,
+	-0.162907004f, 0.852806985f, 0.040959999f, 0.931999981f, 0.0736000016f, -0.897800028f, 0.435400009f, 0.0656000003f,
+	-0.0974479988f, 0.842257977f, -0.0100269997f, 0.91930002f, 0.104400001f, 0.298500001f, 0.433999985f, -0.850000024f,
+	-0.141490996f, 0.830247998f, -0.00742800022f, 0.912100017f, 0.0838000029f, -0.546299994f, 0.469999999f, -0.693300009f,
+	-0.163109004f, 0.816136003f, 0.0186790004f, 0.918200016f, 0.067900002f, -0.966600001f, 0.175600007f, -0.186800003f,
+	-0.153689995f, 0.820658028f, 0.0659390017f, 0.936399996f, 0.0595000014f, -0.721899986f, -0.143999994f, 0.676800013f,
+	-0.0725089982f, 0.834388971f, 0.0934100002f, 0.968800008f, 0.054299999f, -0.125400007f, -0.153500006f, 0.980199993f,
+	-0.0765549988f, 0.786239982f, 0.0655020028f, 0.954299986f, 0.0306000002f, -0.138400003f, -0.83829999f, 0.527400017f,
+	-0.104126997f, 0.787806988f, 0.0620980002f, 0.942700028f, 0.0346000008f, 0.0355999991f, -0.79610002f, 0.604099989f,
+	-0.122964002f, 0.775454998f, 0.0561789982f, 0.931900024f, 0.0362999998f, 0.0337000005f, -0.730400026f, 0.682200015f,
+	-0.162153006f, 0.796618998f, 0.0352020003f, 0.922299981f, 0.0566999987f, -0.902400017f, -0.234400004f, 0.361499995f,
+	-0.157407999f, 0.786521971f, -0.0120550003f, 0.902100027f, 0.064000003f, -0.940999985f, 0.181799993f, -0.285400003f,
+	-0.162591994f, 0.765350997f, 0.00494500017f, 0.907500029f, 0.0507999994f, -0.919799984f, -0.340999991f, 0.194399998f,
+	-0.147453994f, 0.802020013f, -0.0219379999f, 0.899699986f, 0.0763000026f, -0.677999973f, 0.52700001f, -0.512399971f,
+	-0.136905998f, 0.763576984f, 0.0391860008f, 0.921599984f, 0.0379000008f, -0.205300003f, -0.800899982f, 0.5625f,
+	-0.142076001f, 0.749558985f, 0.0125089996f, 0.909699976f, 0.0384000018f, -0.141599998f, -0.875400007f, 0.462199986f,
+	-0.104712002f, 0.782131016f, 0.0286500007f, 0.92900002f, 0.0217000004f, 0.671899974f, -0.725399971f, 0.149299994f,
+	-0.0945049971f, 0.790162027f, 0.0345840007f, 0.9375f, 0.0205000006f, 0.25999999f, -0.94630003f, -0.192200005f,
+	-0.114624999f, 0.767967999f, 0.0146080004f, 0.916599989f, 0.0237000007f, 0.632000029f, -0.728299975f, 0.264899999f,
+	-0.0807740018f, 0.786418021f, 0.0344800018f, 0.944599986f, 0.0184000004f, -0.307700008f, -0.91170001f, -0.272300005f,
+	-0.087559998f, 0.802646995f, 0.0177030005f, 0.935000002f, 0.00960000046f, 0.515299976f, -0.677699983f, -0.524600029f,
+	-0.0927599967f, 0.789959013f, 0.00759499986f, 0.924300015f, 0.0104999999f, 0.871599972f, -0.489199996f, 0.0318000019f,
+	-0.0997119993f, 0.777422011f, -0.00996099971f, 0.909500003f, 0.0116999997f, 0.886600018f, -0.460900009f, -0.0395999998f,
+	-0.119571999f, 0.755698025f, -0.00243000011f, 0.905099988f, 0.0258000009f, 0.591700017f, -0.715499997f, 0.371399999f,
+	-0.161054f, 0.739875019f, -0.0526360013f, 0.882600009f, 0.0482000001f, -0.933700025f, -0.273799986f, -0.230599999f,
+	-0.149820998f, 0.725211024f, -0.0446680002f, 0.884199977f, 0.0439999998f, -0.407999992f, -0.906700015f, 0.106399998f,
+	-0.104428001f, 0.769891024f, -0.0256319996f, 0.896600008f, 0.0137f, 0.982900023f, -0.0623999983f, 0.173299998f,
+	-0.113660999f, 0.73465699f, -0.0347139984f, 0.885800004f, 0.0289999992f, 0.402700007f, -0.79610002f, 0.451599985f,
+	-0.0934050009f, 0.759644985f, -0.0433119982f, 0.881299973f, 0.0160000008f, 0.818899989f, 0.0218000002f, 0.573499978f,
+	-0.126852006f, 0.744499028f, -0.101383001f, 0.858399987f, 0.0518000014f, -0.581099987f, -0.380299985f, -0.719500005f,
+	-0.116218001f, 0.72795701f, -0.0920720026f, 0.860000014f, 0.0439999998f, -0.201000005f, -0.892400026f, -0.404000014f,
+	-0.149991006f, 0.770781994f, -0.0539419986f, 0.883400023f, 0.0617000014f, -0.904900014f, 0.294099987f, -0.307700008f,
+	-0.128563002f, 0.76700002f, -0.102280997f, 0.860000014f, 0.0610999987f, -0.710200012f, 0.132799998f, -0.691299975f,
+	-0.0821070001f, 0.769802988f, -0.128051996f, 0.837899983f, 0.0675000027f, -0.468800008f, 0.0280000009f, -0.8829f,
+	-0.079020001f, 0.753494978f, -0.125760004f, 0.835099995f, 0.0533000007f, -0.307200015f, -0.522199988f, -0.795599997f,
+	-0.0667510033f, 0.748062015f, -0.123833001f, 0.833599985f, 0.0384999998f, 0.0790000036f, -0.902499974f, -0.423500001f,
+	-0.0907289982f, 0.727030993f, -0.067681998f, 0.865700006f, 0.0303000007f, 0.42050001f, -0.871999979f, 0.250499994f,
+	-0.0563779995f, 0.748838007f, -0.117060997f, 0.836300015f, 0.0267999992f, 0.625699997f, -0.7755f, 0.0843999982f,
+	-0.0703350008f, 0.760631025f, -0.0677070022f, 0.862200022f, 0.0152000003f, 0.819000006f, -0.00850000046f, 0.573700011f,
+	-0.0489090011f, 0.767250001f, -0.110835999f, 0.83859998f, 0.0149999997f, 0.897499979f, -0.0538999997f, 0.437599987f,
+	-0.076801002f, 0.782104015f, -0.128347993f, 0.83920002f, 0.0772999972f, -0.368499994f, 0.561999977f, -0.740499973f,
+	-0.141034007f, 0.791765988f, -0.0592610016f, 0.882300019f, 0.0733999982f, -0.66869998f, 0.677900016f, -0.305299997f,
+	-0.119865999f, 0.789759994f, -0.100465f, 0.861500025f, 0.071800001f, -0.537899971f, 0.624800026f, -0.565999985f,
+	-0.0664630011f, 0.79124701f, -0.120328002f, 0.841499984f, 0.0852999985f, -0.0249000005f, 0.961399972f, -0.273999989f,
+	-0.103465997f, 0.799121022f, -0.0900790021f, 0.862999976f, 0.0812999979f, -0.0148999998f, 0.996699989f, -0.079400003f,
+	-0.123257004f, 0.800781012f, -0.0320819989f, 0.89380002f, 0.0903000012f, 0.0592f, 0.809099972f, -0.584699988f,
+	-0.119355999f, 0.797883987f, -0.0563209988f, 0.880999982f, 0.0860999972f, 0.197500005f, 0.980300009f, 0.00109999999f,
+	-0.105714999f, 0.783601999f, -0.0514289998f, 0.879000008f, 0.0970999971f, 0.724600017f, 0.624499977f, 0.291399986f,
+	-0.0807470009f, 0.790700972f, -0.0801350027f, 0.860300004f, 0.0917999968f, 0.4903f, 0.762899995f, 0.421299994f,
+	-0.0614169985f, 0.789808989f, -0.108667001f, 0.844399989f, 0.0891999975f, 0.501999974f, 0.814499974f, 0.290800005f,
+	-0.0703350008f, 0.760631025f, -0.0677070022f, 0.858900011f, 0.106399998f, 0.819000006f, -0.00850000046f, 0.573700011f,
+	-0.109123997f, 0.78965199f, -0.0389170013f, 0.888000011f, 0.0996999964f, 0.815900028f, 0.507399976f, -0.277399987f,
+	-0.104428001f, 0.769891024f, -0.0256319996f, 0.88440001f, 0.111900002f, 0.982900023f, -0.0623999983f, 0.173299998f,
+	-0.0934050009f, 0.759644985f, -0.0433119982f, 0.87349999f, 0.109700002f, 0.818899989f, 0.0218000002f, 0.573499978f,
+	-0.100507997f, 0.799682975f, -0.0263429992f, 0.897499979f, 0.105899997f, 0.709999979f, 0.141900003f, -0.689700007f,
+	-0.0997119993f, 0.777422011f, -0.00996099971f, 0.892499983f, 0.118000001f, 0.886600018f, -0.460900009f, -0.0395999998f,
+	-0.113303997f, 0.816536009f, -0.022775f, 0.903599977f, 0.0975999981f, 0.0181000009f, 0.464700013f, -0.885299981f,
+	-0.0898389965f, 0.812471986f, -0.00952600036f, 0.909500003f, 0.112800002f, 0.867699981f, -0.0790000036f, -0.490700006f,
+	-0.0927599967f, 0.789959013f, 0.00759499986f, 0.904200017f, 0.124600001f, 0.871599972f, -0.489199996f, 0.0318000019f,
+	-0.0748170018f, 0.832840979f, 0.0116290003f, 0.926800013f, 0.116700001f, 0.796999991f, -0.0324999988f, -0.603200018f,
+	-0.0679389983f, 0.828005016f, 0.0206320006f, 0.932600021f, 0.122100003f, 0.789300025f, -0.0588000007f, -0.611199975f,
+	-0.0803129971f, 0.796140015f, 0.0174339991f, 0.917900026f, 0.130799994f, -0.403100014f, -0.548600018f, -0.732500017f,
+	-0.087559998f, 0.802646995f, 0.0177030005f, 0.914900005f, 0.126699999f, 0.515299976f, -0.677699983f, -0.524600029f,
+	0.0936570019f, 0.676162004f, 0.0515529998f, 0.173099995f, 0.852100015f, 0.674099982f, 0.256300002f, 0.692799985f,
+	0.0978259966f, 0.66780901f, 0.0487239994f, 0.168799996f, 0.850799978f, 0.640900016f, 0.0192000009f, 0.767400026f,
+	0.115143001f, 0.665862978f, 0.0343099982f, 0.165900007f, 0.841099977f, 0.803600013f, 0.0590000004f, 0.592199981f,
+	0.105723001f, 0.687959015f, 0.0340539999f, 0.176699996f, 0.841600001f, 0.790899992f, 0.261200011f, 0.55339998f,
+	0.0873640031f, 0.682563007f, 0.0549860001f, 0.176699996f, 0.854499996f, 0.645500004f, 0.198899999f, 0.737399995f,
+	0.0975579992f, 0.656843007f, 0.048308f, 0.163699999f, 0.851700008f, 0.684199989f, -0.308299989f, 0.660899997f,
+	0.129133999f, 0.669772029f, 0.00604300015f, 0.165299997f, 0.826900005f, 0.881399989f, 0.124300003f, 0.45570001f,
+	0.109088004f, 0.638203979f, 0.0348289981f, 0.153799996f, 0.845099986f, 0.778999984f, -0.0368999988f, 0.625999987f,
+	0.0899650007f, 0.648873985f, 0.0514959991f, 0.160500005f, 0.855700016f, 0.612600029f, -0.170900002f, 0.771700025f,
+	0.0987330005f, 0.714429975f, 0.0364090018f, 0.189099997f, 0.842299998f, 0.833999991f, 0.140900001f, 0.533500016f,
+	0.115943998f, 0.696933985f, 0.00604300015f, 0.179100007f, 0.827700019f, 0.86650002f, 0.246299997f, 0.434100002f,
+	0.0855569988f, 0.697323024f, 0.0532220006f, 0.183300003f, 0.853200018f, 0.649800003f, 0.168099999f, 0.74119997f,
+	0.0796660036f, 0.686500013f, 0.058995001f, 0.179299995f, 0.857900023f, 0.520299971f, 0.163900003f, 0.838100016f,
+	0.113608003f, 0.727922022f, 0.00604300015f, 0.193100005f, 0.826300025f, 0.884000003f, 0.0666000023f, 0.462700009f,
+	0.123534001f, 0.633566022f, 0.00604300015f, 0.149200007f, 0.83099997f, 0.89139998f, -0.0443000011f, 0.451000005f,
+	0.0827779993f, 0.644716978f, 0.056127999f, 0.159299999f, 0.859700024f, 0.630599976f, 0.00989999995f, 0.776000023f,
+	0.0872770026f, 0.606370986f, 0.0570290014f, 0.142100006f, 0.861599982f, 0.635500014f, 0.132599995f, 0.760599971f,
+	0.108400002f, 0.608044028f, 0.0390870012f, 0.140400007f, 0.849099994f, 0.7852f, 0.107100002f, 0.609899998f,
+	0.124531001f, 0.603421986f, 0.00604300015f, 0.135900006f, 0.832899988f, 0.890200019f, 0.102300003f, 0.443899989f,
+	0.0969280005f, 0.559099019f, 0.0598529987f, 0.120399997f, 0.863499999f, 0.63440001f, 0.171100006f, 0.753799975f,
+	0.111249f, 0.551163018f, 0.0495430008f, 0.115199998f, 0.85650003f, 0.777400017f, 0.180299997f, 0.602699995f,
+	0.129833996f, 0.541858971f, 0.0229199994f, 0.108599998f, 0.842800021f, 0.858900011f, 0.202900007f, 0.470299989f,
+	0.139160007f, 0.537371993f, 0.00604300015f, 0.105300002f, 0.834399998f, 0.879499972f, 0.194800004f, 0.434199989f,
+	-0.0884430036f, 0.681316972f, 0.0538170002f, 0.182500005f, 0.779100001f, -0.700800002f, 0.227899998f, 0.675999999f,
+	-0.0935249999f, 0.675348997f, 0.0505129993f, 0.179100007f, 0.781099975f, -0.72390002f, 0.270099998f, 0.634899974f,
+	-0.0910440013f, 0.67485702f, 0.0546449982f, 0.179299995f, 0.778900027f, -0.769699991f, 0.376100004f, 0.515900016f,
+	-0.0895719975f, 0.676898003f, 0.0552939996f, 0.180399999f, 0.778500021f, -0.754999995f, 0.373199999f, 0.539099991f,
+	-0.105235003f, 0.687804997f, 0.0336770006f, 0.182999998f, 0.791400015f, -0.785899997f, 0.231900007f, 0.573199987f,
+	-0.085244f, 0.697359025f, 0.0529999994f, 0.189899996f, 0.779999971f, -0.685000002f, 0.1558f, 0.711700022f,
+	-0.0796139985f, 0.686480999f, 0.0589630008f, 0.186000004f, 0.775200009f, -0.563199997f, 0.153600007f, 0.81190002f,
+	-0.0978239998f, 0.667807996f, 0.0487239994f, 0.175099999f, 0.782299995f, -0.681699991f, 0.151600003f, 0.715799987f,
+	-0.114554003f, 0.665822029f, 0.0338080004f, 0.172399998f, 0.791999996f, -0.805700004f, 0.0842000023f, 0.586399972f,
+	-0.0981379971f, 0.71449399f, 0.0360950008f, 0.195600003f, 0.791000009f, -0.797500014f, 0.159400001f, 0.581900001f,
+	-0.113645002f, 0.727917016f, 0.00604300015f, 0.199100003f, 0.807099998f, -0.885399997f, 0.123199999f, 0.448300004f,
+	-0.116131999f, 0.696990013f, 0.00604300015f, 0.185200006f, 0.805400014f, -0.887499988f, 0.198200002f, 0.416000009f,
+	-0.0980890021f, 0.658945978f, 0.0482529998f, 0.171100006f, 0.781899989f, -0.65109998f, -0.124600001f, 0.748700023f,
+	-0.127846003f, 0.66960597f, 0.00604300015f, 0.171800002f, 0.805800021f, -0.886600018f, 0.134200007f, 0.442699999f,
+	-0.123432003f, 0.633572996f, 0.00604300015f, 0.155699998f, 0.802100003f, -0.887499988f, -0.0498999991f, 0.458200008f,
+	-0.108497001f, 0.63826102f, 0.0343119986f, 0.160300002f, 0.787999988f, -0.778900027f, -0.0533000007f, 0.624800026f,
+	-0.09155f, 0.649757981f, 0.0507140011f, 0.167400002f, 0.778500021f, -0.584999979f, -0.2421f, 0.774100006f,
+	-0.0824270025f, 0.644809008f, 0.0558560006f, 0.166099995f, 0.773500025f, -0.634899974f, -0.0170000009f, 0.772400022f,
+	-0.108067997f, 0.607993007f, 0.038821999f, 0.147f, 0.783900023f, -0.780300021f, 0.128900006f, 0.611899972f,
+	-0.124475002f, 0.603412986f, 0.00604199991f, 0.142199993f, 0.800000012f, -0.891300023f, 0.125699997f, 0.435699999f,
+	-0.0872770026f, 0.606370986f, 0.0570290014f, 0.148800001f, 0.771300018f, -0.644999981f, 0.138899997f, 0.751399994f,
+	-0.111181997f, 0.551111996f, 0.0495029986f, 0.1219f, 0.77609998f, -0.758300006f, 0.158000007f, 0.632499993f,
+	-0.129834995f, 0.541858971f, 0.0229199994f, 0.115099996f, 0.789699972f, -0.868900001f, 0.180000007f, 0.461100012f,
+	-0.139119998f, 0.537335992f, 0.00604199991f, 0.111599997f, 0.797900021f, -0.880500019f, 0.195099995f, 0.432099998f,
+	-0.0967039987f, 0.558975995f, 0.0597239994f, 0.127100006f, 0.76910001f, -0.627799988f, 0.168099999f, 0.75999999f,
+	0.0957610011f, 0.666691005f, -0.0426869988f, 0.226500005f, 0.959100008f, 0.0579999983f, 0.580500007f, -0.81220001f,
+	0.0987560004f, 0.665507019f, -0.0432059988f, 0.227599993f, 0.960099995f, 0.0804999992f, 0.564100027f, -0.821799994f,
+	0.0890019983f, 0.660327971f, -0.0477170013f, 0.222399995f, 0.961499989f, -0.0516000018f, 0.652499974f, -0.755999982f,
+	0.0876659974f, 0.662384987f, -0.0456979983f, 0.222299993f, 0.960099995f, -0.0822999999f, 0.670400023f, -0.737399995f,
+	0.0088449996f, 0.322391003f, 0.0553920008f, 0.30399999f, 0.522700012f, -0.952700019f, -0.216199994f, 0.213599995f,
+	0.0142940003f, 0.298503011f, 0.0582219996f, 0.294999987f, 0.529299974f, -0.905499995f, -0.0983999968f, 0.412800014f,
+	0.0286229998f, 0.296660006f, 0.0747030005f, 0.298299998f, 0.538800001f, -0.57889998f, -0.180600002f, 0.79519999f,
+	0.0246600006f, 0.324027002f, 0.078873001f, 0.310000002f, 0.533900023f, -0.597000003f, -0.201399997f, 0.776499987f,
+	0.0116940001f, 0.323058009f, 0.0338059999f, 0.299299985f, 0.513999999f, -0.995100021f, -0.0991000012f, 0.00630000001f,
+	0.0107129999f, 0.301229f, 0.036460001f, 0.291299999f, 0.519900024f, -0.983299971f, 0.0648000017f, 0.1699f,
+	0.0429090001f, 0.296182007f, 0.0800969973f, 0.300300002f, 0.545400023f, 0.0156999994f, -0.186399996f, 0.982299984f,
+	0.0429619998f, 0.324528992f, 0.0856529996f, 0.312999994f, 0.542200029f, 0.0322999991f, -0.192300007f, 0.980799973f,
+	0.0587700009f, 0.323917001f, 0.0784580037f, 0.314099997f, 0.550000012f, 0.674499989f, -0.1523f, 0.72240001f,
+	0.0571499988f, 0.296631992f, 0.0745809972f, 0.301800013f, 0.552200019f, 0.652499974f, -0.1149f, 0.749100029f,
+	0.0701970011f, 0.325206012f, 0.0555430017f, 0.315699995f, 0.561500013f, 0.984600008f, -0.0807000026f, 0.154899999f,
+	0.0682659969f, 0.297291011f, 0.0574980006f, 0.302899987f, 0.561399996f, 0.959200025f, -0.0304000005f, 0.280900002f,
+	0.0678900033f, 0.328108996f, 0.0351510011f, 0.317400008f, 0.57069999f, 0.994499981f, -0.053199999f, -0.0900999978f,
+	0.0675989985f, 0.299275994f, 0.038759999f, 0.30430001f, 0.569800019f, 0.999199986f, -0.0147000002f, -0.0370999984f,
+	-0.0088449996f, 0.322391003f, 0.0553920008f, 0.341300011f, 0.831099987f, 0.952700019f, -0.216199994f, 0.213599995f,
+	-0.0246600006f, 0.324027002f, 0.078873001f, 0.335099995f, 0.819800019f, 0.597000003f, -0.201399997f, 0.776499987f,
+	-0.0286229998f, 0.296660006f, 0.0747030005f, 0.346799999f, 0.814899981f, 0.57889998f, -0.180600002f, 0.79519999f,
+	-0.0142940003f, 0.298503011f, 0.0582219996f, 0.350100011f, 0.824199975f, 0.905499995f, -0.0983999968f, 0.412800014f,
+	-0.0116940001f, 0.323058009f, 0.0338059999f, 0.346300006f, 0.83950001f, 0.995100021f, -0.0991000012f, 0.00630000001f,
+	-0.0429619998f, 0.324528992f, 0.0856529996f, 0.332100004f, 0.811500013f, -0.0322999991f, -0.192300007f, 0.980799973f,
+	-0.0429090001f, 0.296182007f, 0.0800969973f, 0.344799995f, 0.808200002f, -0.0156999994f, -0.186399996f, 0.982299984f,
+	-0.0587700009f, 0.323917001f, 0.0784580037f, 0.331099987f, 0.803600013f, -0.674499989f, -0.1523f, 0.72240001f,
+	-0.0571499988f, 0.296631992f, 0.0745809972f, 0.343400002f, 0.801400006f, -0.652499974f, -0.1149f, 0.749100029f,
+	-0.0701970011f, 0.325206012f, 0.0555430017f, 0.32949999f, 0.792100012f, -0.984600008f, -0.0807000026f, 0.154899999f,
+	-0.0682659969f, 0.297291011f, 0.0574980006f, 0.342299998f, 0.792200029f, -0.959200025f, -0.0304000005f, 0.280900002f,
+	-0.0678900033f, 0.328108996f, 0.0351510011f, 0.327699989f, 0.782899976f, -0.994499981f, -0.053199999f, -0.0900999978f,
+	-0.0675989985f, 0.299275994f, 0.038759999f, 0.340900004f, 0.783800006f, -0.999199986f, -0.0147000002f, -0.0370999984f,
+	-0.0107129999f, 0.301229f, 0.036460001f, 0.354000002f, 0.833400011f, 0.983299971f, 0.0648000017f, 0.1699f,
+	-0.0169130005f, 0.89505899f, -0.0469949991f, 0.126599997f, 0.648899972f, -0.782599986f, 0.249500006f, -0.570299983f,
+	-0.01664f, 0.901744008f, -0.0444520004f, 0.129800007f, 0.649600029f, -0.644800007f, 0.294699997f, -0.705299973f,
+	-0.0154149998f, 0.898483992f, -0.0469340011f, 0.127900004f, 0.649999976f, -0.679700017f, 0.309199989f, -0.665099978f,
+	-0.0179350004f, 0.885589004f, -0.0480379984f, 0.122699998f, 0.647099972f, -0.934899986f, 0.209800005f, -0.286199987f,
+	-0.0154600004f, 0.895206988f, -0.0490740016f, 0.126100004f, 0.649999976f, -0.822700024f, 0.244200006f, -0.513400018f,
+	-0.0180719998f, 0.880135f, -0.0521389991f, 0.119599998f, 0.647300005f, -0.942700028f, 0.215200007f, -0.254900008f,
+	0.116016001f, 0.733229995f, 0.00604300015f, 0.106899999f, 0.769400001f, 0.791700006f, 0.299899995f, 0.532299995f,
+	0.113195002f, 0.740530014f, 0.00604300015f, 0.110399999f, 0.76910001f, 0.789600015f, 0.305000007f, 0.532400012f,
+	0.0955390036f, 0.724671006f, 0.0413209982f, 0.108400002f, 0.788299978f, 0.752399981f, 0.199000001f, 0.628000021f,
+	0.0986189991f, 0.718555987f, 0.0395280011f, 0.1052f, 0.787699997f, 0.745400012f, 0.194600001f, 0.637600005f,
+	0.0799290016f, 0.704151988f, 0.0596809983f, 0.103100002f, 0.801599979f, 0.621699989f, 0.189700007f, 0.759899974f,
+	0.0852110013f, 0.699020982f, 0.0563630015f, 0.100000001f, 0.799799979f, 0.645399988f, 0.185200006f, 0.740999997f,
+	0.0693359971f, 0.687550008f, 0.069881998f, 0.0983000025f, 0.810500026f, 0.453000009f, 0.193599999f, 0.870199978f,
+	0.0779590011f, 0.686878026f, 0.0655369982f, 0.0964000002f, 0.806500018f, 0.472299993f, 0.166299999f, 0.86559999f,
+	0.0818509981f, 0.678415f, 0.0645750016f, 0.0921000019f, 0.806400001f, 0.496399999f, 0.0615999997f, 0.86589998f,
+	0.0870990008f, 0.682523012f, 0.0614139996f, 0.0927999988f, 0.80309999f, 0.512000024f, 0.00789999962f, 0.859000027f,
+	0.0944719985f, 0.674674988f, 0.0562219992f, 0.0879999995f, 0.800700009f, 0.543900013f, 0.0763000026f, 0.835699975f,
+	0.0887669995f, 0.669040024f, 0.0606260002f, 0.0868000016f, 0.804700017f, 0.530799985f, -0.0138999997f, 0.84740001f,
+	0.0987680033f, 0.666961014f, 0.0546230003f, 0.0839999989f, 0.800100029f, 0.466199994f, -0.00769999996f, 0.8847f,
+	0.0890299976f, 0.662652016f, 0.0588660017f, 0.0838999972f, 0.805299997f, 0.409000009f, -0.0804999992f, 0.908999979f,
+	0.0972760022f, 0.657420993f, 0.0552840009f, 0.0802000016f, 0.802399993f, 0.398900002f, 0.000899999985f, 0.916999996f,
+	0.0847690031f, 0.654980004f, 0.0600830019f, 0.0815000013f, 0.808399975f, 0.307900012f, -0.0278999992f, 0.950999975f,
+	0.0914369971f, 0.651677012f, 0.0578280017f, 0.0789000019f, 0.806100011f, 0.338099986f, -0.00270000007f, 0.941100001f,
+	0.0705809966f, 0.645530999f, 0.0643249974f, 0.0799999982f, 0.816299975f, 0.263799995f, 0.0725999996f, 0.961799979f,
+	0.0806759968f, 0.645300984f, 0.0616590008f, 0.0781000033f, 0.81190002f, 0.263599992f, 0.116999999f, 0.957499981f,
+	0.077200003f, 0.604937971f, 0.0659079999f, 0.061900001f, 0.82069999f, 0.369100004f, 0.128800005f, 0.920400023f,
+	0.085363999f, 0.607050002f, 0.0622220002f, 0.0612999983f, 0.816600025f, 0.39199999f, 0.121399999f, 0.911899984f,
+	0.0912370011f, 0.552193999f, 0.0711070001f, 0.0373999998f, 0.825100005f, 0.579299986f, 0.204799995f, 0.788999975f,
+	0.0963660032f, 0.556657016f, 0.0662539974f, 0.0383000001f, 0.821399987f, 0.59859997f, 0.164700001f, 0.783900023f,
+	0.112830997f, 0.542865992f, 0.0584160015f, 0.0295000002f, 0.815900028f, 0.689700007f, 0.370000005f, 0.622399986f,
+	0.112419002f, 0.549600005f, 0.0548800007f, 0.0324000008f, 0.81400001f, 0.689999998f, 0.351000011f, 0.633000016f,
+	0.135170996f, 0.533703029f, 0.0317960009f, 0.0218000002f, 0.801599979f, 0.817600012f, 0.323000014f, 0.476700008f,
+	0.135355994f, 0.538411975f, 0.0284490008f, 0.0237000007f, 0.799799979f, 0.844399989f, 0.287f, 0.452300012f,
+	0.149912f, 0.527886987f, 0.00604300015f, 0.0165999997f, 0.788900018f, 0.824899971f, 0.421099991f, 0.377099991f,
+	0.146274f, 0.535014987f, 0.00604300015f, 0.0201999992f, 0.788900018f, 0.832199991f, 0.404300004f, 0.379400015f,
+	-0.134598002f, 0.539502978f, -0.00515600014f, 0.0184000004f, 0.841099977f, -0.898400009f, 0.194199994f, -0.39379999f,
+	-0.139119998f, 0.537335992f, 0.00604199991f, 0.0165999997f, 0.835900009f, -0.920799971f, 0.204099998f, -0.332300007f,
+	-0.124475002f, 0.603412986f, 0.00604199991f, 0.0472000018f, 0.833899975f, -0.900399983f, 0.134200007f, -0.413899988f,
+	-0.120842002f, 0.546283007f, -0.0262620002f, 0.0232999995f, 0.851599991f, -0.838100016f, 0.160600007f, -0.521300018f,
+	-0.108496003f, 0.608063996f, -0.0270809997f, 0.0518999994f, 0.850099981f, -0.781400025f, 0.132200003f, -0.609899998f,
+	-0.123432003f, 0.633572996f, 0.00604300015f, 0.0606999993f, 0.831900001f, -0.897499979f, -0.0485999994f, -0.4384f,
+	-0.109085001f, 0.638204992f, -0.0227400009f, 0.0653000027f, 0.846099973f, -0.784799993f, -0.0559f, -0.617299974f,
+	-0.111642003f, 0.550728023f, -0.0385870002f, 0.0264999997f, 0.857900023f, -0.739700019f, 0.163399994f, -0.652800024f,
+	-0.0875279978f, 0.606042981f, -0.0453229994f, 0.0533000007f, 0.862800002f, -0.637399971f, 0.142199993f, -0.757300019f,
+	-0.0827779993f, 0.644716978f, -0.0440419987f, 0.0707999989f, 0.861000001f, -0.623000026f, -0.0489999987f, -0.780700028f,
+	-0.0915110037f, 0.649905026f, -0.0399740003f, 0.0725999996f, 0.856400013f, -0.573000014f, -0.275999993f, -0.771700025f,
+	-0.114949003f, 0.66584897f, -0.0220749993f, 0.0772999972f, 0.842000008f, -0.818499982f, 0.0794999972f, -0.569000006f,
+	-0.0983280018f, 0.659433007f, -0.037202999f, 0.076700002f, 0.852400005f, -0.658900023f, -0.0929000005f, -0.746500015f,
+	-0.127846003f, 0.66960597f, 0.00604300015f, 0.0766000003f, 0.828100026f, -0.893599987f, 0.135399997f, -0.428000003f,
+	-0.116131999f, 0.696990013f, 0.00604300015f, 0.0900999978f, 0.828100026f, -0.897899985f, 0.197899997f, -0.39320001f,
+	-0.105892003f, 0.688009024f, -0.022101f, 0.0881000012f, 0.842199981f, -0.791199982f, 0.242799997f, -0.56129998f,
+	-0.095693998f, 0.674099982f, -0.0387100019f, 0.0835999995f, 0.852100015f, -0.677399993f, 0.232800007f, -0.697799981f,
+	-0.113645002f, 0.727917016f, 0.00604300015f, 0.104000002f, 0.826300025f, -0.8926f, 0.130899996f, -0.431499988f,
+	-0.0873719975f, 0.682569027f, -0.0429060012f, 0.0883999988f, 0.855099976f, -0.643700004f, 0.212500006f, -0.735099971f,
+	-0.0990469977f, 0.714682996f, -0.023263f, 0.100599997f, 0.842000008f, -0.796199977f, 0.179199994f, -0.577899992f,
+	-0.0855569988f, 0.697323024f, -0.0411360003f, 0.0949999988f, 0.853500009f, -0.671899974f, 0.163499996f, -0.72240001f,
+	-0.0796660036f, 0.686500013f, -0.0469090007f, 0.0912000015f, 0.858399987f, -0.519500017f, 0.164499998f, -0.838500023f,
+	-0.0969280005f, 0.559099019f, -0.047766f, 0.0318000019f, 0.864499986f, -0.586000025f, 0.158700004f, -0.79460001f,
+	-0.0872770026f, 0.606370986f, 0.0570290014f, 0.206100002f, 0.986400008f, -0.926299989f, 0.175999999f, 0.333099991f,
+	-0.0853279978f, 0.607042015f, 0.06219f, 0.206599995f, 0.983900011f, -0.930400014f, 0.172700003f, 0.323399991f,
+	-0.079824999f, 0.645523012f, 0.0606600009f, 0.224099994f, 0.985000014f, -0.885900021f, 0.127200007f, 0.446200013f,
+	-0.0824270025f, 0.644809008f, 0.0558560006f, 0.2236f, 0.987500012f, -0.880100012f, 0.125f, 0.458099991f,
+	-0.0967039987f, 0.558975995f, 0.0597239994f, 0.184200004f, 0.985000014f, -0.958599985f, 0.217500001f, 0.183799997f,
+	-0.0962970033f, 0.556357026f, 0.0652059987f, 0.1831f, 0.982500017f, -0.959999979f, 0.218199998f, 0.175600007f,
+	-0.0252880007f, 0.671956003f, -0.0664009973f, 0.936200023f, 0.773500025f, -0.916400015f, -0.388399988f, 0.0964000002f,
+	-0.0286630001f, 0.665840983f, -0.0631000027f, 0.935400009f, 0.776899993f, -0.629100025f, 0.716799974f, 0.300700009f,
+	-0.0271000005f, 0.665602982f, -0.0591589995f, 0.933499992f, 0.776899993f, -0.572300017f, 0.776199996f, 0.264400005f,
+	-0.0376890004f, 0.65713203f, -0.045607999f, 0.929700017f, 0.784799993f, -0.331099987f, 0.90170002f, 0.278100014f,
+	-0.041294001f, 0.656803012f, -0.0486069992f, 0.931599975f, 0.785700023f, -0.319599986f, 0.903699994f, 0.284999996f,
+	-0.0827779993f, 0.644716978f, -0.0440419987f, 0.229499996f, 0.932500005f, -0.567900002f, -0.772400022f, -0.284500003f,
+	-0.0915110037f, 0.649905026f, -0.0399740003f, 0.225899994f, 0.935800016f, -0.721499979f, -0.657899976f, -0.215800002f,
+	-0.0914189965f, 0.651690006f, -0.0457209982f, 0.2245f, 0.933399975f, -0.703199983f, -0.674000025f, -0.226600006f,
+	-0.0806759968f, 0.645300984f, -0.0495730005f, 0.229200006f, 0.929799974f, -0.564400017f, -0.770699978f, -0.295700014f,
+	-0.0983280018f, 0.659433007f, -0.037202999f, 0.221100003f, 0.938399971f, -0.966099977f, -0.202099994f, -0.160799995f,
+	-0.0975119993f, 0.660027027f, -0.0428880006f, 0.220400006f, 0.935899973f, -0.966600001f, -0.199000001f, -0.161400005f,
+	-0.095693998f, 0.674099982f, -0.0387100019f, 0.214300007f, 0.938799977f, -0.91960001f, 0.374300003f, -0.1193f,
+	-0.0948650017f, 0.673587978f, -0.0452729985f, 0.214000002f, 0.935800016f, -0.898199975f, 0.414700001f, -0.145799994f,
+	-0.0873980001f, 0.682753026f, -0.0495809987f, 0.2086f, 0.934199989f, -0.537500024f, 0.843200028f, 0.00410000002f,
+	-0.0873719975f, 0.682569027f, -0.0429060012f, 0.208800003f, 0.93720001f, -0.610800028f, 0.791700006f, 0.0119000003f,
+	-0.0779599994f, 0.686878026f, -0.0534510016f, 0.203799993f, 0.932799995f, -0.443100005f, 0.896000028f, -0.0293000005f,
+	-0.0796660036f, 0.686500013f, -0.0469090007f, 0.204799995f, 0.935699999f, -0.484100014f, 0.871699989f, -0.0759000033f,
+	0.124531001f, 0.603421986f, 0.00604300015f, 0.0472999997f, 0.933099985f, 0.897499979f, 0.121399999f, -0.423999995f,
+	0.139160007f, 0.537371993f, 0.00604300015f, 0.0165999997f, 0.932900012f, 0.910600007f, 0.201700002f, -0.360700011f,
+	0.134339005f, 0.53927201f, -0.00506399991f, 0.0179999992f, 0.92750001f, 0.887799978f, 0.206900001f, -0.4111f,
+	0.123534001f, 0.633566022f, 0.00604300015f, 0.0606999993f, 0.934499979f, 0.89139998f, -0.0443000011f, -0.451000005f,
+	0.108400002f, 0.608044028f, -0.0270009991f, 0.0511000007f, 0.916700006f, 0.771099985f, 0.127100006f, -0.623899996f,
+	0.126491994f, 0.543636024f, -0.0173870008f, 0.0208000001f, 0.921199977f, 0.851300001f, 0.186900005f, -0.4903f,
+	0.109088004f, 0.638203979f, -0.0227429997f, 0.0647f, 0.920099974f, 0.780499995f, -0.0474999994f, -0.623300016f,
+	0.129133999f, 0.669772029f, 0.00604300015f, 0.0769999996f, 0.937900007f, 0.881399989f, 0.124300003f, -0.45570001f,
+	0.111249f, 0.551163018f, -0.0374570005f, 0.0255999994f, 0.910399973f, 0.746500015f, 0.156299993f, -0.646799982f,
+	0.0969280005f, 0.559099019f, -0.047766f, 0.0305000003f, 0.903100014f, 0.633300006f, 0.171700001f, -0.754599988f,
+	0.088192001f, 0.600858986f, -0.0452819988f, 0.0498000011f, 0.903999984f, 0.603399992f, 0.238600001f, -0.760900021f,
+	0.0864979997f, 0.605844975f, -0.0445239991f, 0.052099999f, 0.903999984f, 0.606100023f, 0.194999993f, -0.771099985f,
+	0.0827779993f, 0.644716978f, -0.0440419987f, 0.069600001f, 0.905300021f, 0.617900014f, -0.0662999973f, -0.783500016f,
+	0.0904010013f, 0.649138987f, -0.0404420011f, 0.0711999983f, 0.909099996f, 0.594200015f, -0.279700011f, -0.754100025f,
+	0.115143001f, 0.665862978f, -0.0222239997f, 0.0769999996f, 0.923699975f, 0.78670001f, 0.0798000023f, -0.612200022f,
+	0.105723001f, 0.687959015f, -0.0219679996f, 0.0877000019f, 0.922599971f, 0.790600002f, 0.242699996f, -0.562099993f,
+	0.115943998f, 0.696933985f, 0.00604300015f, 0.0907000005f, 0.936500013f, 0.86650002f, 0.246299997f, -0.434100002f,
+	0.0975809991f, 0.657198012f, -0.0375379995f, 0.0746999979f, 0.912899971f, 0.742900014f, -0.2491f, -0.621399999f,
+	0.0975169986f, 0.667984009f, -0.0381239988f, 0.0794999972f, 0.913399994f, 0.873899996f, 0.118000001f, -0.471599996f,
+	0.0953190029f, 0.673397005f, -0.0391100012f, 0.0820999965f, 0.912800014f, 0.771700025f, 0.260699987f, -0.5801f,
+	0.0873640031f, 0.682563007f, -0.0428999998f, 0.0869999975f, 0.909699976f, 0.646000028f, 0.202600002f, -0.735899985f,
+	0.0987330005f, 0.714429975f, -0.0243219994f, 0.100100003f, 0.921400011f, 0.833999991f, 0.140900001f, -0.533500016f,
+	0.113608003f, 0.727922022f, 0.00604300015f, 0.104800001f, 0.93720001f, 0.884000003f, 0.0666000023f, -0.462700009f,
+	0.0855569988f, 0.697323024f, -0.0411360003f, 0.0936999992f, 0.910700023f, 0.649800003f, 0.168099999f, -0.74119997f,
+	0.0796660036f, 0.686500013f, -0.0469090007f, 0.0895000026f, 0.906199992f, 0.520299971f, 0.163900003f, -0.838100016f,
+	0.0940970033f, 0.670837998f, -0.043722f, 0.0811000019f, 0.910600007f, 0.876800001f, 0.26910001f, -0.398499995f,
+	0.0957610011f, 0.666691005f, -0.0426869988f, 0.0790999979f, 0.91109997f, 0.877699971f, 0.250099987f, -0.408699989f,
+	0.085363999f, 0.607050002f, 0.0622220002f, 0.0825999975f, 0.986800015f, 0.931699991f, 0.167799994f, 0.322100013f,
+	0.0872770026f, 0.606370986f, 0.0570290014f, 0.0820999965f, 0.984399974f, 0.932799995f, 0.176400006f, 0.314200014f,
+	0.0827779993f, 0.644716978f, 0.056127999f, 0.0995000005f, 0.983200014f, 0.932600021f, 0.119099997f, 0.340700001f,
+	0.0806759968f, 0.645300984f, 0.0616590008f, 0.100000001f, 0.985899985f, 0.932200015f, 0.1193f, 0.341699988f,
+	0.0963660032f, 0.556657016f, 0.0662539974f, 0.0592f, 0.988799989f, 0.961700022f, 0.208800003f, 0.177499995f,
+	0.0969280005f, 0.559099019f, 0.0598529987f, 0.0601999983f, 0.985899985f, 0.964600027f, 0.206699997f, 0.163599998f,
+	0.0940369964f, 0.781509995f, -0.0946509987f, 0.063000001f, 0.567799985f, -0.533599973f, 0.386400014f, -0.752300024f,
+	0.0984909981f, 0.780884981f, -0.098679997f, 0.0640999973f, 0.565199971f, -0.618099988f, 0.293900013f, -0.729099989f,
+	0.0983999968f, 0.776040971f, -0.100556001f, 0.066399999f, 0.565400004f, -0.572600007f, 0.345699996f, -0.743399978f,
+	0.0901459977f, 0.778419971f, -0.0937639996f, 0.0640999973f, 0.569800019f, -0.503300011f, 0.416000009f, -0.757399976f,
+	-0.0186950006f, 0.347918987f, 0.082735002f, 0.423400015f, 0.917400002f, 0.672100008f, -0.0914999992f, 0.734799981f,
+	-0.0214869995f, 0.327082008f, 0.0834000036f, 0.432700008f, 0.915300012f, 0.605599999f, -0.0557999983f, 0.793799996f,
+	-0.0038089999f, 0.327964008f, 0.0575329997f, 0.434100002f, 0.929400027f, 0.974900007f, -0.0645999983f, 0.213200003f,
+	-0.00247499999f, 0.350169003f, 0.0568559989f, 0.424100012f, 0.931200027f, 0.983099997f, -0.0384000018f, 0.179000005f,
+	-0.0429919995f, 0.328377008f, 0.0918300003f, 0.431199998f, 0.904900014f, -0.0182000007f, -0.179800004f, 0.983500004f,
+	-0.0430339985f, 0.34830299f, 0.0968680009f, 0.421999991f, 0.904699981f, -0.00389999989f, -0.245100006f, 0.969500005f,
+	-0.00801199954f, 0.327243f, 0.0319169983f, 0.436300009f, 0.940900028f, 0.980499983f, -0.0249000005f, -0.194800004f,
+	-0.00903899968f, 0.346985012f, 0.0274039991f, 0.4278f, 0.944500029f, 0.976000011f, 0.00100000005f, -0.217600003f,
+	-0.0672499985f, 0.347867996f, 0.0825290009f, 0.423900008f, 0.892099977f, -0.734700024f, -0.175999999f, 0.655099988f,
+	-0.0634550005f, 0.327789992f, 0.0813269988f, 0.432900012f, 0.894599974f, -0.693700016f, -0.172999993f, 0.699100018f,
+	-0.0775239989f, 0.347597003f, 0.0562920012f, 0.427300006f, 0.879800022f, -0.984200001f, -0.145199999f, 0.101300001f,
+	-0.0747110024f, 0.328799009f, 0.0576899983f, 0.435299993f, 0.883000016f, -0.975399971f, -0.154699996f, 0.157199994f,
+	-0.074653998f, 0.349840999f, 0.0291760005f, 0.430200011f, 0.867799997f, -0.976700008f, -0.179399997f, -0.118199997f,
+	-0.0716930032f, 0.331405014f, 0.0326899998f, 0.43779999f, 0.871800005f, -0.977400005f, -0.170599997f, -0.124399997f,
+	0.0186950006f, 0.347918987f, 0.082735002f, 0.415199995f, 0.578499973f, -0.672100008f, -0.0914999992f, 0.734799981f,
+	0.00247499999f, 0.350169003f, 0.0568559989f, 0.414499998f, 0.564700007f, -0.983099997f, -0.0384000018f, 0.179000005f,
+	0.0038089999f, 0.327964008f, 0.0575329997f, 0.404599994f, 0.566500008f, -0.974900007f, -0.0645999983f, 0.213200003f,
+	0.0214869995f, 0.327082008f, 0.0834000036f, 0.405900002f, 0.580600023f, -0.605599999f, -0.0557999983f, 0.793799996f,
+	0.0429919995f, 0.328377008f, 0.0918300003f, 0.407299995f, 0.591000021f, 0.0182000007f, -0.179800004f, 0.983500004f,
+	0.0430339985f, 0.34830299f, 0.0968680009f, 0.416700006f, 0.591199994f, 0.00389999989f, -0.245100006f, 0.969500005f,
+	0.00903899968f, 0.346985012f, 0.0274039991f, 0.410899997f, 0.551400006f, -0.976000011f, 0.00100000005f, -0.217600003f,
+	0.00801199954f, 0.327243f, 0.0319169983f, 0.402399987f, 0.554899991f, -0.980499983f, -0.0249000005f, -0.194800004f,
+	0.0634550005f, 0.327789992f, 0.0813269988f, 0.405699998f, 0.601300001f, 0.693700016f, -0.172999993f, 0.699100018f,
+	0.0672499985f, 0.347867996f, 0.0825290009f, 0.414700001f, 0.603799999f, 0.734700024f, -0.175999999f, 0.655099988f,
+	0.0747110024f, 0.328799009f, 0.0576899983f, 0.403299987f, 0.612900019f, 0.975399971f, -0.154699996f, 0.157199994f,
+	0.0775239989f, 0.347597003f, 0.0562920012f, 0.411300004f, 0.616100013f, 0.984200001f, -0.145199999f, 0.101300001f,
+	0.0716930032f, 0.331405014f, 0.0326899998f, 0.40079999f, 0.624100029f, 0.977400005f, -0.170599997f, -0.124399997f,
+	0.074653998f, 0.349840999f, 0.0291760005f, 0.408399999f, 0.628099978f, 0.976700008f, -0.179399997f, -0.118199997f,
+	0.0156679992f, 0.752102017f, -0.150039002f, 0.0509000011f, 0.497299999f, -0.0925000012f, 0.924499989f, -0.369800001f,
+	0.0213990007f, 0.754553974f, -0.143205002f, 0.0544000007f, 0.495099992f, -0.210700005f, 0.971199989f, 0.111100003f,
+	0.0321470015f, 0.737771988f, -0.164118007f, 0.0566999987f, 0.50849998f, 0.416500002f, 0.520799994f, -0.745199978f,
+	0.0244779997f, 0.739302993f, -0.167465001f, 0.0529000014f, 0.508099973f, 0.428000003f, 0.608200014f, -0.668500006f,
+	0.00614499999f, 0.739064991f, -0.179318994f, 0.0436999984f, 0.50910002f, -0.0013f, 0.452699989f, -0.891600013f,
+	-0.000302f, 0.745540977f, -0.16719f, 0.0403000005f, 0.503899992f, -0.223399997f, 0.955299973f, -0.193499997f,
+	0.0365110002f, 0.717706025f, -0.167177007f, 0.0584000014f, 0.518999994f, 0.479499996f, -0.0647f, -0.875100017f,
+	-0.0246280003f, 0.738829017f, -0.163481995f, 0.0287999995f, 0.508899987f, -0.783999979f, 0.419200003f, -0.457800001f,
+	0.00873200037f, 0.708203018f, -0.178882003f, 0.0449000001f, 0.522300005f, -0.0163000003f, -0.181700006f, -0.983200014f,
+	-0.0183450002f, 0.742597997f, -0.158176005f, 0.0284000002f, 0.505500019f, -0.170200005f, 0.985099971f, 0.0236000009f,
+	-0.0226380005f, 0.700671971f, -0.160456002f, 0.0292000007f, 0.525600016f, -0.851899981f, -0.247700006f, -0.461400002f,
+	-0.0212590005f, 0.703334987f, -0.139983997f, 0.0207000002f, 0.526799977f, -0.824000001f, -0.216900006f, 0.523400009f,
+	-0.023604f, 0.723806024f, -0.137336001f, 0.0174000002f, 0.517400026f, -0.952300012f, -0.188700005f, 0.239899993f,
+	-0.0180099998f, 0.74198103f, -0.144529f, 0.0204000007f, 0.506299973f, -0.171700001f, 0.985099971f, -0.00689999992f,
+	-0.0240180008f, 0.739971995f, -0.140352994f, 0.0190999992f, 0.509500027f, -0.757399976f, 0.580900013f, 0.298099995f,
+	0.0103759998f, 0.685341001f, -0.170977995f, 0.0438000001f, 0.532999992f, 0.0815000013f, -0.592100024f, -0.801699996f,
+	-0.0156309996f, 0.681052029f, -0.155458003f, 0.0307f, 0.534300029f, -0.646099985f, -0.700600028f, -0.302899987f,
+	0.0357859991f, 0.69561702f, -0.157698005f, 0.0573000014f, 0.531700015f, 0.551199973f, -0.525099993f, -0.648400009f,
+	0.0342219993f, 0.681895018f, -0.140233994f, 0.0581f, 0.542299986f, -0.0854000002f, -0.892700016f, 0.442400008f,
+	0.0105760004f, 0.680260003f, -0.163136005f, 0.0425000004f, 0.537299991f, 0.131300002f, -0.945500016f, -0.298099995f,
+	-0.00878100004f, 0.67831701f, -0.151074007f, 0.0308999997f, 0.537500024f, -0.0812999979f, -0.992600024f, 0.0896999985f,
+	-0.0146230003f, 0.687008023f, -0.138012007f, 0.023f, 0.534600019f, -0.639500022f, -0.420899987f, 0.643299997f,
+	-0.00972099975f, 0.683021009f, -0.138559997f, 0.0242999997f, 0.537100017f, -0.118699998f, -0.799700022f, 0.588500023f,
+	-0.003425f, 0.680748999f, -0.150652006f, 0.0315999985f, 0.539600015f, 0.360700011f, -0.840499997f, 0.404300004f,
+	-0.00110899995f, 0.692227006f, -0.132624999f, 0.0172000006f, 0.537899971f, 0.33070001f, -0.181700006f, 0.926100016f,
+	-0.00151800003f, 0.688537002f, -0.134853005f, 0.0201999992f, 0.539499998f, 0.421799988f, -0.647800028f, 0.63440001f,
+	-0.00323899998f, 0.683870018f, -0.144547999f, 0.0264999997f, 0.540400028f, 0.340299994f, -0.841700017f, 0.419200003f,
+	-0.00610100012f, 0.70589298f, -0.134044006f, 0.0142000001f, 0.529999971f, -0.145199999f, -0.0540999994f, 0.987900019f,
+	-0.0183819998f, 0.723891973f, -0.131210998f, 0.0140000004f, 0.519299984f, -0.268700004f, -0.610899985f, 0.744700015f,
+	-0.0204990003f, 0.734988987f, -0.134165004f, 0.0156999994f, 0.511300027f, -0.801599979f, 0.497799993f, 0.331099987f,
+	-0.014769f, 0.741717994f, -0.137298003f, 0.0162000004f, 0.506399989f, -0.521700025f, 0.852999985f, 0.0126f,
+	0.002385f, 0.690984011f, -0.138647005f, 0.0210999995f, 0.542500019f, 0.619000018f, -0.425000012f, 0.660399973f,
+	0.104673997f, 0.73517698f, 0.00604300015f, 0.195800006f, 0.815699995f, -0.519699991f, 0.846199989f, -0.117399998f,
+	0.113195002f, 0.740530014f, 0.00604300015f, 0.198300004f, 0.819400012f, -0.528500021f, 0.841300011f, -0.113700002f,
+	0.0955390036f, 0.724671006f, -0.0292349998f, 0.179100007f, 0.819599986f, -0.523199975f, 0.816799998f, -0.242799997f,
+	0.0886709988f, 0.722175002f, -0.0231069997f, 0.1796f, 0.815400004f, -0.507200003f, 0.823400021f, -0.254200011f,
+	0.0799290016f, 0.704151988f, -0.0475939997f, 0.165299997f, 0.815699995f, -0.515399992f, 0.717700005f, -0.468199998f,
+	0.0728939995f, 0.703309f, -0.0417230017f, 0.166099995f, 0.811600029f, -0.500699997f, 0.707899988f, -0.498199999f,
+	0.0630249977f, 0.685624003f, -0.0519189984f, 0.156399995f, 0.808300018f, -0.593599975f, 0.65170002f, -0.472200006f,
+	0.0693359971f, 0.687550008f, -0.0577960014f, 0.1558f, 0.81220001f, -0.610199988f, 0.659300029f, -0.439300001f,
+	-0.0979399979f, 0.658670008f, 0.0540009998f, 0.175300002f, 0.896799982f, -0.399599999f, -0.103799999f, 0.91079998f,
+	-0.0905319974f, 0.662621975f, 0.0578989983f, 0.178800002f, 0.894599974f, -0.389699996f, -0.0900999978f, 0.916499972f,
+	-0.0987370014f, 0.666957021f, 0.0546049997f, 0.178299993f, 0.898999989f, -0.383300006f, -0.0238000005f, 0.923300028f,
+	-0.0849040002f, 0.654515028f, 0.0589670017f, 0.177000001f, 0.890500009f, -0.355800003f, -0.0449000001f, 0.933499992f,
+	-0.0918620005f, 0.651493013f, 0.0561439991f, 0.174099997f, 0.8926f, -0.364399999f, -0.0307f, 0.930700004f,
+	-0.0911260024f, 0.66939199f, 0.0573850013f, 0.181199998f, 0.896499991f, -0.338800013f, 0.0416000001f, 0.939899981f,
+	-0.0955160037f, 0.67375201f, 0.0556100011f, 0.181799993f, 0.899299979f, -0.352400005f, 0.0344999991f, 0.935199976f,
+	-0.079824999f, 0.645523012f, 0.0606600009f, 0.174899995f, 0.886300027f, -0.263500005f, 0.0441999994f, 0.963699996f,
+	-0.0708139986f, 0.645177007f, 0.0629820004f, 0.177000001f, 0.882700026f, -0.264899999f, 0.0724000037f, 0.961600006f,
+	-0.0853279978f, 0.607042015f, 0.06219f, 0.158999994f, 0.878700018f, -0.391000003f, 0.133100003f, 0.910700023f,
+	-0.0771630034f, 0.604946017f, 0.0661310032f, 0.160400003f, 0.874800026f, -0.415399998f, 0.143199995f, 0.898299992f,
+	-0.0962970033f, 0.556357026f, 0.0652059987f, 0.1373f, 0.869700015f, -0.614799976f, 0.283199996f, 0.736100018f,
+	-0.0912370011f, 0.552193999f, 0.0711070001f, 0.1373f, 0.865700006f, -0.62620002f, 0.273799986f, 0.730000019f,
+	-0.112823002f, 0.542672992f, 0.0576759987f, 0.127700001f, 0.873300016f, -0.70539999f, 0.349400014f, 0.616699994f,
+	-0.113084003f, 0.547936976f, 0.0542789996f, 0.1294f, 0.87559998f, -0.718500018f, 0.345400006f, 0.603699982f,
+	-0.134092003f, 0.533141017f, 0.0319049992f, 0.117200002f, 0.885100007f, -0.813600004f, 0.190899998f, 0.549199998f,
+	-0.135148004f, 0.539820015f, 0.0281109996f, 0.1193f, 0.888000011f, -0.829299986f, 0.195500001f, 0.523500025f,
+	-0.149851993f, 0.527907014f, 0.00604500016f, 0.109300002f, 0.896600008f, -0.853399992f, 0.36649999f, 0.370799989f,
+	-0.146283001f, 0.535025001f, 0.00604300015f, 0.112800002f, 0.897400022f, -0.842800021f, 0.422600001f, 0.333400011f,
+	0.0963660032f, 0.556657016f, -0.0541669987f, 0.105999999f, 0.982200027f, 0.960900009f, 0.213200003f, -0.176499993f,
+	0.0863220021f, 0.60206902f, -0.0508249998f, 0.123599999f, 0.970499992f, 0.886500001f, 0.412900001f, -0.208800003f,
+	0.088192001f, 0.600858986f, -0.0452819988f, 0.124600001f, 0.97299999f, 0.895900011f, 0.33919999f, -0.286900014f,
+	0.0969280005f, 0.559099019f, -0.047766f, 0.108599998f, 0.983900011f, 0.96329999f, 0.211400002f, -0.165299997f,
+	0.0830499977f, 0.607396007f, -0.0488439985f, 0.126300007f, 0.969200015f, 0.82160002f, 0.4727f, -0.318699986f,
+	0.0864979997f, 0.605844975f, -0.0445239991f, 0.126699999f, 0.971800029f, 0.837400019f, 0.278600007f, -0.470299989f,
+	0.0827779993f, 0.644716978f, -0.0440419987f, 0.116599999f, 0.986299992f, 0.933600008f, 0.0918999985f, -0.346300006f,
+	0.0842289999f, 0.611166f, -0.0490359999f, 0.127100006f, 0.975099981f, 0.929700017f, 0.0932999998f, -0.356400013f,
+	0.0806759968f, 0.645300984f, -0.0495730005f, 0.118600003f, 0.988099992f, 0.934000015f, 0.0917999968f, -0.345299989f,
+	-0.085254997f, 0.611014009f, -0.0503839999f, 0.208199993f, 0.979300022f, -0.949500024f, 0.152099997f, -0.274500012f,
+	-0.0963649973f, 0.556657016f, -0.0541669987f, 0.1831f, 0.981299996f, -0.964100003f, 0.208499998f, -0.164399996f,
+	-0.0969280005f, 0.559099019f, -0.047766f, 0.184100002f, 0.978299975f, -0.96359998f, 0.208199993f, -0.167799994f,
+	-0.0875279978f, 0.606042981f, -0.0453229994f, 0.205799997f, 0.976999998f, -0.950999975f, 0.184200004f, -0.248300001f,
+	-0.0806759968f, 0.645300984f, -0.0495730005f, 0.223800004f, 0.978500009f, -0.933200002f, 0.126499996f, -0.336400002f,
+	-0.0827779993f, 0.644716978f, -0.0440419987f, 0.223399997f, 0.975799978f, -0.931699991f, 0.125699997f, -0.340799987f,
+	0.0628750026f, 0.685477018f, 0.0625239983f, 0.147400007f, 0.95599997f, -0.634599984f, 0.644500017f, 0.426499993f,
+	0.0693359971f, 0.687550008f, 0.069881998f, 0.148399994f, 0.960399985f, -0.650600016f, 0.653100014f, 0.387400001f,
+	0.0799290016f, 0.704151988f, 0.0596809983f, 0.138999999f, 0.963999987f, -0.559099972f, 0.709200025f, 0.429500014f,
+	0.0725559965f, 0.702813029f, 0.0529979989f, 0.138099998f, 0.959599972f, -0.546400011f, 0.697899997f, 0.463f,
+	0.0955390036f, 0.724671006f, 0.0413209982f, 0.125300005f, 0.967999995f, -0.539799988f, 0.810299993f, 0.228100002f,
+	0.0881339982f, 0.72161299f, 0.0348760001f, 0.124799997f, 0.963400006f, -0.530099988f, 0.812699974f, 0.241899997f,
+	0.113195002f, 0.740530014f, 0.00604300015f, 0.105999999f, 0.967800021f, -0.528500021f, 0.841300011f, 0.113700002f,
+	0.104673997f, 0.73517698f, 0.00604300015f, 0.108499996f, 0.963999987f, -0.522199988f, 0.844900012f, 0.116400003f,
+	-0.0984689966f, 0.727272987f, -0.0200769994f, 0.058699999f, 0.963699996f, 0.418599993f, 0.870999992f, -0.257299989f,
+	-0.112874001f, 0.741365016f, 0.00584100001f, 0.0467000008f, 0.972500026f, 0.586199999f, 0.810100019f, -0.0109999999f,
+	-0.104673997f, 0.73517698f, 0.00604300015f, 0.0467000008f, 0.967899978f, 0.591899991f, 0.805100024f, -0.0372000001f,
+	-0.091516003f, 0.724444985f, -0.0190750007f, 0.0582000017f, 0.960300028f, 0.342200011f, 0.886900008f, -0.310299993f,
+	-0.0943169966f, 0.722589016f, -0.0247419998f, 0.0610999987f, 0.961099982f, 0.0516999997f, 0.941200018f, -0.333799988f,
+	-0.0953650028f, 0.723814011f, 0.0405949987f, 0.0310999993f, 0.961199999f, 0.472000003f, 0.828599989f, 0.301099986f,
+	-0.0881339982f, 0.72161299f, 0.0348760001f, 0.0339000002f, 0.957899988f, 0.492900014f, 0.823000014f, 0.282299995f,
+	-0.0799119994f, 0.703352988f, 0.0586180016f, 0.0221999995f, 0.950100005f, 0.453799993f, 0.720099986f, 0.524900019f,
+	-0.0725559965f, 0.702813029f, 0.0529979989f, 0.0252f, 0.9472f, 0.487100005f, 0.710300028f, 0.508099973f,
+	-0.069325f, 0.687463999f, 0.0686369985f, 0.0165999997f, 0.942099988f, 0.599300027f, 0.629700005f, 0.494199991f,
+	-0.0628739968f, 0.685477018f, 0.0625239983f, 0.0194000006f, 0.939100027f, 0.6347f, 0.612999976f, 0.470499992f,
+	-0.0923769996f, 0.720806003f, -0.0319969989f, 0.0643000007f, 0.959599972f, 0.394600004f, 0.849900007f, -0.34920001f,
+	-0.086668998f, 0.720025003f, -0.0263689999f, 0.0615000017f, 0.957300007f, 0.440699995f, 0.834299982f, -0.331200004f,
+	-0.0748189986f, 0.705969989f, -0.039551001f, 0.0678000003f, 0.949299991f, 0.52609998f, 0.719500005f, -0.453399986f,
+	-0.0797810033f, 0.706312001f, -0.0445870012f, 0.0703999996f, 0.951200008f, 0.5176f, 0.720799983f, -0.460999995f,
+	-0.0630260035f, 0.685624003f, -0.0519189984f, 0.0749000013f, 0.939499974f, 0.620199978f, 0.637399971f, -0.457199991f,
+	-0.0693359971f, 0.687550008f, -0.0577960014f, 0.0776999965f, 0.942399979f, 0.610099971f, 0.641799986f, -0.464599997f,
+	0.0572559983f, 0.426160008f, -0.0260489993f, 0.467400014f, 0.681599975f, 0.260899991f, -0.750400007f, -0.6074f,
+	0.0425480008f, 0.428377002f, -0.0366489999f, 0.463999987f, 0.674099982f, 0.382099986f, -0.642199993f, -0.664499998f,
+	0.0425309986f, 0.434123993f, -0.0422139987f, 0.460399985f, 0.673699975f, 0.330900013f, -0.691500008f, -0.642099977f,
+	0.0626650006f, 0.431818008f, -0.0313040018f, 0.46360001f, 0.683600008f, 0.232299998f, -0.771799982f, -0.591899991f,
+	-0.0572559983f, 0.426160008f, -0.0260489993f, 0.358799994f, 0.774800003f, -0.260899991f, -0.750400007f, -0.6074f,
+	-0.0626650006f, 0.431818008f, -0.0313040018f, 0.362599999f, 0.772700012f, -0.232299998f, -0.771799982f, -0.591899991f,
+	-0.0425309986f, 0.434123993f, -0.0422139987f, 0.36590001f, 0.782599986f, -0.330900013f, -0.691500008f, -0.642099977f,
+	-0.0425480008f, 0.428377002f, -0.0366489999f, 0.362300009f, 0.782299995f, -0.382099986f, -0.642199993f, -0.664499998f,
+	0.112432003f, 0.542490005f, -0.046337001f, 0.1219f, 0.814100027f, 0.691500008f, 0.321399987f, -0.646899998f,
+	0.112419002f, 0.549600005f, -0.0427929983f, 0.123899996f, 0.817099988f, 0.689899981f, 0.319799989f, -0.649399996f,
+	0.130449995f, 0.540444016f, -0.0246009994f, 0.113600001f, 0.824000001f, 0.753300011f, 0.271600008f, -0.59890002f,
+	0.131465003f, 0.534970999f, -0.0257619992f, 0.111599997f, 0.822399974f, 0.754100025f, 0.267100006f, -0.600000024f,
+	0.0913029984f, 0.552725017f, -0.0602609999f, 0.132799998f, 0.808300018f, 0.647499979f, 0.25f, -0.719900012f,
+	0.0963660032f, 0.556657016f, -0.0541669987f, 0.131999999f, 0.81220001f, 0.658699989f, 0.251199991f, -0.709299982f,
+	0.077234f, 0.607232988f, -0.0545019992f, 0.154599994f, 0.821799994f, 0.467400014f, 0.211300001f, -0.858399987f,
+	0.0863220021f, 0.60206902f, -0.0508249998f, 0.149900004f, 0.823499978f, 0.484699994f, 0.211199999f, -0.848800004f,
+	-0.0852850005f, 0.443257987f, 0.111495003f, 0.490700006f, 0.789799988f, -0.648999989f, 0.288399994f, 0.703999996f,
+	-0.0694750026f, 0.441760004f, 0.122293003f, 0.487199992f, 0.782100022f, -0.174500003f, 0.31189999f, 0.933899999f,
+	-0.0617219992f, 0.516111016f, 0.0992000028f, 0.521300018f, 0.772499979f, -0.170599997f, 0.301999986f, 0.937900007f,
+	-0.103706002f, 0.447961003f, 0.0820600018f, 0.49939999f, 0.802699983f, -0.579999983f, 0.325899988f, 0.746599972f,
+	-0.0760359988f, 0.517153025f, 0.0900389999f, 0.524299979f, 0.779699981f, -0.739799976f, 0.305299997f, 0.599600017f,
+	-0.138273001f, 0.538676977f, -0.0116839996f, 0.0236000009f, 0.874199986f, -0.850799978f, 0.327199996f, -0.411199987f,
+	-0.139137998f, 0.532360017f, -0.0147919999f, 0.0208000001f, 0.875899971f, -0.844799995f, 0.324900001f, -0.425199986f,
+	-0.149851993f, 0.527907014f, 0.00604500016f, 0.0165999997f, 0.865999997f, -0.859700024f, 0.398600012f, -0.319400012f,
+	-0.146283001f, 0.535025001f, 0.00604300015f, 0.0201999992f, 0.86589998f, -0.853500009f, 0.427899987f, -0.297500014f,
+	-0.127865002f, 0.536769986f, -0.0316339992f, 0.0250000004f, 0.884199977f, -0.801500022f, 0.278800011f, -0.528900027f,
+	-0.126503006f, 0.543739974f, -0.0301329996f, 0.0281000007f, 0.88319999f, -0.792599976f, 0.271200001f, -0.54610002f,
+	-0.117642999f, 0.540660024f, -0.0424470007f, 0.0285999998f, 0.890100002f, -0.705900013f, 0.259299994f, -0.659200013f,
+	-0.114698f, 0.548497975f, -0.0426170006f, 0.0324000008f, 0.889999986f, -0.641799986f, 0.225299999f, -0.73299998f,
+	-0.0963649973f, 0.556657016f, -0.0541669987f, 0.0392000005f, 0.898000002f, -0.635699987f, 0.265399992f, -0.724799991f,
+	-0.0913029984f, 0.552725017f, -0.0602609999f, 0.0384999998f, 0.901899993f, -0.650699973f, 0.265199989f, -0.711499989f,
+	-0.0753140002f, 0.614712f, -0.0547219999f, 0.0671000034f, 0.896899998f, -0.450599998f, 0.146200001f, -0.880699992f,
+	-0.085254997f, 0.611014009f, -0.0503839999f, 0.0639000013f, 0.892799973f, -0.426200002f, 0.139899999f, -0.893700004f,
+	-0.0705730021f, 0.645546973f, -0.0523019992f, 0.0807999969f, 0.893299997f, -0.287200004f, 0.0798000023f, -0.954599977f,
+	-0.0806759968f, 0.645300984f, -0.0495730005f, 0.0790000036f, 0.888899982f, -0.266400009f, 0.0780000016f, -0.960699975f,
+	-0.0848039985f, 0.654802024f, -0.0475069992f, 0.0822999999f, 0.885399997f, -0.324699998f, 0.00630000001f, -0.945800006f,
+	-0.0914189965f, 0.651690006f, -0.0457209982f, 0.0798999965f, 0.883000016f, -0.300199986f, 0.0931999981f, -0.949299991f,
+	-0.0975119993f, 0.660027027f, -0.0428880006f, 0.0821999982f, 0.878700018f, -0.458900005f, -0.0930999964f, -0.883599997f,
+	-0.0890000015f, 0.660336971f, -0.0477479994f, 0.0841000006f, 0.882700026f, -0.472299993f, -0.255699992f, -0.843500018f,
+	-0.0948650017f, 0.673587978f, -0.0452729985f, 0.0883999988f, 0.877699971f, -0.519599974f, -0.0168999992f, -0.854300022f,
+	-0.0887719989f, 0.668790996f, -0.0488840006f, 0.0878000036f, 0.881500006f, -0.506699979f, -0.0348000005f, -0.861400008f,
+	-0.0873980001f, 0.682753026f, -0.0495809987f, 0.0938000008f, 0.879499972f, -0.454600006f, 0.0333999991f, -0.890100002f,
+	-0.0818509981f, 0.678415f, -0.0524890013f, 0.0931999981f, 0.8829f, -0.440699995f, 0.0524999984f, -0.896099985f,
+	-0.0779599994f, 0.686878026f, -0.0534510016f, 0.0974000022f, 0.882799983f, -0.446200013f, 0.215499997f, -0.868600011f,
+	-0.0693359971f, 0.687550008f, -0.0577960014f, 0.0995000005f, 0.886699975f, -0.456800014f, 0.262499988f, -0.850000024f,
+	-0.0852110013f, 0.699020982f, -0.0442770012f, 0.1008f, 0.875999987f, -0.470299989f, 0.317600012f, -0.823400021f,
+	-0.0797810033f, 0.706312001f, -0.0445870012f, 0.104900002f, 0.876600027f, -0.469099998f, 0.314200014f, -0.825299978f,
+	-0.0923769996f, 0.720806003f, -0.0319969989f, 0.108099997f, 0.866699994f, -0.508599997f, 0.289700001f, -0.810800016f,
+	-0.0961230025f, 0.717413008f, -0.0307759997f, 0.105899997f, 0.865700006f, -0.519400001f, 0.283600003f, -0.806100011f,
+	-0.0955160037f, 0.67375201f, 0.0556100011f, 0.104699999f, 0.984499991f, 0.0826999992f, 0.445499986f, 0.891499996f,
+	-0.0911260024f, 0.66939199f, 0.0573850013f, 0.102200001f, 0.985899985f, 0.0829999968f, 0.446399987f, 0.890999973f,
+	-0.0881839991f, 0.671259999f, 0.056175001f, 0.101199999f, 0.984499991f, 0.0828000009f, 0.445800006f, 0.891300023f,
+	-0.0910440013f, 0.67485702f, 0.0546449982f, 0.103f, 0.983200014f, 0.0824000016f, 0.444799989f, 0.891799986f,
+	0.151224002f, 0.444330007f, 0.0575640015f, 0.48120001f, 0.665000021f, 0.909099996f, 0.352600008f, 0.222000003f,
+	0.148812994f, 0.444175005f, 0.0357090011f, 0.485000014f, 0.656599998f, 0.917699993f, 0.192599997f, -0.34740001f,
+	0.127875f, 0.517229021f, 0.0280809999f, 0.518299997f, 0.665499985f, 0.943499982f, 0.329400003f, -0.0370000005f,
+	0.120775998f, 0.517292023f, 0.048165001f, 0.515799999f, 0.674899995f, 0.696799994f, 0.395700008f, 0.598200023f,
+	0.141286999f, 0.447093993f, 0.0714529976f, 0.481099993f, 0.672399998f, 0.604200006f, 0.381399989f, 0.699599981f,
+	0.0789410025f, 0.563069999f, 0.0531730019f, 0.537400007f, 0.693199992f, 0.744099975f, 0.2192f, 0.631099999f,
+	0.0868709981f, 0.517229021f, 0.0655860007f, 0.515799999f, 0.692200005f, 0.720700026f, 0.302700013f, 0.623700023f,
+	0.100547999f, 0.447423995f, 0.0846619979f, 0.482600003f, 0.691299975f, 0.612399995f, 0.317799985f, 0.723800004f,
+	0.0791039988f, 0.517229021f, 0.0906959996f, 0.513100028f, 0.703700006f, 0.754299998f, 0.278899997f, 0.594299972f,
+	0.0877010003f, 0.44372499f, 0.109351002f, 0.478700012f, 0.703100026f, 0.724699974f, 0.290399998f, 0.624899983f,
+	0.126715004f, 0.686048985f, -0.0831520036f, 0.159400001f, 0.471199989f, 0.508300006f, -0.3046f, -0.805499971f,
+	0.127670005f, 0.67910099f, -0.0798629969f, 0.162599996f, 0.469900012f, 0.506900012f, -0.31099999f, -0.803900003f,
+	0.0970159993f, 0.688009977f, -0.102637999f, 0.159299999f, 0.487300009f, 0.548300028f, -0.224399999f, -0.805599988f,
+	0.0973180011f, 0.69353199f, -0.103933997f, 0.1567f, 0.487699986f, 0.556500018f, -0.215900004f, -0.802299976f,
+	0.077996999f, 0.688628972f, -0.116865002f, 0.159400001f, 0.498100013f, 0.59799999f, -0.169599995f, -0.783399999f,
+	0.07773f, 0.694410026f, -0.118384004f, 0.1567f, 0.498699993f, 0.5977f, -0.177900001f, -0.781700015f,
+	0.0634360015f, 0.689020991f, -0.128603995f, 0.159400001f, 0.506600022f, 0.624800026f, -0.0732000023f, -0.777400017f,
+	0.0599320009f, 0.681351006f, -0.130858004f, 0.163000003f, 0.508300006f, 0.625699997f, -0.0571999997f, -0.777999997f,
+	0.0944719985f, 0.674674988f, 0.0562219992f, 0.217600003f, 0.793200016f, 0.818899989f, 0.573599994f, 0.0182000007f,
+	0.0936570019f, 0.676162004f, 0.0515529998f, 0.218099996f, 0.791000009f, 0.82130003f, 0.569199979f, 0.0377999991f,
+	0.0873640031f, 0.682563007f, 0.0549860001f, 0.222399995f, 0.792100012f, 0.649100006f, 0.7597f, 0.0397999994f,
+	0.0870990008f, 0.682523012f, 0.0614139996f, 0.222800002f, 0.795000017f, 0.568499982f, 0.821799994f, 0.0379000008f,
+	0.0978259966f, 0.66780901f, 0.0487239994f, 0.213799998f, 0.790300012f, 0.964600027f, 0.2403f, -0.108499996f,
+	0.0987680033f, 0.666961014f, 0.0546230003f, 0.213599995f, 0.792999983f, 0.975199997f, 0.206400007f, -0.0803999975f,
+	0.0796660036f, 0.686500013f, 0.058995001f, 0.226500005f, 0.793500006f, 0.457399994f, 0.887600005f, 0.0535999984f,
+	0.0779590011f, 0.686878026f, 0.0655369982f, 0.227500007f, 0.796400011f, 0.453599989f, 0.888700008f, 0.0670000017f,
+	0.0975579992f, 0.656843007f, 0.048308f, 0.208800003f, 0.790400028f, 0.91900003f, -0.39320001f, 0.0296f,
+	0.0972760022f, 0.657420993f, 0.0552840009f, 0.209199995f, 0.793500006f, 0.888700008f, -0.451000005f, 0.0822999999f,
+	0.0899650007f, 0.648873985f, 0.0514959991f, 0.203999996f, 0.792299986f, 0.652499974f, -0.735899985f, 0.180500001f,
+	0.0914369971f, 0.651677012f, 0.0578280017f, 0.205699995f, 0.795000017f, 0.649999976f, -0.739199996f, 0.176200002f,
+	0.0806759968f, 0.645300984f, 0.0616590008f, 0.200299993f, 0.797599971f, 0.587599993f, -0.763199985f, 0.268700004f,
+	0.0827779993f, 0.644716978f, 0.056127999f, 0.200599998f, 0.7949f, 0.617999971f, -0.722000003f, 0.311100006f,
+	-0.0395569988f, 0.626561999f, -0.0524890013f, 0.935500026f, 0.829699993f, -0.780900002f, 0.542200029f, -0.310200006f,
+	-0.0434949994f, 0.621722996f, -0.0510330014f, 0.938399971f, 0.829699993f, -0.780900002f, 0.542200029f, -0.310200006f,
+	-0.040817f, 0.62666899f, -0.0491309986f, 0.936200023f, 0.831200004f, -0.780900002f, 0.542200029f, -0.310200006f,
+	-0.0184920002f, 0.371746987f, 0.0801839978f, 0.441799998f, 0.913100004f, 0.700699985f, -0.0250000004f, 0.713f,
+	-0.0194710009f, 0.351577014f, 0.0811749995f, 0.450899988f, 0.912199974f, 0.6778f, 0.00319999992f, 0.735199988f,
+	-0.00520099979f, 0.354321986f, 0.0570699982f, 0.450100005f, 0.924899995f, 0.961600006f, -0.146300003f, 0.2324f,
+	-0.00140199997f, 0.372373015f, 0.0539860018f, 0.442000002f, 0.927200019f, 0.971899986f, -0.177599996f, 0.154100001f,
+	-0.0430239998f, 0.353525013f, 0.0934460014f, 0.449600011f, 0.900200009f, -0.0266999993f, -0.0403000005f, 0.99879998f,
+	-0.0430460013f, 0.370757014f, 0.0944650024f, 0.441799998f, 0.900200009f, -0.00650000013f, -0.0590999983f, 0.998199999f,
+	-0.0109200003f, 0.352088988f, 0.029414f, 0.453200012f, 0.937300026f, 0.95630002f, -0.230399996f, -0.180199996f,
+	-0.00719100004f, 0.370020002f, 0.0263749994f, 0.445100009f, 0.939700007f, 0.95630002f, -0.229499996f, -0.180999994f,
+	-0.0671759993f, 0.369049013f, 0.0785629973f, 0.442900002f, 0.887099981f, -0.770500004f, -0.0811000019f, 0.632200003f,
+	-0.0651360005f, 0.352629989f, 0.0791099966f, 0.450300008f, 0.888199985f, -0.756600022f, -0.0724000037f, 0.649800003f,
+	-0.0778459981f, 0.367823005f, 0.0534510016f, 0.444299996f, 0.874800026f, -0.978699982f, -0.168500006f, 0.117299996f,
+	-0.0752020031f, 0.352185994f, 0.0546130016f, 0.451400012f, 0.876299977f, -0.977900028f, -0.149499997f, 0.145999998f,
+	-0.0743089989f, 0.367220998f, 0.0259610005f, 0.446500003f, 0.862500012f, -0.961199999f, -0.2491f, -0.118199997f,
+	-0.0715650022f, 0.355343997f, 0.0286740009f, 0.451799989f, 0.864300013f, -0.965200007f, -0.226500005f, -0.130600005f,
+	0.0184920002f, 0.371746987f, 0.0801839978f, 0.370599985f, 0.54610002f, -0.700699985f, -0.0250000004f, 0.713f,
+	0.00140199997f, 0.372373015f, 0.0539860018f, 0.370400012f, 0.531899989f, -0.971899986f, -0.177599996f, 0.154100001f,
+	0.00520099979f, 0.354321986f, 0.0570699982f, 0.362300009f, 0.534300029f, -0.961600006f, -0.146300003f, 0.2324f,
+	0.0194710009f, 0.351577014f, 0.0811749995f, 0.361499995f, 0.546999991f, -0.6778f, 0.00319999992f, 0.735199988f,
+	0.0430239998f, 0.353525013f, 0.0934460014f, 0.362800002f, 0.559000015f, 0.0266999993f, -0.0403000005f, 0.99879998f,
+	0.0430460013f, 0.370757014f, 0.0944650024f, 0.370599985f, 0.559000015f, 0.00650000013f, -0.0590999983f, 0.998199999f,
+	0.00719100004f, 0.370020002f, 0.0263749994f, 0.367300004f, 0.519500017f, -0.95630002f, -0.229499996f, -0.180999994f,
+	0.0109200003f, 0.352088988f, 0.029414f, 0.359299988f, 0.521799982f, -0.95630002f, -0.230399996f, -0.180199996f,
+	0.0651360005f, 0.352629989f, 0.0791099966f, 0.362100005f, 0.570900023f, 0.756600022f, -0.0724000037f, 0.649800003f,
+	0.0671759993f, 0.369049013f, 0.0785629973f, 0.369500011f, 0.572000027f, 0.770500004f, -0.0811000019f, 0.632200003f,
+	0.0752020031f, 0.352185994f, 0.0546130016f, 0.361000001f, 0.582899988f, 0.977900028f, -0.149499997f, 0.145999998f,
+	0.0778459981f, 0.367823005f, 0.0534510016f, 0.368099988f, 0.584299982f, 0.978699982f, -0.168500006f, 0.117299996f,
+	0.0715650022f, 0.355343997f, 0.0286740009f, 0.360599995f, 0.594799995f, 0.965200007f, -0.226500005f, -0.130600005f,
+	0.0743089989f, 0.367220998f, 0.0259610005f, 0.36590001f, 0.596700013f, 0.961199999f, -0.2491f, -0.118199997f,
+	-0.0252880007f, 0.671956003f, -0.0664009973f, 0.63440001f, 0.57980001f, -0.45629999f, -0.127000004f, -0.880699992f,
+	-0.0336150005f, 0.677021027f, -0.0631330013f, 0.632600009f, 0.584100008f, -0.360100001f, 0.117399998f, -0.925499976f,
+	-0.0325249992f, 0.680666029f, -0.0630950034f, 0.630900025f, 0.583800018f, -0.385699987f, 0.0854000002f, -0.91869998f,
+	-0.0243759993f, 0.678017974f, -0.0670799986f, 0.631600022f, 0.579599977f, -0.483200014f, -0.0252f, -0.875100017f,
+	-0.0210570004f, 0.674328029f, -0.0691599995f, 0.633000016f, 0.577600002f, -0.528999984f, -0.0658999979f, -0.846099973f,
+	-0.0286630001f, 0.665840983f, -0.0631000027f, 0.637499988f, 0.581499994f, -0.599699974f, -0.170200005f, -0.781899989f,
+	-0.0493309982f, 0.679121017f, -0.0556129999f, 0.632399976f, 0.592000008f, -0.537500024f, 0.0228000004f, -0.842899978f,
+	-0.049761001f, 0.683485985f, -0.0552540012f, 0.630500019f, 0.592499971f, -0.572000027f, 0.0136000002f, -0.820200026f,
+	-0.0726590008f, 0.679159999f, -0.0338729993f, 0.63380003f, 0.606400013f, -0.807200015f, -0.00700000022f, -0.590200007f,
+	-0.0734779984f, 0.683903992f, -0.0328220017f, 0.631699979f, 0.607200027f, -0.851499975f, -0.0311999992f, -0.523400009f,
+	-0.0851399973f, 0.683691025f, -0.00240599993f, 0.633400023f, 0.621900022f, -0.9921f, 0.0163000003f, -0.124700002f,
+	-0.0851740018f, 0.679777026f, -0.00263800006f, 0.635100007f, 0.621599972f, -0.989499986f, 0.0171000008f, -0.143700004f,
+	-0.0821850002f, 0.67937398f, 0.0241199993f, 0.636500001f, 0.63380003f, -0.932399988f, 0.129700005f, 0.337399989f,
+	-0.0818379968f, 0.683758974f, 0.0233319998f, 0.634500027f, 0.633599997f, -0.944999993f, 0.123899996f, 0.302599996f,
+	-0.0667610019f, 0.679527998f, 0.0502969995f, 0.637000024f, 0.647499979f, -0.753400028f, 0.0167999994f, 0.657299995f,
+	-0.0664400011f, 0.683588982f, 0.0506010018f, 0.635200024f, 0.647800028f, -0.734099984f, 0.00710000005f, 0.67900002f,
+	-0.0412809998f, 0.679675996f, 0.0685909986f, 0.637499988f, 0.661800027f, -0.448500007f, 0.00719999988f, 0.89380002f,
+	-0.0412960015f, 0.683435023f, 0.0685710013f, 0.635800004f, 0.661800027f, -0.449000001f, 0.00230000005f, 0.89349997f,
+	-0.0192389991f, 0.683377028f, 0.0755589977f, 0.636200011f, 0.672299981f, -0.204500005f, 0.0790000036f, 0.975700021f,
+	-0.0192200001f, 0.679700017f, 0.0758949965f, 0.637899995f, 0.672299981f, -0.200599998f, 0.0882000029f, 0.975700021f,
+	0.0f, 0.679131985f, 0.0777039975f, 0.638199985f, 0.681100011f, -0.000500000024f, 0.0270000007f, 0.999599993f,
+	0.0f, 0.684001982f, 0.077572003f, 0.635999978f, 0.681100011f, -0.00150000001f, 0.0272000004f, 0.999599993f,
+	0.0192510001f, 0.683407009f, 0.0756160021f, 0.636200011f, 0.689800024f, 0.207499996f, -0.0410999991f, 0.977400005f,
+	0.0191270001f, 0.680094004f, 0.0754730031f, 0.637700021f, 0.689800024f, 0.2051f, -0.0496999994f, 0.977500021f,
+	0.0412819982f, 0.679673016f, 0.0685930029f, 0.638000011f, 0.700299978f, 0.449499995f, 0.000899999985f, 0.893299997f,
+	0.0412960015f, 0.683435023f, 0.0685719997f, 0.636300027f, 0.700299978f, 0.450399995f, 0.0110999998f, 0.892799973f,
+	0.0667589977f, 0.679530025f, 0.0502960011f, 0.638199985f, 0.71450001f, 0.734000027f, 0.217099994f, 0.64349997f,
+	0.0658319965f, 0.683180988f, 0.0500519983f, 0.636500001f, 0.714299977f, 0.714600027f, 0.225700006f, 0.662100017f,
+	0.0818379968f, 0.683758974f, 0.0233319998f, 0.63499999f, 0.728299975f, 0.944800019f, 0.132699996f, 0.299699992f,
+	0.0821890011f, 0.679370999f, 0.0241209995f, 0.637000024f, 0.728299975f, 0.932799995f, 0.132400006f, 0.335200012f,
+	0.0849940032f, 0.683619022f, -0.00238800002f, 0.633300006f, 0.74000001f, 0.988900006f, 0.0714000016f, -0.130400002f,
+	0.0852259994f, 0.679724991f, -0.00264400011f, 0.635100007f, 0.7403f, 0.986500025f, 0.0684999973f, -0.149100006f,
+	0.0722270012f, 0.679678023f, -0.0335870013f, 0.632300019f, 0.755299985f, 0.794499993f, 0.187900007f, -0.577400029f,
+	0.0724020004f, 0.683224976f, -0.0321010016f, 0.630900025f, 0.754400015f, 0.842999995f, 0.171900004f, -0.5097f,
+	0.0493369997f, 0.679112017f, -0.0556199998f, 0.628799975f, 0.769299984f, 0.546899974f, 0.00680000009f, -0.837199986f,
+	0.0497939996f, 0.683522999f, -0.0553079993f, 0.626900017f, 0.76849997f, 0.582099974f, 0.00810000021f, -0.81309998f,
+	0.0325819999f, 0.68076098f, -0.063267f, 0.625899971f, 0.777199984f, 0.394499987f, 0.0504000001f, -0.917500019f,
+	0.033617001f, 0.677017987f, -0.0631359965f, 0.627699971f, 0.777199984f, 0.377200007f, 0.0719000027f, -0.923300028f,
+	0.0253139995f, 0.671953022f, -0.0664220005f, 0.628799975f, 0.781700015f, 0.341399997f, -0.198699996f, -0.91869998f,
+	0.0243759993f, 0.678017974f, -0.0670809969f, 0.625999987f, 0.781499982f, 0.433699995f, -0.0307f, -0.9005f,
+	-0.119719997f, 0.70795399f, -0.0882840008f, 0.181899995f, 0.270399988f, -0.405400008f, -0.294800013f, -0.8653f,
+	-0.121134996f, 0.715094984f, -0.0901279971f, 0.178800002f, 0.268999994f, -0.398200005f, -0.302599996f, -0.865999997f,
+	-0.095464997f, 0.732155025f, -0.107890002f, 0.178000003f, 0.252999991f, -0.4551f, -0.259900004f, -0.851700008f,
+	-0.0904520005f, 0.728811026f, -0.109581999f, 0.180500001f, 0.251599997f, -0.472200006f, -0.263000011f, -0.841300011f,
+	-0.0602920018f, 0.741832972f, -0.131288007f, 0.182099998f, 0.233799994f, -0.561600029f, -0.0732000023f, -0.824199975f,
+	-0.0537620001f, 0.735822976f, -0.135330006f, 0.186100006f, 0.231800005f, -0.565500021f, -0.0612000003f, -0.82249999f,
+	-0.105989002f, 0.517355025f, -0.0104959998f, 0.553499997f, 0.830200016f, -0.955600023f, 0.253800005f, 0.149700001f,
+	-0.128739998f, 0.44916299f, -0.000988999964f, 0.524800003f, 0.845700026f, -0.909099996f, 0.352800012f, 0.221399993f,
+	-0.129087001f, 0.446662992f, 0.0146359997f, 0.519900024f, 0.841099977f, -0.859899998f, 0.202000007f, -0.468800008f,
+	-0.113273002f, 0.518106997f, -0.0276260003f, 0.558099985f, 0.837300003f, -0.933099985f, 0.3125f, -0.178200006f,
+	-0.133932993f, 0.457098991f, -0.0127119999f, 0.530399978f, 0.848999977f, -0.84009999f, 0.379299998f, 0.387699991f,
+	-0.111718997f, 0.466834009f, -0.0528649986f, 0.548099995f, 0.861299992f, -0.344999999f, 0.245100006f, -0.906000018f,
+	-0.128916994f, 0.464913011f, -0.0369389988f, 0.539900005f, 0.855199993f, -0.868499994f, 0.321500003f, -0.377299994f,
+	-0.0183300003f, 0.821973026f, -0.0638850033f, 0.444799989f, 0.244100004f, 0.135100007f, 0.218500003f, -0.966400027f,
+	-0.026935f, 0.82534802f, -0.064538002f, 0.447699994f, 0.241099998f, 0.177300006f, 0.278699994f, -0.943899989f,
+	-0.0290290006f, 0.778268993f, -0.0684330016f, 0.42840001f, 0.231700003f, -0.0108000003f, 0.0208999999f, -0.99970001f,
+	-0.0359110013f, 0.784107029f, -0.068204999f, 0.432099998f, 0.229900002f, -0.0205000006f, 0.0417000018f, -0.998899996f,
+	-0.0337200016f, 0.766076028f, -0.0680560023f, 0.424199998f, 0.227500007f, -0.166299999f, -0.0397999994f, -0.985300004f,
+	-0.0501470007f, 0.751406014f, -0.0642260015f, 0.421200007f, 0.217899993f, -0.147100002f, -0.0923999995f, -0.984799981f,
+	-0.0444680005f, 0.741358995f, -0.0639109984f, 0.416000009f, 0.2183f, -0.134299994f, -0.106799997f, -0.985199988f,
+	-0.0895719975f, 0.676898003f, 0.0552939996f, 0.227500007f, 0.975799978f, -0.520099998f, 0.00549999997f, 0.854099989f,
+	-0.0910440013f, 0.67485702f, 0.0546449982f, 0.227699995f, 0.976999998f, -0.439799994f, 0.0320000015f, 0.897499979f,
+	-0.0881839991f, 0.671259999f, 0.056175001f, 0.225700006f, 0.977800012f, -0.576799989f, -0.0142999999f, 0.816799998f,
+	-0.0860510021f, 0.673691988f, 0.0579940006f, 0.225099996f, 0.976300001f, -0.626800001f, -0.0326000005f, 0.778500021f,
+	-0.00603599986f, 0.242853999f, -0.000645999971f, 0.360399991f, 0.808099985f, 0.620599985f, -0.591000021f, -0.515299976f,
+	-0.0117499996f, 0.251967996f, -0.020451f, 0.360100001f, 0.818300009f, 0.748199999f, -0.324699998f, -0.578599989f,
+	-0.00788099971f, 0.255804002f, -0.0177200008f, 0.357499987f, 0.817399979f, 0.730700016f, -0.42809999f, -0.531799972f,
+	0.000315999991f, 0.250741005f, -0.00303300004f, 0.35589999f, 0.809499979f, 0.5722f, -0.622500002f, -0.533999979f,
+	-0.0214569997f, 0.256866008f, -0.0338610001f, 0.361900002f, 0.825900018f, 0.706799984f, -0.128000006f, -0.69569999f,
+	-0.0212609991f, 0.262124002f, -0.034616001f, 0.359899998f, 0.827300012f, 0.664699972f, -0.141399994f, -0.73360002f,
+	-0.0445559993f, 0.259599f, -0.0511210002f, 0.367700011f, 0.837700009f, 0.579100013f, -0.157199994f, -0.799899995f,
+	-0.0443050005f, 0.268182993f, -0.0526250005f, 0.364499986f, 0.839999974f, 0.580200016f, -0.154599994f, -0.799700022f,
+	0.00603599986f, 0.242853999f, -0.000645999971f, 0.410400003f, 0.550100029f, -0.620599985f, -0.591000021f, -0.515299976f,
+	-0.000315999991f, 0.250741005f, -0.00303300004f, 0.414900005f, 0.548699975f, -0.5722f, -0.622500002f, -0.533999979f,
+	0.00788099971f, 0.255804002f, -0.0177200008f, 0.413399994f, 0.540899992f, -0.730700016f, -0.42809999f, -0.531799972f,
+	0.0117499996f, 0.251967996f, -0.020451f, 0.41080001f, 0.539900005f, -0.748199999f, -0.324699998f, -0.578599989f,
+	0.0212609991f, 0.262124002f, -0.034616001f, 0.4111f, 0.531000018f, -0.664699972f, -0.141399994f, -0.73360002f,
+	0.0214569997f, 0.256866008f, -0.0338610001f, 0.409099996f, 0.532299995f, -0.706799984f, -0.128000006f, -0.69569999f,
+	0.0443050005f, 0.268182993f, -0.0526250005f, 0.406500012f, 0.51819998f, -0.580200016f, -0.154599994f, -0.799700022f,
+	0.0445559993f, 0.259599f, -0.0511210002f, 0.403299987f, 0.520600021f, -0.579100013f, -0.157199994f, -0.799899995f,
+	-0.0263459999f, 0.425496995f, -0.0273620002f, 0.453299999f, 0.967100024f, 0.194700003f, -0.741100013f, -0.6426f,
+	-0.0425480008f, 0.428377002f, -0.0366489999f, 0.449200004f, 0.974600017f, 0.276600003f, -0.668900013f, -0.689999998f,
+	-0.0425309986f, 0.434123993f, -0.0422139987f, 0.445600003f, 0.9745f, 0.241500005f, -0.701399982f, -0.670599997f,
+	-0.0204959996f, 0.431713998f, -0.0331769995f, 0.449499995f, 0.964399993f, 0.176100001f, -0.755699992f, -0.630800009f,
+	0.0263459999f, 0.425496995f, -0.0273620002f, 0.264999986f, 0.515200019f, -0.194700003f, -0.741100013f, -0.6426f,
+	0.0204959996f, 0.431713998f, -0.0331769995f, 0.261200011f, 0.512499988f, -0.176100001f, -0.755699992f, -0.630800009f,
+	0.0425309986f, 0.434123993f, -0.0422139987f, 0.257299989f, 0.522599995f, -0.241500005f, -0.701399982f, -0.670599997f,
+	0.0425480008f, 0.428377002f, -0.0366489999f, 0.261000007f, 0.522700012f, -0.276600003f, -0.668900013f, -0.689999998f,
+	-0.00371400011f, 0.378616989f, 0.0540070012f, 0.2588f, 0.547999978f, -0.968800008f, -0.151299998f, 0.196400002f,
+	-0.0101089999f, 0.416846007f, 0.0493110009f, 0.276300013f, 0.545799971f, -0.958700001f, -0.129199997f, 0.253600001f,
+	-0.00682500005f, 0.409381002f, 0.0200520009f, 0.272700012f, 0.532500029f, -0.923799992f, -0.270099998f, -0.271299988f,
+	0.0038350001f, 0.37659201f, 0.0216090009f, 0.257099986f, 0.532999992f, -0.922200024f, -0.310699999f, -0.230299994f,
+	0.00875599962f, 0.424252987f, 0.0812899992f, 0.278699994f, 0.562699974f, -0.691100001f, -0.00620000018f, 0.7227f,
+	0.0114160003f, 0.379978001f, 0.0845519975f, 0.258599997f, 0.563499987f, -0.709500015f, 0.0129000004f, 0.70450002f,
+	-0.000730000029f, 0.39785701f, 0.0160709992f, 0.266900003f, 0.530399978f, -0.849099994f, -0.298500001f, -0.435799986f,
+	0.000762999989f, 0.41109401f, 0.0037130001f, 0.272399992f, 0.524299979f, -0.851800025f, -0.302899987f, -0.427300006f,
+	0.0431249999f, 0.427688003f, 0.0992190018f, 0.279399991f, 0.580299973f, 0.0126f, 0.0421999991f, 0.999000013f,
+	0.0430880003f, 0.380618006f, 0.101767004f, 0.258100003f, 0.57980001f, 0.0337999985f, 0.0540000014f, 0.998000026f,
+	0.0729319975f, 0.378538013f, 0.0834779963f, 0.257200003f, 0.595700026f, 0.742200017f, -0.00190000003f, 0.670099974f,
+	0.076173f, 0.422533005f, 0.0805680007f, 0.277200013f, 0.597500026f, 0.720300019f, -0.0176999997f, 0.693400025f,
+	0.0866030008f, 0.375532001f, 0.0531769991f, 0.255800009f, 0.610700011f, 0.979700029f, -0.122299999f, 0.158999994f,
+	0.092102997f, 0.416711986f, 0.0489609987f, 0.274500012f, 0.613600016f, 0.976100028f, -0.111199997f, 0.186800003f,
+	0.0803719983f, 0.375667006f, 0.0219209995f, 0.254799992f, 0.625100017f, 0.956900001f, -0.216900006f, -0.193299994f,
+	0.088330999f, 0.413450003f, 0.0189319998f, 0.272199988f, 0.627099991f, 0.941699982f, -0.144299999f, -0.304100007f,
+	0.084220998f, 0.399650007f, 0.0144020002f, 0.265599996f, 0.629000008f, 0.932900012f, -0.174400002f, -0.315100014f,
+	0.0781069994f, 0.413724989f, 0.00312600005f, 0.271200001f, 0.635599971f, 0.837000012f, -0.0710999966f, -0.542599976f,
+	0.00371400011f, 0.378616989f, 0.0540070012f, 0.273499995f, 0.854799986f, 0.968800008f, -0.151299998f, 0.196400002f,
+	-0.0038350001f, 0.37659201f, 0.0216090009f, 0.275299996f, 0.869799972f, 0.922200024f, -0.310699999f, -0.230299994f,
+	0.00682500005f, 0.409381002f, 0.0200520009f, 0.2597f, 0.870400012f, 0.923799992f, -0.270099998f, -0.271299988f,
+	0.0101089999f, 0.416846007f, 0.0493110009f, 0.256000012f, 0.85710001f, 0.958700001f, -0.129199997f, 0.253600001f,
+	-0.00875599962f, 0.424252987f, 0.0812899992f, 0.253600001f, 0.840200007f, 0.691100001f, -0.00620000018f, 0.7227f,
+	-0.0114160003f, 0.379978001f, 0.0845519975f, 0.273699999f, 0.839399993f, 0.709500015f, 0.0129000004f, 0.70450002f,
+	0.000730000029f, 0.39785701f, 0.0160709992f, 0.265500009f, 0.872399986f, 0.849099994f, -0.298500001f, -0.435799986f,
+	-0.000762999989f, 0.41109401f, 0.0037130001f, 0.259900004f, 0.878499985f, 0.851800025f, -0.302899987f, -0.427300006f,
+	-0.0431249999f, 0.427688003f, 0.0992190018f, 0.252900004f, 0.82249999f, -0.0126f, 0.0421999991f, 0.999000013f,
+	-0.0430880003f, 0.380618006f, 0.101767004f, 0.274199992f, 0.823000014f, -0.0337999985f, 0.0540000014f, 0.998000026f,
+	-0.0729319975f, 0.378538013f, 0.0834779963f, 0.275099993f, 0.807200015f, -0.742200017f, -0.00190000003f, 0.670099974f,
+	-0.076173f, 0.422533005f, 0.0805680007f, 0.255100012f, 0.805299997f, -0.720300019f, -0.0176999997f, 0.693400025f,
+	-0.0866030008f, 0.375532001f, 0.0531769991f, 0.2764f, 0.792100012f, -0.979700029f, -0.122299999f, 0.158999994f,
+	-0.092102997f, 0.416711986f, 0.0489609987f, 0.257699996f, 0.789300025f, -0.976100028f, -0.111199997f, 0.186800003f,
+	-0.088330999f, 0.413450003f, 0.0189319998f, 0.260100007f, 0.775699973f, -0.941699982f, -0.144299999f, -0.304100007f,
+	-0.0803719983f, 0.375667006f, 0.0219209995f, 0.277500004f, 0.777700007f, -0.956900001f, -0.216900006f, -0.193299994f,
+	-0.084220998f, 0.399650007f, 0.0144020002f, 0.2667f, 0.773800015f, -0.932900012f, -0.174400002f, -0.315100014f,
+	-0.0781069994f, 0.413724989f, 0.00312600005f, 0.261099994f, 0.767199993f, -0.837000012f, -0.0710999966f, -0.542599976f,
+	-0.0495820008f, 0.71024102f, -0.0552459992f, 0.947399974f, 0.758899987f, -0.578800023f, -0.0860000029f, -0.810899973f,
+	-0.0339009985f, 0.713074028f, -0.0637539998f, 0.947300017f, 0.7676f, -0.399899989f, -0.0644999966f, -0.914300025f,
+	-0.0327280015f, 0.708392978f, -0.0638879985f, 0.944999993f, 0.767700016f, -0.405800015f, -0.0732999966f, -0.911000013f,
+	-0.0488119982f, 0.705293f, -0.0552829988f, 0.944999993f, 0.758899987f, -0.5722f, -0.0764999986f, -0.816600025f,
+	-0.0726549998f, 0.709793985f, -0.033578001f, 0.948400021f, 0.743600011f, -0.819899976f, 0.0271000005f, -0.57190001f,
+	-0.025254f, 0.712117016f, -0.0668499991f, 0.945900023f, 0.771799982f, -0.295899987f, 0.00109999999f, -0.955200016f,
+	-0.025378f, 0.717599988f, -0.0668070018f, 0.948499978f, 0.772199988f, -0.227699995f, 0.00240000011f, -0.973699987f,
+	-0.0163620003f, 0.724250972f, -0.0683329999f, 0.950900018f, 0.777100027f, -0.138699993f, 0.0756999999f, -0.987399995f,
+	-0.0168159995f, 0.717795014f, -0.0688240007f, 0.947799981f, 0.77640003f, -0.226199999f, 0.101899996f, -0.968699992f,
+	-0.0f, 0.728576005f, -0.0694179982f, 0.952099979f, 0.785000026f, 0.0176999997f, 0.217800006f, -0.975799978f,
+	-0.0f, 0.724121988f, -0.0707049966f, 0.949899971f, 0.785000026f, 0.0260000005f, 0.277399987f, -0.960399985f,
+	0.0165819991f, 0.717685997f, -0.0679389983f, 0.947899997f, 0.793500006f, 0.113899998f, -0.0198999997f, -0.993300021f,
+	0.0162969995f, 0.724147022f, -0.0682319999f, 0.950999975f, 0.792900026f, 0.0908999965f, -0.0333000012f, -0.995299995f,
+	0.0252359994f, 0.712186992f, -0.066662997f, 0.946200013f, 0.798200011f, 0.292299986f, 0.0267999992f, -0.95599997f,
+	0.0250739995f, 0.717298985f, -0.0664639995f, 0.948499978f, 0.797599971f, 0.266799986f, 0.0458000004f, -0.962700009f,
+	0.0337399989f, 0.712885976f, -0.0635600016f, 0.94749999f, 0.802399993f, 0.399399996f, -0.0148f, -0.916700006f,
+	0.0327269994f, 0.708392978f, -0.0638870001f, 0.945200026f, 0.802299976f, 0.405400008f, -0.0275999997f, -0.913699985f,
+	0.0495820008f, 0.71024102f, -0.0552459992f, 0.947899997f, 0.811100006f, 0.576799989f, -0.0850000009f, -0.8125f,
+	0.0488030016f, 0.705303013f, -0.0552689992f, 0.945500016f, 0.811100006f, 0.569999993f, -0.0886000022f, -0.816900015f,
+	0.0728320032f, 0.709994018f, -0.0336989984f, 0.949599981f, 0.826300025f, 0.816999972f, -0.1611f, -0.55369997f,
+	0.0721819997f, 0.705597997f, -0.0333570018f, 0.94749999f, 0.826200008f, 0.813399971f, -0.158000007f, -0.559800029f,
+	0.0845730007f, 0.710223973f, -0.00432599988f, 0.946799994f, 0.841000021f, 0.981999993f, 0.00800000038f, -0.188899994f,
+	0.0847989991f, 0.706040978f, -0.00347399991f, 0.946500003f, 0.841799974f, 0.9921f, 0.0274f, -0.1228f,
+	0.0823599994f, 0.708997011f, 0.0216470007f, 0.956399977f, 0.834299982f, 0.960500002f, 0.108800001f, 0.256000012f,
+	0.0824220031f, 0.705377996f, 0.0229349993f, 0.958000004f, 0.834699988f, 0.930599988f, 0.138300002f, 0.338800013f,
+	0.0659089983f, 0.709771991f, 0.0500649996f, 0.958500028f, 0.819000006f, 0.710900009f, 0.187999994f, 0.677699983f,
+	0.0669649988f, 0.705781996f, 0.0500719994f, 0.960399985f, 0.819599986f, 0.741100013f, 0.196600005f, 0.64200002f,
+	0.0411209986f, 0.708989978f, 0.0676610023f, 0.960300028f, 0.804499984f, 0.461499989f, 0.138699993f, 0.87620002f,
+	0.0412589982f, 0.705174029f, 0.0681890026f, 0.962100029f, 0.804499984f, 0.450199991f, 0.116400003f, 0.885299981f,
+	0.0188929997f, 0.70875901f, 0.0758059993f, 0.960300028f, 0.793200016f, 0.186800003f, -0.155900002f, 0.970000029f,
+	0.0192930009f, 0.703328013f, 0.0747689977f, 0.962899983f, 0.793500006f, 0.201100007f, -0.156299993f, 0.967000008f,
+	0.0f, 0.708567977f, 0.0773790032f, 0.960500002f, 0.784099996f, -0.00150000001f, -0.0105999997f, 0.999899983f,
+	0.0f, 0.704342008f, 0.0774340034f, 0.962499976f, 0.784099996f, 0.0f, 0.0131000001f, 0.999899983f,
+	-0.0187589992f, 0.708127022f, 0.0751660019f, 0.960699975f, 0.774999976f, -0.194299996f, -0.0467999987f, 0.979799986f,
+	-0.0192930009f, 0.703328013f, 0.0747689977f, 0.963f, 0.774800003f, -0.206400007f, -0.0522000007f, 0.977100015f,
+	-0.0413639992f, 0.705096006f, 0.0683950037f, 0.963f, 0.763700008f, -0.434100002f, 0.177499995f, 0.88319999f,
+	-0.0411209986f, 0.708989978f, 0.0676610023f, 0.961099982f, 0.763700008f, -0.446200013f, 0.191699997f, 0.874199986f,
+	-0.066990003f, 0.705771983f, 0.050094001f, 0.960900009f, 0.748700023f, -0.739899993f, 0.205899999f, 0.640500009f,
+	-0.0659079999f, 0.709771991f, 0.0500649996f, 0.958999991f, 0.749300003f, -0.710099995f, 0.195199996f, 0.676500022f,
+	-0.0824220031f, 0.705377996f, 0.0229349993f, 0.958599985f, 0.733500004f, -0.930599988f, 0.138600007f, 0.338800013f,
+	-0.0823599994f, 0.708997011f, 0.0216470007f, 0.957099974f, 0.734000027f, -0.960500002f, 0.108800001f, 0.256000012f,
+	-0.0847989991f, 0.706040978f, -0.00347399991f, 0.94630003f, 0.727900028f, -0.992999971f, 0.0291000009f, -0.1149f,
+	-0.0845730007f, 0.710223973f, -0.00432599988f, 0.946699977f, 0.728799999f, -0.983799994f, 0.0194000006f, -0.178299993f,
+	-0.0727360025f, 0.705272019f, -0.0337300003f, 0.946200013f, 0.743700027f, -0.815699995f, 0.0315999985f, -0.577600002f,
+	0.0626650006f, 0.431818008f, -0.0313040018f, 0.441300005f, 0.652700007f, -0.0555999987f, -0.62470001f, -0.778900027f,
+	0.0751470029f, 0.405533999f, -0.00971799996f, 0.438600004f, 0.668799996f, 0.100299999f, -0.606999993f, -0.788299978f,
+	0.068843998f, 0.400974005f, -0.00700799981f, 0.441799998f, 0.670700014f, 0.105800003f, -0.597000003f, -0.79519999f,
+	0.0572559983f, 0.426160008f, -0.0260489993f, 0.444400012f, 0.655600011f, -0.0942000002f, -0.627600014f, -0.772800028f,
+	0.0819270015f, 0.391957015f, 0.00179500005f, 0.437000006f, 0.677299976f, 0.183599994f, -0.537299991f, -0.823199987f,
+	0.075048998f, 0.38786301f, 0.0025549999f, 0.440499991f, 0.67839998f, 0.210700005f, -0.50910002f, -0.834500015f,
+	-0.0626650006f, 0.431818008f, -0.0313040018f, 0.353799999f, 0.782299995f, 0.0555999987f, -0.62470001f, -0.778900027f,
+	-0.0572559983f, 0.426160008f, -0.0260489993f, 0.350800008f, 0.779299974f, 0.0942000002f, -0.627600014f, -0.772800028f,
+	-0.068843998f, 0.400974005f, -0.00700799981f, 0.353199989f, 0.764299989f, -0.105800003f, -0.597000003f, -0.79519999f,
+	-0.0751470029f, 0.405533999f, -0.00971799996f, 0.3565f, 0.766099989f, -0.100299999f, -0.606999993f, -0.788299978f,
+	-0.0819270015f, 0.391957015f, 0.00179500005f, 0.35800001f, 0.757600009f, -0.183599994f, -0.537299991f, -0.823199987f,
+	-0.075048998f, 0.38786301f, 0.0025549999f, 0.354499996f, 0.756500006f, -0.210700005f, -0.50910002f, -0.834500015f,
+	-0.000666000007f, 0.390469998f, -0.000348000001f, 0.467000008f, 0.541599989f, -0.0860999972f, -0.557200015f, -0.825900018f,
+	0.00663000019f, 0.405418992f, -0.0120599996f, 0.466399997f, 0.532400012f, 0.000500000024f, -0.620999992f, -0.783800006f,
+	0.0137630003f, 0.404413015f, -0.0112579996f, 0.463200003f, 0.532000005f, -0.00179999997f, -0.617600024f, -0.786499977f,
+	0.00485899998f, 0.388823986f, -9.99999975e-06f, 0.464399993f, 0.541499972f, -0.109800003f, -0.539600015f, -0.834699988f,
+	0.0204959996f, 0.431713998f, -0.0331769995f, 0.465000004f, 0.515900016f, 0.0681999996f, -0.634800017f, -0.769699991f,
+	0.0263459999f, 0.425496995f, -0.0273620002f, 0.461299986f, 0.51880002f, 0.0855000019f, -0.636500001f, -0.766499996f,
+	0.000666000007f, 0.390469998f, -0.000348000001f, 0.458000004f, 0.801900029f, 0.0860999972f, -0.557200015f, -0.825900018f,
+	-0.00485899998f, 0.388823986f, -9.99999975e-06f, 0.460599989f, 0.801999986f, 0.109800003f, -0.539600015f, -0.834699988f,
+	-0.0137630003f, 0.404413015f, -0.0112579996f, 0.461800009f, 0.811500013f, 0.00179999997f, -0.617600024f, -0.786499977f,
+	-0.00663000019f, 0.405418992f, -0.0120599996f, 0.458600014f, 0.811100006f, -0.000500000024f, -0.620999992f, -0.783800006f,
+	-0.0204959996f, 0.431713998f, -0.0331769995f, 0.460000008f, 0.827600002f, -0.0681999996f, -0.634800017f, -0.769699991f,
+	-0.0263459999f, 0.425496995f, -0.0273620002f, 0.463699996f, 0.824699998f, -0.0855000019f, -0.636500001f, -0.766499996f,
+	0.0509589985f, 0.689091027f, -0.137250006f, 0.1338f, 0.563199997f, 0.602199972f, -0.314399987f, -0.733799994f,
+	0.0516720004f, 0.684704006f, -0.134574994f, 0.131600007f, 0.562399983f, 0.613799989f, -0.335799992f, -0.71450001f,
+	0.0418150015f, 0.680595994f, -0.141112998f, 0.1338f, 0.557200015f, 0.583999991f, -0.282499999f, -0.760999978f,
+	0.0447829999f, 0.686058998f, -0.140615001f, 0.134900004f, 0.559899986f, 0.549000025f, -0.224800006f, -0.805000007f,
+	-0.102532998f, 0.723322988f, -0.0204869993f, 0.207699999f, 0.942099988f, -0.567600012f, 0.0353000015f, -0.822600007f,
+	-0.0970479995f, 0.718715012f, -0.0244689994f, 0.203999996f, 0.942099988f, -0.567600012f, 0.0353000015f, -0.822600007f,
+	-0.0990469977f, 0.714682996f, -0.023263f, 0.203799993f, 0.939999998f, -0.567600012f, 0.0353000015f, -0.822600007f,
+	-0.104080997f, 0.871083021f, -0.001452f, 0.194999993f, 0.502399981f, -0.943700016f, 0.203199998f, -0.261099994f,
+	-0.105039999f, 0.883938015f, 0.0162090007f, 0.203400001f, 0.507700026f, -0.958999991f, 0.242599994f, -0.146699995f,
+	-0.102665998f, 0.890742004f, 0.0119420001f, 0.2016f, 0.510999978f, -0.957599998f, 0.239700004f, -0.159799993f,
+	-0.101407997f, 0.877683997f, -0.0054990002f, 0.193200007f, 0.505599976f, -0.939499974f, 0.219099998f, -0.263200015f,
+	-0.101033002f, 0.86263603f, -0.0170910005f, 0.1875f, 0.4991f, -0.95599997f, 0.101099998f, -0.2755f,
+	-0.103396997f, 0.860346973f, -0.00946400035f, 0.191f, 0.497799993f, -0.958599985f, 0.100500003f, -0.266499996f,
+	-0.105630003f, 0.891496003f, 0.0432600006f, 0.215900004f, 0.510299981f, -0.960099995f, 0.279399991f, 0.00889999978f,
+	-0.103606001f, 0.89851898f, 0.0419239998f, 0.215499997f, 0.513599992f, -0.962800026f, 0.269600004f, -0.0172000006f,
+	-0.105425999f, 0.882984996f, 0.0715259984f, 0.228400007f, 0.505699992f, -0.9648f, 0.2227f, 0.140100002f,
+	-0.103505999f, 0.890208006f, 0.0734589994f, 0.229599997f, 0.509000003f, -0.966099977f, 0.225600004f, 0.125699997f,
+	-0.104503997f, 0.871680021f, 0.0876609981f, 0.235400006f, 0.500100017f, -0.945900023f, 0.161500007f, 0.281500012f,
+	-0.102467f, 0.876583993f, 0.0916350037f, 0.237499997f, 0.502200007f, -0.9454f, 0.173500001f, 0.275900006f,
+	-0.103182003f, 0.848702013f, 0.099183999f, 0.239700004f, 0.489300013f, -0.896799982f, -0.00439999998f, 0.442499995f,
+	-0.100244001f, 0.852523029f, 0.105136f, 0.242799997f, 0.490799993f, -0.909500003f, 0.0397000015f, 0.413899988f,
+	-0.100262001f, 0.810083985f, 0.0968869999f, 0.237299994f, 0.471899986f, -0.907599986f, -0.220799997f, 0.35710001f,
+	-0.0976750031f, 0.810276985f, 0.103707999f, 0.240600005f, 0.471599996f, -0.917800009f, -0.171700001f, 0.358099997f,
+	-0.0989430025f, 0.792406976f, 0.0836799964f, 0.230700001f, 0.46450001f, -0.841899991f, -0.472900003f, 0.260100007f,
+	-0.0954359993f, 0.788223028f, 0.0873050019f, 0.2324f, 0.462099999f, -0.847599983f, -0.456800014f, 0.269899994f,
+	-0.0978429988f, 0.782151997f, 0.0492679998f, 0.214900002f, 0.460599989f, -0.921599984f, -0.387499988f, 0.0225000009f,
+	-0.095145002f, 0.775554001f, 0.0490589999f, 0.214599997f, 0.457399994f, -0.924600005f, -0.380800009f, 0.0131999999f,
+	-0.0982469991f, 0.791172981f, 0.0126400003f, 0.198599994f, 0.465799987f, -0.920799971f, -0.358999997f, -0.152400002f,
+	-0.095693998f, 0.786453009f, 0.00841300003f, 0.196500003f, 0.463499993f, -0.922100008f, -0.347799987f, -0.169799998f,
+	-0.099545002f, 0.807690024f, -0.00440400001f, 0.191400006f, 0.473800004f, -0.926299989f, -0.271100014f, -0.261799991f,
+	-0.0967750028f, 0.803045988f, -0.0093790004f, 0.188899994f, 0.471700013f, -0.929499984f, -0.273499995f, -0.247299999f,
+	-0.1008f, 0.824102998f, -0.0139640002f, 0.187700003f, 0.481599987f, -0.957400024f, -0.155200005f, -0.243599996f,
+	-0.0986860022f, 0.820915997f, -0.0205189995f, 0.184499994f, 0.480300009f, -0.959200025f, -0.166299999f, -0.228599995f,
+	-0.102307998f, 0.846008003f, -0.0161550008f, 0.1875f, 0.491600007f, -0.962300003f, -0.00850000046f, -0.271800011f,
+	-0.100341998f, 0.845546007f, -0.0230989996f, 0.184200004f, 0.491600007f, -0.962100029f, -0.0282000005f, -0.271100014f,
+	0.101406999f, 0.877683997f, -0.0054990002f, 0.257699996f, 0.455199987f, 0.934099972f, 0.224099994f, -0.27790001f,
+	0.104006f, 0.874439001f, 9.69999965e-05f, 0.26030001f, 0.456900001f, 0.924099982f, 0.264299989f, -0.275900006f,
+	0.103074998f, 0.859629989f, -0.0114120003f, 0.254900008f, 0.463400006f, 0.949999988f, 0.1162f, -0.289700001f,
+	0.101031996f, 0.86263603f, -0.0170910005f, 0.252200007f, 0.461899996f, 0.953999996f, 0.112800002f, -0.27790001f,
+	0.102665f, 0.890742004f, 0.0119420001f, 0.265899986f, 0.449499995f, 0.958899975f, 0.231700003f, -0.164000005f,
+	0.105039999f, 0.883938015f, 0.0162090007f, 0.267800003f, 0.452800006f, 0.956499994f, 0.246999994f, -0.155200005f,
+	0.102307998f, 0.846008003f, -0.0161550008f, 0.252499998f, 0.469500005f, 0.961099982f, -0.00939999986f, -0.27610001f,
+	0.100341998f, 0.845546007f, -0.0230989996f, 0.249200001f, 0.469599992f, 0.962300003f, -0.0277999993f, -0.270500004f,
+	0.1008f, 0.824102998f, -0.0139640002f, 0.252999991f, 0.479499996f, 0.960200012f, -0.140499994f, -0.241500005f,
+	0.0986860022f, 0.820915997f, -0.0205189995f, 0.249799997f, 0.48089999f, 0.95660001f, -0.159400001f, -0.243799999f,
+	0.099545002f, 0.807690024f, -0.00440400001f, 0.256900012f, 0.487100005f, 0.92930001f, -0.278100014f, -0.243000001f,
+	0.0967739969f, 0.803045988f, -0.0093790004f, 0.254400015f, 0.489300013f, 0.925700009f, -0.287299991f, -0.246199995f,
+	0.0982460007f, 0.791172981f, 0.0126400003f, 0.264400005f, 0.494899988f, 0.919499993f, -0.362800002f, -0.151199996f,
+	0.095693998f, 0.786453009f, 0.00841300003f, 0.262300014f, 0.497200012f, 0.923099995f, -0.346100003f, -0.167600006f,
+	0.0978429988f, 0.782151997f, 0.0492679998f, 0.280800015f, 0.49939999f, 0.925000012f, -0.379999995f, 0.000300000014f,
+	0.095145002f, 0.775554001f, 0.0490589999f, 0.280699998f, 0.502699971f, 0.921199977f, -0.389099985f, -0.000199999995f,
+	0.0989430025f, 0.792406976f, 0.0836799964f, 0.296499997f, 0.495000005f, 0.847100019f, -0.451200008f, 0.280800015f,
+	0.0954359993f, 0.788223028f, 0.0873050019f, 0.298200011f, 0.497399986f, 0.845399976f, -0.450100005f, 0.287499994f,
+	0.100262001f, 0.810083985f, 0.0968869999f, 0.302899987f, 0.487399995f, 0.902999997f, -0.242699996f, 0.354400009f,
+	0.0976739973f, 0.810276985f, 0.103707999f, 0.306199998f, 0.487599999f, 0.913399994f, -0.187399998f, 0.361200005f,
+	0.103182003f, 0.848702013f, 0.099183999f, 0.3046f, 0.469900012f, 0.903199971f, 0.0130000003f, 0.42899999f,
+	0.100243002f, 0.852523029f, 0.105136f, 0.307700008f, 0.468400002f, 0.909600019f, 0.0504000001f, 0.412400007f,
+	0.104503997f, 0.871680021f, 0.0876609981f, 0.300000012f, 0.459300011f, 0.943899989f, 0.163499996f, 0.287f,
+	0.102467f, 0.876583993f, 0.0916350037f, 0.301999986f, 0.457100004f, 0.947399974f, 0.169300005f, 0.271600008f,
+	0.105425999f, 0.882984996f, 0.0715259984f, 0.292899996f, 0.453900009f, 0.964299977f, 0.218999997f, 0.148800001f,
+	0.103505999f, 0.890208006f, 0.0734589994f, 0.293900013f, 0.450599998f, 0.964999974f, 0.225299999f, 0.1338f,
+	0.105628997f, 0.891496003f, 0.0432600006f, 0.280200005f, 0.449800014f, 0.961899996f, 0.273400009f, 0.00200000009f,
+	0.103606001f, 0.89851898f, 0.0419239998f, 0.279599994f, 0.446399987f, 0.961300015f, 0.274699986f, -0.0197999999f,
+	0.0749540031f, 0.621002972f, -0.0535969995f, 0.221200004f, 0.814700007f, 0.436199993f, 0.0461000018f, -0.898699999f,
+	0.0705809966f, 0.645530999f, -0.0522379987f, 0.215700001f, 0.824599981f, 0.263799995f, 0.0863000005f, -0.960699975f,
+	0.0806759968f, 0.645300984f, -0.0495730005f, 0.212099999f, 0.82160002f, 0.275400013f, 0.120300002f, -0.953800023f,
+	0.0842289999f, 0.611166f, -0.0490359999f, 0.220100001f, 0.808300018f, 0.470800012f, 0.0351000018f, -0.881500006f,
+	0.0847690031f, 0.654980004f, -0.0479970016f, 0.207800001f, 0.823800027f, 0.284799993f, -0.0773999989f, -0.95539999f,
+	0.0914369971f, 0.651677012f, -0.0457409993f, 0.206200004f, 0.82069999f, 0.350100011f, -0.0671000034f, -0.934300005f,
+	0.0890019983f, 0.660327971f, -0.0477170013f, 0.204799995f, 0.824699998f, 0.383399993f, -0.104500003f, -0.917699993f,
+	0.0972760022f, 0.657420993f, -0.0431980006f, 0.202299997f, 0.82099998f, 0.456099987f, -0.0795999989f, -0.886300027f,
+	0.0987560004f, 0.665507019f, -0.0432059988f, 0.199599996f, 0.823499978f, 0.454699993f, -0.0841000006f, -0.886600018f,
+	0.0149950003f, 0.654218018f, 0.0735599995f, 0.578800023f, 0.726899981f, 0.0692000017f, 0.0500999987f, 0.996299982f,
+	0.0151819997f, 0.685473025f, 0.0723169968f, 0.592800021f, 0.725199997f, 0.122900002f, 0.0720999986f, 0.989799976f,
+	-0.0207690001f, 0.685988009f, 0.0712699965f, 0.595399976f, 0.7403f, -0.204099998f, 0.0401000008f, 0.978100002f,
+	-0.0914459974f, 0.879984975f, 0.0208480004f, 0.207800001f, 0.629800022f, -0.389899999f, -0.853900015f, 0.344799995f,
+	-0.105039999f, 0.883938015f, 0.0162090007f, 0.203899994f, 0.635299981f, -0.401199996f, -0.837100029f, 0.372000009f,
+	-0.104080997f, 0.871083021f, -0.001452f, 0.1954f, 0.628799975f, -0.456800014f, -0.651199996f, 0.606000006f,
+	-0.0893469974f, 0.860207021f, -0.00125700003f, 0.198200002f, 0.621100008f, -0.497399986f, -0.446399987f, 0.743799984f,
+	-0.0942780003f, 0.885115981f, 0.0465000011f, 0.218500003f, 0.633700013f, -0.477100015f, -0.87559998f, -0.0747999996f,
+	-0.105630003f, 0.891496003f, 0.0432600006f, 0.216800004f, 0.639500022f, -0.494100004f, -0.869199991f, 0.0196000002f,
+	-0.0938059986f, 0.870814025f, 0.0786269978f, 0.233400002f, 0.629199982f, -0.560899973f, -0.625500023f, -0.542400002f,
+	-0.105425999f, 0.882984996f, 0.0715259984f, 0.230700001f, 0.636900008f, -0.531400025f, -0.768000007f, -0.357600003f,
+	-0.104503997f, 0.871680021f, 0.0876609981f, 0.238999993f, 0.631900012f, -0.5722f, -0.528699994f, -0.626900017f,
+	-0.0921130031f, 0.844959021f, 0.0930619985f, 0.240099996f, 0.618399978f, -0.522300005f, -0.182400003f, -0.833000004f,
+	-0.103182003f, 0.848702013f, 0.099183999f, 0.245399997f, 0.620999992f, -0.543900013f, -0.2456f, -0.802399993f,
+	-0.0890600011f, 0.819302022f, 0.0908970013f, 0.238499999f, 0.607299984f, -0.5625f, 0.156599998f, -0.811800003f,
+	-0.100262001f, 0.810083985f, 0.0968869999f, 0.243900001f, 0.602599978f, -0.591499984f, 0.262199998f, -0.762499988f,
+	-0.0874599963f, 0.79794699f, 0.077496998f, 0.232800007f, 0.598200023f, -0.58950001f, 0.661199987f, -0.464100003f,
+	-0.0989430025f, 0.792406976f, 0.0836799964f, 0.237399995f, 0.593800008f, -0.580600023f, 0.636099994f, -0.50819999f,
+	-0.0978429988f, 0.782151997f, 0.0492679998f, 0.221300006f, 0.588f, -0.587000012f, 0.809599996f, -0.000300000014f,
+	-0.085796997f, 0.790866971f, 0.05229f, 0.222000003f, 0.594799995f, -0.567200005f, 0.821200013f, -0.0632999986f,
+	-0.0982469991f, 0.791172981f, 0.0126400003f, 0.203500003f, 0.590499997f, -0.602100015f, 0.680599988f, 0.417499989f,
+	-0.0861240029f, 0.797698021f, 0.0191479996f, 0.207300007f, 0.596300006f, -0.586099982f, 0.727699995f, 0.356400013f,
+	-0.099545002f, 0.807690024f, -0.00440400001f, 0.194100007f, 0.597299993f, -0.587400019f, 0.488299996f, 0.645399988f,
+	-0.090402998f, 0.816197991f, -0.00244399998f, 0.196500003f, 0.602400005f, -0.61589998f, 0.362100005f, 0.699699998f,
+	-0.1008f, 0.824102998f, -0.0139640002f, 0.189300001f, 0.605300009f, -0.698199987f, 0.112099998f, 0.707000017f,
+	-0.102307998f, 0.846008003f, -0.0161550008f, 0.188199997f, 0.615999997f, -0.6796f, -0.175999999f, 0.712199986f,
+	-0.0890590027f, 0.840744019f, -0.00537799997f, 0.195800006f, 0.612999976f, -0.604799986f, -0.0432000011f, 0.79519999f,
+	-0.103396997f, 0.860346973f, -0.00946400035f, 0.191300005f, 0.623300016f, -0.521700025f, -0.399800003f, 0.753700018f,
+	-0.0317890011f, 0.766843975f, -0.0663489997f, 0.350499988f, 0.414600015f, -0.233700007f, 0.0947000012f, -0.967700005f,
+	-0.027524f, 0.77620101f, -0.0660180002f, 0.3486f, 0.418900013f, -0.223800004f, 0.136199996f, -0.96509999f,
+	-0.0f, 0.759781003f, -0.0747160017f, 0.335599989f, 0.411300004f, -0.260899991f, -0.0313999988f, -0.9648f,
+	-0.0f, 0.74536097f, -0.0738070011f, 0.335700005f, 0.404799998f, -0.266600013f, -0.0606000014f, -0.961899996f,
+	-0.0f, 0.74536097f, -0.0738070011f, 0.348699987f, 0.475800008f, 0.292299986f, -0.0194000006f, -0.956099987f,
+	-0.0f, 0.759781003f, -0.0747160017f, 0.348500013f, 0.4824f, 0.332800001f, -0.0593000017f, -0.941100001f,
+	0.027524f, 0.77620101f, -0.0660180002f, 0.335099995f, 0.489300013f, 0.195700005f, 0.0724000037f, -0.977999985f,
+	0.031787999f, 0.766843975f, -0.0663489997f, 0.333400011f, 0.485000014f, 0.158099994f, 0.106799997f, -0.981599987f,
+	0.131610006f, 0.539537013f, -0.0127560003f, 0.124300003f, 0.921700001f, 0.639599979f, 0.751299977f, -0.162300006f,
+	0.126491994f, 0.543636024f, -0.0173870008f, 0.122400001f, 0.91869998f, 0.600600004f, 0.796899974f, -0.0643000007f,
+	0.134339005f, 0.53927201f, -0.00506399991f, 0.127800003f, 0.922900021f, 0.414400011f, 0.906199992f, -0.0842000023f,
+	0.137382001f, 0.537485003f, -0.0109970002f, 0.125200003f, 0.924499989f, 0.374799997f, 0.923099995f, -0.0857999995f,
+	0.130449995f, 0.540444016f, -0.0246009994f, 0.119000003f, 0.920899987f, 0.554400027f, 0.829900026f, -0.0631000027f,
+	0.112419002f, 0.549600005f, -0.0427929983f, 0.111000001f, 0.91140002f, 0.552100003f, 0.82160002f, -0.141900003f,
+	0.111249f, 0.551163018f, -0.0374570005f, 0.113499999f, 0.910700023f, 0.555000007f, 0.823199987f, -0.119499996f,
+	0.0969280005f, 0.559099019f, -0.047766f, 0.109099999f, 0.903100014f, 0.567099988f, 0.764800012f, -0.305599988f,
+	0.0963660032f, 0.556657016f, -0.0541669987f, 0.105999999f, 0.903400004f, 0.568400025f, 0.750800014f, -0.336400002f,
+	0.146274f, 0.535014987f, 0.00604300015f, 0.1329f, 0.928600013f, 0.328000009f, 0.944700003f, 0.00120000006f,
+	0.139160007f, 0.537371993f, 0.00604300015f, 0.1329f, 0.925199986f, 0.331699997f, 0.943199992f, 0.0206000004f,
+	0.135355994f, 0.538411975f, 0.0284490008f, 0.143099993f, 0.923300028f, 0.474099994f, 0.879199982f, 0.0463999994f,
+	0.129833996f, 0.541858971f, 0.0229199994f, 0.140499994f, 0.920400023f, 0.496199995f, 0.866699994f, 0.0516000018f,
+	0.112419002f, 0.549600005f, 0.0548800007f, 0.154799998f, 0.911499977f, 0.55339998f, 0.821200013f, 0.139300004f,
+	0.111249f, 0.551163018f, 0.0495430008f, 0.152400002f, 0.910700023f, 0.56129998f, 0.819299996f, 0.116999999f,
+	0.0969280005f, 0.559099019f, 0.0598529987f, 0.156900004f, 0.903199971f, 0.567099988f, 0.764800012f, 0.305599988f,
+	0.0963660032f, 0.556657016f, 0.0662539974f, 0.159899995f, 0.903500021f, 0.568400025f, 0.750800014f, 0.336400002f,
+	-0.0121320002f, 0.275638014f, 0.0268300008f, 0.440699995f, 0.783699989f, 0.842999995f, -0.0504000001f, 0.535600007f,
+	-0.0097719999f, 0.259712011f, 0.0185829997f, 0.441799998f, 0.791899979f, 0.79400003f, -0.292199999f, 0.533100009f,
+	-0.00532299979f, 0.265563011f, 0.015164f, 0.438300014f, 0.791000009f, 0.798600018f, -0.244399995f, 0.550000012f,
+	-0.00819199998f, 0.279983014f, 0.0197640005f, 0.4366f, 0.784200013f, 0.869300008f, 0.0153999999f, 0.494100004f,
+	-0.00603599986f, 0.242853999f, -0.000645999971f, 0.440100014f, 0.80339998f, 0.742799997f, -0.398099989f, 0.538299978f,
+	0.000315999991f, 0.250741005f, -0.00303300004f, 0.435699999f, 0.801699996f, 0.720499992f, -0.411300004f, 0.558300018f,
+	0.0121320002f, 0.275638014f, 0.0268300008f, 0.442499995f, 0.545700014f, -0.842999995f, -0.0504000001f, 0.535600007f,
+	0.00819199998f, 0.279983014f, 0.0197640005f, 0.44659999f, 0.545300007f, -0.869300008f, 0.0153999999f, 0.494100004f,
+	0.00532299979f, 0.265563011f, 0.015164f, 0.445100009f, 0.538500011f, -0.798600018f, -0.244399995f, 0.550000012f,
+	0.0097719999f, 0.259712011f, 0.0185829997f, 0.441500008f, 0.537599981f, -0.79400003f, -0.292199999f, 0.533100009f,
+	0.00603599986f, 0.242853999f, -0.000645999971f, 0.443500012f, 0.526000023f, -0.742799997f, -0.398099989f, 0.538299978f,
+	-0.000315999991f, 0.250741005f, -0.00303300004f, 0.44780001f, 0.527899981f, -0.720499992f, -0.411300004f, 0.558300018f,
+	0.092730999f, 0.884657979f, 0.041627001f, 0.211999997f, 0.526199996f, 0.994000018f, -0.0965000018f, -0.0505000018f,
+	0.0929540023f, 0.878866971f, 0.0663210005f, 0.223399997f, 0.528100014f, 0.993600011f, -0.112599999f, -0.00749999983f,
+	0.0890939981f, 0.846338987f, 0.0432729982f, 0.2139f, 0.543500006f, 0.998000026f, -0.063000001f, -0.0f,
+	0.0904079974f, 0.877986014f, 0.0176059995f, 0.201399997f, 0.529999971f, 0.995199978f, -0.0834000036f, -0.0518000014f,
+	0.0911609977f, 0.866136014f, 0.0807840005f, 0.230299994f, 0.533399999f, 0.994799972f, -0.1017f, -0.00109999999f,
+	0.0890140012f, 0.838108003f, 0.0898770019f, 0.235200003f, 0.545899987f, 0.997699976f, -0.066399999f, -0.0118000004f,
+	0.0871749967f, 0.815984011f, 0.0397650003f, 0.213200003f, 0.557399988f, 0.997900009f, -0.0537f, 0.0353000015f,
+	0.089011997f, 0.866227984f, 0.00385199999f, 0.195500001f, 0.535700023f, 1.0f, 0.0027999999f, -0.000600000028f,
+	0.0905800015f, 0.844870985f, -0.00790499989f, 0.190799996f, 0.545700014f, 0.999199986f, 0.0281000007f, 0.0282000005f,
+	0.0906289965f, 0.818122983f, -0.00369399996f, 0.193399996f, 0.557600021f, 0.998099983f, -0.0164999999f, 0.0599000007f,
+	0.0874309987f, 0.809781015f, 0.0866219997f, 0.234599993f, 0.558799982f, 0.998700023f, -0.0489999987f, -0.0127999997f,
+	0.0860600024f, 0.790462971f, 0.0414259993f, 0.214699998f, 0.568899989f, 0.998899996f, -0.0318999998f, 0.0355999991f,
+	0.0890600011f, 0.796733975f, 0.0157340001f, 0.202900007f, 0.566799998f, 0.99119997f, 0.0416000001f, 0.1259f,
+	0.0868330002f, 0.797634006f, 0.0760480016f, 0.230199993f, 0.564599991f, 0.999199986f, -0.0362999998f, -0.0148f,
+	0.01664f, 0.901744008f, -0.0444520004f, 0.168699995f, 0.662800014f, 0.912f, 0.156599998f, -0.379200011f,
+	0.0136700002f, 0.921651006f, -0.0437990017f, 0.177499995f, 0.660300016f, 0.979600012f, 0.141499996f, 0.142700002f,
+	0.0129699996f, 0.924311996f, -0.0420419984f, 0.178900003f, 0.660700023f, 0.83069998f, 0.104099996f, -0.546899974f,
+	0.0154400002f, 0.922834992f, -0.0401230007f, 0.178399995f, 0.662199974f, 0.668900013f, 0.182699993f, -0.720499992f,
+	0.0149729997f, 0.905485988f, -0.0469859987f, 0.170000002f, 0.661000013f, 0.916999996f, 0.150600001f, -0.369300008f,
+	0.0179350004f, 0.885589004f, -0.0480379984f, 0.161200002f, 0.663299978f, 0.970399976f, 0.154300004f, -0.185699999f,
+	0.0150520001f, 0.930729985f, -0.0385369994f, 0.182099998f, 0.662f, 0.915799975f, 0.0318000019f, -0.400400013f,
+	0.0132149998f, 0.927555978f, -0.0433249995f, 0.180299997f, 0.65990001f, 0.950999975f, -0.121699996f, -0.284200013f,
+	0.0138050001f, 0.932164013f, -0.0415909998f, 0.182500005f, 0.660399973f, 0.931400001f, 0.0414000005f, -0.361600012f,
+	0.0161979999f, 0.962503016f, -0.0301300008f, 0.196899995f, 0.663299978f, 0.926199973f, 0.0671000034f, -0.370999992f,
+	0.0146700004f, 0.965285003f, -0.033427f, 0.197899997f, 0.661499977f, 0.925700009f, 0.0675999969f, -0.372099996f,
+	0.0180719998f, 0.880135f, -0.0521389991f, 0.158299997f, 0.662299991f, 0.972899973f, 0.153999999f, -0.172399998f,
+	0.0857859999f, 0.667083979f, -0.0448280014f, 0.160500005f, 0.823000014f, 0.213f, 0.145099998f, -0.966199994f,
+	0.0940970033f, 0.670837998f, -0.043722f, 0.156800002f, 0.824899971f, 0.201100007f, -0.160400003f, -0.966400027f,
+	0.0957610011f, 0.666691005f, -0.0426869988f, 0.1558f, 0.823000014f, 0.208700001f, -0.0276999995f, -0.977599978f,
+	0.0876659974f, 0.662384987f, -0.0456979983f, 0.159700006f, 0.820800006f, 0.212400004f, 0.259600013f, -0.942099988f,
+	0.0243759993f, 0.678017974f, -0.0670809969f, 0.933600008f, 0.730799973f, 0.739000022f, -0.399199992f, -0.542699993f,
+	0.0208700001f, 0.67445302f, -0.0686839968f, 0.935000002f, 0.728900015f, 0.690100014f, -0.41080001f, -0.595799983f,
+	0.0260540005f, 0.68542397f, -0.0702439994f, 0.934599996f, 0.734499991f, 0.896300018f, -0.114299998f, -0.428499997f,
+	0.0300980005f, 0.682982028f, -0.0606469996f, 0.929799974f, 0.733299971f, 0.894999981f, -0.0997999981f, -0.434700012f,
+	0.024007f, 0.705452025f, -0.0699160025f, 0.934700012f, 0.743600011f, 0.788100004f, 0.355199993f, -0.502799988f,
+	0.029228f, 0.706466019f, -0.0611840002f, 0.930100024f, 0.744000018f, 0.826900005f, 0.215599999f, -0.519400001f,
+	0.023356f, 0.71006602f, -0.064933002f, 0.933000028f, 0.746100008f, 0.632700026f, 0.570200026f, -0.524100006f,
+	0.0152580002f, 0.714667022f, -0.0691440031f, 0.936699986f, 0.749000013f, 0.558600008f, 0.263399988f, -0.786499977f,
+	0.0165819991f, 0.717685997f, -0.0679389983f, 0.935699999f, 0.750100017f, 0.509599984f, 0.116700001f, -0.852500021f,
+	0.00795300025f, 0.925500989f, -0.0447609983f, 0.1294f, 0.744400024f, -0.649100006f, 0.0847000033f, -0.755999982f,
+	0.0098679997f, 0.921154022f, -0.0465659983f, 0.127200007f, 0.745100021f, -0.643400013f, 0.103100002f, -0.75849998f,
+	0.00428099977f, 0.919748008f, -0.0423839986f, 0.127399996f, 0.74180001f, -0.623899996f, 0.0987000018f, -0.775300026f,
+	0.00402199989f, 0.927039027f, -0.0410359986f, 0.130700007f, 0.742200017f, -0.681200027f, 0.0851999968f, -0.727100015f,
+	0.0088320002f, 0.927682996f, -0.0453189984f, 0.1303f, 0.745100021f, -0.667599976f, 0.0454999991f, -0.743099988f,
+	0.00938300043f, 0.911463022f, -0.0490670018f, 0.122699998f, 0.744599998f, -0.764599979f, 0.158800006f, -0.624599993f,
+	0.00487100007f, 0.907604992f, -0.0445230007f, 0.121799998f, 0.741299987f, -0.735700011f, 0.124499999f, -0.665700018f,
+	0.0138590001f, 0.864067018f, -0.0617050007f, 0.100400001f, 0.744199991f, -0.766200006f, 0.0927999988f, -0.635900021f,
+	0.00831899978f, 0.861128986f, -0.0554190017f, 0.100199997f, 0.740199983f, -0.76789999f, 0.0917000026f, -0.633899987f,
+	0.00860800035f, 0.933458984f, -0.044941999f, 0.1329f, 0.745500028f, -0.710799992f, 0.105400003f, -0.6954f,
+	0.0038399999f, 0.931868017f, -0.0401399992f, 0.1329f, 0.742399991f, -0.724900007f, 0.122900002f, -0.6778f,
+	0.00885299966f, 0.972424984f, -0.0366149992f, 0.150800005f, 0.747500002f, -0.735800028f, 0.148399994f, -0.660700023f,
+	0.00389500009f, 0.972181022f, -0.0311299991f, 0.151600003f, 0.744199991f, -0.736899972f, 0.148399994f, -0.659500003f,
+	0.065076001f, 0.321904004f, 0.0187100004f, 0.379000008f, 0.651300013f, 0.74180001f, -0.0148999998f, -0.67049998f,
+	0.0660220012f, 0.297140002f, 0.0189260002f, 0.381700009f, 0.662199974f, 0.911199987f, 0.0311999992f, -0.41080001f,
+	0.061009001f, 0.297533989f, 0.00783399958f, 0.386999995f, 0.660600007f, 0.801199973f, 0.113499999f, -0.587599993f,
+	0.0415050015f, 0.352384001f, -0.0110630002f, 0.391200006f, 0.6329f, 0.656700015f, -0.211300001f, -0.72390002f,
+	0.0696080029f, 0.356667012f, 0.0115440004f, 0.375f, 0.635599971f, 0.615700006f, -0.261000007f, -0.743499994f,
+	0.040608f, 0.320780993f, -0.00738199987f, 0.394600004f, 0.646899998f, 0.717999995f, 0.0273000002f, -0.695500016f,
+	0.0418669991f, 0.30409199f, -0.00904100016f, 0.397000015f, 0.654100001f, 0.679700017f, 0.123199999f, -0.723100007f,
+	0.0425629988f, 0.396573991f, -0.0254720002f, 0.389099985f, 0.611999989f, 0.581099987f, -0.289799988f, -0.760500014f,
+	0.075048998f, 0.38786301f, 0.0025549999f, 0.371499985f, 0.621100008f, 0.573000014f, -0.307500005f, -0.7597f,
+	0.0572559983f, 0.426160008f, -0.0260489993f, 0.380400002f, 0.599799991f, 0.55430001f, -0.290499985f, -0.779999971f,
+	0.068843998f, 0.400974005f, -0.00700799981f, 0.374500006f, 0.613900006f, 0.582300007f, -0.288199991f, -0.760200024f,
+	0.0425480008f, 0.428377002f, -0.0366489999f, 0.388000011f, 0.596700013f, 0.533100009f, -0.280299991f, -0.798300028f,
+	-0.065076001f, 0.321904004f, 0.0187100004f, 0.413500011f, 0.889100015f, -0.74180001f, -0.0148999998f, -0.67049998f,
+	-0.061009001f, 0.297533989f, 0.00783399958f, 0.40959999f, 0.877499998f, -0.801199973f, 0.113499999f, -0.587599993f,
+	-0.0660220012f, 0.297140002f, 0.0189260002f, 0.415100008f, 0.877900004f, -0.911199987f, 0.0311999992f, -0.41080001f,
+	-0.0415050015f, 0.352384001f, -0.0110619999f, 0.395300001f, 0.901499987f, -0.656700015f, -0.211300001f, -0.72390002f,
+	-0.040608f, 0.320780993f, -0.00738199987f, 0.397399992f, 0.887300014f, -0.717999995f, 0.0273000002f, -0.695500016f,
+	-0.0696080029f, 0.356667012f, 0.0115440004f, 0.41139999f, 0.905099988f, -0.615700006f, -0.261000007f, -0.743499994f,
+	-0.0418669991f, 0.30409199f, -0.00904100016f, 0.397799999f, 0.879700005f, -0.679700017f, 0.123199999f, -0.723100007f,
+	-0.0425629988f, 0.396573991f, -0.0254720002f, 0.389400005f, 0.921800017f, -0.581099987f, -0.289799988f, -0.760500014f,
+	-0.075048998f, 0.38786301f, 0.0025549999f, 0.409200013f, 0.9199f, -0.573000014f, -0.307500005f, -0.7597f,
+	-0.0572559983f, 0.426160008f, -0.0260489993f, 0.393000007f, 0.93629998f, -0.55430001f, -0.290499985f, -0.779999971f,
+	-0.0425480008f, 0.428377002f, -0.0366489999f, 0.3847f, 0.93629998f, -0.533100009f, -0.280299991f, -0.798300028f,
+	-0.068843998f, 0.400974005f, -0.00700799981f, 0.403699994f, 0.925499976f, -0.582300007f, -0.288199991f, -0.760200024f,
+	-0.119592004f, 0.221926004f, 0.119323f, 0.651499987f, 0.470999986f, -0.843800008f, 0.277500004f, 0.459300011f,
+	-0.133292004f, 0.130592003f, 0.149325997f, 0.648599982f, 0.514900029f, -0.843800008f, 0.277500004f, 0.459300011f,
+	-0.115248002f, 0.214202002f, 0.131969005f, 0.646099985f, 0.475499988f, -0.843800008f, 0.277500004f, 0.459300011f,
+	-0.126503006f, 0.543739974f, -0.0301329996f, 0.149200007f, 0.945100009f, -0.400200009f, 0.916400015f, 0.00240000011f,
+	-0.138273001f, 0.538676977f, -0.0116839996f, 0.140900001f, 0.950800002f, -0.314399987f, 0.94749999f, 0.0577999987f,
+	-0.134598002f, 0.539502978f, -0.00515600014f, 0.137899995f, 0.949100018f, -0.323300004f, 0.944800019f, 0.0538999997f,
+	-0.120842002f, 0.546283007f, -0.0262620002f, 0.147499993f, 0.942200005f, -0.419499993f, 0.907700002f, -0.00999999978f,
+	-0.114698f, 0.548497975f, -0.0426170006f, 0.155000001f, 0.939400017f, -0.478199989f, 0.873199999f, -0.0939999968f,
+	-0.139119998f, 0.537335992f, 0.00604199991f, 0.132799998f, 0.951399982f, -0.307700008f, 0.951300025f, -0.0164999999f,
+	-0.146283001f, 0.535025001f, 0.00604300015f, 0.132799998f, 0.95480001f, -0.316300005f, 0.948700011f, -0.0027999999f,
+	-0.129834995f, 0.541858971f, 0.0229199994f, 0.125200003f, 0.946799994f, -0.376399994f, 0.925800025f, -0.0333999991f,
+	-0.135148004f, 0.539820015f, 0.0281109996f, 0.1228f, 0.949400008f, -0.397199988f, 0.917699993f, -0.0119000003f,
+	-0.111181997f, 0.551111996f, 0.0495029986f, 0.113200001f, 0.937300026f, -0.579100013f, 0.771700025f, 0.262699991f,
+	-0.113084003f, 0.547936976f, 0.0542789996f, 0.1109f, 0.938799977f, -0.582400024f, 0.764500022f, 0.276300013f,
+	-0.0962970033f, 0.556357026f, 0.0652059987f, 0.105999999f, 0.930299997f, -0.619400024f, 0.701300025f, 0.352899998f,
+	-0.0967039987f, 0.558975995f, 0.0597239994f, 0.1087f, 0.929799974f, -0.631900012f, 0.680000007f, 0.371899992f,
+	-0.111642003f, 0.550728023f, -0.0385870002f, 0.153200001f, 0.937699974f, -0.506099999f, 0.853900015f, -0.120999999f,
+	-0.0963649973f, 0.556657016f, -0.0541669987f, 0.160500005f, 0.930499971f, -0.587700009f, 0.755900025f, -0.288599998f,
+	-0.0969280005f, 0.559099019f, -0.047766f, 0.157399997f, 0.930000007f, -0.613399982f, 0.718400002f, -0.328099996f,
+	-0.0210570004f, 0.674328029f, -0.0691599995f, 0.926999986f, 0.746100008f, -0.764299989f, -0.404399991f, -0.502300024f,
+	-0.0243759993f, 0.678017974f, -0.0670799986f, 0.925000012f, 0.744700015f, -0.783800006f, -0.397799999f, -0.476900011f,
+	-0.0261369999f, 0.685397983f, -0.0703419968f, 0.925000012f, 0.740999997f, -0.902899981f, -0.123899996f, -0.411599994f,
+	-0.0301099997f, 0.682989001f, -0.0606620014f, 0.920700014f, 0.743399978f, -0.899100006f, -0.107799999f, -0.424299985f,
+	-0.0241989996f, 0.705543995f, -0.0701560006f, 0.922599971f, 0.73210001f, -0.818199992f, 0.3565f, -0.451099992f,
+	-0.0292339996f, 0.706462979f, -0.0611930005f, 0.917999983f, 0.733099997f, -0.838800013f, 0.227699995f, -0.494599998f,
+	-0.0158760007f, 0.715242982f, -0.0710590035f, 0.923300028f, 0.726300001f, -0.728900015f, 0.380899996f, -0.568899989f,
+	-0.0233580004f, 0.71006602f, -0.0649380013f, 0.920099974f, 0.730199993f, -0.694299996f, 0.574400008f, -0.433600008f,
+	-0.0168159995f, 0.717795014f, -0.0688240007f, 0.921899974f, 0.725600004f, -0.718100011f, 0.289799988f, -0.632700026f,
+	-0.0086319996f, 0.93334502f, -0.0455790013f, 0.135399997f, 0.634000003f, 0.763100028f, 0.108199999f, -0.637099981f,
+	-0.0038399999f, 0.931868017f, -0.0401399992f, 0.135600001f, 0.637300014f, 0.75880003f, 0.105400003f, -0.642700016f,
+	-0.00540099991f, 0.907302022f, -0.0443640016f, 0.124300003f, 0.638300002f, 0.761900008f, 0.0661000013f, -0.644299984f,
+	-0.00938300043f, 0.911463022f, -0.0490670018f, 0.125400007f, 0.635200024f, 0.789300025f, 0.0653000027f, -0.610499978f,
+	-0.00885299966f, 0.972424984f, -0.0366149992f, 0.153500006f, 0.632300019f, 0.739600003f, 0.148499995f, -0.656400025f,
+	-0.00389500009f, 0.972181022f, -0.0311299991f, 0.154200003f, 0.635599971f, 0.736899972f, 0.148399994f, -0.659500003f,
+	-0.00791900046f, 0.905834019f, -0.0476760007f, 0.123199999f, 0.636699975f, 0.807900012f, -0.0632999986f, -0.585900009f,
+	-0.00526400004f, 0.901063979f, -0.0456160009f, 0.1215f, 0.638700008f, 0.683300018f, 0.166299999f, -0.711000025f,
+	-0.00980199967f, 0.902072012f, -0.0495150015f, 0.121200003f, 0.635999978f, 0.684499979f, 0.182999998f, -0.70569998f,
+	-0.010861f, 0.897421002f, -0.0520960018f, 0.118900001f, 0.635500014f, 0.700800002f, 0.159799993f, -0.695299983f,
+	-0.0138590001f, 0.864067018f, -0.0617050007f, 0.103100002f, 0.635599971f, 0.762700021f, 0.100599997f, -0.638899982f,
+	-0.00831899978f, 0.861128986f, -0.0554190017f, 0.102799997f, 0.639599979f, 0.768700004f, 0.0964000002f, -0.632399976f,
+	-0.0367190018f, 0.814215004f, -0.140313998f, 0.186000004f, 0.296600014f, 0.31310001f, 0.576399982f, 0.754800022f,
+	-0.0511859991f, 0.810029984f, -0.131969005f, 0.179700002f, 0.292100012f, 0.120700002f, 0.787699997f, 0.604200006f,
+	-0.049922999f, 0.808959007f, -0.130824998f, 0.180299997f, 0.291399986f, 0.152700007f, 0.75910002f, 0.632799983f,
+	-0.0344530009f, 0.810434997f, -0.138524994f, 0.187299997f, 0.2949f, 0.326799989f, 0.557200015f, 0.763400018f,
+	-0.0652289987f, 0.685087025f, 0.0490179993f, 0.656300008f, 0.665300012f, -0.740499973f, 0.0419000015f, 0.670700014f,
+	-0.0403800011f, 0.685171008f, 0.0668160021f, 0.656599998f, 0.679099977f, -0.449600011f, 0.0353000015f, 0.892499983f,
+	-0.0401760004f, 0.702607989f, 0.0662290007f, 0.648699999f, 0.67930001f, -0.451200008f, 0.0386000015f, 0.891600013f,
+	-0.0644780025f, 0.702775002f, 0.0487480015f, 0.648299992f, 0.665700018f, -0.738499999f, 0.0417000018f, 0.672999978f,
+	-0.0801509991f, 0.702993989f, 0.0218449999f, 0.647599995f, 0.651600003f, -0.955600023f, 0.0277999993f, 0.293199986f,
+	-0.080167003f, 0.68514502f, 0.0235259999f, 0.655700028f, 0.65200001f, -0.945800006f, 0.0362999998f, 0.322600007f,
+	-0.0824860036f, 0.703227997f, -0.0031969999f, 0.647000015f, 0.640200019f, -0.989899993f, 0.0165999997f, -0.140900001f,
+	-0.082987003f, 0.685545981f, -0.00164300005f, 0.654999971f, 0.640500009f, -0.994199991f, 0.0188999996f, -0.105800003f,
+	-0.0721170008f, 0.685303986f, -0.0312770009f, 0.654399991f, 0.62620002f, -0.82889998f, 0.0135000004f, -0.559199989f,
+	-0.0712990016f, 0.703611016f, -0.0319599994f, 0.646099985f, 0.626299977f, -0.816299975f, 0.0148999998f, -0.577499986f,
+	-0.047642f, 0.703903019f, -0.0531269982f, 0.645099998f, 0.611899972f, -0.533100009f, 0.00730000017f, -0.846000016f,
+	-0.0486930013f, 0.685099006f, -0.052689001f, 0.653599977f, 0.611899972f, -0.543900013f, 0.00899999961f, -0.839100003f,
+	-0.0292339996f, 0.706462979f, -0.0611930005f, 0.643299997f, 0.602900028f, -0.398000002f, -0.00270000007f, -0.917400002f,
+	-0.0301099997f, 0.682989001f, -0.0606620014f, 0.653999984f, 0.602699995f, -0.394899994f, -0.00600000005f, -0.91869998f,
+	0.0877399966f, 0.546223998f, 0.0683559999f, 0.201199993f, 0.942099988f, 0.252900004f, -0.521799982f, 0.814700007f,
+	0.105821997f, 0.538230002f, 0.0576759987f, 0.191599995f, 0.93870002f, 0.317099988f, -0.598200023f, 0.735899985f,
+	0.112830997f, 0.542865992f, 0.0584160015f, 0.191200003f, 0.934899986f, 0.353599995f, -0.64380002f, 0.678600013f,
+	0.0912370011f, 0.552193999f, 0.0711070001f, 0.202600002f, 0.93900001f, 0.252499998f, -0.523000002f, 0.81400001f,
+	0.135170996f, 0.533703029f, 0.0317960009f, 0.175300002f, 0.931500018f, 0.437900007f, -0.745500028f, 0.502499998f,
+	0.127811998f, 0.528298974f, 0.0301770009f, 0.175300002f, 0.935699999f, 0.432099998f, -0.739499986f, 0.516200006f,
+	0.149912f, 0.527886987f, 0.00604300015f, 0.161699995f, 0.929799974f, 0.476099998f, -0.756099999f, 0.448900014f,
+	0.140223995f, 0.521723986f, 0.00604300015f, 0.162699997f, 0.934899986f, 0.478899986f, -0.752900004f, 0.451400012f,
+	0.0795459971f, 0.411570996f, -0.00379400002f, 0.290399998f, 0.679199994f, 0.830299973f, -0.0546000004f, -0.554700017f,
+	0.0751470029f, 0.405533999f, -0.00971799996f, 0.294499993f, 0.680499971f, 0.82950002f, -0.0595999993f, -0.555299997f,
+	0.0626650006f, 0.431818008f, -0.0313040018f, 0.300399989f, 0.665199995f, 0.706900001f, 0.100900002f, -0.700100005f,
+	0.0642170012f, 0.44037801f, -0.0284209996f, 0.297600001f, 0.662199974f, 0.684700012f, 0.1109f, -0.720300019f,
+	0.0870129988f, 0.396869987f, 0.00858100038f, 0.286799997f, 0.687900007f, 0.846899986f, -0.169300005f, -0.504100025f,
+	0.0819270015f, 0.391957015f, 0.00179500005f, 0.291200012f, 0.688499987f, 0.845600009f, -0.174500003f, -0.504499972f,
+	0.0425309986f, 0.434123993f, -0.0422139987f, 0.309300005f, 0.659799993f, 0.499300003f, 0.1505f, -0.853299975f,
+	0.0425439999f, 0.442039996f, -0.0409360006f, 0.307500005f, 0.656700015f, 0.503199995f, 0.136899993f, -0.853299975f,
+	0.0766599998f, 0.358456999f, 0.0129009997f, 0.294499993f, 0.704299986f, 0.879999995f, -0.252799988f, -0.402099997f,
+	0.0818269998f, 0.366102993f, 0.019359f, 0.289700001f, 0.702600002f, 0.882200003f, -0.271200001f, -0.384900004f,
+	0.0792099983f, 0.349781007f, 0.0237850007f, 0.291599989f, 0.710099995f, 0.899200022f, -0.214300007f, -0.381500006f,
+	0.07553f, 0.324389994f, 0.0286720004f, 0.295300007f, 0.721300006f, 0.863799989f, -0.133699998f, -0.485700011f,
+	0.0705009997f, 0.322836012f, 0.0206819996f, 0.299499989f, 0.720300019f, 0.850499988f, -0.1241f, -0.511200011f,
+	0.0715060011f, 0.291615009f, 0.0227579996f, 0.304100007f, 0.733699977f, 0.915099978f, 0.0865999982f, -0.393900007f,
+	0.0761260018f, 0.296503007f, 0.0328399986f, 0.298599988f, 0.733699977f, 0.908500016f, 0.00310000009f, -0.417800009f,
+	0.0742039979f, 0.280286014f, 0.0241369996f, 0.305099994f, 0.738900006f, 0.921999991f, 0.177599996f, -0.344199985f,
+	0.0773850009f, 0.278719008f, 0.0325190015f, 0.301699996f, 0.741100013f, 0.914799988f, 0.126800001f, -0.383399993f,
+	0.0708649978f, 0.28165701f, 0.0168609992f, 0.308200002f, 0.736899972f, 0.918299973f, 0.122299999f, -0.376599997f,
+	0.0652230009f, 0.293309987f, 0.00567900017f, 0.311399996f, 0.729799986f, 0.799199998f, 0.0118000004f, -0.600899994f,
+	0.0652030036f, 0.284025997f, 0.00593699981f, 0.312900007f, 0.733699977f, 0.809700012f, -0.0175000001f, -0.586600006f,
+	0.0418380015f, 0.301670015f, -0.0162439998f, 0.323300004f, 0.720700026f, 0.681599975f, -0.0170000009f, -0.73150003f,
+	0.042498f, 0.290962994f, -0.0153980004f, 0.324699998f, 0.725399971f, 0.682099998f, -0.0156999994f, -0.731100023f,
+	-0.0795459971f, 0.411570996f, -0.00379400002f, 0.301999986f, 0.971000016f, -0.830299973f, -0.0546000004f, -0.554700017f,
+	-0.0642170012f, 0.44037801f, -0.0284209996f, 0.289600015f, 0.984799981f, -0.684700012f, 0.1109f, -0.720300019f,
+	-0.0626650006f, 0.431818008f, -0.0313040018f, 0.287900001f, 0.981000006f, -0.706900001f, 0.100900002f, -0.700100005f,
+	-0.0751470029f, 0.405533999f, -0.00971799996f, 0.298500001f, 0.968400002f, -0.82950002f, -0.0595999993f, -0.555299997f,
+	-0.0819270015f, 0.391957015f, 0.00179500005f, 0.304100007f, 0.961899996f, -0.845600009f, -0.174500003f, -0.504499972f,
+	-0.0870129988f, 0.396869987f, 0.00858100038f, 0.308099985f, 0.96390003f, -0.846899986f, -0.169300005f, -0.504100025f,
+	-0.0425309986f, 0.434123993f, -0.0422139987f, 0.277700007f, 0.983299971f, -0.499300003f, 0.1505f, -0.853299975f,
+	-0.0425439999f, 0.442039996f, -0.0409360006f, 0.278499991f, 0.986899972f, -0.503199995f, 0.136899993f, -0.853299975f,
+	-0.0766599998f, 0.358456999f, 0.0129009997f, 0.306100011f, 0.945900023f, -0.879999995f, -0.252799988f, -0.402099997f,
+	-0.0818269998f, 0.366102993f, 0.019359f, 0.310099989f, 0.949100018f, -0.882200003f, -0.271200001f, -0.384900004f,
+	-0.0792099983f, 0.349781007f, 0.0237850007f, 0.310600013f, 0.941299975f, -0.899200022f, -0.214300007f, -0.381500006f,
+	-0.0705009997f, 0.322836012f, 0.0206819996f, 0.306400001f, 0.929099977f, -0.850499988f, -0.1241f, -0.511200011f,
+	-0.07553f, 0.324389994f, 0.0286720004f, 0.310699999f, 0.929499984f, -0.863799989f, -0.133699998f, -0.485700011f,
+	-0.0715060011f, 0.291615009f, 0.0227579996f, 0.306400001f, 0.914900005f, -0.915099978f, 0.0865999982f, -0.393900007f,
+	-0.0761260018f, 0.296503007f, 0.0328399986f, 0.311500013f, 0.916800022f, -0.908500016f, 0.00310000009f, -0.417800009f,
+	-0.0742039979f, 0.280286014f, 0.0241369996f, 0.307000011f, 0.909699976f, -0.921999991f, 0.177599996f, -0.344199985f,
+	-0.0773850009f, 0.278719008f, 0.0325190015f, 0.31099999f, 0.908699989f, -0.914799988f, 0.126800001f, -0.383399993f,
+	-0.0652230009f, 0.293309987f, 0.00567900017f, 0.298200011f, 0.916299999f, -0.799199998f, 0.0118000004f, -0.600899994f,
+	-0.0708649978f, 0.28165701f, 0.0168609992f, 0.30340001f, 0.910600007f, -0.918299973f, 0.122299999f, -0.376599997f,
+	-0.0652030036f, 0.284025997f, 0.00593699981f, 0.298000008f, 0.912100017f, -0.809700012f, -0.0175000001f, -0.586600006f,
+	-0.0418380015f, 0.301670015f, -0.0162439998f, 0.284000009f, 0.92110002f, -0.681599975f, -0.0170000009f, -0.73150003f,
+	-0.042498f, 0.290962994f, -0.0153980004f, 0.284099996f, 0.916299999f, -0.682099998f, -0.0156999994f, -0.731100023f,
+	-0.0f, 0.72025001f, -0.0712900013f, 0.574100018f, 0.915799975f, 0.0291000009f, 0.131400004f, -0.99089998f,
+	-0.0158760007f, 0.715242982f, -0.0710590035f, 0.576799989f, 0.908800006f, -0.143999994f, 0.302899987f, -0.942099988f,
+	-0.0168159995f, 0.717795014f, -0.0688240007f, 0.578199983f, 0.909300029f, -0.199100003f, 0.546500027f, -0.813399971f,
+	-0.0f, 0.724121988f, -0.0707049966f, 0.575399995f, 0.916899979f, 0.0270000007f, 0.149299994f, -0.988399982f,
+	-0.0114829997f, 0.711838007f, -0.0716790035f, 0.574299991f, 0.909399986f, 0.00150000001f, 0.0103000002f, -0.999899983f,
+	-0.0f, 0.714121997f, -0.0712210014f, 0.57190001f, 0.914099991f, 0.00980000012f, -0.0568000004f, -0.998300016f,
+	0.0165819991f, 0.717685997f, -0.0679389983f, 0.568599999f, 0.921299994f, 0.229100004f, 0.253399998f, -0.939800024f,
+	0.0152580002f, 0.714667022f, -0.0691440031f, 0.567900002f, 0.9199f, 0.260199994f, 0.316500008f, -0.912199974f,
+	0.0114820004f, 0.711840987f, -0.0714540035f, 0.567900002f, 0.917500019f, 0.119499996f, 0.155900002f, -0.980499983f,
+	-0.0178399999f, 0.705475986f, -0.071667999f, 0.573899984f, 0.905399978f, -0.0847999975f, 0.0208999999f, -0.996200025f,
+	-0.0241989996f, 0.705543995f, -0.0701560006f, 0.575699985f, 0.903100014f, -0.230499998f, 0.0573000014f, -0.971400023f,
+	-0.0f, 0.699187994f, -0.069490999f, 0.566600025f, 0.90990001f, 0.00230000005f, -0.0408000015f, -0.999199986f,
+	0.0178379994f, 0.705475986f, -0.071638003f, 0.563799977f, 0.917999983f, 0.122199997f, 0.1184f, -0.985400021f,
+	0.024007f, 0.705452025f, -0.0699160025f, 0.562099993f, 0.920300007f, 0.266799986f, 0.138799995f, -0.953700006f,
+	-0.0f, 0.686416984f, -0.0694639981f, 0.561999977f, 0.906300008f, -0.00989999995f, 0.0342000015f, -0.99940002f,
+	0.0208630003f, 0.685114026f, -0.0716810003f, 0.555800021f, 0.913399994f, 0.136099994f, -0.0825000033f, -0.987299979f,
+	0.0260540005f, 0.68542397f, -0.0702439994f, 0.554400027f, 0.915300012f, 0.271100014f, -0.0874999985f, -0.958599985f,
+	-0.020823f, 0.685145974f, -0.0711269975f, 0.567499995f, 0.898599982f, -0.0724000037f, -0.0661000013f, -0.995199978f,
+	-0.0261369999f, 0.685397983f, -0.0703419968f, 0.569000006f, 0.896799982f, -0.159199998f, -0.0724000037f, -0.984600008f,
+	-0.0100840004f, 0.674122989f, -0.071119003f, 0.560500026f, 0.899299979f, -0.0373999998f, -0.1008f, -0.994199991f,
+	-0.0f, 0.672258019f, -0.0709350035f, 0.556900024f, 0.9023f, -0.000199999995f, -0.0173000004f, -0.999899983f,
+	0.0100959996f, 0.674112976f, -0.0714320019f, 0.554799974f, 0.906400025f, 0.0452999994f, -0.162400007f, -0.985700011f,
+	0.0208700001f, 0.67445302f, -0.0686839968f, 0.551800013f, 0.910399973f, 0.258899987f, -0.269199997f, -0.927600026f,
+	0.0137919998f, 0.668172002f, -0.0688370019f, 0.551500022f, 0.906099975f, 0.244599998f, -0.237100005f, -0.940199971f,
+	-0.0f, 0.664408982f, -0.0707269982f, 0.55400002f, 0.899999976f, 0.0168999992f, 0.0617000014f, -0.997900009f,
+	-0.0138950003f, 0.668075025f, -0.0693060011f, 0.559400022f, 0.896099985f, -0.228499994f, -0.224199995f, -0.947399974f,
+	-0.0210570004f, 0.674328029f, -0.0691599995f, 0.56370002f, 0.895500004f, -0.205699995f, -0.213100001f, -0.9551f,
+	-0.0213050004f, 0.657873988f, -0.063161999f, 0.558200002f, 0.889900029f, -0.435000002f, -0.0615000017f, -0.898299992f,
+	-0.0f, 0.657712996f, -0.0715639964f, 0.551599979f, 0.898000002f, 0.00510000018f, 0.0637999997f, -0.998000026f,
+	0.0213050004f, 0.657873988f, -0.0631640032f, 0.54519999f, 0.906400025f, 0.430200011f, -0.0395999998f, -0.901799977f,
+	-0.0f, 0.630378008f, -0.0760660022f, 0.541599989f, 0.890200019f, -0.00319999992f, 0.0643000007f, -0.997900009f,
+	-0.0361989997f, 0.626452029f, -0.0549289994f, 0.55250001f, 0.874599993f, -0.541700006f, 0.0683000013f, -0.837800026f,
+	-0.0351819992f, 0.650166988f, -0.0541080013f, 0.560599983f, 0.881900012f, -0.565999985f, 0.0527999997f, -0.822700024f,
+	-0.0f, 0.584569991f, -0.0776939988f, 0.525600016f, 0.877499998f, -0.0f, -0.00469999993f, -1.0f,
+	0.0358919986f, 0.614151001f, -0.0564180017f, 0.524600029f, 0.9005f, 0.48969999f, 0.0359999985f, -0.871100008f,
+	0.0365310013f, 0.626423001f, -0.0555390008f, 0.528999984f, 0.904399991f, 0.505900025f, 0.0406999998f, -0.861599982f,
+	-0.0358919986f, 0.614151001f, -0.0564180017f, 0.547900021f, 0.871299982f, -0.504899979f, 0.0603f, -0.861100018f,
+	0.0351830013f, 0.650166988f, -0.0541110002f, 0.537999988f, 0.91049999f, 0.575900018f, 0.0816000029f, -0.813399971f,
+	0.0343849994f, 0.585557997f, -0.0585860014f, 0.514800012f, 0.891499996f, 0.485500008f, 0.00889999978f, -0.874199986f,
+	0.0231800005f, 0.536377013f, -0.0630270019f, 0.501100004f, 0.872799993f, 0.448300004f, -0.0803999975f, -0.890299976f,
+	-0.0f, 0.534613013f, -0.0740939975f, 0.508099973f, 0.863499999f, -0.0f, -0.109099999f, -0.994000018f,
+	-0.0343849994f, 0.585557997f, -0.0585860014f, 0.536899984f, 0.863799989f, -0.485500008f, 0.00889999978f, -0.874199986f,
+	-0.0231800005f, 0.536377013f, -0.0630270019f, 0.515600026f, 0.854600012f, -0.448300004f, -0.0803999975f, -0.890299976f,
+	-0.0395569988f, 0.626561999f, -0.0524890013f, 0.553799987f, 0.873199999f, -0.584100008f, 0.0830999985f, -0.807399988f,
+	-0.0f, 0.48712799f, -0.0671250001f, 0.4912f, 0.850099981f, 0.0f, -0.145199999f, -0.989400029f,
+	-0.0251739994f, 0.660881996f, -0.0647749975f, 0.639500022f, 0.579400003f, -0.625500023f, -0.1228f, -0.770500004f,
+	-0.038679f, 0.653212011f, -0.0531079993f, 0.644200027f, 0.586799979f, -0.777100027f, 0.185000002f, -0.601599991f,
+	-0.041294001f, 0.656803012f, -0.0486069992f, 0.643000007f, 0.589399993f, -0.773899972f, 0.128000006f, -0.620199978f,
+	-0.0429270007f, 0.634203017f, -0.0498449989f, 0.653100014f, 0.587700009f, -0.81370002f, 0.0830999985f, -0.575299978f,
+	-0.0400860012f, 0.630187988f, -0.0544029996f, 0.654500008f, 0.584999979f, -0.811699986f, 0.0820999965f, -0.578299999f,
+	-0.0141660003f, 0.907132983f, -0.0471750014f, 0.1259f, 0.606599987f, -0.864700019f, 0.143800005f, -0.481299996f,
+	-0.01664f, 0.901744008f, -0.0444520004f, 0.125300005f, 0.603699982f, -0.859399974f, 0.147f, -0.489800006f,
+	-0.0150520001f, 0.930729985f, -0.0385369994f, 0.136099994f, 0.611599982f, -0.931800008f, 0.0794999972f, -0.354000002f,
+	-0.0138050001f, 0.932164013f, -0.0415909998f, 0.135499999f, 0.613099992f, -0.934599996f, 0.0729999989f, -0.348100007f,
+	-0.0161979999f, 0.962503016f, -0.0301300008f, 0.148900002f, 0.619300008f, -0.926199973f, 0.0671000034f, -0.370999992f,
+	-0.0146700004f, 0.965285003f, -0.033427f, 0.148599997f, 0.621399999f, -0.925700009f, 0.0675999969f, -0.372099996f,
+	-0.105531f, 0.538773f, 0.0570579991f, 0.193900004f, 0.89349997f, -0.285299987f, -0.635599971f, 0.717400014f,
+	-0.0877399966f, 0.546223998f, 0.0683559999f, 0.184400007f, 0.897000015f, -0.282999992f, -0.533200026f, 0.797299981f,
+	-0.0912370011f, 0.552193999f, 0.0711070001f, 0.182999998f, 0.893999994f, -0.273900002f, -0.540799975f, 0.795300007f,
+	-0.112823002f, 0.542672992f, 0.0576759987f, 0.194499999f, 0.889800012f, -0.314999998f, -0.685400009f, 0.656599998f,
+	-0.127793998f, 0.528330028f, 0.0301559996f, 0.210099995f, 0.890600026f, -0.419400007f, -0.743700027f, 0.520600021f,
+	-0.134092003f, 0.533141017f, 0.0319049992f, 0.209999993f, 0.886900008f, -0.430599988f, -0.743399978f, 0.511900008f,
+	-0.140263006f, 0.521661997f, 0.00604300015f, 0.222800002f, 0.889900029f, -0.4833f, -0.751600027f, 0.448900014f,
+	-0.149851993f, 0.527907014f, 0.00604500016f, 0.223700002f, 0.884800017f, -0.487599999f, -0.748899996f, 0.448700011f,
+	-0.0400860012f, 0.630187988f, -0.0544029996f, 0.890600026f, 0.8398f, -0.107600003f, 0.0410000011f, -0.993399978f,
+	-0.038679f, 0.653212011f, -0.0531079993f, 0.880299985f, 0.841700017f, -0.218999997f, 0.0680999979f, -0.97329998f,
+	-0.0351819992f, 0.650166988f, -0.0541080013f, 0.881299973f, 0.8398f, -0.208399996f, 0.0654999986f, -0.975799978f,
+	-0.0361989997f, 0.626452029f, -0.0549289994f, 0.891799986f, 0.837700009f, -0.0976999998f, 0.0386000015f, -0.994499981f,
+	-0.090402998f, 0.816197991f, -0.00244399998f, 0.193100005f, 0.416200012f, -0.997900009f, -0.0103000002f, 0.0634000003f,
+	-0.0861240029f, 0.797698021f, 0.0191479996f, 0.202600002f, 0.407400012f, -0.993799984f, -0.100000001f, 0.0489000008f,
+	-0.0877439976f, 0.824362993f, 0.0407459997f, 0.212799996f, 0.419099987f, -0.998199999f, -0.0595000014f, 0.00170000002f,
+	-0.0890590027f, 0.840744019f, -0.00537799997f, 0.192200005f, 0.427300006f, -0.999800026f, 0.0055999998f, 0.0184000004f,
+	-0.085796997f, 0.790866971f, 0.05229f, 0.217500001f, 0.403699994f, -0.997799993f, -0.0614f, -0.0240000002f,
+	-0.0890600011f, 0.819302022f, 0.0908970013f, 0.235400006f, 0.416000009f, -0.995599985f, -0.0780000016f, -0.0518999994f,
+	-0.0895240009f, 0.852088988f, 0.0488420017f, 0.216999993f, 0.431499988f, -0.994799972f, -0.0942000002f, -0.0397000015f,
+	-0.0893469974f, 0.860207021f, -0.00125700003f, 0.194399998f, 0.436100006f, -0.999199986f, -0.0394000001f, -0.00989999995f,
+	-0.0921130031f, 0.844959021f, 0.0930619985f, 0.236900002f, 0.427599996f, -0.991100013f, -0.109899998f, -0.0758000016f,
+	-0.0914459974f, 0.879984975f, 0.0208480004f, 0.204799995f, 0.444700003f, -0.993099988f, -0.1096f, -0.0410000011f,
+	-0.0942780003f, 0.885115981f, 0.0465000011f, 0.216499999f, 0.446700007f, -0.986899972f, -0.146799996f, -0.0667999983f,
+	-0.0938059986f, 0.870814025f, 0.0786269978f, 0.230800003f, 0.439599991f, -0.9903f, -0.122299999f, -0.0654999986f,
+	-0.0874599963f, 0.79794699f, 0.077496998f, 0.229000002f, 0.406500012f, -0.997699976f, -0.0406000018f, -0.0544000007f,
+	-0.115801997f, 0.219323993f, -0.123607002f, 0.977199972f, 0.949699998f, -0.872699976f, 0.301899999f, -0.3838f,
+	-0.137960002f, 0.131133005f, -0.142596006f, 0.985400021f, 0.990999997f, -0.980199993f, 0.195899993f, -0.0287999995f,
+	-0.119717002f, 0.222383007f, -0.112296f, 0.971700013f, 0.948800027f, -0.960200012f, 0.239700004f, -0.143600002f,
+	-0.133292004f, 0.130592003f, 0.149325997f, 0.853200018f, 0.99089998f, -0.987999976f, 0.153500006f, 0.0161000006f,
+	-0.119592004f, 0.221926004f, 0.119323f, 0.86680001f, 0.949000001f, -0.986800015f, 0.161200002f, 0.0132999998f,
+	-0.0541689992f, 0.260194987f, -0.0438870005f, 0.316300005f, 0.752200007f, -0.690400004f, 0.064199999f, -0.720600009f,
+	-0.0557870008f, 0.267159998f, -0.0407700017f, 0.319400012f, 0.750699997f, -0.717299998f, 0.138899997f, -0.682699978f,
+	-0.0443050005f, 0.268182993f, -0.0526250005f, 0.320100009f, 0.758099973f, -0.649399996f, -0.0293000005f, -0.759800017f,
+	-0.0445559993f, 0.259599f, -0.0511210002f, 0.316100001f, 0.757700026f, -0.601700008f, -0.120700002f, -0.789600015f,
+	0.0870129988f, 0.396869987f, 0.00858100038f, 0.368600011f, 0.604600012f, 0.898299992f, -0.00499999989f, 0.439300001f,
+	0.084220998f, 0.399650007f, 0.0144020002f, 0.365500003f, 0.603699982f, 0.900200009f, -0.00789999962f, 0.435499996f,
+	0.0803719983f, 0.375667006f, 0.0219209995f, 0.363299996f, 0.61500001f, 0.834399998f, -0.0228000004f, 0.550700009f,
+	0.0818269998f, 0.366102993f, 0.019359f, 0.3653f, 0.619099975f, 0.715399981f, 0.00529999984f, 0.698700011f,
+	0.0743089989f, 0.367220998f, 0.0259610005f, 0.360700011f, 0.619400024f, 0.640600026f, 0.0160000008f, 0.767700016f,
+	0.0792099983f, 0.349781007f, 0.0237850007f, 0.364300013f, 0.626800001f, 0.699599981f, 0.116300002f, 0.704999983f,
+	0.0715650022f, 0.355343997f, 0.0286740009f, 0.359899998f, 0.624899983f, 0.614400029f, 0.166500002f, 0.771300018f,
+	0.074653998f, 0.349840999f, 0.0291760005f, 0.361200005f, 0.627499998f, 0.745100021f, 0.227400005f, 0.627099991f,
+	0.0716930032f, 0.331405014f, 0.0326899998f, 0.361000001f, 0.636099994f, 0.692300022f, -0.0381999984f, 0.720600009f,
+	0.07553f, 0.324389994f, 0.0286720004f, 0.364199996f, 0.638599992f, 0.673399985f, 0.0399000011f, 0.738200009f,
+	0.0678900033f, 0.328108996f, 0.0351510011f, 0.359400004f, 0.638000011f, 0.646300018f, -0.00170000002f, 0.763100028f,
+	0.0675989985f, 0.299275994f, 0.038759999f, 0.361200005f, 0.65109998f, 0.614000022f, 0.195600003f, 0.764699996f,
+	0.0761260018f, 0.296503007f, 0.0328399986f, 0.365999997f, 0.651300013f, 0.655499995f, 0.133599997f, 0.743300021f,
+	0.0711989999f, 0.294672012f, 0.0380720012f, 0.363099992f, 0.652899981f, 0.684199989f, 0.211899996f, 0.697799981f,
+	0.0773850009f, 0.278719008f, 0.0325190015f, 0.368600011f, 0.658900023f, 0.756299973f, 0.00209999993f, 0.654200017f,
+	0.071062997f, 0.280622989f, 0.0400790013f, 0.364100009f, 0.659300029f, 0.761399984f, -0.0406000018f, 0.647000015f,
+	0.0688590035f, 0.274342f, 0.0410410017f, 0.363900006f, 0.662299991f, 0.737500012f, -0.158199996f, 0.656599998f,
+	-0.0870129988f, 0.396869987f, 0.00858100038f, 0.35710001f, 0.904699981f, -0.898299992f, -0.00499999989f, 0.439300001f,
+	-0.0818269998f, 0.366102993f, 0.019359f, 0.360399991f, 0.890100002f, -0.715399981f, 0.00529999984f, 0.698700011f,
+	-0.0803719983f, 0.375667006f, 0.0219209995f, 0.362399995f, 0.894200027f, -0.834399998f, -0.0228000004f, 0.550700009f,
+	-0.084220998f, 0.399650007f, 0.0144020002f, 0.360199988f, 0.905499995f, -0.900200009f, -0.00789999962f, 0.435499996f,
+	-0.0743089989f, 0.367220998f, 0.0259610005f, 0.36500001f, 0.889900029f, -0.640600026f, 0.0160000008f, 0.767700016f,
+	-0.0792099983f, 0.349781007f, 0.0237850007f, 0.361400008f, 0.882499993f, -0.699599981f, 0.116300002f, 0.704999983f,
+	-0.0715650022f, 0.355343997f, 0.0286740009f, 0.365799993f, 0.884299994f, -0.614400029f, 0.166500002f, 0.771300018f,
+	-0.074653998f, 0.349840999f, 0.0291760005f, 0.364499986f, 0.881799996f, -0.745100021f, 0.227400005f, 0.627099991f,
+	-0.07553f, 0.324389994f, 0.0286720004f, 0.361499995f, 0.870599985f, -0.673399985f, 0.0399000011f, 0.738200009f,
+	-0.0716930032f, 0.331405014f, 0.0326899998f, 0.36469999f, 0.873199999f, -0.692300022f, -0.0381999984f, 0.720600009f,
+	-0.0678900033f, 0.328108996f, 0.0351510011f, 0.366299987f, 0.871200025f, -0.646300018f, -0.00170000002f, 0.763100028f,
+	-0.0675989985f, 0.299275994f, 0.038759999f, 0.364499986f, 0.858200014f, -0.614000022f, 0.195600003f, 0.764699996f,
+	-0.0761260018f, 0.296503007f, 0.0328399986f, 0.359600008f, 0.85799998f, -0.655499995f, 0.133599997f, 0.743300021f,
+	-0.0711989999f, 0.294672012f, 0.0380720012f, 0.362599999f, 0.856400013f, -0.684199989f, 0.211899996f, 0.697799981f,
+	-0.0773850009f, 0.278719008f, 0.0325190015f, 0.35710001f, 0.850300014f, -0.756299973f, 0.00209999993f, 0.654200017f,
+	-0.071062997f, 0.280622989f, 0.0400790013f, 0.361600012f, 0.850000024f, -0.761399984f, -0.0406000018f, 0.647000015f,
+	-0.0688590035f, 0.274342f, 0.0410410017f, 0.361799985f, 0.847000003f, -0.737500012f, -0.158199996f, 0.656599998f,
+	-0.115248002f, 0.214202002f, 0.131969005f, 0.87620002f, 0.590699971f, 0.00710000005f, 0.2042f, 0.978900015f,
+	-0.133292004f, 0.130592003f, 0.149325997f, 0.867999971f, 0.552100003f, 0.00630000001f, 0.202000007f, 0.979399979f,
+	0.138992995f, 0.129521996f, 0.147799999f, 0.991299987f, 0.551699996f, 0.0092000002f, 0.210299999f, 0.977599978f,
+	0.110614002f, 0.221943006f, 0.127933994f, 0.978500009f, 0.594500005f, 0.0102000004f, 0.213100001f, 0.976999998f,
+	-0.177435994f, 0.761258006f, -0.0947809964f, 0.0877000019f, 0.361400008f, -0.0307f, -0.0750999972f, -0.996699989f,
+	-0.170645997f, 0.762421012f, -0.0949869975f, 0.0860000029f, 0.358900011f, -0.0193000007f, -0.0640999973f, -0.997799993f,
+	-0.154773995f, 0.737806976f, -0.093712002f, 0.0930000022f, 0.347600013f, -0.0684999973f, -0.185399994f, -0.980300009f,
+	-0.158898994f, 0.735166013f, -0.0928919986f, 0.0947000012f, 0.348699987f, -0.0808999985f, -0.181099996f, -0.980099976f,
+	-0.121134996f, 0.715094984f, -0.0901279971f, 0.0965000018f, 0.329299986f, -0.0680000037f, -0.260600001f, -0.963100016f,
+	-0.119719997f, 0.70795399f, -0.0882840008f, 0.0996999964f, 0.327499986f, -0.0688999966f, -0.262199998f, -0.962499976f,
+	0.111372001f, 0.214886993f, -0.128496006f, 0.980199993f, 0.893299997f, -0.00810000021f, 0.189400002f, -0.981899977f,
+	0.137271002f, 0.131125003f, -0.144308999f, 0.991999984f, 0.931900024f, -0.00609999988f, 0.183699995f, -0.98299998f,
+	-0.137960002f, 0.131133005f, -0.142596006f, 0.867299974f, 0.931699991f, -0.0142000001f, 0.206900001f, -0.978299975f,
+	-0.115801997f, 0.219323993f, -0.123607002f, 0.877300024f, 0.890900016f, -0.0167999994f, 0.214499995f, -0.976599991f,
+	0.0231800005f, 0.536377013f, -0.0630270019f, 0.858099997f, 0.791599989f, -0.224199995f, 0.189500004f, -0.95599997f,
+	0.0267299991f, 0.537550986f, -0.0636050031f, 0.85680002f, 0.792699993f, -0.206300005f, 0.155499995f, -0.966000021f,
+	-0.0f, 0.482701987f, -0.0694660023f, 0.858500004f, 0.764800012f, -0.614199996f, 0.350100011f, -0.707300007f,
+	-0.0f, 0.48712799f, -0.0671250001f, 0.859600008f, 0.766799986f, -0.641799986f, 0.358500004f, -0.677900016f,
+	0.0343849994f, 0.585557997f, -0.0585860014f, 0.861500025f, 0.814400017f, -0.1184f, 0.101599999f, -0.987800002f,
+	0.0383009985f, 0.585071981f, -0.0590980016f, 0.859700024f, 0.814800024f, -0.109300002f, 0.101800002f, -0.988799989f,
+	0.0358919986f, 0.614151001f, -0.0564180017f, 0.86559999f, 0.826799989f, 0.0394000001f, 0.0966000035f, -0.994499981f,
+	0.0399760008f, 0.611235976f, -0.0565650016f, 0.863399982f, 0.826200008f, 0.0333999991f, 0.0969000012f, -0.994700015f,
+	0.0402880013f, 0.63013202f, -0.0546009988f, 0.866400003f, 0.834299982f, 0.169100001f, 0.0710000023f, -0.98299998f,
+	0.0365310013f, 0.626423001f, -0.0555390008f, 0.867299974f, 0.832099974f, 0.182699993f, 0.0628999993f, -0.98119998f,
+	0.0351830013f, 0.650166988f, -0.0541110002f, 0.871900022f, 0.842000008f, 0.211099997f, 0.0776000023f, -0.974399984f,
+	0.0386720002f, 0.653213024f, -0.0530980006f, 0.870899975f, 0.843900025f, 0.214399993f, 0.0784000009f, -0.97359997f,
+	-0.158801004f, 0.123153001f, 0.192460999f, 0.733399987f, 0.649600029f, -0.576399982f, 0.408699989f, 0.707599998f,
+	-0.164480001f, 0.124410003f, 0.187105998f, 0.736899972f, 0.648999989f, -0.576600015f, 0.408699989f, 0.707499981f,
+	-0.195466995f, 0.0245220009f, 0.219550997f, 0.737600029f, 0.698599994f, -0.573599994f, 0.408300012f, 0.710099995f,
+	-0.188399002f, 0.0242199991f, 0.225431994f, 0.733399987f, 0.698700011f, -0.573400021f, 0.408300012f, 0.710300028f,
+	-0.0395569988f, 0.626561999f, -0.0524890013f, 0.823400021f, 0.740999997f, -0.464700013f, 0.239399999f, -0.852500021f,
+	-0.0358919986f, 0.614151001f, -0.0564180017f, 0.823400021f, 0.747099996f, -0.102399997f, 0.201900005f, -0.973999977f,
+	-0.0399760008f, 0.611235976f, -0.0565650016f, 0.821200013f, 0.747900009f, -0.126200005f, 0.156499997f, -0.979600012f,
+	-0.0434949994f, 0.621722996f, -0.0510330014f, 0.820800006f, 0.742299974f, -0.569500029f, 0.225700006f, -0.790400028f,
+	-0.0343849994f, 0.585557997f, -0.0585860014f, 0.820299983f, 0.759899974f, 0.1184f, 0.101599999f, -0.987800002f,
+	-0.0383009985f, 0.585071981f, -0.0590980016f, 0.818499982f, 0.759599984f, 0.109300002f, 0.101800002f, -0.988799989f,
+	-0.0231800005f, 0.536377013f, -0.0630270019f, 0.818899989f, 0.782899976f, 0.224199995f, 0.189500004f, -0.95599997f,
+	-0.0267299991f, 0.537550986f, -0.0636050031f, 0.817499995f, 0.782000005f, 0.206300005f, 0.155499995f, -0.966000021f,
+	-0.0f, 0.482701987f, -0.0694660023f, 0.821699977f, 0.809599996f, 0.614199996f, 0.350100011f, -0.707300007f,
+	-0.0f, 0.48712799f, -0.0671250001f, 0.822600007f, 0.807600021f, 0.641799986f, 0.358500004f, -0.677900016f,
+	0.0947220027f, 0.674024999f, -0.0453360006f, 0.194299996f, 0.862999976f, 0.961700022f, -0.247799993f, -0.117200002f,
+	0.0953190029f, 0.673397005f, -0.0391100012f, 0.197099999f, 0.862999976f, 0.961700022f, -0.247799993f, -0.117200002f,
+	0.0940970033f, 0.670837998f, -0.043722f, 0.195099995f, 0.864400029f, 0.961700022f, -0.247799993f, -0.117200002f,
+	-0.121184997f, 0.530948997f, -0.0277110003f, 0.179800004f, 0.910600007f, -0.38530001f, -0.769699991f, -0.509000003f,
+	-0.131472006f, 0.526287973f, -0.0125080002f, 0.171399996f, 0.909099996f, -0.457199991f, -0.754400015f, -0.471100003f,
+	-0.139137998f, 0.532360017f, -0.0147919999f, 0.171900004f, 0.904500008f, -0.456800014f, -0.760699987f, -0.461100012f,
+	-0.127865002f, 0.536769986f, -0.0316339992f, 0.181099996f, 0.906400025f, -0.384600013f, -0.763499975f, -0.518899977f,
+	-0.112977996f, 0.534888029f, -0.0388620012f, 0.186199993f, 0.911899984f, -0.311699986f, -0.677200019f, -0.666499972f,
+	-0.140263006f, 0.521661997f, 0.00604300015f, 0.161899999f, 0.908200026f, -0.492799997f, -0.763000011f, -0.41839999f,
+	-0.149851993f, 0.527907014f, 0.00604500016f, 0.161200002f, 0.903100014f, -0.495900005f, -0.761300027f, -0.417699993f,
+	-0.117642999f, 0.540660024f, -0.0424470007f, 0.187700003f, 0.908500016f, -0.296400011f, -0.665199995f, -0.685299993f,
+	-0.0913029984f, 0.552725017f, -0.0602609999f, 0.202000007f, 0.914099991f, -0.322899997f, -0.540000021f, -0.777199984f,
+	-0.0877119973f, 0.54617101f, -0.0574770011f, 0.200299993f, 0.917299986f, -0.343499988f, -0.520500004f, -0.781700015f,
+	-0.0479359999f, 0.746528029f, -0.139336005f, 0.180000007f, 0.328999996f, -0.468499988f, -0.340700001f, -0.815100014f,
+	-0.0395490006f, 0.747482002f, -0.144651994f, 0.175699994f, 0.330500007f, -0.469500005f, -0.361600012f, -0.805499971f,
+	-0.0355889983f, 0.743319988f, -0.145091996f, 0.173600003f, 0.328900009f, -0.469199985f, -0.353899986f, -0.809099972f,
+	-0.0476219989f, 0.742982984f, -0.138061002f, 0.179700002f, 0.327300012f, -0.468300015f, -0.335500002f, -0.817399979f,
+	-0.0557870008f, 0.267159998f, -0.0407700017f, 0.39379999f, 0.829999983f, -0.924199998f, -0.0496999994f, -0.378600001f,
+	-0.0565459989f, 0.260821998f, -0.0375569984f, 0.397000015f, 0.830600023f, -0.922699988f, -0.0804999992f, -0.377000004f,
+	-0.0611319989f, 0.267111987f, -0.0286459997f, 0.395500004f, 0.835799992f, -0.930100024f, 0.334199995f, -0.152500004f,
+	-0.0602229983f, 0.269057006f, -0.0290029999f, 0.394600004f, 0.835699975f, -0.899600029f, 0.380899996f, -0.213799998f,
+	-0.0541689992f, 0.260194987f, -0.0438870005f, 0.396499991f, 0.827600002f, -0.93629998f, -0.0628999993f, -0.345499992f,
+	-0.0609770007f, 0.266072989f, -0.0219449997f, 0.396299988f, 0.838800013f, -0.896200001f, 0.434799999f, 0.0882000029f,
+	0.149912f, 0.527886987f, 0.00604300015f, 0.209999993f, 0.779500008f, 0.479900002f, -0.753799975f, -0.448900014f,
+	0.140223995f, 0.521723986f, 0.00604300015f, 0.215100005f, 0.778199971f, 0.479699999f, -0.754000008f, -0.448700011f,
+	0.127847999f, 0.528237998f, -0.0181329995f, 0.221399993f, 0.789099991f, 0.392500013f, -0.771700025f, -0.500500023f,
+	0.136983007f, 0.531576991f, -0.0139579996f, 0.216700003f, 0.788200021f, 0.480699986f, -0.752900004f, -0.449600011f,
+	0.123435996f, 0.530314028f, -0.0237290002f, 0.218899995f, 0.786800027f, 0.316599995f, -0.780900002f, -0.538500011f,
+	0.131465003f, 0.534970999f, -0.0257619992f, 0.222399995f, 0.784300029f, 0.324099988f, -0.772099972f, -0.546700001f,
+	0.105821997f, 0.538230002f, -0.0455899984f, 0.209099993f, 0.777999997f, 0.310799986f, -0.625f, -0.716099977f,
+	0.112432003f, 0.542490005f, -0.046337001f, 0.212099999f, 0.77609998f, 0.344099998f, -0.644900024f, -0.682399988f,
+	0.0877119973f, 0.54617101f, -0.0574770011f, 0.200299993f, 0.772300005f, 0.287900001f, -0.513300002f, -0.808499992f,
+	0.0913029984f, 0.552725017f, -0.0602609999f, 0.201900005f, 0.76910001f, 0.291000009f, -0.504800022f, -0.812699974f,
+	-0.040817f, 0.62666899f, -0.0491309986f, 0.920400023f, 0.827400029f, -0.935500026f, 0.0324999988f, -0.351900011f,
+	-0.0409459993f, 0.630240977f, -0.0484590009f, 0.919099987f, 0.826399982f, -0.935500026f, 0.0324999988f, -0.351900011f,
+	-0.0395569988f, 0.626561999f, -0.0524890013f, 0.921700001f, 0.826399982f, -0.935500026f, 0.0324999988f, -0.351900011f,
+	0.0304160006f, 0.536882997f, -0.0610169992f, 0.629199982f, 0.557900012f, 0.559899986f, -0.1087f, -0.821399987f,
+	0.00245700008f, 0.476913989f, -0.0686350018f, 0.646099985f, 0.532800019f, 0.248799995f, -0.0333999991f, -0.967999995f,
+	-0.0f, 0.482701987f, -0.0694660023f, 0.646899998f, 0.535600007f, 0.0f, -0.0242999997f, -0.99970001f,
+	0.0267299991f, 0.537550986f, -0.0636050031f, 0.631200016f, 0.558600008f, 0.554799974f, -0.125599995f, -0.82249999f,
+	0.0383009985f, 0.585071981f, -0.0590980016f, 0.622099996f, 0.578999996f, 0.75819999f, -0.0557000004f, -0.649600029f,
+	0.0421960019f, 0.586467981f, -0.0546020009f, 0.619300008f, 0.579100013f, 0.760500014f, -0.0265999995f, -0.648800015f,
+	-0.0f, 0.476498991f, -0.0691720024f, 0.647300005f, 0.532800019f, 0.0f, -0.0474000014f, -0.998899996f,
+	-0.00245700008f, 0.476913989f, -0.0686350018f, 0.648400009f, 0.533100009f, -0.248799995f, -0.0333999991f, -0.967999995f,
+	-0.0304160006f, 0.536882997f, -0.0610169992f, 0.658500016f, 0.561600029f, -0.559899986f, -0.1087f, -0.821399987f,
+	-0.0267299991f, 0.537550986f, -0.0636050031f, 0.656499982f, 0.561699986f, -0.554799974f, -0.125599995f, -0.82249999f,
+	-0.0421960019f, 0.586467981f, -0.0546020009f, 0.662800014f, 0.584599972f, -0.760500014f, -0.0265999995f, -0.648800015f,
+	-0.0383009985f, 0.585071981f, -0.0590980016f, 0.660099983f, 0.583800018f, -0.75819999f, -0.0557000004f, -0.649600029f,
+	-0.0436110012f, 0.610997021f, -0.0522579998f, 0.663299978f, 0.595799983f, -0.764599979f, 0.0505000018f, -0.642499983f,
+	-0.0399760008f, 0.611235976f, -0.0565650016f, 0.66079998f, 0.595700026f, -0.763700008f, 0.0423999988f, -0.644200027f,
+	-0.0434949994f, 0.621722996f, -0.0510330014f, 0.663399994f, 0.600700021f, -0.763899982f, 0.0812999979f, -0.640200019f,
+	0.0399760008f, 0.611235976f, -0.0565650016f, 0.618600011f, 0.590399981f, 0.763899982f, 0.0350000001f, -0.644400001f,
+	0.0436110012f, 0.610997021f, -0.0522579998f, 0.616100013f, 0.5898f, 0.773199975f, 0.0390000008f, -0.633000016f,
+	0.0402880013f, 0.63013202f, -0.0546009988f, 0.616299987f, 0.598699987f, 0.84890002f, 0.0856000036f, -0.521600008f,
+	0.0426420011f, 0.634232998f, -0.0499260016f, 0.613600016f, 0.600099981f, 0.852999985f, 0.0904000029f, -0.513999999f,
+	0.0386720002f, 0.653213024f, -0.0530980006f, 0.614000022f, 0.609099984f, 0.781599998f, 0.180800006f, -0.597000003f,
+	0.0412929989f, 0.656803012f, -0.0486069992f, 0.611299992f, 0.610099971f, 0.775099993f, 0.122500002f, -0.619899988f,
+	0.0251739994f, 0.660881996f, -0.0647760034f, 0.620999992f, 0.614400029f, 0.613600016f, -0.115599997f, -0.781099975f,
+	0.0286950003f, 0.665858984f, -0.0631129965f, 0.618700027f, 0.61619997f, 0.578599989f, -0.169499993f, -0.797800004f,
+	0.0208700001f, 0.67445302f, -0.0686839968f, 0.622099996f, 0.621100008f, 0.435499996f, -0.0887999982f, -0.895799994f,
+	0.0253139995f, 0.671953022f, -0.0664220005f, 0.620100021f, 0.619499981f, 0.341399997f, -0.198699996f, -0.91869998f,
+	0.0243759993f, 0.678017974f, -0.0670809969f, 0.620000005f, 0.622300029f, 0.433699995f, -0.0307f, -0.9005f,
+	-0.0354080014f, 0.760326028f, -0.160337001f, 0.065700002f, 0.394400001f, 0.688499987f, -0.215299994f, -0.692499995f,
+	-0.0272669997f, 0.747821987f, -0.142600998f, 0.0675999969f, 0.404700011f, 0.878499985f, -0.0927999988f, -0.468600005f,
+	-0.0281370003f, 0.744817019f, -0.143636003f, 0.066200003f, 0.405200005f, 0.8671f, -0.1153f, -0.484600008f,
+	-0.0373170003f, 0.75750798f, -0.161235005f, 0.0640999973f, 0.394699991f, 0.692200005f, -0.253399998f, -0.675700009f,
+	-0.0441909991f, 0.778945982f, -0.171664998f, 0.066399999f, 0.3838f, 0.726499975f, 0.116599999f, -0.677200019f,
+	-0.0407500006f, 0.779991984f, -0.167689994f, 0.0684999973f, 0.38499999f, 0.727400005f, 0.150900006f, -0.669499993f,
+	-0.0432199985f, 0.790292978f, -0.165006995f, 0.0719000027f, 0.381399989f, 0.667500019f, 0.333400011f, -0.665799975f,
+	0.137382001f, 0.537485003f, -0.0109970002f, 0.228799999f, 0.810000002f, 0.325100005f, 0.344599992f, -0.880699992f,
+	0.136983007f, 0.531576991f, -0.0139579996f, 0.227200001f, 0.812600017f, 0.245100006f, 0.421200007f, -0.873199999f,
+	0.127847999f, 0.528237998f, -0.0181329995f, 0.222399995f, 0.812600017f, 0.313899994f, 0.355800003f, -0.880299985f,
+	0.131610006f, 0.539537013f, -0.0127560003f, 0.226500005f, 0.808300018f, 0.372799993f, 0.29460001f, -0.879899979f,
+	-0.158801004f, 0.123153001f, 0.192460999f, 0.835300028f, 0.487300009f, 0.00319999992f, 0.313499987f, 0.949599981f,
+	-0.188399002f, 0.0242199991f, 0.225431994f, 0.82190001f, 0.440100014f, 0.0037f, 0.315200001f, 0.949000001f,
+	0.192054003f, 0.0259939991f, 0.223351002f, 0.994199991f, 0.441100001f, 0.00109999999f, 0.306699991f, 0.951799989f,
+	0.154115006f, 0.120714001f, 0.193128005f, 0.976999998f, 0.486200005f, 0.000300000014f, 0.304100007f, 0.952600002f,
+	-0.167523995f, 0.120832004f, -0.184184998f, 0.719399989f, 0.652999997f, -0.507000029f, 0.415199995f, -0.755299985f,
+	-0.156955004f, 0.121234f, -0.190971002f, 0.725099981f, 0.652499974f, -0.502600014f, 0.415300012f, -0.75819999f,
+	-0.188842997f, 0.0256629996f, -0.222185001f, 0.724099994f, 0.700200021f, -0.592000008f, 0.409700006f, -0.694000006f,
+	-0.194898993f, 0.0246859994f, -0.217507005f, 0.720700026f, 0.700800002f, -0.59829998f, 0.409099996f, -0.68900001f,
+	-0.0658259988f, 0.776278019f, -0.155417994f, 0.0747999996f, 0.403600007f, 0.433099985f, -0.177100003f, -0.88380003f,
+	-0.0572779998f, 0.756156981f, -0.146433994f, 0.0763999969f, 0.393099993f, 0.554099977f, -0.1215f, -0.823499978f,
+	-0.0602729991f, 0.752848983f, -0.148001f, 0.0785000026f, 0.39289999f, 0.547999978f, -0.121699996f, -0.827600002f,
+	-0.0723899975f, 0.776905f, -0.158650994f, 0.077200003f, 0.405900002f, 0.420399994f, -0.181700006f, -0.888899982f,
+	-0.0497579984f, 0.739726007f, -0.139191002f, 0.0775000006f, 0.384299994f, 0.585200012f, -0.173199996f, -0.792200029f,
+	-0.0479359999f, 0.746528029f, -0.139336005f, 0.075000003f, 0.386299998f, 0.530700028f, -0.159899995f, -0.832400024f,
+	-0.0476219989f, 0.742982984f, -0.138061002f, 0.0756999999f, 0.3847f, 0.623300016f, -0.142000005f, -0.768999994f,
+	-0.0438680016f, 0.743658006f, -0.135521993f, 0.074000001f, 0.383700013f, 0.771000028f, -0.238600001f, -0.590399981f,
+	-0.0458009988f, 0.736304998f, -0.134917006f, 0.0766000003f, 0.381399989f, 0.656599998f, -0.231700003f, -0.717800021f,
+	-0.0419970006f, 0.746475995f, -0.133802995f, 0.0722000003f, 0.3838f, 0.835600019f, -0.259499997f, -0.484200001f,
+	-0.0274209995f, 0.275160998f, 0.0784349963f, 0.43720001f, 0.838800013f, 0.520500004f, 0.0441000015f, 0.852800012f,
+	-0.0133250002f, 0.278322011f, 0.0615530014f, 0.435099989f, 0.848699987f, 0.867399991f, -0.0533000007f, 0.494700015f,
+	-0.0105400002f, 0.294992f, 0.0584679991f, 0.42750001f, 0.850099981f, 0.917100012f, -0.0271000005f, 0.397700012f,
+	-0.0271119997f, 0.292082012f, 0.0771809965f, 0.429500014f, 0.83890003f, 0.561399996f, 0.050999999f, 0.825999975f,
+	-0.0429139994f, 0.291747987f, 0.0822850019f, 0.429899991f, 0.831399977f, -0.00430000015f, 0.0643000007f, 0.997900009f,
+	-0.0428999998f, 0.273283005f, 0.0834039971f, 0.438300014f, 0.831499994f, -0.00430000015f, 0.0604999997f, 0.998199999f,
+	-0.0063029998f, 0.278393f, 0.0351979993f, 0.434700012f, 0.861000001f, 0.98269999f, -0.00860000029f, 0.185100004f,
+	-0.00724099996f, 0.297107011f, 0.0343040004f, 0.426299989f, 0.861100018f, 0.988600016f, 0.0562000014f, 0.139899999f,
+	-0.0586719997f, 0.292050004f, 0.0770469978f, 0.429699987f, 0.823800027f, -0.610499978f, 0.0467000008f, 0.790600002f,
+	-0.0583389997f, 0.275130004f, 0.0783040002f, 0.437400013f, 0.824100018f, -0.567399979f, 0.0364000015f, 0.822600007f,
+	-0.0712440014f, 0.294126987f, 0.0593990013f, 0.42840001f, 0.814100027f, -0.959500015f, -0.0309999995f, 0.279900014f,
+	-0.0700619966f, 0.278041989f, 0.0601870008f, 0.435799986f, 0.814400017f, -0.941799998f, -0.0529000014f, 0.331999987f,
+	-0.0711989999f, 0.294672012f, 0.0380720012f, 0.428200006f, 0.804400027f, -0.999899983f, -0.0100999996f, -0.00230000005f,
+	-0.071062997f, 0.280622989f, 0.0400790013f, 0.434500009f, 0.805299997f, -0.999300003f, -0.0346999988f, 0.0148999998f,
+	0.0274209995f, 0.275160998f, 0.0784349963f, 0.41870001f, 0.594200015f, -0.520500004f, 0.0441000015f, 0.852800012f,
+	0.0271119997f, 0.292082012f, 0.0771809965f, 0.426400006f, 0.594200015f, -0.561399996f, 0.050999999f, 0.825999975f,
+	0.0105400002f, 0.294992f, 0.0584679991f, 0.428499997f, 0.583000004f, -0.917100012f, -0.0271000005f, 0.397700012f,
+	0.0133250002f, 0.278322011f, 0.0615530014f, 0.4208f, 0.584299982f, -0.867399991f, -0.0533000007f, 0.494700015f,
+	0.0429139994f, 0.291747987f, 0.0822850019f, 0.425999999f, 0.601700008f, 0.00430000015f, 0.0643000007f, 0.997900009f,
+	0.0428999998f, 0.273283005f, 0.0834039971f, 0.417699993f, 0.601499975f, 0.00430000015f, 0.0604999997f, 0.998199999f,
+	0.00724099996f, 0.297107011f, 0.0343040004f, 0.429800004f, 0.572000027f, -0.988600016f, 0.0562000014f, 0.139899999f,
+	0.0063029998f, 0.278393f, 0.0351979993f, 0.421299994f, 0.572000027f, -0.98269999f, -0.00860000029f, 0.185100004f,
+	0.0583389997f, 0.275130004f, 0.0783040002f, 0.418500006f, 0.608900011f, 0.567399979f, 0.0364000015f, 0.822600007f,
+	0.0586719997f, 0.292050004f, 0.0770469978f, 0.426200002f, 0.609200001f, 0.610499978f, 0.0467000008f, 0.790600002f,
+	0.0700619966f, 0.278041989f, 0.0601870008f, 0.42019999f, 0.618600011f, 0.941799998f, -0.0529000014f, 0.331999987f,
+	0.0712440014f, 0.294126987f, 0.0593990013f, 0.42750001f, 0.619000018f, 0.959500015f, -0.0309999995f, 0.279900014f,
+	0.071062997f, 0.280622989f, 0.0400790013f, 0.421400011f, 0.627699971f, 0.999300003f, -0.0346999988f, 0.0148999998f,
+	0.0711989999f, 0.294672012f, 0.0380720012f, 0.4278f, 0.628600001f, 0.999899983f, -0.0100999996f, -0.00230000005f,
+	0.141463995f, 0.838980019f, -0.0223660003f, 0.432200015f, 0.0754999965f, 0.602100015f, -0.165999994f, -0.781000018f,
+	0.112410001f, 0.819966972f, -0.0365790017f, 0.448300004f, 0.0768000036f, 0.526600003f, -0.361900002f, -0.769299984f,
+	0.108502999f, 0.833047986f, -0.0448919982f, 0.448700011f, 0.0698999986f, 0.532899976f, -0.319999993f, -0.783299983f,
+	0.138834f, 0.851675987f, -0.0267440006f, 0.431400001f, 0.069600001f, 0.620100021f, -0.103799999f, -0.77759999f,
+	0.151804999f, 0.84611398f, -0.01504f, 0.425999999f, 0.0754999965f, 0.658999979f, -0.00700000022f, -0.752099991f,
+	0.0812380016f, 0.824496984f, -0.058056999f, 0.462099999f, 0.067900002f, 0.452100009f, -0.47330001f, -0.755999982f,
+	0.0731180012f, 0.804139018f, -0.0490510017f, 0.467400014f, 0.0766000003f, 0.439099997f, -0.504100025f, -0.743700027f,
+	0.157866001f, 0.86469698f, -0.00869700033f, 0.418799996f, 0.070100002f, 0.689199984f, 0.0948000029f, -0.718400002f,
+	0.164106995f, 0.854689002f, -0.00424499996f, 0.417899996f, 0.0754000023f, 0.684499979f, 0.105999999f, -0.721300006f,
+	0.173997998f, 0.861172974f, 0.00757300016f, 0.411000013f, 0.0762000009f, 0.684800029f, 0.434899986f, -0.584699988f,
+	0.181015f, 0.865114987f, 0.0194690004f, 0.404599994f, 0.0769999996f, 0.853100002f, 0.0485999994f, -0.519500017f,
+	0.181089997f, 0.877655983f, 0.0196439996f, 0.402099997f, 0.0722000003f, 0.889199972f, 0.064000003f, -0.452899992f,
+	0.185063004f, 0.866958976f, 0.0303130001f, 0.400099993f, 0.0786999986f, 0.960500002f, 0.0283000004f, -0.276899993f,
+	0.185007006f, 0.87956202f, 0.0433069989f, 0.39230001f, 0.0756999999f, 0.769599974f, 0.613499999f, -0.176799998f,
+	0.187989995f, 0.875773013f, 0.0431470014f, 0.393000007f, 0.0776999965f, 0.961700022f, 0.217899993f, -0.166199997f,
+	0.186987996f, 0.86748302f, 0.0420969985f, 0.395099998f, 0.0806000009f, 0.9903f, -0.108800001f, -0.0864000022f,
+	0.187013f, 0.867810011f, 0.0483359993f, 0.392699987f, 0.0817999989f, 0.992200017f, 0.0436000004f, 0.116599999f,
+	0.192054003f, 0.0259939991f, 0.223351002f, 0.657400012f, 0.890399992f, 0.965699971f, 0.259600013f, 0.00540000014f,
+	0.196132004f, 0.0239649992f, -0.214755997f, 0.855799973f, 0.890399992f, 0.963199973f, 0.26879999f, 0.00769999996f,
+	0.168993995f, 0.120107003f, -0.175867006f, 0.837899983f, 0.935500026f, 0.96359998f, 0.26730001f, 0.0074f,
+	0.16663f, 0.122252002f, 0.184165999f, 0.674899995f, 0.935599983f, 0.966300011f, 0.257200003f, 0.00480000023f,
+	-0.0f, 0.476287991f, -0.0629379973f, 0.9296f, 0.824199975f, -0.00039999999f, -0.999800026f, -0.0208000001f,
+	-0.0f, 0.476498991f, -0.0691720024f, 0.9296f, 0.821399987f, 0.0f, -0.99940002f, -0.0339000002f,
+	0.00245700008f, 0.476913989f, -0.0686350018f, 0.930800021f, 0.821699977f, 0.181799993f, -0.982900023f, -0.0296f,
+	0.00224000006f, 0.476776987f, -0.0630469993f, 0.930700004f, 0.824199975f, 0.212400004f, -0.977100015f, -0.0157999992f,
+	-0.00245700008f, 0.476913989f, -0.0686350018f, 0.928499997f, 0.821699977f, -0.182099998f, -0.982800007f, -0.0295000002f,
+	-0.00223800004f, 0.476779014f, -0.0630469993f, 0.928600013f, 0.824199975f, -0.213400006f, -0.976800025f, -0.0153000001f,
+	-0.0189890005f, 0.685329974f, 0.0736979991f, 0.656700015f, 0.689300001f, -0.168400005f, 0.0491999984f, 0.984499991f,
+	-0.0190740004f, 0.701318979f, 0.0728349984f, 0.649399996f, 0.689300001f, -0.186199993f, 0.0326000005f, 0.981999993f,
+	0.0f, 0.685136974f, 0.0743990019f, 0.656700015f, 0.698000014f, 0.0f, 0.0055999998f, 1.0f,
+	0.0f, 0.70184201f, 0.0749489963f, 0.649200022f, 0.698000014f, 0.0f, -0.0329000019f, 0.999499977f,
+	0.0189890005f, 0.685329974f, 0.0736979991f, 0.656599998f, 0.70660001f, 0.170699999f, 0.0511999987f, 0.984000027f,
+	0.0190740004f, 0.701318979f, 0.0728349984f, 0.649399996f, 0.70660001f, 0.190200001f, 0.0324999988f, 0.98119998f,
+	0.0400939994f, 0.702674985f, 0.0660710037f, 0.648599982f, 0.716600001f, 0.456999987f, 0.0392999984f, 0.888599992f,
+	0.0403769985f, 0.685167015f, 0.0668089986f, 0.656599998f, 0.716700017f, 0.457700014f, 0.0447999984f, 0.888000011f,
+	0.0648299977f, 0.684819996f, 0.0486570001f, 0.656499982f, 0.730499983f, 0.739600003f, 0.0231999997f, 0.672599971f,
+	0.0644809976f, 0.702773988f, 0.0487499982f, 0.648299992f, 0.730199993f, 0.737100005f, 0.0108000003f, 0.675700009f,
+	0.080167003f, 0.68514502f, 0.0235259999f, 0.655900002f, 0.743900001f, 0.942399979f, 0.0372000001f, 0.332300007f,
+	0.0801509991f, 0.702993989f, 0.0218449999f, 0.647800028f, 0.744300008f, 0.954100013f, 0.0231999997f, 0.298599988f,
+	0.0824880004f, 0.703226984f, -0.0031969999f, 0.647199988f, 0.755699992f, 0.988300025f, 0.00730000017f, -0.152199998f,
+	0.082987003f, 0.685545981f, -0.00164300005f, 0.655300021f, 0.755299985f, 0.992500007f, 0.0174000002f, -0.120999999f,
+	0.0713180006f, 0.684786975f, -0.0307390001f, 0.654799998f, 0.769500017f, 0.829299986f, -0.0151000004f, -0.558600008f,
+	0.0712110028f, 0.703661025f, -0.0319009982f, 0.646300018f, 0.769599974f, 0.815999985f, -0.0308999997f, -0.577300012f,
+	0.0488060005f, 0.685220003f, -0.0528779998f, 0.653999984f, 0.783800006f, 0.557399988f, 0.0185000002f, -0.829999983f,
+	0.0476429984f, 0.703902006f, -0.0531280003f, 0.645600021f, 0.783900023f, 0.54339999f, 0.0105999997f, -0.839399993f,
+	0.029228f, 0.706466019f, -0.0611840002f, 0.643999994f, 0.792999983f, 0.392699987f, 0.00240000011f, -0.919700027f,
+	0.0300980005f, 0.682982028f, -0.0606469996f, 0.654600024f, 0.792999983f, 0.384200007f, -0.00689999992f, -0.923200011f,
+	0.137271002f, 0.131125003f, -0.144308999f, 0.843200028f, 0.945599973f, 0.972800016f, 0.220899999f, -0.0705000013f,
+	0.111372001f, 0.214886993f, -0.128496006f, 0.837599993f, 0.985499978f, 0.727400005f, 0.337700009f, -0.59740001f,
+	0.118937001f, 0.220962003f, -0.115851998f, 0.830500007f, 0.987200022f, 0.936999977f, 0.263799995f, -0.229100004f,
+	0.120159f, 0.220406994f, 0.116948001f, 0.725099981f, 0.987399995f, 0.979499996f, 0.201399997f, -0.00469999993f,
+	0.138992995f, 0.129521996f, 0.147799999f, 0.710900009f, 0.9454f, 0.979499996f, 0.201399997f, -0.00469999993f,
+	0.092730999f, 0.884657979f, 0.041627001f, 0.346300006f, 0.462700009f, 0.446200013f, -0.894800007f, 0.0159000009f,
+	0.105628997f, 0.891496003f, 0.0432600006f, 0.346100003f, 0.456f, 0.470899999f, -0.881799996f, -0.0274999999f,
+	0.105425999f, 0.882984996f, 0.0715259984f, 0.360300004f, 0.457399994f, 0.467500001f, -0.790899992f, -0.394899994f,
+	0.0929540023f, 0.878866971f, 0.0663210005f, 0.357300013f, 0.463099986f, 0.42840001f, -0.821500003f, -0.376399994f,
+	0.0904079974f, 0.877986014f, 0.0176059995f, 0.336600006f, 0.467599988f, 0.419800013f, -0.827899992f, 0.372099996f,
+	0.105039999f, 0.883938015f, 0.0162090007f, 0.333499998f, 0.460999995f, 0.390799999f, -0.858900011f, 0.331099987f,
+	0.104503997f, 0.871680021f, 0.0876609981f, 0.368900001f, 0.462599993f, 0.579599977f, -0.532999992f, -0.616400003f,
+	0.0911609977f, 0.866136014f, 0.0807840005f, 0.363799989f, 0.467700005f, 0.536599994f, -0.501800001f, -0.678499997f,
+	0.103182003f, 0.848702013f, 0.099183999f, 0.37529999f, 0.4736f, 0.652800024f, -0.242799997f, -0.717499971f,
+	0.0890140012f, 0.838108003f, 0.0898770019f, 0.368400007f, 0.479499996f, 0.597199976f, -0.102799997f, -0.795400023f,
+	0.100262001f, 0.810083985f, 0.0968869999f, 0.374599993f, 0.4921f, 0.601400018f, 0.229100004f, -0.765399992f,
+	0.0874309987f, 0.809781015f, 0.0866219997f, 0.367199987f, 0.49180001f, 0.578499973f, 0.356400013f, -0.733699977f,
+	0.0989430025f, 0.792406976f, 0.0836799964f, 0.368600011f, 0.50120002f, 0.606599987f, 0.625f, -0.491299987f,
+	0.0868330002f, 0.797634006f, 0.0760480016f, 0.363099992f, 0.497000009f, 0.548099995f, 0.731899977f, -0.404799998f,
+	0.0978429988f, 0.782151997f, 0.0492679998f, 0.352800012f, 0.5079f, 0.6171f, 0.783100009f, -0.0771000013f,
+	0.0860600024f, 0.790462971f, 0.0414259993f, 0.348399997f, 0.501800001f, 0.51700002f, 0.851300001f, 0.0895999968f,
+	0.0982460007f, 0.791172981f, 0.0126400003f, 0.335000008f, 0.506399989f, 0.569299996f, 0.707899988f, 0.418000013f,
+	0.0890600011f, 0.796733975f, 0.0157340001f, 0.336899996f, 0.501699984f, 0.568300009f, 0.710600019f, 0.414799988f,
+	0.099545002f, 0.807690024f, -0.00440400001f, 0.325599998f, 0.499599993f, 0.587899983f, 0.480599999f, 0.65079999f,
+	0.0906289965f, 0.818122983f, -0.00369399996f, 0.327300012f, 0.493699998f, 0.610499978f, 0.347799987f, 0.711499989f,
+	0.1008f, 0.824102998f, -0.0139640002f, 0.320600003f, 0.49180001f, 0.616900027f, 0.179900005f, 0.766200006f,
+	0.0905800015f, 0.844870985f, -0.00790499989f, 0.325500011f, 0.481999993f, 0.612100005f, -0.136600003f, 0.778900027f,
+	0.102307998f, 0.846008003f, -0.0161550008f, 0.319099993f, 0.48120001f, 0.578800023f, -0.137500003f, 0.803799987f,
+	0.103074998f, 0.859629989f, -0.0114120003f, 0.321200013f, 0.474299997f, 0.562900007f, -0.399899989f, 0.72329998f,
+	0.089011997f, 0.866227984f, 0.00385199999f, 0.331099987f, 0.47299999f, 0.532400012f, -0.560800016f, 0.63410002f,
+	0.104006f, 0.874439001f, 9.69999965e-05f, 0.326299995f, 0.466699988f, 0.463400006f, -0.668600023f, 0.58160001f,
+	-0.088082999f, 0.680458009f, 0.0591350012f, 0.234400004f, 0.952600002f, -0.792900026f, -0.324999988f, 0.515399992f,
+	-0.0895719975f, 0.676898003f, 0.0552939996f, 0.232600003f, 0.954299986f, -0.743099988f, -0.322100013f, 0.586600006f,
+	-0.0860510021f, 0.673691988f, 0.0579940006f, 0.231099993f, 0.952300012f, -0.787299991f, -0.324800014f, 0.524100006f,
+	-0.0859180018f, 0.677586019f, 0.0611979999f, 0.233099997f, 0.951200008f, -0.841899991f, -0.325399995f, 0.430400014f,
+	0.158519998f, 0.122040004f, -0.188996002f, 0.977500021f, 0.496499985f, 0.000600000028f, 0.323599994f, -0.946200013f,
+	0.191685006f, 0.0243309997f, -0.222718f, 0.992500007f, 0.543299973f, -0.000199999995f, 0.326200008f, -0.945299983f,
+	-0.188842997f, 0.0256629996f, -0.222185001f, 0.820200026f, 0.542699993f, 0.00389999989f, 0.312900007f, -0.949800014f,
+	-0.156955004f, 0.121234f, -0.190971002f, 0.834599972f, 0.497200012f, 0.00520000001f, 0.308899999f, -0.951099992f,
+	0.0864979997f, 0.605844975f, -0.0445239991f, 0.2236f, 0.76910001f, 0.708899975f, -0.255199999f, -0.657500029f,
+	0.0830499977f, 0.607396007f, -0.0488439985f, 0.226199999f, 0.769500017f, 0.532299995f, -0.237299994f, -0.812699974f,
+	0.0842289999f, 0.611166f, -0.0490359999f, 0.226099998f, 0.771300018f, 0.441199988f, -0.182699993f, -0.878600001f,
+	0.0755650029f, 0.613143027f, -0.0511440001f, 0.230299994f, 0.771200001f, 0.068599999f, -0.292400002f, -0.953800023f,
+	0.0749540031f, 0.621002972f, -0.0535969995f, 0.231600001f, 0.774699986f, 0.148200005f, -0.246399999f, -0.957799971f,
+	0.0705009997f, 0.322836012f, 0.0206819996f, 0.3222f, 0.556699991f, 0.37560001f, -0.145300001f, -0.915300012f,
+	0.0715060011f, 0.291615009f, 0.0227579996f, 0.321500003f, 0.570800006f, 0.546299994f, -0.0379999988f, -0.836700022f,
+	0.0660220012f, 0.297140002f, 0.0189260002f, 0.324499995f, 0.568300009f, 0.52759999f, -0.0339000002f, -0.848800004f,
+	0.065076001f, 0.321904004f, 0.0187100004f, 0.324800014f, 0.557099998f, 0.349000007f, -0.112000003f, -0.930400014f,
+	0.0766599998f, 0.358456999f, 0.0129009997f, 0.32069999f, 0.540000021f, 0.244599998f, -0.279500008f, -0.928499997f,
+	0.0696080029f, 0.356667012f, 0.0115440004f, 0.323900014f, 0.540899992f, 0.245499998f, -0.258599997f, -0.934300005f,
+	0.075048998f, 0.38786301f, 0.0025549999f, 0.322899997f, 0.526000023f, 0.1065f, -0.324800014f, -0.939800024f,
+	0.0819270015f, 0.391957015f, 0.00179500005f, 0.319900006f, 0.523899972f, 0.0900999978f, -0.326099992f, -0.940999985f,
+	-0.0705009997f, 0.322836012f, 0.0206819996f, 0.4463f, 0.828400016f, -0.37560001f, -0.145300001f, -0.915300012f,
+	-0.065076001f, 0.321904004f, 0.0187100004f, 0.443699986f, 0.828000009f, -0.349000007f, -0.112000003f, -0.930400014f,
+	-0.0660220012f, 0.297140002f, 0.0189260002f, 0.444000006f, 0.816699982f, -0.52759999f, -0.0339000002f, -0.848800004f,
+	-0.0715060011f, 0.291615009f, 0.0227579996f, 0.446999997f, 0.814199984f, -0.546299994f, -0.0379999988f, -0.836700022f,
+	-0.0766599998f, 0.358456999f, 0.0129009997f, 0.447899997f, 0.845099986f, -0.244599998f, -0.279500008f, -0.928499997f,
+	-0.0696080029f, 0.356667012f, 0.0115440004f, 0.444700003f, 0.844200015f, -0.245499998f, -0.258599997f, -0.934300005f,
+	-0.0819270015f, 0.391957015f, 0.00179500005f, 0.448700011f, 0.861299992f, -0.0900999978f, -0.326099992f, -0.940999985f,
+	-0.075048998f, 0.38786301f, 0.0025549999f, 0.445800006f, 0.859099984f, -0.1065f, -0.324800014f, -0.939800024f,
+	0.110614002f, 0.221943006f, 0.127933994f, 0.628400028f, 0.513700008f, 0.730700016f, 0.350300014f, 0.585900009f,
+	0.138992995f, 0.129521996f, 0.147799999f, 0.629899979f, 0.469000012f, 0.730700016f, 0.350300014f, 0.585900009f,
+	0.120159f, 0.220406994f, 0.116948001f, 0.63499999f, 0.513000011f, 0.730700016f, 0.350300014f, 0.585900009f,
+	-0.0918620005f, 0.651493013f, 0.0561439991f, 0.229100004f, 0.846199989f, -0.689800024f, -0.700900018f, 0.181299999f,
+	-0.0979399979f, 0.658670008f, 0.0540009998f, 0.224800006f, 0.845300019f, -0.925999999f, -0.376399994f, -0.0288999993f,
+	-0.0980890021f, 0.658945978f, 0.0482529998f, 0.224700004f, 0.842700005f, -0.959200025f, -0.280699998f, 0.0348000005f,
+	-0.09155f, 0.649757981f, 0.0507140011f, 0.229800001f, 0.843699992f, -0.712499976f, -0.679199994f, 0.176100001f,
+	-0.0824270025f, 0.644809008f, 0.0558560006f, 0.234300002f, 0.846300006f, -0.532000005f, -0.76639998f, 0.360000014f,
+	-0.079824999f, 0.645523012f, 0.0606600009f, 0.234999999f, 0.848699987f, -0.522899985f, -0.755200028f, 0.395300001f,
+	-0.0978239998f, 0.667807996f, 0.0487239994f, 0.220699996f, 0.842899978f, -0.964900017f, 0.250800014f, -0.0782999992f,
+	-0.0987370014f, 0.666957021f, 0.0546049997f, 0.221100003f, 0.845600009f, -0.969200015f, 0.199200004f, -0.144999996f,
+	-0.0935249999f, 0.675348997f, 0.0505129993f, 0.216700003f, 0.843599975f, -0.870199978f, 0.47240001f, -0.139699996f,
+	-0.0955160037f, 0.67375201f, 0.0556100011f, 0.217600003f, 0.846000016f, -0.873099983f, 0.443800002f, -0.202000007f,
+	-0.0522489995f, 0.528563976f, -0.0371490009f, 0.726899981f, 0.0795999989f, -0.0566999987f, -0.155100003f, -0.986299992f,
+	-0.01798f, 0.527862012f, -0.0205329992f, 0.711600006f, 0.0759000033f, 0.650399983f, 0.0092000002f, -0.759500027f,
+	-0.0149180004f, 0.49070999f, -0.0175650008f, 0.712599993f, 0.0593999997f, 0.560500026f, -0.222000003f, -0.797800004f,
+	-0.0519040003f, 0.490541011f, -0.0259390008f, 0.729600012f, 0.0626000017f, -0.206599995f, -0.2949f, -0.932900012f,
+	-0.0765239969f, 0.49346301f, -0.00848999992f, 0.743499994f, 0.0645999983f, -0.789600015f, -0.319900006f, -0.523599982f,
+	-0.0845019966f, 0.527396023f, -0.0179510005f, 0.742200017f, 0.0800999999f, -0.780900002f, -0.226199999f, -0.582300007f,
+	-0.0179939996f, 0.455460012f, -0.00243499991f, 0.71390003f, 0.0425000004f, 0.675199986f, -0.273699999f, -0.684899986f,
+	-0.00923800003f, 0.457783014f, 0.011953f, 0.705500007f, 0.0405000001f, 0.941100001f, -0.197400004f, -0.274699986f,
+	-0.00246499991f, 0.491616994f, -0.00190300005f, 0.703700006f, 0.0577000007f, 0.931400001f, -0.135700002f, -0.337799996f,
+	-0.0472230017f, 0.450654f, -0.0202680007f, 0.729900002f, 0.0452000014f, -0.114f, -0.277799994f, -0.953800023f,
+	-0.0673440024f, 0.455832988f, 0.00243099988f, 0.744400024f, 0.0467999987f, -0.840600014f, -0.216900006f, -0.496399999f,
+	-0.082777001f, 0.496012986f, 0.0159760006f, 0.755200028f, 0.0649000034f, -0.962700009f, -0.215000004f, 0.164399996f,
+	-0.0912349969f, 0.529183984f, 0.0094440002f, 0.753400028f, 0.0804999992f, -0.979900002f, -0.152099997f, 0.128999993f,
+	-0.0659869984f, 0.524556994f, 0.0528660007f, 0.774299979f, 0.0768999979f, -0.551900029f, -0.125300005f, 0.824500024f,
+	-0.0603770018f, 0.493303001f, 0.0478780009f, 0.772800028f, 0.0615000017f, -0.546599984f, -0.0781000033f, 0.833700001f,
+	-0.0732040033f, 0.452903986f, 0.0242030006f, 0.755699992f, 0.0443000011f, -0.992500007f, 0.0870999992f, 0.0854000002f,
+	-0.0580860004f, 0.457879007f, 0.0510069989f, 0.771700025f, 0.0441999994f, -0.592700005f, 0.285600007f, 0.753099978f,
+	-0.0682889968f, 0.437667996f, 0.0103259999f, 0.745800018f, 0.0384000018f, -0.818700016f, -0.226400003f, -0.52759999f,
+	-0.0776989982f, 0.43789199f, 0.0311699994f, 0.756299973f, 0.0364999995f, -0.984600008f, 0.174899995f, 0.0027999999f,
+	-0.0467739999f, 0.434507996f, -0.0128450003f, 0.730799973f, 0.0383000001f, -0.127200007f, -0.416099995f, -0.900399983f,
+	-0.0677359998f, 0.41850999f, 0.0197749995f, 0.747099996f, 0.0291000009f, -0.789799988f, -0.219799995f, -0.572600007f,
+	-0.0794989988f, 0.421626002f, 0.0386070013f, 0.757200003f, 0.0285999998f, -0.99849999f, 0.0504000001f, -0.0234999992f,
+	-0.0665490031f, 0.424407005f, 0.0651080012f, 0.769900024f, 0.0267999992f, -0.629199982f, 0.247199997f, 0.736899972f,
+	-0.0627280027f, 0.444344014f, 0.0572570004f, 0.770500004f, 0.0366000012f, -0.612800002f, 0.437999994f, 0.657700002f,
+	-0.0225939993f, 0.460375011f, 0.0589650013f, 0.790199995f, 0.0439999998f, 0.433200002f, 0.344399989f, 0.832899988f,
+	-0.0250509996f, 0.500939012f, 0.0553780012f, 0.790000021f, 0.063500002f, 0.355599999f, -0.00630000001f, 0.934599996f,
+	-0.023085f, 0.446718991f, 0.069986999f, 0.789600015f, 0.0359000005f, 0.292400002f, 0.490799993f, 0.82069999f,
+	-0.0252470002f, 0.429946005f, 0.0771970004f, 0.788800001f, 0.0282000005f, 0.225199997f, 0.194199994f, 0.95480001f,
+	-0.0675109997f, 0.399477005f, 0.0678360015f, 0.76880002f, 0.0160000008f, -0.60680002f, 0.0957999974f, 0.789099991f,
+	-0.0797279999f, 0.40229699f, 0.0459569991f, 0.758300006f, 0.0196000002f, -0.995500028f, 0.0151000004f, 0.0935000032f,
+	-0.0692169964f, 0.398831993f, 0.0262860004f, 0.748600006f, 0.0199999996f, -0.808000028f, -0.148900002f, -0.569999993f,
+	-0.0463859998f, 0.397803009f, 0.00234799995f, 0.734000027f, 0.0208000001f, -0.298000008f, -0.316399992f, -0.900600016f,
+	-0.0461569987f, 0.417017996f, -0.00482999999f, 0.73210001f, 0.0299999993f, -0.194199994f, -0.342400014f, -0.91930002f,
+	-0.0140140001f, 0.402319998f, 0.0120660001f, 0.719200015f, 0.0175000001f, 0.553499997f, -0.190899998f, -0.810699999f,
+	-0.0185979996f, 0.439404994f, 0.00365699991f, 0.715399981f, 0.0348000005f, 0.702000022f, -0.186700001f, -0.687300026f,
+	-0.0157650001f, 0.421853006f, 0.00675299997f, 0.717199981f, 0.0266999993f, 0.630100012f, -0.0524999984f, -0.774699986f,
+	-0.001361f, 0.401174992f, 0.0247009993f, 0.712400019f, 0.0133999996f, 0.185800001f, 0.182600006f, -0.965499997f,
+	-0.00766499992f, 0.439518005f, 0.0242849998f, 0.705200016f, 0.0300999992f, 0.949100018f, 0.121699996f, -0.290399998f,
+	0.000296999991f, 0.42167601f, 0.0304220002f, 0.70569998f, 0.0205000006f, 0.0189999994f, 0.4296f, -0.902800024f,
+	-0.0273550004f, 0.403586f, 0.077862002f, 0.787699997f, 0.0164000001f, 0.209700003f, 0.0566999987f, 0.976100028f,
+	0.000406000006f, 0.429446995f, 0.0514749996f, 0.804700017f, 0.0296999998f, 0.0922999978f, 0.700399995f, 0.707799971f,
+	-0.000433000008f, 0.400554001f, 0.0586390011f, 0.8028f, 0.0154999997f, -0.0546999983f, 0.189799994f, 0.980300009f,
+	-0.0065299999f, 0.443136007f, 0.0425609984f, 0.804099977f, 0.0386999995f, 0.91079998f, 0.384900004f, 0.149100006f,
+	-0.00902900007f, 0.457702011f, 0.0355120003f, 0.804099977f, 0.0456999987f, 0.970899999f, 0.0775000006f, 0.226600006f,
+	-0.00433799997f, 0.503597975f, 0.0279460009f, 0.805400014f, 0.0658000037f, 0.941200018f, -0.0709000006f, 0.330300003f,
+	-0.0252190009f, 0.532299995f, 0.0590160005f, 0.791599989f, 0.0790999979f, 0.346100003f, -0.060800001f, 0.936200023f,
+	-0.00070199999f, 0.53320998f, 0.0326879993f, 0.806400001f, 0.0790000036f, 0.0171000008f, -0.2377f, 0.971199989f,
+	-0.0660799965f, 0.570466995f, 0.0551379994f, 0.776499987f, 0.0979999974f, -0.499000013f, 0.0684999973f, 0.863900006f,
+	-0.0242369995f, 0.571667016f, 0.0562659986f, 0.793900013f, 0.0980999991f, 0.349400014f, 0.0961000025f, 0.931999981f,
+	0.000398000004f, 0.570064008f, 0.0352640003f, 0.808000028f, 0.0966999978f, 0.00240000011f, 0.0790000036f, 0.996900022f,
+	-0.0218880009f, 0.608087003f, 0.0491579995f, 0.795599997f, 0.116099998f, 0.406300008f, -0.127100006f, 0.904900014f,
+	-0.0608510002f, 0.606858015f, 0.0497089997f, 0.776799977f, 0.115199998f, -0.441799998f, 0.140599996f, 0.885999978f,
+	0.000530000019f, 0.609044015f, 0.0264320001f, 0.811500013f, 0.115400001f, -0.0119000003f, -0.263799995f, 0.96450001f,
+	0.00165700004f, 0.632471025f, 0.0552170016f, 0.804499984f, 0.130999997f, -0.0773999989f, -0.4542f, 0.887600005f,
+	-0.0286209993f, 0.631465971f, 0.0665630028f, 0.790400028f, 0.1294f, -0.0671999976f, -0.331499994f, 0.940999985f,
+	-0.0597219989f, 0.63241899f, 0.0494720004f, 0.774800003f, 0.127499998f, -0.633300006f, -0.0296999998f, 0.773400009f,
+	-0.0265519992f, 0.672262013f, 0.0669839978f, 0.788600028f, 0.147799999f, -0.149100006f, 0.100199997f, 0.983699977f,
+	-0.0594180003f, 0.673471987f, 0.0469160005f, 0.771399975f, 0.146599993f, -0.718699992f, 0.0865999982f, 0.689899981f,
+	0.00271699997f, 0.677691996f, 0.0621649995f, 0.801100016f, 0.152199998f, -0.0984999985f, 0.0184000004f, 0.995000005f,
+	-0.0286720004f, 0.714851022f, 0.0528380014f, 0.783299983f, 0.167899996f, -0.318699986f, 0.0384999998f, 0.947099984f,
+	-0.0588430017f, 0.714761019f, 0.0391740017f, 0.767400026f, 0.166099995f, -0.716799974f, 0.124300003f, 0.686100006f,
+	-0.0759489983f, 0.713227987f, 0.00778800016f, 0.750699997f, 0.163000003f, -0.975499988f, 0.183400005f, 0.1215f,
+	-0.0623320006f, 0.751290023f, 0.0361079983f, 0.762899995f, 0.183799997f, -0.826099992f, -0.345899999f, 0.444900006f,
+	-0.0684269965f, 0.746383011f, -0.00277999998f, 0.745000005f, 0.177599996f, -0.997799993f, 0.00779999979f, -0.0658999979f,
+	-0.0302809998f, 0.750624001f, 0.0613080002f, 0.782299995f, 0.185599998f, -0.336100012f, -0.311100006f, 0.888999999f,
+	0.000755999994f, 0.718659997f, 0.0593420006f, 0.797399998f, 0.170900002f, -0.0172000006f, 0.00139999995f, 0.999899983f,
+	-0.0705839992f, 0.770111978f, -0.00606000004f, 0.740999997f, 0.187000006f, -0.974399984f, -0.192200005f, -0.116499998f,
+	-0.0776629969f, 0.774268985f, 0.0433599986f, 0.75880003f, 0.197899997f, -0.743700027f, -0.556999981f, 0.369800001f,
+	-0.062167f, 0.767494023f, -0.0312939994f, 0.730700016f, 0.185299993f, -0.827099979f, -0.195199996f, -0.527100027f,
+	-0.0605130009f, 0.744450986f, -0.0251390003f, 0.733299971f, 0.175999999f, -0.869899988f, -0.0231999997f, -0.492599994f,
+	-0.046484001f, 0.767871022f, -0.0473010018f, 0.721400023f, 0.1866f, -0.610599995f, -0.174500003f, -0.772499979f,
+	-0.001039f, 0.753270984f, 0.0628369972f, 0.795799971f, 0.186800003f, -0.00630000001f, -0.280800015f, 0.959699988f,
+	-0.0246719997f, 0.774182022f, 0.0733750015f, 0.786000013f, 0.198400006f, -0.162400007f, -0.385899991f, 0.908100009f,
+	-0.0020359999f, 0.776104987f, 0.0717379972f, 0.795899987f, 0.197999999f, -0.0138999997f, -0.395300001f, 0.91839999f,
+	0.129081994f, 0.834730983f, -0.0123709999f, 0.858200014f, 0.198599994f, 0.273600012f, 0.547500014f, -0.790799975f,
+	0.106374003f, 0.813344002f, -0.0264800005f, 0.866100013f, 0.212300003f, -0.307500005f, 0.431899995f, -0.847899973f,
+	0.0947830006f, 0.839815974f, -0.00935999956f, 0.851400018f, 0.212699994f, -0.295300007f, 0.43599999f, -0.850099981f,
+	0.106372997f, 0.868054986f, 0.00709300023f, 0.842100024f, 0.202299997f, -0.0250000004f, 0.755500019f, -0.654699981f,
+	0.150493994f, 0.845252991f, 0.00941000041f, 0.849799991f, 0.187800005f, 0.735300004f, 0.526799977f, -0.426499993f,
+	0.0849429965f, 0.871151984f, 0.0219509993f, 0.836799979f, 0.205799997f, -0.187099993f, 0.852100015f, -0.488900006f,
+	0.128662005f, 0.880111992f, 0.0348230004f, 0.832700014f, 0.192000002f, 0.408899993f, 0.900200009f, -0.149599999f,
+	0.0914179981f, 0.880774021f, 0.0503330007f, 0.822700024f, 0.201100007f, 0.0217000004f, 0.999800026f, -0.00529999984f,
+	0.163321003f, 0.825878024f, 0.0359189995f, 0.84740001f, 0.1752f, 0.975300014f, 0.186399996f, 0.118500002f,
+	0.151932001f, 0.794813991f, -0.0193109997f, 0.87349999f, 0.185699999f, 0.772599995f, 0.381199986f, -0.507700026f,
+	0.145009995f, 0.859459996f, 0.0713680014f, 0.828100026f, 0.178499997f, 0.696500003f, 0.467700005f, 0.54430002f,
+	0.0943540037f, 0.873376012f, 0.0803550035f, 0.811600029f, 0.189999998f, 0.257200003f, 0.683099985f, 0.683499992f,
+	0.128813997f, 0.817574978f, 0.0861679986f, 0.827499986f, 0.162300006f, 0.450599998f, -0.183200002f, 0.873700023f,
+	0.156764001f, 0.788652003f, 0.0508040003f, 0.850300014f, 0.160600007f, 0.780099988f, -0.3046f, 0.546500027f,
+	0.162189007f, 0.786602974f, -0.00104600005f, 0.869300008f, 0.174799994f, 0.981400013f, 0.129500002f, -0.141800001f,
+	0.150927007f, 0.774185002f, -0.0407590009f, 0.885299981f, 0.186800003f, 0.688899994f, 0.550899982f, -0.471100003f,
+	0.159603998f, 0.76442802f, 0.0210350007f, 0.866400003f, 0.160500005f, 0.850399971f, -0.433499992f, 0.298200011f,
+	0.161845997f, 0.76059401f, -0.027392f, 0.88380003f, 0.174999997f, 0.993300021f, 0.057599999f, -0.100199997f,
+	0.101461001f, 0.783092022f, 0.0710330009f, 0.832300007f, 0.143399999f, -0.0170000009f, -0.843800008f, 0.53640002f,
+	0.129708007f, 0.769248009f, 0.0521899983f, 0.850499988f, 0.148000002f, 0.0255999994f, -0.799799979f, 0.599699974f,
+	0.142605007f, 0.753443003f, 0.0253619999f, 0.866599977f, 0.152099997f, 0.169799998f, -0.868399978f, 0.465799987f,
+	0.154384002f, 0.74633199f, -0.0136329997f, 0.8829f, 0.163599998f, 0.741299987f, -0.58829999f, 0.323199987f,
+	0.162362993f, 0.736711979f, -0.0511589982f, 0.896700025f, 0.174799994f, 0.976199985f, -0.100299999f, -0.192100003f,
+	0.150821f, 0.756596029f, -0.0605200008f, 0.896200001f, 0.185900003f, 0.790899992f, 0.413700014f, -0.450899988f,
+	0.139763996f, 0.750267982f, -0.0831580013f, 0.906899989f, 0.189300001f, 0.705299973f, 0.319499999f, -0.6329f,
+	0.156939998f, 0.724071026f, -0.0428179987f, 0.897099972f, 0.169f, 0.700600028f, -0.670700014f, 0.243599996f,
+	0.150029004f, 0.728681028f, -0.0742959976f, 0.906799972f, 0.178900003f, 0.821799994f, -0.226799995f, -0.522700012f,
+	0.134838f, 0.74050498f, -0.00502699986f, 0.882799983f, 0.152099997f, -0.059799999f, -0.870400012f, 0.488799989f,
+	0.123225003f, 0.752623022f, 0.00417099986f, 0.875400007f, 0.143299997f, -0.637000024f, -0.681599975f, 0.360000014f,
+	0.127581f, 0.72518599f, -0.0298129991f, 0.897099972f, 0.154899999f, 0.0137999998f, -0.799000025f, 0.601100028f,
+	0.120265998f, 0.742618978f, -0.0159869995f, 0.888000011f, 0.144800007f, -0.601499975f, -0.539499998f, 0.589299977f,
+	0.141404003f, 0.708953977f, -0.062295001f, 0.908599973f, 0.169599995f, 0.527400017f, -0.8495f, 0.0108000003f,
+	0.108571f, 0.737906992f, -0.112891003f, 0.926599979f, 0.194600001f, 0.54460001f, 0.223900005f, -0.808300018f,
+	0.114779003f, 0.717342019f, -0.108980998f, 0.928499997f, 0.184300005f, 0.6329f, -0.281399995f, -0.721300006f,
+	0.0817850009f, 0.727567971f, -0.129693002f, 0.941699982f, 0.197999999f, 0.421600014f, 0.291500002f, -0.858699977f,
+	0.0845249966f, 0.708037972f, -0.121802002f, 0.944500029f, 0.177100003f, 0.355800003f, -0.680199981f, -0.640799999f,
+	0.0883930027f, 0.716224015f, -0.125217006f, 0.942399979f, 0.186800003f, 0.514199972f, -0.25850001f, -0.817799985f,
+	0.109205f, 0.698024988f, -0.0967900008f, 0.929099977f, 0.172800004f, 0.403400004f, -0.864600003f, -0.299499989f,
+	0.113118999f, 0.708526015f, -0.0502710007f, 0.91109997f, 0.157499999f, -0.0126999998f, -0.878099978f, 0.478199989f,
+	0.111901999f, 0.728375971f, -0.0290770009f, 0.899200022f, 0.1479f, -0.388099998f, -0.516300023f, 0.763400018f,
+	0.0936639979f, 0.715803981f, -0.0477739982f, 0.913500011f, 0.149399996f, -0.52579999f, -0.56370002f, 0.637000024f,
+	0.0909349993f, 0.695972979f, -0.0866229981f, 0.930800021f, 0.163100004f, -0.158700004f, -0.965300024f, 0.207200006f,
+	0.0713680014f, 0.699014008f, -0.113761999f, 0.945299983f, 0.1646f, -0.190799996f, -0.978799999f, -0.0746000037f,
+	0.0587269999f, 0.70679301f, -0.109389f, 0.946399987f, 0.155300006f, -0.640200019f, -0.662999988f, 0.388000011f,
+	0.0745889992f, 0.708450973f, -0.0821499974f, 0.932200015f, 0.152999997f, -0.645799994f, -0.60619998f, 0.464100003f,
+	0.0905949995f, 0.738762021f, -0.0447270013f, 0.907800019f, 0.137999997f, -0.774200022f, 0.0965000018f, 0.625500023f,
+	0.0783419982f, 0.734812021f, -0.0588349998f, 0.919200003f, 0.138899997f, -0.836600006f, 0.0760999992f, 0.542599976f,
+	0.100652002f, 0.750473022f, -0.0321099982f, 0.895399988f, 0.1347f, -0.8574f, -0.0278999992f, 0.513800025f,
+	0.109696999f, 0.763275981f, -0.0167159997f, 0.881600022f, 0.132499993f, -0.853100002f, -0.351399988f, 0.385699987f,
+	0.112775996f, 0.774605989f, 0.0225789994f, 0.859399974f, 0.136199996f, -0.653699994f, -0.746100008f, 0.127100006f,
+	0.102908f, 0.784346998f, 0.00132599997f, 0.865400016f, 0.127200007f, -0.814899981f, -0.579400003f, 0.0146000003f,
+	0.0927909985f, 0.784861028f, 0.0338799991f, 0.845099986f, 0.129600003f, -0.0447999984f, -0.997200012f, -0.0595999993f,
+	0.0909660012f, 0.797425985f, 0.00726900017f, 0.856700003f, 0.121200003f, -0.00499999989f, -0.924899995f, -0.380199999f,
+	0.0761429965f, 0.789454997f, 0.0795470029f, 0.818000019f, 0.141299993f, 0.0491999984f, -0.75940001f, 0.648699999f,
+	0.0793600008f, 0.776915014f, 0.0302610006f, 0.838500023f, 0.123199999f, 0.595099986f, -0.80250001f, -0.0430999994f,
+	0.0832900032f, 0.784249008f, 0.000934000011f, 0.852100015f, 0.115800001f, 0.885200024f, -0.409299999f, -0.221300006f,
+	0.0870440006f, 0.832644999f, 0.0949769989f, 0.808300018f, 0.165999994f, 0.181799993f, -0.0230999999f, 0.983099997f,
+	-0.167523995f, 0.120832004f, -0.184184998f, 0.808099985f, 0.835300028f, -0.960799992f, 0.277399987f, -0.000300000014f,
+	-0.194898993f, 0.0246859994f, -0.217507005f, 0.823300004f, 0.880599976f, -0.961700022f, 0.274199992f, -0.00109999999f,
+	-0.195466995f, 0.0245220009f, 0.219550997f, 0.625400007f, 0.881099999f, -0.95599997f, 0.293300003f, 0.00380000006f,
+	-0.164480001f, 0.124410003f, 0.187105998f, 0.639999986f, 0.833700001f, -0.954599977f, 0.297800004f, 0.00499999989f,
+	0.154115006f, 0.120714001f, 0.193128005f, 0.745000005f, 0.697700024f, 0.487699986f, 0.4366f, 0.755999982f,
+	0.192054003f, 0.0259939991f, 0.223351002f, 0.749499977f, 0.649699986f, 0.487699986f, 0.4366f, 0.755999982f,
+	0.16663f, 0.122252002f, 0.184165999f, 0.751999974f, 0.698099971f, 0.487699986f, 0.4366f, 0.755999982f,
+	0.158519998f, 0.122040004f, -0.188996002f, 0.703700006f, 0.533500016f, 0.741900027f, 0.421499997f, -0.521499991f,
+	0.168993995f, 0.120107003f, -0.175867006f, 0.69599998f, 0.533500016f, 0.738099992f, 0.421499997f, -0.526799977f,
+	0.196132004f, 0.0239649992f, -0.214755997f, 0.69660002f, 0.485000014f, 0.795400023f, 0.4199f, -0.437099993f,
+	0.191685006f, 0.0243309997f, -0.222718f, 0.700699985f, 0.484400004f, 0.800599992f, 0.419400007f, -0.427899987f,
+	-0.0779599994f, 0.686878026f, -0.0534510016f, 0.0989999995f, 0.967700005f, -0.9005f, -0.348500013f, -0.259900004f,
+	-0.0796660036f, 0.686500013f, -0.0469090007f, 0.0962999985f, 0.969200015f, -0.899900019f, -0.353700012f, -0.255199999f,
+	-0.0855569988f, 0.697323024f, -0.0411360003f, 0.0910999998f, 0.965799987f, -0.9005f, -0.325100005f, -0.288700014f,
+	-0.0852110013f, 0.699020982f, -0.0442770012f, 0.0921000019f, 0.96450001f, -0.902199984f, -0.3301f, -0.277700007f,
+	-0.0961230025f, 0.717413008f, -0.0307759997f, 0.0817999989f, 0.959399998f, -0.875400007f, -0.245900005f, -0.416099995f,
+	-0.0990469977f, 0.714682996f, -0.023263f, 0.0789000019f, 0.962000012f, -0.88410002f, -0.252799988f, -0.393000007f,
+	-0.182879001f, 0.760116994f, -0.0914480016f, 0.0131000001f, 0.367399991f, -0.843500018f, -0.0883999988f, 0.529900014f,
+	-0.177111f, 0.759482026f, -0.0820610002f, 0.0173000004f, 0.36469999f, -0.846800029f, -0.0888999999f, 0.524500012f,
+	-0.153052002f, 0.800067008f, -0.0719679967f, 0.0353999995f, 0.376899987f, -0.67930001f, 0.427100003f, 0.596800029f,
+	-0.161151007f, 0.800812006f, -0.0815420002f, 0.0305000003f, 0.379799992f, -0.710699975f, 0.320600003f, 0.62620002f,
+	-0.163930997f, 0.73398f, -0.0889229998f, 0.0109000001f, 0.352899998f, -0.65259999f, -0.57160002f, 0.497399986f,
+	-0.159986004f, 0.736553013f, -0.0810090005f, 0.0149999997f, 0.351900011f, -0.629199982f, -0.590300024f, 0.505599976f,
+	-0.116314001f, 0.706090987f, -0.0713239983f, 0.0175999999f, 0.327499986f, -0.568300009f, -0.661499977f, 0.489300013f,
+	-0.120370999f, 0.701949f, -0.0816610008f, 0.0122999996f, 0.328200012f, -0.568300009f, -0.662199974f, 0.488299996f,
+	-0.132146999f, 0.824958026f, -0.0706859976f, 0.0472999997f, 0.385500014f, -0.640699983f, 0.508400023f, 0.575299978f,
+	-0.127871007f, 0.820903003f, -0.0623230003f, 0.0500000007f, 0.381799996f, -0.641099989f, 0.50880003f, 0.574500024f,
+	0.161338001f, 0.739367008f, -0.0953629985f, 0.149100006f, 0.513199985f, -0.0513000004f, -0.204400003f, -0.977500021f,
+	0.170285001f, 0.741571009f, -0.0963490009f, 0.151600003f, 0.509899974f, -0.0579000004f, -0.202299997f, -0.977599978f,
+	0.147634f, 0.697066009f, -0.0857980028f, 0.156100005f, 0.532599986f, 0.0109000001f, -0.264200002f, -0.964399993f,
+	0.141278997f, 0.700528979f, -0.0868579969f, 0.152799994f, 0.532999992f, 0.0251000002f, -0.278200001f, -0.960200012f,
+	0.127670005f, 0.67910099f, -0.0798629969f, 0.154100001f, 0.5449f, 0.120800003f, -0.376599997f, -0.918500006f,
+	0.126715004f, 0.686048985f, -0.0831520036f, 0.151600003f, 0.542400002f, 0.171100006f, -0.4023f, -0.899399996f,
+	0.00481999991f, 0.931868017f, -0.0300559998f, 0.215000004f, 0.702600002f, -0.648999989f, 0.152899995f, -0.745199978f,
+	0.0072300001f, 0.931868017f, -0.0425040014f, 0.220300004f, 0.704699993f, -0.98180002f, -0.00039999999f, -0.190099999f,
+	0.00831899978f, 0.861128986f, -0.0554190017f, 0.214200005f, 0.736699998f, -0.987999976f, -0.0930000022f, 0.123199999f,
+	0.00954599958f, 0.875068009f, -0.0431060009f, 0.211199999f, 0.728799999f, -0.953599989f, -0.0102000004f, -0.301099986f,
+	0.00389500009f, 0.972181022f, -0.0311299991f, 0.221900001f, 0.685699999f, -0.941799998f, 0.336199999f, -0.00449999981f,
+	0.00400200021f, 0.971983016f, -0.0190360006f, 0.216800004f, 0.683899999f, -0.206200004f, 0.354999989f, -0.911800027f,
+	0.0225300007f, 0.975344002f, -0.00634399988f, 0.214200005f, 0.673900008f, 0.200100005f, 0.792800009f, -0.575699985f,
+	0.0218739994f, 0.976288974f, -0.0126470001f, 0.216900006f, 0.675000012f, -0.408800006f, 0.896600008f, 0.170000002f,
+	0.0302009992f, 0.978788018f, 0.00309500005f, 0.211700007f, 0.668799996f, 0.796899974f, 0.144199997f, -0.586600006f,
+	0.0302419998f, 0.977991998f, 0.00253099995f, 0.212099999f, 0.66869998f, 0.791100025f, 0.380600005f, -0.478899986f,
+	-0.00954599958f, 0.875068009f, -0.0431060009f, 0.236300007f, 0.756500006f, 0.913399994f, 0.0785000026f, -0.399399996f,
+	-0.00831899978f, 0.861128986f, -0.0554190017f, 0.2333f, 0.764299989f, 0.988399982f, -0.0419000015f, 0.145899996f,
+	-0.0072300001f, 0.931868017f, -0.0425040014f, 0.227400005f, 0.732299984f, 0.987699986f, -0.0183000006f, -0.155399993f,
+	-0.00481999991f, 0.931868017f, -0.0300559998f, 0.232700005f, 0.730199993f, 0.634500027f, 0.160899997f, -0.755999982f,
+	-0.00400200021f, 0.971983016f, -0.0190360006f, 0.230700001f, 0.711499989f, 0.231199995f, 0.337500006f, -0.912500024f,
+	-0.00389500009f, 0.972181022f, -0.0311299991f, 0.225600004f, 0.713400006f, 0.957799971f, 0.287099987f, 0.0131999999f,
+	-0.0218739994f, 0.976288974f, -0.0126470001f, 0.230599999f, 0.702700019f, 0.316599995f, 0.936699986f, 0.149399996f,
+	-0.0225300007f, 0.975344002f, -0.00634399988f, 0.2333f, 0.701499999f, -0.283699989f, 0.797100008f, -0.533100009f,
+	-0.0302419998f, 0.977991998f, 0.00253099995f, 0.235699996f, 0.69660002f, -0.520500004f, 0.580900013f, -0.625800014f,
+	-0.0302009992f, 0.978788018f, 0.00309500005f, 0.236100003f, 0.69660002f, -0.731000006f, 0.0808999985f, -0.677600026f,
+	-0.0691509992f, 0.517292023f, -0.0443729982f, 0.576399982f, 0.852100015f, -0.25060001f, 0.063699998f, -0.966000021f,
+	-0.056708999f, 0.517292023f, -0.0520699993f, 0.58160001f, 0.856100023f, -0.760800004f, 0.0786999986f, -0.644200027f,
+	-0.0648399964f, 0.457542002f, -0.0549140014f, 0.563799977f, 0.876699984f, -0.578499973f, 0.134900004f, -0.804400027f,
+	-0.0796430036f, 0.461834997f, -0.0489300005f, 0.559099972f, 0.870800018f, -0.122599997f, 0.1219f, -0.984899998f,
+	-0.0558289997f, 0.563069999f, -0.0491309986f, 0.593699992f, 0.83920002f, -0.641799986f, 0.0702000037f, -0.763599992f,
+	-0.0661519989f, 0.563069999f, -0.0445059985f, 0.58950001f, 0.836000025f, -0.224600002f, 0.0526000001f, -0.97299999f,
+	-0.0964090005f, 0.517355025f, -0.0453249998f, 0.566200018f, 0.845099986f, -0.3565f, 0.165199995f, -0.91960001f,
+	-0.0577780008f, 0.452580005f, -0.0630970001f, 0.566200018f, 0.881500006f, -0.357199997f, 0.0882999972f, -0.929799974f,
+	-0.0533780009f, 0.517292023f, -0.0602659993f, 0.584599972f, 0.85860002f, -0.565500021f, 0.0756999999f, -0.82130003f,
+	-0.0493579991f, 0.563069999f, -0.0580729991f, 0.597500026f, 0.842499971f, -0.398299992f, 0.0868000016f, -0.913100004f,
+	-0.0555559993f, 0.624319017f, -0.0432640016f, 0.610099971f, 0.816900015f, -0.396100014f, 0.0759000033f, -0.915099978f,
+	-0.0853750035f, 0.563069999f, -0.0436509997f, 0.582300007f, 0.830799997f, -0.404000014f, 0.124799997f, -0.906199992f,
+	-0.0729290023f, 0.626534998f, -0.0398150012f, 0.604300022f, 0.81129998f, -0.426999986f, 0.128000006f, -0.895200014f,
+	-0.0995199978f, 0.564167023f, -0.0279770009f, 0.575399995f, 0.823700011f, -0.928600013f, 0.191499993f, -0.317799985f,
+	-0.086902f, 0.627107978f, -0.0281029996f, 0.598200023f, 0.805599988f, -0.822399974f, 0.204400003f, -0.530900002f,
+	-0.0700789988f, 0.656111002f, -0.0344570018f, 0.613099992f, 0.800800025f, -0.576300025f, 0.143600002f, -0.804499984f,
+	-0.0550789982f, 0.654524982f, -0.0424989983f, 0.618700027f, 0.806200027f, -0.436399996f, 0.050999999f, -0.898299992f,
+	-0.0439440012f, 0.625753999f, -0.051399f, 0.61559999f, 0.8204f, -0.379000008f, 0.0904000029f, -0.921000004f,
+	-0.0425570011f, 0.65586102f, -0.0486290008f, 0.624100029f, 0.809599996f, -0.421299994f, 0.0137999998f, -0.906799972f,
+	-0.0368230008f, 0.563069999f, -0.0569350012f, 0.602199972f, 0.845700026f, 0.447400004f, 0.055399999f, -0.8926f,
+	-0.0353889987f, 0.625329018f, -0.0527939983f, 0.618700027f, 0.822799981f, 0.282900006f, -0.00879999995f, -0.959100008f,
+	-0.0344250016f, 0.655677974f, -0.0519389994f, 0.627300024f, 0.812099993f, -0.0397999994f, -0.00139999995f, -0.999199986f,
+	-0.0325459987f, 0.687276006f, -0.0547409989f, 0.637099981f, 0.801599979f, 0.0185000002f, -0.0666999966f, -0.997600019f,
+	-0.060819f, 0.686610997f, -0.0383480005f, 0.625400007f, 0.792999983f, -0.596400023f, 0.0878999978f, -0.797800004f,
+	-0.0808599964f, 0.656392992f, -0.0244670007f, 0.608099997f, 0.796299994f, -0.849099994f, 0.213300005f, -0.4833f,
+	-0.095002003f, 0.62450701f, -0.000714000023f, 0.58890003f, 0.796500027f, -0.969799995f, 0.207499996f, -0.127800003f,
+	-0.0873489976f, 0.653617024f, 0.00182799995f, 0.599300027f, 0.787599981f, -0.966300011f, 0.238299996f, -0.0971999988f,
+	-0.0754259974f, 0.686466992f, -0.0210870001f, 0.617999971f, 0.786499977f, -0.881600022f, 0.215499997f, -0.419999987f,
+	-0.0969469994f, 0.56320101f, -0.0100539997f, 0.570100009f, 0.817099988f, -0.984099984f, 0.126200005f, -0.125200003f,
+	-0.106994003f, 0.563069999f, 0.00882699993f, 0.563399971f, 0.809599996f, -0.936500013f, 0.182400003f, -0.299499989f,
+	-0.0943010002f, 0.627242982f, 0.0265900008f, 0.582700014f, 0.78549999f, -0.898500025f, 0.255400002f, 0.35710001f,
+	-0.0865229964f, 0.655658007f, 0.0241839997f, 0.594200015f, 0.778800011f, -0.887700021f, 0.303200006f, 0.346599996f,
+	-0.0802130029f, 0.687550008f, 0.0058439998f, 0.610899985f, 0.777100027f, -0.965200007f, 0.25029999f, 0.0760999992f,
+	-0.108810998f, 0.564956009f, 0.0343130007f, 0.556999981f, 0.799399972f, -0.852299988f, 0.266299993f, 0.450199991f,
+	-0.0747760013f, 0.624575019f, 0.0474230014f, 0.576399982f, 0.773800015f, -0.735499978f, 0.145500004f, 0.66170001f,
+	-0.107378997f, 0.517355025f, 9.40000027e-05f, 0.550499976f, 0.826300025f, -0.908399999f, 0.181999996f, -0.376300007f,
+	-0.122954004f, 0.518190026f, 0.0195719991f, 0.542800009f, 0.817900002f, -0.924499989f, 0.222200006f, -0.309700012f,
+	-0.145855993f, 0.444766998f, 0.0303000007f, 0.512099981f, 0.834900022f, -0.874599993f, 0.257499993f, -0.410699993f,
+	-0.121365003f, 0.518790007f, 0.0414239988f, 0.537199974f, 0.809499979f, -0.81129998f, 0.334500015f, 0.479499996f,
+	-0.0923329964f, 0.563069999f, 0.0436679982f, 0.553300023f, 0.791400015f, -0.50120002f, 0.190699995f, 0.843999982f,
+	-0.151448995f, 0.443960011f, 0.0524379984f, 0.505299985f, 0.828000009f, -0.887399971f, 0.43810001f, 0.143600002f,
+	-0.103577003f, 0.51670301f, 0.053580001f, 0.533200026f, 0.800400019f, -0.472499996f, 0.330799997f, 0.816900015f,
+	-0.0745849982f, 0.563181996f, 0.0549070016f, 0.550100029f, 0.782199979f, -0.796500027f, 0.202900007f, 0.569599986f,
+	-0.138577998f, 0.447777003f, 0.0726319999f, 0.501999974f, 0.818400025f, -0.606599987f, 0.469799995f, 0.64139998f,
+	-0.0858429968f, 0.510095f, 0.064290002f, 0.52759999f, 0.792100012f, -0.708599985f, 0.334500015f, 0.621299982f,
+	-0.0704779997f, 0.563610971f, 0.0745410025f, 0.545899987f, 0.773999989f, -0.791199982f, 0.261500001f, 0.552900016f,
+	-0.0641750023f, 0.622264028f, 0.0610160008f, 0.572300017f, 0.766700029f, -0.658599973f, 0.158500001f, 0.735599995f,
+	-0.0545869991f, 0.563943028f, 0.0840599984f, 0.543299973f, 0.765600026f, -0.271299988f, 0.273600012f, 0.922800004f,
+	-0.0447119996f, 0.622197986f, 0.0721649975f, 0.569199979f, 0.756600022f, -0.317699999f, 0.202700004f, 0.926299989f,
+	-0.059514001f, 0.651356995f, 0.058203999f, 0.584699988f, 0.761500001f, -0.592400014f, 0.1646f, 0.788699985f,
+	-0.0717800036f, 0.654300988f, 0.0458049998f, 0.588800013f, 0.768400013f, -0.770600021f, 0.189600006f, 0.608500004f,
+	-0.0675259978f, 0.688017011f, 0.0411599986f, 0.603200018f, 0.762799978f, -0.827199996f, 0.179800004f, 0.532400012f,
+	-0.0424499996f, 0.651148021f, 0.067772001f, 0.582000017f, 0.753000021f, -0.342799991f, 0.140799999f, 0.928799987f,
+	-0.0463510007f, 0.686707973f, 0.0610999987f, 0.598399997f, 0.751399994f, -0.496199995f, 0.133599997f, 0.857900023f,
+	-0.0209030006f, 0.623498023f, 0.0754859969f, 0.567499995f, 0.745299995f, -0.0269000009f, 0.0869999975f, 0.995800018f,
+	-0.0392699987f, 0.56278801f, 0.0844290033f, 0.541499972f, 0.75849998f, 0.211400002f, 0.160600007f, 0.964100003f,
+	-0.0216269996f, 0.563069999f, 0.0762429982f, 0.540600002f, 0.749499977f, 0.358700007f, 0.0628999993f, 0.931299984f,
+	-0.00444999989f, 0.563069999f, 0.071138002f, 0.539499998f, 0.741299987f, 0.076700002f, 0.0445000008f, 0.996100008f,
+	0.0142719997f, 0.624037981f, 0.0746959969f, 0.565400004f, 0.728999972f, 0.0264999997f, 0.00719999988f, 0.999599993f,
+	-0.0208149999f, 0.653504014f, 0.0726019964f, 0.580900013f, 0.742999971f, -0.138099998f, 0.0790999979f, 0.987299979f,
+	0.0146869998f, 0.563069999f, 0.0735640004f, 0.538200021f, 0.7324f, -0.252200007f, 0.0857999995f, 0.96390003f,
+	0.0334750004f, 0.622857988f, 0.0735620037f, 0.563799977f, 0.720099986f, 0.0825000033f, 0.0781000033f, 0.993499994f,
+	-0.0276909992f, 0.517292023f, 0.0833090022f, 0.520299971f, 0.755200028f, 0.456200004f, 0.144400001f, 0.878099978f,
+	-0.00731399981f, 0.517229021f, 0.0757770017f, 0.519299984f, 0.745500028f, 0.142100006f, 0.146200001f, 0.978999972f,
+	-0.0454690009f, 0.517355025f, 0.0953639969f, 0.520900011f, 0.764900029f, 0.373899996f, 0.202900007f, 0.904999971f,
+	-0.0483709984f, 0.440221012f, 0.119034998f, 0.485199988f, 0.772899985f, 0.368099988f, 0.252099991f, 0.894999981f,
+	-0.0278740004f, 0.444247007f, 0.101265997f, 0.486799985f, 0.760800004f, 0.558700025f, 0.180899993f, 0.809400022f,
+	-0.00872599985f, 0.446426004f, 0.0897879973f, 0.487199992f, 0.750800014f, 0.232099995f, 0.184400007f, 0.9551f,
+	0.0137750003f, 0.446561009f, 0.0918280035f, 0.485599995f, 0.740700006f, -0.377200007f, 0.180800006f, 0.908299983f,
+	0.013119f, 0.517229021f, 0.0773710012f, 0.51789999f, 0.736400008f, -0.317999989f, 0.142900005f, 0.93720001f,
+	0.041813001f, 0.442413002f, 0.113968998f, 0.479699999f, 0.725700021f, -0.506799996f, 0.194000006f, 0.839900017f,
+	0.0379340015f, 0.517292023f, 0.0935980007f, 0.514900029f, 0.723500013f, -0.385100007f, 0.203700006f, 0.900099993f,
+	0.0582959987f, 0.440521985f, 0.123057999f, 0.476999998f, 0.717700005f, -0.0901999995f, 0.335900009f, 0.937600017f,
+	0.0326570012f, 0.563069999f, 0.0812740028f, 0.536599994f, 0.723399997f, -0.281699985f, 0.190300003f, 0.940400004f,
+	0.0767640024f, 0.440813005f, 0.120029002f, 0.476700008f, 0.709699988f, 0.351200014f, 0.345099986f, 0.870400012f,
+	0.0625180006f, 0.517292023f, 0.100501999f, 0.512799978f, 0.712300003f, 0.123000003f, 0.289299995f, 0.949299991f,
+	0.0523490012f, 0.563069999f, 0.0851199999f, 0.5352f, 0.713999987f, 0.113399997f, 0.281599998f, 0.952799976f,
+	0.0500979982f, 0.621559978f, 0.071581997f, 0.562399983f, 0.712199986f, 0.336199999f, 0.171800002f, 0.925999999f,
+	0.0705280006f, 0.563069999f, 0.0757509992f, 0.535300016f, 0.704200029f, 0.717700005f, 0.273099989f, 0.640600026f,
+	0.062913999f, 0.620344996f, 0.0634870008f, 0.561999977f, 0.704999983f, 0.654100001f, 0.204600006f, 0.728200018f,
+	0.0755459964f, 0.620315015f, 0.0478879996f, 0.563000023f, 0.695599973f, 0.715499997f, 0.138300002f, 0.684800029f,
+	0.058952f, 0.649253011f, 0.0600039996f, 0.575299978f, 0.70599997f, 0.625100017f, 0.167199999f, 0.762399971f,
+	0.0490269996f, 0.650343001f, 0.066124998f, 0.575699985f, 0.711300015f, 0.415100008f, 0.161200002f, 0.895399988f,
+	0.0344830006f, 0.652514994f, 0.0699699968f, 0.577099979f, 0.717999995f, 0.225500003f, 0.104699999f, 0.968599975f,
+	0.0465879999f, 0.685792983f, 0.0613260008f, 0.592000008f, 0.711099982f, 0.494800001f, 0.165399998f, 0.853100002f,
+	0.0731989965f, 0.649888992f, 0.0461370014f, 0.576300025f, 0.697099984f, 0.704599977f, 0.157600001f, 0.691900015f,
+	0.0915570036f, 0.621572971f, 0.0339220017f, 0.564599991f, 0.685899973f, 0.793900013f, 0.179800004f, 0.580799997f,
+	0.0866999999f, 0.650385976f, 0.0303479992f, 0.577700019f, 0.687900007f, 0.847500026f, 0.235599995f, 0.475699991f,
+	0.0667150021f, 0.687743008f, 0.0431019999f, 0.593599975f, 0.699699998f, 0.745400012f, 0.221300006f, 0.628799975f,
+	0.104618996f, 0.563268006f, 0.0390160009f, 0.537999988f, 0.6796f, 0.728600025f, 0.297899991f, 0.61680001f,
+	0.0971219987f, 0.621380985f, 0.020428f, 0.565999985f, 0.679199994f, 0.957799971f, 0.229800001f, 0.172800004f,
+	0.090249002f, 0.649950027f, 0.0206010006f, 0.578599989f, 0.683399975f, 0.950699985f, 0.273699999f, 0.145400003f,
+	0.0768280029f, 0.688517988f, 0.0232839994f, 0.595600009f, 0.690599978f, 0.915199995f, 0.300300002f, 0.268900007f,
+	0.110996f, 0.563069999f, 0.0205160007f, 0.540199995f, 0.67049998f, 0.962800026f, 0.2685f, 0.0295000002f,
+	0.0969260037f, 0.620804012f, 0.00361600006f, 0.568400025f, 0.671899974f, 0.965600014f, 0.214599997f, -0.147100002f,
+	0.121205002f, 0.517229021f, 0.0110860001f, 0.522000015f, 0.657999992f, 0.893700004f, 0.188899994f, -0.407099992f,
+	0.106973998f, 0.563069999f, 0.00403899979f, 0.543299973f, 0.663100004f, 0.894299984f, 0.181099996f, -0.409200013f,
+	0.0930759981f, 0.622673988f, -0.00953899976f, 0.571699977f, 0.666400015f, 0.950600028f, 0.189500004f, -0.245900005f,
+	0.0900999978f, 0.648979008f, 0.00546400016f, 0.580500007f, 0.676900029f, 0.963100016f, 0.251700014f, -0.0953999981f,
+	0.0797879994f, 0.687538981f, -0.00254000002f, 0.59859997f, 0.679799974f, 0.962400019f, 0.255199999f, -0.0927999988f,
+	0.0867870003f, 0.651997983f, -0.00750300009f, 0.584100008f, 0.671999991f, 0.952899992f, 0.216199994f, -0.212799996f,
+	0.0980700031f, 0.563069999f, -0.00788899977f, 0.546500027f, 0.657000005f, 0.961399972f, 0.183200002f, -0.205400005f,
+	0.100304998f, 0.563069999f, -0.018646f, 0.548200011f, 0.65200001f, 0.97329998f, 0.229000002f, -0.0124000004f,
+	0.0883509964f, 0.623535991f, -0.0269900002f, 0.575500011f, 0.658999979f, 0.873099983f, 0.196400002f, -0.4463f,
+	0.113284998f, 0.517229021f, -0.0048580002f, 0.525699973f, 0.650699973f, 0.959500015f, 0.243100002f, -0.142100006f,
+	0.131024003f, 0.444757015f, 0.0163739994f, 0.490799993f, 0.646899998f, 0.881500006f, 0.124499999f, -0.455500007f,
+	0.129688993f, 0.449851006f, -0.002629f, 0.495999992f, 0.640399992f, 0.963100016f, 0.238600001f, 0.124399997f,
+	0.134581f, 0.458573997f, -0.0230390001f, 0.502200007f, 0.632799983f, 0.960900009f, 0.272500008f, 0.0498000011f,
+	0.115595996f, 0.517292023f, -0.0209490005f, 0.527999997f, 0.64349997f, 0.948199987f, 0.313600004f, -0.0507999994f,
+	0.111769997f, 0.517292023f, -0.035941001f, 0.531000018f, 0.637000024f, 0.782000005f, 0.287099987f, -0.553200006f,
+	0.0973820016f, 0.563069999f, -0.0329790004f, 0.550999999f, 0.645699978f, 0.851300001f, 0.232500002f, -0.470299989f,
+	0.0789930001f, 0.625909984f, -0.0374730006f, 0.579699993f, 0.654100001f, 0.522400022f, 0.196199998f, -0.82980001f,
+	0.0829550028f, 0.65259099f, -0.0229289997f, 0.587300003f, 0.665499985f, 0.888599992f, 0.213200003f, -0.406100005f,
+	0.076481998f, 0.655200005f, -0.0309929997f, 0.590699971f, 0.662100017f, 0.672500014f, 0.187999994f, -0.715799987f,
+	0.0738790035f, 0.686451972f, -0.0240439996f, 0.602299988f, 0.670899987f, 0.834399998f, 0.206f, -0.511200011f,
+	0.0862729996f, 0.563069999f, -0.0439140014f, 0.554899991f, 0.639500022f, 0.385800004f, 0.125200003f, -0.913999975f,
+	0.0667060018f, 0.625765979f, -0.0408309996f, 0.583199978f, 0.649500012f, 0.281199992f, 0.124700002f, -0.951499999f,
+	0.0717829987f, 0.517229021f, -0.0450319983f, 0.542999983f, 0.621200025f, 0.151600003f, 0.0830999985f, -0.984899998f,
+	0.0699020028f, 0.563069999f, -0.0452909991f, 0.559599996f, 0.633599997f, 0.154799998f, 0.0368999988f, -0.987299979f,
+	0.0921209976f, 0.517292023f, -0.0480879992f, 0.537f, 0.628400028f, 0.181899995f, 0.150399998f, -0.971800029f,
+	0.0546870008f, 0.626134992f, -0.0443129987f, 0.586799979f, 0.644999981f, 0.459600002f, 0.074000001f, -0.885100007f,
+	0.0667639971f, 0.65574801f, -0.0376360007f, 0.593999982f, 0.657800019f, 0.500699997f, 0.0996999964f, -0.859899998f,
+	0.0578139983f, 0.686363995f, -0.0409439988f, 0.607800007f, 0.662299991f, 0.566999972f, 0.0584000014f, -0.82160002f,
+	0.0547269993f, 0.656265974f, -0.0426069982f, 0.5977f, 0.653199971f, 0.435000002f, 0.0399000011f, -0.899500012f,
+	0.0579410009f, 0.563069999f, -0.0480070002f, 0.563000023f, 0.629100025f, 0.557500005f, 0.0692000017f, -0.827300012f,
+	0.0462719984f, 0.626682997f, -0.0507600009f, 0.5898f, 0.641200006f, 0.416599989f, 0.0913999975f, -0.904500008f,
+	0.0522690006f, 0.563069999f, -0.0562379993f, 0.565599978f, 0.62529999f, 0.590300024f, 0.101300001f, -0.800800025f,
+	0.0583400019f, 0.517229021f, -0.0515919998f, 0.546999991f, 0.615800023f, 0.708800018f, 0.0970000029f, -0.698700011f,
+	0.0365119986f, 0.626851022f, -0.0529050007f, 0.592599988f, 0.637700021f, -0.265899986f, 0.054299999f, -0.962499976f,
+	0.045483999f, 0.656695008f, -0.0474799983f, 0.600700021f, 0.649500012f, 0.422699988f, 0.0351000018f, -0.905600011f,
+	0.0308330003f, 0.687305987f, -0.0551539995f, 0.616299987f, 0.65170002f, -0.196700007f, 0.00870000012f, -0.980400026f,
+	0.0334660001f, 0.65705198f, -0.0523779988f, 0.604399979f, 0.644900024f, 0.0244999994f, -0.074500002f, -0.996900022f,
+	0.0447309986f, 0.563069999f, -0.0584729984f, 0.567700028f, 0.622399986f, 0.0615000017f, 0.0964000002f, -0.993399978f,
+	0.0372529998f, 0.563069999f, -0.0570780002f, 0.569899976f, 0.619799972f, -0.533800006f, 0.0588000007f, -0.843599975f,
+	0.0294400007f, 0.627178013f, -0.0458079986f, 0.595499992f, 0.634299994f, -0.675400019f, -0.0281000007f, -0.736899972f,
+	0.055470001f, 0.517229021f, -0.0577270016f, 0.548699975f, 0.613300025f, 0.702799976f, 0.0825000033f, -0.70660001f,
+	0.0443120003f, 0.517229021f, -0.0629739985f, 0.551999986f, 0.608799994f, 0.127599999f, 0.0647f, -0.989700019f,
+	0.0771429986f, 0.460869014f, -0.0493130013f, 0.522099972f, 0.60619998f, 0.1796f, 0.103299998f, -0.978299975f,
+	0.0620750003f, 0.454962999f, -0.0593359992f, 0.524900019f, 0.59799999f, 0.461199999f, 0.0913999975f, -0.882600009f,
+	0.0494889989f, 0.44956401f, -0.0650350004f, 0.52670002f, 0.591499984f, 0.0758000016f, 0.0372000001f, -0.996399999f,
+	0.0378170013f, 0.517229021f, -0.0619690008f, 0.553900003f, 0.60650003f, -0.521499991f, 0.0428000018f, -0.852199972f,
+	0.0328380018f, 0.562429011f, -0.0509789996f, 0.572000027f, 0.616999984f, -0.811100006f, 0.0277999993f, -0.584200025f,
+	0.0231350008f, 0.658699989f, -0.0495570004f, 0.607800007f, 0.641499996f, -0.335599989f, -0.1184f, -0.934499979f,
+	0.0237210002f, 0.689768016f, -0.0476999991f, 0.619599998f, 0.648599982f, -0.713199973f, 0.0551999994f, -0.698800027f,
+	0.0341410004f, 0.517229021f, -0.0568320006f, 0.555800021f, 0.604399979f, -0.814199984f, 0.0195000004f, -0.580200016f,
+	0.0405509993f, 0.445546001f, -0.0639059991f, 0.527899981f, 0.587199986f, -0.808000028f, -0.00700000022f, -0.58920002f,
+	0.0363470018f, 0.445246994f, -0.057204999f, 0.529999971f, 0.584299982f, -0.868499994f, -0.0177999996f, -0.495400012f,
+	0.0999429971f, 0.46539399f, -0.0549460016f, 0.516799986f, 0.615499973f, 0.0773999989f, 0.126399994f, -0.989000022f,
+	0.124600001f, 0.464008003f, -0.0457670018f, 0.509199977f, 0.624199986f, 0.731999993f, 0.264200002f, -0.628000021f,
+	-0.113645002f, 0.727917016f, 0.00604300015f, 0.219500005f, 0.963f, -0.87529999f, -0.380299985f, 0.298700005f,
+	-0.0981379971f, 0.71449399f, 0.0360950008f, 0.203099996f, 0.961399972f, -0.889500022f, -0.295700014f, 0.34830001f,
+	-0.098240003f, 0.718578994f, 0.0393019989f, 0.202800006f, 0.959100008f, -0.888400018f, -0.301499993f, 0.346300006f,
+	-0.115997002f, 0.733229995f, 0.00604300015f, 0.221000001f, 0.960900009f, -0.873399973f, -0.386599988f, 0.296000004f,
+	-0.085244f, 0.697359025f, 0.0529999994f, 0.191100001f, 0.964299977f, -0.887300014f, -0.303900003f, 0.346899986f,
+	-0.0846860036f, 0.699069977f, 0.0559820011f, 0.190300003f, 0.962899983f, -0.888599992f, -0.305799991f, 0.341800004f,
+	-0.0796139985f, 0.686480999f, 0.0589630008f, 0.185599998f, 0.967199981f, -0.89139998f, -0.256399989f, 0.373899996f,
+	-0.0771709979f, 0.686587989f, 0.064861998f, 0.1831f, 0.965799987f, -0.89200002f, -0.265399992f, 0.365999997f,
+	0.0987330005f, 0.714429975f, 0.0364090018f, 0.179100007f, 0.920799971f, 0.890799999f, -0.2676f, 0.367199987f,
+	0.113608003f, 0.727922022f, 0.00604300015f, 0.162699997f, 0.922399998f, 0.880800009f, -0.399500012f, 0.254000008f,
+	0.116016001f, 0.733229995f, 0.00604300015f, 0.161200002f, 0.920300007f, 0.884800017f, -0.381500006f, 0.267399997f,
+	0.0986189991f, 0.718555987f, 0.0395280011f, 0.179399997f, 0.918500006f, 0.890500009f, -0.25850001f, 0.37439999f,
+	0.0852110013f, 0.699020982f, 0.0563630015f, 0.192000002f, 0.922399998f, 0.889800012f, -0.350600004f, 0.292100012f,
+	0.0855569988f, 0.697323024f, 0.0532220006f, 0.191200003f, 0.923799992f, 0.885800004f, -0.360399991f, 0.292499989f,
+	0.0796660036f, 0.686500013f, 0.058995001f, 0.196600005f, 0.926800013f, 0.902199984f, -0.345099986f, 0.258899987f,
+	0.0779590011f, 0.686878026f, 0.0655369982f, 0.199200004f, 0.925100029f, 0.902700007f, -0.345999986f, 0.255600005f,
+	0.177437007f, 0.743104994f, -0.0918760002f, 0.163399994f, 0.415899992f, 0.54430002f, -0.446099997f, -0.710399985f,
+	0.152615994f, 0.695397973f, -0.0806019977f, 0.167500004f, 0.440400004f, 0.502200007f, -0.567600012f, -0.652400017f,
+	0.147634f, 0.697066009f, -0.0857980028f, 0.164199993f, 0.440800011f, 0.491600007f, -0.571500003f, -0.657100022f,
+	0.170285001f, 0.741571009f, -0.0963490009f, 0.1602f, 0.418099999f, 0.541499972f, -0.444700003f, -0.713400006f,
+	0.129125997f, 0.674180984f, -0.0721599981f, 0.167099997f, 0.455199987f, 0.449200004f, -0.712100029f, -0.539699972f,
+	0.127670005f, 0.67910099f, -0.0798629969f, 0.163399994f, 0.453299999f, 0.445600003f, -0.707000017f, -0.549199998f,
+	-0.0990469977f, 0.714682996f, -0.023263f, 0.203299999f, 0.922399998f, -0.88410002f, -0.252799988f, -0.393000007f,
+	-0.113645002f, 0.727917016f, 0.00604300015f, 0.219099998f, 0.925000012f, -0.882200003f, -0.390500009f, -0.263099998f,
+	-0.115997002f, 0.733229995f, 0.00604300015f, 0.219999999f, 0.927900016f, -0.886900008f, -0.366600007f, -0.280999988f,
+	-0.102532998f, 0.723322988f, -0.0204869993f, 0.205899999f, 0.925599992f, -0.898400009f, -0.245499998f, -0.364300013f,
+	0.0796660036f, 0.686500013f, -0.0469090007f, 0.0617999993f, 0.981999993f, 0.902199984f, -0.345099986f, -0.258899987f,
+	0.0779590011f, 0.686878026f, -0.0534499995f, 0.0592f, 0.980300009f, 0.902700007f, -0.345999986f, -0.255600005f,
+	0.0852110013f, 0.699020982f, -0.0442759991f, 0.066399999f, 0.977699995f, 0.889800012f, -0.350600004f, -0.292100012f,
+	0.0855569988f, 0.697323024f, -0.0411360003f, 0.0671999976f, 0.979099989f, 0.885800004f, -0.360399991f, -0.292499989f,
+	0.0986189991f, 0.718555987f, -0.0274410006f, 0.0790000036f, 0.973800004f, 0.890500009f, -0.25850001f, -0.37439999f,
+	0.0987330005f, 0.714429975f, -0.0243219994f, 0.0791999996f, 0.976100028f, 0.890799999f, -0.2676f, -0.367199987f,
+	0.116016001f, 0.733229995f, 0.00604300015f, 0.0971999988f, 0.975499988f, 0.884800017f, -0.381500006f, -0.267399997f,
+	0.113608003f, 0.727922022f, 0.00604300015f, 0.0957000032f, 0.977699995f, 0.880800009f, -0.399500012f, -0.254000008f,
+	0.0482829995f, 0.699122012f, -0.154829994f, 0.0285f, 0.552900016f, 0.640699983f, -0.500699997f, -0.582000017f,
+	0.0579040013f, 0.700923979f, -0.145831004f, 0.0340999998f, 0.555100024f, 0.608099997f, -0.541499972f, -0.580500007f,
+	0.0509589985f, 0.689091027f, -0.137250006f, 0.0311999992f, 0.561800003f, 0.576600015f, -0.668799996f, -0.469300002f,
+	0.0447829999f, 0.686058998f, -0.140615001f, 0.0276999995f, 0.561800003f, 0.581700027f, -0.665300012f, -0.468100011f,
+	0.0499290004f, 0.719610989f, -0.164234996f, 0.0311999992f, 0.542999983f, 0.592899978f, -0.422300011f, -0.685699999f,
+	0.0621040016f, 0.721415997f, -0.155851007f, 0.0375999995f, 0.54519999f, 0.549799979f, -0.455199987f, -0.700399995f,
+	0.163901001f, 0.841547012f, 0.0912609994f, 0.529900014f, 0.0979000032f, 0.694899976f, -0.143099993f, 0.70480001f,
+	0.176632002f, 0.853667021f, 0.0790020004f, 0.538699985f, 0.0993999988f, 0.837100029f, -0.1127f, 0.535300016f,
+	0.173847005f, 0.862152994f, 0.0851449966f, 0.539499998f, 0.0948000029f, 0.818899989f, -0.0939000025f, 0.566299975f,
+	0.144188002f, 0.835646987f, 0.108792998f, 0.519800007f, 0.0913999975f, 0.628600001f, -0.318100005f, 0.709699988f,
+	0.147319004f, 0.827389002f, 0.102537997f, 0.519200027f, 0.0960000008f, 0.608399987f, -0.319599986f, 0.726499975f,
+	0.182456002f, 0.859766006f, 0.0684470013f, 0.544200003f, 0.1017f, 0.903999984f, 0.0174000002f, 0.427100003f,
+	0.186473995f, 0.875155985f, 0.0585849993f, 0.552200019f, 0.100400001f, 0.986999989f, -0.0584000014f, 0.149499997f,
+	0.185257003f, 0.863264978f, 0.0601899996f, 0.547800004f, 0.103200004f, 0.975899994f, -0.0399000011f, 0.214599997f,
+	0.185668007f, 0.871241987f, 0.0513739996f, 0.552900016f, 0.1039f, 0.993499994f, 0.057599999f, 0.0984999985f,
+	0.187013f, 0.867810011f, 0.0483359993f, 0.552600026f, 0.105999999f, 0.992200017f, 0.0436000004f, 0.116599999f,
+	0.113562003f, 0.799820006f, 0.112534001f, 0.499900013f, 0.0960000008f, 0.514699996f, -0.555100024f, 0.653400004f,
+	0.116913997f, 0.81439501f, 0.122366004f, 0.503899992f, 0.0892999992f, 0.587599993f, -0.541000009f, 0.601700008f,
+	0.0772640035f, 0.799160004f, 0.135657996f, 0.485300004f, 0.0843999982f, 0.432000011f, -0.614099979f, 0.660600007f,
+	0.0721520036f, 0.780730009f, 0.121287003f, 0.479999989f, 0.0932999998f, 0.426699996f, -0.626699984f, 0.65200001f,
+	0.141278997f, 0.700528979f, -0.0868579969f, 0.115099996f, 0.484100014f, 0.430799991f, -0.50819999f, -0.745800018f,
+	0.126715004f, 0.686048985f, -0.0831520036f, 0.119999997f, 0.492199987f, 0.37529999f, -0.565400004f, -0.734499991f,
+	0.0973180011f, 0.69353199f, -0.103933997f, 0.109300002f, 0.504899979f, 0.433099985f, -0.566900015f, -0.700699985f,
+	0.120196998f, 0.732282996f, -0.120130002f, 0.0930999964f, 0.490500003f, 0.471399993f, -0.520399988f, -0.712000012f,
+	0.161338001f, 0.739367008f, -0.0953629985f, 0.100900002f, 0.469900012f, 0.518899977f, -0.429800004f, -0.739000022f,
+	0.0912759975f, 0.726282001f, -0.137528002f, 0.0878000036f, 0.505100012f, 0.537599981f, -0.551999986f, -0.637499988f,
+	0.07773f, 0.694410026f, -0.118384004f, 0.103299998f, 0.514199972f, 0.540199995f, -0.589999974f, -0.600099981f,
+	0.0634360015f, 0.689020991f, -0.128603995f, 0.1008f, 0.522099972f, 0.628899992f, -0.590900004f, -0.505299985f,
+	0.0704509988f, 0.704925001f, -0.140097007f, 0.0925000012f, 0.517799973f, 0.648500025f, -0.572000027f, -0.502200007f,
+	0.0744189993f, 0.722761989f, -0.147847995f, 0.0844999999f, 0.513499975f, 0.534600019f, -0.434100002f, -0.725099981f,
+	-0.0225300007f, 0.975344002f, -0.00634399988f, 0.216000006f, 0.74119997f, -0.283699989f, 0.797100008f, -0.533100009f,
+	-0.0302009992f, 0.978788018f, 0.00309500005f, 0.221799999f, 0.741400003f, -0.731000006f, 0.0808999985f, -0.677600026f,
+	-0.0213649999f, 0.985345006f, -0.0115369996f, 0.215000004f, 0.746299982f, -0.680100024f, -0.287200004f, -0.674499989f,
+	-0.0124819996f, 0.985441983f, -0.0194789991f, 0.209700003f, 0.747399986f, -0.468699992f, -0.298799992f, -0.83130002f,
+	-0.00400200021f, 0.971983016f, -0.0190360006f, 0.205599993f, 0.741299987f, 0.231199995f, 0.337500006f, -0.912500024f,
+	-0.0285020005f, 0.982744992f, -0.00196400005f, 0.219999999f, 0.743900001f, -0.62349999f, -0.500400007f, -0.600700021f,
+	-0.0f, 0.986814022f, -0.0227620006f, 0.203799993f, 0.748300016f, -0.0f, -0.194000006f, -0.981000006f,
+	0.00400200021f, 0.971983016f, -0.0190360006f, 0.202000007f, 0.741299987f, -0.206200004f, 0.354999989f, -0.911800027f,
+	0.00481999991f, 0.931868017f, -0.0300559998f, 0.2016f, 0.722299993f, -0.648999989f, 0.152899995f, -0.745199978f,
+	-0.00481999991f, 0.931868017f, -0.0300559998f, 0.206f, 0.722299993f, 0.634500027f, 0.160899997f, -0.755999982f,
+	0.0124819996f, 0.985441983f, -0.0194789991f, 0.197999999f, 0.747399986f, 0.468699992f, -0.298799992f, -0.83130002f,
+	0.0225300007f, 0.975344002f, -0.00634399988f, 0.191599995f, 0.74119997f, 0.200100005f, 0.792800009f, -0.575699985f,
+	0.0213649999f, 0.985345006f, -0.0115369996f, 0.192699999f, 0.746299982f, 0.680100024f, -0.287200004f, -0.674499989f,
+	0.0302009992f, 0.978788018f, 0.00309500005f, 0.185900003f, 0.741400003f, 0.796899974f, 0.144199997f, -0.586600006f,
+	0.0285020005f, 0.982744992f, -0.00196400005f, 0.187600002f, 0.743900001f, 0.62349999f, -0.500400007f, -0.600700021f,
+	0.00954599958f, 0.875068009f, -0.0431060009f, 0.199499995f, 0.695800006f, -0.953599989f, -0.0102000004f, -0.301099986f,
+	-0.00954599958f, 0.875068009f, -0.0431060009f, 0.208199993f, 0.695800006f, 0.913399994f, 0.0785000026f, -0.399399996f,
+	0.0482829995f, 0.699122012f, -0.154829994f, 0.0654999986f, 0.55400002f, 0.926299989f, -0.298900008f, -0.229499996f,
+	0.0463830009f, 0.696645975f, -0.159621f, 0.063000001f, 0.55339998f, 0.932200015f, -0.27759999f, -0.232299998f,
+	0.0468659997f, 0.71815598f, -0.169614002f, 0.0658999979f, 0.542999983f, 0.881900012f, -0.2465f, -0.401899993f,
+	0.0499290004f, 0.719610989f, -0.164234996f, 0.0684999973f, 0.544200003f, 0.867200017f, -0.263599992f, -0.422500014f,
+	0.0447829999f, 0.686058998f, -0.140615001f, 0.0658999979f, 0.562900007f, 0.874899983f, -0.450700015f, -0.177399993f,
+	0.0418150015f, 0.680595994f, -0.141112998f, 0.063699998f, 0.564700007f, 0.871100008f, -0.45660001f, -0.180999994f,
+	-0.0202270001f, 0.689855993f, -0.0494339988f, 0.642400026f, 0.804499984f, 0.377499998f, -0.0892999992f, -0.921700001f,
+	-0.0219700001f, 0.657509029f, -0.0484250002f, 0.632399976f, 0.814999998f, 0.327499986f, -0.0421999991f, -0.943899989f,
+	-0.0265650004f, 0.624284983f, -0.0437979996f, 0.623000026f, 0.826399982f, 0.706499994f, -0.0843999982f, -0.702700019f,
+	-0.0283029992f, 0.563069999f, -0.0471060015f, 0.607200027f, 0.848800004f, 0.752799988f, 0.0269000009f, -0.657700002f,
+	-0.0296340007f, 0.517292023f, -0.0506540015f, 0.595399976f, 0.86589998f, 0.801800013f, 0.0196000002f, -0.597199976f,
+	-0.0373920016f, 0.517229021f, -0.0610020012f, 0.590399981f, 0.862800002f, 0.426600009f, 0.0511000007f, -0.902999997f,
+	-0.0321930014f, 0.446500003f, -0.0505909994f, 0.577300012f, 0.892400026f, 0.881900012f, -0.0388000011f, -0.469700009f,
+	-0.0400779992f, 0.446945012f, -0.0647810027f, 0.57130003f, 0.888199985f, 0.726100028f, -0.00389999989f, -0.687600017f,
+	0.0842870027f, 0.703236997f, -0.0530509986f, 0.122400001f, 0.432300001f, 0.273699999f, -0.00879999995f, 0.961799979f,
+	0.0999469981f, 0.690648019f, -0.0602650009f, 0.125200003f, 0.422899991f, 0.351099998f, -0.214499995f, 0.911499977f,
+	0.104153998f, 0.697278976f, -0.0603250004f, 0.1285f, 0.424299985f, 0.382800013f, -0.0939999968f, 0.91900003f,
+	0.0894699991f, 0.708392978f, -0.0545919985f, 0.125699997f, 0.432599992f, 0.3759f, 0.141399994f, 0.915799975f,
+	0.0698880032f, 0.723495007f, -0.0510409996f, 0.123199999f, 0.443800002f, 0.368000001f, 0.237499997f, 0.898999989f,
+	0.115130998f, 0.684985995f, -0.0690559968f, 0.130199999f, 0.415899992f, 0.514800012f, -0.273600012f, 0.8125f,
+	0.116750002f, 0.695927978f, -0.0659499988f, 0.133200005f, 0.420100003f, 0.536800027f, -0.0927999988f, 0.83859998f,
+	0.0787670016f, 0.725968003f, -0.0556290001f, 0.127399996f, 0.441900015f, 0.404599994f, 0.245299995f, 0.880999982f,
+	0.0979849994f, 0.742895007f, -0.0711999983f, 0.141000003f, 0.441700011f, 0.436399996f, 0.0942000002f, 0.894800007f,
+	0.109591998f, 0.71983701f, -0.0712779984f, 0.138400003f, 0.430299997f, 0.364199996f, 0.252700001f, 0.896399975f,
+	0.0668149963f, 0.749568999f, -0.0568500012f, 0.130500004f, 0.453599989f, 0.190500006f, 0.232500002f, 0.953800023f,
+	0.0755740032f, 0.746676028f, -0.0579590015f, 0.132699996f, 0.450100005f, 0.235799998f, 0.168899998f, 0.957000017f,
+	0.085359998f, 0.765160978f, -0.0643260032f, 0.142000005f, 0.453500003f, 0.251199991f, 0.336699992f, 0.907500029f,
+	0.124114998f, 0.751807988f, -0.080711998f, 0.153500006f, 0.437000006f, 0.609899998f, 0.269699991f, 0.745100021f,
+	0.129832f, 0.734386981f, -0.0795480013f, 0.150299996f, 0.429399997f, 0.617799997f, 0.182899997f, 0.764800012f,
+	0.127174005f, 0.706524014f, -0.0732280016f, 0.140699998f, 0.420599997f, 0.607900023f, 0.0390000008f, 0.793099999f,
+	0.134247005f, 0.702570975f, -0.0795459971f, 0.143099993f, 0.416700006f, 0.67900002f, 0.0439000018f, 0.732800007f,
+	0.140945002f, 0.736383021f, -0.0963710025f, 0.158500001f, 0.425399989f, 0.791999996f, 0.2183f, 0.570200026f,
+	0.130356997f, 0.755415022f, -0.0926159993f, 0.159600005f, 0.435699999f, 0.768700004f, 0.362599999f, 0.526899993f,
+	0.109168999f, 0.779496014f, -0.082653001f, 0.156900004f, 0.451000005f, 0.522199988f, 0.463999987f, 0.715600014f,
+	0.103924997f, 0.773710012f, -0.0756160021f, 0.152199998f, 0.450700015f, 0.411300004f, 0.40200001f, 0.818099976f,
+	0.0807029977f, 0.772010028f, -0.0680880025f, 0.143099993f, 0.457399994f, 0.127100006f, 0.531300008f, 0.837599993f,
+	0.0988989994f, 0.785211027f, -0.0816180035f, 0.155200005f, 0.456200004f, 0.292400002f, 0.539799988f, 0.789399981f,
+	0.068200998f, 0.722720981f, -0.159167007f, 0.162599996f, 0.508899987f, -0.405200005f, -0.330199987f, -0.852500021f,
+	0.0648439974f, 0.697449982f, -0.148157001f, 0.164000005f, 0.521499991f, -0.449800014f, -0.347900003f, -0.822600007f,
+	0.0579040013f, 0.700923979f, -0.145831004f, 0.160300002f, 0.521200001f, -0.432300001f, -0.358399987f, -0.827400029f,
+	0.0621040016f, 0.721415997f, -0.155851007f, 0.159899995f, 0.510699987f, -0.393000007f, -0.337700009f, -0.855300009f,
+	0.0550969988f, 0.683449984f, -0.135689005f, 0.160799995f, 0.530499995f, -0.492500007f, -0.512700021f, -0.703299999f,
+	0.0509589985f, 0.689091027f, -0.137250006f, 0.158299997f, 0.528400004f, -0.318899989f, -0.462700009f, -0.827199996f,
+	0.0518580005f, 0.679439008f, -0.130380005f, 0.159899995f, 0.533599973f, -0.69630003f, -0.300500005f, -0.651799977f,
+	0.0480000004f, 0.685954988f, -0.129262999f, 0.1567f, 0.532400012f, -0.676100016f, -0.479000002f, -0.559899986f,
+	0.0516720004f, 0.684704006f, -0.134574994f, 0.159099996f, 0.530600011f, -0.421000004f, -0.834599972f, -0.355199993f,
+	0.0550969988f, 0.683449984f, -0.135689005f, 0.0384999998f, 0.565100014f, 0.298000008f, -0.754800022f, -0.584399998f,
+	0.0648439974f, 0.697449982f, -0.148157001f, 0.0401999988f, 0.555599988f, 0.642499983f, -0.617999971f, -0.453099996f,
+	0.0691839978f, 0.700590014f, -0.146330997f, 0.0425000004f, 0.5546f, 0.592100024f, -0.502900004f, -0.629700005f,
+	0.0599320009f, 0.681351006f, -0.130858004f, 0.0414000005f, 0.566600025f, 0.266400009f, -0.757600009f, -0.595799983f,
+	0.0518580005f, 0.679439008f, -0.130380005f, 0.0381000005f, 0.568400025f, 0.165999994f, -0.832799971f, -0.527999997f,
+	0.068200998f, 0.722720981f, -0.159167007f, 0.0414000005f, 0.542999983f, 0.621599972f, -0.380800009f, -0.684499979f,
+	0.0733620003f, 0.723267972f, -0.154785007f, 0.0445000008f, 0.543600023f, 0.616900027f, -0.380400002f, -0.68900001f,
+	0.0394209996f, 0.969419003f, 0.0183589999f, 0.102799997f, 0.640600026f, 0.99940002f, -0.0296f, 0.0205000006f,
+	0.0396520011f, 0.972180009f, 0.0110940002f, 0.106399998f, 0.640600026f, 0.99940002f, -0.0296f, 0.0205000006f,
+	0.0396809988f, 0.974398971f, 0.0129079996f, 0.105899997f, 0.641799986f, 0.99940002f, -0.0296f, 0.0205000006f,
+	-0.0394209996f, 0.969419003f, 0.0183589999f, 0.1193f, 0.717700005f, -0.99940002f, -0.0296f, 0.0205000006f,
+	-0.0396809988f, 0.974398971f, 0.0129079996f, 0.1162f, 0.718900025f, -0.99940002f, -0.0296f, 0.0205000006f,
+	-0.0396520011f, 0.972180009f, 0.0110940002f, 0.115800001f, 0.717700005f, -0.99940002f, -0.0296f, 0.0205000006f,
+	-0.00683700014f, 0.35728699f, 0.00998300035f, 0.279300004f, 0.863099992f, 0.145500004f, -0.278699994f, -0.949299991f,
+	-0.0115299998f, 0.356465012f, 0.00949299987f, 0.281500012f, 0.862800002f, 0.145899996f, -0.264600009f, -0.953299999f,
+	-0.00485899998f, 0.388823986f, -9.99999975e-06f, 0.278800011f, 0.878199995f, 0.0403999984f, -0.304100007f, -0.951799989f,
+	0.000666000007f, 0.390469998f, -0.000348000001f, 0.276300013f, 0.879000008f, 0.0324000008f, -0.303799987f, -0.952199996f,
+	-0.0112939999f, 0.321743011f, 0.0184450001f, 0.281199992f, 0.846499979f, 0.2588f, -0.136700004f, -0.956200004f,
+	-0.0152369998f, 0.32101199f, 0.017616f, 0.282999992f, 0.846199989f, 0.218500003f, -0.0996999964f, -0.970700026f,
+	-0.00876099989f, 0.289701998f, 0.0218720008f, 0.280000001f, 0.831799984f, 0.568799973f, -0.0428999998f, -0.821399987f,
+	-0.0150079997f, 0.296577007f, 0.0171869993f, 0.283399999f, 0.835099995f, 0.546400011f, -0.0388000011f, -0.836700022f,
+	0.00683700014f, 0.35728699f, 0.00998300035f, 0.283699989f, 0.604700029f, -0.145500004f, -0.278699994f, -0.949299991f,
+	-0.000666000007f, 0.390469998f, -0.000348000001f, 0.28670001f, 0.58890003f, -0.0324000008f, -0.303799987f, -0.952199996f,
+	0.00485899998f, 0.388823986f, -9.99999975e-06f, 0.284200013f, 0.589699984f, -0.0403999984f, -0.304100007f, -0.951799989f,
+	0.0115299998f, 0.356465012f, 0.00949299987f, 0.281599998f, 0.605099976f, -0.145899996f, -0.264600009f, -0.953299999f,
+	0.0152369998f, 0.32101199f, 0.017616f, 0.280000001f, 0.621500015f, -0.218500003f, -0.0996999964f, -0.970700026f,
+	0.0112939999f, 0.321743011f, 0.0184450001f, 0.281800002f, 0.621299982f, -0.2588f, -0.136700004f, -0.956200004f,
+	0.0150079997f, 0.296577007f, 0.0171869993f, 0.279300004f, 0.632600009f, -0.546400011f, -0.0388000011f, -0.836700022f,
+	0.00876099989f, 0.289701998f, 0.0218720008f, 0.282599986f, 0.635900021f, -0.568799973f, -0.0428999998f, -0.821399987f,
+	-0.0152369998f, 0.32101199f, 0.017616f, 0.377799988f, 0.850000024f, 0.701900005f, -0.0218000002f, -0.711899996f,
+	-0.0150079997f, 0.296577007f, 0.0171869993f, 0.381599993f, 0.839600027f, 0.866100013f, 0.0168999992f, -0.499500006f,
+	-0.0206359997f, 0.297886014f, 0.0074740001f, 0.386200011f, 0.841899991f, 0.761699975f, 0.075000003f, -0.643599987f,
+	-0.0415050015f, 0.352384001f, -0.0110619999f, 0.389200002f, 0.869599998f, 0.605300009f, -0.199200004f, -0.770600021f,
+	-0.0115299998f, 0.356465012f, 0.00949299987f, 0.373100013f, 0.86589998f, 0.547800004f, -0.266200006f, -0.793200016f,
+	-0.040608f, 0.320780993f, -0.00738199987f, 0.39289999f, 0.855700016f, 0.679499984f, 0.0109999999f, -0.73360002f,
+	-0.0418669991f, 0.30409199f, -0.00904100016f, 0.396499991f, 0.849099994f, 0.619400024f, 0.0311999992f, -0.784500003f,
+	-0.0425629988f, 0.396573991f, -0.0254720002f, 0.386299998f, 0.890500009f, 0.493900001f, -0.304800004f, -0.814300001f,
+	-0.00485899998f, 0.388823986f, -9.99999975e-06f, 0.367900014f, 0.880599976f, 0.481000006f, -0.3292f, -0.8125f,
+	-0.0263459999f, 0.425496995f, -0.0273620002f, 0.376399994f, 0.901899993f, 0.459199995f, -0.311800003f, -0.831799984f,
+	-0.0137630003f, 0.404413015f, -0.0112579996f, 0.371300012f, 0.889500022f, 0.487699986f, -0.316300005f, -0.81370002f,
+	-0.0425480008f, 0.428377002f, -0.0366489999f, 0.38409999f, 0.905600011f, 0.433999985f, -0.298900008f, -0.849900007f,
+	0.0152369998f, 0.32101199f, 0.017616f, 0.417600006f, 0.685100019f, -0.701900005f, -0.0218000002f, -0.711899996f,
+	0.0206359997f, 0.297886014f, 0.0074740001f, 0.409200013f, 0.693199992f, -0.761699975f, 0.075000003f, -0.643599987f,
+	0.0150079997f, 0.296577007f, 0.0171869993f, 0.413800001f, 0.695500016f, -0.866100013f, 0.0168999992f, -0.499500006f,
+	0.0415050015f, 0.352384001f, -0.0110630002f, 0.406300008f, 0.665400028f, -0.605300009f, -0.199200004f, -0.770600021f,
+	0.040608f, 0.320780993f, -0.00738199987f, 0.40259999f, 0.67930001f, -0.679499984f, 0.0109999999f, -0.73360002f,
+	0.0115299998f, 0.356465012f, 0.00949299987f, 0.422399998f, 0.669200003f, -0.547800004f, -0.266200006f, -0.793200016f,
+	0.0418669991f, 0.30409199f, -0.00904100016f, 0.398900002f, 0.68599999f, -0.619400024f, 0.0311999992f, -0.784500003f,
+	0.0425629988f, 0.396573991f, -0.0254720002f, 0.409299999f, 0.644599974f, -0.493900001f, -0.304800004f, -0.814300001f,
+	0.00485899998f, 0.388823986f, -9.99999975e-06f, 0.427599996f, 0.654600024f, -0.481000006f, -0.3292f, -0.8125f,
+	0.0263459999f, 0.425496995f, -0.0273620002f, 0.419200003f, 0.633300006f, -0.459199995f, -0.311800003f, -0.831799984f,
+	0.0425480008f, 0.428377002f, -0.0366489999f, 0.411500007f, 0.629499972f, -0.433999985f, -0.298900008f, -0.849900007f,
+	0.0137630003f, 0.404413015f, -0.0112579996f, 0.424199998f, 0.645600021f, -0.487699986f, -0.316300005f, -0.81370002f,
+	-0.170645997f, 0.762421012f, -0.0949869975f, 0.0649999976f, 0.381099999f, -0.414299995f, -0.311399996f, -0.855199993f,
+	-0.109425001f, 0.768712997f, -0.126936004f, 0.056499999f, 0.350800008f, -0.359899998f, -0.500199974f, -0.787599981f,
+	-0.154773995f, 0.737806976f, -0.093712002f, 0.0754000023f, 0.372900009f, -0.339700013f, -0.405800015f, -0.848500013f,
+	-0.095464997f, 0.732155025f, -0.107890002f, 0.0754000023f, 0.345200002f, -0.30430001f, -0.539699972f, -0.78490001f,
+	-0.0700509995f, 0.75563401f, -0.139985994f, 0.0590999983f, 0.33129999f, -0.372500002f, -0.57190001f, -0.73089999f,
+	-0.0801410004f, 0.773739994f, -0.146456003f, 0.0504000001f, 0.335900009f, -0.417899996f, -0.503199995f, -0.756500006f,
+	-0.121134996f, 0.715094984f, -0.0901279971f, 0.0856000036f, 0.357600003f, -0.246299997f, -0.496199995f, -0.832499981f,
+	-0.0602920018f, 0.741832972f, -0.131288007f, 0.0667999983f, 0.327499986f, -0.289799988f, -0.648500025f, -0.70389998f,
+	0.0463830009f, 0.696645975f, -0.159621f, 0.142900005f, 0.556900024f, 0.3204f, -0.614300013f, -0.721099973f,
+	0.0404530019f, 0.693962991f, -0.160337001f, 0.140000001f, 0.557500005f, 0.3926f, -0.712599993f, -0.581399977f,
+	0.0414390005f, 0.717481971f, -0.172135994f, 0.141900003f, 0.54549998f, 0.407200009f, -0.397300005f, -0.822399974f,
+	0.0468659997f, 0.71815598f, -0.169614002f, 0.144600004f, 0.54610002f, 0.427599996f, -0.388799995f, -0.816100001f,
+	0.0342219993f, 0.681895018f, -0.140233994f, 0.138400003f, 0.568599999f, -0.0993999988f, -0.760800004f, -0.641300023f,
+	0.0418150015f, 0.680595994f, -0.141112998f, 0.141800001f, 0.568199992f, -0.199900001f, -0.715300024f, -0.66960001f,
+	0.0213050004f, 0.657873988f, -0.0631640032f, 0.912999988f, 0.832000017f, -0.145099998f, -0.316000015f, -0.937600017f,
+	0.0208700001f, 0.67445302f, -0.0686839968f, 0.905099988f, 0.832000017f, -0.145099998f, -0.316000015f, -0.937600017f,
+	0.0251739994f, 0.660881996f, -0.0647760034f, 0.911499977f, 0.830200016f, -0.145099998f, -0.316000015f, -0.937600017f,
+	0.0404530019f, 0.693962991f, -0.160337001f, 0.0625f, 0.5546f, -0.569100022f, -0.45660001f, -0.683899999f,
+	0.0357859991f, 0.69561702f, -0.157698005f, 0.0599999987f, 0.555199981f, -0.553900003f, -0.495200008f, -0.66930002f,
+	0.0365110002f, 0.717706025f, -0.167177007f, 0.057f, 0.544700027f, -0.667200029f, -0.306400001f, -0.678900003f,
+	0.0414390005f, 0.717481971f, -0.172135994f, 0.059700001f, 0.542999983f, -0.682399988f, -0.304699987f, -0.664399981f,
+	0.0342219993f, 0.681895018f, -0.140233994f, 0.0595999993f, 0.565299988f, -0.537599981f, -0.638999999f, -0.550199986f,
+	0.0795459971f, 0.411570996f, -0.00379400002f, 0.285400003f, 0.577700019f, 0.883599997f, 0.465999991f, 0.0465000011f,
+	0.0642170012f, 0.44037801f, -0.0284209996f, 0.283899993f, 0.559300005f, 0.902700007f, 0.425399989f, -0.0643000007f,
+	0.0640410036f, 0.44175899f, -0.0217480008f, 0.281199992f, 0.560899973f, 0.901199996f, 0.430000007f, -0.0553000011f,
+	0.0781069994f, 0.413724989f, 0.00312600005f, 0.282299995f, 0.578999996f, 0.892199993f, 0.449400008f, 0.0456999987f,
+	0.084220998f, 0.399650007f, 0.0144020002f, 0.282999992f, 0.587499976f, 0.846899986f, 0.517700016f, 0.121600002f,
+	0.0870129988f, 0.396869987f, 0.00858100038f, 0.286199987f, 0.587000012f, 0.8301f, 0.539699972f, 0.140400007f,
+	-0.0795459971f, 0.411570996f, -0.00379400002f, 0.462000012f, 0.943700016f, -0.883599997f, 0.465999991f, 0.0465000011f,
+	-0.0781069994f, 0.413724989f, 0.00312600005f, 0.465200007f, 0.944700003f, -0.892199993f, 0.449400008f, 0.0456999987f,
+	-0.0640410036f, 0.44175899f, -0.0217480008f, 0.454699993f, 0.959500015f, -0.901199996f, 0.430000007f, -0.0553000011f,
+	-0.0642170012f, 0.44037801f, -0.0284209996f, 0.451599985f, 0.959100008f, -0.902700007f, 0.425399989f, -0.0643000007f,
+	-0.0870129988f, 0.396869987f, 0.00858100038f, 0.467200011f, 0.935899973f, -0.8301f, 0.539699972f, 0.140300006f,
+	-0.084220998f, 0.399650007f, 0.0144020002f, 0.469900012f, 0.9375f, -0.846899986f, 0.517700016f, 0.121600002f,
+	0.0691839978f, 0.700590014f, -0.146330997f, 0.131600007f, 0.544700027f, 0.948800027f, -0.315699995f, 0.0131000001f,
+	0.0733620003f, 0.723267972f, -0.154785007f, 0.1347f, 0.533999979f, 0.957599998f, -0.237299994f, -0.163299993f,
+	0.0744189993f, 0.722761989f, -0.147847995f, 0.137199998f, 0.536000013f, 0.961099982f, -0.236699998f, -0.142199993f,
+	0.0704509988f, 0.704925001f, -0.140097007f, 0.135100007f, 0.544700027f, 0.952499986f, -0.30430001f, 0.00960000046f,
+	0.0599320009f, 0.681351006f, -0.130858004f, 0.131600007f, 0.556699991f, 0.915300012f, -0.402500004f, 0.0152000003f,
+	0.0634360015f, 0.689020991f, -0.128603995f, 0.1347f, 0.554199994f, 0.911000013f, -0.412099987f, -0.0141000003f,
+	-0.0210570004f, 0.674328029f, -0.0691599995f, 0.897000015f, 0.801900029f, 0.123000003f, -0.341500014f, -0.931800008f,
+	-0.0213050004f, 0.657873988f, -0.063161999f, 0.897000015f, 0.79400003f, 0.123000003f, -0.341500014f, -0.931800008f,
+	-0.0251739994f, 0.660881996f, -0.0647749975f, 0.898800015f, 0.79549998f, 0.123000003f, -0.341500014f, -0.931800008f,
+	-0.0174519997f, 0.284833997f, 0.00315500004f, 0.311100006f, 0.82099998f, 0.774500012f, -0.0829000026f, -0.627200007f,
+	-0.042498f, 0.290962994f, -0.0153980004f, 0.323599994f, 0.828100026f, 0.576399982f, -0.0996000022f, -0.811100006f,
+	-0.0418380015f, 0.301670015f, -0.0162439998f, 0.322100013f, 0.832799971f, 0.575699985f, -0.101000004f, -0.811399996f,
+	-0.182879001f, 0.760116994f, -0.0914480016f, 0.165999994f, 0.395200014f, -0.439200014f, -0.374799997f, -0.816500008f,
+	-0.177435994f, 0.761258006f, -0.0947809964f, 0.163499996f, 0.393700004f, -0.429399997f, -0.364899993f, -0.826099992f,
+	-0.158898994f, 0.735166013f, -0.0928919986f, 0.166500002f, 0.379500002f, -0.41960001f, -0.565299988f, -0.710200012f,
+	-0.163930997f, 0.73398f, -0.0889229998f, 0.169100001f, 0.380800009f, -0.451799989f, -0.51910001f, -0.725600004f,
+	-0.119719997f, 0.70795399f, -0.0882840008f, 0.166099995f, 0.357800007f, -0.381900012f, -0.664499998f, -0.642400026f,
+	-0.120370999f, 0.701949f, -0.0816610008f, 0.169799998f, 0.356099993f, -0.382499993f, -0.665400028f, -0.640999973f,
+	0.00462799985f, 0.440901011f, 0.0399020016f, 0.58890003f, 0.0403999984f, -0.938600004f, 0.296000004f, 0.177300006f,
+	0.000406000006f, 0.429446995f, 0.0514749996f, 0.589600027f, 0.0331999995f, 0.0922999978f, 0.700399995f, 0.707799971f,
+	0.0263529997f, 0.42513299f, 0.0790800005f, 0.605300009f, 0.0284000002f, -0.26820001f, 0.203199998f, 0.941699982f,
+	-0.000433000008f, 0.400554001f, 0.0586390011f, 0.589100003f, 0.0198999997f, -0.0546999983f, 0.189799994f, 0.980300009f,
+	0.0281610005f, 0.402184993f, 0.0797370002f, 0.605300009f, 0.0185000002f, -0.192399994f, 0.0271000005f, 0.98089999f,
+	0.0904010013f, 0.649138987f, -0.0404420011f, 0.171499997f, 0.96420002f, 0.651899993f, -0.728399992f, -0.210700005f,
+	0.0827779993f, 0.644716978f, -0.0440419987f, 0.175500005f, 0.965900004f, 0.58069998f, -0.756600022f, -0.300500005f,
+	0.0806759968f, 0.645300984f, -0.0495730005f, 0.176100001f, 0.968500018f, 0.57190001f, -0.768899977f, -0.286000013f,
+	0.0914369971f, 0.651677012f, -0.0457409993f, 0.170399994f, 0.966700017f, 0.654200017f, -0.72390002f, -0.218899995f,
+	0.0972760022f, 0.657420993f, -0.0431980006f, 0.166700006f, 0.965600014f, 0.887700021f, -0.452600002f, -0.0839999989f,
+	0.0975809991f, 0.657198012f, -0.0375379995f, 0.166600004f, 0.963100016f, 0.925300002f, -0.379200011f, -0.00600000005f,
+	0.0987560004f, 0.665507019f, -0.0432059988f, 0.163000003f, 0.966000021f, 0.988600016f, -0.0412000008f, 0.144600004f,
+	0.0975169986f, 0.667984009f, -0.0381239988f, 0.161699995f, 0.963699996f, 0.973399997f, 0.0182000007f, 0.228499994f,
+	-0.0395569988f, 0.626561999f, -0.0524890013f, 0.937600017f, 0.815199971f, -0.799600005f, -0.367300004f, -0.475199997f,
+	-0.0400860012f, 0.630187988f, -0.0544029996f, 0.93599999f, 0.816100001f, -0.858699977f, -0.386099994f, -0.337000012f,
+	-0.0361989997f, 0.626452029f, -0.0549289994f, 0.936500013f, 0.81370002f, -0.533399999f, -0.454299986f, -0.713500023f,
+	-0.0409459993f, 0.630240977f, -0.0484590009f, 0.938199997f, 0.817700028f, -0.912400007f, -0.388700008f, -0.1285f,
+	-0.0429270007f, 0.634203017f, -0.0498449989f, 0.936600029f, 0.819100022f, -0.870100021f, -0.477600008f, -0.121699996f,
+	-0.0860510021f, 0.673691988f, 0.0579940006f, 0.170000002f, 0.959399998f, 0.135700002f, -0.596099973f, 0.791400015f,
+	-0.0881839991f, 0.671259999f, 0.056175001f, 0.168400005f, 0.958899975f, 0.238499999f, -0.306899995f, 0.921400011f,
+	-0.0832260028f, 0.668033004f, 0.0538170002f, 0.169200003f, 0.956099987f, 0.293199986f, -0.325599998f, 0.898899972f,
+	-0.079896003f, 0.672456026f, 0.055594001f, 0.171700001f, 0.956900001f, 0.182500005f, -0.621399999f, 0.762000024f,
+	-0.0859180018f, 0.677586019f, 0.0611979999f, 0.171299994f, 0.961300015f, 0.112199999f, -0.6699f, 0.733900011f,
+	-0.0911260024f, 0.66939199f, 0.0573850013f, 0.166800007f, 0.959299982f, 0.475400001f, -0.0057000001f, 0.879800022f,
+	-0.0833529979f, 0.663227975f, 0.0528860018f, 0.167799994f, 0.954400003f, 0.500899971f, 0.220599994f, 0.836899996f,
+	-0.0905319974f, 0.662621975f, 0.0578989983f, 0.164700001f, 0.957000017f, 0.537899971f, 0.26030001f, 0.801800013f,
+	-0.0849040002f, 0.654515028f, 0.0589670017f, 0.163200006f, 0.952799976f, 0.423999995f, 0.566399992f, 0.706700027f,
+	-0.0788519979f, 0.656620979f, 0.0535710007f, 0.166500002f, 0.950999975f, 0.424699992f, 0.609899998f, 0.66900003f,
+	-0.0708139986f, 0.645177007f, 0.0629820004f, 0.161699995f, 0.945100009f, 0.413399994f, 0.733799994f, 0.539200008f,
+	-0.0652500018f, 0.646323979f, 0.0563619994f, 0.165199995f, 0.943300009f, 0.451799989f, 0.734200001f, 0.506900012f,
+	-0.069325f, 0.687463999f, 0.0686369985f, 0.180700004f, 0.961899996f, 0.270399988f, -0.73299998f, 0.624199986f,
+	-0.0628739968f, 0.685477018f, 0.0625239983f, 0.181899995f, 0.957899988f, 0.327800006f, -0.74059999f, 0.586499989f,
+	-0.0174219999f, 0.294364005f, 0.00192299997f, 0.310000002f, 0.825200021f, 0.724600017f, -0.0741999969f, -0.685199976f,
+	-0.0120780002f, 0.280761003f, 0.013429f, 0.306800008f, 0.817499995f, 0.894900024f, 0.0535999984f, -0.443100005f,
+	-0.00876099989f, 0.289701998f, 0.0218720008f, 0.301499993f, 0.819800019f, 0.879599988f, 0.0746000037f, -0.469799995f,
+	-0.00819199998f, 0.279983014f, 0.0197640005f, 0.303799987f, 0.815900028f, 0.85589999f, 0.157000005f, -0.492700011f,
+	-0.0112939999f, 0.321743011f, 0.0184450001f, 0.298299998f, 0.834100008f, 0.756600022f, -0.126699999f, -0.64139998f,
+	-0.00333400001f, 0.323119015f, 0.0275630001f, 0.293000013f, 0.832799971f, 0.774699986f, -0.135800004f, -0.617600024f,
+	-0.00421199994f, 0.294984013f, 0.031293001f, 0.296299994f, 0.8204f, 0.9005f, -0.0f, -0.434799999f,
+	-0.00242800009f, 0.282256991f, 0.0308519993f, 0.298099995f, 0.814899981f, 0.861299992f, 0.145400003f, -0.486799985f,
+	-0.00683700014f, 0.35728699f, 0.00998300035f, 0.294200003f, 0.850300014f, 0.760399997f, -0.267100006f, -0.592000008f,
+	-0.000617999991f, 0.346816003f, 0.0213370007f, 0.290499985f, 0.843699992f, 0.738099992f, -0.243699998f, -0.629100025f,
+	0.000666000007f, 0.390469998f, -0.000348000001f, 0.290100008f, 0.86589998f, 0.810800016f, -0.208199993f, -0.546999991f,
+	0.00671900017f, 0.394652992f, 0.00701300008f, 0.285400003f, 0.866100013f, 0.805100024f, -0.211799994f, -0.55400002f,
+	0.000800999987f, 0.362805992f, 0.0173099991f, 0.288800001f, 0.851000011f, 0.762700021f, -0.284299999f, -0.580900013f,
+	-0.00204699999f, 0.41207999f, -0.00683500012f, 0.289400011f, 0.876100004f, 0.79610002f, -0.0698999986f, -0.601100028f,
+	-0.00663000019f, 0.405418992f, -0.0120599996f, 0.29339999f, 0.874499977f, 0.794799984f, -0.0744000003f, -0.602199972f,
+	-0.0204959996f, 0.431713998f, -0.0331769995f, 0.299699992f, 0.889800012f, 0.615199983f, 0.178200006f, -0.76789999f,
+	-0.0169220008f, 0.439929992f, -0.0283439998f, 0.2958f, 0.892199993f, 0.662500024f, 0.125200003f, -0.738499999f,
+	-0.0425309986f, 0.434123993f, -0.0422139987f, 0.308899999f, 0.895600021f, 0.436199993f, 0.181600004f, -0.881399989f,
+	-0.0425439999f, 0.442039996f, -0.0409360006f, 0.307099998f, 0.898699999f, 0.44600001f, 0.143399999f, -0.88349998f,
+	0.0174219999f, 0.294364005f, 0.00192299997f, 0.301600009f, 0.645200014f, -0.724600017f, -0.0741999969f, -0.685199976f,
+	0.0174519997f, 0.284833997f, 0.00315500004f, 0.300599992f, 0.649399996f, -0.774500012f, -0.0829000026f, -0.627200007f,
+	0.0120780002f, 0.280761003f, 0.013429f, 0.304800004f, 0.652999997f, -0.894900024f, 0.0535999984f, -0.443100005f,
+	0.00876099989f, 0.289701998f, 0.0218720008f, 0.310099989f, 0.650600016f, -0.879599988f, 0.0746000037f, -0.469799995f,
+	0.0418380015f, 0.301670015f, -0.0162439998f, 0.289600015f, 0.637700021f, -0.575699985f, -0.101000004f, -0.811399996f,
+	0.042498f, 0.290962994f, -0.0153980004f, 0.287999988f, 0.64230001f, -0.576399982f, -0.0996000022f, -0.811100006f,
+	0.00819199998f, 0.279983014f, 0.0197640005f, 0.307799995f, 0.654500008f, -0.85589999f, 0.157000005f, -0.492700011f,
+	0.00421199994f, 0.294984013f, 0.031293001f, 0.315400004f, 0.649999976f, -0.9005f, -0.0f, -0.434799999f,
+	0.00333400001f, 0.323119015f, 0.0275630001f, 0.318699986f, 0.637600005f, -0.774699986f, -0.135800004f, -0.617600024f,
+	0.0112939999f, 0.321743011f, 0.0184450001f, 0.3134f, 0.636300027f, -0.756600022f, -0.126699999f, -0.64139998f,
+	0.00242800009f, 0.282256991f, 0.0308519993f, 0.313499987f, 0.655499995f, -0.861299992f, 0.145400003f, -0.486799985f,
+	0.00683700014f, 0.35728699f, 0.00998300035f, 0.317499995f, 0.620199978f, -0.760399997f, -0.267100006f, -0.592000008f,
+	0.000617999991f, 0.346816003f, 0.0213370007f, 0.321200013f, 0.626699984f, -0.738099992f, -0.243699998f, -0.629100025f,
+	-0.000800999987f, 0.362805992f, 0.0173099991f, 0.322899997f, 0.619400024f, -0.762700021f, -0.284299999f, -0.580900013f,
+	-0.00671900017f, 0.394652992f, 0.00701300008f, 0.326299995f, 0.604399979f, -0.805100024f, -0.211799994f, -0.55400002f,
+	-0.000666000007f, 0.390469998f, -0.000348000001f, 0.32159999f, 0.604600012f, -0.810800016f, -0.208199993f, -0.546999991f,
+	0.00204699999f, 0.41207999f, -0.00683500012f, 0.3222f, 0.594299972f, -0.79610002f, -0.0698999986f, -0.601100028f,
+	0.00663000019f, 0.405418992f, -0.0120599996f, 0.318199992f, 0.596000016f, -0.794799984f, -0.0744000003f, -0.602199972f,
+	0.0169220008f, 0.439929992f, -0.0283439998f, 0.315899998f, 0.578199983f, -0.662500024f, 0.125200003f, -0.738499999f,
+	0.0204959996f, 0.431713998f, -0.0331769995f, 0.31189999f, 0.58069998f, -0.615199983f, 0.178200006f, -0.76789999f,
+	0.0425309986f, 0.434123993f, -0.0422139987f, 0.3028f, 0.574800014f, -0.436199993f, 0.181600004f, -0.881299973f,
+	0.0425439999f, 0.442039996f, -0.0409360006f, 0.304699987f, 0.571699977f, -0.44600001f, 0.143399999f, -0.88349998f,
+	-0.0489090011f, 0.767250001f, -0.110835999f, 0.838100016f, 0.0983999968f, 0.897499979f, -0.0538999997f, 0.437599987f,
+	0.152615994f, 0.695397973f, -0.0806019977f, 0.121399999f, 0.532599986f, 0.723200023f, -0.376800001f, 0.578800023f,
+	0.177437007f, 0.743104994f, -0.0918760002f, 0.1206f, 0.507799983f, 0.819700003f, -0.31310001f, 0.479699999f,
+	0.171208993f, 0.742564976f, -0.0815870017f, 0.125599995f, 0.50999999f, 0.814400017f, -0.310799986f, 0.49000001f,
+	0.147829995f, 0.700215995f, -0.0717329979f, 0.126399994f, 0.532400012f, 0.709900022f, -0.3829f, 0.591099977f,
+	0.124585003f, 0.679482996f, -0.0622919984f, 0.130999997f, 0.546400011f, 0.654399991f, -0.48969999f, 0.576200008f,
+	0.129125997f, 0.674180984f, -0.0721599981f, 0.125599995f, 0.546899974f, 0.654399991f, -0.498199999f, 0.568799973f,
+	-0.00242800009f, 0.282256991f, 0.0308519993f, 0.326400012f, 0.762000024f, 0.715499997f, 0.0702999979f, 0.695100009f,
+	-0.00421199994f, 0.294984013f, 0.031293001f, 0.324000001f, 0.76730001f, 0.728999972f, 0.0749000013f, 0.680499971f,
+	-0.00724099996f, 0.297107011f, 0.0343040004f, 0.32190001f, 0.767700016f, 0.697899997f, 0.0815000013f, 0.711499989f,
+	-0.0063029998f, 0.278393f, 0.0351979993f, 0.324400008f, 0.759500027f, 0.713400006f, 0.0691f, 0.697399974f,
+	-0.00333400001f, 0.323119015f, 0.0275630001f, 0.321700007f, 0.779999971f, 0.655900002f, 0.0593000017f, 0.752499998f,
+	-0.0107129999f, 0.301229f, 0.036460001f, 0.319599986f, 0.768899977f, 0.611100018f, 0.112400003f, 0.783500016f,
+	-0.00801199954f, 0.327243f, 0.0319169983f, 0.318399996f, 0.781000018f, 0.653100014f, -0.0102000004f, 0.757200003f,
+	-0.0116940001f, 0.323058009f, 0.0338059999f, 0.317099988f, 0.778599977f, 0.59799999f, 0.0285999998f, 0.800999999f,
+	-0.000617999991f, 0.346816003f, 0.0213370007f, 0.321500003f, 0.791100025f, 0.646799982f, 0.0851999968f, 0.7579f,
+	-0.00903899968f, 0.346985012f, 0.0274039991f, 0.317000002f, 0.790099978f, 0.584699988f, 0.0355000012f, 0.810500026f,
+	-0.0109200003f, 0.352088988f, 0.029414f, 0.315200001f, 0.791999996f, 0.608099997f, -0.0274f, 0.79339999f,
+	0.000800999987f, 0.362805992f, 0.0173099991f, 0.321399987f, 0.798600018f, 0.776899993f, 0.0763000026f, 0.625f,
+	-0.00719100004f, 0.370020002f, 0.0263749994f, 0.315299988f, 0.800400019f, 0.743799984f, 0.0562999994f, 0.666100025f,
+	-0.0038350001f, 0.37659201f, 0.0216090009f, 0.317099988f, 0.80400002f, 0.779900014f, 0.0500000007f, 0.623899996f,
+	0.00671900017f, 0.394652992f, 0.00701300008f, 0.323000014f, 0.813899994f, 0.813499987f, -0.00540000014f, 0.58160001f,
+	0.000730000029f, 0.39785701f, 0.0160709992f, 0.317900002f, 0.814100027f, 0.828400016f, -0.0322000012f, 0.559199989f,
+	0.00242800009f, 0.282256991f, 0.0308519993f, 0.44780001f, 0.590399981f, -0.715499997f, 0.0702999979f, 0.695100009f,
+	0.0063029998f, 0.278393f, 0.0351979993f, 0.449800014f, 0.592800021f, -0.713400006f, 0.0691f, 0.697399974f,
+	0.00724099996f, 0.297107011f, 0.0343040004f, 0.452300012f, 0.584699988f, -0.697899997f, 0.0815000013f, 0.711499989f,
+	0.00421199994f, 0.294984013f, 0.031293001f, 0.450199991f, 0.585099995f, -0.728999972f, 0.0749000013f, 0.680499971f,
+	0.00333400001f, 0.323119015f, 0.0275630001f, 0.452499986f, 0.572399974f, -0.655900002f, 0.0593000017f, 0.752499998f,
+	0.0107129999f, 0.301229f, 0.036460001f, 0.454600006f, 0.583400011f, -0.611100018f, 0.112400003f, 0.783500016f,
+	0.0116940001f, 0.323058009f, 0.0338059999f, 0.456999987f, 0.573800027f, -0.59799999f, 0.0285999998f, 0.800999999f,
+	0.00801199954f, 0.327243f, 0.0319169983f, 0.455799997f, 0.571399987f, -0.653100014f, -0.0102000004f, 0.757200003f,
+	0.000617999991f, 0.346816003f, 0.0213370007f, 0.452600002f, 0.56129998f, -0.646799982f, 0.0851999968f, 0.7579f,
+	0.00903899968f, 0.346985012f, 0.0274039991f, 0.457199991f, 0.562300026f, -0.584699988f, 0.0355000012f, 0.810500026f,
+	0.0109200003f, 0.352088988f, 0.029414f, 0.458999991f, 0.560400009f, -0.608099997f, -0.0274f, 0.79339999f,
+	0.00719100004f, 0.370020002f, 0.0263749994f, 0.458900005f, 0.551999986f, -0.743799984f, 0.0562999994f, 0.666100025f,
+	-0.000800999987f, 0.362805992f, 0.0173099991f, 0.452800006f, 0.553799987f, -0.776899993f, 0.0763000026f, 0.625f,
+	0.0038350001f, 0.37659201f, 0.0216090009f, 0.457100004f, 0.548399985f, -0.779900014f, 0.0500000007f, 0.623899996f,
+	-0.00671900017f, 0.394652992f, 0.00701300008f, 0.451299995f, 0.538399994f, -0.813499987f, -0.00540000014f, 0.58160001f,
+	-0.000730000029f, 0.39785701f, 0.0160709992f, 0.456400007f, 0.538299978f, -0.828400016f, -0.0322000012f, 0.559199989f,
+	-0.0389630012f, 0.427406996f, -0.0619699992f, 0.901499987f, 0.771600008f, 0.846899986f, -0.0773999989f, -0.52609998f,
+	-0.0446229987f, 0.423994005f, -0.0682670027f, 0.899900019f, 0.767799973f, 0.298700005f, -0.077200003f, -0.951200008f,
+	-0.0425209999f, 0.443780988f, -0.0692140013f, 0.908999979f, 0.768000007f, 0.470400006f, -0.0175999999f, -0.882300019f,
+	-0.0400779992f, 0.446945012f, -0.0647810027f, 0.910399973f, 0.770299971f, 0.726100028f, -0.00389999989f, -0.687600017f,
+	-0.0321930014f, 0.446500003f, -0.0505909994f, 0.910099983f, 0.777700007f, 0.881900012f, -0.0388000011f, -0.469700009f,
+	-0.0335259996f, 0.427116007f, -0.049509f, 0.901300013f, 0.777800024f, 0.912500024f, -0.0851000026f, -0.400099993f,
+	-0.185343996f, 0.867317021f, 0.0316519998f, 0.600499988f, 0.495799989f, -0.957899988f, 0.0187999997f, -0.286500007f,
+	-0.187497005f, 0.867861986f, 0.043056f, 0.602900028f, 0.491100013f, -0.995999992f, -0.0824000016f, -0.0351999998f,
+	-0.188434005f, 0.879311025f, 0.042764999f, 0.60769999f, 0.493000001f, -0.994799972f, -0.0518000014f, -0.0872000009f,
+	-0.181669995f, 0.86590898f, 0.0204860009f, 0.598100007f, 0.500400007f, -0.91960001f, -0.00449999981f, -0.392800003f,
+	-0.185312003f, 0.863120019f, 0.0624470003f, 0.603999972f, 0.482199997f, -0.961399972f, -0.124799997f, 0.245299995f,
+	-0.185765997f, 0.874008f, 0.0661730021f, 0.609200001f, 0.4824f, -0.961199999f, -0.107000001f, 0.254299998f,
+	-0.180427998f, 0.877388f, 0.0173199996f, 0.602299988f, 0.503700018f, -0.893899977f, 0.0305000003f, -0.447299987f,
+	-0.173648f, 0.860884011f, 0.00641300017f, 0.592999995f, 0.505800009f, -0.741299987f, 0.122599997f, -0.65990001f,
+	-0.157866001f, 0.86469698f, -0.00869700033f, 0.591000021f, 0.515600026f, -0.66930002f, 0.0851000026f, -0.738099992f,
+	-0.164106995f, 0.854689002f, -0.00424499996f, 0.588100016f, 0.510800004f, -0.678600013f, 0.0995000005f, -0.727699995f,
+	-0.152504995f, 0.846212983f, -0.0148689998f, 0.582000017f, 0.515900016f, -0.524299979f, 0.128999993f, -0.841700017f,
+	-0.138834f, 0.851675987f, -0.0267440006f, 0.581200004f, 0.524399996f, -0.654900014f, -0.1215f, -0.745899975f,
+	-0.141463995f, 0.838980019f, -0.0223660003f, 0.576799989f, 0.520200014f, -0.619000018f, -0.1193f, -0.776199996f,
+	-0.108502999f, 0.833047986f, -0.0448919982f, 0.567300022f, 0.535700023f, -0.532899976f, -0.319999993f, -0.783299983f,
+	-0.112410001f, 0.819966972f, -0.0365790017f, 0.56309998f, 0.529900014f, -0.526600003f, -0.361900002f, -0.769299984f,
+	-0.0812380016f, 0.824496984f, -0.058056999f, 0.558099985f, 0.546299994f, -0.452100009f, -0.47330001f, -0.755999982f,
+	-0.0731180012f, 0.804139018f, -0.0490510017f, 0.548099995f, 0.542800009f, -0.439099997f, -0.504100025f, -0.743700027f,
+	-0.176632002f, 0.853667021f, 0.0790020004f, 0.602599978f, 0.472900003f, -0.843200028f, -0.127700001f, 0.522300005f,
+	-0.173847005f, 0.862152994f, 0.0851449966f, 0.607200027f, 0.471199989f, -0.809300005f, -0.105400003f, 0.577899992f,
+	-0.168050006f, 0.844718993f, 0.0883129984f, 0.600399971f, 0.466699988f, -0.710200012f, -0.109800003f, 0.6954f,
+	-0.161276996f, 0.838600993f, 0.0939349979f, 0.598800004f, 0.462399989f, -0.665899992f, -0.114500001f, 0.737200022f,
+	-0.144188002f, 0.835646987f, 0.108792998f, 0.600099981f, 0.451799989f, -0.632000029f, -0.293099999f, 0.717400014f,
+	-0.147760004f, 0.826869011f, 0.101756997f, 0.595600009f, 0.453599989f, -0.620000005f, -0.321399987f, 0.715799987f,
+	-0.132361993f, 0.813751996f, 0.107780002f, 0.591099977f, 0.445800006f, -0.60769999f, -0.414700001f, 0.677299976f,
+	-0.116913997f, 0.81439501f, 0.122366004f, 0.593699992f, 0.436399996f, -0.535600007f, -0.521399975f, 0.664300025f,
+	-0.113562003f, 0.799820006f, 0.112534001f, 0.585699975f, 0.436300009f, -0.485300004f, -0.573000014f, 0.66049999f,
+	-0.0772640035f, 0.799160004f, 0.135657996f, 0.588500023f, 0.417199999f, -0.432000011f, -0.614099979f, 0.66049999f,
+	-0.0721520036f, 0.780730009f, 0.121287003f, 0.577799976f, 0.417100012f, -0.426699996f, -0.626699984f, 0.65200001f,
+	-0.064937003f, 0.751510978f, -0.145539999f, 0.185399994f, 0.339300007f, -0.263099998f, -0.570800006f, -0.777800024f,
+	-0.0774519965f, 0.775426984f, -0.154413f, 0.183400005f, 0.351999998f, -0.459699988f, -0.510200024f, -0.726899981f,
+	-0.0723899975f, 0.776905f, -0.158650994f, 0.180299997f, 0.351700008f, -0.438699991f, -0.510500014f, -0.739499986f,
+	-0.0602729991f, 0.752848983f, -0.148001f, 0.182999998f, 0.3389f, -0.240899995f, -0.572300017f, -0.783900023f,
+	-0.0537620001f, 0.735822976f, -0.135330006f, 0.186800003f, 0.329600006f, -0.0489999987f, -0.683499992f, -0.728299975f,
+	-0.0497579984f, 0.739726007f, -0.139191002f, 0.183799997f, 0.330300003f, -0.0494000018f, -0.676199973f, -0.735000014f,
+	-0.0458009988f, 0.736304998f, -0.134917006f, 0.184f, 0.327300012f, 0.0794999972f, -0.740999997f, -0.666800022f,
+	0.00502099982f, 0.502780974f, 0.0304329991f, 0.984600008f, 0.129099995f, -0.915499985f, -0.120200001f, 0.383899987f,
+	-0.00070199999f, 0.53320998f, 0.0326879993f, 0.988900006f, 0.1426f, 0.0171000008f, -0.2377f, 0.971199989f,
+	-0.000127000007f, 0.538957f, 0.0068930001f, 0.978100002f, 0.147799999f, 0.0675000027f, -0.128700003f, -0.989400029f,
+	0.000887000002f, 0.494726002f, 0.00517700007f, 0.972500026f, 0.128600001f, -0.942799985f, -0.119000003f, -0.311500013f,
+	0.00891099963f, 0.457771003f, 0.00908300001f, 0.970099986f, 0.111699998f, -0.871200025f, -0.228599995f, -0.434500009f,
+	0.00713500008f, 0.461908996f, 0.0286030006f, 0.979099989f, 0.111400001f, -0.978100002f, 0.0750999972f, 0.194000006f,
+	0.00626600021f, 0.436453015f, 0.0257680006f, 0.975000024f, 0.100500003f, -0.941100001f, 0.107799999f, -0.320600003f,
+	0.00462799985f, 0.440901011f, 0.0399020016f, 0.98180002f, 0.1008f, -0.938600004f, 0.296000004f, 0.177300006f,
+	0.000406000006f, 0.429446995f, 0.0514749996f, 0.985700011f, 0.0942000002f, 0.0922999978f, 0.700399995f, 0.707799971f,
+	0.000296999991f, 0.42167601f, 0.0304220002f, 0.975600004f, 0.0930000022f, 0.0189999994f, 0.4296f, -0.902800024f,
+	-0.00433799997f, 0.503597975f, 0.0279460009f, 0.974300027f, 0.186299995f, 0.941200018f, -0.0709000006f, 0.330300003f,
+	-0.00246499991f, 0.491616994f, -0.00190300005f, 0.959699988f, 0.186700001f, 0.931400001f, -0.135700002f, -0.337799996f,
+	-0.000127000007f, 0.538957f, 0.0068930001f, 0.970799983f, 0.167899996f, 0.0675000027f, -0.128700003f, -0.989400029f,
+	-0.00070199999f, 0.53320998f, 0.0326879993f, 0.98089999f, 0.174400002f, 0.0171000008f, -0.2377f, 0.971199989f,
+	-0.00902900007f, 0.457702011f, 0.0355120003f, 0.970399976f, 0.207100004f, 0.970899999f, 0.0775000006f, 0.226600006f,
+	-0.00923800003f, 0.457783014f, 0.011953f, 0.960399985f, 0.203500003f, 0.941100001f, -0.197400004f, -0.274699986f,
+	-0.0065299999f, 0.443136007f, 0.0425609984f, 0.971199989f, 0.214499995f, 0.91079998f, 0.384900004f, 0.149100006f,
+	-0.00766499992f, 0.439518005f, 0.0242849998f, 0.962899983f, 0.213200003f, 0.949100018f, 0.121699996f, -0.290399998f,
+	0.000296999991f, 0.42167601f, 0.0304220002f, 0.962899983f, 0.222499996f, 0.0189999994f, 0.4296f, -0.902800024f,
+	0.000406000006f, 0.429446995f, 0.0514749996f, 0.97299999f, 0.222299993f, 0.0922999978f, 0.700399995f, 0.707799971f,
+	0.0351830013f, 0.650166988f, -0.0541110002f, 0.908299983f, 0.843900025f, 0.466600001f, -0.365700006f, -0.805299997f,
+	0.0213050004f, 0.657873988f, -0.0631640032f, 0.900099993f, 0.842199981f, 0.159299999f, -0.617699981f, -0.770099998f,
+	0.0251739994f, 0.660881996f, -0.0647760034f, 0.900900006f, 0.839999974f, 0.212400004f, -0.582499981f, -0.784600019f,
+	0.0386720002f, 0.653213024f, -0.0530980006f, 0.909600019f, 0.842199981f, 0.510200024f, -0.318500012f, -0.798900008f,
+	-0.0251739994f, 0.660881996f, -0.0647749975f, 0.92809999f, 0.836799979f, -0.211999997f, -0.582899988f, -0.784399986f,
+	-0.0213050004f, 0.657873988f, -0.063161999f, 0.92900002f, 0.83890003f, -0.159299999f, -0.617799997f, -0.769999981f,
+	-0.0351819992f, 0.650166988f, -0.0541080013f, 0.920799971f, 0.840699971f, -0.464700013f, -0.367900014f, -0.805499971f,
+	-0.038679f, 0.653212011f, -0.0531079993f, 0.919499993f, 0.838999987f, -0.508099973f, -0.321099997f, -0.799199998f,
+	-0.0639199987f, 0.432381004f, -0.0643879995f, 0.664699972f, 0.814700007f, -0.379799992f, 0.0759999976f, -0.921899974f,
+	-0.0606499985f, 0.448092014f, -0.0640430003f, 0.67110002f, 0.818000019f, -0.428600013f, 0.108900003f, -0.896899998f,
+	-0.0425209999f, 0.443780988f, -0.0692140013f, 0.666899979f, 0.825699985f, 0.470400006f, -0.0175999999f, -0.882300019f,
+	-0.0446229987f, 0.423994005f, -0.0682670027f, 0.658599973f, 0.822300017f, 0.298700005f, -0.077200003f, -0.951200008f,
+	-0.0699850023f, 0.454293996f, -0.056694001f, 0.675499976f, 0.813799977f, -0.37470001f, 0.121299997f, -0.919200003f,
+	-0.0724980012f, 0.435833007f, -0.0581349991f, 0.667699993f, 0.810599983f, -0.512399971f, 0.0957000032f, -0.853399992f,
+	-0.0808489993f, 0.458541989f, -0.0533370003f, 0.678799987f, 0.809400022f, -0.0119000003f, 0.0140000004f, -0.999800026f,
+	-0.0801410004f, 0.441682994f, -0.052827999f, 0.671400011f, 0.807399988f, -0.296900004f, -0.0500999987f, -0.953599989f,
+	-0.100731999f, 0.460245997f, -0.0582330003f, 0.682399988f, 0.800899982f, 0.00359999994f, -0.0957000032f, -0.995400012f,
+	-0.0977810025f, 0.443607986f, -0.0564800017f, 0.674799979f, 0.799899995f, 0.0551000014f, -0.102799997f, -0.993200004f,
+	-0.118674003f, 0.461636007f, -0.055695001f, 0.685299993f, 0.793099999f, -0.412200004f, -0.104800001f, -0.904999971f,
+	-0.119177997f, 0.448754996f, -0.0531210005f, 0.679700017f, 0.791100025f, -0.419200003f, -0.162100002f, -0.893299997f,
+	-0.138521999f, 0.446263999f, -0.0375909992f, 0.680800021f, 0.779799998f, -0.949000001f, 0.194399998f, -0.248300001f,
+	-0.135487005f, 0.458817005f, -0.037140999f, 0.686200023f, 0.781799972f, -0.898800015f, 0.184200004f, -0.397799999f,
+	-0.138903007f, 0.432352006f, -0.00638499996f, 0.680000007f, 0.764400005f, -0.944000006f, 0.0559f, 0.325199991f,
+	-0.139877006f, 0.450419992f, -0.0101229995f, 0.686999977f, 0.768899977f, -0.997799993f, -0.0436000004f, 0.0494999997f,
+	-0.132797003f, 0.44532001f, 0.00217200001f, 0.68720001f, 0.762000024f, -0.952499986f, 0.0659999996f, 0.297399998f,
+	-0.133738995f, 0.429096013f, 0.00329499994f, 0.680299997f, 0.759199977f, -0.985899985f, 0.1021f, 0.1329f,
+	-0.133677006f, 0.442369014f, 0.0132149998f, 0.687399983f, 0.756799996f, -0.922500014f, 0.0758000016f, -0.378600001f,
+	-0.135757998f, 0.428175002f, 0.0132879997f, 0.681299984f, 0.754700005f, -0.875800014f, 0.126000002f, -0.465900004f,
+	-0.149046004f, 0.426272988f, 0.0277190004f, 0.682500005f, 0.745800018f, -0.855000019f, 0.00410000002f, -0.518599987f,
+	-0.149182007f, 0.440342993f, 0.0274320003f, 0.68870002f, 0.747300029f, -0.837800026f, -0.00190000003f, -0.546000004f,
+	-0.158069998f, 0.423803985f, 0.0543720014f, 0.684199989f, 0.733099997f, -0.986999989f, 0.0799999982f, 0.139599994f,
+	-0.156380996f, 0.440809011f, 0.0536869988f, 0.691600025f, 0.735300004f, -0.982900023f, 0.103799999f, 0.152099997f,
+	-0.141609997f, 0.44412899f, 0.0769390017f, 0.696799994f, 0.723800004f, -0.542200029f, -0.0147000002f, 0.84009999f,
+	-0.144846007f, 0.426539004f, 0.0742050037f, 0.688600004f, 0.723100007f, -0.662299991f, 0.00540000014f, 0.749199986f,
+	-0.108142003f, 0.431836993f, 0.0859280005f, 0.696099997f, 0.707099974f, -0.527100027f, 0.00219999999f, 0.849799991f,
+	-0.106659003f, 0.445645988f, 0.0866400003f, 0.702300012f, 0.708199978f, -0.573400021f, -0.0244999994f, 0.818899989f,
+	-0.0981639996f, 0.426757008f, 0.0974140018f, 0.695800006f, 0.699800014f, -0.809499979f, -0.0798999965f, 0.581700027f,
+	-0.0969579965f, 0.441881001f, 0.102243997f, 0.703000009f, 0.699800014f, -0.827000022f, -0.110100001f, 0.551299989f,
+	-0.0844120011f, 0.438333988f, 0.118612997f, 0.704200029f, 0.690299988f, -0.645399988f, -0.160300002f, 0.746800005f,
+	-0.084735997f, 0.421454012f, 0.114726998f, 0.696399987f, 0.689599991f, -0.660700023f, -0.136099994f, 0.738200009f,
+	-0.0683870018f, 0.435943007f, 0.126516998f, 0.704900026f, 0.682099998f, -0.193700001f, -0.0988000035f, 0.976100028f,
+	-0.0680899993f, 0.419910997f, 0.124891996f, 0.697700024f, 0.680800021f, -0.221699998f, -0.102399997f, 0.969699979f,
+	-0.045113001f, 0.423355997f, 0.122359f, 0.700800002f, 0.670700014f, 0.373400003f, 0.0375000015f, 0.926900029f,
+	-0.0456399992f, 0.436545014f, 0.121546999f, 0.706700027f, 0.671700001f, 0.417499989f, 0.0791999996f, 0.905200005f,
+	-0.0248150006f, 0.426946998f, 0.107391998f, 0.70450002f, 0.659699976f, 0.530399978f, 0.1382f, 0.836399972f,
+	-0.0252870005f, 0.440750003f, 0.105768003f, 0.710699975f, 0.66049999f, 0.540700018f, 0.116499998f, 0.833100021f,
+	-0.00733500021f, 0.444207996f, 0.0948849991f, 0.71390003f, 0.65140003f, 0.170599997f, 0.260100007f, 0.950399995f,
+	-0.00571299996f, 0.432007015f, 0.098416999f, 0.708199978f, 0.6505f, 0.134200007f, 0.307599992f, 0.941999972f,
+	0.0118089998f, 0.443805993f, 0.0963049978f, 0.71390003f, 0.642700016f, -0.273999989f, 0.288300008f, 0.917500019f,
+	0.0131080002f, 0.432314992f, 0.100776002f, 0.708299994f, 0.641900003f, -0.352100015f, 0.304500014f, 0.88499999f,
+	0.0354800001f, 0.425314009f, 0.116489999f, 0.703599989f, 0.629899979f, -0.422100008f, 0.132699996f, 0.896799982f,
+	0.0371970013f, 0.438360989f, 0.115566999f, 0.709399998f, 0.628799975f, -0.485199988f, 0.0856999978f, 0.870199978f,
+	0.0562609993f, 0.419638008f, 0.123673998f, 0.699999988f, 0.620299995f, -0.152400002f, -0.0920000002f, 0.984000027f,
+	0.0575859994f, 0.433887988f, 0.126061007f, 0.706399977f, 0.618600011f, -0.156100005f, -0.149000004f, 0.976400018f,
+	0.0772470012f, 0.436437994f, 0.123553999f, 0.705799997f, 0.609499991f, 0.432900012f, -0.144099995f, 0.889800012f,
+	0.0752490014f, 0.41940999f, 0.122029997f, 0.698400021f, 0.611800015f, 0.349700004f, -0.124899998f, 0.928499997f,
+	0.0916040018f, 0.439202011f, 0.111688003f, 0.70480001f, 0.601000011f, 0.800000012f, -0.131200001f, 0.585500002f,
+	0.0907130018f, 0.42395401f, 0.109467998f, 0.698000014f, 0.602500021f, 0.763400018f, -0.105099998f, 0.637300014f,
+	0.103740998f, 0.446042001f, 0.0877799988f, 0.704100013f, 0.588500023f, 0.570800006f, 0.0645999983f, 0.818599999f,
+	0.104547001f, 0.430678993f, 0.0890000015f, 0.69749999f, 0.590900004f, 0.584399998f, 0.0947000012f, 0.805899978f,
+	0.141579002f, 0.429138005f, 0.0794960037f, 0.690500021f, 0.574899971f, 0.544399977f, 0.107600003f, 0.831900001f,
+	0.142664999f, 0.443838f, 0.0772079974f, 0.696500003f, 0.571799994f, 0.58950001f, 0.0815000013f, 0.803600013f,
+	0.154833004f, 0.441177994f, 0.0596840009f, 0.692399979f, 0.562900007f, 0.954400003f, 0.113300003f, 0.27610001f,
+	0.156051993f, 0.428909987f, 0.0617690012f, 0.687099993f, 0.565100014f, 0.93599999f, 0.152700007f, 0.317099988f,
+	0.153291002f, 0.440939009f, 0.0343540013f, 0.689800024f, 0.551699996f, 0.906700015f, 0.0577999987f, -0.417800009f,
+	0.155242994f, 0.426380992f, 0.037289001f, 0.683600008f, 0.554499984f, 0.946799994f, 0.0632999986f, -0.315400004f,
+	0.137032002f, 0.429675013f, 0.0155610004f, 0.682600021f, 0.541499972f, 0.916400015f, 0.141800001f, -0.37439999f,
+	0.134277001f, 0.440809011f, 0.0148710003f, 0.687399983f, 0.539499998f, 0.955900013f, 0.224800006f, -0.189199999f,
+	0.136389002f, 0.447099f, -0.0027079999f, 0.68720001f, 0.531000018f, 0.975000024f, 0.140900001f, 0.172000006f,
+	0.137756005f, 0.432761997f, -0.00079999998f, 0.681400001f, 0.534099996f, 0.987500012f, 0.109300002f, 0.113899998f,
+	0.141489998f, 0.44273901f, -0.0246210005f, 0.681599975f, 0.522199988f, 0.987299979f, 0.145199999f, -0.0644000024f,
+	0.139299005f, 0.456777006f, -0.0250109993f, 0.687600017f, 0.519900024f, 0.968500018f, 0.143099993f, -0.203700006f,
+	0.127858996f, 0.447733015f, -0.0500920005f, 0.680199981f, 0.509000003f, 0.663299978f, 0.145600006f, -0.734000027f,
+	0.127525002f, 0.459419996f, -0.0478690006f, 0.685599983f, 0.508300006f, 0.672399998f, 0.156900004f, -0.723399997f,
+	0.102836996f, 0.447522014f, -0.0588059984f, 0.678200006f, 0.497099996f, 0.0505999997f, 0.0454999991f, -0.997699976f,
+	0.100555003f, 0.461587995f, -0.0582799986f, 0.684400022f, 0.495200008f, 0.0419000015f, 0.0487000011f, -0.997900009f,
+	0.0798199996f, 0.441013992f, -0.0532380007f, 0.673900008f, 0.486799985f, 0.222499996f, 0.0480000004f, -0.973800004f,
+	0.0775379986f, 0.456968993f, -0.0533300005f, 0.680899978f, 0.484899998f, 0.1417f, 0.0146000003f, -0.989799976f,
+	0.0648790002f, 0.452490985f, -0.0614220016f, 0.677999973f, 0.478399992f, 0.485500008f, 0.104800001f, -0.867900014f,
+	0.0664660037f, 0.434309006f, -0.0630400032f, 0.669799984f, 0.479799986f, 0.443100005f, 0.0824000016f, -0.892700016f,
+	0.0504180007f, 0.44650501f, -0.0687839985f, 0.674300015f, 0.471500009f, 0.185399994f, 0.0406000018f, -0.98180002f,
+	0.0503560007f, 0.426591992f, -0.0689370036f, 0.665400028f, 0.472499996f, 0.122000001f, 0.0256999992f, -0.992200017f,
+	0.0409980007f, 0.444822997f, -0.0679029971f, 0.673099995f, 0.467299998f, -0.716099977f, -0.0206000004f, -0.697700024f,
+	0.0420040004f, 0.426093996f, -0.0688759983f, 0.664699972f, 0.468800008f, -0.525600016f, 0.0454999991f, -0.8495f,
+	-0.0724119991f, 0.599856973f, 0.0614750013f, 0.206699997f, 0.872200012f, 0.663100004f, -0.0736000016f, 0.744899988f,
+	-0.0652500018f, 0.646323979f, 0.0563619994f, 0.227200001f, 0.865700006f, 0.768700004f, -0.0483000018f, 0.637700021f,
+	-0.0708139986f, 0.645177007f, 0.0629820004f, 0.227200001f, 0.869700015f, 0.760800004f, -0.0483000018f, 0.647099972f,
+	-0.0771630034f, 0.604946017f, 0.0661310032f, 0.209299996f, 0.874800026f, 0.660600007f, -0.0621000007f, 0.748199999f,
+	-0.0877399966f, 0.546223998f, 0.0683559999f, 0.182999998f, 0.881600022f, 0.559499979f, -0.0694999993f, 0.825900018f,
+	-0.0912370011f, 0.552193999f, 0.0711070001f, 0.185900003f, 0.883599997f, 0.544499993f, -0.066399999f, 0.836099982f,
+	-0.00223800004f, 0.476779014f, -0.0630469993f, 0.806900024f, 0.815699995f, -0.904299974f, -0.425199986f, 0.0368000008f,
+	-0.0291000009f, 0.537340999f, -0.0565290004f, 0.806800008f, 0.78549999f, -0.893100023f, -0.331f, 0.304699987f,
+	-0.0304160006f, 0.536882997f, -0.0610169992f, 0.808899999f, 0.785600007f, -0.893599987f, -0.343100011f, 0.289400011f,
+	-0.00245700008f, 0.476913989f, -0.0686350018f, 0.809400022f, 0.815900028f, -0.904799998f, -0.425000012f, 0.0250000004f,
+	-0.0391269997f, 0.584321976f, -0.0513820015f, 0.805000007f, 0.763599992f, -0.76730001f, -0.185200006f, 0.614000022f,
+	-0.0421960019f, 0.586467981f, -0.0546020009f, 0.806800008f, 0.762399971f, -0.769500017f, -0.150600001f, 0.620700002f,
+	-0.0436110012f, 0.610997021f, -0.0522579998f, 0.805000007f, 0.751299977f, -0.698099971f, -0.0843999982f, 0.711000025f,
+	-0.0402429998f, 0.610709012f, -0.0490170009f, 0.802999973f, 0.751699984f, -0.687600017f, -0.0803000033f, 0.721599996f,
+	-0.0434949994f, 0.621722996f, -0.0510330014f, 0.80400002f, 0.746500015f, -0.664099991f, -0.0288999993f, 0.747099996f,
+	-0.0398159996f, 0.621118009f, -0.0480140001f, 0.801900029f, 0.747099996f, -0.638400018f, -0.0476999991f, 0.76819998f,
+	-0.0396240018f, 0.626533985f, -0.0475189984f, 0.801299989f, 0.744700015f, -0.766900003f, 0.0320000015f, 0.640999973f,
+	-0.040817f, 0.62666899f, -0.0491309986f, 0.802200019f, 0.744499981f, -0.77609998f, 0.0938000008f, 0.62349999f,
+	-0.0393610001f, 0.633710027f, -0.0469620004f, 0.800499976f, 0.74150002f, -0.635200024f, -0.0293000005f, 0.771799982f,
+	-0.0409459993f, 0.630240977f, -0.0484590009f, 0.801699996f, 0.742900014f, -0.496600002f, -0.1426f, 0.85619998f,
+	-0.0429270007f, 0.634203017f, -0.0498449989f, 0.80250001f, 0.74089998f, -0.629999995f, -0.0148f, 0.776499987f,
+	-0.0376890004f, 0.65713203f, -0.045607999f, 0.797699988f, 0.73119998f, -0.639599979f, 0.00120000006f, 0.768700004f,
+	-0.041294001f, 0.656803012f, -0.0486069992f, 0.799799979f, 0.731000006f, -0.638400018f, 0.00139999995f, 0.769699991f,
+	0.0412929989f, 0.656803012f, -0.0486069992f, 0.675599992f, 0.724799991f, 0.64319998f, 0.000699999975f, 0.765699983f,
+	0.0376890004f, 0.65713203f, -0.0456070006f, 0.673500001f, 0.724699974f, 0.639699996f, 0.00120000006f, 0.768599987f,
+	0.0393600017f, 0.633710027f, -0.0469629988f, 0.675899982f, 0.714299977f, 0.670000017f, -0.0218000002f, 0.7421f,
+	0.0426420011f, 0.634232998f, -0.0499260016f, 0.677900016f, 0.7148f, 0.673200011f, -0.0216000006f, 0.739099979f,
+	0.0402429998f, 0.610709012f, -0.0490170009f, 0.678300023f, 0.704100013f, 0.693599999f, -0.0680999979f, 0.717100024f,
+	0.0436110012f, 0.610997021f, -0.0522579998f, 0.680400014f, 0.70450002f, 0.698300004f, -0.0688999966f, 0.712499976f,
+	0.0391269997f, 0.584321976f, -0.0513820015f, 0.680299997f, 0.692200005f, 0.767400026f, -0.185200006f, 0.613900006f,
+	0.0421960019f, 0.586467981f, -0.0546020009f, 0.682200015f, 0.693400025f, 0.769500017f, -0.150600001f, 0.620599985f,
+	0.0291000009f, 0.537340999f, -0.0565290004f, 0.682099998f, 0.670300007f, 0.893100023f, -0.331f, 0.304699987f,
+	0.0304160006f, 0.536882997f, -0.0610169992f, 0.684199989f, 0.67019999f, 0.893599987f, -0.343100011f, 0.289400011f,
+	0.00224000006f, 0.476776987f, -0.0630469993f, 0.682299972f, 0.639999986f, 0.904399991f, -0.425199986f, 0.0364000015f,
+	0.00245700008f, 0.476913989f, -0.0686350018f, 0.684800029f, 0.639900029f, 0.904900014f, -0.425000012f, 0.0245999992f,
+	0.0648119971f, 0.646592975f, 0.0568070002f, 0.229900002f, 0.957899988f, -0.780600011f, -0.0971999988f, 0.617399991f,
+	0.0724119991f, 0.599856973f, 0.0614750013f, 0.208399996f, 0.957099974f, -0.63499999f, -0.0675999969f, 0.769599974f,
+	0.077200003f, 0.604937971f, 0.0659079999f, 0.210199997f, 0.953800023f, -0.657400012f, -0.0577999987f, 0.751399994f,
+	0.0705809966f, 0.645530999f, 0.0643249974f, 0.2289f, 0.953700006f, -0.796000004f, -0.106600001f, 0.595799983f,
+	0.0912370011f, 0.552193999f, 0.0711070001f, 0.185399994f, 0.951200008f, -0.563600004f, -0.0560999997f, 0.824100018f,
+	0.0877399966f, 0.546223998f, 0.0683559999f, 0.1831f, 0.953599989f, -0.559300005f, -0.0537f, 0.827300012f,
+	-0.0658259988f, 0.776278019f, -0.155417994f, 0.0562999994f, 0.399500012f, -0.40169999f, -0.516300023f, -0.756399989f,
+	-0.0534979999f, 0.778228998f, -0.163409993f, 0.0504000001f, 0.396299988f, -0.405299991f, -0.519800007f, -0.752099991f,
+	-0.04538f, 0.757369995f, -0.153368995f, 0.0562999994f, 0.386900008f, -0.34799999f, -0.623600006f, -0.699999988f,
+	-0.0572779998f, 0.756156981f, -0.146433994f, 0.0615999997f, 0.390199989f, -0.352699995f, -0.614400029f, -0.705799997f,
+	-0.0395490006f, 0.747482002f, -0.144651994f, 0.0599000007f, 0.381399989f, -0.295700014f, -0.730700016f, -0.6153f,
+	-0.0479359999f, 0.746528029f, -0.139336005f, 0.0637999997f, 0.383700013f, -0.299899995f, -0.737200022f, -0.605400026f,
+	-0.0184659995f, 0.571603f, -0.0193939991f, 0.708500028f, 0.0961000025f, 0.656799972f, -0.0738999993f, -0.750400007f,
+	-0.0518760011f, 0.568762004f, -0.041499f, 0.724600017f, 0.0973000005f, 0.0604000017f, -0.0427000001f, -0.997300029f,
+	-0.0493180007f, 0.60857898f, -0.0384729989f, 0.722599983f, 0.115099996f, 0.0122999996f, 0.0599000007f, -0.998099983f,
+	-0.0157249998f, 0.600582004f, -0.0244520009f, 0.707099974f, 0.110200003f, 0.474400014f, -0.400200009f, -0.784099996f,
+	-0.00169800001f, 0.606522977f, -0.00584900007f, 0.697799981f, 0.108000003f, 0.198899999f, -0.537699997f, -0.819299996f,
+	-0.00131700002f, 0.567218006f, 0.00287299999f, 0.698400021f, 0.0916000009f, 0.0755999982f, -0.151700005f, -0.985499978f,
+	-0.000127000007f, 0.538957f, 0.0068930001f, 0.698099971f, 0.0790999979f, 0.0675000027f, -0.128700003f, -0.989400029f,
+	-0.0871270001f, 0.572329998f, -0.0250909999f, 0.739799976f, 0.0996999964f, -0.770399988f, -0.0284000002f, -0.636900008f,
+	-0.0813329965f, 0.619013011f, -0.0254459996f, 0.737699986f, 0.119800001f, -0.728100002f, 0.194999993f, -0.657100022f,
+	-0.0503339991f, 0.632022023f, -0.0341689996f, 0.723500013f, 0.126100004f, -0.223800004f, 0.0408000015f, -0.973800004f,
+	-0.0221609995f, 0.621270001f, -0.0312790014f, 0.709699988f, 0.121200003f, -0.0142999999f, -0.248600006f, -0.968500018f,
+	-0.000123000005f, 0.614309013f, -0.036003001f, 0.698199987f, 0.120499998f, 0.155499995f, -0.636500001f, -0.755400002f,
+	0.00355600007f, 0.653792024f, -0.0459830016f, 0.69630003f, 0.137899995f, 0.0311999992f, -0.225799993f, -0.973699987f,
+	-0.0223590005f, 0.652611017f, -0.0442649983f, 0.709200025f, 0.136700004f, -0.174199998f, -0.222900003f, -0.959100008f,
+	-0.0501680002f, 0.662782013f, -0.0331959985f, 0.7245f, 0.140200004f, -0.520600021f, 0.0275999997f, -0.853399992f,
+	-0.0725170001f, 0.645227015f, -0.0232170001f, 0.736100018f, 0.131400004f, -0.706799984f, 0.238700002f, -0.665899992f,
+	-0.096187003f, 0.576969028f, 0.00999699999f, 0.753899992f, 0.101599999f, -0.985300004f, 0.0245999992f, 0.169f,
+	-0.090640001f, 0.620073974f, 0.00796999969f, 0.752900004f, 0.120300002f, -0.96359998f, 0.209800005f, 0.165700004f,
+	-0.0846339986f, 0.643536985f, 0.00756700011f, 0.751800001f, 0.130700007f, -0.973200023f, 0.204300001f, 0.105700001f,
+	-0.0682130009f, 0.672043979f, -0.0148510002f, 0.737999976f, 0.143900007f, -0.803799987f, 0.0833000019f, -0.588999987f,
+	-0.0448510014f, 0.709500015f, -0.0395389982f, 0.721899986f, 0.161300004f, -0.582499981f, -0.0962999985f, -0.807099998f,
+	-0.0208609998f, 0.708036005f, -0.0541249998f, 0.708100021f, 0.161799997f, -0.261500001f, -0.172700003f, -0.949599981f,
+	-0.000472000014f, 0.704602003f, -0.0532950014f, 0.698000014f, 0.160600007f, 0.0419999994f, -0.175699994f, -0.98360002f,
+	-0.0229209997f, 0.742588997f, -0.0600010008f, 0.708700001f, 0.177300006f, -0.347299993f, -0.0903000012f, -0.933399975f,
+	-0.00163399999f, 0.738743007f, -0.0617819987f, 0.698700011f, 0.176200002f, 0.0571999997f, -0.125100002f, -0.990499973f,
+	-0.0670730025f, 0.711036026f, -0.0225510001f, 0.735499978f, 0.161500007f, -0.825100005f, 0.0111999996f, -0.564899981f,
+	-0.0454780012f, 0.744147003f, -0.0433950014f, 0.721800029f, 0.176499993f, -0.659500003f, -0.0826999992f, -0.747200012f,
+	-0.0799529999f, 0.673443019f, 0.00714700017f, 0.750699997f, 0.144600004f, -0.995899975f, 0.0873000026f, 0.0220999997f,
+	-0.0231979992f, 0.769640028f, -0.0610300004f, 0.709500015f, 0.189199999f, -0.319499999f, -0.0687000006f, -0.945100009f,
+	0.000404999999f, 0.767082989f, -0.0623509996f, 0.698400021f, 0.189099997f, 0.0753000006f, -0.0315999985f, -0.996699989f,
+	0.0308260005f, 0.772997975f, -0.0562550016f, 0.683899999f, 0.192300007f, 0.453099996f, -0.0366999991f, -0.890699983f,
+	0.0300949998f, 0.740180016f, -0.0552770011f, 0.683700025f, 0.177200004f, 0.441700011f, -0.0843999982f, -0.89319998f,
+	0.0579160005f, 0.775394976f, -0.0339090005f, 0.667599976f, 0.193399996f, 0.787f, -0.119099997f, -0.605300009f,
+	0.0568219982f, 0.75169301f, -0.0294540003f, 0.666199982f, 0.1822f, 0.818899989f, -0.0683000013f, -0.569800019f,
+	0.0316939987f, 0.705295026f, -0.0516970009f, 0.682600021f, 0.161300004f, 0.353899986f, -0.0969000012f, -0.930199981f,
+	0.0665810034f, 0.778747976f, -0.0191319995f, 0.65990001f, 0.195199996f, 0.882700026f, -0.167699993f, -0.43900001f,
+	0.0634590015f, 0.754656017f, -0.0151209999f, 0.658200026f, 0.183699995f, 0.917800009f, -0.0416000001f, -0.394800007f,
+	0.0560830012f, 0.71469897f, -0.0345720015f, 0.66839999f, 0.165000007f, 0.672299981f, 0.0221999995f, -0.74000001f,
+	0.0354209989f, 0.659317017f, -0.0419190004f, 0.680400014f, 0.140100002f, 0.405200005f, -0.223900005f, -0.886399984f,
+	0.0590780005f, 0.672344983f, -0.0269050002f, 0.665700018f, 0.145300001f, 0.684599996f, 0.00240000011f, -0.728900015f,
+	0.073206f, 0.719512999f, -0.0142069999f, 0.655900002f, 0.167099997f, 0.927299976f, 0.0604999997f, -0.369399995f,
+	0.0790060014f, 0.776457012f, 0.00706200022f, 0.647099972f, 0.196199998f, 0.938199997f, -0.303499997f, -0.166600004f,
+	0.0704569966f, 0.752337992f, 0.009234f, 0.645399988f, 0.183599994f, 0.992299974f, -0.123300001f, -0.0126999998f,
+	0.0707020015f, 0.678641975f, -0.00739700021f, 0.653699994f, 0.148200005f, 0.913500011f, 0.101800002f, -0.393900007f,
+	0.0739229992f, 0.716724992f, 0.0132990004f, 0.642799973f, 0.1664f, 0.978399992f, 0.066399999f, 0.195500001f,
+	0.0641309991f, 0.630654991f, -0.0355870016f, 0.666800022f, 0.1259f, 0.345999986f, 0.185900003f, -0.91960001f,
+	0.035374999f, 0.631668985f, -0.0322760008f, 0.680400014f, 0.126699999f, 0.0414999984f, -0.158399999f, -0.986500025f,
+	0.0344440006f, 0.603091002f, -0.0344109982f, 0.679499984f, 0.113300003f, -0.390899986f, -0.0119000003f, -0.920400023f,
+	0.0816949978f, 0.638197005f, -0.0149870003f, 0.654200017f, 0.129299998f, 0.862699986f, 0.255499989f, -0.436399996f,
+	0.0650070012f, 0.60899502f, -0.0386679992f, 0.666700006f, 0.116700001f, 0.279199988f, 0.0860999972f, -0.956399977f,
+	0.0796020031f, 0.676075995f, 0.0182659999f, 0.640299976f, 0.147100002f, 0.968400002f, 0.149700001f, 0.199300006f,
+	0.0573160015f, 0.713274002f, 0.0413950011f, 0.626999974f, 0.165999994f, 0.667400002f, 0.0164999999f, 0.744499981f,
+	0.0603590012f, 0.750275016f, 0.0420019999f, 0.628199995f, 0.184100002f, 0.731299996f, -0.323300004f, 0.600499988f,
+	0.0851889998f, 0.633929014f, 0.0146580003f, 0.640299976f, 0.127700001f, 0.954599977f, 0.167300001f, 0.246299997f,
+	0.0596500002f, 0.671615005f, 0.0461370014f, 0.624499977f, 0.146300003f, 0.697099984f, 0.121200003f, 0.706700027f,
+	0.0873569995f, 0.61421603f, -0.0183390006f, 0.653699994f, 0.119000003f, 0.883099973f, 0.1479f, -0.4454f,
+	0.0309239998f, 0.571627021f, -0.0306240004f, 0.679499984f, 0.0980999991f, -0.502799988f, -0.0379999988f, -0.863499999f,
+	0.0677959993f, 0.571395993f, -0.0395979993f, 0.664099991f, 0.100500003f, 0.298700005f, -0.0366999991f, -0.953599989f,
+	0.0898239985f, 0.573632002f, -0.0167980008f, 0.651600003f, 0.101899996f, 0.917699993f, -0.0223999992f, -0.396600008f,
+	0.0298529994f, 0.529815972f, -0.0281840004f, 0.677299976f, 0.0800999999f, -0.497399986f, -0.111400001f, -0.860400021f,
+	0.0669199973f, 0.529998004f, -0.0345779993f, 0.66170001f, 0.0829000026f, 0.343899995f, -0.183699995f, -0.920899987f,
+	0.0873880014f, 0.528995991f, -0.0104430001f, 0.648899972f, 0.0826999992f, 0.925599992f, -0.199000001f, -0.32190001f,
+	0.0909539983f, 0.573216975f, 0.0272339992f, 0.633300006f, 0.101300001f, 0.919700027f, 0.0500999987f, 0.389400005f,
+	0.0899010003f, 0.610440016f, 0.0161700007f, 0.638599992f, 0.117299996f, 0.954599977f, 0.126800001f, 0.269400001f,
+	0.0863759965f, 0.52859199f, 0.0289769992f, 0.632499993f, 0.0815000013f, 0.91140002f, -0.164299995f, 0.377200007f,
+	0.0647929981f, 0.568852007f, 0.0542909987f, 0.617900014f, 0.0988999978f, 0.417100012f, 0.0524000004f, 0.907299995f,
+	0.0767960027f, 0.495687008f, -0.00713199982f, 0.649299979f, 0.0676999986f, 0.897000015f, -0.278600007f, -0.343100011f,
+	0.0615609996f, 0.49347201f, -0.0262809992f, 0.66049999f, 0.0670000017f, 0.353500009f, -0.265799999f, -0.896899998f,
+	0.0286580008f, 0.49267301f, -0.0204220004f, 0.675000012f, 0.0637999997f, -0.468100011f, -0.167600006f, -0.867699981f,
+	0.000887000002f, 0.494726002f, 0.00517700007f, 0.691200018f, 0.059700001f, -0.942799985f, -0.119000003f, -0.311500013f,
+	0.0573059991f, 0.457379013f, -0.0193290003f, 0.659300029f, 0.0513999984f, 0.384600013f, -0.305700004f, -0.870999992f,
+	0.0273930002f, 0.45748499f, -0.00977000035f, 0.672900021f, 0.0476000011f, -0.527899981f, -0.214699998f, -0.821699977f,
+	0.0678720027f, 0.453682005f, 0.00338399992f, 0.648100019f, 0.0483999997f, 0.908999979f, -0.224199995f, -0.351399988f,
+	0.0786980018f, 0.493023992f, 0.0252379999f, 0.634599984f, 0.065200001f, 0.952899992f, -0.155499995f, 0.260500014f,
+	0.0724970028f, 0.453155011f, 0.0296769999f, 0.63499999f, 0.0465000011f, 0.993300021f, 0.0516000018f, 0.103799999f,
+	0.0683770031f, 0.431044012f, 0.0141789997f, 0.646300018f, 0.0375999995f, 0.881600022f, -0.121699996f, -0.456099987f,
+	0.0536429994f, 0.432572007f, -0.00896899961f, 0.658500016f, 0.0399999991f, 0.363700002f, -0.397399992f, -0.842499971f,
+	0.0225949995f, 0.434827f, -0.00343200006f, 0.672500014f, 0.0372000001f, -0.584800005f, -0.1928f, -0.787899971f,
+	0.00891099963f, 0.457771003f, 0.00908300001f, 0.684199989f, 0.0438000001f, -0.871200025f, -0.228599995f, -0.434500009f,
+	0.00626600021f, 0.436453015f, 0.0257680006f, 0.686699986f, 0.0320000015f, -0.941100001f, 0.107799999f, -0.320600003f,
+	0.000296999991f, 0.42167601f, 0.0304220002f, 0.686999977f, 0.0248000007f, 0.0189999994f, 0.4296f, -0.902800024f,
+	0.0209960006f, 0.419544995f, 0.00386899989f, 0.672299981f, 0.0296999998f, -0.523800015f, -0.287999988f, -0.801699996f,
+	0.0515009984f, 0.415033013f, -0.00110500003f, 0.658100009f, 0.0313000008f, 0.31310001f, -0.391799986f, -0.865100026f,
+	0.0792369992f, 0.432285994f, 0.0400790013f, 0.634199977f, 0.0353000015f, 0.97329998f, 0.228499994f, 0.0197999999f,
+	0.0702600032f, 0.414604008f, 0.0206780005f, 0.645600021f, 0.0294000003f, 0.835099995f, -0.2227f, -0.503000021f,
+	0.0604409985f, 0.456880987f, 0.0495159999f, 0.622600019f, 0.0469999984f, 0.627799988f, 0.310099989f, 0.71390003f,
+	0.0638689995f, 0.437611014f, 0.0648519993f, 0.621800005f, 0.0351000018f, 0.572000027f, 0.419099987f, 0.7051f,
+	0.0815040022f, 0.417138994f, 0.0470429994f, 0.633700013f, 0.0277999993f, 0.9921f, -0.0189999994f, 0.123899996f,
+	0.0681279972f, 0.396234006f, 0.0295609999f, 0.64410001f, 0.0197999999f, 0.847100019f, -0.295599997f, -0.441599995f,
+	0.0772010013f, 0.397718996f, 0.0538830012f, 0.632200003f, 0.0185000002f, 0.956900001f, -0.106299996f, 0.270200014f,
+	0.050898999f, 0.395985007f, 0.00704499986f, 0.656799972f, 0.0217000004f, 0.393900007f, -0.354900002f, -0.847800016f,
+	0.0200510006f, 0.399949998f, 0.0101330001f, 0.671000004f, 0.0203000009f, -0.468199998f, -0.155300006f, -0.869799972f,
+	-0.001361f, 0.401174992f, 0.0247009993f, 0.682299972f, 0.0164000001f, 0.185800001f, 0.182600006f, -0.965499997f,
+	0.0590739995f, 0.401044011f, 0.0742319971f, 0.619599998f, 0.0178999994f, 0.481299996f, 0.0697000027f, 0.87379998f,
+	0.0624269992f, 0.421651006f, 0.0711229965f, 0.620899975f, 0.0273000002f, 0.531799972f, 0.146400005f, 0.834100008f,
+	0.0257270001f, 0.442068994f, 0.0735519975f, 0.605300009f, 0.0362000018f, -0.349000007f, 0.413300008f, 0.841000021f,
+	0.0271259993f, 0.462253988f, 0.0588830002f, 0.605000019f, 0.0480999984f, -0.335000008f, 0.362500012f, 0.869700015f,
+	0.00713500008f, 0.461908996f, 0.0286030006f, 0.587599993f, 0.0494999997f, -0.978100002f, 0.0750999972f, 0.194000006f,
+	0.0244239997f, 0.506401002f, 0.0549350008f, 0.602199972f, 0.0689999983f, -0.403299987f, -0.0978000015f, 0.909799993f,
+	0.00502099982f, 0.502780974f, 0.0304329991f, 0.587400019f, 0.0672999993f, -0.915499985f, -0.120200001f, 0.383899987f,
+	-0.00070199999f, 0.53320998f, 0.0326879993f, 0.585699975f, 0.0815000013f, 0.0171000008f, -0.2377f, 0.971199989f,
+	0.0263640005f, 0.529744029f, 0.059014f, 0.602500021f, 0.0802000016f, -0.279799998f, -0.0250000004f, 0.959699988f,
+	0.0601040013f, 0.499440998f, 0.0515929982f, 0.619300008f, 0.0666999966f, 0.479600012f, -0.0759000033f, 0.874199986f,
+	0.0655699968f, 0.527791977f, 0.0507149994f, 0.619899988f, 0.0799999982f, 0.504700005f, -0.0734999999f, 0.860199988f,
+	0.0266430005f, 0.569954991f, 0.0571030006f, 0.601899981f, 0.0989999995f, -0.2949f, 0.0844999999f, 0.951799989f,
+	0.000398000004f, 0.570064008f, 0.0352640003f, 0.587100029f, 0.0987000018f, 0.00240000011f, 0.0790000036f, 0.996900022f,
+	0.0268200003f, 0.606347978f, 0.0507480018f, 0.601899981f, 0.116700001f, -0.330300003f, -0.249899998f, 0.9102f,
+	0.000530000019f, 0.609044015f, 0.0264320001f, 0.584500015f, 0.116499998f, -0.0119000003f, -0.263799995f, 0.96450001f,
+	0.0650459975f, 0.603070974f, 0.0478349999f, 0.620100021f, 0.114600003f, 0.534200013f, 0.0439000018f, 0.844200015f,
+	0.0651139989f, 0.626420975f, 0.0459140018f, 0.623099983f, 0.125200003f, 0.69660002f, 0.0744000003f, 0.71359998f,
+	0.0334669985f, 0.628993988f, 0.0659290031f, 0.606999993f, 0.1285f, 0.0750999972f, -0.243900001f, 0.966899991f,
+	0.00165700004f, 0.632471025f, 0.0552170016f, 0.592499971f, 0.130899996f, -0.0773999989f, -0.4542f, 0.887600005f,
+	0.0300489999f, 0.674404025f, 0.0688999966f, 0.60860002f, 0.148300007f, 0.217099994f, 0.103799999f, 0.970600009f,
+	0.00271699997f, 0.677691996f, 0.0621649995f, 0.59740001f, 0.150700003f, -0.0984999985f, 0.0184000004f, 0.995000005f,
+	0.0287360009f, 0.717173994f, 0.0533739999f, 0.611899972f, 0.167999998f, 0.301099986f, 0.00789999962f, 0.953499973f,
+	0.000755999994f, 0.718659997f, 0.0593420006f, 0.59799999f, 0.167500004f, -0.0172000006f, 0.00139999995f, 0.999899983f,
+	0.0291700009f, 0.751354992f, 0.0643569976f, 0.609600008f, 0.182999998f, 0.271400005f, -0.270500004f, 0.923699975f,
+	-0.001039f, 0.753270984f, 0.0628369972f, 0.594900012f, 0.180700004f, -0.00630000001f, -0.280800015f, 0.959699988f,
+	0.0201299991f, 0.774271011f, 0.0758330002f, 0.601700008f, 0.191200003f, 0.0399999991f, -0.479600012f, 0.876600027f,
+	-0.0020359999f, 0.776104987f, 0.0717379972f, 0.592299998f, 0.189999998f, -0.0138999997f, -0.395300001f, 0.91839999f,
+	0.0744619966f, 0.772747993f, 0.0536720008f, 0.62620002f, 0.198100001f, 0.633599997f, -0.589100003f, 0.501399994f,
+	0.0913029984f, 0.552725017f, -0.0602609999f, 0.185699999f, 0.974600017f, -0.557299972f, -0.0496999994f, -0.828800023f,
+	0.0877119973f, 0.54617101f, -0.0574770011f, 0.1831f, 0.972100019f, -0.555100024f, -0.0485999994f, -0.83039999f,
+	0.0721189976f, 0.604258001f, -0.0504520014f, 0.210299999f, 0.968900025f, -0.63349998f, 0.0423999988f, -0.772599995f,
+	0.077234f, 0.607232988f, -0.0545019992f, 0.211199999f, 0.972100019f, -0.64289999f, 0.072800003f, -0.762499988f,
+	0.0730580017f, 0.612690985f, -0.0489440002f, 0.214200005f, 0.969399989f, -0.657199979f, -0.0463000014f, -0.752300024f,
+	0.0755650029f, 0.613143027f, -0.0511440001f, 0.214200005f, 0.971000016f, -0.655399978f, -0.0265999995f, -0.754899979f,
+	0.0694549978f, 0.620526016f, -0.0490490012f, 0.218099996f, 0.968900025f, -0.62559998f, -0.132799998f, -0.76880002f,
+	0.0749540031f, 0.621002972f, -0.0535969995f, 0.217700005f, 0.972100019f, -0.635800004f, -0.153600007f, -0.756399989f,
+	0.0649449974f, 0.646874011f, -0.0458590016f, 0.230299994f, 0.968400002f, -0.733799994f, -0.0820999965f, -0.674399972f,
+	0.0705809966f, 0.645530999f, -0.0522379987f, 0.229000002f, 0.972100019f, -0.755999982f, -0.0988999978f, -0.647099972f,
+	0.0420040004f, 0.426093996f, -0.0688759983f, 0.90990001f, 0.798399985f, -0.525600016f, 0.0454999991f, -0.8495f,
+	0.0388769992f, 0.427435011f, -0.061590001f, 0.910700023f, 0.794799984f, -0.946799994f, -0.0243999995f, -0.32100001f,
+	0.0405509993f, 0.445546001f, -0.0639059991f, 0.918900013f, 0.796500027f, -0.808000028f, -0.00700000022f, -0.58920002f,
+	0.0409980007f, 0.444822997f, -0.0679029971f, 0.918500006f, 0.798300028f, -0.716099977f, -0.0206000004f, -0.697700024f,
+	0.0363470018f, 0.445246994f, -0.057204999f, 0.91900003f, 0.792999983f, -0.868499994f, -0.0177999996f, -0.495400012f,
+	0.0379379988f, 0.427051991f, -0.0553469993f, 0.910700023f, 0.791999996f, -0.982800007f, -0.101599999f, -0.154100001f,
+	0.223184004f, -0.00318800006f, 0.257620007f, 0.994099975f, 0.627600014f, -0.00190000003f, 0.444099993f, 0.896000028f,
+	0.199790001f, 0.0219509993f, 0.245174006f, 0.983500004f, 0.640299976f, -0.00209999993f, 0.442200005f, 0.896899998f,
+	-0.209052995f, 0.0200500004f, 0.245176002f, 0.798300028f, 0.639500022f, -0.000199999995f, 0.469599992f, 0.8829f,
+	-0.223767996f, -0.00288300007f, 0.257400006f, 0.791599989f, 0.627699971f, -9.99999975e-05f, 0.470400006f, 0.882399976f,
+	-0.0877119973f, 0.54617101f, -0.0574770011f, 0.1831f, 0.945800006f, 0.554700017f, -0.0670000017f, -0.829400003f,
+	-0.0913029984f, 0.552725017f, -0.0602609999f, 0.185699999f, 0.943300009f, 0.536800027f, -0.0632999986f, -0.841300011f,
+	-0.0753140002f, 0.614712f, -0.0547219999f, 0.214699998f, 0.94599998f, 0.691600025f, -0.064199999f, -0.719399989f,
+	-0.0711819977f, 0.608129978f, -0.0501159988f, 0.212099999f, 0.949199975f, 0.686500013f, -0.0798999965f, -0.7227f,
+	-0.0705730021f, 0.645546973f, -0.0523019992f, 0.228799999f, 0.946200013f, 0.752099991f, -0.0505999997f, -0.657100022f,
+	-0.0649449974f, 0.646874011f, -0.0458590016f, 0.230000004f, 0.949999988f, 0.757300019f, -0.0504000001f, -0.65109998f,
+	-0.0373170003f, 0.75750798f, -0.161235005f, 0.0465000011f, 0.396499991f, -0.116499998f, -0.614199996f, -0.780499995f,
+	-0.0428010002f, 0.756017983f, -0.159055993f, 0.0493000001f, 0.396299988f, -0.134599999f, -0.626900017f, -0.767400026f,
+	-0.0500649996f, 0.778689027f, -0.169309005f, 0.0489000008f, 0.408100009f, -0.291399986f, -0.488799989f, -0.822300017f,
+	-0.0441909991f, 0.778945982f, -0.171664998f, 0.0461000018f, 0.407700002f, -0.304899991f, -0.493900001f, -0.814300001f,
+	-0.0355889983f, 0.743319988f, -0.145091996f, 0.0494999997f, 0.387199998f, 0.2236f, -0.720099986f, -0.656899989f,
+	-0.0281370003f, 0.744817019f, -0.143636003f, 0.0461999997f, 0.385899991f, 0.269800007f, -0.708800018f, -0.651799977f,
+	-0.138400003f, 0.765085995f, -0.100088999f, 0.152400002f, 0.352699995f, 0.333400011f, 0.336600006f, 0.880599976f,
+	-0.177111f, 0.759482026f, -0.0820610002f, 0.137799993f, 0.36559999f, 0.363599986f, 0.31189999f, 0.877799988f,
+	-0.159986004f, 0.736553013f, -0.0810090005f, 0.134000003f, 0.353199989f, 0.310200006f, 0.412299991f, 0.856599987f,
+	-0.133027002f, 0.741025984f, -0.0922100022f, 0.143999994f, 0.344399989f, 0.259200007f, 0.478899986f, 0.838699996f,
+	-0.116314001f, 0.706090987f, -0.0713239983f, 0.131600007f, 0.328900009f, 0.176400006f, 0.561200023f, 0.808600008f,
+	-0.110676996f, 0.717585027f, -0.080072999f, 0.138500005f, 0.329699993f, 0.152500004f, 0.550100029f, 0.82099998f,
+	-0.105792999f, 0.715171993f, -0.0795049965f, 0.138699993f, 0.327300012f, 0.172000006f, 0.541800022f, 0.822700024f,
+	0.0847690031f, 0.654980004f, -0.0479970016f, 0.196999997f, 0.852400005f, -0.4648f, 0.573000014f, -0.675000012f,
+	0.0705809966f, 0.645530999f, -0.0522379987f, 0.194299996f, 0.845000029f, -0.374000013f, 0.783999979f, -0.495499998f,
+	0.0649449974f, 0.646874011f, -0.0458590016f, 0.197400004f, 0.842700005f, -0.369199991f, 0.763000011f, -0.530700028f,
+	0.0787660033f, 0.656632006f, -0.0426310003f, 0.199900001f, 0.850099981f, -0.426299989f, 0.618600011f, -0.660000026f,
+	0.0890019983f, 0.660327971f, -0.0477170013f, 0.198200002f, 0.855300009f, -0.544499993f, 0.42750001f, -0.721599996f,
+	0.0831440017f, 0.661745012f, -0.0423649997f, 0.201000005f, 0.852900028f, -0.576699972f, 0.223900005f, -0.785700023f,
+	0.0876659974f, 0.662384987f, -0.0456979983f, 0.199699998f, 0.855099976f, -0.581399977f, 0.171800002f, -0.795300007f,
+	0.0825809985f, 0.669468999f, -0.0436829999f, 0.203700006f, 0.855300009f, -0.504299998f, -0.477299988f, -0.719699979f,
+	0.0857859999f, 0.667083979f, -0.0448280014f, 0.201900005f, 0.855700016f, -0.439900011f, -0.167500004f, -0.882300019f,
+	0.0887669995f, 0.669040024f, -0.0485399999f, 0.201499999f, 0.85799998f, -0.529299974f, -0.575500011f, -0.623399973f,
+	0.0818509981f, 0.678415f, -0.0524890013f, 0.206599995f, 0.860199988f, -0.370799989f, -0.698000014f, -0.612699986f,
+	0.0758949965f, 0.676123023f, -0.0466930009f, 0.208000004f, 0.856599987f, -0.334600002f, -0.706799984f, -0.623300016f,
+	0.0630249977f, 0.685624003f, -0.0519189984f, 0.215499997f, 0.858099997f, -0.305299997f, -0.750999987f, -0.585600019f,
+	0.0693359971f, 0.687550008f, -0.0577960014f, 0.213799998f, 0.861800015f, -0.307099998f, -0.756299973f, -0.577600002f,
+	0.0818509981f, 0.678415f, 0.0645750016f, 0.0930000022f, 0.940999985f, -0.419200003f, -0.721099973f, 0.551699996f,
+	0.0693359971f, 0.687550008f, 0.069881998f, 0.100199997f, 0.939100027f, -0.346300006f, -0.778500021f, 0.523400009f,
+	0.0628750026f, 0.685477018f, 0.0625239983f, 0.101899996f, 0.943300009f, -0.345499992f, -0.774600029f, 0.529699981f,
+	0.0758899972f, 0.676113009f, 0.0575320013f, 0.0944999978f, 0.945100009f, -0.3847f, -0.730400026f, 0.564300001f,
+	0.0827199966f, 0.669184029f, 0.0544009991f, 0.0901999995f, 0.94660002f, -0.585399985f, -0.363599986f, 0.724699974f,
+	0.0887669995f, 0.669040024f, 0.0606260002f, 0.0878999978f, 0.943400025f, -0.650399983f, -0.436199993f, 0.621800005f,
+	0.0890299976f, 0.662652016f, 0.0588660017f, 0.0857999995f, 0.9454f, -0.62349999f, 0.0825999975f, 0.777499974f,
+	0.0788519979f, 0.656621993f, 0.0535719991f, 0.0857999995f, 0.951300025f, -0.492000014f, 0.547699988f, 0.676699996f,
+	0.0847690031f, 0.654980004f, 0.0600830019f, 0.0829999968f, 0.948400021f, -0.526499987f, 0.595899999f, 0.606400013f,
+	0.0648119971f, 0.646592975f, 0.0568070002f, 0.0819000006f, 0.958199978f, -0.406699985f, 0.78579998f, 0.465999991f,
+	0.0705809966f, 0.645530999f, 0.0643249974f, 0.0789000019f, 0.955200016f, -0.409000009f, 0.806100011f, 0.427700013f,
+	-0.0705730021f, 0.645546973f, -0.0523019992f, 0.203299999f, 0.918600023f, 0.377099991f, 0.751299977f, -0.541700006f,
+	-0.0848039985f, 0.654802024f, -0.0475069992f, 0.206900001f, 0.911499977f, 0.43599999f, 0.559700012f, -0.704699993f,
+	-0.0787649974f, 0.656632006f, -0.0426310003f, 0.209399998f, 0.914099991f, 0.382600009f, 0.638100028f, -0.668200016f,
+	-0.0649449974f, 0.646874011f, -0.0458590016f, 0.206200004f, 0.921199977f, 0.411300004f, 0.752600014f, -0.514299989f,
+	-0.0890000015f, 0.660336971f, -0.0477479994f, 0.208399996f, 0.908800006f, 0.655099988f, 0.124899998f, -0.745199978f,
+	-0.083145f, 0.661745012f, -0.0423649997f, 0.210899994f, 0.911499977f, 0.615100026f, 0.164900005f, -0.771000028f,
+	-0.0887719989f, 0.668790996f, -0.0488840006f, 0.211500004f, 0.906400025f, 0.605199993f, -0.385600001f, -0.696500003f,
+	-0.0825809985f, 0.669468999f, -0.0436829999f, 0.213799998f, 0.909300029f, 0.587800026f, -0.502300024f, -0.63410002f,
+	-0.0818509981f, 0.678415f, -0.0524890013f, 0.216800004f, 0.904500008f, 0.375400007f, -0.662800014f, -0.647899985f,
+	-0.0758949965f, 0.676123023f, -0.0466930009f, 0.218099996f, 0.908200026f, 0.377700001f, -0.6972f, -0.609300017f,
+	-0.0693359971f, 0.687550008f, -0.0577960014f, 0.224000007f, 0.903100014f, 0.308800012f, -0.748000026f, -0.587499976f,
+	-0.0630260035f, 0.685624003f, -0.0519189984f, 0.225600004f, 0.906799972f, 0.315299988f, -0.748199999f, -0.583800018f,
+	0.147829995f, 0.700215995f, -0.0717329979f, 0.121100001f, 0.491600007f, -0.351700008f, 0.545000017f, 0.761099994f,
+	0.134247005f, 0.702570975f, -0.0795459971f, 0.127700001f, 0.494599998f, -0.323199987f, 0.590200007f, 0.739799976f,
+	0.115130998f, 0.684985995f, -0.0690559968f, 0.126399994f, 0.507200003f, -0.227799997f, 0.620999992f, 0.75f,
+	0.124585003f, 0.679482996f, -0.0622919984f, 0.1206f, 0.506399989f, -0.211999997f, 0.591799974f, 0.777700007f,
+	0.140945002f, 0.736383021f, -0.0963710025f, 0.137799993f, 0.480399996f, -0.447100013f, 0.443899989f, 0.776600003f,
+	0.171208993f, 0.742564976f, -0.0815870017f, 0.126399994f, 0.469900012f, -0.46540001f, 0.436100006f, 0.770200014f,
+	-0.125765994f, 0.790003002f, -0.0804549977f, 0.143299997f, 0.258700013f, -0.452499986f, -0.0392999984f, 0.890900016f,
+	-0.130175993f, 0.793534994f, -0.0883020014f, 0.1391f, 0.258399993f, -0.835900009f, 0.136999995f, 0.531499982f,
+	-0.138400003f, 0.765085995f, -0.100088999f, 0.1391f, 0.243799999f, -0.913200021f, 0.0247000009f, 0.406699985f,
+	-0.132567003f, 0.763602972f, -0.0863450021f, 0.145300001f, 0.246299997f, -0.760999978f, -0.00109999999f, 0.648800015f,
+	-0.114522003f, 0.813552022f, -0.075914003f, 0.143000007f, 0.270599991f, -0.551999986f, 0.0441999994f, 0.832700014f,
+	-0.133027002f, 0.741025984f, -0.0922100022f, 0.148399994f, 0.236300007f, -0.79460001f, -0.206499994f, 0.570900023f,
+	-0.125753999f, 0.742080986f, -0.0829700008f, 0.152899995f, 0.239199996f, -0.629499972f, -0.172000006f, 0.757700026f,
+	-0.0947090015f, 0.801467001f, -0.0636940002f, 0.155000001f, 0.270799994f, -0.474400014f, -0.0513000004f, 0.878799975f,
+	-0.0770189986f, 0.784072995f, -0.0568160005f, 0.166299999f, 0.267800003f, -0.42930001f, -0.0812999979f, 0.899500012f,
+	-0.110676996f, 0.717585027f, -0.080072999f, 0.163699999f, 0.231999993f, -0.557900012f, -0.454100013f, 0.694700003f,
+	-0.105659001f, 0.722764015f, -0.0728309974f, 0.165800005f, 0.236300007f, -0.404000014f, -0.344199985f, 0.847500026f,
+	-0.0670190006f, 0.759006023f, -0.0547580011f, 0.175799996f, 0.2597f, -0.399199992f, -0.0734999999f, 0.913900018f,
+	-0.105792999f, 0.715171993f, -0.0795049965f, 0.1664f, 0.231800005f, -0.325800002f, -0.620999992f, 0.712899983f,
+	-0.0977440029f, 0.717225015f, -0.0748889968f, 0.169699997f, 0.234799996f, -0.172399998f, -0.550000012f, 0.817200005f,
+	-0.0716790035f, 0.739894986f, -0.0585899986f, 0.177599996f, 0.250400007f, -0.320499986f, -0.142800003f, 0.936399996f,
+	0.223184004f, -0.00318800006f, 0.257620007f, 0.763000011f, 0.67049998f, 0.894999981f, 0.44600001f, 0.00159999996f,
+	0.223670006f, -0.00413999986f, -0.256065011f, 0.995700002f, 0.670599997f, 0.907700002f, 0.41960001f, 9.99999975e-05f,
+	0.212422997f, 0.0201890003f, -0.233620003f, 0.985499978f, 0.682699978f, 0.907400012f, 0.42019999f, 9.99999975e-05f,
+	0.211237997f, 0.0207550004f, 0.236884996f, 0.772400022f, 0.682699978f, 0.894200027f, 0.447600007f, 0.00170000002f,
+	-0.0534979999f, 0.778228998f, -0.163409993f, 0.0892999992f, 0.400900006f, -0.76849997f, -0.457800001f, -0.446999997f,
+	-0.0500649996f, 0.778689027f, -0.169309005f, 0.0864000022f, 0.402099997f, -0.753400028f, -0.455799997f, -0.474000007f,
+	-0.0428010002f, 0.756017983f, -0.159055993f, 0.0848999992f, 0.390399992f, -0.801599979f, -0.536300004f, -0.264099985f,
+	-0.04538f, 0.757369995f, -0.153368995f, 0.0877000019f, 0.389899999f, -0.801999986f, -0.550100029f, -0.232899994f,
+	-0.0355889983f, 0.743319988f, -0.145091996f, 0.0863000005f, 0.381399989f, -0.717199981f, -0.658399999f, -0.228300005f,
+	-0.0395490006f, 0.747482002f, -0.144651994f, 0.0879999995f, 0.383399993f, -0.72390002f, -0.652700007f, -0.223399997f,
+	0.206838995f, 0.0220599994f, -0.241019994f, 0.987399995f, 0.604600012f, 0.3134f, 0.615700006f, -0.722899973f,
+	0.212422997f, 0.0201890003f, -0.233620003f, 0.991299987f, 0.602900028f, 0.681999981f, 0.640699983f, -0.352699995f,
+	0.223670006f, -0.00413999986f, -0.256065011f, 0.995000005f, 0.618300021f, 0.148900002f, 0.562600017f, -0.813199997f,
+	-0.221653f, -0.00337100006f, -0.255636007f, 0.793299973f, 0.617900014f, 0.00200000009f, 0.47240001f, -0.881399989f,
+	-0.203950003f, 0.0205710009f, -0.242827997f, 0.801299989f, 0.605599999f, 0.00219999999f, 0.470400006f, -0.882399976f,
+	-0.0758860037f, 0.258029997f, -0.0172070004f, 0.469300002f, 0.988200009f, -0.807200015f, 0.431600004f, -0.40259999f,
+	-0.0741650015f, 0.265332997f, -0.0124639999f, 0.469999999f, 0.984300017f, -0.804799974f, 0.444799989f, -0.39289999f,
+	-0.0648109987f, 0.267630994f, -0.0266449992f, 0.477200001f, 0.987200022f, -0.772199988f, 0.461699992f, -0.436500013f,
+	-0.0635119975f, 0.262080014f, -0.0347959995f, 0.478799999f, 0.991400003f, -0.772199988f, 0.460999995f, -0.437099993f,
+	-0.0847709998f, 0.253535986f, 0.00132200005f, 0.460399985f, 0.984799981f, -0.937900007f, 0.332500011f, -0.0988999978f,
+	-0.0820799991f, 0.261382014f, 0.00104799995f, 0.463f, 0.981999993f, -0.939800024f, 0.339700013f, -0.0377000012f,
+	-0.0776769966f, 0.263550997f, 0.0169949997f, 0.458299994f, 0.976000011f, -0.926699996f, 0.369399995f, 0.0691f,
+	-0.0776569992f, 0.266362995f, 0.0100830002f, 0.461499989f, 0.977100015f, -0.915499985f, 0.367799997f, 0.163100004f,
+	-0.0742039979f, 0.280286014f, 0.0241369996f, 0.460700005f, 0.967999995f, -0.880299985f, 0.328700006f, -0.342099994f,
+	-0.0708649978f, 0.28165701f, 0.0168609992f, 0.464100003f, 0.969399989f, -0.91109997f, 0.340999991f, -0.231700003f,
+	0.0132680004f, 0.988570988f, 0.148247004f, 0.657100022f, 0.989600003f, 0.912899971f, -0.0826999992f, 0.399800003f,
+	0.0134159997f, 0.986492991f, 0.143696994f, 0.656799972f, 0.987399995f, 0.987699986f, -0.127499998f, 0.0904000029f,
+	0.0178740006f, 1.01139796f, 0.135424003f, 0.66900003f, 0.987299979f, 0.990199983f, -0.130799994f, 0.0483999997f,
+	0.0887669995f, 0.669040024f, -0.0485399999f, 0.100199997f, 0.973800004f, 0.499799997f, -0.831399977f, -0.242599994f,
+	0.0947220027f, 0.674024999f, -0.0453360006f, 0.103699997f, 0.975300014f, 0.680499971f, -0.432799995f, -0.591300011f,
+	0.0940970033f, 0.670837998f, -0.043722f, 0.102499999f, 0.976300001f, 0.643100023f, -0.586300015f, -0.492599994f,
+	0.0857859999f, 0.667083979f, -0.0448280014f, 0.0983999968f, 0.975199997f, 0.422600001f, -0.896499991f, -0.133000001f,
+	-0.064937003f, 0.751510978f, -0.145539999f, 0.181899995f, 0.393000007f, -0.754800022f, -0.60769999f, -0.246800005f,
+	-0.0537620001f, 0.735822976f, -0.135330006f, 0.179499999f, 0.40259999f, -0.728699982f, -0.653100014f, -0.206f,
+	-0.0602920018f, 0.741832972f, -0.131288007f, 0.176599994f, 0.399199992f, -0.730400026f, -0.65170002f, -0.204400003f,
+	-0.0700509995f, 0.75563401f, -0.139985994f, 0.1787f, 0.390799999f, -0.765299976f, -0.577199996f, -0.284999996f,
+	-0.0774519965f, 0.775426984f, -0.154413f, 0.183400005f, 0.380299985f, -0.757399976f, -0.545099974f, -0.359400004f,
+	-0.0801410004f, 0.773739994f, -0.146456003f, 0.1796f, 0.381000012f, -0.749100029f, -0.549600005f, -0.369800001f,
+	-0.0322909988f, 0.228327006f, -0.139723003f, 0.866699994f, 0.256300002f, -0.52670002f, -0.262800008f, 0.808399975f,
+	-0.042555999f, 0.227514997f, -0.147214994f, 0.864099979f, 0.251100004f, -0.553300023f, -0.271200001f, 0.787599981f,
+	0.000497000001f, 0.141154006f, -0.146702006f, 0.907400012f, 0.244299993f, -0.251199991f, -0.170699999f, 0.952799976f,
+	3.50000009e-05f, 0.168503001f, -0.143225998f, 0.897199988f, 0.251599997f, -0.128800005f, -0.127200007f, 0.983500004f,
+	-0.209052995f, 0.0200500004f, 0.245176002f, 0.76700002f, 0.648899972f, -0.845099986f, 0.534600019f, -0.0037f,
+	-0.211151004f, 0.0214380007f, -0.236570001f, 0.985499978f, 0.648999989f, -0.922299981f, 0.386500001f, 0.00510000018f,
+	-0.221653f, -0.00337100006f, -0.255636007f, 0.994199991f, 0.661199987f, -0.918500006f, 0.395399988f, 0.0046000001f,
+	-0.223767996f, -0.00288300007f, 0.257400006f, 0.761399984f, 0.661300004f, -0.842599988f, 0.538500011f, -0.00400000019f,
+	-0.00204699999f, 0.41207999f, -0.00683500012f, 0.432399988f, 0.78579998f, 0.916899979f, 0.398000002f, -0.0308999997f,
+	-0.000762999989f, 0.41109401f, 0.0037130001f, 0.4296f, 0.781799972f, 0.988399982f, 0.104199998f, -0.110600002f,
+	0.000730000029f, 0.39785701f, 0.0160709992f, 0.430299997f, 0.773400009f, 0.835699975f, 0.506200016f, 0.213f,
+	0.00671900017f, 0.394652992f, 0.00701300008f, 0.435099989f, 0.775200009f, 0.748099983f, 0.600600004f, 0.282200009f,
+	-0.0169220008f, 0.439929992f, -0.0283439998f, 0.430099994f, 0.803200006f, 0.902700007f, 0.423500001f, -0.0759000033f,
+	-0.0172479991f, 0.441532999f, -0.0232679993f, 0.4278f, 0.802100003f, 0.90259999f, 0.423799992f, -0.0753000006f,
+	0.00204699999f, 0.41207999f, -0.00683500012f, 0.434700012f, 0.533200026f, -0.916899979f, 0.398000002f, -0.0308999997f,
+	-0.00671900017f, 0.394652992f, 0.00701300008f, 0.431800008f, 0.54369998f, -0.748099983f, 0.600600004f, 0.282200009f,
+	-0.000730000029f, 0.39785701f, 0.0160709992f, 0.4366f, 0.54549998f, -0.835699975f, 0.506200016f, 0.213f,
+	0.000762999989f, 0.41109401f, 0.0037130001f, 0.437400013f, 0.537299991f, -0.988399982f, 0.104199998f, -0.110600002f,
+	0.0172479991f, 0.441532999f, -0.0232679993f, 0.440800011f, 0.5176f, -0.90259999f, 0.423799992f, -0.0753000006f,
+	0.0169220008f, 0.439929992f, -0.0283439998f, 0.438699991f, 0.516300023f, -0.902700007f, 0.423500001f, -0.0759000033f,
+	-0.0233580004f, 0.71006602f, -0.0649380013f, 0.770399988f, 0.721599996f, 0.066200003f, -0.646799982f, -0.759800017f,
+	-0.025254f, 0.712117016f, -0.0668499991f, 0.770600021f, 0.720099986f, 0.104500003f, -0.645900011f, -0.756200016f,
+	-0.0168159995f, 0.717795014f, -0.0688240007f, 0.775200009f, 0.720899999f, 0.194000006f, -0.566799998f, -0.800700009f,
+	0.0097719999f, 0.259712011f, 0.0185829997f, 0.277500004f, 0.654200017f, -0.99150002f, 0.126300007f, -0.0296999998f,
+	0.00825999957f, 0.254716009f, 0.0373769999f, 0.273000002f, 0.661800027f, -0.983799994f, 0.0798000023f, 0.160300002f,
+	0.0100830002f, 0.274574995f, 0.0357020013f, 0.281899989f, 0.663500011f, -0.987999976f, 0.133100003f, 0.0781999975f,
+	0.0121320002f, 0.275638014f, 0.0268300008f, 0.283499986f, 0.659699976f, -0.951799989f, 0.239899993f, -0.191f,
+	0.00539200008f, 0.223124996f, 0.0306490008f, 0.25999999f, 0.655099988f, -0.986800015f, 0.128999993f, 0.0980999991f,
+	0.00603599986f, 0.242853999f, -0.000645999971f, 0.272300005f, 0.64380002f, -0.986999989f, 0.156000003f, 0.0381999984f,
+	0.0169190001f, 0.252766013f, 0.0621219985f, 0.269400001f, 0.673300028f, -0.878300011f, 0.162100002f, 0.449800014f,
+	0.0177340005f, 0.272994012f, 0.0606030002f, 0.278499991f, 0.674700022f, -0.876699984f, 0.0710000023f, 0.475699991f,
+	0.00896099955f, 0.223578006f, 0.0656839982f, 0.255800009f, 0.670400023f, -0.884599984f, 0.277200013f, 0.375f,
+	0.0291080009f, 0.250968009f, 0.0784559995f, 0.267100006f, 0.682399988f, -0.549000025f, 0.219999999f, 0.806400001f,
+	0.0302510001f, 0.271275997f, 0.0749180019f, 0.2764f, 0.683000028f, -0.555599988f, 0.150999993f, 0.817600012f,
+	0.00422299979f, 0.221111f, -0.0108890003f, 0.264099985f, 0.636699975f, -0.996999979f, 0.0610999987f, 0.0469000004f,
+	0.0253829993f, 0.222158998f, 0.0854170024f, 0.253500015f, 0.681800008f, -0.448100001f, 0.264299989f, 0.853999972f,
+	0.0428779982f, 0.250762999f, 0.0836839974f, 0.266799986f, 0.689100027f, 0.0456999987f, 0.213400006f, 0.975899994f,
+	0.042874001f, 0.268896013f, 0.0783950016f, 0.275200009f, 0.688799977f, 0.0296999998f, 0.199900001f, 0.979399979f,
+	0.0428650007f, 0.220183f, 0.0885360017f, 0.252900004f, 0.689999998f, 0.125100002f, 0.194999993f, 0.972800016f,
+	0.0574130006f, 0.252048999f, 0.0763140023f, 0.2685f, 0.69630003f, 0.626600027f, 0.150199994f, 0.764699996f,
+	0.0554720014f, 0.27125001f, 0.0748120025f, 0.277099997f, 0.694500029f, 0.582000017f, 0.119000003f, 0.804400027f,
+	0.0722640008f, 0.219339997f, 0.0628150031f, 0.255800009f, 0.707899988f, 0.918200016f, 0.115800001f, 0.378800005f,
+	0.0684880018f, 0.253706008f, 0.0606050007f, 0.271100014f, 0.704599977f, 0.913299978f, 0.118600003f, 0.389600009f,
+	0.0567170009f, 0.219468996f, 0.0823320001f, 0.253600001f, 0.69690001f, 0.598999977f, 0.133100003f, 0.789600015f,
+	0.0666000023f, 0.273828f, 0.0591499992f, 0.280099988f, 0.702799976f, 0.929499984f, 0.112599999f, 0.351200014f,
+	0.0763750002f, 0.218994007f, 0.0299549997f, 0.25940001f, 0.72240001f, 0.981000006f, 0.114399999f, 0.156800002f,
+	0.073714003f, 0.256152004f, 0.0365470015f, 0.274899989f, 0.71509999f, 0.987100005f, 0.151700005f, 0.0513000004f,
+	0.0688590035f, 0.274342f, 0.0410410017f, 0.282499999f, 0.710699975f, 0.97420001f, 0.219500005f, 0.0524999984f,
+	0.0788780004f, 0.244664997f, 0.0033760001f, 0.273600012f, 0.731299996f, 0.960799992f, 0.227799997f, 0.158299997f,
+	0.0850939974f, 0.218863994f, -0.00947999954f, 0.263500005f, 0.740100026f, 0.975799978f, 0.162f, 0.146599993f,
+	0.0714209974f, 0.258497f, 0.0207029991f, 0.278200001f, 0.721700013f, 0.981299996f, 0.192599997f, 0.00310000009f,
+	0.0670330003f, 0.276053011f, 0.0299190003f, 0.284799993f, 0.715300024f, 0.949000001f, 0.295100003f, -0.110399999f,
+	-0.0097719999f, 0.259712011f, 0.0185829997f, 0.2509f, 0.976499975f, 0.99150002f, 0.126300007f, -0.0296999998f,
+	-0.0121320002f, 0.275638014f, 0.0268300008f, 0.244800001f, 0.971099973f, 0.951799989f, 0.239899993f, -0.191f,
+	-0.0100830002f, 0.274574995f, 0.0357020013f, 0.246399999f, 0.967299998f, 0.987999976f, 0.133100003f, 0.0781999975f,
+	-0.00825999957f, 0.254716009f, 0.0373769999f, 0.255400002f, 0.968900025f, 0.983799994f, 0.0798000023f, 0.160300002f,
+	-0.00539200008f, 0.223124996f, 0.0306490008f, 0.2685f, 0.975499988f, 0.986800015f, 0.128999993f, 0.0980999991f,
+	-0.00603599986f, 0.242853999f, -0.000645999971f, 0.256199986f, 0.986999989f, 0.984300017f, 0.166500002f, 0.0592f,
+	-0.0169190001f, 0.252766013f, 0.0621219985f, 0.259000003f, 0.957300007f, 0.878300011f, 0.162100002f, 0.449800014f,
+	-0.0177340005f, 0.272994012f, 0.0606030002f, 0.249799997f, 0.95599997f, 0.876699984f, 0.0710000023f, 0.475699991f,
+	-0.00896099955f, 0.223578006f, 0.0656839982f, 0.272700012f, 0.960099995f, 0.884599984f, 0.277200013f, 0.375f,
+	-0.00422299979f, 0.221111f, -0.0108890003f, 0.264600009f, 0.994000018f, 0.995000005f, 0.0401000008f, 0.0909999982f,
+	-0.0302510001f, 0.271275997f, 0.0749180019f, 0.251899987f, 0.947700024f, 0.555599988f, 0.150999993f, 0.817600012f,
+	-0.0291080009f, 0.250968009f, 0.0784559995f, 0.261200011f, 0.948099971f, 0.549000025f, 0.219999999f, 0.806400001f,
+	-0.0253829993f, 0.222158998f, 0.0854170024f, 0.274899989f, 0.948599994f, 0.448100001f, 0.264299989f, 0.853999972f,
+	-0.042874001f, 0.268896013f, 0.0783950016f, 0.253100008f, 0.941799998f, -0.0296999998f, 0.199900001f, 0.979399979f,
+	-0.0428779982f, 0.250762999f, 0.0836839974f, 0.261500001f, 0.941500008f, -0.0456999987f, 0.213400006f, 0.975899994f,
+	-0.0428650007f, 0.220183f, 0.0885360017f, 0.275400013f, 0.940500021f, -0.125100002f, 0.194999993f, 0.972800016f,
+	-0.0574130006f, 0.252048999f, 0.0763150007f, 0.259799987f, 0.934300005f, -0.626600027f, 0.150199994f, 0.764699996f,
+	-0.0554720014f, 0.27125001f, 0.0748120025f, 0.251300007f, 0.936100006f, -0.582000017f, 0.119000003f, 0.804400027f,
+	-0.0567170009f, 0.219468996f, 0.0823320001f, 0.274699986f, 0.933700025f, -0.598999977f, 0.133100003f, 0.789600015f,
+	-0.0722640008f, 0.219339997f, 0.0628150031f, 0.272599995f, 0.922599971f, -0.918200016f, 0.115800001f, 0.378800005f,
+	-0.0684880018f, 0.253706008f, 0.0606050007f, 0.257299989f, 0.925999999f, -0.913299978f, 0.118600003f, 0.389600009f,
+	-0.0666000023f, 0.273828f, 0.0591499992f, 0.248400003f, 0.927900016f, -0.929499984f, 0.112599999f, 0.351200014f,
+	-0.0763750002f, 0.218994007f, 0.0299549997f, 0.26879999f, 0.908200026f, -0.981000006f, 0.114399999f, 0.156800002f,
+	-0.073714003f, 0.256152004f, 0.0365470015f, 0.253500015f, 0.915600002f, -0.987100005f, 0.151700005f, 0.0513000004f,
+	-0.0688590035f, 0.274342f, 0.0410410017f, 0.246000007f, 0.920000017f, -0.97420001f, 0.219500005f, 0.0524999984f,
+	-0.0788780004f, 0.244664997f, 0.0033760001f, 0.254599988f, 0.899399996f, -0.960799992f, 0.227799997f, 0.158299997f,
+	-0.0850939974f, 0.218863994f, -0.00947999954f, 0.264499992f, 0.890500009f, -0.975799978f, 0.162f, 0.146599993f,
+	-0.0714209974f, 0.258497f, 0.0207029991f, 0.25029999f, 0.908999979f, -0.981299996f, 0.192599997f, 0.00310000009f,
+	-0.0670330003f, 0.276053011f, 0.0299190003f, 0.243599996f, 0.915300012f, -0.949000001f, 0.295100003f, -0.110399999f,
+	3.50000009e-05f, 0.168503001f, -0.143225998f, 0.832899988f, 0.266600013f, 0.25060001f, -0.130700007f, 0.959200025f,
+	0.000497000001f, 0.141154006f, -0.146702006f, 0.823099971f, 0.258899987f, 0.233799994f, -0.118699998f, 0.964999974f,
+	0.0421230011f, 0.228530005f, -0.146038994f, 0.866100013f, 0.26699999f, 0.479799986f, -0.297699988f, 0.825299978f,
+	0.0322909988f, 0.228327006f, -0.139723003f, 0.863300025f, 0.271499991f, 0.515999973f, -0.324600011f, 0.792699993f,
+	0.0425439999f, 0.442039996f, -0.0409360006f, 0.425799996f, 0.531199992f, 0.218199998f, 0.948199987f, -0.230700001f,
+	0.0425760001f, 0.44383201f, -0.0338380001f, 0.422600001f, 0.531799972f, 0.225999996f, 0.944199979f, -0.239399999f,
+	0.0640410036f, 0.44175899f, -0.0217480008f, 0.419200003f, 0.542500019f, 0.194299996f, 0.959500015f, -0.203700006f,
+	0.0642170012f, 0.44037801f, -0.0284209996f, 0.422300011f, 0.541999996f, 0.186100006f, 0.963100016f, -0.194499999f,
+	-0.0425439999f, 0.442039996f, -0.0409360006f, 0.269400001f, 0.766200006f, -0.218199998f, 0.948199987f, -0.230700001f,
+	-0.0642170012f, 0.44037801f, -0.0284209996f, 0.272899985f, 0.755400002f, -0.186100006f, 0.963100016f, -0.194499999f,
+	-0.0640410036f, 0.44175899f, -0.0217480008f, 0.275999993f, 0.754899979f, -0.194299996f, 0.959500015f, -0.203700006f,
+	-0.0425760001f, 0.44383201f, -0.0338380001f, 0.272700012f, 0.765600026f, -0.225999996f, 0.944199979f, -0.239399999f,
+	0.00886000041f, 0.951499999f, 0.149743006f, 0.640699983f, 0.985800028f, 0.779999971f, -0.0944000036f, 0.618600011f,
+	0.00373900007f, 0.942960978f, 0.154653996f, 0.635900021f, 0.987600029f, 0.839100003f, -0.137899995f, 0.526199996f,
+	0.00671799993f, 0.944123983f, 0.149774998f, 0.637099981f, 0.985300004f, 0.866400003f, -0.206499994f, 0.45449999f,
+	0.00706999982f, 0.994929016f, 0.156094998f, 0.657999992f, 0.994899988f, 0.784500003f, -0.0151000004f, 0.620000005f,
+	0.00249299989f, 0.932918012f, 0.154342994f, 0.631500006f, 0.986899972f, 0.912699997f, -0.123999998f, 0.389299989f,
+	0.00513899978f, 0.934894979f, 0.148581997f, 0.6329f, 0.984300017f, 0.916599989f, -0.162499994f, 0.3653f,
+	0.00259799999f, 0.919831991f, 0.150911003f, 0.625800014f, 0.984799981f, 0.940299988f, -0.0533000007f, 0.336199999f,
+	0.00128700002f, 0.918574989f, 0.154517993f, 0.625100017f, 0.986400008f, 0.944999993f, -0.0205000006f, 0.326400012f,
+	0.00179300003f, 0.912747979f, 0.153251007f, 0.622500002f, 0.985599995f, 0.956900001f, 0.0461999997f, 0.286900014f,
+	0.000959000026f, 0.914286017f, 0.155876994f, 0.623099983f, 0.986899972f, 0.963699996f, 0.0469999984f, 0.262899995f,
+	0.001239f, 0.908855021f, 0.156474993f, 0.620599985f, 0.986999989f, 0.976899981f, 0.0724999979f, 0.201199993f,
+	0.000688f, 0.91000402f, 0.159141004f, 0.621100008f, 0.988300025f, 0.9824f, 0.0697000027f, 0.172999993f,
+	0.0180840008f, 1.01495802f, 0.141037002f, 0.66960001f, 0.9903f, 0.945900023f, -0.0344000012f, 0.322600007f,
+	0.0117419995f, 1.02196205f, 0.150064006f, 0.67049998f, 0.996200025f, 0.84829998f, 0.0364000015f, 0.528299987f,
+	0.0190520007f, 1.02198398f, 0.129036993f, 0.674700022f, 0.986400008f, 0.980700016f, -0.189600006f, -0.0480999984f,
+	0.0203399993f, 1.02711594f, 0.133682996f, 0.675999999f, 0.989400029f, 0.976800025f, -0.0786999986f, 0.199300006f,
+	0.0169910006f, 1.037956f, 0.140145004f, 0.678900003f, 0.994499981f, 0.898100019f, 0.0154999997f, 0.439500004f,
+	0.0216240007f, 1.036057f, 0.124352001f, 0.681599975f, 0.987299979f, 0.989499986f, -0.143800005f, -0.0167999994f,
+	0.0212849993f, 1.04637599f, 0.130327001f, 0.684400022f, 0.991999984f, 0.971599996f, -0.0419000015f, 0.232700005f,
+	0.0199050009f, 1.03065896f, 0.120788001f, 0.680000007f, 0.984700024f, 0.963800013f, -0.218999997f, -0.151899993f,
+	0.0212500002f, 1.04173005f, 0.114384003f, 0.685899973f, 0.984499991f, 0.946799994f, -0.282299995f, -0.154499993f,
+	0.02458f, 1.05308795f, 0.116663001f, 0.690100014f, 0.987999976f, 0.972599983f, -0.230900005f, 0.0276999995f,
+	0.0186449997f, 1.04031801f, 0.104456998f, 0.687300026f, 0.979900002f, 0.881299973f, -0.409099996f, -0.236599997f,
+	0.0256270003f, 1.05484998f, 0.102270998f, 0.694100022f, 0.98299998f, 0.876900017f, -0.467400014f, -0.112000003f,
+	0.0160649996f, 1.04344594f, 0.0934540033f, 0.690699995f, 0.975700021f, 0.785300016f, -0.603200018f, -0.139400005f,
+	0.0225859992f, 1.05105698f, 0.0883729979f, 0.695800006f, 0.976599991f, 0.746500015f, -0.663500011f, -0.0502999984f,
+	0.0130690001f, 1.04242003f, 0.0765239969f, 0.694299996f, 0.968800008f, 0.731100023f, -0.671400011f, -0.121200003f,
+	0.0186359994f, 1.04997802f, 0.0688399971f, 0.699800014f, 0.968500018f, 0.728999972f, -0.671599984f, -0.132400006f,
+	0.0116149997f, 1.04407895f, 0.061751999f, 0.698400021f, 0.963500023f, 0.74849999f, -0.650699973f, -0.128000006f,
+	0.00896300003f, 1.04014206f, 0.0666989982f, 0.6954f, 0.963999987f, 0.744799972f, -0.655900002f, -0.1228f,
+	0.003272f, 1.03456497f, 0.0571050011f, 0.695100009f, 0.958400011f, 0.776199996f, -0.61680001f, -0.130899996f,
+	0.00595499994f, 1.03913498f, 0.0525069982f, 0.698199987f, 0.958100021f, 0.778599977f, -0.609099984f, -0.150900006f,
+	-0.0130709996f, 1.04241598f, 0.0765239969f, 0.600499988f, 0.942700028f, -0.744599998f, -0.657999992f, -0.112400003f,
+	-0.0186379999f, 1.04997802f, 0.0688389987f, 0.595399976f, 0.940599978f, -0.736299992f, -0.665600002f, -0.1215f,
+	-0.0116149997f, 1.04407895f, 0.061751999f, 0.598200023f, 0.93629998f, -0.750500023f, -0.645299971f, -0.142199993f,
+	-0.00897500012f, 1.04012299f, 0.0667010024f, 0.600899994f, 0.937699974f, -0.745899975f, -0.654200017f, -0.125f,
+	-0.0225549992f, 1.05190694f, 0.0881239995f, 0.596400023f, 0.949500024f, -0.76819998f, -0.636399984f, -0.0697000027f,
+	-0.016059f, 1.04345596f, 0.0934550017f, 0.601800025f, 0.950399995f, -0.799399972f, -0.580200016f, -0.156100005f,
+	-0.00577200018f, 1.03986096f, 0.0520830005f, 0.599699974f, 0.931100011f, -0.782599986f, -0.582799971f, -0.218700007f,
+	-0.00324300001f, 1.03458905f, 0.0570800006f, 0.602900028f, 0.932399988f, -0.779799998f, -0.600000024f, -0.178599998f,
+	-0.0256280005f, 1.05484998f, 0.102270998f, 0.596300006f, 0.95599997f, -0.877300024f, -0.4639f, -0.123300001f,
+	-0.0186299998f, 1.04033399f, 0.104463004f, 0.603699982f, 0.955500007f, -0.880500019f, -0.410299987f, -0.237299994f,
+	-0.0212500002f, 1.04173005f, 0.114384003f, 0.603600025f, 0.960200012f, -0.946500003f, -0.282799989f, -0.155300006f,
+	-0.0245820004f, 1.05308795f, 0.116664f, 0.598500013f, 0.962100029f, -0.972500026f, -0.231199995f, 0.0275999997f,
+	-0.0199059993f, 1.03065801f, 0.120787002f, 0.609200001f, 0.962199986f, -0.96390003f, -0.217700005f, -0.153500006f,
+	-0.0216220003f, 1.03605795f, 0.124352001f, 0.606899977f, 0.96420002f, -0.989499986f, -0.143199995f, -0.0170000009f,
+	-0.0212900005f, 1.04637599f, 0.130328998f, 0.602800012f, 0.967700005f, -0.975600004f, -0.0452999994f, 0.214699998f,
+	-0.0203399993f, 1.02711594f, 0.133682996f, 0.611699998f, 0.967700005f, -0.977699995f, -0.0904000029f, 0.189400002f,
+	-0.0190900005f, 1.02195501f, 0.129006997f, 0.613799989f, 0.965300024f, -0.98119998f, -0.188199997f, -0.0434999987f,
+	-0.0175979994f, 1.03808105f, 0.140518993f, 0.607299984f, 0.971700013f, -0.919099987f, -0.0155999996f, 0.393700004f,
+	-0.0180430003f, 1.014961f, 0.141023993f, 0.617799997f, 0.970300019f, -0.945800006f, -0.0362000018f, 0.322600007f,
+	-0.0117419995f, 1.02196205f, 0.150064006f, 0.6153f, 0.975499988f, -0.851700008f, 0.0214000009f, 0.523699999f,
+	-0.0178350005f, 1.01141798f, 0.135453999f, 0.619099975f, 0.967700005f, -0.989899993f, -0.132599995f, 0.0496000014f,
+	-0.0132630002f, 0.988572001f, 0.148246005f, 0.630200028f, 0.972599983f, -0.913500011f, -0.0829999968f, 0.398299992f,
+	-0.00707500009f, 0.994929016f, 0.156100005f, 0.627699971f, 0.977400005f, -0.78549999f, -0.0148999998f, 0.618700027f,
+	-0.0134030003f, 0.986496985f, 0.143705994f, 0.630999982f, 0.970499992f, -0.987699986f, -0.128299996f, 0.0890000015f,
+	-0.00836000033f, 0.947800994f, 0.149592996f, 0.648800015f, 0.972899973f, -0.798399985f, -0.1193f, 0.590200007f,
+	-0.00373600004f, 0.942961991f, 0.154651001f, 0.651199996f, 0.976100028f, -0.830900013f, -0.169499993f, 0.529900014f,
+	-0.00508099981f, 0.934588015f, 0.148619995f, 0.654999971f, 0.973200023f, -0.899200022f, -0.1391f, 0.414799988f,
+	-0.00249299989f, 0.932918012f, 0.154342994f, 0.655799985f, 0.976100028f, -0.91960001f, -0.103699997f, 0.378800005f,
+	-0.00255399989f, 0.919449985f, 0.151032001f, 0.661899984f, 0.974699974f, -0.939199984f, -0.0529999994f, 0.339399993f,
+	-0.00128600001f, 0.918574989f, 0.154516995f, 0.662299991f, 0.976400018f, -0.9454f, -0.0267999992f, 0.324900001f,
+	-0.00173300004f, 0.912766993f, 0.153274f, 0.665000021f, 0.975799978f, -0.961099982f, 0.0417000018f, 0.272899985f,
+	-0.000960999983f, 0.914286971f, 0.155880004f, 0.664300025f, 0.976999998f, -0.967700005f, 0.0434000008f, 0.248400003f,
+	-0.00123299996f, 0.908859015f, 0.156474993f, 0.666700006f, 0.977299988f, -0.978500009f, 0.0702999979f, 0.193800002f,
+	-0.000690000015f, 0.91000402f, 0.159143999f, 0.666199982f, 0.978500009f, -0.98299998f, 0.0680000037f, 0.1708f,
+	0.0758860037f, 0.258029997f, -0.0172070004f, 0.390799999f, 0.531099975f, 0.813199997f, 0.435200006f, -0.386400014f,
+	0.0642559975f, 0.263244003f, -0.0348360017f, 0.3847f, 0.523299992f, 0.680499971f, 0.57249999f, -0.457300007f,
+	0.0621730015f, 0.269867986f, -0.0298950002f, 0.382099986f, 0.52609998f, 0.693099976f, 0.551500022f, -0.46419999f,
+	0.0741650015f, 0.265332997f, -0.0124639999f, 0.388000011f, 0.533999979f, 0.808899999f, 0.442200005f, -0.387400001f,
+	0.0820799991f, 0.261382014f, 0.00104799995f, 0.392399997f, 0.539900005f, 0.939800024f, 0.339700013f, -0.0377000012f,
+	0.0847709998f, 0.253535986f, 0.00132200005f, 0.395999998f, 0.539099991f, 0.937900007f, 0.332500011f, -0.0988999978f,
+	0.0443050005f, 0.268182993f, -0.0526250005f, 0.376300007f, 0.514299989f, 0.583100021f, 0.662699997f, -0.469900012f,
+	0.0436200015f, 0.274798006f, -0.0441460013f, 0.374199986f, 0.518700004f, 0.583500028f, 0.651000023f, -0.485500008f,
+	0.0776569992f, 0.266362995f, 0.0100830002f, 0.390599996f, 0.54460001f, 0.915499985f, 0.367799997f, 0.163100004f,
+	0.0776769966f, 0.263550997f, 0.0169949997f, 0.392500013f, 0.547399998f, 0.926699996f, 0.369399995f, 0.0691f,
+	0.0708649978f, 0.28165701f, 0.0168609992f, 0.383899987f, 0.549099982f, 0.91109997f, 0.340999991f, -0.231700003f,
+	0.0742039979f, 0.280286014f, 0.0241369996f, 0.385699987f, 0.552299976f, 0.880299985f, 0.328700006f, -0.342099994f,
+	-0.0606499985f, 0.448092014f, -0.0640430003f, 0.549099982f, 0.458999991f, -0.223700002f, 0.468100011f, -0.854900002f,
+	-0.0577780008f, 0.452580005f, -0.0630970001f, 0.551299989f, 0.459800005f, -0.269499987f, 0.360599995f, -0.89289999f,
+	-0.0400779992f, 0.446945012f, -0.0647810027f, 0.550800025f, 0.468199998f, 0.0163000003f, 0.731000006f, -0.682099998f,
+	-0.0425209999f, 0.443780988f, -0.0692140013f, 0.548300028f, 0.467700005f, 0.0238000005f, 0.807399988f, -0.58950001f,
+	-0.0648399964f, 0.457542002f, -0.0549140014f, 0.553900003f, 0.4551f, -0.197099999f, 0.621699989f, -0.758000016f,
+	-0.0699850023f, 0.454293996f, -0.056694001f, 0.551500022f, 0.453500003f, -0.112300001f, 0.656700015f, -0.745700002f,
+	-0.0796430036f, 0.461834997f, -0.0489300005f, 0.554400027f, 0.44749999f, 0.120700002f, 0.754100025f, -0.645600021f,
+	-0.0808489993f, 0.458541989f, -0.0533370003f, 0.551900029f, 0.448000014f, 0.157299995f, 0.773899972f, -0.613499999f,
+	-0.111718997f, 0.466834009f, -0.0528649986f, 0.548600018f, 0.433800012f, -0.175899997f, 0.714999974f, -0.676599979f,
+	-0.100731999f, 0.460245997f, -0.0582330003f, 0.547100008f, 0.439999998f, 0.159099996f, 0.769400001f, -0.618600011f,
+	-0.118674003f, 0.461636007f, -0.055695001f, 0.5449f, 0.432000011f, -0.379500002f, 0.779299974f, -0.498699993f,
+	-0.135487005f, 0.458817005f, -0.037140999f, 0.546000004f, 0.420599997f, -0.664699972f, 0.739400029f, -0.107299998f,
+	-0.128916994f, 0.464913011f, -0.0369389988f, 0.549199998f, 0.423200011f, -0.638300002f, 0.698599994f, -0.323300004f,
+	-0.133932993f, 0.457098991f, -0.0127119999f, 0.553200006f, 0.412099987f, -0.642799973f, 0.715600014f, 0.273400009f,
+	-0.139877006f, 0.450419992f, -0.0101229995f, 0.550800025f, 0.408499986f, -0.59799999f, 0.690199971f, 0.407599986f,
+	-0.132797003f, 0.44532001f, 0.00217200001f, 0.555800021f, 0.403800011f, -0.532999992f, 0.781700015f, 0.323900014f,
+	-0.128739998f, 0.44916299f, -0.000988999964f, 0.557099998f, 0.406399995f, -0.380299985f, 0.786899984f, 0.486099988f,
+	-0.133677006f, 0.442369014f, 0.0132149998f, 0.557699978f, 0.398900002f, -0.619099975f, 0.751800001f, -0.226999998f,
+	-0.129087001f, 0.446662992f, 0.0146359997f, 0.560400009f, 0.400000006f, -0.649500012f, 0.744300008f, -0.155599996f,
+	-0.149182007f, 0.440342993f, 0.0274320003f, 0.557099998f, 0.389400005f, -0.621200025f, 0.698700011f, -0.354799986f,
+	-0.145855993f, 0.444766998f, 0.0303000007f, 0.559899986f, 0.389600009f, -0.62349999f, 0.70630002f, -0.335299999f,
+	-0.156380996f, 0.440809011f, 0.0536869988f, 0.56190002f, 0.377999991f, -0.558700025f, 0.828800023f, 0.0298999995f,
+	-0.151448995f, 0.443960011f, 0.0524379984f, 0.563799977f, 0.379900008f, -0.534300029f, 0.845000029f, 0.0220999997f,
+	-0.141609997f, 0.44412899f, 0.0769390017f, 0.573400021f, 0.372799993f, -0.398400009f, 0.818899989f, 0.413100004f,
+	-0.138577998f, 0.447777003f, 0.0726319999f, 0.573899984f, 0.37560001f, -0.382600009f, 0.82950002f, 0.406899989f,
+	-0.106659003f, 0.445645988f, 0.0866400003f, 0.5898f, 0.374799997f, -0.199399993f, 0.9102f, 0.363099992f,
+	-0.103706002f, 0.447961003f, 0.0820600018f, 0.590300024f, 0.377400011f, -0.175999999f, 0.91960001f, 0.351399988f,
+	-0.0852850005f, 0.443257987f, 0.111495003f, 0.603200018f, 0.368099988f, -0.439999998f, 0.724799991f, 0.530200005f,
+	-0.0969579965f, 0.441881001f, 0.102243997f, 0.596499979f, 0.369500011f, -0.465200007f, 0.746399999f, 0.475899994f,
+	-0.0694750026f, 0.441760004f, 0.122293003f, 0.611599982f, 0.365799993f, -0.128199995f, 0.604700029f, 0.78609997f,
+	-0.0844120011f, 0.438333988f, 0.118612997f, 0.604600012f, 0.364399999f, -0.361900002f, 0.714999974f, 0.598200023f,
+	-0.0683870018f, 0.435943007f, 0.126516998f, 0.612600029f, 0.362699986f, -0.0340999998f, 0.583100021f, 0.811699986f,
+	-0.0456399992f, 0.436545014f, 0.121546999f, 0.622699976f, 0.365700006f, 0.270200014f, 0.668299973f, 0.693099976f,
+	-0.0483709984f, 0.440221012f, 0.119034998f, 0.621200025f, 0.367500007f, 0.239999995f, 0.674099982f, 0.698599994f,
+	-0.0252870005f, 0.440750003f, 0.105768003f, 0.632000029f, 0.372999996f, 0.237200007f, 0.82980001f, 0.505100012f,
+	-0.0278740004f, 0.444247007f, 0.101265997f, 0.630800009f, 0.375499994f, 0.237900004f, 0.828499973f, 0.506900012f,
+	-0.00733500021f, 0.444207996f, 0.0948849991f, 0.640200019f, 0.378199995f, 0.0228000004f, 0.91900003f, 0.393599987f,
+	-0.00872599985f, 0.446426004f, 0.0897879973f, 0.639599979f, 0.380699992f, 0.0362999998f, 0.907100022f, 0.419400007f,
+	0.0118089998f, 0.443805993f, 0.0963049978f, 0.648999989f, 0.377600014f, -0.105499998f, 0.871399999f, 0.479099989f,
+	0.0137750003f, 0.446561009f, 0.0918280035f, 0.649800003f, 0.379999995f, -0.123999998f, 0.85799998f, 0.49849999f,
+	0.0371970013f, 0.438360989f, 0.115566999f, 0.660899997f, 0.368999988f, -0.354099989f, 0.659300029f, 0.663299978f,
+	0.041813001f, 0.442413002f, 0.113968998f, 0.663200021f, 0.370599985f, -0.342599988f, 0.655799985f, 0.672699988f,
+	0.0575859994f, 0.433887988f, 0.126061007f, 0.6699f, 0.363400012f, -0.113899998f, 0.443899989f, 0.888800025f,
+	0.0582959987f, 0.440521985f, 0.123057999f, 0.670799971f, 0.366600007f, -0.103500001f, 0.436800003f, 0.893599987f,
+	0.0772470012f, 0.436437994f, 0.123553999f, 0.67900002f, 0.363200009f, 0.199000001f, 0.636699975f, 0.745000005f,
+	0.0767640024f, 0.440813005f, 0.120029002f, 0.67930001f, 0.365799993f, 0.307200015f, 0.597000003f, 0.741100013f,
+	0.0916040018f, 0.439202011f, 0.111688003f, 0.687099993f, 0.365999997f, 0.463800013f, 0.688300014f, 0.557799995f,
+	0.0877010003f, 0.44372499f, 0.109351002f, 0.685899973f, 0.368600011f, 0.460700005f, 0.699699998f, 0.546000004f,
+	0.103740998f, 0.446042001f, 0.0877799988f, 0.697000027f, 0.373699993f, 0.177100003f, 0.944100022f, 0.278100014f,
+	0.100547999f, 0.447423995f, 0.0846619979f, 0.696399987f, 0.375699997f, 0.159799993f, 0.948899984f, 0.272300005f,
+	0.142664999f, 0.443838f, 0.0772079974f, 0.71509999f, 0.370000005f, 0.334600002f, 0.857500017f, 0.390700012f,
+	0.141286999f, 0.447093993f, 0.0714529976f, 0.715699971f, 0.372999996f, 0.426499993f, 0.827199996f, 0.36590001f,
+	0.151224002f, 0.444330007f, 0.0575640015f, 0.723200023f, 0.37529999f, 0.621100008f, 0.778100014f, 0.0934000015f,
+	0.154833004f, 0.441177994f, 0.0596840009f, 0.724300027f, 0.373199999f, 0.609600008f, 0.782599986f, 0.125799999f,
+	0.153291002f, 0.440939009f, 0.0343540013f, 0.731400013f, 0.382299989f, 0.528100014f, 0.814400017f, -0.240500003f,
+	0.148812994f, 0.444175005f, 0.0357090011f, 0.729099989f, 0.38350001f, 0.51789999f, 0.81129998f, -0.271400005f,
+	0.134277001f, 0.440809011f, 0.0148710003f, 0.732299984f, 0.394699991f, 0.73150003f, 0.669399977f, -0.129800007f,
+	0.131024003f, 0.444757015f, 0.0163739994f, 0.730000019f, 0.395399988f, 0.701499999f, 0.706700027f, -0.0918999985f,
+	0.136389002f, 0.447099f, -0.0027079999f, 0.735599995f, 0.40259999f, 0.404300004f, 0.856000006f, 0.3222f,
+	0.129688993f, 0.449851006f, -0.002629f, 0.73269999f, 0.403899997f, 0.372299999f, 0.871100008f, 0.320300013f,
+	0.139299005f, 0.456777006f, -0.0250109993f, 0.74000001f, 0.412800014f, 0.399699986f, 0.899999976f, 0.173899993f,
+	0.134581f, 0.458573997f, -0.0230390001f, 0.737600029f, 0.413100004f, 0.457899988f, 0.864199996f, 0.208299994f,
+	0.127525002f, 0.459419996f, -0.0478690006f, 0.740100026f, 0.424600005f, 0.596300006f, 0.657800019f, -0.460000008f,
+	0.124600001f, 0.464008003f, -0.0457670018f, 0.737500012f, 0.424600005f, 0.558600008f, 0.612299979f, -0.559499979f,
+	0.100555003f, 0.461587995f, -0.0582799986f, 0.735199988f, 0.436800003f, 0.0230999999f, 0.660899997f, -0.750100017f,
+	0.0999429971f, 0.46539399f, -0.0549460016f, 0.733099997f, 0.435799986f, 0.0127999997f, 0.659500003f, -0.751600027f,
+	0.0775379986f, 0.456968993f, -0.0533300005f, 0.729499996f, 0.446099997f, -0.0373999998f, 0.712899983f, -0.700299978f,
+	0.0771429986f, 0.460869014f, -0.0493130013f, 0.727199972f, 0.444999993f, -0.112300001f, 0.707400024f, -0.697799981f,
+	0.0620750003f, 0.454962999f, -0.0593359992f, 0.727999985f, 0.453599989f, 0.0993999988f, 0.702700019f, -0.70450002f,
+	0.0648790002f, 0.452490985f, -0.0614220016f, 0.729900002f, 0.453299999f, 0.103399999f, 0.719200015f, -0.686999977f,
+	0.0494889989f, 0.44956401f, -0.0650350004f, 0.728100002f, 0.460299999f, -0.112800002f, 0.784099996f, -0.610300004f,
+	0.0504180007f, 0.44650501f, -0.0687839985f, 0.730099976f, 0.461100012f, -0.105099998f, 0.757499993f, -0.644299984f,
+	0.0409980007f, 0.444822997f, -0.0679029971f, 0.728100002f, 0.465000004f, -0.368699998f, 0.865400016f, -0.33919999f,
+	0.0405509993f, 0.445546001f, -0.0639059991f, 0.726400018f, 0.46450001f, -0.422800004f, 0.882300019f, -0.206900001f,
+	0.129125997f, 0.674180984f, -0.0721599981f, 0.0832000002f, 0.495099992f, 0.164100006f, -0.821699977f, -0.545700014f,
+	0.0968609974f, 0.684879005f, -0.0972760022f, 0.0803999975f, 0.514100015f, 0.158600003f, -0.854600012f, -0.494500011f,
+	0.0970159993f, 0.688009977f, -0.102637999f, 0.0778999999f, 0.515500009f, 0.224700004f, -0.849099994f, -0.478100002f,
+	0.127670005f, 0.67910099f, -0.0798629969f, 0.0799999982f, 0.497799993f, 0.1743f, -0.814599991f, -0.553200006f,
+	0.0761429965f, 0.686815977f, -0.112751998f, 0.0798999965f, 0.52579999f, 0.323399991f, -0.913299978f, -0.247600004f,
+	0.077996999f, 0.688628972f, -0.116865002f, 0.0777999982f, 0.526300013f, 0.359299988f, -0.902899981f, -0.236100003f,
+	0.0518580005f, 0.679439008f, -0.130380005f, 0.0816000029f, 0.539799988f, 0.234400004f, -0.968599975f, 0.0825000033f,
+	0.0599320009f, 0.681351006f, -0.130858004f, 0.0789000019f, 0.537100017f, 0.254799992f, -0.964900017f, 0.0631000027f,
+	-0.0425439999f, 0.442039996f, -0.0409360006f, 0.473699987f, 0.859700024f, 0.190599993f, 0.950399995f, -0.245700002f,
+	-0.0425760001f, 0.44383201f, -0.0338380001f, 0.476999998f, 0.860400021f, 0.186499998f, 0.952799976f, -0.239700004f,
+	-0.0172479991f, 0.441532999f, -0.0232679993f, 0.479099989f, 0.872699976f, 0.2104f, 0.938300014f, -0.274300009f,
+	-0.0169220008f, 0.439929992f, -0.0283439998f, 0.476700008f, 0.872399986f, 0.215399995f, 0.935100019f, -0.281599998f,
+	0.0425439999f, 0.442039996f, -0.0409360006f, 0.487699986f, 0.568300009f, -0.190599993f, 0.950399995f, -0.245700002f,
+	0.0169220008f, 0.439929992f, -0.0283439998f, 0.484800011f, 0.555700004f, -0.215399995f, 0.935100019f, -0.281599998f,
+	0.0172479991f, 0.441532999f, -0.0232679993f, 0.4824f, 0.555400014f, -0.2104f, 0.938300014f, -0.274300009f,
+	0.0425760001f, 0.44383201f, -0.0338380001f, 0.484400004f, 0.567700028f, -0.186499998f, 0.952799976f, -0.239700004f,
+	-0.00938300043f, 0.911463022f, -0.0490670018f, 0.157600001f, 0.613499999f, -0.156100005f, -0.326200008f, -0.932299972f,
+	-0.00791900046f, 0.905834019f, -0.0476760007f, 0.156900004f, 0.61619997f, -0.211500004f, -0.285899997f, -0.934599996f,
+	-0.01664f, 0.901744008f, -0.0444520004f, 0.1523f, 0.61619997f, -0.119900003f, -0.351300001f, -0.928499997f,
+	-0.0141660003f, 0.907132983f, -0.0471750014f, 0.154599994f, 0.614300013f, 0.0918999985f, -0.482300013f, -0.871200025f,
+	-0.0781069994f, 0.413724989f, 0.00312600005f, 0.39410001f, 0.755900025f, 0.115699999f, 0.712800026f, 0.691799998f,
+	-0.0426819995f, 0.419131011f, -0.00296700001f, 0.405299991f, 0.768100023f, 0.0192000009f, 0.780600011f, 0.62470001f,
+	-0.0425760001f, 0.44383201f, -0.0338380001f, 0.395399988f, 0.783200026f, 0.0344999991f, 0.691100001f, 0.721899986f,
+	-0.0640410036f, 0.44175899f, -0.0217480008f, 0.389600009f, 0.773599982f, 0.390100002f, 0.493800014f, 0.777199984f,
+	-0.000762999989f, 0.41109401f, 0.0037130001f, 0.423999995f, 0.774600029f, -0.0647f, 0.715399981f, 0.69569999f,
+	-0.0172479991f, 0.441532999f, -0.0232679993f, 0.407499999f, 0.78609997f, -0.279399991f, 0.547699988f, 0.788600028f,
+	0.0781069994f, 0.413724989f, 0.00312600005f, 0.453599989f, 0.632499993f, -0.115699999f, 0.712800026f, 0.691799998f,
+	0.0640410036f, 0.44175899f, -0.0217480008f, 0.471199989f, 0.627799988f, -0.390100002f, 0.493800014f, 0.777199984f,
+	0.0425760001f, 0.44383201f, -0.0338380001f, 0.476399988f, 0.617799997f, -0.0344999991f, 0.691100001f, 0.721899986f,
+	0.0426819995f, 0.419131011f, -0.00296700001f, 0.458400011f, 0.61680001f, -0.0192000009f, 0.780600011f, 0.62470001f,
+	0.000762999989f, 0.41109401f, 0.0037130001f, 0.454699993f, 0.597500026f, 0.0647f, 0.715399981f, 0.69569999f,
+	0.0172479991f, 0.441532999f, -0.0232679993f, 0.472799987f, 0.605799973f, 0.279399991f, 0.547699988f, 0.788600028f,
+	0.0494720004f, 0.604250014f, -0.155039996f, 0.754100025f, 0.308999985f, -0.259600013f, -0.965699971f, 0.0f,
+	0.0713260025f, 0.598375976f, -0.155039996f, 0.743900001f, 0.308999985f, -0.259600013f, -0.965699971f, 0.0f,
+	0.0713260025f, 0.598375976f, -0.138402998f, 0.743900001f, 0.301400006f, -0.259600013f, -0.965699971f, 0.0f,
+	0.0494720004f, 0.604250014f, -0.138402998f, 0.754100025f, 0.301400006f, -0.259600013f, -0.965699971f, 0.0f,
+	-0.0496889986f, 0.604649007f, -0.153078005f, 0.763700008f, 0.287499994f, 0.245000005f, -0.968200028f, 0.0500000007f,
+	-0.0504570007f, 0.605668008f, -0.138455003f, 0.759899974f, 0.292899996f, 0.264200002f, -0.961099982f, 0.0808999985f,
+	-0.0701749995f, 0.600175023f, -0.139311001f, 0.752399981f, 0.287499994f, 0.234500006f, -0.971499979f, 0.0333000012f,
+	-0.0695480034f, 0.60028702f, -0.153744996f, 0.756200016f, 0.282200009f, 0.214499995f, -0.976700008f, 0.00170000002f,
+	-0.203950003f, 0.0205710009f, -0.242827997f, 0.873099983f, 0.73150003f, -0.448399991f, 0.656199992f, -0.606899977f,
+	-0.221653f, -0.00337100006f, -0.255636007f, 0.865100026f, 0.743799984f, -0.448399991f, 0.656199992f, -0.606899977f,
+	-0.211151004f, 0.0214380007f, -0.236570001f, 0.869300008f, 0.729399979f, -0.448399991f, 0.656199992f, -0.606899977f,
+	0.0907580033f, 0.218949005f, -0.0132670002f, 0.324299991f, 0.522000015f, 0.525200009f, 0.438800007f, 0.729099989f,
+	0.0839719996f, 0.238582999f, -0.0217439998f, 0.32190001f, 0.512099981f, 0.687900007f, 0.474799991f, 0.549000025f,
+	0.0818220004f, 0.237050995f, -0.0177260004f, 0.320199996f, 0.513499975f, 0.662f, 0.470499992f, 0.583400011f,
+	0.0850939974f, 0.218863994f, -0.00947999954f, 0.3213f, 0.522599995f, 0.497099996f, 0.430900007f, 0.753099978f,
+	-0.0907580033f, 0.218949005f, -0.0132670002f, 0.458299994f, 0.790899992f, -0.525200009f, 0.438800007f, 0.729099989f,
+	-0.0850939974f, 0.218863994f, -0.00947999954f, 0.461299986f, 0.790199995f, -0.497099996f, 0.430900007f, 0.753099978f,
+	-0.0818220004f, 0.237050995f, -0.0177260004f, 0.462599993f, 0.799300015f, -0.662f, 0.470499992f, 0.583400011f,
+	-0.0839719996f, 0.238582999f, -0.0217439998f, 0.460999995f, 0.800700009f, -0.687900007f, 0.474799991f, 0.549000025f,
+	-0.0458009988f, 0.736304998f, -0.134917006f, 0.129099995f, 0.364100009f, 0.0412999988f, -0.975600004f, -0.215700001f,
+	-0.086649999f, 0.72716701f, -0.108415999f, 0.1197f, 0.342799991f, -0.132699996f, -0.765399992f, -0.629700005f,
+	-0.0904520005f, 0.728811026f, -0.109581999f, 0.119599998f, 0.341399997f, -0.0979000032f, -0.735499978f, -0.670400023f,
+	-0.0537620001f, 0.735822976f, -0.135330006f, 0.131200001f, 0.359899998f, 0.068400003f, -0.98299998f, -0.170300007f,
+	-0.120370999f, 0.701949f, -0.0816610008f, 0.101199999f, 0.327300012f, 0.0228000004f, -0.741699994f, -0.670300007f,
+	-0.119719997f, 0.70795399f, -0.0882840008f, 0.105300002f, 0.327699989f, 0.0195000004f, -0.739099979f, -0.673300028f,
+	0.0132149998f, 0.927555978f, -0.0433249995f, 0.158000007f, 0.602299988f, 0.37529999f, -0.3662f, -0.851499975f,
+	0.0129699996f, 0.924311996f, -0.0420419984f, 0.157499999f, 0.603900015f, 0.375099987f, -0.365399987f, -0.851899981f,
+	0.00795300025f, 0.925500989f, -0.0447609983f, 0.155399993f, 0.602299988f, 0.37560001f, -0.367399991f, -0.850799978f,
+	0.0088320002f, 0.927682996f, -0.0453189984f, 0.156000003f, 0.601499975f, 0.3759f, -0.368699998f, -0.850099981f,
+	-0.0225489996f, 0.650632977f, -0.141240001f, 0.73269999f, 0.286599994f, -0.569800019f, -0.0179999992f, 0.82160002f,
+	-0.0306579992f, 0.649673998f, -0.146937996f, 0.731899977f, 0.291000009f, -0.573400021f, -0.0177999996f, 0.819100022f,
+	-0.025564f, 0.493075013f, -0.146775007f, 0.661300004f, 0.284200013f, -0.497500002f, 0.00520000001f, 0.867500007f,
+	-0.0157810003f, 0.493243992f, -0.141188994f, 0.66170001f, 0.279100001f, -0.497399986f, 0.00439999998f, 0.867500007f,
+	-0.042555999f, 0.227514997f, -0.147214994f, 0.540799975f, 0.282799989f, -0.588500023f, 0.0410000011f, 0.807500005f,
+	-0.0322909988f, 0.228327006f, -0.139723003f, 0.541499972f, 0.277099997f, -0.591099977f, 0.0412999988f, 0.805499971f,
+	-0.0f, 0.651040971f, -0.129374996f, 0.815599978f, 0.296200007f, 0.0037f, -1.0f, -0.00380000006f,
+	-0.0225489996f, 0.650632977f, -0.141240001f, 0.805299997f, 0.291000009f, 0.0599999987f, -0.997600019f, -0.0340999998f,
+	0.0222309995f, 0.650941014f, -0.140795007f, 0.825600028f, 0.290899992f, -0.0759999976f, -0.994099975f, -0.0773999989f,
+	0.0355850011f, 0.649374008f, -0.136731997f, 0.831700027f, 0.292699993f, -0.3917f, -0.9199f, -0.0185000002f,
+	-0.035197001f, 0.649578989f, -0.136656001f, 0.799600005f, 0.293199986f, 0.374300003f, -0.927299976f, 0.00659999996f,
+	-0.0306579992f, 0.649673998f, -0.146937996f, 0.801599979f, 0.288500011f, 0.101400003f, -0.994300008f, 0.0328000002f,
+	-0.0394610018f, 0.645196021f, -0.155210003f, 0.796899974f, 0.284700006f, 0.743499994f, -0.668299973f, 0.0241f,
+	-0.0347499996f, 0.648921013f, -0.156802997f, 0.799700022f, 0.284000009f, 0.344099998f, -0.937900007f, 0.0436000004f,
+	-0.0398630016f, 0.644971013f, -0.137594f, 0.796700001f, 0.292699993f, 0.771300018f, -0.636399984f, 0.0121999998f,
+	-0.021706f, 0.650507987f, -0.152368993f, 0.805599988f, 0.285899997f, 0.0886999965f, -0.995100021f, 0.0432000011f,
+	-0.000288999989f, 0.651832998f, -0.161567003f, 0.815299988f, 0.281599998f, 0.00829999987f, -0.995500028f, -0.0948000029f,
+	0.0230749995f, 0.650759995f, -0.152215004f, 0.825900018f, 0.285699993f, -0.0659999996f, -0.997799993f, 0.00179999997f,
+	0.0351990014f, 0.649784982f, -0.156809002f, 0.831399977f, 0.283600003f, -0.387800008f, -0.921700001f, -0.00829999987f,
+	0.0307330005f, 0.649707973f, -0.146396995f, 0.82950002f, 0.288300008f, -0.0750999972f, -0.997099996f, -0.0137999998f,
+	0.0410329998f, 0.643725991f, -0.138349995f, 0.835300028f, 0.291900009f, -0.832599998f, -0.55369997f, 0.0130000003f,
+	0.0402150005f, 0.644514024f, -0.155662f, 0.834699988f, 0.284099996f, -0.806500018f, -0.591300011f, -0.00579999993f,
+	0.0438500009f, 0.636877f, -0.138812006f, 0.83859998f, 0.291700006f, -0.954400003f, -0.298200011f, -0.0154999997f,
+	0.0445739999f, 0.636669993f, -0.155276f, 0.838800013f, 0.284299999f, -0.943400025f, -0.330199987f, -0.0310999993f,
+	0.0494720004f, 0.604250014f, -0.138402998f, 0.853600025f, 0.291900009f, -0.987699986f, -0.155599996f, -0.0121999998f,
+	0.0494720004f, 0.604250014f, -0.155039996f, 0.853600025f, 0.284399986f, -0.988799989f, -0.149399996f, -0.0f,
+	-0.0439409986f, 0.638121009f, -0.155328006f, 0.793099999f, 0.28459999f, 0.927600026f, -0.372299999f, 0.0299999993f,
+	-0.0447189994f, 0.637561977f, -0.138150007f, 0.792599976f, 0.292400002f, 0.92869997f, -0.369500011f, 0.0300999992f,
+	-0.0504570007f, 0.605668008f, -0.138455003f, 0.777999997f, 0.291999996f, 0.984099984f, -0.168500006f, 0.0560999997f,
+	-0.0496889986f, 0.604649007f, -0.153078005f, 0.777700007f, 0.285299987f, 0.984300017f, -0.164800003f, 0.0631999969f,
+	0.00903899968f, 0.346985012f, 0.0274039991f, 0.450599998f, 0.633700013f, -0.875899971f, 0.4296f, -0.219600007f,
+	0.00247499999f, 0.350169003f, 0.0568559989f, 0.440299988f, 0.642799973f, -0.833999991f, 0.542100012f, 0.102799997f,
+	0.00520099979f, 0.354321986f, 0.0570699982f, 0.441700011f, 0.644500017f, -0.834399998f, 0.524299979f, 0.1699f,
+	0.0109200003f, 0.352088988f, 0.029414f, 0.451499999f, 0.636200011f, -0.885399997f, 0.411500007f, -0.216299996f,
+	0.0186950006f, 0.347918987f, 0.082735002f, 0.432500005f, 0.654299974f, -0.611699998f, 0.42050001f, 0.670099974f,
+	0.0194710009f, 0.351577014f, 0.0811749995f, 0.434300005f, 0.654900014f, -0.64289999f, 0.415699989f, 0.643400013f,
+	0.0430339985f, 0.34830299f, 0.0968680009f, 0.428600013f, 0.666499972f, 0.0229000002f, 0.558799982f, 0.828999996f,
+	0.0430239998f, 0.353525013f, 0.0934460014f, 0.431400001f, 0.666599989f, 0.0438000001f, 0.547699988f, 0.835600019f,
+	0.0672499985f, 0.347867996f, 0.0825290009f, 0.431400001f, 0.678900003f, 0.580299973f, 0.626800001f, 0.519999981f,
+	0.0651360005f, 0.352629989f, 0.0791099966f, 0.434199989f, 0.678200006f, 0.629199982f, 0.609399974f, 0.4824f,
+	0.0775239989f, 0.347597003f, 0.0562920012f, 0.43900001f, 0.689199984f, 0.854900002f, 0.492399991f, 0.163399994f,
+	0.0752020031f, 0.352185994f, 0.0546130016f, 0.441199988f, 0.688000023f, 0.870400012f, 0.483099997f, 0.0944999978f,
+	0.074653998f, 0.349840999f, 0.0291760005f, 0.449099988f, 0.696399987f, 0.875699997f, 0.478700012f, -0.063000001f,
+	0.0715650022f, 0.355343997f, 0.0286740009f, 0.451200008f, 0.694400012f, 0.872699976f, 0.484100014f, -0.0634000003f,
+	-0.00903899968f, 0.346985012f, 0.0274039991f, 0.371199995f, 0.838100016f, 0.875899971f, 0.4296f, -0.219600007f,
+	-0.0109200003f, 0.352088988f, 0.029414f, 0.370299995f, 0.835600019f, 0.885399997f, 0.411500007f, -0.216299996f,
+	-0.00520099979f, 0.354321986f, 0.0570699982f, 0.380100012f, 0.827300012f, 0.834399998f, 0.524299979f, 0.1699f,
+	-0.00247499999f, 0.350169003f, 0.0568559989f, 0.381599993f, 0.828999996f, 0.833999991f, 0.542100012f, 0.102799997f,
+	-0.0186950006f, 0.347918987f, 0.082735002f, 0.389299989f, 0.817499995f, 0.611699998f, 0.42050001f, 0.670099974f,
+	-0.0194710009f, 0.351577014f, 0.0811749995f, 0.387499988f, 0.816999972f, 0.64289999f, 0.415699989f, 0.643299997f,
+	-0.0430339985f, 0.34830299f, 0.0968680009f, 0.39320001f, 0.805400014f, -0.0229000002f, 0.558799982f, 0.828999996f,
+	-0.0430239998f, 0.353525013f, 0.0934460014f, 0.390399992f, 0.805199981f, -0.0438000001f, 0.547699988f, 0.835600019f,
+	-0.0651360005f, 0.352629989f, 0.0791099966f, 0.387699991f, 0.793600023f, -0.629199982f, 0.609399974f, 0.4824f,
+	-0.0672499985f, 0.347867996f, 0.0825290009f, 0.390399992f, 0.792900026f, -0.580299973f, 0.626800001f, 0.519999981f,
+	-0.0752020031f, 0.352185994f, 0.0546130016f, 0.380600005f, 0.783900023f, -0.870400012f, 0.483099997f, 0.0944999978f,
+	-0.0775239989f, 0.347597003f, 0.0562920012f, 0.382800013f, 0.782599986f, -0.854900002f, 0.492399991f, 0.163399994f,
+	-0.074653998f, 0.349840999f, 0.0291760005f, 0.372700006f, 0.775399983f, -0.875699997f, 0.478700012f, -0.063000001f,
+	-0.0715650022f, 0.355343997f, 0.0286740009f, 0.370599985f, 0.777400017f, -0.872699976f, 0.484100014f, -0.0634000003f,
+	0.000269000011f, 0.221132994f, -0.0129789999f, 0.278200001f, 0.805700004f, 0.454100013f, 0.323100001f, 0.830299973f,
+	-0.000865000009f, 0.238667995f, -0.0213910006f, 0.280600011f, 0.797100008f, 0.778999984f, 0.311500013f, 0.544200003f,
+	-0.0030449999f, 0.237132996f, -0.0173909999f, 0.281800002f, 0.798799992f, 0.74119997f, 0.316799998f, 0.591799974f,
+	-0.00422299979f, 0.221111f, -0.0108890003f, 0.280200005f, 0.806599975f, 0.398400009f, 0.319599986f, 0.859700024f,
+	-0.086649999f, 0.72716701f, -0.108415999f, 0.0684999973f, 0.297800004f, 0.569299996f, -0.818000019f, 0.0820000023f,
+	-0.0419970006f, 0.746475995f, -0.133802995f, 0.0500000007f, 0.281800002f, 0.543900013f, -0.683300018f, 0.487100005f,
+	-0.0793680027f, 0.732795f, -0.0989559963f, 0.0711999983f, 0.291900009f, 0.603600025f, -0.791999996f, 0.0921000019f,
+	-0.096231997f, 0.718254983f, -0.0851520002f, 0.0803999975f, 0.300099999f, 0.559300005f, -0.828999996f, -0.00260000001f,
+	-0.120370999f, 0.701949f, -0.0816610008f, 0.0847999975f, 0.312999994f, 0.628700018f, -0.773299992f, 0.0821999982f,
+	-0.0458009988f, 0.736304998f, -0.134917006f, 0.0496000014f, 0.286300004f, 0.565599978f, -0.2958f, 0.769800007f,
+	-0.0272669997f, 0.747821987f, -0.142600998f, 0.0428000018f, 0.279799998f, 0.335299999f, -0.873899996f, 0.351900011f,
+	-0.0246229991f, 0.755393982f, -0.134772003f, 0.0441999994f, 0.2755f, 0.645699978f, -0.549899995f, 0.529799998f,
+	-0.0321669988f, 0.75523299f, -0.130030006f, 0.0487000011f, 0.276199996f, 0.522700012f, -0.573599994f, 0.630599976f,
+	-0.0501759984f, 0.752919972f, -0.112703003f, 0.0601000004f, 0.277999997f, 0.72420001f, -0.443100005f, 0.528299987f,
+	-0.0624120012f, 0.748368979f, -0.0841749981f, 0.0744000003f, 0.279399991f, 0.879700005f, -0.435000002f, 0.192200005f,
+	-0.0330779999f, 0.772880018f, -0.119047999f, 0.0522999987f, 0.267800003f, 0.451000005f, -0.336800009f, 0.826499999f,
+	-0.0183060002f, 0.761240005f, -0.141230002f, 0.0401999988f, 0.273499995f, 0.358399987f, -0.504800022f, 0.785300016f,
+	-0.0172320008f, 0.783069015f, -0.132467002f, 0.0399999991f, 0.262899995f, 0.543799996f, -0.466800004f, 0.697399974f,
+	-0.0205349997f, 0.779150009f, -0.118828997f, 0.0467999987f, 0.263300002f, 0.589100003f, -0.398799986f, 0.702799976f,
+	-0.0288970005f, 0.796916008f, -0.113922f, 0.0509000011f, 0.257299989f, -0.1303f, 0.00899999961f, 0.991400003f,
+	-0.0360249989f, 0.789990008f, -0.115751997f, 0.0542000011f, 0.260399997f, 0.171800002f, 0.103200004f, 0.979700029f,
+	-0.0472420007f, 0.778999984f, -0.105844997f, 0.0615999997f, 0.264899999f, 0.704999983f, 0.124600001f, 0.698199987f,
+	-0.0616549999f, 0.771995008f, -0.0821830034f, 0.0749000013f, 0.267800003f, 0.895299971f, 0.253600001f, 0.366299987f,
+	-0.0675730035f, 0.73783499f, -0.0675299987f, 0.0828000009f, 0.283300012f, 0.766300023f, -0.61559999f, 0.183899999f,
+	-0.0394660011f, 0.806881011f, -0.121738002f, 0.0533000007f, 0.252600014f, -0.218999997f, 0.765799999f, 0.604600012f,
+	-0.0580889992f, 0.797670007f, -0.109480999f, 0.0636000037f, 0.254200011f, 0.4296f, 0.629700005f, 0.647300005f,
+	-0.0344530009f, 0.810434997f, -0.138524994f, 0.0467000008f, 0.247899994f, -0.377299994f, 0.913299978f, -0.153300002f,
+	-0.049922999f, 0.808959007f, -0.130824998f, 0.054299999f, 0.246399999f, 0.0816000029f, 0.987900019f, 0.131999999f,
+	-0.0511309989f, 0.808984995f, -0.128252998f, 0.0551000014f, 0.246999994f, 0.227400005f, 0.846199989f, 0.481900007f,
+	-0.0865620002f, 0.806640029f, -0.100479998f, 0.0746999979f, 0.245399997f, 0.465600014f, 0.77700001f, 0.423700005f,
+	-0.076462999f, 0.797025979f, -0.0904119983f, 0.0754999965f, 0.253399998f, 0.586499989f, 0.723699987f, 0.363599986f,
+	-0.0546090007f, 0.816160977f, -0.129393995f, 0.0551999994f, 0.243799999f, 0.498600006f, 0.36649999f, 0.78549999f,
+	-0.0908370018f, 0.812026024f, -0.10447f, 0.074500002f, 0.2412f, 0.493299991f, 0.724699974f, 0.481099993f,
+	-0.101060003f, 0.811110973f, -0.0875350013f, 0.0830999985f, 0.242300004f, 0.437099993f, 0.856100023f, 0.275700003f,
+	-0.0834570006f, 0.799057007f, -0.0746909976f, 0.0833000019f, 0.253399998f, 0.585699975f, 0.773000002f, 0.243799999f,
+	-0.114522003f, 0.813552022f, -0.075914003f, 0.0910999998f, 0.240099996f, 0.524200022f, 0.77700001f, 0.3486f,
+	-0.132146999f, 0.824958026f, -0.0706859976f, 0.0979000032f, 0.2333f, 0.574100018f, 0.792299986f, 0.206799999f,
+	-0.127871007f, 0.820903003f, -0.0623230003f, 0.0997999981f, 0.237299994f, 0.56279999f, 0.819299996f, 0.1096f,
+	-0.0947090015f, 0.801467001f, -0.0636940002f, 0.0901999995f, 0.25150001f, 0.467099994f, 0.833400011f, 0.295300007f,
+	-0.0718759969f, 0.785795987f, -0.0681279972f, 0.0830999985f, 0.261500001f, 0.778100014f, 0.582400024f, 0.235400006f,
+	-0.0770189986f, 0.784072995f, -0.0568160005f, 0.0886000022f, 0.262400001f, 0.722800016f, 0.547599971f, 0.421600014f,
+	-0.0625080019f, 0.761830986f, -0.0639740005f, 0.0829999968f, 0.272700012f, 0.959200025f, 0.0582999997f, 0.27669999f,
+	-0.0670190006f, 0.759006023f, -0.0547580011f, 0.0873999968f, 0.273999989f, 0.90140003f, 0.0119000003f, 0.432799995f,
+	-0.0716790035f, 0.739894986f, -0.0585899986f, 0.0868000016f, 0.282700002f, 0.730499983f, -0.549000025f, 0.406100005f,
+	-0.0977440029f, 0.717225015f, -0.0748889968f, 0.0854000002f, 0.299699992f, 0.511200011f, -0.859399974f, -0.0109999999f,
+	-0.105792999f, 0.715171993f, -0.0795049965f, 0.0843999982f, 0.303900003f, 0.514100015f, -0.79549998f, 0.320600003f,
+	-0.116314001f, 0.706090987f, -0.0713239983f, 0.0890000015f, 0.309599996f, 0.668600023f, -0.742799997f, 0.0353000015f,
+	0.0157810003f, 0.493243992f, -0.141188994f, 0.624100029f, 0.324099988f, 0.471399993f, 0.00889999978f, 0.881900012f,
+	0.0273400005f, 0.49317801f, -0.147338003f, 0.624599993f, 0.330000013f, 0.470600009f, 0.00970000029f, 0.882300019f,
+	0.0307330005f, 0.649707973f, -0.146396995f, 0.55400002f, 0.336400002f, 0.543799996f, -0.0240000002f, 0.83890003f,
+	0.0222309995f, 0.650941014f, -0.140795007f, 0.55309999f, 0.331800014f, 0.547500014f, -0.0244999994f, 0.836399972f,
+	0.0322909988f, 0.228327006f, -0.139723003f, 0.744300008f, 0.321500003f, 0.537599981f, 0.0342999995f, 0.842499971f,
+	0.0421230011f, 0.228530005f, -0.146038994f, 0.744599998f, 0.326799989f, 0.539699972f, 0.0342999995f, 0.841199994f,
+	-0.088330999f, 0.413450003f, 0.0189319998f, 0.398000002f, 0.94569999f, -0.201800004f, 0.970399976f, -0.1329f,
+	-0.0423570015f, 0.423799992f, 0.0209810007f, 0.398400009f, 0.967100024f, 0.0203000009f, 0.985700011f, -0.167400002f,
+	-0.0426819995f, 0.419131011f, -0.00296700001f, 0.387400001f, 0.966499984f, 0.0291000009f, 0.986299992f, -0.162400007f,
+	-0.0781069994f, 0.413724989f, 0.00312600005f, 0.390700012f, 0.950100005f, -0.165299997f, 0.98210001f, -0.0899000019f,
+	-0.092102997f, 0.416711986f, 0.0489609987f, 0.41170001f, 0.944500029f, -0.208299994f, 0.97240001f, -0.105499998f,
+	-0.0430249982f, 0.427134991f, 0.0495340005f, 0.411300004f, 0.967299998f, -0.0148999998f, 0.994000018f, -0.1083f,
+	0.00682500005f, 0.409381002f, 0.0200520009f, 0.396400005f, 0.990199983f, 0.248999998f, 0.951099992f, -0.182500005f,
+	0.0101089999f, 0.416846007f, 0.0493110009f, 0.410299987f, 0.99180001f, 0.220799997f, 0.959399998f, -0.175600007f,
+	-0.000762999989f, 0.41109401f, 0.0037130001f, 0.389200002f, 0.986100018f, 0.185699999f, 0.982500017f, 0.0167999994f,
+	-0.00875599962f, 0.424252987f, 0.0812899992f, 0.425300002f, 0.983299971f, 0.171800002f, 0.983200014f, -0.0612000003f,
+	-0.076173f, 0.422533005f, 0.0805680007f, 0.425799996f, 0.952400029f, -0.206599995f, 0.977599978f, -0.0395999998f,
+	-0.0429649986f, 0.429526001f, 0.0724520013f, 0.421700001f, 0.967599988f, -0.0262000002f, 0.999199986f, -0.0306000002f,
+	-0.0431249999f, 0.427688003f, 0.0992190018f, 0.433899999f, 0.967800021f, -0.0270000007f, 0.997300029f, 0.0683000013f,
+	0.088330999f, 0.413450003f, 0.0189319998f, 0.424699992f, 0.759000003f, 0.201800004f, 0.970399976f, -0.1329f,
+	0.0781069994f, 0.413724989f, 0.00312600005f, 0.432000011f, 0.754499972f, 0.165299997f, 0.98210001f, -0.0899000019f,
+	0.0426819995f, 0.419131011f, -0.00296700001f, 0.434899986f, 0.738200009f, -0.0291000009f, 0.986299992f, -0.162400007f,
+	0.0423570015f, 0.423799992f, 0.0209810007f, 0.423900008f, 0.737699986f, -0.0203000009f, 0.985700011f, -0.167400002f,
+	0.092102997f, 0.416711986f, 0.0489609987f, 0.410899997f, 0.760200024f, 0.208299994f, 0.97240001f, -0.105499998f,
+	-0.00682500005f, 0.409381002f, 0.0200520009f, 0.426099986f, 0.71450001f, -0.248999998f, 0.951099992f, -0.182500005f,
+	0.000762999989f, 0.41109401f, 0.0037130001f, 0.433299989f, 0.718599975f, -0.185699999f, 0.982500017f, 0.0167999994f,
+	0.0430249982f, 0.427134991f, 0.0495340005f, 0.411000013f, 0.737500012f, 0.0148999998f, 0.994000018f, -0.1083f,
+	-0.0101089999f, 0.416846007f, 0.0493110009f, 0.412299991f, 0.712899983f, -0.220799997f, 0.959399998f, -0.175600007f,
+	0.076173f, 0.422533005f, 0.0805680007f, 0.396699995f, 0.752399981f, 0.206599995f, 0.977599978f, -0.0395999998f,
+	0.0429649986f, 0.429526001f, 0.0724520013f, 0.400700003f, 0.737100005f, 0.0262000002f, 0.999199986f, -0.0306000002f,
+	0.00875599962f, 0.424252987f, 0.0812899992f, 0.397100002f, 0.721400023f, -0.171800002f, 0.983200014f, -0.0612000003f,
+	0.0431249999f, 0.427688003f, 0.0992190018f, 0.388599992f, 0.736999989f, 0.0270000007f, 0.997300029f, 0.0683000013f,
+	-0.0664850026f, 0.220676005f, -0.0787369981f, 0.381700009f, 0.96390003f, -0.524399996f, 0.2139f, -0.824199975f,
+	-0.0839549974f, 0.219995007f, -0.0574669987f, 0.377299994f, 0.976000011f, -0.855599999f, 0.167300001f, -0.489800006f,
+	-0.0817639977f, 0.233019993f, -0.0568449982f, 0.371899992f, 0.97329998f, -0.84859997f, 0.305200011f, -0.432200015f,
+	-0.0663330033f, 0.238767996f, -0.0744310021f, 0.373400003f, 0.962899983f, -0.513999999f, 0.395300001f, -0.761200011f,
+	-0.0422860011f, 0.239418998f, -0.0806680024f, 0.374300003f, 0.952199996f, 0.0243999995f, 0.453500003f, -0.890900016f,
+	-0.0421259999f, 0.221300006f, -0.0861779973f, 0.382800013f, 0.952000022f, 0.00490000006f, 0.291000009f, -0.956700027f,
+	-0.0902649984f, 0.220442995f, -0.0407189988f, 0.373100013f, 0.983200014f, -0.944299996f, 0.296900004f, -0.142100006f,
+	-0.0869870037f, 0.230189994f, -0.0395819992f, 0.368999988f, 0.98089999f, -0.925199986f, 0.361400008f, -0.115800001f,
+	-0.0817070007f, 0.243974f, -0.0333180018f, 0.361900002f, 0.979200006f, -0.920300007f, 0.377799988f, -0.101300001f,
+	-0.0761900023f, 0.251327008f, -0.0484340005f, 0.362699986f, 0.971199989f, -0.822600007f, 0.441000015f, -0.358999997f,
+	-0.0620339997f, 0.257155001f, -0.0609279983f, 0.363000005f, 0.961899996f, -0.444700003f, 0.601499975f, -0.663699985f,
+	-0.0422540009f, 0.258127987f, -0.0649259984f, 0.363299996f, 0.952300012f, 0.00319999992f, 0.64380002f, -0.765200019f,
+	-0.0225079991f, 0.257194996f, -0.0607599989f, 0.362599999f, 0.942799985f, 0.498600006f, 0.510699987f, -0.700399995f,
+	-0.0215360001f, 0.237655997f, -0.0732569993f, 0.373199999f, 0.942600012f, 0.535300016f, 0.409799993f, -0.738600016f,
+	-0.0178299993f, 0.220723003f, -0.078530997f, 0.381099999f, 0.940299988f, 0.565400004f, 0.32069999f, -0.759899974f,
+	-0.00844599959f, 0.251396f, -0.0481459983f, 0.362100005f, 0.933700025f, 0.844299972f, 0.319700003f, -0.430000007f,
+	-0.00500599993f, 0.231710002f, -0.0549929999f, 0.371399999f, 0.931400001f, 0.879899979f, 0.233999997f, -0.413500011f,
+	-0.00500599993f, 0.221716002f, -0.0581750013f, 0.376100004f, 0.930599988f, 0.887600005f, 0.139699996f, -0.438800007f,
+	-0.00304200011f, 0.244053006f, -0.0329839997f, 0.361600012f, 0.925599992f, 0.958899975f, 0.233799994f, -0.160999998f,
+	3.99999999e-06f, 0.228469998f, -0.0378069989f, 0.368800014f, 0.923699975f, 0.978600025f, 0.165099993f, -0.122500002f,
+	0.000743000011f, 0.220869005f, -0.0401559994f, 0.372399986f, 0.922800004f, 0.981000006f, 0.124799997f, -0.148599997f,
+	-0.000865000009f, 0.238667995f, -0.0213910006f, 0.361000001f, 0.919700027f, 0.99119997f, 0.129600003f, -0.0281000007f,
+	0.000269000011f, 0.221132994f, -0.0129789999f, 0.36590001f, 0.912299991f, 0.997099996f, 0.0751999989f, 0.0115f,
+	-0.0839719996f, 0.238582999f, -0.0217439998f, 0.360900015f, 0.985000014f, -0.939700007f, 0.341899991f, -0.00200000009f,
+	-0.0907580033f, 0.218949005f, -0.0132670002f, 0.3662f, 0.993700027f, -0.945599973f, 0.325399995f, 0.00350000011f,
+	-0.0957750008f, 0.661279976f, -0.0292680003f, 0.0427000001f, 0.951399982f, 0.749499977f, 0.0388999991f, 0.660899997f,
+	-0.0822999999f, 0.686080992f, -0.0347459987f, 0.0419999994f, 0.953700006f, 0.720399976f, -0.221000001f, 0.657500029f,
+	-0.0927560031f, 0.702286005f, -0.0171189997f, 0.0438000001f, 0.954900026f, 0.840900004f, -0.128399998f, 0.52579999f,
+	-0.108268f, 0.662599981f, -0.0124589996f, 0.0445000008f, 0.951300025f, 0.870400012f, -0.0379000008f, 0.49090001f,
+	-0.083145f, 0.661745012f, -0.0423649997f, 0.0412000008f, 0.951699972f, 0.75999999f, 0.184200004f, 0.623300016f,
+	-0.0787649974f, 0.656632006f, -0.0426310003f, 0.0408000015f, 0.951300025f, 0.560500026f, 0.444000006f, 0.699000001f,
+	-0.106648996f, 0.650398016f, -0.0101220002f, 0.0445000008f, 0.950100005f, 0.854900002f, 0.0555000007f, 0.515799999f,
+	-0.0910679996f, 0.647982001f, -0.028345f, 0.0423999988f, 0.950200021f, 0.685199976f, 0.0926999971f, 0.722500026f,
+	-0.116209f, 0.662819982f, 0.00629799999f, 0.0461000018f, 0.951200008f, 0.998399973f, -0.0403000005f, -0.0390999988f,
+	-0.113618001f, 0.649653971f, 0.00524700014f, 0.0460000001f, 0.949999988f, 0.999499977f, 0.0260000005f, -0.0195000004f,
+	-0.114583999f, 0.562629998f, -0.0173669998f, 0.0436000004f, 0.942399979f, 0.814999998f, -0.236699998f, 0.528999984f,
+	-0.0951519981f, 0.575715005f, -0.0368710011f, 0.0412999988f, 0.943899989f, 0.718800008f, -0.225799993f, 0.657599986f,
+	-0.0649449974f, 0.646874011f, -0.0458590016f, 0.0395999998f, 0.950500011f, 0.557299972f, 0.0195000004f, 0.8301f,
+	-0.0711819977f, 0.608129978f, -0.0501159988f, 0.0394000001f, 0.946699977f, 0.6153f, -0.165099993f, 0.770799994f,
+	-0.0877119973f, 0.54617101f, -0.0574770011f, 0.0392000005f, 0.941500008f, 0.672999978f, -0.301600009f, 0.675400019f,
+	-0.121184997f, 0.530948997f, -0.0277110003f, 0.0432000011f, 0.939499974f, 0.81099999f, -0.340000004f, 0.476000011f,
+	-0.112977996f, 0.534888029f, -0.0388620012f, 0.0408999994f, 0.940400004f, 0.762600005f, -0.359200001f, 0.537899971f,
+	-0.131472006f, 0.526287973f, -0.0125080002f, 0.0438000001f, 0.939199984f, 0.860800028f, -0.350699991f, 0.368999988f,
+	-0.140263006f, 0.521661997f, 0.00604300015f, 0.0461000018f, 0.938399971f, 0.935800016f, -0.352499992f, -0.00449999981f,
+	-0.128625005f, 0.554982007f, 0.00388099998f, 0.0458999984f, 0.941600025f, 0.962199986f, -0.267399997f, 0.0524999984f,
+	-0.0999519974f, 0.649731994f, 0.0307039991f, 0.0485999994f, 0.950200021f, 0.773699999f, 0.0678000003f, -0.629899979f,
+	-0.116910003f, 0.558896005f, 0.0260240007f, 0.0482000001f, 0.942099988f, 0.830299973f, -0.255600005f, -0.495299995f,
+	-0.127793998f, 0.528330028f, 0.0301559996f, 0.0483999997f, 0.939199984f, 0.835600019f, -0.343899995f, -0.42840001f,
+	-0.095968999f, 0.568745971f, 0.0491530001f, 0.0509000011f, 0.943300009f, 0.715399981f, -0.252499998f, -0.65140003f,
+	-0.0724119991f, 0.599856973f, 0.0614750013f, 0.0527000017f, 0.946399987f, 0.620000005f, -0.181099996f, -0.763400018f,
+	-0.0652500018f, 0.646323979f, 0.0563619994f, 0.0524000004f, 0.950500011f, 0.596499979f, 0.0392000005f, -0.801599979f,
+	-0.103951998f, 0.661404014f, 0.0301970001f, 0.0483000018f, 0.951300025f, 0.826099992f, 0.0186000001f, -0.563300014f,
+	-0.0788519979f, 0.656620979f, 0.0535710007f, 0.0511999987f, 0.951399982f, 0.593800008f, 0.460500002f, -0.659799993f,
+	-0.105531f, 0.538773f, 0.0570579991f, 0.0513000004f, 0.940500021f, 0.713f, -0.372799993f, -0.593800008f,
+	-0.0877399966f, 0.546223998f, 0.0683559999f, 0.0529000014f, 0.941500008f, 0.647300005f, -0.343699992f, -0.680400014f,
+	-0.0833529979f, 0.663227975f, 0.0528860018f, 0.0511000007f, 0.951900005f, 0.704699993f, 0.259000003f, -0.660600007f,
+	-0.102519996f, 0.71094501f, 0.00639000023f, 0.0460000001f, 0.955600023f, 0.995500028f, -0.0918999985f, -0.0234999992f,
+	-0.0917719975f, 0.703435004f, 0.0292470008f, 0.0483000018f, 0.9551f, 0.830500007f, -0.120399997f, -0.543900013f,
+	-0.0770319998f, 0.690141976f, 0.0489140004f, 0.0505000018f, 0.954299986f, 0.709599972f, -0.176300004f, -0.682200015f,
+	-0.0832260028f, 0.668033004f, 0.0538170002f, 0.0509000011f, 0.952400029f, 0.763300002f, -0.192399994f, -0.616699994f,
+	-0.091516003f, 0.724444985f, -0.0190750007f, 0.0432000011f, 0.95660001f, 0.883599997f, 0.0183000006f, 0.467799991f,
+	-0.104673997f, 0.73517698f, 0.00604300015f, 0.0458999984f, 0.957799971f, 0.995999992f, 0.0883999988f, -0.0092000002f,
+	-0.0881339982f, 0.72161299f, 0.0348760001f, 0.0487000011f, 0.956799984f, 0.849399984f, 0.0046000001f, -0.527700007f,
+	-0.0725559965f, 0.702813029f, 0.0529979989f, 0.0509000011f, 0.955500007f, 0.719099998f, -0.0303000007f, -0.694299996f,
+	-0.079896003f, 0.672456026f, 0.055594001f, 0.0513000004f, 0.953199983f, 0.702700019f, -0.348100007f, -0.620500028f,
+	-0.0628739968f, 0.685477018f, 0.0625239983f, 0.0522999987f, 0.954299986f, 0.636900008f, -0.221599996f, -0.738399982f,
+	-0.086668998f, 0.720025003f, -0.0263689999f, 0.0425999984f, 0.956200004f, 0.805599988f, 0.0320999995f, 0.591700017f,
+	-0.0748189986f, 0.705969989f, -0.039551001f, 0.0410999991f, 0.955200016f, 0.74119997f, -0.0623999983f, 0.668299973f,
+	-0.0630260035f, 0.685624003f, -0.0519189984f, 0.0397000015f, 0.95389998f, 0.643400013f, -0.235699996f, 0.728399992f,
+	-0.0758949965f, 0.676123023f, -0.0466930009f, 0.0406999998f, 0.953000009f, 0.624899983f, -0.4014f, 0.66960001f,
+	-0.0825809985f, 0.669468999f, -0.0436829999f, 0.0412000008f, 0.952300012f, 0.948400021f, -0.162499994f, 0.272300005f,
+	0.0957750008f, 0.661279976f, -0.0292680003f, 0.0111999996f, 0.905399978f, -0.750100017f, 0.0603f, 0.658500016f,
+	0.108268f, 0.662599981f, -0.0124589996f, 0.0129000004f, 0.905300021f, -0.870400012f, -0.0379000008f, 0.49090001f,
+	0.0927560031f, 0.702286005f, -0.0171189997f, 0.0122999996f, 0.909099996f, -0.837700009f, -0.145099998f, 0.526499987f,
+	0.0822999999f, 0.686080992f, -0.0347459987f, 0.0103000002f, 0.907800019f, -0.717899978f, -0.240400001f, 0.653400004f,
+	0.0825809985f, 0.669468999f, -0.0436829999f, 0.00960000046f, 0.906400025f, -0.742699981f, -0.226699993f, 0.630100012f,
+	0.0831440017f, 0.661745012f, -0.0423649997f, 0.00960000046f, 0.905700028f, -0.680199981f, 0.304500014f, 0.666800022f,
+	0.0787660033f, 0.656632006f, -0.0426310003f, 0.0092000002f, 0.905300021f, -0.585500002f, 0.610899985f, 0.532800019f,
+	0.106648996f, 0.650398016f, -0.0101220002f, 0.0130000003f, 0.904100001f, -0.854900002f, 0.0555000007f, 0.515799999f,
+	0.0910679996f, 0.647982001f, -0.028345f, 0.0107000005f, 0.904200017f, -0.667800009f, 0.0637999997f, 0.741599977f,
+	0.0649449974f, 0.646874011f, -0.0458590016f, 0.00789999962f, 0.904500008f, -0.578100026f, 0.0f, 0.815999985f,
+	0.116209f, 0.662819982f, 0.00629799999f, 0.0146000003f, 0.905200005f, -0.998399973f, -0.0403000005f, -0.0390999988f,
+	0.113618001f, 0.649653971f, 0.00524700014f, 0.0146000003f, 0.903900027f, -0.999499977f, 0.0260000005f, -0.0195000004f,
+	0.114583999f, 0.562629998f, -0.0173669998f, 0.0120999999f, 0.896099985f, -0.81309998f, -0.230399996f, 0.534600019f,
+	0.0951519981f, 0.575715005f, -0.0368710011f, 0.00970000029f, 0.897599995f, -0.719900012f, -0.224299997f, 0.656799972f,
+	0.0694549978f, 0.620526016f, -0.0490490012f, 0.00779999979f, 0.90200001f, -0.520299971f, -0.2139f, 0.826799989f,
+	0.0730580017f, 0.612690985f, -0.0489440002f, 0.00789999962f, 0.901300013f, -0.588500023f, -0.143199995f, 0.795700014f,
+	0.0721189976f, 0.604258001f, -0.0504520014f, 0.00769999996f, 0.9005f, -0.612999976f, -0.123400003f, 0.780399978f,
+	0.0877119973f, 0.54617101f, -0.0574770011f, 0.00749999983f, 0.895099998f, -0.649200022f, -0.318300009f, 0.690800011f,
+	0.105821997f, 0.538230002f, -0.0455899984f, 0.0092000002f, 0.893999994f, -0.728100002f, -0.344999999f, 0.592400014f,
+	0.123435996f, 0.530314028f, -0.0237290002f, 0.0116999997f, 0.893000007f, -0.791199982f, -0.325300008f, 0.51789999f,
+	0.127847999f, 0.528237998f, -0.0181329995f, 0.0122999996f, 0.892700016f, -0.847299993f, -0.335900009f, 0.41139999f,
+	0.140223995f, 0.521723986f, 0.00604300015f, 0.0147000002f, 0.891900003f, -0.937900007f, -0.346899986f, 0.00109999999f,
+	0.128625005f, 0.554982007f, 0.00388099998f, 0.0143999998f, 0.895200014f, -0.962199986f, -0.267199993f, 0.0527999997f,
+	0.0999519974f, 0.649731994f, 0.0307039991f, 0.0172000006f, 0.904200017f, -0.752699971f, 0.0377000012f, -0.657299995f,
+	0.116910003f, 0.558896005f, 0.0260240007f, 0.0167999994f, 0.895699978f, -0.83099997f, -0.257299989f, -0.493200004f,
+	0.127811998f, 0.528298974f, 0.0301770009f, 0.0170000009f, 0.892700016f, -0.837100029f, -0.344300002f, -0.425099999f,
+	0.095968999f, 0.568745971f, 0.0491530001f, 0.0196000002f, 0.897000015f, -0.714299977f, -0.255899996f, -0.65140003f,
+	0.0724119991f, 0.599856973f, 0.0614750013f, 0.0215000007f, 0.900200009f, -0.620599985f, -0.180399999f, -0.763100028f,
+	0.0648119971f, 0.646592975f, 0.0568070002f, 0.0211999994f, 0.904399991f, -0.619099975f, 0.0287999995f, -0.784799993f,
+	0.103951998f, 0.661404014f, 0.0301970001f, 0.0168999992f, 0.905300021f, -0.815299988f, 0.0311999992f, -0.578199983f,
+	0.105821997f, 0.538230002f, 0.0576759987f, 0.0199999996f, 0.893999994f, -0.710099995f, -0.380600005f, -0.592400014f,
+	0.0877399966f, 0.546223998f, 0.0683559999f, 0.0218000002f, 0.895099998f, -0.638199985f, -0.351099998f, -0.685199976f,
+	0.102519996f, 0.71094501f, 0.00639000023f, 0.0146000003f, 0.909699976f, -0.995299995f, -0.0956000015f, -0.0171000008f,
+	0.0917719975f, 0.703435004f, 0.0292470008f, 0.0168999992f, 0.909300029f, -0.830500007f, -0.120399997f, -0.543900013f,
+	0.0770319998f, 0.690141976f, 0.0489140004f, 0.0192000009f, 0.908399999f, -0.710600019f, -0.182600006f, -0.679499984f,
+	0.0827199966f, 0.669184029f, 0.0544009991f, 0.0196000002f, 0.906499982f, -0.747200012f, -0.132200003f, -0.65140003f,
+	0.0788519979f, 0.656621993f, 0.0535719991f, 0.0199999996f, 0.905300021f, -0.629400015f, 0.531099975f, -0.567300022f,
+	0.104673997f, 0.73517698f, 0.00604300015f, 0.0143999998f, 0.912f, -0.996100008f, 0.0885000005f, -0.00240000011f,
+	0.0886709988f, 0.722175002f, -0.0231069997f, 0.0116999997f, 0.91079998f, -0.854799986f, 0.0137f, 0.518700004f,
+	0.0881339982f, 0.72161299f, 0.0348760001f, 0.0173000004f, 0.911000013f, -0.849399984f, 0.0046000001f, -0.527700007f,
+	0.0728939995f, 0.703309f, -0.0417230017f, 0.00949999969f, 0.909399986f, -0.730000019f, -0.0760999992f, 0.679199994f,
+	0.0630249977f, 0.685624003f, -0.0519189984f, 0.00800000038f, 0.907999992f, -0.644599974f, -0.228499994f, 0.729600012f,
+	0.0758949965f, 0.676123023f, -0.0466930009f, 0.00910000037f, 0.907000005f, -0.624899983f, -0.4014f, 0.66960001f,
+	0.0725559965f, 0.702813029f, 0.0529979989f, 0.0196000002f, 0.909600019f, -0.719099998f, -0.0303000007f, -0.694299996f,
+	0.0628750026f, 0.685477018f, 0.0625239983f, 0.0210999995f, 0.908399999f, -0.630999982f, -0.238499999f, -0.738200009f,
+	0.0758899972f, 0.676113009f, 0.0575320013f, 0.0200999994f, 0.907199979f, -0.62349999f, -0.371699989f, -0.68779999f,
+	-0.0204990003f, 0.734988987f, -0.134165004f, 0.156900004f, 0.56129998f, -0.801599979f, 0.497799993f, 0.331099987f,
+	-0.023604f, 0.723806024f, -0.137336001f, 0.160600007f, 0.565400004f, -0.952300012f, -0.188700005f, 0.239899993f,
+	-0.0258179996f, 0.728190005f, -0.134461001f, 0.158000007f, 0.565100014f, -0.970300019f, 0.0326000005f, -0.239700004f,
+	-0.0183819998f, 0.723891973f, -0.131210998f, 0.159600005f, 0.569000006f, -0.268700004f, -0.610899985f, 0.744700015f,
+	-0.0246740002f, 0.727391005f, -0.129351005f, 0.156800002f, 0.566999972f, -0.85799998f, -0.252999991f, 0.446999997f,
+	-0.0203380007f, 0.727003992f, -0.125979006f, 0.1567f, 0.569500029f, -0.323700011f, -0.377999991f, 0.867399991f,
+	0.0664850026f, 0.220676005f, -0.0787369981f, 0.393400013f, 0.716899991f, 0.524399996f, 0.2139f, -0.824199975f,
+	0.0663330033f, 0.238767996f, -0.0744310021f, 0.385600001f, 0.714399993f, 0.513999999f, 0.395300001f, -0.761200011f,
+	0.0817639977f, 0.233019993f, -0.0568449982f, 0.381900012f, 0.724300027f, 0.84859997f, 0.305200011f, -0.432200015f,
+	0.0839549974f, 0.219995007f, -0.0574669987f, 0.386799991f, 0.727999985f, 0.855599999f, 0.167300001f, -0.489800006f,
+	0.0421259999f, 0.221300006f, -0.0861779973f, 0.396899998f, 0.705600023f, -0.0173000004f, 0.291000009f, -0.95660001f,
+	0.0422860011f, 0.239418998f, -0.0806680024f, 0.388700008f, 0.704100013f, -0.0339000002f, 0.453399986f, -0.890699983f,
+	0.0620339997f, 0.257155001f, -0.0609290004f, 0.375699997f, 0.711399972f, 0.444700003f, 0.601499975f, -0.663699985f,
+	0.0761900023f, 0.251327008f, -0.0484340005f, 0.373299986f, 0.720200002f, 0.822600007f, 0.441000015f, -0.358999997f,
+	0.0869870037f, 0.230189994f, -0.0395819992f, 0.377400011f, 0.731100023f, 0.925199986f, 0.361400008f, -0.115800001f,
+	0.0902649984f, 0.220442995f, -0.0407189988f, 0.381099999f, 0.734300017f, 0.944299996f, 0.296900004f, -0.142100006f,
+	0.0817070007f, 0.243974f, -0.0333180018f, 0.370700002f, 0.727900028f, 0.920300007f, 0.377799988f, -0.101300001f,
+	0.0907580033f, 0.218949005f, -0.0132670002f, 0.371899992f, 0.742999971f, 0.945599973f, 0.325399995f, 0.00350000011f,
+	0.0839719996f, 0.238582999f, -0.0217439998f, 0.368499994f, 0.733299971f, 0.939700007f, 0.341899991f, -0.00200000009f,
+	0.0422540009f, 0.258127987f, -0.0649259984f, 0.377900004f, 0.702099979f, -0.0239000004f, 0.643599987f, -0.764999986f,
+	0.0228610002f, 0.256363988f, -0.0603929982f, 0.379500002f, 0.692700028f, -0.526799977f, 0.523699999f, -0.669499993f,
+	0.0215360001f, 0.237655997f, -0.0732569993f, 0.389800012f, 0.694599986f, -0.539900005f, 0.408100009f, -0.736199975f,
+	0.0185310002f, 0.221458003f, -0.0776230022f, 0.397399992f, 0.694100022f, -0.569299996f, 0.290800005f, -0.768999994f,
+	0.00992500037f, 0.250957012f, -0.047265999f, 0.380800009f, 0.683700025f, -0.840799987f, 0.37650001f, -0.388999999f,
+	0.00500599993f, 0.231710002f, -0.0549929999f, 0.390599996f, 0.683399975f, -0.873199999f, 0.2685f, -0.406699985f,
+	0.00500599993f, 0.221716002f, -0.0581750013f, 0.395300001f, 0.683600008f, -0.876999974f, 0.145699993f, -0.457800001f,
+	-3.99999999e-06f, 0.228469998f, -0.0378069989f, 0.389800012f, 0.675400019f, -0.971000016f, 0.214399993f, -0.105499998f,
+	0.00439500017f, 0.243362993f, -0.032354001f, 0.382200003f, 0.675599992f, -0.943300009f, 0.311399996f, -0.115199998f,
+	-0.000743000011f, 0.220869005f, -0.0401559994f, 0.393400013f, 0.675300002f, -0.981000006f, 0.124799997f, -0.148599997f,
+	-0.000269000011f, 0.221132994f, -0.0129789999f, 0.389200002f, 0.663699985f, -0.986100018f, 0.161699995f, 0.0372000001f,
+	0.00253399997f, 0.237865999f, -0.0212709997f, 0.383100003f, 0.669799984f, -0.973399997f, 0.228400007f, 0.0196000002f,
+	-0.00532299979f, 0.265563011f, 0.015164f, 0.474099994f, 0.906499982f, 0.918900013f, 0.383300006f, -0.0935999975f,
+	-0.0065390002f, 0.268200994f, 0.00801199954f, 0.471700013f, 0.908999979f, 0.926500022f, 0.376199991f, 0.00999999978f,
+	-0.0120780002f, 0.280761003f, 0.013429f, 0.466699988f, 0.904600024f, 0.872699976f, 0.34889999f, -0.341699988f,
+	-0.00819199998f, 0.279983014f, 0.0197640005f, 0.468699992f, 0.90200001f, 0.826099992f, 0.313699991f, -0.468199998f,
+	0.000315999991f, 0.250741005f, -0.00303300004f, 0.477899998f, 0.916700006f, 0.96359998f, 0.207100004f, -0.169300005f,
+	-0.00136999995f, 0.258938015f, -0.00409599999f, 0.474099994f, 0.915899992f, 0.974300027f, 0.198200002f, -0.106899999f,
+	-0.00788099971f, 0.255804002f, -0.0177200008f, 0.472600013f, 0.922699988f, 0.809599996f, 0.270999998f, -0.520699978f,
+	-0.00793899968f, 0.26176399f, -0.0149769997f, 0.470600009f, 0.920599997f, 0.801199973f, 0.256599993f, -0.540600002f,
+	-0.0212609991f, 0.262124002f, -0.034616001f, 0.465900004f, 0.930400014f, 0.645799994f, 0.581499994f, -0.494800001f,
+	-0.0200420003f, 0.267677009f, -0.026455f, 0.464599997f, 0.925999999f, 0.70539999f, 0.512799978f, -0.489399999f,
+	-0.0443050005f, 0.268182993f, -0.0526250005f, 0.45629999f, 0.939999998f, 0.577700019f, 0.620299995f, -0.530499995f,
+	-0.0436200015f, 0.274798006f, -0.0441460013f, 0.45449999f, 0.935400009f, 0.577799976f, 0.622300029f, -0.528100014f,
+	0.00532299979f, 0.265563011f, 0.015164f, 0.433400005f, 0.627399981f, -0.918900013f, 0.383300006f, -0.0935999975f,
+	0.00819199998f, 0.279983014f, 0.0197640005f, 0.438600004f, 0.632099986f, -0.826099992f, 0.313699991f, -0.468199998f,
+	0.0120780002f, 0.280761003f, 0.013429f, 0.440800011f, 0.629599988f, -0.872699976f, 0.34889999f, -0.341699988f,
+	0.0065390002f, 0.268200994f, 0.00801199954f, 0.43599999f, 0.624899983f, -0.926500022f, 0.376199991f, 0.00999999978f,
+	-0.000315999991f, 0.250741005f, -0.00303300004f, 0.429899991f, 0.6171f, -0.96359998f, 0.207100004f, -0.169300005f,
+	0.00136999995f, 0.258938015f, -0.00409599999f, 0.433600008f, 0.617999971f, -0.974300027f, 0.198200002f, -0.106899999f,
+	0.00788099971f, 0.255804002f, -0.0177200008f, 0.435099989f, 0.611199975f, -0.809599996f, 0.270999998f, -0.520699978f,
+	0.00793899968f, 0.26176399f, -0.0149769997f, 0.43720001f, 0.613300025f, -0.801199973f, 0.256599993f, -0.540600002f,
+	0.0200420003f, 0.267677009f, -0.026455f, 0.443100005f, 0.60799998f, -0.70539999f, 0.512799978f, -0.489399999f,
+	0.0212609991f, 0.262124002f, -0.034616001f, 0.441900015f, 0.603600025f, -0.645799994f, 0.581499994f, -0.494800001f,
+	0.0436200015f, 0.274798006f, -0.0441460013f, 0.453200012f, 0.598699987f, -0.577799976f, 0.622300029f, -0.528100014f,
+	0.0443050005f, 0.268182993f, -0.0526250005f, 0.451499999f, 0.594200015f, -0.577700019f, 0.620299995f, -0.530499995f,
+	0.199790001f, 0.0219509993f, 0.245174006f, 0.885299981f, 0.738900006f, 0.465000004f, 0.700699985f, 0.541199982f,
+	0.223184004f, -0.00318800006f, 0.257620007f, 0.895900011f, 0.726199985f, 0.465000004f, 0.700699985f, 0.541199982f,
+	0.211237997f, 0.0207550004f, 0.236884996f, 0.89139998f, 0.740800023f, 0.465000004f, 0.700699985f, 0.541199982f,
+	-0.0916799977f, 0.851592004f, 0.102596f, 0.535899997f, 0.322699994f, 0.298299998f, 0.213200003f, 0.930400014f,
+	-0.100244001f, 0.852523029f, 0.105136f, 0.538500011f, 0.319900006f, 0.289200008f, 0.249200001f, 0.924300015f,
+	-0.0976750031f, 0.810276985f, 0.103707999f, 0.543799996f, 0.34040001f, 0.333999991f, -0.300300002f, 0.89349997f,
+	-0.0884639993f, 0.812834024f, 0.101131998f, 0.539900005f, 0.338800013f, 0.328500003f, -0.275099993f, 0.903599977f,
+	-0.0931309983f, 0.875151992f, 0.0902329981f, 0.524999976f, 0.319000006f, 0.218199998f, 0.643000007f, 0.734099984f,
+	-0.102467f, 0.876583993f, 0.0916350037f, 0.525699973f, 0.314599991f, 0.209600002f, 0.661599994f, 0.720000029f,
+	-0.0947680026f, 0.889514029f, 0.0714320019f, 0.514100015f, 0.317999989f, 0.165399998f, 0.899200022f, 0.405000001f,
+	-0.103505999f, 0.890208006f, 0.0734589994f, 0.514900029f, 0.313899994f, 0.176799998f, 0.882099986f, 0.436699986f,
+	-0.094302997f, 0.896898985f, 0.0415600017f, 0.499500006f, 0.317699999f, 0.167199999f, 0.985800028f, -0.0181000009f,
+	-0.103606001f, 0.89851898f, 0.0419239998f, 0.499599993f, 0.313300014f, 0.178499997f, 0.983900011f, 0.00430000015f,
+	-0.0934100002f, 0.888607025f, 0.0122020002f, 0.485300004f, 0.318800002f, 0.208199993f, 0.878099978f, -0.430799991f,
+	-0.102665998f, 0.890742004f, 0.0119420001f, 0.484899998f, 0.314399987f, 0.217500001f, 0.888899982f, -0.403200001f,
+	-0.0926299989f, 0.876241982f, -0.00432999991f, 0.476599991f, 0.321500003f, 0.205500007f, 0.720300019f, -0.662500024f,
+	-0.101407997f, 0.877683997f, -0.0054990002f, 0.474599987f, 0.317900002f, 0.188999996f, 0.721700013f, -0.665899992f,
+	-0.091421999f, 0.862316012f, -0.0163020007f, 0.471300006f, 0.326700002f, 0.103799999f, 0.512300014f, -0.852500021f,
+	-0.101033002f, 0.86263603f, -0.0170910005f, 0.467500001f, 0.324900001f, 0.0656000003f, 0.500800014f, -0.862999976f,
+	-0.0896819979f, 0.844485998f, -0.0240189992f, 0.471599996f, 0.334300011f, -0.0573000014f, 0.0957999974f, -0.993700027f,
+	-0.100341998f, 0.845546007f, -0.0230989996f, 0.466800004f, 0.334699988f, -0.0702000037f, 0.133000001f, -0.988600016f,
+	-0.0889659971f, 0.821510971f, -0.021373f, 0.476300001f, 0.342599988f, -0.0654999986f, -0.322600007f, -0.944299996f,
+	-0.0986860022f, 0.820915997f, -0.0205189995f, 0.47330001f, 0.345699996f, -0.0654999986f, -0.326700002f, -0.942900002f,
+	-0.0868839994f, 0.801980972f, -0.00943099987f, 0.485000014f, 0.347000003f, -0.075000003f, -0.683799982f, -0.725799978f,
+	-0.0967750028f, 0.803045988f, -0.0093790004f, 0.48269999f, 0.351000011f, -0.0469000004f, -0.653299987f, -0.755599976f,
+	-0.086292997f, 0.788055003f, 0.00876899995f, 0.494800001f, 0.3495f, 0.135499999f, -0.873899996f, -0.466800004f,
+	-0.095693998f, 0.786453009f, 0.00841300003f, 0.494300008f, 0.353899986f, 0.171599999f, -0.864499986f, -0.47240001f,
+	-0.0847750008f, 0.778137982f, 0.049612999f, 0.514199972f, 0.349299997f, 0.2456f, -0.968299985f, 0.0447999984f,
+	-0.095145002f, 0.775554001f, 0.0490589999f, 0.514400005f, 0.354299992f, 0.240899995f, -0.970399976f, 0.0168999992f,
+	-0.0854490027f, 0.791159987f, 0.084691003f, 0.530799985f, 0.345800012f, 0.3653f, -0.743900001f, 0.559700012f,
+	-0.0954359993f, 0.788223028f, 0.0873050019f, 0.533399999f, 0.349999994f, 0.355199993f, -0.73089999f, 0.582700014f,
+	0.102467f, 0.876583993f, 0.0916350037f, 0.430700004f, 0.3574f, -0.218099996f, 0.651000023f, 0.727100015f,
+	0.0931309983f, 0.875151992f, 0.0902329981f, 0.427899987f, 0.354099989f, -0.209000006f, 0.631900012f, 0.746299982f,
+	0.0916789994f, 0.851592004f, 0.102596f, 0.434300005f, 0.344999999f, -0.289700001f, 0.227599993f, 0.929700017f,
+	0.100243002f, 0.852523029f, 0.105136f, 0.437700003f, 0.344900012f, -0.299699992f, 0.263099998f, 0.916999996f,
+	0.103505999f, 0.890208006f, 0.0734589994f, 0.4208f, 0.363000005f, -0.172000006f, 0.881600022f, 0.439599991f,
+	0.0947680026f, 0.889514029f, 0.0714320019f, 0.418799996f, 0.359299988f, -0.171399996f, 0.896499991f, 0.408600003f,
+	0.0884639993f, 0.812834024f, 0.101131998f, 0.421000004f, 0.334300011f, -0.329699993f, -0.275200009f, 0.903100014f,
+	0.0976739973f, 0.810276985f, 0.103707999f, 0.422899991f, 0.3301f, -0.332800001f, -0.300700009f, 0.89380002f,
+	0.0854490027f, 0.791159987f, 0.084691003f, 0.409000009f, 0.33160001f, -0.353899986f, -0.75849998f, 0.547100008f,
+	0.0954359993f, 0.788223028f, 0.0873050019f, 0.409999996f, 0.326599985f, -0.36559999f, -0.736199975f, 0.569500029f,
+	0.095145002f, 0.775554001f, 0.0490589999f, 0.390799999f, 0.327199996f, -0.2456f, -0.968599975f, 0.0381999984f,
+	0.0847750008f, 0.778137982f, 0.049612999f, 0.391799986f, 0.332100004f, -0.2377f, -0.968900025f, 0.0692000017f,
+	0.0862919986f, 0.788055003f, 0.00876899995f, 0.372900009f, 0.335999995f, -0.173099995f, -0.882200003f, -0.437999994f,
+	0.095693998f, 0.786453009f, 0.00841300003f, 0.371199995f, 0.331999987f, -0.136500001f, -0.882700026f, -0.449699998f,
+	0.0868839994f, 0.801980972f, -0.00943099987f, 0.36469999f, 0.341300011f, 0.0430999994f, -0.653100014f, -0.756099999f,
+	0.0967739969f, 0.803045988f, -0.0093790004f, 0.361000001f, 0.3389f, 0.0687000006f, -0.625400007f, -0.777199984f,
+	0.0889659971f, 0.821510971f, -0.021373f, 0.360100001f, 0.349099994f, 0.0653000027f, -0.328200012f, -0.942300022f,
+	0.0986860022f, 0.820915997f, -0.0205189995f, 0.356099993f, 0.349299997f, 0.0645999983f, -0.332199991f, -0.940999985f,
+	0.0896809995f, 0.844485998f, -0.0240189992f, 0.36590001f, 0.356299996f, 0.0715000033f, 0.117200002f, -0.990499973f,
+	0.100341998f, 0.845546007f, -0.0230989996f, 0.363200009f, 0.360300004f, 0.0465999991f, 0.163200006f, -0.985499978f,
+	0.091421999f, 0.862316012f, -0.0163020007f, 0.372799993f, 0.360799998f, -0.0650999993f, 0.505999982f, -0.860099971f,
+	0.101031996f, 0.86263603f, -0.0170910005f, 0.371300012f, 0.36500001f, -0.104900002f, 0.496399999f, -0.861699998f,
+	0.0926299989f, 0.876241982f, -0.00432999991f, 0.380800009f, 0.362699986f, -0.187800005f, 0.705200016f, -0.683700025f,
+	0.101406999f, 0.877683997f, -0.0054990002f, 0.380499989f, 0.366899997f, -0.2051f, 0.704900026f, -0.67900002f,
+	0.0934100002f, 0.888607025f, 0.0122020002f, 0.390399992f, 0.363000005f, -0.215000004f, 0.873899996f, -0.43599999f,
+	0.102665f, 0.890742004f, 0.0119420001f, 0.391000003f, 0.367399991f, -0.209099993f, 0.887199998f, -0.41139999f,
+	0.094302997f, 0.896898985f, 0.0415600017f, 0.404700011f, 0.361900002f, -0.177699998f, 0.984000027f, -0.0132999998f,
+	0.103606001f, 0.89851898f, 0.0419239998f, 0.405600011f, 0.366299987f, -0.167899996f, 0.985800028f, 0.00730000017f,
+	0.0355850011f, 0.649374008f, -0.136731997f, 0.847599983f, 0.357300013f, 0.128800005f, -0.0114000002f, 0.991599977f,
+	0.0426249988f, 0.66652298f, -0.137933001f, 0.850499988f, 0.365200013f, 0.0771000013f, 0.0381000005f, 0.996299982f,
+	-0.000308999995f, 0.668733001f, -0.132488996f, 0.830900013f, 0.365399987f, 0.0228000004f, 0.151299998f, 0.988200009f,
+	-0.0f, 0.651040971f, -0.129374996f, 0.831099987f, 0.357300013f, 0.0297999997f, 0.152199998f, 0.987900019f,
+	0.0524690002f, 0.659579992f, -0.137851f, 0.855099976f, 0.362199992f, 0.0399000011f, -0.0116999997f, 0.999100029f,
+	0.0410329998f, 0.643725991f, -0.138349995f, 0.850199997f, 0.354799986f, 0.066200003f, -0.0870999992f, 0.994000018f,
+	-0.0420869999f, 0.666719019f, -0.137945995f, 0.811800003f, 0.364800006f, -0.1285f, 0.0287999995f, 0.991299987f,
+	-0.035197001f, 0.649578989f, -0.136656001f, 0.814800024f, 0.356999993f, -0.197799996f, -0.0057000001f, 0.980199993f,
+	-0.0398630016f, 0.644971013f, -0.137594f, 0.812600017f, 0.354900002f, -0.104999997f, -0.0104999999f, 0.994400024f,
+	-0.0523689985f, 0.658751011f, -0.138321996f, 0.807099998f, 0.361200005f, -0.0729999989f, -0.00730000017f, 0.997300029f,
+	-0.0447189994f, 0.637561977f, -0.138150007f, 0.810299993f, 0.351599991f, -0.0776999965f, -0.00200000009f, 0.996999979f,
+	-0.0573339984f, 0.648882985f, -0.139265999f, 0.804700017f, 0.35679999f, -0.101599999f, -0.0151000004f, 0.994700015f,
+	-0.0701749995f, 0.600175023f, -0.139311001f, 0.798500001f, 0.334899992f, -0.0524000004f, 0.00469999993f, 0.998600006f,
+	-0.0504570007f, 0.605668008f, -0.138455003f, 0.807500005f, 0.337199986f, -0.0428000018f, -0.00190000003f, 0.999100029f,
+	0.0581340007f, 0.648504019f, -0.138302997f, 0.857800007f, 0.357300013f, -0.00540000014f, -0.0296f, 0.999499977f,
+	0.0438500009f, 0.636877f, -0.138812006f, 0.851599991f, 0.351799995f, -0.00769999996f, -0.0261000004f, 0.999599993f,
+	0.0713260025f, 0.598375976f, -0.138402998f, 0.864799976f, 0.334899992f, -0.00730000017f, 0.00540000014f, 1.0f,
+	0.0494720004f, 0.604250014f, -0.138402998f, 0.854799986f, 0.337099999f, 0.00350000011f, 0.0131000001f, 0.999899983f,
+	0.0120780002f, 0.280761003f, 0.013429f, 0.398999989f, 0.552699983f, 0.335200012f, 0.336600006f, -0.879999995f,
+	0.0162289999f, 0.279047012f, 0.0147050004f, 0.40110001f, 0.552699983f, 0.398200005f, 0.326099992f, -0.8574f,
+	0.0117220003f, 0.266883999f, 0.00798499957f, 0.400700003f, 0.54610002f, 0.159199998f, 0.50999999f, -0.845300019f,
+	0.0065390002f, 0.268200994f, 0.00801199954f, 0.398299992f, 0.546000004f, 0.165999994f, 0.540300012f, -0.824999988f,
+	0.006269f, 0.257555991f, -0.00204399996f, 0.399699986f, 0.539600015f, 0.398699999f, 0.62440002f, -0.671700001f,
+	0.00136999995f, 0.258938015f, -0.00409599999f, 0.397300005f, 0.538800001f, 0.446399987f, 0.608500004f, -0.656099975f,
+	-0.0120780002f, 0.280761003f, 0.013429f, 0.38350001f, 0.774399996f, -0.335200012f, 0.336600006f, -0.879999995f,
+	-0.0065390002f, 0.268200994f, 0.00801199954f, 0.382600009f, 0.767799973f, -0.165999994f, 0.540300012f, -0.824999988f,
+	-0.0117220003f, 0.266883999f, 0.00798499957f, 0.38499999f, 0.767799973f, -0.159199998f, 0.50999999f, -0.845300019f,
+	-0.0162289999f, 0.279047012f, 0.0147050004f, 0.385600001f, 0.774399996f, -0.398200005f, 0.326099992f, -0.8574f,
+	-0.00136999995f, 0.258938015f, -0.00409599999f, 0.381500006f, 0.760599971f, -0.446399987f, 0.608500004f, -0.656099975f,
+	-0.006269f, 0.257555991f, -0.00204399996f, 0.3838f, 0.761200011f, -0.398699999f, 0.62440002f, -0.671700001f,
+	-0.0803129971f, 0.796140015f, 0.0174339991f, 0.940599978f, 0.00999999978f, -0.403100014f, -0.548600018f, -0.732500017f,
+	0.0652230009f, 0.293309987f, 0.00567900017f, 0.459800005f, 0.648500025f, 0.629199982f, 0.72420001f, -0.282099992f,
+	0.061009001f, 0.297533989f, 0.00783399958f, 0.456999987f, 0.648000002f, 0.592499971f, 0.75f, -0.294f,
+	0.0660220012f, 0.297140002f, 0.0189260002f, 0.455799997f, 0.653299987f, 0.736999989f, 0.636200011f, -0.228400007f,
+	0.0715060011f, 0.291615009f, 0.0227579996f, 0.458000004f, 0.656599998f, 0.764500022f, 0.605499983f, -0.221200004f,
+	0.0418380015f, 0.301670015f, -0.0162439998f, 0.45629999f, 0.633899987f, 0.530700028f, 0.798099995f, -0.285400003f,
+	0.0418669991f, 0.30409199f, -0.00904100016f, 0.453999996f, 0.636399984f, 0.519200027f, 0.809499979f, -0.274300009f,
+	-0.0652230009f, 0.293309987f, 0.00567900017f, 0.27790001f, 0.815999985f, -0.629199982f, 0.72420001f, -0.282099992f,
+	-0.0715060011f, 0.291615009f, 0.0227579996f, 0.279700011f, 0.807900012f, -0.764500022f, 0.605499983f, -0.221200004f,
+	-0.0660220012f, 0.297140002f, 0.0189260002f, 0.281899989f, 0.811100006f, -0.736999989f, 0.636200011f, -0.228400007f,
+	-0.061009001f, 0.297533989f, 0.00783399958f, 0.280800015f, 0.816500008f, -0.592499971f, 0.75f, -0.294f,
+	-0.0418380015f, 0.301670015f, -0.0162439998f, 0.281399995f, 0.830600023f, -0.530700028f, 0.798099995f, -0.285400003f,
+	-0.0418669991f, 0.30409199f, -0.00904100016f, 0.283800006f, 0.828100026f, -0.519200027f, 0.809499979f, -0.274300009f,
+	-0.0671079978f, 0.27026701f, 0.00257900008f, 0.463800013f, 0.836399972f, -0.708700001f, 0.653299987f, -0.266600013f,
+	-0.0609770007f, 0.266072989f, -0.0219449997f, 0.465700001f, 0.847899973f, -0.482199997f, 0.835500002f, -0.263399988f,
+	-0.0705920011f, 0.263769001f, -0.00835299958f, 0.461100012f, 0.841799974f, -0.625400007f, 0.746399999f, -0.227500007f,
+	-0.0614780001f, 0.280689001f, 0.00910899974f, 0.468499988f, 0.832499981f, -0.713199973f, 0.586899996f, -0.38319999f,
+	-0.0730110034f, 0.265105993f, 0.0101279998f, 0.459800005f, 0.833500028f, -0.741699994f, 0.635800004f, -0.213599995f,
+	-0.0433339998f, 0.271638006f, -0.0351799987f, 0.474099994f, 0.853900015f, -0.566200018f, 0.755699992f, -0.328999996f,
+	-0.0425579995f, 0.279159993f, -0.0219250005f, 0.475899994f, 0.847299993f, -0.631200016f, 0.671199977f, -0.388799995f,
+	-0.0425049998f, 0.28728801f, -0.0104900002f, 0.477800012f, 0.841199994f, -0.657000005f, 0.617200017f, -0.432999998f,
+	-0.0774590001f, 0.259672999f, 0.00215899991f, 0.457100004f, 0.837499976f, -0.656099975f, 0.741699994f, -0.139599994f,
+	-0.0667359978f, 0.279110014f, 0.0170569997f, 0.465900004f, 0.828999996f, -0.751600027f, 0.530700028f, -0.391799986f,
+	0.0671079978f, 0.27026701f, 0.00257900008f, 0.47420001f, 0.560599983f, 0.709900022f, 0.654200017f, -0.261000007f,
+	0.0705920011f, 0.263769001f, -0.00835299958f, 0.477100015f, 0.555299997f, 0.647199988f, 0.732299984f, -0.211799994f,
+	0.0584039986f, 0.268281996f, -0.0242720004f, 0.471199989f, 0.548099995f, 0.378899992f, 0.905799985f, -0.189799994f,
+	0.0730110034f, 0.265105993f, 0.0101269996f, 0.478100002f, 0.56370002f, 0.741699994f, 0.635800004f, -0.213599995f,
+	0.0614780001f, 0.280689001f, 0.00910899974f, 0.469300002f, 0.564300001f, 0.713199973f, 0.586899996f, -0.38319999f,
+	0.0433339998f, 0.271638006f, -0.0351799987f, 0.46450001f, 0.542800009f, 0.530300021f, 0.790899992f, -0.305200011f,
+	0.0425579995f, 0.279159993f, -0.0219250005f, 0.462500006f, 0.549399972f, 0.631200016f, 0.671199977f, -0.388799995f,
+	0.0425049998f, 0.28728801f, -0.0104900002f, 0.460399985f, 0.555299997f, 0.657000005f, 0.617200017f, -0.432999998f,
+	0.0774590001f, 0.259672999f, 0.00215899991f, 0.481000006f, 0.559800029f, 0.656099975f, 0.741699994f, -0.139599994f,
+	0.0667359978f, 0.279110014f, 0.0170569997f, 0.471799999f, 0.567900002f, 0.751600027f, 0.530700028f, -0.391799986f,
+	-0.0557870008f, 0.267159998f, -0.0407700017f, 0.385500014f, 0.75120002f, -0.565400004f, 0.735300004f, -0.373699993f,
+	-0.0602229983f, 0.269057006f, -0.0290029999f, 0.383899987f, 0.756699979f, -0.565900028f, 0.753400028f, -0.334899992f,
+	-0.0436200015f, 0.274798006f, -0.0441460013f, 0.380400002f, 0.746800005f, -0.561699986f, 0.698800027f, -0.442900002f,
+	-0.0443050005f, 0.268182993f, -0.0526250005f, 0.384299994f, 0.743799984f, -0.557900012f, 0.675599992f, -0.481999993f,
+	-0.0157810003f, 0.493243992f, -0.141188994f, 0.626699984f, 0.244800001f, -0.000899999985f, 0.00170000002f, 1.0f,
+	0.0157810003f, 0.493243992f, -0.141188994f, 0.626699984f, 0.25909999f, 0.0f, 0.00150000001f, 1.0f,
+	0.0222309995f, 0.650941014f, -0.140795007f, 0.555299997f, 0.262199998f, -0.00870000012f, -0.00039999999f, 1.0f,
+	-0.0225489996f, 0.650632977f, -0.141240001f, 0.555400014f, 0.241899997f, -0.00989999995f, -9.99999975e-05f, 1.0f,
+	-0.0322909988f, 0.228327006f, -0.139723003f, 0.746699989f, 0.237299994f, 0.0f, -0.0210999995f, 0.999800026f,
+	0.0322909988f, 0.228327006f, -0.139723003f, 0.746699989f, 0.266499996f, 0.0f, -0.0210999995f, 0.999800026f,
+	3.50000009e-05f, 0.168503001f, -0.143225998f, 0.773800015f, 0.251899987f, 0.0f, -0.0584999993f, 0.998300016f,
+	0.0289849993f, 0.966597021f, -0.0112490002f, 0.106600001f, 0.697799981f, 0.859799981f, -0.320199996f, -0.397700012f,
+	0.0286720004f, 0.970465004f, -0.0149029996f, 0.105300002f, 0.695800006f, 0.821799994f, -0.354699999f, -0.445800006f,
+	0.0396520011f, 0.972180009f, 0.0110940002f, 0.118100002f, 0.696500003f, 0.773000002f, -0.594900012f, -0.220400006f,
+	0.0394209996f, 0.969419003f, 0.0183589999f, 0.120899998f, 0.698599994f, 0.970399976f, -0.158700004f, 0.182099998f,
+	0.0146700004f, 0.965285003f, -0.033427f, 0.0947000012f, 0.697700024f, 0.826300025f, -0.214900002f, -0.520600021f,
+	0.0161979999f, 0.962503016f, -0.0301300008f, 0.0961999968f, 0.699000001f, 0.832799971f, -0.167799994f, -0.52759999f,
+	-0.0289849993f, 0.966597021f, -0.0112490002f, 0.134100005f, 0.730700016f, -0.859799981f, -0.320199996f, -0.397700012f,
+	-0.0394209996f, 0.969419003f, 0.0183589999f, 0.144400001f, 0.720799983f, -0.970399976f, -0.158700004f, 0.182099998f,
+	-0.0396520011f, 0.972180009f, 0.0110940002f, 0.143600002f, 0.72420001f, -0.773000002f, -0.594900012f, -0.220400006f,
+	-0.0286720004f, 0.970465004f, -0.0149029996f, 0.134399995f, 0.733099997f, -0.821799994f, -0.354699999f, -0.445899993f,
+	-0.0146700004f, 0.965285003f, -0.033427f, 0.125100002f, 0.738499999f, -0.826300025f, -0.214900002f, -0.520600021f,
+	-0.0161979999f, 0.962503016f, -0.0301300008f, 0.125400007f, 0.736500025f, -0.832799971f, -0.167799994f, -0.52759999f,
+	-0.0105400002f, 0.294992f, 0.0584679991f, 0.465000004f, 0.893599987f, 0.637000024f, 0.692399979f, 0.338999987f,
+	-0.0142940003f, 0.298503011f, 0.0582219996f, 0.463499993f, 0.891799986f, 0.626399994f, 0.6778f, 0.384900004f,
+	-0.0286229998f, 0.296660006f, 0.0747030005f, 0.468400002f, 0.883099973f, 0.442699999f, 0.532800019f, 0.721199989f,
+	-0.0271119997f, 0.292082012f, 0.0771809965f, 0.470800012f, 0.88380003f, 0.422600001f, 0.535300016f, 0.731400013f,
+	-0.00724099996f, 0.297107011f, 0.0343040004f, 0.456200004f, 0.900399983f, 0.778400004f, 0.596899986f, 0.194700003f,
+	-0.0107129999f, 0.301229f, 0.036460001f, 0.455500007f, 0.897899985f, 0.798600018f, 0.566799998f, 0.202399999f,
+	-0.0429139994f, 0.291747987f, 0.0822850019f, 0.472000003f, 0.876299977f, -0.00419999985f, 0.465999991f, 0.884800017f,
+	-0.0429090001f, 0.296182007f, 0.0800969973f, 0.469799995f, 0.876299977f, -0.00430000015f, 0.442499995f, 0.896799982f,
+	-0.0571499988f, 0.296631992f, 0.0745809972f, 0.468600005f, 0.869499981f, -0.489399999f, 0.542100012f, 0.683099985f,
+	-0.0586719997f, 0.292050004f, 0.0770469978f, 0.470899999f, 0.868900001f, -0.465499997f, 0.534300029f, 0.705500007f,
+	-0.0712440014f, 0.294126987f, 0.0593990013f, 0.465900004f, 0.860400021f, -0.647499979f, 0.719200015f, 0.252099991f,
+	-0.0682659969f, 0.297291011f, 0.0574980006f, 0.463999987f, 0.861500025f, -0.667599976f, 0.7227f, 0.178900003f,
+	-0.0711989999f, 0.294672012f, 0.0380720012f, 0.458000004f, 0.854799986f, -0.780600011f, 0.624199986f, 0.0337000005f,
+	-0.0675989985f, 0.299275994f, 0.038759999f, 0.456699997f, 0.85710001f, -0.789900005f, 0.612100005f, 0.0366999991f,
+	0.0105400002f, 0.294992f, 0.0584679991f, 0.438199997f, 0.553799987f, -0.637000024f, 0.692399979f, 0.3389f,
+	0.0271119997f, 0.292082012f, 0.0771809965f, 0.432399988f, 0.56370002f, -0.422600001f, 0.535300016f, 0.731400013f,
+	0.0286229998f, 0.296660006f, 0.0747030005f, 0.434700012f, 0.564300001f, -0.442699999f, 0.532700002f, 0.721199989f,
+	0.0142940003f, 0.298503011f, 0.0582219996f, 0.439599991f, 0.555700004f, -0.626399994f, 0.6778f, 0.384900004f,
+	0.00724099996f, 0.297107011f, 0.0343040004f, 0.44690001f, 0.547100008f, -0.778400004f, 0.596899986f, 0.194700003f,
+	0.0429139994f, 0.291747987f, 0.0822850019f, 0.431100011f, 0.571099997f, 0.00419999985f, 0.465999991f, 0.884800017f,
+	0.0429090001f, 0.296182007f, 0.0800969973f, 0.433400005f, 0.571099997f, 0.00430000015f, 0.442499995f, 0.896799982f,
+	0.0571499988f, 0.296631992f, 0.0745809972f, 0.434599996f, 0.577899992f, 0.489399999f, 0.542100012f, 0.683099985f,
+	0.0586719997f, 0.292050004f, 0.0770469978f, 0.432200015f, 0.578499973f, 0.465499997f, 0.534300029f, 0.705500007f,
+	0.0712440014f, 0.294126987f, 0.0593990013f, 0.43720001f, 0.587000012f, 0.647499979f, 0.719200015f, 0.252099991f,
+	0.0682659969f, 0.297291011f, 0.0574980006f, 0.439099997f, 0.586000025f, 0.667599976f, 0.7227f, 0.178900003f,
+	0.0711989999f, 0.294672012f, 0.0380720012f, 0.444999993f, 0.592700005f, 0.780600011f, 0.624199986f, 0.0337000005f,
+	0.0675989985f, 0.299275994f, 0.038759999f, 0.446399987f, 0.590399981f, 0.789900005f, 0.612100005f, 0.0366999991f,
+	0.0107129999f, 0.301229f, 0.036460001f, 0.447600007f, 0.549600005f, -0.798600018f, 0.566799998f, 0.202399999f,
+	0.0988989994f, 0.785211027f, -0.0816180035f, 0.0318999998f, 0.423700005f, -0.676500022f, 0.726700008f, 0.1197f,
+	0.107911997f, 0.793259025f, -0.0721630007f, 0.0263999999f, 0.419499993f, -0.71450001f, 0.693700016f, 0.0907000005f,
+	0.111332998f, 0.798021972f, -0.0816560015f, 0.0298999995f, 0.415899992f, -0.70660001f, 0.702199996f, 0.0869000033f,
+	0.089850001f, 0.77837503f, -0.0904719979f, 0.0370999984f, 0.427700013f, -0.630699992f, 0.774699986f, -0.0449000001f,
+	0.0726189986f, 0.76652801f, -0.0760969967f, 0.0335000008f, 0.4384f, -0.744799972f, 0.662299991f, 0.0815000013f,
+	0.0807029977f, 0.772010028f, -0.0680880025f, 0.0288999993f, 0.434899986f, -0.644800007f, 0.752200007f, 0.136000007f,
+	0.0940369964f, 0.781509995f, -0.0946509987f, 0.0383000001f, 0.424899995f, -0.647400022f, 0.7579f, -0.0799999982f,
+	0.0901459977f, 0.778419971f, -0.0937639996f, 0.0384999998f, 0.427300006f, -0.645500004f, 0.763700008f, -0.00779999979f,
+	0.0850339979f, 0.773974001f, -0.094550997f, 0.0394000001f, 0.430200011f, -0.641200006f, 0.76700002f, 0.0214000009f,
+	0.0686269999f, 0.761119008f, -0.0871900022f, 0.0390000008f, 0.440499991f, -0.7597f, 0.64319998f, 0.0960000008f,
+	0.063556999f, 0.746370971f, -0.0653159991f, 0.0303000007f, 0.448599994f, -0.953299999f, 0.214200005f, 0.213100001f,
+	0.0668149963f, 0.749568999f, -0.0568500012f, 0.0262000002f, 0.447100013f, -0.912100017f, 0.282900006f, 0.296499997f,
+	0.0602359995f, 0.74269098f, -0.0812089965f, 0.0379000008f, 0.450399995f, -0.92869997f, 0.215299994f, 0.301800013f,
+	0.0575129986f, 0.754960001f, -0.106098004f, 0.0489999987f, 0.443500012f, -0.613699973f, 0.670899987f, 0.416200012f,
+	0.0877749994f, 0.777058005f, -0.0974640027f, 0.0403000005f, 0.42809999f, -0.70660001f, 0.703100026f, 0.0797000006f,
+	0.0876799971f, 0.777109027f, -0.101507001f, 0.0419999994f, 0.427700013f, -0.662100017f, 0.74150002f, 0.108599998f,
+	0.0714699998f, 0.764331996f, -0.105965003f, 0.0461999997f, 0.436300009f, -0.555100024f, 0.81190002f, 0.180800006f,
+	0.0370149985f, 0.758846998f, -0.133838996f, 0.065200001f, 0.442900002f, -0.443800002f, 0.766799986f, 0.463699996f,
+	0.0261640009f, 0.751932979f, -0.128425002f, 0.065700002f, 0.449000001f, -0.212599993f, 0.831700027f, 0.512899995f,
+	0.0467999987f, 0.738587022f, -0.102686003f, 0.0496000014f, 0.452899992f, -0.761500001f, 0.186199993f, 0.620800018f,
+	0.0495579988f, 0.723671019f, -0.102068998f, 0.0482000001f, 0.460200012f, -0.75849998f, -0.244800001f, 0.603999972f,
+	0.0620680004f, 0.721018016f, -0.0799529999f, 0.0364000015f, 0.460599989f, -0.898400009f, -0.325199991f, 0.29519999f,
+	0.065237999f, 0.720851004f, -0.0605349988f, 0.0274f, 0.459500015f, -0.898599982f, -0.298000008f, 0.32190001f,
+	0.0698880032f, 0.723495007f, -0.0510409996f, 0.0226000007f, 0.458099991f, -0.827700019f, -0.264999986f, 0.494800001f,
+	0.0783889964f, 0.700213015f, -0.0625139996f, 0.0248000007f, 0.469700009f, -0.636500001f, -0.698199987f, 0.327699989f,
+	0.0744270012f, 0.700385988f, -0.0855920017f, 0.0351999998f, 0.472200006f, -0.639800012f, -0.720899999f, 0.266299993f,
+	0.0323279984f, 0.736738026f, -0.118419997f, 0.0592f, 0.45449999f, -0.519999981f, 0.0342000015f, 0.853500009f,
+	0.0369900018f, 0.720808983f, -0.116299003f, 0.0571000017f, 0.461600006f, -0.773199975f, -0.1822f, 0.6074f,
+	0.037002001f, 0.699788988f, -0.123626001f, 0.0599000007f, 0.471399993f, -0.483799994f, -0.446500003f, 0.752699971f,
+	0.0569830015f, 0.703316987f, -0.106729999f, 0.0476999991f, 0.470600009f, -0.578100026f, -0.545899987f, 0.60650003f,
+	0.0213990007f, 0.754553974f, -0.143205002f, 0.0724999979f, 0.4472f, -0.210700005f, 0.971199989f, 0.111100003f,
+	0.0242040008f, 0.758969009f, -0.145393997f, 0.0728999972f, 0.444599986f, -0.521600008f, 0.621200025f, 0.584900022f,
+	0.074248001f, 0.768736005f, -0.112212002f, 0.0482000001f, 0.433200002f, -0.547800004f, 0.772899985f, 0.320199996f,
+	0.0395569988f, 0.763171017f, -0.135042995f, 0.0653999969f, 0.440800011f, -0.530200005f, 0.501999974f, 0.683300018f,
+	0.0115419999f, 0.744014978f, -0.121807002f, 0.0680000037f, 0.449800014f, -0.161899999f, -0.0296f, 0.986400008f,
+	0.0120919999f, 0.735004008f, -0.127779007f, 0.0693999976f, 0.454100013f, -0.327699989f, -0.421999991f, 0.845300019f,
+	-0.00319100008f, 0.710394979f, -0.134314999f, 0.0785000026f, 0.4639f, 0.0262000002f, -0.125200003f, 0.99180001f,
+	-0.00249499991f, 0.734520018f, -0.127479002f, 0.0759000033f, 0.452899992f, 0.0390000008f, -0.438499987f, 0.897899985f,
+	0.0249080006f, 0.69253999f, -0.133837998f, 0.0675000027f, 0.474400014f, -0.266400009f, -0.496899992f, 0.825900018f,
+	-0.0183819998f, 0.723891973f, -0.131210998f, 0.0839999989f, 0.456400007f, -0.268700004f, -0.610899985f, 0.744700015f,
+	-0.00610100012f, 0.70589298f, -0.134044006f, 0.0802000016f, 0.465600014f, -0.145199999f, -0.0540999994f, 0.987900019f,
+	-0.0101190004f, 0.727872014f, -0.130312994f, 0.0798999965f, 0.45539999f, 0.140200004f, -0.449400008f, 0.882300019f,
+	-0.00110899995f, 0.692227006f, -0.132624999f, 0.0803999975f, 0.472000003f, 0.33070001f, -0.181700006f, 0.926100016f,
+	0.00226800004f, 0.695026994f, -0.137425005f, 0.0775000006f, 0.471300006f, 0.387899995f, -0.2271f, 0.893299997f,
+	0.00766499992f, 0.684144974f, -0.144428f, 0.0769999996f, 0.477400005f, -0.0127999997f, -0.862100005f, 0.506500006f,
+	0.0203269999f, 0.685473979f, -0.141020998f, 0.0710999966f, 0.478100002f, -0.164499998f, -0.809800029f, 0.563300014f,
+	0.0342219993f, 0.681895018f, -0.140233994f, 0.0654999986f, 0.481099993f, -0.0854000002f, -0.892700016f, 0.442400008f,
+	0.002385f, 0.690984011f, -0.138647005f, 0.0776000023f, 0.472900003f, 0.619000018f, -0.425000012f, 0.660399973f,
+	-0.00151800003f, 0.688537002f, -0.134853005f, 0.0799999982f, 0.47389999f, 0.421799988f, -0.647800028f, 0.63440001f,
+	-0.00323899998f, 0.683870018f, -0.144547999f, 0.0816000029f, 0.475499988f, 0.340299994f, -0.841700017f, 0.419200003f,
+	0.0105760004f, 0.680260003f, -0.163136005f, 0.0794999972f, 0.485799998f, 0.131300002f, -0.945500016f, -0.298099995f,
+	0.0480000004f, 0.685954988f, -0.129262999f, 0.0582000017f, 0.479499996f, -0.418300003f, -0.561999977f, 0.71359998f,
+	0.0721589997f, 0.691138983f, -0.109099999f, 0.0441999994f, 0.478899986f, -0.420399994f, -0.765200019f, 0.487599999f,
+	0.0518580005f, 0.679439008f, -0.130380005f, 0.0579999983f, 0.482800007f, -0.453599989f, -0.404500008f, 0.794099987f,
+	0.0761429965f, 0.686815977f, -0.112751998f, 0.0443999991f, 0.481900007f, -0.381300002f, -0.754400015f, 0.534300029f,
+	0.0968609974f, 0.684879005f, -0.0972760022f, 0.0339000002f, 0.485900015f, -0.440800011f, -0.842400014f, 0.310000002f,
+	0.09296f, 0.688866019f, -0.091959998f, 0.0329000019f, 0.482600003f, -0.450500011f, -0.863699973f, 0.225899994f,
+	0.10881f, 0.683485985f, -0.0771510005f, 0.0233999994f, 0.486400008f, 0.267199993f, -0.949000001f, -0.167400002f,
+	0.115130998f, 0.684985995f, -0.0690559968f, 0.0187999997f, 0.486600012f, -0.372000009f, -0.882799983f, 0.28670001f,
+	0.129125997f, 0.674180984f, -0.0721599981f, 0.0167999994f, 0.494500011f, -0.554099977f, -0.791599989f, 0.257499993f,
+	0.0956899971f, 0.687856972f, -0.0688010007f, 0.0230999999f, 0.479200006f, -0.372799993f, -0.899200022f, 0.229000002f,
+	0.124585003f, 0.679482996f, -0.0622919984f, 0.0140000004f, 0.489899993f, -0.580299973f, -0.798099995f, 0.161799997f,
+	0.0999469981f, 0.690648019f, -0.0602650009f, 0.0186999999f, 0.478399992f, -0.290399998f, -0.857299984f, 0.425099999f,
+	0.0842870027f, 0.703236997f, -0.0530509986f, 0.0197000001f, 0.468800008f, -0.529200017f, -0.659200013f, 0.534200013f,
+	-0.000269000011f, 0.221132994f, -0.0129789999f, 0.281300008f, 0.557200015f, -0.390799999f, 0.440600008f, 0.808200002f,
+	0.00422299979f, 0.221111f, -0.0108890003f, 0.283399999f, 0.558000028f, -0.377200007f, 0.439200014f, 0.815400004f,
+	0.00437200023f, 0.235956997f, -0.0188159999f, 0.284700006f, 0.550499976f, -0.496800005f, 0.448199987f, 0.743200004f,
+	0.00253399997f, 0.237865999f, -0.0212709997f, 0.283899993f, 0.549099982f, -0.512399971f, 0.448700011f, 0.732200027f,
+	-0.0242609996f, 0.670695007f, -0.0611359999f, 0.933899999f, 0.774200022f, -0.952600002f, -0.241999999f, 0.184400007f,
+	-0.0288910009f, 0.674534023f, -0.0537349992f, 0.930499971f, 0.771499991f, -0.368800014f, -0.92930001f, 0.0207000002f,
+	-0.0336150005f, 0.677021027f, -0.0631330013f, 0.934700012f, 0.76910001f, -0.376300007f, -0.922999978f, -0.0800999999f,
+	-0.0391700007f, 0.678498983f, -0.045398999f, 0.926599979f, 0.766600013f, -0.133499995f, -0.987800002f, 0.0803999975f,
+	-0.0493309982f, 0.679121017f, -0.0556129999f, 0.931200027f, 0.762000024f, -0.114100002f, -0.993499994f, -0.0037f,
+	-0.0726590008f, 0.679159999f, -0.0338729993f, 0.921299994f, 0.75150001f, -0.0186999999f, -0.999800026f, 0.0055999998f,
+	-0.0568000004f, 0.678966999f, -0.0281380005f, 0.91869998f, 0.758700013f, -0.0203000009f, -0.999800026f, 0.00719999988f,
+	-0.0851740018f, 0.679777026f, -0.00263800006f, 0.907100022f, 0.745800018f, -0.0507000014f, -0.998700023f, -0.0109999999f,
+	-0.0705609992f, 0.678960979f, -0.00448800018f, 0.907999992f, 0.752499998f, -0.0538999997f, -0.998300016f, -0.0219000001f,
+	-0.0821850002f, 0.67937398f, 0.0241199993f, 0.894999981f, 0.747200012f, -0.0287999995f, -0.999499977f, 0.00860000029f,
+	-0.0656559989f, 0.678946018f, 0.0196550004f, 0.897000015f, 0.754700005f, -0.0243999995f, -0.999599993f, 0.0116999997f,
+	-0.0667610019f, 0.679527998f, 0.0502969995f, 0.88319999f, 0.754199982f, -0.0229000002f, -0.99940002f, 0.0254999995f,
+	-0.0535789989f, 0.678924024f, 0.039512001f, 0.888000011f, 0.760200024f, -0.0264999997f, -0.999300003f, 0.0266999993f,
+	-0.0412809998f, 0.679675996f, 0.0685909986f, 0.874899983f, 0.765699983f, -0.0226000007f, -0.99879998f, 0.0434000008f,
+	-0.0337940007f, 0.678928971f, 0.0557309985f, 0.880699992f, 0.76910001f, -0.0252999999f, -0.998700023f, 0.0432999991f,
+	-0.0143729998f, 0.678924978f, 0.0632570013f, 0.877300024f, 0.777899981f, -0.0137999998f, -0.998399973f, 0.0548f,
+	-0.0192200001f, 0.679700017f, 0.0758949965f, 0.871500015f, 0.775699973f, -0.0182000007f, -0.998700023f, 0.0480000004f,
+	0.0f, 0.678923011f, 0.0658560023f, 0.876100004f, 0.784399986f, 0.00779999979f, -0.999199986f, 0.0383000001f,
+	0.0f, 0.679131985f, 0.0777039975f, 0.870700002f, 0.784399986f, 0.0102000004f, -0.999800026f, 0.0175999999f,
+	0.0191270001f, 0.680094004f, 0.0754730031f, 0.871699989f, 0.793099999f, 0.0196000002f, -0.996900022f, 0.0763999969f,
+	0.0143729998f, 0.678924978f, 0.0632570013f, 0.877300024f, 0.790899992f, 0.0146000003f, -0.996500015f, 0.0826999992f,
+	0.0412819982f, 0.679673016f, 0.0685930029f, 0.874800026f, 0.80309999f, 0.0212999992f, -0.99849999f, 0.0498000011f,
+	0.0337940007f, 0.678928971f, 0.0557309985f, 0.880699992f, 0.799700022f, 0.0252f, -0.99879998f, 0.0432000011f,
+	0.0535789989f, 0.678924024f, 0.039512001f, 0.888000011f, 0.808700025f, 0.0265999995f, -0.999300003f, 0.0266999993f,
+	0.0667589977f, 0.679530025f, 0.0502960011f, 0.88319999f, 0.814700007f, 0.0229000002f, -0.99940002f, 0.0254999995f,
+	0.0656559989f, 0.678945005f, 0.0196550004f, 0.897000015f, 0.814199984f, 0.0242999997f, -0.999599993f, 0.0116999997f,
+	0.0821890011f, 0.679370999f, 0.0241209995f, 0.894999981f, 0.82160002f, 0.0280000009f, -0.999599993f, 0.00889999978f,
+	0.0705609992f, 0.678960979f, -0.00448800018f, 0.907999992f, 0.816399992f, 0.0505000018f, -0.99849999f, -0.0201999992f,
+	0.0852259994f, 0.679724991f, -0.00264400011f, 0.907100022f, 0.823000014f, 0.0516000018f, -0.998600006f, -0.0144999996f,
+	0.0568000004f, 0.678965986f, -0.0281380005f, 0.91869998f, 0.810199976f, 0.0421999991f, -0.999000013f, -0.0167999994f,
+	0.0722270012f, 0.679678023f, -0.0335870013f, 0.921199977f, 0.817200005f, 0.0408999994f, -0.999000013f, -0.0156999994f,
+	0.0391689986f, 0.678502977f, -0.045398999f, 0.926599979f, 0.802299976f, 0.140699998f, -0.986699998f, 0.0816999972f,
+	0.0493369997f, 0.679112017f, -0.0556199998f, 0.931200027f, 0.806900024f, 0.120800003f, -0.992699981f, 0.00400000019f,
+	0.0288910009f, 0.67453301f, -0.0537349992f, 0.930499971f, 0.797399998f, 0.368299991f, -0.929499984f, 0.0209999997f,
+	0.033617001f, 0.677017987f, -0.0631359965f, 0.934700012f, 0.799799979f, 0.375999987f, -0.923200011f, -0.079400003f,
+	0.0242529996f, 0.67069602f, -0.0611380003f, 0.933799982f, 0.794700027f, 0.952099979f, -0.240099996f, 0.189199999f,
+	0.0253139995f, 0.671953022f, -0.0664220005f, 0.936200023f, 0.795400023f, 0.916700006f, -0.386099994f, 0.102499999f,
+	0.0271140002f, 0.665620983f, -0.0591519997f, 0.933499992f, 0.791899979f, 0.571200013f, 0.776600003f, 0.265700012f,
+	0.0286950003f, 0.665858984f, -0.0631129965f, 0.935400009f, 0.791999996f, 0.627399981f, 0.717899978f, 0.301499993f,
+	0.0376890004f, 0.65713203f, -0.0456070006f, 0.929799974f, 0.784099996f, 0.331900001f, 0.901199996f, 0.278800011f,
+	0.0412929989f, 0.656803012f, -0.0486069992f, 0.931699991f, 0.783100009f, 0.320300013f, 0.903199971f, 0.285699993f,
+	-0.00460499991f, 0.785414994f, -0.128622994f, 0.0340999998f, 0.261299998f, -0.216499999f, -0.184900001f, 0.958599985f,
+	0.00299299997f, 0.754009008f, -0.137379006f, 0.0307999998f, 0.275900006f, -0.432799995f, -0.791299999f, 0.431800008f,
+	0.00501699978f, 0.754483998f, -0.131413996f, 0.0287999995f, 0.275000006f, -0.344300002f, -0.602999985f, 0.719600022f,
+	0.0188950002f, 0.787075996f, -0.125669003f, 0.0238000005f, 0.260199994f, 0.602100015f, -0.0474999994f, 0.796999991f,
+	-0.00428400002f, 0.806940019f, -0.125828996f, 0.0335000008f, 0.251300007f, 0.57190001f, -0.405600011f, 0.713100016f,
+	0.0186800007f, 0.750532985f, -0.137695998f, 0.0222999994f, 0.277099997f, 0.539600015f, -0.692799985f, 0.478399992f,
+	0.0154670002f, 0.80687499f, -0.125603005f, 0.0240000002f, 0.251899987f, 0.472900003f, 0.530900002f, 0.703199983f,
+	0.0247530006f, 0.789179981f, -0.151176006f, 0.0124000004f, 0.261299998f, 0.987399995f, 0.0863000005f, -0.132499993f,
+	0.0220960006f, 0.750316978f, -0.151490003f, 0.0161000006f, 0.278499991f, 0.744300008f, -0.667100012f, 0.0328000002f,
+	0.0199549999f, 0.811455011f, -0.149122f, 0.0126f, 0.250999987f, 0.680700004f, 0.727999985f, -0.0811000019f,
+	-0.0708649978f, 0.28165701f, 0.0168609992f, 0.467500001f, 0.814700007f, 0.224800006f, 0.342099994f, -0.912400007f,
+	-0.0667359978f, 0.279110014f, 0.0170569997f, 0.469599992f, 0.815299988f, 0.250699997f, 0.336800009f, -0.907599986f,
+	-0.0730110034f, 0.265105993f, 0.0101279998f, 0.468400002f, 0.822799981f, 0.169f, 0.543299973f, -0.822399974f,
+	-0.0776569992f, 0.266362995f, 0.0100830002f, 0.466300011f, 0.822799981f, 0.198899999f, 0.595899999f, -0.777999997f,
+	-0.0774590001f, 0.259672999f, 0.00215899991f, 0.467099994f, 0.827499986f, 0.3574f, 0.717999995f, -0.597299993f,
+	-0.0820799991f, 0.261382014f, 0.00104799995f, 0.464899987f, 0.827700019f, 0.4014f, 0.704699993f, -0.584999979f,
+	0.0708649978f, 0.28165701f, 0.0168609992f, 0.343199998f, 0.531799972f, -0.224800006f, 0.342099994f, -0.912400007f,
+	0.0776569992f, 0.266362995f, 0.0100830002f, 0.344500005f, 0.523800015f, -0.198899999f, 0.595899999f, -0.777999997f,
+	0.0730110034f, 0.265105993f, 0.0101269996f, 0.342299998f, 0.523699999f, -0.169f, 0.543299973f, -0.822399974f,
+	0.0667359978f, 0.279110014f, 0.0170569997f, 0.341100007f, 0.531300008f, -0.250699997f, 0.336800009f, -0.907599986f,
+	0.0820799991f, 0.261382014f, 0.00104799995f, 0.345999986f, 0.518899977f, -0.4014f, 0.704699993f, -0.584999979f,
+	0.0774590001f, 0.259672999f, 0.00215899991f, 0.343699992f, 0.51910001f, -0.3574f, 0.717999995f, -0.597299993f,
+	-0.00113700004f, 0.746415973f, -0.157850996f, 0.177499995f, 0.297399998f, -0.0542000011f, -0.995400012f, -0.0791999996f,
+	-0.0272669997f, 0.747821987f, -0.142600998f, 0.187299997f, 0.307000011f, 0.335299999f, -0.873899996f, 0.351900011f,
+	-0.0354080014f, 0.760326028f, -0.160337001f, 0.179700002f, 0.31400001f, -0.351999998f, -0.617200017f, -0.703700006f,
+	-0.0027699999f, 0.752542019f, -0.170245007f, 0.171800002f, 0.300300002f, 0.0785000026f, -0.556900024f, -0.826900005f,
+	0.0213690009f, 0.750258982f, -0.155697003f, 0.173700005f, 0.287600011f, 0.65990001f, -0.60650003f, -0.443500012f,
+	0.0133180004f, 0.749772012f, -0.148523003f, 0.178200006f, 0.289499998f, 0.0275999997f, -0.99089998f, 0.131799996f,
+	0.0220960006f, 0.750316978f, -0.151490003f, 0.1752f, 0.286500007f, 0.744300008f, -0.667100012f, 0.0328000002f,
+	0.0186800007f, 0.750532985f, -0.137695998f, 0.181400001f, 0.284999996f, 0.539600015f, -0.692799985f, 0.478399992f,
+	0.0129810004f, 0.750167012f, -0.142297f, 0.180800006f, 0.288199991f, -0.169200003f, -0.978900015f, 0.114799999f,
+	0.00501699978f, 0.754483998f, -0.131413996f, 0.187199995f, 0.289000005f, -0.344300002f, -0.602999985f, 0.719600022f,
+	0.00299299997f, 0.754009008f, -0.137379006f, 0.185299993f, 0.291099995f, -0.432799995f, -0.791299999f, 0.431800008f,
+	0.0651429966f, 0.727919996f, -0.0824019983f, 0.933600008f, 0.142800003f, -0.841300011f, -0.0582000017f, 0.537400007f,
+	0.0497270003f, 0.72092402f, -0.108906999f, 0.948199987f, 0.147400007f, -0.839699984f, -0.196899995f, 0.505999982f,
+	-0.0292339996f, 0.706462979f, -0.0611930005f, 0.766799986f, 0.721499979f, 0.00340000005f, -0.793799996f, -0.608200014f,
+	-0.0327280015f, 0.708392978f, -0.0638879985f, 0.766700029f, 0.719299972f, -0.0140000004f, -0.821200013f, -0.570500016f,
+	-0.047642f, 0.703903019f, -0.0531269982f, 0.758099973f, 0.718500018f, -0.223199993f, -0.870299995f, -0.439099997f,
+	-0.0488119982f, 0.705293f, -0.0552829988f, 0.75849998f, 0.717299998f, -0.208100006f, -0.868200004f, -0.450500011f,
+	-0.0712990016f, 0.703611016f, -0.0319599994f, 0.743799984f, 0.717000008f, -0.523800015f, -0.788999975f, -0.321099997f,
+	-0.0727360025f, 0.705272019f, -0.0337300003f, 0.744000018f, 0.715799987f, -0.489899993f, -0.797900021f, -0.351300001f,
+	-0.0847989991f, 0.706040978f, -0.00347399991f, 0.729600012f, 0.719099998f, -0.755800009f, -0.645299971f, -0.110799998f,
+	-0.0824860036f, 0.703227997f, -0.0031969999f, 0.730300009f, 0.720700026f, -0.761799991f, -0.637700021f, -0.114299998f,
+	-0.0801509991f, 0.702993989f, 0.0218449999f, 0.720600009f, 0.726599991f, -0.669099987f, -0.718500018f, 0.189600006f,
+	-0.0824220031f, 0.705377996f, 0.0229349993f, 0.719500005f, 0.725499988f, -0.660700023f, -0.721199989f, 0.208299994f,
+	-0.0644780025f, 0.702775002f, 0.0487480015f, 0.711399972f, 0.737299979f, -0.534300029f, -0.67930001f, 0.503099978f,
+	-0.066990003f, 0.705771983f, 0.050094001f, 0.709999979f, 0.736100018f, -0.555400014f, -0.680400014f, 0.478100002f,
+	-0.0401760004f, 0.702607989f, 0.0662290007f, 0.70569998f, 0.74970001f, -0.334600002f, -0.70450002f, 0.625899971f,
+	-0.0413639992f, 0.705096006f, 0.0683950037f, 0.704200029f, 0.749100029f, -0.342799991f, -0.701699972f, 0.624599993f,
+	-0.0190740004f, 0.701318979f, 0.0728349984f, 0.703999996f, 0.759599984f, -0.1602f, -0.694400012f, 0.701600015f,
+	-0.0192930009f, 0.703328013f, 0.0747689977f, 0.702700019f, 0.759500027f, -0.153400004f, -0.694500029f, 0.703000009f,
+	0.0f, 0.70184201f, 0.0749489963f, 0.703100026f, 0.76819998f, 0.0f, -0.704400003f, 0.709800005f,
+	0.0f, 0.704342008f, 0.0774340034f, 0.701600015f, 0.76819998f, 0.0f, -0.7051f, 0.709200025f,
+	0.0190740004f, 0.701318979f, 0.0728349984f, 0.703999996f, 0.776899993f, 0.165199995f, -0.693700016f, 0.700999975f,
+	0.0192930009f, 0.703328013f, 0.0747689977f, 0.702700019f, 0.77700001f, 0.157900006f, -0.694199979f, 0.702199996f,
+	0.0412589982f, 0.705174029f, 0.0681890026f, 0.704299986f, 0.787299991f, 0.34709999f, -0.692900002f, 0.632000029f,
+	0.0400939994f, 0.702674985f, 0.0660710037f, 0.70569998f, 0.786800027f, 0.339399993f, -0.695299983f, 0.63349998f,
+	0.0644809976f, 0.702773988f, 0.0487499982f, 0.711399972f, 0.799099982f, 0.535899997f, -0.672500014f, 0.510399997f,
+	0.0669649988f, 0.705781996f, 0.0500719994f, 0.709999979f, 0.800400019f, 0.558000028f, -0.673699975f, 0.484499991f,
+	0.0801509991f, 0.702993989f, 0.0218449999f, 0.720499992f, 0.809800029f, 0.669200003f, -0.718500018f, 0.189600006f,
+	0.0824220031f, 0.705377996f, 0.0229349993f, 0.719399989f, 0.810899973f, 0.660899997f, -0.720899999f, 0.208399996f,
+	0.0847989991f, 0.706040978f, -0.00347399991f, 0.729499996f, 0.817399979f, 0.759800017f, -0.639999986f, -0.114500001f,
+	0.0824880004f, 0.703226984f, -0.0031969999f, 0.730199993f, 0.815800011f, 0.761900008f, -0.637199998f, -0.1162f,
+	0.0712110028f, 0.703661025f, -0.0319009982f, 0.743700027f, 0.819500029f, 0.649100006f, -0.642700016f, -0.406899989f,
+	0.0721819997f, 0.705597997f, -0.0333570018f, 0.743900001f, 0.82069999f, 0.617900014f, -0.646300018f, -0.44780001f,
+	0.0476429984f, 0.703902006f, -0.0531280003f, 0.758099973f, 0.818899989f, 0.228300005f, -0.867299974f, -0.442299992f,
+	0.0488030016f, 0.705303013f, -0.0552689992f, 0.758400023f, 0.820100009f, 0.216000006f, -0.862500012f, -0.457599998f,
+	0.0327269994f, 0.708392978f, -0.0638870001f, 0.766600013f, 0.818700016f, 0.00800000038f, -0.818499982f, -0.574400008f,
+	0.029228f, 0.706466019f, -0.0611840002f, 0.766900003f, 0.816500008f, -0.00600000005f, -0.787f, -0.616900027f,
+	0.0252359994f, 0.712186992f, -0.066662997f, 0.770600021f, 0.818099976f, -0.0949999988f, -0.609099984f, -0.787400007f,
+	0.023356f, 0.71006602f, -0.064933002f, 0.770500004f, 0.816600025f, -0.0507000014f, -0.603900015f, -0.795400023f,
+	0.0165819991f, 0.717685997f, -0.0679389983f, 0.775200009f, 0.817399979f, -0.198799998f, -0.507600009f, -0.83829999f,
+	-0.0117220003f, 0.266883999f, 0.00798499957f, 0.332100004f, 0.777400017f, 0.782500029f, 0.56279999f, -0.266299993f,
+	-0.0170649998f, 0.270249993f, -2.80000004e-05f, 0.335399985f, 0.774100006f, 0.691500008f, 0.628799975f, -0.355599999f,
+	-0.0204249993f, 0.281410009f, 0.00674800016f, 0.339599997f, 0.778599977f, 0.727199972f, 0.510599971f, -0.458799988f,
+	-0.0162289999f, 0.279047012f, 0.0147050004f, 0.336899996f, 0.781899989f, 0.829999983f, 0.471899986f, -0.297500014f,
+	-0.0120740002f, 0.26135999f, -0.0119129997f, 0.331699997f, 0.768000007f, 0.65990001f, 0.705900013f, -0.257400006f,
+	-0.006269f, 0.257555991f, -0.00204399996f, 0.328000009f, 0.772099972f, 0.744099975f, 0.640299976f, -0.190899998f,
+	-0.0235200003f, 0.266268998f, -0.0224239994f, 0.337599993f, 0.763599992f, 0.457599998f, 0.843299985f, -0.281800002f,
+	-0.0433339998f, 0.271638006f, -0.0351799987f, 0.346799999f, 0.757700026f, 0.541400015f, 0.752600014f, -0.374799997f,
+	-0.0425579995f, 0.279159993f, -0.0219250005f, 0.347900003f, 0.764500022f, 0.606299996f, 0.665799975f, -0.434899986f,
+	-0.0425049998f, 0.28728801f, -0.0104900002f, 0.349700004f, 0.770600021f, 0.6153f, 0.619400024f, -0.487500012f,
+	0.0117220003f, 0.266883999f, 0.00798499957f, 0.463499993f, 0.588800013f, -0.782500029f, 0.56279999f, -0.266299993f,
+	0.0162289999f, 0.279047012f, 0.0147050004f, 0.468300015f, 0.593299985f, -0.829999983f, 0.471899986f, -0.297500014f,
+	0.0204249993f, 0.281410009f, 0.00674800016f, 0.471100003f, 0.590200007f, -0.727199972f, 0.510599971f, -0.458799988f,
+	0.0170649998f, 0.270249993f, -2.80000004e-05f, 0.467000008f, 0.585600019f, -0.691500008f, 0.628799975f, -0.355599999f,
+	0.0120740002f, 0.26135999f, -0.0119129997f, 0.463400006f, 0.579400003f, -0.65990001f, 0.705900013f, -0.257400006f,
+	0.006269f, 0.257555991f, -0.00204399996f, 0.459600002f, 0.583400011f, -0.744099975f, 0.640299976f, -0.190899998f,
+	0.0425049998f, 0.28728801f, -0.0104900002f, 0.481299996f, 0.582300007f, -0.6153f, 0.619400024f, -0.487500012f,
+	0.0235200003f, 0.266268998f, -0.0224239994f, 0.469300002f, 0.575100005f, -0.457599998f, 0.843299985f, -0.281800002f,
+	0.0433339998f, 0.271638006f, -0.0351799987f, 0.478599995f, 0.569400012f, -0.541400015f, 0.752600014f, -0.374799997f,
+	0.0425579995f, 0.279159993f, -0.0219250005f, 0.479600012f, 0.576200008f, -0.606299996f, 0.665799975f, -0.434899986f,
+	-0.0590520017f, 0.892261982f, -0.0332110003f, 0.703199983f, 0.432700008f, 0.871699989f, -0.232199997f, 0.431600004f,
+	-0.0592829995f, 0.930130005f, -0.0115870005f, 0.700600028f, 0.4375f, 0.922999978f, -0.216700003f, 0.318100005f,
+	-0.0669410005f, 0.920446992f, 0.00400000019f, 0.698700011f, 0.435699999f, 0.715799987f, -0.455799997f, 0.529100001f,
+	-0.0695049986f, 0.887856007f, -0.0154630002f, 0.701099992f, 0.431400001f, 0.585600019f, -0.409000009f, 0.699800014f,
+	-0.0627529994f, 0.848022997f, -0.0447949991f, 0.705500007f, 0.427599996f, 0.739700019f, -0.269300014f, 0.616699994f,
+	-0.119080998f, 0.879405975f, -0.00619499991f, 0.69749999f, 0.426299989f, 0.399300009f, -0.506699979f, 0.764100015f,
+	-0.0722920001f, 0.846668005f, -0.0347569995f, 0.704100013f, 0.426600009f, 0.485599995f, -0.342500001f, 0.80430001f,
+	-0.108461998f, 0.856262028f, -0.0223760009f, 0.700200021f, 0.424600005f, 0.281100005f, -0.3759f, 0.883000016f,
+	-0.0731180012f, 0.804139018f, -0.0490510017f, 0.708299994f, 0.422699988f, 0.297899991f, -0.31310001f, 0.901799977f,
+	-0.0817909986f, 0.828869998f, -0.0389170013f, 0.704900026f, 0.423999995f, 0.200200006f, -0.342000008f, 0.918099999f,
+	-0.105843998f, 0.836329997f, -0.02929f, 0.702199996f, 0.422500014f, 0.234300002f, -0.387899995f, 0.89139998f,
+	-0.129646003f, 0.850027025f, -0.0163909998f, 0.699400008f, 0.421700001f, 0.259299994f, -0.504899979f, 0.823300004f,
+	-0.112410001f, 0.819966972f, -0.0365790017f, 0.703599989f, 0.42019999f, 0.172999993f, -0.443300009f, 0.879499972f,
+	-0.141463995f, 0.838980019f, -0.0223660003f, 0.699800014f, 0.419200003f, 0.110799998f, -0.56190002f, 0.819700003f,
+	-0.152504995f, 0.846212983f, -0.0148689998f, 0.698300004f, 0.418900013f, 0.144299999f, -0.687099993f, 0.712100029f,
+	0.031787999f, 0.766843975f, -0.0663489997f, 0.270599991f, 0.490999997f, 0.537800014f, -0.808799982f, 0.237900004f,
+	0.0212949999f, 0.764362991f, -0.0535579994f, 0.269800007f, 0.483500004f, 0.537800014f, -0.792500019f, 0.287499994f,
+	0.000140999997f, 0.747641981f, -0.0600830019f, 0.280900002f, 0.477400005f, 0.535399973f, -0.827799976f, 0.167699993f,
+	-0.0f, 0.74536097f, -0.0738070011f, 0.285600007f, 0.481599987f, 0.533299983f, -0.835399985f, 0.133300006f,
+	-0.0f, 0.74536097f, -0.0738070011f, 0.484400004f, 0.418500006f, -0.561500013f, -0.809899986f, 0.169499993f,
+	-0.000142000004f, 0.747641981f, -0.0600830019f, 0.489199996f, 0.414499998f, -0.590900004f, -0.796800017f, 0.126300007f,
+	-0.0212949999f, 0.764362991f, -0.0535579994f, 0.500100017f, 0.4208f, -0.519500017f, -0.823800027f, 0.226799995f,
+	-0.0317890011f, 0.766843975f, -0.0663489997f, 0.499199986f, 0.428299993f, -0.501100004f, -0.828400016f, 0.250400007f,
+	-0.003425f, 0.680748999f, -0.150652006f, 0.0829999968f, 0.478100002f, 0.360700011f, -0.840499997f, 0.404300004f,
+	0.0480000004f, 0.685954988f, -0.129262999f, 0.0636000037f, 0.534600019f, 0.0901999995f, -0.924300015f, 0.370999992f,
+	0.0342219993f, 0.681895018f, -0.140233994f, 0.0606999993f, 0.542299986f, -0.0992999971f, -0.886200011f, 0.452600002f,
+	0.0418150015f, 0.680595994f, -0.141112998f, 0.0590000004f, 0.539300025f, -0.0452999994f, -0.90109998f, 0.431199998f,
+	0.0516720004f, 0.684704006f, -0.134574994f, 0.0606999993f, 0.533900023f, 0.165800005f, -0.92809999f, 0.333299994f,
+	-0.0635119975f, 0.262080014f, -0.0347959995f, 0.364899993f, 0.804899991f, -0.157100007f, 0.717700005f, -0.67839998f,
+	-0.0648109987f, 0.267630994f, -0.0266449992f, 0.364300013f, 0.800400019f, 0.0474999994f, 0.984600008f, -0.168099999f,
+	-0.0611319989f, 0.267111987f, -0.0286459997f, 0.365999997f, 0.801299989f, -0.053199999f, 0.921899974f, -0.383899987f,
+	-0.0565459989f, 0.260821998f, -0.0375569984f, 0.368099988f, 0.806200027f, -0.174400002f, 0.652899981f, -0.737100005f,
+	-0.0613459982f, 0.258563012f, -0.0373900011f, 0.365799993f, 0.806900024f, -0.250699997f, 0.469999999f, -0.846300006f,
+	-0.0609770007f, 0.266072989f, -0.0219449997f, 0.365999997f, 0.798200011f, 0.215000004f, 0.965799987f, 0.144800007f,
+	-0.0174219999f, 0.294364005f, 0.00192299997f, 0.485599995f, 0.840600014f, 0.539200008f, 0.805100024f, -0.247099996f,
+	-0.0206359997f, 0.297886014f, 0.0074740001f, 0.4824f, 0.839600027f, 0.505100012f, 0.83039999f, -0.235400006f,
+	-0.0150079997f, 0.296577007f, 0.0171869993f, 0.481900007f, 0.834500015f, 0.751900017f, 0.625100017f, -0.2095f,
+	-0.00876099989f, 0.289701998f, 0.0218720008f, 0.484400004f, 0.830500007f, 0.790400028f, 0.576099992f, -0.208499998f,
+	-0.0418380015f, 0.301670015f, -0.0162439998f, 0.48120001f, 0.854099989f, 0.462399989f, 0.841600001f, -0.279000014f,
+	-0.0418669991f, 0.30409199f, -0.00904100016f, 0.478799999f, 0.851599991f, 0.463999987f, 0.840200007f, -0.280699998f,
+	0.0174219999f, 0.294364005f, 0.00192299997f, 0.449499995f, 0.526899993f, -0.539200008f, 0.805100024f, -0.247099996f,
+	0.00876099989f, 0.289701998f, 0.0218720008f, 0.450399995f, 0.536899984f, -0.790400028f, 0.576099992f, -0.208499998f,
+	0.0150079997f, 0.296577007f, 0.0171869993f, 0.453099996f, 0.532999992f, -0.751900017f, 0.625100017f, -0.2095f,
+	0.0206359997f, 0.297886014f, 0.0074740001f, 0.452600002f, 0.527899981f, -0.505100012f, 0.83039999f, -0.235400006f,
+	0.0418380015f, 0.301670015f, -0.0162439998f, 0.454100013f, 0.513499975f, -0.462399989f, 0.841600001f, -0.279000014f,
+	0.0418669991f, 0.30409199f, -0.00904100016f, 0.456400007f, 0.515999973f, -0.463999987f, 0.840200007f, -0.280699998f,
+	-0.0610519983f, 0.743155003f, -0.033468999f, 0.528699994f, 0.439300001f, -0.833400011f, -0.446799994f, -0.325199991f,
+	-0.0646229982f, 0.751037002f, -0.0349610001f, 0.532500029f, 0.440400004f, -0.836099982f, -0.440699995f, -0.326700002f,
+	-0.0501470007f, 0.751406014f, -0.0642260015f, 0.528299987f, 0.454600006f, -0.792699993f, -0.456800014f, -0.403600007f,
+	-0.0444680005f, 0.741358995f, -0.0639109984f, 0.523100019f, 0.453999996f, -0.791000009f, -0.459699988f, -0.403800011f,
+	-0.0762929991f, 0.750374973f, 0.00728400005f, 0.536499977f, 0.420899987f, -0.852699995f, -0.520200014f, -0.0474000014f,
+	-0.0721459985f, 0.743552029f, 0.0074430001f, 0.532899976f, 0.420599997f, -0.853699982f, -0.519599974f, -0.0329000019f,
+	-0.0648469999f, 0.740809977f, 0.0398879983f, 0.531300008f, 0.405499995f, -0.730599999f, -0.576799989f, 0.365399987f,
+	-0.0695130005f, 0.747568011f, 0.0411100015f, 0.535000026f, 0.405299991f, -0.755100012f, -0.577499986f, 0.310299993f,
+	-0.045818001f, 0.745124996f, 0.0664020032f, 0.528900027f, 0.390799999f, -0.40079999f, -0.643599987f, 0.65200001f,
+	-0.0424459986f, 0.738677979f, 0.0619589984f, 0.525399983f, 0.392500013f, -0.351799995f, -0.646300018f, 0.677200019f,
+	-0.0f, 0.742838979f, 0.0736510009f, 0.513599992f, 0.376300007f, -0.00490000006f, -0.573700011f, 0.819100022f,
+	-0.0f, 0.736222982f, 0.0690540001f, 0.511200011f, 0.379000008f, -0.00529999984f, -0.573599994f, 0.819100022f,
+	0.0458169989f, 0.745124996f, 0.0664020032f, 0.496899992f, 0.363499999f, 0.412499994f, -0.650300026f, 0.637899995f,
+	0.0424459986f, 0.738677979f, 0.0619589984f, 0.495700002f, 0.367199987f, 0.371300012f, -0.643299997f, 0.66960001f,
+	0.0695130005f, 0.747568011f, 0.0411100015f, 0.481599987f, 0.359699994f, 0.746399999f, -0.579599977f, 0.326999992f,
+	0.0648460016f, 0.740809977f, 0.0398879983f, 0.481900007f, 0.363400012f, 0.722199976f, -0.569599986f, 0.39230001f,
+	0.0721459985f, 0.743552029f, 0.0074430001f, 0.466800004f, 0.364100009f, 0.852500021f, -0.520299971f, -0.0505999997f,
+	0.0762929991f, 0.750374973f, 0.00728400005f, 0.465900004f, 0.360599995f, 0.852299988f, -0.519400001f, -0.0610000007f,
+	0.0610519983f, 0.743155003f, -0.033468999f, 0.448900014f, 0.371199995f, 0.837499976f, -0.440600008f, -0.323100001f,
+	0.0646229982f, 0.751037002f, -0.0349619985f, 0.447299987f, 0.367599994f, 0.834299982f, -0.447100013f, -0.322600007f,
+	0.0444669984f, 0.741358995f, -0.0639109984f, 0.435299993f, 0.379099995f, 0.79430002f, -0.456900001f, -0.400299996f,
+	0.0501459986f, 0.751406014f, -0.0642260015f, 0.433999985f, 0.374000013f, 0.793200016f, -0.460799992f, -0.398200005f,
+	0.147029996f, 0.769749999f, -0.0796099976f, 0.0753000006f, 0.510900021f, -0.267699987f, -0.455599993f, 0.848999977f,
+	0.130356997f, 0.755415022f, -0.0926159993f, 0.0640999973f, 0.514100015f, -0.287299991f, -0.452300012f, 0.844299972f,
+	0.140945002f, 0.736383021f, -0.0963710025f, 0.0590000004f, 0.505500019f, -0.349400014f, -0.368900001f, 0.861299992f,
+	0.171208993f, 0.742564976f, -0.0815870017f, 0.0705000013f, 0.495099992f, -0.345600009f, -0.370099992f, 0.862299979f,
+	0.107911997f, 0.793259025f, -0.0721630007f, 0.077200003f, 0.531700015f, -0.248300001f, -0.582099974f, 0.774299979f,
+	0.109168999f, 0.779496014f, -0.082653001f, 0.0703999996f, 0.527899981f, -0.305900007f, -0.594600022f, 0.743499994f,
+	0.0988989994f, 0.785211027f, -0.0816180035f, 0.0705000013f, 0.533299983f, -0.2579f, -0.600499988f, 0.756900012f,
+	-0.0281370003f, 0.744817019f, -0.143636003f, 0.1505f, 0.365999997f, 0.483900011f, -0.440200001f, 0.756399989f,
+	-0.0272669997f, 0.747821987f, -0.142600998f, 0.151899993f, 0.365999997f, 0.495400012f, -0.407599986f, 0.767099977f,
+	-0.0419970006f, 0.746475995f, -0.133802995f, 0.151299998f, 0.373699993f, 0.397899985f, -0.629800022f, 0.667100012f,
+	-0.0438680016f, 0.743658006f, -0.135521993f, 0.149599999f, 0.374000013f, 0.384600013f, -0.653100014f, 0.6523f,
+	-0.0476219989f, 0.742982984f, -0.138061002f, 0.165099993f, 0.404700011f, 0.126300007f, -0.985099971f, 0.1171f,
+	-0.0355889983f, 0.743319988f, -0.145091996f, 0.163499996f, 0.398600012f, 0.152099997f, -0.964900017f, 0.214000002f,
+	-0.0281370003f, 0.744817019f, -0.143636003f, 0.165099993f, 0.395500004f, 0.142399997f, -0.973800004f, 0.177399993f,
+	-0.0438680016f, 0.743658006f, -0.135521993f, 0.166700006f, 0.403400004f, 0.118299998f, -0.989099979f, 0.0881000012f,
+	0.000688f, 0.91000402f, 0.159141004f, 0.575200021f, 0.987500012f, 0.117899999f, -0.824400008f, 0.553499997f,
+	0.0f, 0.908149004f, 0.156525001f, 0.576200008f, 0.986400008f, -0.00120000006f, -0.865800023f, 0.50029999f,
+	0.001239f, 0.908855021f, 0.156474993f, 0.576499999f, 0.986999989f, 0.460000008f, -0.776899993f, 0.430000007f,
+	-0.000690000015f, 0.91000402f, 0.159143999f, 0.574800014f, 0.986999989f, -0.116800003f, -0.824800014f, 0.553200006f,
+	-0.00123299996f, 0.908859015f, 0.156474993f, 0.575699985f, 0.986000001f, -0.4639f, -0.77609998f, 0.42719999f,
+	-0.153052002f, 0.800067008f, -0.0719679967f, 0.121600002f, 0.381599993f, 0.378500015f, -0.549799979f, 0.744599998f,
+	-0.130175993f, 0.793534994f, -0.0883020014f, 0.109700002f, 0.376300007f, 0.372999996f, -0.55430001f, 0.744000018f,
+	-0.114522003f, 0.813552022f, -0.075914003f, 0.114600003f, 0.364399999f, 0.304100007f, -0.671000004f, 0.676299989f,
+	-0.127871007f, 0.820903003f, -0.0623230003f, 0.123599999f, 0.366299987f, 0.305900007f, -0.678799987f, 0.667599976f,
+	-0.138400003f, 0.765085995f, -0.100088999f, 0.101199999f, 0.387899995f, 0.430099994f, -0.449299991f, 0.782999992f,
+	-0.177111f, 0.759482026f, -0.0820610002f, 0.114500001f, 0.402200013f, 0.429800004f, -0.449499995f, 0.783100009f,
+	-0.00793899968f, 0.26176399f, -0.0149769997f, 0.478100002f, 0.879499972f, 0.0860999972f, 0.946399987f, 0.311199993f,
+	-0.0120740002f, 0.26135999f, -0.0119129997f, 0.475899994f, 0.880400002f, 0.127000004f, 0.94660002f, 0.296299994f,
+	-0.006269f, 0.257555991f, -0.00204399996f, 0.47330001f, 0.875500023f, -0.0703999996f, 0.945900023f, 0.316900015f,
+	-0.00136999995f, 0.258938015f, -0.00409599999f, 0.475400001f, 0.874300003f, -0.129700005f, 0.93779999f, 0.32190001f,
+	-0.0235200003f, 0.266268998f, -0.0224239994f, 0.477299988f, 0.887600005f, 0.0582999997f, 0.930100024f, 0.362699986f,
+	-0.0200420003f, 0.267677009f, -0.026455f, 0.479799986f, 0.887399971f, 0.0533999987f, 0.928499997f, 0.367500007f,
+	-0.0433339998f, 0.271638006f, -0.0351799987f, 0.477499992f, 0.898599982f, 0.0353999995f, 0.942200005f, 0.333200008f,
+	-0.0436200015f, 0.274798006f, -0.0441460013f, 0.481000006f, 0.90109998f, 0.0362999998f, 0.942900002f, 0.331200004f,
+	0.00793899968f, 0.26176399f, -0.0149769997f, 0.423900008f, 0.549099982f, -0.0860999972f, 0.946399987f, 0.311199993f,
+	0.00136999995f, 0.258938015f, -0.00409599999f, 0.421299994f, 0.543799996f, 0.129700005f, 0.93779999f, 0.32190001f,
+	0.006269f, 0.257555991f, -0.00204399996f, 0.419200003f, 0.545099974f, 0.0703999996f, 0.945900023f, 0.316900015f,
+	0.0120740002f, 0.26135999f, -0.0119129997f, 0.421700001f, 0.549899995f, -0.127000004f, 0.94660002f, 0.296299994f,
+	0.0235200003f, 0.266268998f, -0.0224239994f, 0.423099995f, 0.557200015f, -0.0582999997f, 0.930100024f, 0.362699986f,
+	0.0200420003f, 0.267677009f, -0.026455f, 0.425599992f, 0.556999981f, -0.0533999987f, 0.928499997f, 0.367500007f,
+	0.0433339998f, 0.271638006f, -0.0351799987f, 0.423299998f, 0.568099976f, -0.0353999995f, 0.942200005f, 0.333200008f,
+	0.0436200015f, 0.274798006f, -0.0441460013f, 0.426800013f, 0.570599973f, -0.0362999998f, 0.942900002f, 0.331200004f,
+	0.0621730015f, 0.269867986f, -0.0298950002f, 0.44600001f, 0.773500025f, 0.0127999997f, 0.958400011f, 0.2852f,
+	0.0584039986f, 0.268281996f, -0.0242720004f, 0.448599994f, 0.771700025f, 0.00860000029f, 0.958800018f, 0.283899993f,
+	0.0705920011f, 0.263769001f, -0.00835299958f, 0.4463f, 0.762600005f, -0.0204000007f, 0.942799985f, 0.332899988f,
+	0.0741650015f, 0.265332997f, -0.0124639999f, 0.444099993f, 0.763899982f, -0.0671999976f, 0.942600012f, 0.327100009f,
+	0.0436200015f, 0.274798006f, -0.0441460013f, 0.451200008f, 0.782899976f, -0.0118000004f, 0.94749999f, 0.319499999f,
+	0.0433339998f, 0.271638006f, -0.0351799987f, 0.453000009f, 0.778999984f, -0.0298999995f, 0.943000019f, 0.331400007f,
+	0.0774590001f, 0.259672999f, 0.00215899991f, 0.4454f, 0.756699979f, -0.1884f, 0.900900006f, 0.391099989f,
+	0.0820799991f, 0.261382014f, 0.00104799995f, 0.443199992f, 0.756600022f, -0.233099997f, 0.888100028f, 0.396200001f,
+	-0.0648109987f, 0.267630994f, -0.0266449992f, 0.255400002f, 0.751100004f, 0.1105f, 0.9648f, 0.238600001f,
+	-0.0741650015f, 0.265332997f, -0.0124639999f, 0.262199998f, 0.754899979f, 0.106200002f, 0.949299991f, 0.2958f,
+	-0.0705920011f, 0.263769001f, -0.00835299958f, 0.261700004f, 0.757399976f, 0.0491000004f, 0.948199987f, 0.31400001f,
+	-0.0609770007f, 0.266072989f, -0.0219449997f, 0.254900008f, 0.753799975f, 0.0759000033f, 0.957499981f, 0.278100014f,
+	-0.0820799991f, 0.261382014f, 0.00104799995f, 0.268299997f, 0.758899987f, 0.233099997f, 0.888100028f, 0.396200001f,
+	-0.0774590001f, 0.259672999f, 0.00215899991f, 0.2667f, 0.760500014f, 0.1884f, 0.900900006f, 0.391099989f,
+	-0.0436200015f, 0.274798006f, -0.0441460013f, 0.260600001f, 0.765999973f, -0.0291000009f, 0.93779999f, 0.345800012f,
+	-0.0433339998f, 0.271638006f, -0.0351799987f, 0.261500001f, 0.761699975f, -0.0469000004f, 0.941600025f, 0.333400011f,
+	-0.0602229983f, 0.269057006f, -0.0290029999f, 0.254599988f, 0.757300019f, 0.0405000001f, 0.918799996f, 0.392699987f,
+	0.0133180004f, 0.749772012f, -0.148523003f, 0.0315999985f, 0.404599994f, 0.0275999997f, -0.99089998f, 0.131799996f,
+	0.0129810004f, 0.750167012f, -0.142297f, 0.0288999993f, 0.403600007f, -0.169200003f, -0.978900015f, 0.114799999f,
+	0.00299299997f, 0.754009008f, -0.137379006f, 0.0277999993f, 0.398400009f, -0.432799995f, -0.791299999f, 0.431800008f,
+	-0.00113700004f, 0.746415973f, -0.157850996f, 0.0377999991f, 0.399599999f, -0.0542000011f, -0.995400012f, -0.0791999996f,
+	-0.0183060002f, 0.761240005f, -0.141230002f, 0.0311999992f, 0.388700008f, 0.358399987f, -0.504800022f, 0.785300016f,
+	-0.0272669997f, 0.747821987f, -0.142600998f, 0.0379000008f, 0.385899991f, 0.335299999f, -0.873899996f, 0.351900011f,
+	-0.0727489963f, 0.253497988f, -0.0196509995f, 0.305200011f, 0.768000007f, -0.813600004f, 0.575500011f, -0.0824000016f,
+	-0.0613459982f, 0.258563012f, -0.0373900011f, 0.297600001f, 0.774299979f, -0.505400002f, 0.844900012f, -0.175099999f,
+	-0.0708009973f, 0.250764996f, -0.0432070009f, 0.294499993f, 0.768999994f, -0.628799975f, 0.762099981f, -0.154499993f,
+	-0.077601999f, 0.244145006f, -0.0294940006f, 0.300000012f, 0.763899982f, -0.845200002f, 0.52640003f, -0.0917999968f,
+	-0.0788780004f, 0.244664997f, 0.0033760001f, 0.314700007f, 0.761600018f, -0.960799992f, 0.227799997f, 0.158299997f,
+	-0.0594930016f, 0.256235987f, -0.0540710017f, 0.289999992f, 0.775099993f, -0.336400002f, 0.914300025f, -0.225600004f,
+	-0.0541689992f, 0.260194987f, -0.0438870005f, 0.2949f, 0.777700007f, -0.296999991f, 0.929899991f, -0.216999993f,
+	-0.0565459989f, 0.260821998f, -0.0375569984f, 0.297699988f, 0.77670002f, -0.4199f, 0.874000013f, -0.244399995f,
+	-0.0422770008f, 0.257916987f, -0.0595179982f, 0.287600011f, 0.782899976f, 0.0452999994f, 0.984899998f, -0.167099997f,
+	-0.0445559993f, 0.259599f, -0.0511210002f, 0.291500002f, 0.782000005f, 0.0337999985f, 0.981700003f, -0.1875f,
+	-0.0214569997f, 0.256866008f, -0.0338610001f, 0.298700005f, 0.792999983f, 0.458999991f, 0.882799983f, -0.0996000022f,
+	-0.0251039993f, 0.256271988f, -0.0539250001f, 0.289700001f, 0.790899992f, 0.221599996f, 0.9727f, -0.0691f,
+	-0.0138769997f, 0.250822991f, -0.0429649986f, 0.294099987f, 0.796899974f, 0.593100011f, 0.797399998f, -0.111000001f,
+	-0.0117499996f, 0.251967996f, -0.020451f, 0.30430001f, 0.798399985f, 0.795799971f, 0.603500009f, -0.0502000004f,
+	-0.00717899995f, 0.244216993f, -0.0291949995f, 0.299800009f, 0.801900029f, 0.82980001f, 0.554400027f, -0.0634000003f,
+	-0.00603599986f, 0.242853999f, -0.000645999971f, 0.3125f, 0.804499984f, 0.984300017f, 0.166500002f, 0.0592f,
+	-0.0030449999f, 0.237132996f, -0.0173909999f, 0.3046f, 0.806299984f, 0.951799989f, 0.299199998f, 0.0678000003f,
+	-0.00422299979f, 0.221111f, -0.0108890003f, 0.306899995f, 0.813799977f, 0.995000005f, 0.0401000008f, 0.0909999982f,
+	-0.0818220004f, 0.237050995f, -0.0177260004f, 0.304699987f, 0.75940001f, -0.933899999f, 0.357600003f, 0.0013f,
+	-0.0850939974f, 0.218863994f, -0.00947999954f, 0.307200015f, 0.75059998f, -0.975799978f, 0.162f, 0.146599993f,
+	-0.115248002f, 0.214202002f, 0.131969005f, 0.72329998f, 0.592000008f, 0.00939999986f, 0.863600016f, 0.504199982f,
+	0.110614002f, 0.221943006f, 0.127933994f, 0.725700021f, 0.489499986f, -0.0368000008f, 0.984799981f, -0.169599995f,
+	0.120159f, 0.220406994f, 0.116948001f, 0.730499983f, 0.485199988f, -0.0339000002f, 0.991999984f, -0.121600002f,
+	-0.119592004f, 0.221926004f, 0.119323f, 0.729600012f, 0.593999982f, 0.0105999997f, 0.855000019f, 0.51849997f,
+	0.0727489963f, 0.253497988f, -0.0196509995f, 0.339300007f, 0.578599989f, 0.813600004f, 0.575500011f, -0.0824000016f,
+	0.077601999f, 0.244145006f, -0.0294940006f, 0.344399989f, 0.582599998f, 0.845200002f, 0.52640003f, -0.0917999968f,
+	0.0708009973f, 0.250764996f, -0.0432070009f, 0.350100011f, 0.577600002f, 0.628799975f, 0.762099981f, -0.154499993f,
+	0.0613459982f, 0.258563012f, -0.0373900011f, 0.346899986f, 0.572300017f, 0.483599991f, 0.859799981f, -0.164100006f,
+	0.0788780004f, 0.244664997f, 0.0033760001f, 0.329699993f, 0.584999979f, 0.960799992f, 0.227799997f, 0.158299997f,
+	0.0818220004f, 0.237050995f, -0.0177260004f, 0.339700013f, 0.587100029f, 0.933899999f, 0.357600003f, 0.0013f,
+	0.0850939974f, 0.218863994f, -0.00947999954f, 0.337300003f, 0.595899999f, 0.975799978f, 0.162f, 0.146599993f,
+	0.0594930016f, 0.256235987f, -0.0540710017f, 0.354499996f, 0.571500003f, 0.273200005f, 0.948099971f, -0.162599996f,
+	0.0422770008f, 0.257916987f, -0.0595179982f, 0.356900007f, 0.56370002f, -0.0252999999f, 0.989000022f, -0.145699993f,
+	0.0445559993f, 0.259599f, -0.0511210002f, 0.352999985f, 0.564599991f, 0.0595000014f, 0.975499988f, -0.211600006f,
+	0.0251039993f, 0.256271988f, -0.0539250001f, 0.354699999f, 0.555700004f, -0.221599996f, 0.9727f, -0.0691f,
+	0.0214569997f, 0.256866008f, -0.0338610001f, 0.345699996f, 0.553600013f, -0.458999991f, 0.882799983f, -0.0996000022f,
+	0.0138769997f, 0.250822991f, -0.0429649986f, 0.350300014f, 0.549700022f, -0.593100011f, 0.797399998f, -0.111000001f,
+	0.0117499996f, 0.251967996f, -0.020451f, 0.34009999f, 0.548200011f, -0.795799971f, 0.603500009f, -0.0502000004f,
+	0.00717899995f, 0.244216993f, -0.0291949995f, 0.344599992f, 0.544700027f, -0.853200018f, 0.517499983f, -0.0648000017f,
+	0.00603599986f, 0.242853999f, -0.000645999971f, 0.331800014f, 0.542100012f, -0.986999989f, 0.156000003f, 0.0381999984f,
+	0.00437200023f, 0.235956997f, -0.0188159999f, 0.34040001f, 0.540099978f, -0.980599999f, 0.195099995f, 0.0156999994f,
+	0.00422299979f, 0.221111f, -0.0108890003f, 0.337799996f, 0.532999992f, -0.996999979f, 0.0610999987f, 0.0469000004f,
+	-0.0761900023f, 0.251327008f, -0.0484340005f, 0.408199996f, 0.79339999f, -0.214599997f, 0.931699991f, 0.293099999f,
+	-0.0817070007f, 0.243974f, -0.0333180018f, 0.415800005f, 0.790700018f, -0.336899996f, 0.8847f, 0.322299987f,
+	-0.077601999f, 0.244145006f, -0.0294940006f, 0.417400002f, 0.792699993f, -0.318500012f, 0.884599984f, 0.340600014f,
+	-0.0708009973f, 0.250764996f, -0.0432070009f, 0.41049999f, 0.795799971f, -0.204699993f, 0.928200006f, 0.310799986f,
+	-0.0594930016f, 0.256235987f, -0.0540710017f, 0.405099988f, 0.800999999f, -0.135800004f, 0.972000003f, 0.191599995f,
+	-0.0620339997f, 0.257155001f, -0.0609279983f, 0.40200001f, 0.799799979f, -0.122299999f, 0.978699982f, 0.164900005f,
+	-0.0839719996f, 0.238582999f, -0.0217439998f, 0.421499997f, 0.789499998f, -0.240099996f, 0.871299982f, 0.427899987f,
+	-0.0818220004f, 0.237050995f, -0.0177260004f, 0.423500001f, 0.790400028f, -0.215399995f, 0.868600011f, 0.4463f,
+	-0.0422770008f, 0.257916987f, -0.0595179982f, 0.402399987f, 0.808799982f, -0.0013f, 0.998099983f, 0.0615999997f,
+	-0.0422540009f, 0.258127987f, -0.0649259984f, 0.399899989f, 0.808700025f, -0.00120000006f, 0.999199986f, 0.0390000008f,
+	-0.0251039993f, 0.256271988f, -0.0539250001f, 0.404700011f, 0.816699982f, 0.132200003f, 0.972299993f, 0.192699999f,
+	-0.0225079991f, 0.257194996f, -0.0607599989f, 0.401600003f, 0.817700028f, 0.118900001f, 0.978900015f, 0.165900007f,
+	-0.00844599959f, 0.251396f, -0.0481459983f, 0.407400012f, 0.824500024f, 0.210199997f, 0.932099998f, 0.2949f,
+	-0.0138769997f, 0.250822991f, -0.0429649986f, 0.40990001f, 0.822099984f, 0.200100005f, 0.928600013f, 0.3125f,
+	-0.00717899995f, 0.244216993f, -0.0291949995f, 0.416599989f, 0.825699985f, 0.314099997f, 0.885200024f, 0.343199998f,
+	-0.00304200011f, 0.244053006f, -0.0329839997f, 0.414799988f, 0.827600002f, 0.332700014f, 0.885200024f, 0.324999988f,
+	-0.0030449999f, 0.237132996f, -0.0173909999f, 0.422500014f, 0.828299999f, 0.210099995f, 0.869000018f, 0.448000014f,
+	-0.000865000009f, 0.238667995f, -0.0213910006f, 0.42050001f, 0.829100013f, 0.234999999f, 0.871800005f, 0.429800004f,
+	0.0761900023f, 0.251327008f, -0.0484340005f, 0.454299986f, 0.745400012f, 0.214599997f, 0.931699991f, 0.293099999f,
+	0.0708009973f, 0.250764996f, -0.0432070009f, 0.451599985f, 0.743200004f, 0.204699993f, 0.928200006f, 0.310799986f,
+	0.077601999f, 0.244145006f, -0.0294940006f, 0.445199996f, 0.747200012f, 0.318500012f, 0.884599984f, 0.340600014f,
+	0.0817070007f, 0.243974f, -0.0333180018f, 0.447100013f, 0.749000013f, 0.336899996f, 0.8847f, 0.322299987f,
+	0.0620339997f, 0.257155001f, -0.0609290004f, 0.459500015f, 0.738200009f, 0.122299999f, 0.978699982f, 0.164900005f,
+	0.0594930016f, 0.256235987f, -0.0540710017f, 0.456200004f, 0.737399995f, 0.135800004f, 0.972000003f, 0.191599995f,
+	0.0818220004f, 0.237050995f, -0.0177260004f, 0.439399987f, 0.750199974f, 0.215399995f, 0.868600011f, 0.4463f,
+	0.0839719996f, 0.238582999f, -0.0217439998f, 0.441500008f, 0.750899971f, 0.240099996f, 0.871299982f, 0.427899987f,
+	0.0422770008f, 0.257916987f, -0.0595179982f, 0.457800001f, 0.729399979f, -0.0193000007f, 0.99849999f, 0.0507000014f,
+	0.0422540009f, 0.258127987f, -0.0649259984f, 0.460299999f, 0.729099989f, -0.0196000002f, 0.999000013f, 0.0390999988f,
+	0.0228610002f, 0.256363988f, -0.0603929982f, 0.456999987f, 0.720700026f, -0.170599997f, 0.982599974f, 0.072800003f,
+	0.0251039993f, 0.256271988f, -0.0539250001f, 0.454299986f, 0.722199976f, -0.190099999f, 0.977299988f, 0.0938000008f,
+	0.00992500037f, 0.250957012f, -0.047265999f, 0.450199991f, 0.715600014f, -0.278800011f, 0.9296f, 0.2412f,
+	0.0138769997f, 0.250822991f, -0.0429649986f, 0.448399991f, 0.717599988f, -0.262400001f, 0.926400006f, 0.270000011f,
+	0.00439500017f, 0.243362993f, -0.032354001f, 0.442499995f, 0.713400006f, -0.533100009f, 0.807799995f, 0.25150001f,
+	0.00717899995f, 0.244216993f, -0.0291949995f, 0.441300005f, 0.714999974f, -0.495200008f, 0.815999985f, 0.298200011f,
+	0.00253399997f, 0.237865999f, -0.0212709997f, 0.43689999f, 0.712400019f, -0.0922999978f, 0.802600026f, 0.589299977f,
+	0.00437200023f, 0.235956997f, -0.0188159999f, 0.435499996f, 0.713199973f, -0.0143999998f, 0.784300029f, 0.620199978f,
+	0.00779900001f, 0.824438989f, -0.154520005f, 0.987100005f, 0.242300004f, 0.614300013f, -0.5176f, -0.595600009f,
+	0.0109850001f, 0.824460983f, -0.146721005f, 0.989000022f, 0.246399999f, 0.854900002f, -0.518700004f, 0.00810000021f,
+	0.00904699974f, 0.821255982f, -0.146643996f, 0.987399995f, 0.246999994f, 0.85680002f, -0.515500009f, 0.0120000001f,
+	0.00629300019f, 0.820904016f, -0.153014004f, 0.986100018f, 0.243900001f, 0.608200014f, -0.519200027f, -0.600399971f,
+	-0.0f, 0.82437098f, -0.157895997f, 0.982900023f, 0.240799993f, -0.00659999996f, -0.547999978f, -0.836499989f,
+	0.00768399984f, 0.824515998f, -0.139036998f, 0.987900019f, 0.250800014f, 0.604099989f, -0.508599997f, 0.613499999f,
+	0.00631899992f, 0.821422994f, -0.140239f, 0.986500025f, 0.250200003f, 0.592299998f, -0.504000008f, 0.628700018f,
+	-0.0f, 0.824532986f, -0.135892004f, 0.984099984f, 0.252999991f, -0.0260000005f, -0.493200004f, 0.869499981f,
+	4.19999997e-05f, 0.821211994f, -0.137874007f, 0.983699977f, 0.251300007f, -0.0168999992f, -0.510399997f, 0.859799981f,
+	-0.00722000003f, 0.824823976f, -0.139501005f, 0.980099976f, 0.25150001f, -0.650200009f, -0.410600007f, 0.639299989f,
+	-0.00591900013f, 0.820694029f, -0.140702993f, 0.981299996f, 0.249799997f, -0.657500029f, -0.4111f, 0.631399989f,
+	-0.0109959999f, 0.824455023f, -0.146721005f, 0.977999985f, 0.247500002f, -0.8398f, -0.541199982f, 0.0428999998f,
+	-0.00845499989f, 0.820629001f, -0.146240994f, 0.980099976f, 0.247199997f, -0.845000029f, -0.5255f, 0.0992999971f,
+	-0.00783300027f, 0.824416995f, -0.154553995f, 0.979099989f, 0.243100002f, -0.601899981f, -0.541400015f, -0.587000012f,
+	-0.00611199997f, 0.820789993f, -0.153024003f, 0.980799973f, 0.243900001f, -0.591600001f, -0.542699993f, -0.596199989f,
+	0.000163999997f, 0.820711017f, -0.155481994f, 0.983500004f, 0.242699996f, 0.00789999962f, -0.5449f, -0.838500023f,
+	-0.0896760002f, 0.901220024f, 0.0629900023f, 0.307300001f, 0.134399995f, 0.897499979f, -0.435499996f, -0.0688999966f,
+	-0.0887719989f, 0.885532022f, 0.0884890035f, 0.302300006f, 0.146799996f, 0.8028f, -0.457700014f, -0.382099986f,
+	-0.0991019979f, 0.873486996f, 0.0812150016f, 0.294999987f, 0.143999994f, 0.827199996f, -0.425099999f, -0.367399991f,
+	-0.0950300023f, 0.889566004f, 0.0595179982f, 0.301400006f, 0.133300006f, 0.905399978f, -0.422800004f, -0.0381000005f,
+	-0.0871590003f, 0.901452005f, 0.0293439999f, 0.307000011f, 0.119199999f, 0.831700027f, -0.547699988f, 0.0910999998f,
+	-0.0912209973f, 0.859221995f, 0.108484f, 0.292699993f, 0.158199996f, 0.849900007f, -0.33129999f, -0.409700006f,
+	-0.0974190012f, 0.854955018f, 0.0984039977f, 0.289000005f, 0.153899997f, 0.857299984f, -0.31189999f, -0.40959999f,
+	-0.100789003f, 0.827219009f, 0.113343999f, 0.278600007f, 0.163900003f, 0.789900005f, -0.406300008f, -0.459199995f,
+	-0.106991f, 0.827082992f, 0.103206001f, 0.276300013f, 0.159099996f, 0.771399975f, -0.433200002f, -0.466199994f,
+	-0.117604002f, 0.805629015f, 0.108907998f, 0.266099989f, 0.163599998f, 0.650399983f, -0.582599998f, -0.487500012f,
+	-0.119934f, 0.810535014f, 0.0996289998f, 0.2667f, 0.158800006f, 0.621599972f, -0.616900027f, -0.482800007f,
+	-0.137319997f, 0.804111004f, 0.0913060009f, 0.258599997f, 0.154300004f, 0.441199988f, -0.675599992f, -0.590600014f,
+	-0.137362003f, 0.79599297f, 0.100327f, 0.256099999f, 0.159500003f, 0.475899994f, -0.648199975f, -0.594399989f,
+	-0.160365999f, 0.803189993f, 0.0788329989f, 0.250099987f, 0.1461f, 0.44690001f, -0.639699996f, -0.62529999f,
+	-0.163985997f, 0.794156015f, 0.0850350037f, 0.246199995f, 0.149700001f, 0.4463f, -0.621100008f, -0.644200027f,
+	-0.181842998f, 0.796338975f, 0.0696630031f, 0.241500005f, 0.140300006f, 0.44749999f, -0.749100029f, -0.488499999f,
+	-0.194125995f, 0.798985004f, 0.0531819984f, 0.237200007f, 0.131799996f, 0.615199983f, -0.647899985f, -0.449099988f,
+	-0.185837001f, 0.809067011f, 0.0508790016f, 0.243000001f, 0.130400002f, 0.618799984f, -0.672800004f, -0.405499995f,
+	-0.173107997f, 0.794614017f, 0.0777269974f, 0.243900001f, 0.145099998f, 0.468699992f, -0.614400029f, -0.6347f,
+	-0.197949007f, 0.801783979f, 0.0387060009f, 0.237299994f, 0.125200003f, 0.585300028f, -0.804499984f, -0.101099998f,
+	-0.195859f, 0.803425014f, 0.0254250001f, 0.237499997f, 0.119000003f, 0.637199998f, -0.766300023f, 0.0826999992f,
+	-0.185947999f, 0.812491f, 0.0266319998f, 0.243499994f, 0.119400002f, 0.636799991f, -0.75910002f, 0.134900004f,
+	-0.187189996f, 0.804762006f, 0.0103900004f, 0.241400003f, 0.112300001f, 0.550000012f, -0.757799983f, 0.351000011f,
+	-0.167652994f, 0.815126002f, 0.00439399993f, 0.250400007f, 0.108400002f, 0.479000002f, -0.747099996f, 0.460900009f,
+	-0.172438994f, 0.806366026f, -0.00383100007f, 0.246199995f, 0.1043f, 0.485100001f, -0.724600017f, 0.489499986f,
+	-0.156666994f, 0.807847977f, -0.0155429998f, 0.252600014f, 0.0987000018f, 0.413700014f, -0.764299989f, 0.494700015f,
+	-0.133855999f, 0.819965005f, -0.0152759999f, 0.263900012f, 0.0966999978f, 0.499300003f, -0.771600008f, 0.39410001f,
+	-0.138200998f, 0.812170029f, -0.0249690004f, 0.260100007f, 0.0922000036f, 0.481700003f, -0.775600016f, 0.407799989f,
+	-0.114201002f, 0.827929974f, -0.0310340002f, 0.273000002f, 0.0891000032f, 0.675999999f, -0.672100008f, 0.302300006f,
+	-0.117170997f, 0.829257011f, -0.02104f, 0.272399992f, 0.0938000008f, 0.639400005f, -0.714900017f, 0.282999992f,
+	-0.100909002f, 0.846328974f, -0.0292760003f, 0.283199996f, 0.0905999988f, 0.803799987f, -0.517400026f, 0.293599993f,
+	-0.103652999f, 0.846861005f, -0.0208279993f, 0.282400012f, 0.0945999995f, 0.806500018f, -0.512799978f, 0.29429999f,
+	-0.0942400023f, 0.863291025f, -0.0236740001f, 0.291000009f, 0.0940999985f, 0.860000014f, -0.425300002f, 0.282099992f,
+	-0.0977419987f, 0.86283797f, -0.013909f, 0.289700001f, 0.0986000001f, 0.853600025f, -0.433999985f, 0.288199991f,
+	-0.0941250026f, 0.883257985f, 0.00622900017f, 0.298200011f, 0.1087f, 0.854900002f, -0.477400005f, 0.203299999f,
+	-0.0894050002f, 0.887139022f, -0.00476399995f, 0.300999999f, 0.103699997f, 0.87470001f, -0.428499997f, 0.226500005f,
+	-0.0932060033f, 0.892960012f, 0.0308110006f, 0.302300006f, 0.120099999f, 0.819899976f, -0.567200005f, 0.0780000016f,
+	0.0896760002f, 0.901220024f, 0.0629900023f, 0.227200001f, 0.0953999981f, -0.897499979f, -0.435499996f, -0.0688999966f,
+	0.0950300023f, 0.889566004f, 0.0595179982f, 0.221300006f, 0.0943000019f, -0.905399978f, -0.422800004f, -0.0381000005f,
+	0.0991019979f, 0.873486996f, 0.0812150016f, 0.214900002f, 0.104999997f, -0.827199996f, -0.425099999f, -0.367399991f,
+	0.0887719989f, 0.885532022f, 0.0884890035f, 0.222200006f, 0.107900001f, -0.8028f, -0.457700014f, -0.382099986f,
+	0.0871590003f, 0.901452005f, 0.0293439999f, 0.226899996f, 0.0803000033f, -0.831700027f, -0.547699988f, 0.0910999998f,
+	0.0932060033f, 0.892960012f, 0.0308110006f, 0.222200006f, 0.0811000019f, -0.819899976f, -0.567200005f, 0.0780000016f,
+	0.0894050002f, 0.887139022f, -0.00476399995f, 0.220899999f, 0.0647f, -0.87470001f, -0.428499997f, 0.226500005f,
+	0.0941250026f, 0.883257985f, 0.00622900017f, 0.218199998f, 0.0697000027f, -0.854900002f, -0.477400005f, 0.203299999f,
+	0.0942400023f, 0.863291025f, -0.0236740001f, 0.210899994f, 0.0551000014f, -0.860000014f, -0.425300002f, 0.282099992f,
+	0.0977419987f, 0.86283797f, -0.013909f, 0.209700003f, 0.0595999993f, -0.853600025f, -0.433999985f, 0.288199991f,
+	0.100909002f, 0.846328974f, -0.0292760003f, 0.203099996f, 0.0516999997f, -0.803799987f, -0.517400026f, 0.293599993f,
+	0.103652999f, 0.846861005f, -0.0208279993f, 0.202299997f, 0.0555999987f, -0.806500018f, -0.512799978f, 0.29429999f,
+	0.114201002f, 0.827929974f, -0.0310340002f, 0.192900002f, 0.0500999987f, -0.675999999f, -0.672100008f, 0.302300006f,
+	0.117170997f, 0.829257011f, -0.0210410003f, 0.192300007f, 0.0548f, -0.639400005f, -0.714900017f, 0.282999992f,
+	0.133855999f, 0.819965005f, -0.0152759999f, 0.183799997f, 0.0577999987f, -0.499300003f, -0.771600008f, 0.39410001f,
+	0.138200998f, 0.812170029f, -0.0249690004f, 0.180000007f, 0.053199999f, -0.481700003f, -0.775600016f, 0.407799989f,
+	0.167652994f, 0.815126002f, 0.00439399993f, 0.170399994f, 0.0693999976f, -0.479000002f, -0.747099996f, 0.460900009f,
+	0.156666994f, 0.807847977f, -0.0155429998f, 0.172499999f, 0.059799999f, -0.413700014f, -0.764299989f, 0.494700015f,
+	0.185947999f, 0.812491f, 0.0266319998f, 0.163499996f, 0.0803999975f, -0.636799991f, -0.75910002f, 0.134900004f,
+	0.187189996f, 0.804762006f, 0.0103900004f, 0.161300004f, 0.0733999982f, -0.550000012f, -0.757799983f, 0.351000011f,
+	0.172438994f, 0.806366026f, -0.00383100007f, 0.166099995f, 0.0653999969f, -0.485100001f, -0.724600017f, 0.489499986f,
+	0.185837001f, 0.809067011f, 0.0508790016f, 0.162900001f, 0.0913999975f, -0.618799984f, -0.672800004f, -0.405499995f,
+	0.195859f, 0.803425014f, 0.0254250001f, 0.157399997f, 0.0799999982f, -0.637199998f, -0.766300023f, 0.0826999992f,
+	0.160365999f, 0.803189993f, 0.0788329989f, 0.170100003f, 0.107100002f, -0.44690001f, -0.639699996f, -0.62529999f,
+	0.194125995f, 0.798985004f, 0.0531819984f, 0.157100007f, 0.0929000005f, -0.615199983f, -0.647899985f, -0.449099988f,
+	0.197949007f, 0.801783979f, 0.0387060009f, 0.157299995f, 0.0861999989f, -0.585300028f, -0.804499984f, -0.101099998f,
+	0.163985997f, 0.794156015f, 0.0850350037f, 0.166199997f, 0.110699996f, -0.4463f, -0.621100008f, -0.644200027f,
+	0.137362003f, 0.79599297f, 0.100327f, 0.176100001f, 0.120499998f, -0.475899994f, -0.648199975f, -0.594399989f,
+	0.137319997f, 0.804111004f, 0.0913060009f, 0.178599998f, 0.1153f, -0.441199988f, -0.675599992f, -0.590600014f,
+	0.181842998f, 0.796338975f, 0.0696619973f, 0.161400005f, 0.101400003f, -0.44749999f, -0.749100029f, -0.488499999f,
+	0.173107997f, 0.794614017f, 0.0777269974f, 0.163800001f, 0.1061f, -0.468699992f, -0.614400029f, -0.6347f,
+	0.117604002f, 0.805629015f, 0.108907998f, 0.186100006f, 0.124700002f, -0.650399983f, -0.582599998f, -0.487500012f,
+	0.119934f, 0.810535014f, 0.0996289998f, 0.1866f, 0.119800001f, -0.621599972f, -0.616900027f, -0.482800007f,
+	0.100789003f, 0.827219009f, 0.113343f, 0.198599994f, 0.125f, -0.789900005f, -0.406300008f, -0.459199995f,
+	0.106991f, 0.827082992f, 0.103206001f, 0.1963f, 0.120099999f, -0.771399975f, -0.433200002f, -0.466199994f,
+	0.0974190012f, 0.854955018f, 0.0984039977f, 0.208900005f, 0.115000002f, -0.857299984f, -0.31189999f, -0.40959999f,
+	0.0912209973f, 0.859221995f, 0.108484f, 0.212599993f, 0.1193f, -0.849900007f, -0.33129999f, -0.409700006f,
+	0.0106960004f, 0.849929988f, -0.156973004f, 0.975700021f, 0.254500002f, 0.716300011f, -0.143700004f, -0.682799995f,
+	0.0146770002f, 0.849761009f, -0.146449f, 0.976899981f, 0.25940001f, 0.989700019f, -0.141399994f, 0.0214000009f,
+	0.0109850001f, 0.824460983f, -0.146721005f, 0.965499997f, 0.261700004f, 0.988900006f, -0.148599997f, 0.0092000002f,
+	0.00779900001f, 0.824438989f, -0.154520005f, 0.96450001f, 0.257999986f, 0.704200029f, -0.146500006f, -0.694700003f,
+	1.80000006e-05f, 0.84958303f, -0.161532f, 0.973699987f, 0.249699995f, 0.0125000002f, -0.143000007f, -0.989600003f,
+	0.00990399998f, 0.849063993f, -0.136272997f, 0.977299988f, 0.264499992f, 0.682500005f, -0.141200006f, 0.717100024f,
+	0.00768399984f, 0.824515998f, -0.139036998f, 0.966099977f, 0.265500009f, 0.694000006f, -0.146400005f, 0.704999983f,
+	-7.00000019e-05f, 0.849515021f, -0.132230997f, 0.977800012f, 0.269300014f, -0.0289999992f, -0.154300004f, 0.987600029f,
+	-0.0f, 0.824532986f, -0.135892004f, 0.966400027f, 0.269199997f, -0.0362999998f, -0.146500006f, 0.988499999f,
+	-0.0105299996f, 0.849964976f, -0.136610001f, 0.977699995f, 0.274399996f, -0.706799984f, -0.157100007f, 0.689800024f,
+	-0.00722000003f, 0.824823976f, -0.139501005f, 0.966199994f, 0.272899985f, -0.682799995f, -0.1602f, 0.712800026f,
+	-0.0147620002f, 0.85026598f, -0.147055f, 0.976899981f, 0.279500008f, -0.989899993f, -0.141499996f, -0.00680000009f,
+	-0.0109959999f, 0.824455023f, -0.146721005f, 0.965399981f, 0.276499987f, -0.986100018f, -0.162300006f, 0.0359999985f,
+	-0.0f, 0.82437098f, -0.157895997f, 0.963100016f, 0.254299998f, 0.00400000019f, -0.144800007f, -0.989400029f,
+	-0.0102779996f, 0.849543989f, -0.157272995f, 0.971499979f, 0.245299995f, -0.700699985f, -0.142100006f, -0.699100018f,
+	-0.00783300027f, 0.824416995f, -0.154553995f, 0.961399972f, 0.250800014f, -0.705299973f, -0.147400007f, -0.693400025f,
+	-0.0147620002f, 0.85026598f, -0.147055f, 0.969099998f, 0.240799993f, -0.989899993f, -0.141499996f, -0.00680000009f,
+	-0.0109959999f, 0.824455023f, -0.146721005f, 0.959399998f, 0.247600004f, -0.986100018f, -0.162300006f, 0.0359999985f,
+	0.118937001f, 0.220962003f, -0.115851998f, 0.985400021f, 0.321500003f, 0.00689999992f, 0.983699977f, -0.1796f,
+	0.111372001f, 0.214886993f, -0.128496006f, 0.991699994f, 0.324999988f, 0.00820000004f, 0.899399996f, -0.437000006f,
+	-0.115801997f, 0.219323993f, -0.123607002f, 0.989099979f, 0.428000003f, 0.00209999993f, 0.96390003f, -0.266200006f,
+	-0.119717002f, 0.222383007f, -0.112296f, 0.983799994f, 0.429800004f, 0.00430000015f, 0.993499994f, -0.113700002f,
+	0.120159f, 0.220406994f, 0.116948001f, 0.879700005f, 0.32100001f, 0.00620000018f, 1.0f, 0.00219999999f,
+	-0.119592004f, 0.221926004f, 0.119323f, 0.878899992f, 0.429699987f, 0.00639999984f, 1.0f, 0.00200000009f,
+	0.0600440018f, 0.962734997f, 0.0787390023f, 0.665600002f, 0.428000003f, -0.926100016f, -0.340299994f, -0.162599996f,
+	0.060442999f, 0.969549f, 0.0569039993f, 0.664300025f, 0.425700009f, -0.944999993f, -0.324000001f, -0.0439000018f,
+	0.0706619993f, 0.940909982f, 0.0482960008f, 0.660300016f, 0.427399993f, -0.780300021f, -0.624300003f, 0.0384999998f,
+	0.0719889998f, 0.93551898f, 0.0725030005f, 0.662299991f, 0.430400014f, -0.760900021f, -0.568000019f, -0.313499987f,
+	0.059675999f, 0.947431028f, 0.098559998f, 0.666599989f, 0.430799991f, -0.914799988f, -0.247299999f, -0.319299996f,
+	0.0604359992f, 0.965992987f, 0.0309459995f, 0.662f, 0.423400015f, -0.946500003f, -0.294099987f, 0.132699996f,
+	0.0595850013f, 0.951085985f, 0.00679499982f, 0.658900023f, 0.421700001f, -0.930700004f, -0.276499987f, 0.239399999f,
+	0.0688930005f, 0.935167015f, 0.022473f, 0.657599986f, 0.424800009f, -0.750100017f, -0.579699993f, 0.318300009f,
+	0.143307999f, 0.901648998f, 0.0450319983f, 0.651600003f, 0.434500009f, -0.59740001f, -0.800700009f, 0.0447000004f,
+	0.0691459998f, 0.913869977f, 0.0944909975f, 0.663999975f, 0.434500009f, -0.706499994f, -0.382200003f, -0.595700026f,
+	0.0587150007f, 0.928113997f, 0.111727998f, 0.667200029f, 0.433499992f, -0.900300026f, -0.193000004f, -0.390199989f,
+	0.138260007f, 0.893074989f, 0.074382998f, 0.654299974f, 0.437599987f, -0.557099998f, -0.630999982f, -0.539799988f,
+	0.130294994f, 0.89152801f, 0.010636f, 0.648800015f, 0.430299997f, -0.520600021f, -0.64380002f, 0.560800016f,
+	0.150121003f, 0.859549999f, -0.00120099995f, 0.643400013f, 0.431400001f, -0.280999988f, -0.697000027f, 0.659699976f,
+	0.166950002f, 0.876335025f, 0.0303470008f, 0.646700025f, 0.435900003f, -0.443899989f, -0.791899979f, 0.419400007f,
+	0.175438002f, 0.875559986f, 0.0462599993f, 0.647499979f, 0.4384f, -0.5528f, -0.82099998f, -0.143000007f,
+	0.162955001f, 0.862290978f, 0.0762619972f, 0.65109998f, 0.441900015f, -0.416500002f, -0.609899998f, -0.674099982f,
+	0.0592829995f, 0.930130005f, -0.0115870005f, 0.655700028f, 0.420399994f, -0.922999978f, -0.216700003f, 0.318100005f,
+	0.0669410005f, 0.920446992f, 0.00400000019f, 0.654799998f, 0.423000008f, -0.715799987f, -0.455799997f, 0.529100001f,
+	0.119080998f, 0.879405975f, -0.00619499991f, 0.647000015f, 0.427700013f, -0.399300009f, -0.506699979f, 0.764100015f,
+	0.129646003f, 0.850027025f, -0.0163909998f, 0.642400026f, 0.4278f, -0.259799987f, -0.504800022f, 0.823199987f,
+	0.0590520017f, 0.892261982f, -0.0332110003f, 0.650300026f, 0.418599993f, -0.871699989f, -0.232199997f, 0.431600004f,
+	0.0695049986f, 0.887856007f, -0.0154630002f, 0.649900019f, 0.421400011f, -0.585600019f, -0.409000009f, 0.699800014f,
+	0.108461998f, 0.856262028f, -0.0223760009f, 0.643899977f, 0.425000012f, -0.281100005f, -0.3759f, 0.883000016f,
+	0.141463995f, 0.838980019f, -0.0223660003f, 0.639999986f, 0.428799987f, -0.111199997f, -0.56220001f, 0.819500029f,
+	0.151804999f, 0.84611398f, -0.01504f, 0.640900016f, 0.430500001f, -0.146300003f, -0.684899986f, 0.713800013f,
+	0.112410001f, 0.819966972f, -0.0365790017f, 0.638499975f, 0.423799992f, -0.172999993f, -0.443300009f, 0.879499972f,
+	0.105843998f, 0.836329997f, -0.02929f, 0.641300023f, 0.423799992f, -0.234300002f, -0.387899995f, 0.89139998f,
+	0.0722920001f, 0.846668005f, -0.0347569995f, 0.643899977f, 0.41960001f, -0.485599995f, -0.342500001f, 0.80430001f,
+	0.0627529994f, 0.848022997f, -0.0447949991f, 0.644200027f, 0.417699993f, -0.739700019f, -0.269300014f, 0.616699994f,
+	0.0731180012f, 0.804139018f, -0.0490510017f, 0.638100028f, 0.417600006f, -0.297899991f, -0.31310001f, 0.901799977f,
+	0.0817909986f, 0.828869998f, -0.0389170013f, 0.641099989f, 0.419999987f, -0.200200006f, -0.342000008f, 0.918099999f,
+	0.164106995f, 0.854689002f, -0.00424499996f, 0.64200002f, 0.432700008f, -0.134200007f, -0.773800015f, 0.619099975f,
+	0.173997998f, 0.861172974f, 0.00757300016f, 0.64319998f, 0.434399992f, -0.0829000026f, -0.915000021f, 0.394899994f,
+	0.181015f, 0.865114987f, 0.0194690004f, 0.644299984f, 0.435900003f, -0.289099991f, -0.856100023f, 0.42840001f,
+	0.185063004f, 0.866958976f, 0.0303130001f, 0.644999981f, 0.437400013f, -0.450100005f, -0.870299995f, 0.199900001f,
+	0.186987996f, 0.86748302f, 0.0420969985f, 0.645699978f, 0.439099997f, -0.514500022f, -0.849600017f, 0.115900002f,
+	0.187013f, 0.867810011f, 0.0483359993f, 0.646300018f, 0.439799994f, -0.467400014f, -0.84829998f, -0.248799995f,
+	0.185257003f, 0.863264978f, 0.0601899996f, 0.647400022f, 0.441300005f, -0.247099996f, -0.884199977f, -0.396499991f,
+	0.136533007f, 0.839797974f, 0.0985210016f, 0.655700028f, 0.4454f, -0.238700002f, -0.312400013f, -0.919499993f,
+	0.176632002f, 0.853667021f, 0.0790020004f, 0.649600029f, 0.443500012f, -0.266400009f, -0.659300029f, -0.703100026f,
+	0.123627f, 0.871002972f, 0.0965059996f, 0.657199979f, 0.441100001f, -0.356599987f, -0.326700002f, -0.87529999f,
+	0.182456002f, 0.859766006f, 0.0684470013f, 0.648299992f, 0.442200005f, -0.305500001f, -0.810199976f, -0.50029999f,
+	0.163901001f, 0.841547012f, 0.0912609994f, 0.651799977f, 0.445300013f, -0.1743f, -0.578800023f, -0.796599984f,
+	0.110711999f, 0.810090005f, 0.109210998f, 0.659699976f, 0.449299991f, -0.204699993f, -0.270799994f, -0.940599978f,
+	0.147319004f, 0.827389002f, 0.102537997f, 0.654500008f, 0.447400004f, -0.107699998f, -0.388700008f, -0.915000021f,
+	0.073439002f, 0.847929001f, 0.114853002f, 0.664600015f, 0.444000006f, -0.515299976f, -0.161200002f, -0.841700017f,
+	0.0692989975f, 0.886008978f, 0.106305003f, 0.664600015f, 0.438600004f, -0.623899996f, -0.259900004f, -0.736999989f,
+	0.0575239994f, 0.887435019f, 0.126114994f, 0.667699993f, 0.439099997f, -0.832000017f, -0.159999996f, -0.531199992f,
+	0.059071999f, 0.843195975f, 0.129954994f, 0.667100012f, 0.444999993f, -0.712300003f, -0.0670000017f, -0.698700011f,
+	0.0928220004f, 0.811470985f, 0.115162998f, 0.662299991f, 0.449099988f, -0.306300014f, -0.137600005f, -0.941900015f,
+	0.0637089983f, 0.808007002f, 0.127832994f, 0.665899992f, 0.449699998f, -0.455599993f, -0.0469999984f, -0.888899982f,
+	0.113562003f, 0.799820006f, 0.112534001f, 0.659399986f, 0.450800002f, -0.162100002f, -0.260899991f, -0.951699972f,
+	0.0721520036f, 0.780730009f, 0.121287003f, 0.665000021f, 0.453399986f, -0.325399995f, 0.0306000002f, -0.945100009f,
+	-0.181669995f, 0.86590898f, 0.0204860009f, 0.693099976f, 0.417899996f, 0.117600001f, -0.938499987f, 0.324499995f,
+	-0.173648f, 0.860884011f, 0.00641300017f, 0.694899976f, 0.418300003f, 0.0839999989f, -0.904600024f, 0.417899996f,
+	-0.150121003f, 0.859549999f, -0.00120099995f, 0.697000027f, 0.420899987f, 0.288500011f, -0.707799971f, 0.644800007f,
+	-0.174380004f, 0.874050021f, 0.0417690016f, 0.690999985f, 0.420399994f, 0.479099989f, -0.877699971f, -0.00810000021f,
+	-0.185343996f, 0.867317021f, 0.0316519998f, 0.691900015f, 0.418000013f, 0.377499998f, -0.905600011f, 0.193599999f,
+	-0.164106995f, 0.854689002f, -0.00424499996f, 0.69660002f, 0.418599993f, 0.128900006f, -0.765500009f, 0.630400002f,
+	-0.130294994f, 0.89152801f, 0.010636f, 0.6954f, 0.426800013f, 0.520600021f, -0.64380002f, 0.560800016f,
+	-0.143307999f, 0.901648998f, 0.0450330004f, 0.691299975f, 0.426899999f, 0.618399978f, -0.784300029f, 0.0496999994f,
+	-0.187497005f, 0.867861986f, 0.043056f, 0.690699995f, 0.418000013f, 0.362899989f, -0.919799984f, -0.149100006f,
+	-0.162955001f, 0.862290978f, 0.0762619972f, 0.687099993f, 0.421000004f, 0.422500014f, -0.629800022f, -0.651799977f,
+	-0.0688930005f, 0.935167015f, 0.022473f, 0.696099997f, 0.437599987f, 0.750100017f, -0.579699993f, 0.318300009f,
+	-0.0706619993f, 0.940909982f, 0.0482960008f, 0.692300022f, 0.438600004f, 0.780300021f, -0.624300003f, 0.0384999998f,
+	-0.0719889998f, 0.93551898f, 0.0725030005f, 0.688499987f, 0.438300014f, 0.760900021f, -0.568000019f, -0.313499987f,
+	-0.138260007f, 0.893074989f, 0.074382998f, 0.688199997f, 0.427100003f, 0.557099998f, -0.630999982f, -0.539799988f,
+	-0.0595850013f, 0.951085985f, 0.00679499982f, 0.698300004f, 0.440400004f, 0.930700004f, -0.276499987f, 0.239399999f,
+	-0.0600440018f, 0.962734997f, 0.0787390023f, 0.688399971f, 0.442699999f, 0.926100016f, -0.340299994f, -0.162599996f,
+	-0.060442999f, 0.969549f, 0.0569039993f, 0.691500008f, 0.443100005f, 0.944999993f, -0.324000001f, -0.0439000018f,
+	-0.0604359992f, 0.965992987f, 0.0309459995f, 0.694899976f, 0.442400008f, 0.946500003f, -0.294099987f, 0.132699996f,
+	-0.059675999f, 0.947431028f, 0.098559998f, 0.685400009f, 0.441399992f, 0.914799988f, -0.247299999f, -0.319299996f,
+	-0.0587150007f, 0.928113997f, 0.111727998f, 0.683000028f, 0.439500004f, 0.900300026f, -0.193000004f, -0.390199989f,
+	-0.0691459998f, 0.913869977f, 0.0944909975f, 0.684599996f, 0.436399996f, 0.706499994f, -0.382200003f, -0.595700026f,
+	-0.123627f, 0.871002972f, 0.0965059996f, 0.684899986f, 0.426800013f, 0.356599987f, -0.326700002f, -0.87529999f,
+	-0.0692989975f, 0.886008978f, 0.106305003f, 0.682200015f, 0.433299989f, 0.623899996f, -0.259900004f, -0.736999989f,
+	-0.0575239994f, 0.887435019f, 0.126114994f, 0.6796f, 0.435099989f, 0.833899975f, -0.161799997f, -0.527700007f,
+	-0.073439002f, 0.847929001f, 0.114853002f, 0.679499984f, 0.429100007f, 0.522499979f, -0.164399996f, -0.836600006f,
+	-0.136533007f, 0.839797974f, 0.0985210016f, 0.683700025f, 0.422300011f, 0.243499994f, -0.296600014f, -0.923399985f,
+	-0.147760004f, 0.826869011f, 0.101756997f, 0.683000028f, 0.419699997f, 0.114299998f, -0.352100015f, -0.92900002f,
+	-0.110711999f, 0.810090005f, 0.109210998f, 0.679700017f, 0.421799988f, 0.202500001f, -0.273400009f, -0.940400004f,
+	-0.161276996f, 0.838600993f, 0.0939349979f, 0.684800029f, 0.419200003f, 0.170200005f, -0.536899984f, -0.826300025f,
+	-0.0594069995f, 0.846185982f, 0.129954994f, 0.677399993f, 0.429699987f, 0.726499975f, -0.0715999976f, -0.683399975f,
+	-0.0928220004f, 0.811470985f, 0.115162998f, 0.678600013f, 0.423500001f, 0.310400009f, -0.135800004f, -0.940900028f,
+	-0.0634440035f, 0.810927987f, 0.128120005f, 0.676100016f, 0.426200002f, 0.466899991f, -0.0582999997f, -0.882399976f,
+	-0.113562003f, 0.799820006f, 0.112534001f, 0.679099977f, 0.42050001f, 0.154200003f, -0.260699987f, -0.953000009f,
+	-0.132361993f, 0.813751996f, 0.107780002f, 0.681200027f, 0.420100003f, -0.00939999986f, -0.41139999f, -0.91140002f,
+	-0.0721520036f, 0.780730009f, 0.121287003f, 0.674499989f, 0.421799988f, 0.321999997f, 0.0280000009f, -0.94630003f,
+	-0.168050006f, 0.844718993f, 0.0883129984f, 0.685800016f, 0.418900013f, 0.157399997f, -0.589100003f, -0.792599976f,
+	-0.176632002f, 0.853667021f, 0.0790020004f, 0.686999977f, 0.418500006f, 0.282999992f, -0.667599976f, -0.68870002f,
+	-0.185312003f, 0.863120019f, 0.0624470003f, 0.688899994f, 0.418000013f, 0.173099995f, -0.925999999f, -0.335599989f,
+	-0.00831899978f, 0.861128986f, -0.0554190017f, 0.1052f, 0.610499978f, -0.629299998f, -0.734700024f, 0.253399998f,
+	-0.0210350007f, 0.879356027f, -0.0383130014f, 0.115900002f, 0.617399991f, -0.571699977f, -0.734399974f, 0.365799993f,
+	-0.0266529992f, 0.880288005f, -0.0454099998f, 0.113200001f, 0.620599985f, -0.583800018f, -0.734499991f, 0.345800012f,
+	-0.0138590001f, 0.864067018f, -0.0617050007f, 0.103299998f, 0.614000022f, -0.64289999f, -0.7324f, 0.224199995f,
+	-0.0332279988f, 0.901722014f, -0.0149189997f, 0.129999995f, 0.624300003f, -0.483900011f, -0.796800017f, 0.361900002f,
+	-0.0405020006f, 0.904145002f, -0.0193109997f, 0.128700003f, 0.628099978f, -0.477400005f, -0.803200006f, 0.35620001f,
+	-0.0397780016f, 0.913773f, 0.0108589996f, 0.143000007f, 0.626699984f, -0.33919999f, -0.907100022f, 0.249300003f,
+	-0.0491000004f, 0.915948987f, 0.00647199992f, 0.1417f, 0.631299973f, -0.329899997f, -0.908100009f, 0.257999986f,
+	-0.0410309993f, 0.919165015f, 0.0320850015f, 0.152899995f, 0.626299977f, -0.285899997f, -0.937699974f, 0.197500005f,
+	-0.0507230014f, 0.921562016f, 0.0293109994f, 0.152400002f, 0.630999982f, -0.288500011f, -0.936699986f, 0.198300004f,
+	-0.0483499989f, 0.924672008f, 0.0489379987f, 0.161200002f, 0.628799975f, -0.262600005f, -0.942200005f, 0.208199993f,
+	-0.0391050018f, 0.921595991f, 0.0461749993f, 0.159199998f, 0.62470001f, -0.253399998f, -0.945500016f, 0.204699993f,
+	-0.0337660015f, 0.923222005f, 0.0597510003f, 0.165099993f, 0.621599972f, -0.263700008f, -0.92049998f, 0.288300008f,
+	-0.0417199992f, 0.926696002f, 0.0642760023f, 0.167799994f, 0.625100017f, -0.240500003f, -0.926699996f, 0.288599998f,
+	-0.0247450005f, 0.92343998f, 0.0696410015f, 0.169f, 0.616900027f, -0.3301f, -0.869000018f, 0.368499994f,
+	-0.0306499992f, 0.928318024f, 0.0754799992f, 0.172499999f, 0.619599998f, -0.3116f, -0.875699997f, 0.368800014f,
+	-0.011217f, 0.922060013f, 0.0757910013f, 0.171000004f, 0.610499978f, -0.216900006f, -0.903699994f, 0.369199991f,
+	-0.01456f, 0.926208973f, 0.0839840025f, 0.1752f, 0.611800015f, -0.217299998f, -0.887600005f, 0.405999988f,
+	0.0f, 0.920808017f, 0.0782560036f, 0.171499997f, 0.605199993f, -0.0f, -0.883099973f, 0.469300002f,
+	0.0f, 0.926307023f, 0.0874719992f, 0.176300004f, 0.605099976f, -0.0f, -0.858799994f, 0.512399971f,
+	0.01456f, 0.926208973f, 0.0839840025f, 0.174700007f, 0.598500013f, 0.217299998f, -0.887600005f, 0.405999988f,
+	0.011217f, 0.922060013f, 0.0757910013f, 0.170599997f, 0.600099981f, 0.216900006f, -0.903699994f, 0.369199991f,
+	0.0247450005f, 0.92343998f, 0.0696410015f, 0.168099999f, 0.593800008f, 0.3301f, -0.869000018f, 0.368499994f,
+	0.0306499992f, 0.928318024f, 0.0754799992f, 0.171399996f, 0.590900004f, 0.3116f, -0.875699997f, 0.368800014f,
+	0.0337660015f, 0.923222005f, 0.0597510003f, 0.163900003f, 0.58950001f, 0.263700008f, -0.92049998f, 0.288300008f,
+	0.0417199992f, 0.926696002f, 0.0642760023f, 0.166299999f, 0.585799992f, 0.240500003f, -0.926699996f, 0.288599998f,
+	0.0391050018f, 0.921595991f, 0.0461749993f, 0.157800004f, 0.586799979f, 0.253399998f, -0.945500016f, 0.204699993f,
+	0.0483499989f, 0.924672008f, 0.0489379987f, 0.159400001f, 0.582499981f, 0.262600005f, -0.942200005f, 0.208199993f,
+	0.0410309993f, 0.919165015f, 0.0320850015f, 0.1514f, 0.585699975f, 0.285899997f, -0.937699974f, 0.197500005f,
+	0.0507230014f, 0.921562016f, 0.0293109994f, 0.1505f, 0.581099987f, 0.288500011f, -0.936699986f, 0.198300004f,
+	0.0397780016f, 0.913773f, 0.0108589996f, 0.141399994f, 0.586000025f, 0.33919999f, -0.907100022f, 0.249300003f,
+	0.0491000004f, 0.915948987f, 0.00647199992f, 0.139799997f, 0.581499994f, 0.329899997f, -0.908100009f, 0.257999986f,
+	0.0332279988f, 0.901722014f, -0.0149189997f, 0.128700003f, 0.589399993f, 0.483900011f, -0.796800017f, 0.361900002f,
+	0.0405020006f, 0.904145002f, -0.0193109997f, 0.127100006f, 0.585699975f, 0.477400005f, -0.803200006f, 0.35620001f,
+	0.0210360009f, 0.879356027f, -0.0383130014f, 0.115199998f, 0.59740001f, 0.571699977f, -0.734399974f, 0.365799993f,
+	0.0266529992f, 0.880288005f, -0.0454099998f, 0.112300001f, 0.594399989f, 0.583800018f, -0.734499991f, 0.345800012f,
+	0.00831899978f, 0.861128986f, -0.0554190017f, 0.105099998f, 0.605099976f, 0.629299998f, -0.734700024f, 0.253399998f,
+	0.0138590001f, 0.864067018f, -0.0617050007f, 0.102799997f, 0.601700008f, 0.64289999f, -0.7324f, 0.224199995f,
+	0.158519998f, 0.122040004f, -0.188996002f, 0.834100008f, 0.702300012f, 0.1338f, 0.981599987f, -0.136000007f,
+	-0.156955004f, 0.121234f, -0.190971002f, 0.977599978f, 0.697000027f, -0.0719000027f, 0.982299984f, -0.172800004f,
+	-0.137960002f, 0.131133005f, -0.142596006f, 0.969399989f, 0.719600022f, -0.1796f, 0.979200006f, -0.0948999971f,
+	0.137271002f, 0.131125003f, -0.144308999f, 0.844600022f, 0.722599983f, 0.181799993f, 0.978799999f, -0.0944000036f,
+	0.168993995f, 0.120107003f, -0.175867006f, 0.829100013f, 0.708599985f, 0.28490001f, 0.957400024f, -0.0478999987f,
+	-0.167523995f, 0.120832004f, -0.184184998f, 0.982800007f, 0.700100005f, -0.189199999f, 0.976100028f, -0.107299998f,
+	-0.164480001f, 0.124410003f, 0.187105998f, 0.986500025f, 0.868900001f, -0.0364000015f, 0.99000001f, 0.136099994f,
+	-0.133292004f, 0.130592003f, 0.149325997f, 0.971599996f, 0.852100015f, -0.0952000022f, 0.991599977f, 0.0870999992f,
+	-0.158801004f, 0.123153001f, 0.192460999f, 0.983900011f, 0.871599972f, 0.023f, 0.982599974f, 0.184f,
+	0.138992995f, 0.129521996f, 0.147799999f, 0.84799999f, 0.855199993f, 0.137500003f, 0.986299992f, 0.0910999998f,
+	0.154115006f, 0.120714001f, 0.193128005f, 0.841600001f, 0.876299977f, 0.0100999996f, 0.982200027f, 0.1875f,
+	0.16663f, 0.122252002f, 0.184165999f, 0.835699975f, 0.872200012f, 0.0886999965f, 0.987200022f, 0.132400006f,
+	0.0f, 0.912510991f, 0.152336001f, 0.56400001f, 0.959800005f, -0.0103000002f, -0.510100007f, -0.860000014f,
+	0.00179300003f, 0.912747979f, 0.153251007f, 0.56400001f, 0.958999991f, 0.448500007f, -0.477200001f, -0.755699992f,
+	0.001239f, 0.908855021f, 0.156474993f, 0.566299975f, 0.958899975f, 0.3574f, -0.644299984f, -0.676100016f,
+	0.0f, 0.908149004f, 0.156525001f, 0.566600025f, 0.959500015f, -0.00120000006f, -0.692600012f, -0.721300006f,
+	0.00259799999f, 0.919831991f, 0.150911003f, 0.560599983f, 0.958899975f, 0.272199988f, -0.232500002f, -0.933700025f,
+	0.0f, 0.919710994f, 0.150234997f, 0.560599983f, 0.959999979f, -0.00590000022f, -0.236399993f, -0.971599996f,
+	-0.00173300004f, 0.912766993f, 0.153274f, 0.564100027f, 0.960500002f, -0.47240001f, -0.472900003f, -0.743799984f,
+	-0.00255399989f, 0.919449985f, 0.151032001f, 0.560899973f, 0.961199999f, -0.286900014f, -0.239700004f, -0.92750001f,
+	-0.00123299996f, 0.908859015f, 0.156474993f, 0.566399992f, 0.960099995f, -0.364300013f, -0.641799986f, -0.674899995f,
+	0.00513899978f, 0.934894979f, 0.148581997f, 0.55369997f, 0.958000004f, 0.270099998f, -0.0954999998f, -0.958100021f,
+	0.0f, 0.934496999f, 0.147448003f, 0.553900003f, 0.960399985f, -0.0131000001f, -0.115599997f, -0.993200004f,
+	-0.00508099981f, 0.934588015f, 0.148619995f, 0.55400002f, 0.962800026f, -0.228100002f, -0.0710000023f, -0.971000016f,
+	0.0f, 0.94641602f, 0.146595001f, 0.548399985f, 0.960399985f, 0.0190999992f, -0.0952000022f, -0.995299995f,
+	0.00671799993f, 0.944123983f, 0.149774998f, 0.549600005f, 0.957099974f, 0.417800009f, -0.0351999998f, -0.907899976f,
+	-0.00836000033f, 0.947800994f, 0.149592996f, 0.547999978f, 0.964600027f, -0.323799998f, -0.105899997f, -0.940199971f,
+	0.00886000041f, 0.951499999f, 0.149743006f, 0.546400011f, 0.956099987f, 0.375499994f, -0.138699993f, -0.916400015f,
+	0.0f, 0.985189974f, 0.140791997f, 0.530700028f, 0.960099995f, 0.0027999999f, -0.234300002f, -0.972199976f,
+	-0.0134030003f, 0.986496985f, 0.143705994f, 0.530300021f, 0.966400027f, -0.208900005f, -0.244800001f, -0.946799994f,
+	0.0134159997f, 0.986492991f, 0.143696994f, 0.530499995f, 0.953800023f, 0.208100006f, -0.253199995f, -0.944800019f,
+	0.0f, 1.01211202f, 0.132716998f, 0.517799973f, 0.959900022f, -0.00100000005f, -0.42809999f, -0.903699994f,
+	-0.0178350005f, 1.01141798f, 0.135453999f, 0.518400013f, 0.967999995f, -0.116800003f, -0.432200015f, -0.894200027f,
+	0.0178740006f, 1.01139796f, 0.135424003f, 0.518700004f, 0.951699972f, 0.116300002f, -0.430500001f, -0.895099998f,
+	0.0f, 1.02371395f, 0.125698999f, 0.511500001f, 0.959800005f, 0.000600000028f, -0.617799997f, -0.786300004f,
+	-0.0190900005f, 1.02195501f, 0.129006997f, 0.512899995f, 0.968400002f, -0.0808999985f, -0.606299996f, -0.791100025f,
+	0.0190520007f, 1.02198398f, 0.129036993f, 0.513100028f, 0.951200008f, 0.0829000026f, -0.604300022f, -0.792400002f,
+	0.0f, 1.03314602f, 0.116742f, 0.505500019f, 0.959900022f, 0.000300000014f, -0.774999976f, -0.632000029f,
+	-0.0199059993f, 1.03065801f, 0.120787002f, 0.507499993f, 0.968800008f, -0.0259000007f, -0.763599992f, -0.645200014f,
+	0.0199050009f, 1.03065896f, 0.120788001f, 0.507600009f, 0.950900018f, 0.0252999999f, -0.765100002f, -0.643400013f,
+	0.0f, 1.04008806f, 0.106388003f, 0.499799997f, 0.959900022f, -0.000300000014f, -0.943499982f, -0.331499994f,
+	-0.0186299998f, 1.04033399f, 0.104463004f, 0.498899996f, 0.968200028f, -0.0219999999f, -0.931900024f, -0.362100005f,
+	0.0186449997f, 1.04031801f, 0.104456998f, 0.4991f, 0.951499999f, 0.0211999994f, -0.931999981f, -0.361699998f,
+	0.0f, 1.04137301f, 0.0909420028f, 0.492700011f, 0.959800005f, -0.000199999995f, -0.99940002f, -0.0333000012f,
+	-0.016059f, 1.04345596f, 0.0934550017f, 0.493699998f, 0.967199981f, -0.153099999f, -0.973100007f, -0.172099993f,
+	0.0160649996f, 1.04344594f, 0.0934540033f, 0.493999988f, 0.952499986f, 0.152600005f, -0.973100007f, -0.172900006f,
+	0.0130690001f, 1.04242003f, 0.0765239969f, 0.486400008f, 0.953599989f, 0.188500002f, -0.976300001f, 0.1065f,
+	0.0f, 1.03943503f, 0.0749979988f, 0.485300004f, 0.959599972f, 0.000199999995f, -0.985300004f, 0.170699999f,
+	-0.0130709996f, 1.04241598f, 0.0765239969f, 0.486000001f, 0.965699971f, -0.188099995f, -0.976300001f, 0.107299998f,
+	0.0f, 1.03796899f, 0.0682279989f, 0.48210001f, 0.959500015f, 0.00079999998f, -0.970099986f, 0.242500007f,
+	0.00896300003f, 1.04014206f, 0.0666989982f, 0.48179999f, 0.955299973f, 0.250800014f, -0.946699977f, 0.202099994f,
+	-0.00897500012f, 1.04012299f, 0.0667010024f, 0.481599987f, 0.963699996f, -0.249599993f, -0.94690001f, 0.202800006f,
+	0.0f, 1.03447902f, 0.0578619987f, 0.477200001f, 0.959299982f, -0.00240000011f, -0.919799984f, 0.39230001f,
+	0.003272f, 1.03456497f, 0.0571050011f, 0.476900011f, 0.957899988f, 0.125499994f, -0.888199985f, 0.441900015f,
+	-0.00324300001f, 1.03458905f, 0.0570800006f, 0.476799995f, 0.960699975f, -0.134499997f, -0.891499996f, 0.432599992f,
+	0.0f, 1.02884698f, 0.0566430017f, 0.595899999f, 0.993399978f, -0.00499999989f, -0.787800014f, 0.615999997f,
+	0.0f, 1.02605999f, 0.0528980009f, 0.593800008f, 0.992900014f, -9.99999975e-05f, -0.802200019f, 0.597000003f,
+	0.00338599994f, 1.02643502f, 0.0522040017f, 0.593999982f, 0.991400003f, 0.574100018f, -0.67930001f, 0.457100004f,
+	0.00423000008f, 1.02939296f, 0.0555519983f, 0.596099973f, 0.991400003f, 0.569800019f, -0.681800008f, 0.458799988f,
+	0.00817599986f, 1.03304899f, 0.0501689985f, 0.595799983f, 0.987900019f, 0.934899986f, -0.325300008f, -0.142199993f,
+	0.00607899996f, 1.02829194f, 0.0480859987f, 0.593500018f, 0.989099979f, 0.921899974f, -0.384200007f, -0.0507999994f,
+	0.00439300016f, 1.03092897f, 0.0436480008f, 0.592400014f, 0.986999989f, 0.683300018f, -0.0197000001f, -0.729900002f,
+	0.00513899978f, 1.036165f, 0.0444389991f, 0.594099998f, 0.985199988f, 0.611999989f, 0.0522999987f, -0.789099991f,
+	0.0f, 1.03161597f, 0.0420080014f, 0.590900004f, 0.985800028f, -0.00730000017f, 0.1382f, -0.990400016f,
+	0.0f, 1.03747904f, 0.0429989994f, 0.592299998f, 0.983500004f, -0.0119000003f, 0.166700006f, -0.985899985f,
+	-0.00502499985f, 1.03611302f, 0.0445399992f, 0.589999974f, 0.98269999f, -0.617699981f, 0.0714000016f, -0.783200026f,
+	-0.00439100014f, 1.03092802f, 0.0436509997f, 0.589100003f, 0.985000014f, -0.686100006f, 0.0037f, -0.727500021f,
+	-0.00811500009f, 1.03305197f, 0.0501659997f, 0.586799979f, 0.9824f, -0.940199971f, -0.311500013f, -0.137600005f,
+	-0.00607899996f, 1.02829194f, 0.0480859987f, 0.586799979f, 0.985000014f, -0.925599992f, -0.375699997f, -0.0461999997f,
+	-0.00338499993f, 1.02643502f, 0.0522040017f, 0.584599972f, 0.985499978f, -0.579299986f, -0.670300007f, 0.463800013f,
+	-0.00417899992f, 1.02942801f, 0.0554939993f, 0.583599985f, 0.983699977f, -0.578599989f, -0.667900026f, 0.468100011f,
+	0.0f, 1.02605999f, 0.0528980009f, 0.583299994f, 0.986400008f, -9.99999975e-05f, -0.802200019f, 0.597000003f,
+	0.0f, 1.02884698f, 0.0566430017f, 0.581900001f, 0.984799981f, -0.00499999989f, -0.787800014f, 0.615999997f,
+	-0.0339200012f, 0.979272008f, -0.00124400004f, 0.152400002f, 0.657599986f, 0.594900012f, 0.741699994f, -0.309799999f,
+	-0.0338889994f, 0.980599999f, -0.000739999989f, 0.151899993f, 0.658100009f, 0.484200001f, -0.513599992f, -0.708299994f,
+	-0.0302009992f, 0.978788018f, 0.00309500005f, 0.150199994f, 0.656199992f, 0.67110002f, -0.1919f, -0.716099977f,
+	-0.0311110001f, 0.983915985f, -0.00608099997f, 0.150700003f, 0.660899997f, 0.065200001f, -0.93779999f, -0.340999991f,
+	-0.0285020005f, 0.982744992f, -0.00196400005f, 0.149399996f, 0.658999979f, 0.26820001f, -0.870999992f, -0.411500007f,
+	-0.0239819996f, 0.986284018f, -0.0158259999f, 0.147699997f, 0.665600002f, -0.0922000036f, -0.981899977f, -0.165399998f,
+	-0.0213649999f, 0.985345006f, -0.0115369996f, 0.146400005f, 0.663699985f, -0.0309999995f, -0.983099997f, -0.180600002f,
+	-0.0148949996f, 0.985889971f, -0.0252609998f, 0.143700004f, 0.670000017f, -0.193399996f, -0.981100023f, -0.00730000017f,
+	-0.0124819996f, 0.985441983f, -0.0194789991f, 0.142499998f, 0.667400002f, -0.121799998f, -0.992500007f, -0.00449999981f,
+	-0.0f, 0.981324971f, -0.037103001f, 0.136800006f, 0.675599992f, -0.0f, -0.993499994f, 0.113799997f,
+	-0.0f, 0.982854009f, -0.0268530007f, 0.136800006f, 0.670899987f, -0.0f, -0.989099979f, 0.147499993f,
+	0.0124819996f, 0.985441983f, -0.0194789991f, 0.131099999f, 0.667400002f, 0.121799998f, -0.992500007f, -0.00449999981f,
+	0.0148949996f, 0.985889971f, -0.0252609998f, 0.129899994f, 0.670000017f, 0.193399996f, -0.981100023f, -0.00730000017f,
+	0.0213649999f, 0.985345006f, -0.0115369996f, 0.127200007f, 0.663699985f, 0.0309999995f, -0.983099997f, -0.180600002f,
+	0.0239819996f, 0.986284018f, -0.0158259999f, 0.1259f, 0.665600002f, 0.0922000036f, -0.981899977f, -0.165399998f,
+	0.0285020005f, 0.982744992f, -0.00196400005f, 0.124200001f, 0.658999979f, -0.26820001f, -0.870999992f, -0.411500007f,
+	0.0311110001f, 0.983915985f, -0.00608099997f, 0.122900002f, 0.660899997f, -0.065200001f, -0.93779999f, -0.340999991f,
+	0.0302009992f, 0.978788018f, 0.00309500005f, 0.123300001f, 0.656199992f, -0.67110002f, -0.1919f, -0.716099977f,
+	0.0338889994f, 0.980599999f, -0.000739999989f, 0.121699996f, 0.658100009f, -0.484200001f, -0.513599992f, -0.708299994f,
+	0.0339200012f, 0.979272008f, -0.00124400004f, 0.121200003f, 0.657599986f, -0.594900012f, 0.741699994f, -0.309799999f,
+	0.0302419998f, 0.977991998f, 0.00253099995f, 0.123000003f, 0.655900002f, -0.610800028f, 0.701099992f, -0.368000001f,
+	0.0257089995f, 0.977208972f, -0.0169459991f, 0.114200003f, 0.653599977f, -0.246299997f, 0.969200015f, -0.00380000006f,
+	0.0218739994f, 0.976288974f, -0.0126470001f, 0.1162f, 0.651799977f, -0.226099998f, 0.974099994f, -0.00680000009f,
+	0.00885299966f, 0.972424984f, -0.0366149992f, 0.105599999f, 0.645399988f, -0.156900004f, 0.984899998f, -0.0736000016f,
+	0.00389500009f, 0.972181022f, -0.0311299991f, 0.108099997f, 0.64319998f, -0.140300006f, 0.986599982f, -0.0829000026f,
+	-0.211151004f, 0.0214380007f, -0.236570001f, 0.747300029f, 0.620899975f, -0.0733999982f, 0.99150002f, -0.107600003f,
+	-0.209052995f, 0.0200500004f, 0.245176002f, 0.748000026f, 0.401600003f, -0.115400001f, 0.985199988f, 0.127200007f,
+	-0.195466995f, 0.0245220009f, 0.219550997f, 0.754400015f, 0.413300008f, -0.226400003f, 0.972800016f, 0.0491000004f,
+	-0.194898993f, 0.0246859994f, -0.217507005f, 0.754800022f, 0.612200022f, -0.187800005f, 0.981400013f, -0.0388999991f,
+	0.212422997f, 0.0201890003f, -0.233620003f, 0.761500001f, 0.418599993f, 0.256700009f, 0.966099977f, 0.0275999997f,
+	0.196132004f, 0.0239649992f, -0.214755997f, 0.76910001f, 0.42719999f, 0.202600002f, 0.979300022f, -0.00350000011f,
+	0.192054003f, 0.0259939991f, 0.223351002f, 0.770900011f, 0.625899971f, 0.145999998f, 0.985099971f, 0.0904999971f,
+	0.211237997f, 0.0207550004f, 0.236884996f, 0.761900008f, 0.632099986f, 0.220500007f, 0.97329998f, 0.0640999973f,
+	-0.188399002f, 0.0242199991f, 0.225431994f, 0.785700023f, 0.605099976f, -0.0296f, 0.983900011f, 0.176499993f,
+	-0.195466995f, 0.0245220009f, 0.219550997f, 0.788399994f, 0.608200014f, -0.226400003f, 0.972800016f, 0.0491000004f,
+	-0.209052995f, 0.0200500004f, 0.245176002f, 0.776600003f, 0.614499986f, -0.115400001f, 0.985199988f, 0.127200007f,
+	0.199790001f, 0.0219509993f, 0.245174006f, 0.776600003f, 0.428600013f, 0.0939000025f, 0.984300017f, 0.149499997f,
+	0.192054003f, 0.0259939991f, 0.223351002f, 0.78670001f, 0.432300001f, 0.145999998f, 0.985099971f, 0.0904999971f,
+	0.211237997f, 0.0207550004f, 0.236884996f, 0.780499995f, 0.423299998f, 0.220500007f, 0.97329998f, 0.0640999973f,
+	-0.188842997f, 0.0256629996f, -0.222185001f, 0.795799971f, 0.582300007f, -0.0935999975f, 0.980700016f, -0.171800002f,
+	0.191685006f, 0.0243309997f, -0.222718f, 0.79610002f, 0.409399986f, 0.0581f, 0.995500028f, -0.0754000023f,
+	0.206838995f, 0.0220599994f, -0.241019994f, 0.804400027f, 0.402500004f, 0.1461f, 0.988699973f, -0.0348000005f,
+	-0.203950003f, 0.0205710009f, -0.242827997f, 0.805299997f, 0.58920002f, -0.0346999988f, 0.983200014f, -0.179100007f,
+	-0.194898993f, 0.0246859994f, -0.217507005f, 0.79369998f, 0.584999979f, -0.187800005f, 0.981400013f, -0.0388999991f,
+	0.196132004f, 0.0239649992f, -0.214755997f, 0.792500019f, 0.407400012f, 0.202600002f, 0.979300022f, -0.00350000011f,
+	0.212422997f, 0.0201890003f, -0.233620003f, 0.801100016f, 0.399800003f, 0.256700009f, 0.966099977f, 0.0275999997f,
+	-0.211151004f, 0.0214380007f, -0.236570001f, 0.802399993f, 0.592499971f, -0.0733999982f, 0.99150002f, -0.107600003f,
+	0.00238900003f, 1.01854205f, 0.0468759984f, 0.574899971f, 0.960799992f, 0.546599984f, -0.525699973f, 0.651799977f,
+	0.00338599994f, 1.02643502f, 0.0522040017f, 0.574800014f, 0.96509999f, 0.577799976f, -0.504700005f, 0.641499996f,
+	0.0f, 1.02605999f, 0.0528980009f, 0.573199987f, 0.964900017f, -9.99999975e-05f, -0.582400024f, 0.812900007f,
+	0.0f, 1.01856196f, 0.0473049991f, 0.573800027f, 0.960799992f, 0.000199999995f, -0.597899973f, 0.801599979f,
+	0.00525700022f, 1.02095401f, 0.0429779999f, 0.577400029f, 0.960900009f, 0.990199983f, -0.139200002f, 0.0108000003f,
+	0.00607899996f, 1.02829194f, 0.0480859987f, 0.577199996f, 0.964900017f, 0.984099984f, -0.161599994f, 0.0737999976f,
+	0.00439300016f, 1.03092897f, 0.0436480008f, 0.579699993f, 0.9648f, 0.726599991f, 0.264600009f, -0.63410002f,
+	0.00371100008f, 1.02289295f, 0.039694f, 0.579299986f, 0.960799992f, 0.699500024f, 0.26730001f, -0.662699997f,
+	0.0f, 1.03161597f, 0.0420080014f, 0.581799984f, 0.964399993f, -0.000300000014f, 0.414099991f, -0.9102f,
+	0.0f, 1.02347898f, 0.0382979997f, 0.581200004f, 0.960500002f, 9.99999975e-05f, 0.414799988f, -0.90990001f,
+	-0.00371100008f, 1.02289402f, 0.039694f, 0.583100021f, 0.960200012f, -0.699400008f, 0.267699987f, -0.662699997f,
+	-0.00439100014f, 1.03092802f, 0.0436509997f, 0.583999991f, 0.964100003f, -0.726599991f, 0.264999986f, -0.633899987f,
+	-0.00526000001f, 1.02095306f, 0.0429779999f, 0.584900022f, 0.959699988f, -0.9903f, -0.138799995f, 0.0109000001f,
+	-0.00607899996f, 1.02829194f, 0.0480859987f, 0.586399972f, 0.963400006f, -0.984200001f, -0.161200002f, 0.0737999976f,
+	-0.00239000004f, 1.01854205f, 0.0468759984f, 0.587199986f, 0.958800018f, -0.546400011f, -0.525600016f, 0.65200001f,
+	-0.00338499993f, 1.02643502f, 0.0522040017f, 0.588699996f, 0.962800026f, -0.577799976f, -0.504499972f, 0.641600013f,
+	0.0f, 1.02605999f, 0.0528980009f, 0.59009999f, 0.962100029f, -9.99999975e-05f, -0.582400024f, 0.812900007f,
+	0.0f, 1.01856196f, 0.0473049991f, 0.588199973f, 0.958400011f, 0.000199999995f, -0.597899973f, 0.801599979f,
+	
+};
+
+inline const unsigned short alliance_mesh_indices[] = {
+	0, 1, 2, 2, 1, 3, 3, 4, 2, 4, 3, 5, 5, 6, 4, 6, 5, 7, 7, 8, 6, 8, 7, 9,
+	9, 10, 8, 10, 9, 11, 11, 12, 10, 13, 12, 11, 11, 14, 13, 13, 14, 15, 16, 17, 18, 19, 16, 18,
+	18, 17, 20, 20, 21, 18, 18, 21, 22, 22, 19, 18, 21, 20, 23, 23, 24, 21, 21, 25, 26, 26, 22, 21,
+	23, 27, 28, 28, 24, 23, 29, 28, 27, 27, 30, 29, 31, 29, 30, 30, 32, 31, 33, 31, 32, 32, 34, 33,
+	35, 33, 34, 34, 36, 35, 37, 35, 36, 38, 39, 26, 26, 25, 38, 39, 38, 40, 40, 41, 39, 41, 40, 42,
+	42, 43, 41, 43, 42, 44, 44, 45, 43, 45, 44, 46, 46, 47, 45, 46, 48, 47, 49, 50, 51, 51, 52, 49,
+	53, 52, 51, 51, 54, 53, 54, 55, 53, 56, 53, 55, 55, 57, 56, 56, 57, 58, 58, 59, 56, 58, 60, 59,
+	61, 62, 59, 59, 60, 61, 61, 63, 64, 64, 62, 61, 65, 66, 67, 66, 68, 69, 69, 67, 66, 70, 71, 72,
+	72, 73, 70, 74, 70, 73, 73, 75, 74, 76, 74, 75, 75, 77, 76, 76, 77, 78, 78, 79, 76, 80, 81, 82,
+	82, 83, 80, 81, 80, 84, 84, 85, 81, 85, 84, 86, 86, 87, 85, 86, 88, 89, 89, 87, 86, 90, 91, 92,
+	93, 94, 95, 95, 96, 93, 97, 93, 98, 98, 93, 96, 99, 94, 93, 93, 97, 99, 100, 94, 99, 101, 102, 94,
+	94, 100, 101, 95, 94, 102, 95, 103, 104, 104, 96, 95, 103, 95, 102, 96, 105, 98, 105, 96, 104, 98, 106, 97,
+	107, 98, 105, 106, 98, 107, 105, 108, 107, 108, 105, 109, 104, 109, 105, 110, 109, 104, 104, 111, 110, 112, 111, 104,
+	104, 103, 112, 102, 113, 103, 112, 103, 113, 113, 114, 112, 109, 110, 91, 109, 90, 108, 91, 90, 109, 115, 107, 108,
+	108, 92, 115, 92, 108, 90, 107, 116, 106, 116, 107, 115, 115, 117, 116, 118, 117, 115, 115, 119, 118, 115, 120, 121,
+	121, 119, 115, 116, 122, 123, 123, 106, 116, 122, 116, 117, 117, 124, 122, 117, 118, 125, 125, 124, 117, 126, 118, 119,
+	118, 126, 127, 127, 125, 118, 119, 121, 128, 128, 129, 119, 119, 129, 126, 130, 128, 121, 121, 131, 130, 131, 121, 120,
+	120, 132, 131, 130, 131, 132, 128, 130, 133, 132, 134, 130, 133, 130, 134, 129, 128, 135, 133, 135, 128, 136, 126, 129,
+	129, 137, 136, 135, 137, 129, 126, 136, 138, 138, 127, 126, 139, 127, 138, 125, 127, 139, 140, 138, 136, 136, 141, 140,
+	141, 136, 137, 137, 135, 142, 142, 143, 137, 137, 143, 141, 142, 135, 133, 133, 144, 142, 142, 145, 143, 145, 142, 144,
+	141, 143, 146, 147, 146, 143, 143, 145, 147, 146, 140, 141, 148, 140, 146, 146, 149, 148, 149, 146, 147, 147, 150, 149,
+	148, 149, 151, 152, 151, 149, 149, 153, 152, 150, 153, 149, 151, 154, 148, 153, 155, 152, 155, 153, 156, 153, 150, 156,
+	157, 158, 155, 156, 157, 155, 144, 159, 145, 159, 144, 160, 160, 161, 159, 160, 144, 133, 133, 162, 160, 134, 162, 133,
+	163, 164, 165, 165, 166, 163, 165, 167, 168, 168, 166, 165, 167, 169, 170, 170, 168, 167, 171, 170, 169, 169, 172, 171,
+	172, 173, 171, 173, 172, 174, 174, 175, 173, 174, 176, 177, 177, 175, 174, 176, 178, 177, 178, 176, 179, 179, 180, 178,
+	181, 182, 183, 183, 184, 181, 183, 182, 185, 185, 186, 183, 186, 185, 187, 187, 188, 186, 188, 187, 189, 189, 190, 188,
+	190, 189, 191, 192, 190, 191, 191, 193, 192, 192, 193, 194, 194, 195, 192, 195, 194, 196, 197, 195, 196, 196, 198, 197,
+	199, 200, 201, 200, 199, 202, 201, 200, 203, 202, 204, 200, 205, 206, 207, 207, 208, 205, 209, 205, 208, 210, 207, 206,
+	206, 211, 210, 212, 213, 210, 210, 211, 212, 214, 215, 212, 212, 216, 214, 212, 217, 213, 217, 212, 215, 218, 214, 219,
+	214, 216, 219, 220, 221, 218, 218, 219, 220, 220, 222, 223, 223, 221, 220, 224, 223, 222, 224, 222, 225, 225, 226, 224,
+	227, 226, 225, 228, 226, 227, 227, 229, 228, 228, 229, 230, 229, 231, 232, 232, 233, 229, 229, 233, 234, 234, 230, 229,
+	234, 235, 230, 231, 236, 232, 237, 232, 236, 236, 209, 237, 208, 237, 209, 238, 239, 240, 241, 239, 238, 238, 242, 241,
+	243, 239, 241, 241, 242, 244, 244, 245, 241, 243, 241, 246, 246, 247, 243, 246, 248, 247, 249, 247, 248, 248, 250, 249,
+	249, 250, 251, 251, 250, 252, 252, 253, 251, 252, 254, 255, 255, 253, 252, 255, 254, 256, 256, 254, 257, 256, 257, 258,
+	258, 259, 256, 258, 260, 261, 261, 262, 258, 258, 262, 263, 259, 258, 263, 263, 264, 259, 263, 265, 264, 261, 260, 266,
+	266, 267, 261, 266, 268, 269, 269, 270, 266, 270, 267, 266, 269, 268, 271, 271, 244, 269, 245, 244, 271, 272, 273, 274,
+	274, 275, 272, 276, 272, 275, 275, 277, 276, 278, 276, 277, 277, 279, 278, 278, 279, 280, 280, 281, 278, 282, 281, 280,
+	280, 283, 282, 284, 282, 283, 283, 285, 284, 284, 285, 286, 286, 287, 284, 288, 287, 286, 286, 289, 288, 290, 288, 289,
+	289, 291, 290, 292, 293, 290, 290, 291, 292, 294, 295, 296, 296, 297, 294, 298, 294, 297, 295, 299, 300, 300, 296, 295,
+	296, 300, 301, 301, 302, 296, 297, 296, 302, 297, 303, 298, 303, 297, 304, 302, 304, 297, 305, 306, 298, 298, 303, 307,
+	307, 305, 298, 304, 308, 303, 309, 307, 303, 303, 308, 309, 308, 310, 309, 301, 300, 311, 311, 312, 301, 313, 311, 300,
+	300, 299, 313, 314, 315, 316, 316, 317, 314, 318, 314, 317, 319, 316, 315, 315, 320, 319, 321, 317, 316, 316, 322, 321,
+	322, 316, 319, 323, 324, 317, 317, 321, 323, 317, 324, 318, 318, 324, 325, 325, 326, 318, 327, 325, 324, 324, 323, 327,
+	323, 328, 329, 329, 327, 323, 328, 323, 321, 321, 330, 328, 330, 321, 322, 319, 331, 322, 322, 332, 330, 332, 322, 331,
+	333, 334, 330, 330, 332, 333, 328, 330, 334, 334, 335, 328, 328, 335, 336, 336, 329, 328, 336, 337, 329, 327, 329, 337,
+	325, 327, 338, 337, 338, 327, 338, 339, 325, 325, 339, 326, 340, 341, 333, 333, 332, 340, 331, 340, 332, 342, 341, 340,
+	343, 342, 340, 340, 331, 343, 344, 343, 331, 331, 319, 344, 344, 319, 320, 345, 346, 347, 347, 348, 345, 346, 345, 349,
+	347, 346, 350, 351, 350, 346, 346, 352, 351, 349, 352, 346, 350, 353, 347, 354, 347, 353, 348, 347, 354, 354, 355, 348,
+	353, 356, 354, 357, 354, 356, 357, 355, 354, 353, 350, 358, 358, 359, 353, 356, 353, 359, 350, 351, 360, 360, 358, 350,
+	361, 351, 352, 351, 361, 362, 362, 360, 351, 352, 363, 361, 363, 352, 349, 364, 361, 363, 361, 364, 365, 365, 362, 361,
+	360, 362, 366, 366, 362, 365, 367, 358, 360, 360, 368, 367, 366, 368, 360, 369, 359, 358, 358, 367, 369, 370, 359, 369,
+	359, 370, 356, 369, 371, 370, 372, 370, 371, 373, 356, 370, 370, 372, 373, 356, 373, 357, 363, 374, 364, 363, 375, 374,
+	349, 375, 363, 376, 377, 378, 378, 379, 376, 380, 378, 377, 377, 381, 380, 382, 383, 384, 384, 385, 382, 382, 385, 386,
+	387, 388, 389, 389, 390, 387, 388, 387, 391, 391, 392, 388, 392, 391, 393, 393, 394, 392, 394, 393, 395, 395, 396, 394,
+	396, 395, 397, 397, 398, 396, 398, 397, 399, 399, 400, 398, 399, 401, 402, 402, 400, 399, 402, 401, 403, 403, 404, 402,
+	405, 404, 403, 403, 406, 405, 407, 405, 406, 406, 408, 407, 407, 408, 409, 409, 410, 407, 411, 410, 409, 409, 412, 411,
+	413, 414, 411, 411, 412, 413, 414, 413, 415, 415, 416, 414, 416, 415, 417, 417, 418, 416, 418, 417, 419, 419, 420, 418,
+	420, 419, 421, 421, 422, 420, 422, 421, 423, 423, 424, 422, 423, 425, 426, 426, 424, 423, 427, 428, 429, 427, 429, 430,
+	430, 431, 427, 432, 427, 431, 428, 427, 432, 428, 433, 429, 429, 433, 434, 434, 430, 429, 428, 435, 433, 433, 435, 436,
+	436, 434, 433, 435, 428, 437, 435, 437, 438, 438, 436, 435, 439, 437, 428, 437, 439, 440, 440, 438, 437, 439, 441, 442,
+	442, 440, 439, 439, 428, 441, 441, 432, 443, 443, 442, 441, 441, 428, 432, 431, 443, 432, 444, 445, 446, 446, 447, 444,
+	448, 444, 447, 445, 449, 450, 450, 446, 445, 449, 451, 452, 452, 450, 449, 451, 453, 454, 454, 452, 451, 453, 455, 456,
+	456, 454, 453, 455, 457, 458, 458, 456, 455, 457, 448, 459, 459, 458, 457, 447, 459, 448, 460, 461, 462, 462, 463, 460,
+	464, 465, 466, 466, 467, 464, 468, 464, 467, 465, 469, 470, 470, 466, 465, 469, 471, 472, 472, 470, 469, 471, 473, 474,
+	474, 472, 471, 473, 475, 476, 476, 474, 473, 475, 477, 478, 478, 476, 475, 477, 468, 479, 479, 478, 477, 467, 479, 468,
+	480, 481, 482, 482, 483, 480, 484, 481, 480, 480, 485, 484, 486, 487, 488, 488, 489, 486, 487, 486, 490, 490, 491, 487,
+	492, 493, 494, 494, 495, 492, 493, 492, 496, 496, 497, 493, 497, 496, 498, 498, 499, 497, 498, 500, 501, 501, 499, 498,
+	502, 501, 500, 500, 503, 502, 504, 502, 503, 503, 505, 504, 504, 505, 506, 506, 507, 504, 507, 506, 508, 508, 509, 507,
+	509, 508, 510, 510, 511, 509, 511, 510, 512, 512, 513, 511, 513, 512, 514, 514, 515, 513, 515, 514, 516, 516, 517, 515,
+	517, 516, 518, 518, 519, 517, 520, 519, 518, 518, 521, 520, 522, 520, 521, 521, 523, 522, 522, 523, 524, 524, 525, 522,
+	525, 524, 526, 527, 528, 525, 525, 526, 527, 528, 527, 529, 529, 530, 528, 530, 529, 531, 531, 532, 530, 531, 495, 494,
+	494, 532, 531, 533, 534, 535, 535, 536, 533, 537, 533, 536, 535, 534, 538, 538, 539, 535, 540, 539, 538, 538, 541, 540,
+	542, 540, 541, 541, 543, 542, 544, 542, 543, 543, 545, 544, 544, 545, 546, 547, 544, 546, 546, 548, 547, 549, 550, 547,
+	547, 548, 549, 550, 549, 551, 551, 552, 550, 553, 552, 551, 551, 554, 553, 555, 553, 554, 554, 556, 555, 557, 555, 556,
+	556, 558, 557, 559, 557, 558, 558, 560, 559, 561, 559, 560, 560, 562, 561, 563, 561, 562, 562, 564, 563, 565, 563, 564,
+	564, 566, 565, 567, 568, 565, 565, 566, 567, 568, 567, 569, 569, 570, 568, 570, 569, 571, 571, 572, 570, 573, 572, 571,
+	571, 537, 573, 536, 573, 537, 574, 575, 576, 576, 577, 574, 575, 574, 578, 579, 580, 575, 575, 578, 579, 580, 579, 581,
+	582, 580, 581, 581, 583, 582, 584, 582, 583, 583, 585, 584, 586, 584, 585, 585, 587, 586, 586, 587, 588, 588, 589, 586,
+	589, 588, 590, 590, 591, 589, 591, 590, 592, 592, 593, 591, 593, 592, 594, 594, 595, 593, 595, 594, 596, 596, 597, 595,
+	597, 596, 598, 598, 599, 597, 600, 599, 598, 598, 601, 600, 602, 600, 601, 601, 603, 602, 602, 603, 604, 604, 605, 602,
+	605, 604, 606, 605, 606, 607, 607, 606, 608, 608, 609, 607, 607, 609, 576, 576, 609, 577, 610, 611, 612, 612, 613, 610,
+	613, 614, 610, 612, 611, 615, 616, 612, 615, 617, 616, 615, 618, 616, 619, 616, 617, 619, 618, 619, 620, 621, 618, 620,
+	620, 622, 621, 623, 624, 621, 621, 622, 623, 624, 623, 625, 625, 626, 624, 627, 626, 625, 625, 628, 627, 629, 627, 628,
+	628, 630, 629, 631, 629, 630, 630, 632, 631, 633, 631, 632, 632, 634, 633, 635, 633, 634, 634, 636, 635, 637, 635, 636,
+	636, 638, 637, 639, 640, 637, 637, 638, 639, 640, 639, 641, 641, 642, 640, 642, 641, 643, 643, 644, 642, 644, 643, 645,
+	613, 644, 645, 645, 614, 613, 646, 647, 648, 646, 649, 650, 650, 651, 646, 647, 646, 651, 651, 652, 647, 653, 654, 647,
+	647, 652, 653, 655, 651, 650, 656, 652, 651, 651, 655, 656, 653, 652, 656, 653, 657, 658, 658, 654, 653, 653, 659, 660,
+	660, 657, 653, 656, 659, 653, 655, 661, 656, 650, 662, 655, 663, 662, 650, 650, 664, 663, 665, 664, 650, 650, 649, 665,
+	658, 657, 666, 666, 657, 660, 666, 667, 658, 660, 668, 666, 669, 670, 671, 669, 672, 673, 673, 674, 669, 672, 669, 671,
+	671, 675, 672, 676, 675, 671, 671, 677, 676, 673, 672, 678, 679, 678, 672, 672, 675, 679, 679, 675, 676, 676, 677, 680,
+	680, 681, 676, 676, 681, 682, 682, 683, 676, 676, 683, 679, 678, 679, 684, 678, 685, 673, 673, 685, 686, 686, 687, 673,
+	673, 687, 688, 688, 674, 673, 682, 681, 689, 689, 690, 682, 689, 681, 680, 680, 691, 689, 692, 693, 694, 694, 695, 692,
+	694, 693, 696, 696, 697, 694, 698, 694, 697, 697, 696, 699, 699, 696, 700, 701, 697, 702, 699, 702, 697, 697, 701, 698,
+	701, 703, 698, 702, 704, 701, 701, 704, 705, 703, 701, 705, 706, 704, 702, 702, 699, 706, 700, 706, 699, 707, 700, 708,
+	706, 700, 707, 704, 706, 705, 706, 709, 710, 710, 705, 706, 707, 709, 706, 705, 710, 703, 711, 709, 712, 709, 707, 712,
+	708, 713, 707, 707, 713, 714, 714, 712, 707, 713, 708, 715, 714, 713, 716, 715, 716, 713, 716, 717, 714, 717, 716, 718,
+	716, 715, 719, 719, 718, 716, 718, 720, 717, 721, 722, 723, 723, 724, 721, 725, 726, 721, 721, 724, 725, 723, 722, 727,
+	727, 728, 723, 728, 727, 729, 729, 730, 728, 731, 730, 729, 729, 732, 731, 733, 734, 735, 735, 736, 733, 734, 733, 737,
+	737, 738, 734, 738, 737, 739, 739, 740, 738, 739, 741, 742, 742, 740, 739, 743, 744, 745, 746, 747, 748, 748, 749, 746,
+	746, 749, 750, 750, 751, 746, 752, 748, 747, 747, 753, 752, 752, 753, 754, 754, 755, 752, 755, 754, 756, 756, 757, 755,
+	757, 756, 758, 758, 759, 757, 759, 758, 760, 760, 761, 759, 761, 760, 762, 762, 763, 761, 763, 762, 764, 764, 765, 763,
+	765, 764, 766, 766, 767, 765, 767, 766, 768, 768, 769, 767, 768, 770, 771, 771, 769, 768, 772, 771, 770, 770, 773, 772,
+	774, 775, 772, 772, 773, 774, 775, 774, 776, 776, 777, 775, 777, 776, 778, 778, 779, 777, 778, 780, 781, 781, 782, 778,
+	782, 779, 778, 783, 784, 785, 785, 786, 783, 787, 784, 783, 783, 788, 787, 788, 789, 787, 790, 791, 792, 792, 793, 790,
+	794, 790, 793, 793, 795, 794, 796, 797, 798, 798, 799, 796, 800, 801, 796, 796, 799, 800, 802, 803, 804, 802, 805, 806,
+	806, 803, 802, 807, 808, 809, 809, 810, 807, 811, 807, 810, 812, 810, 809, 809, 813, 812, 812, 814, 810, 815, 816, 817,
+	817, 818, 815, 817, 816, 819, 819, 820, 817, 821, 822, 823, 823, 824, 821, 824, 823, 825, 825, 826, 824, 827, 828, 829,
+	829, 830, 827, 831, 832, 833, 833, 834, 831, 835, 836, 837, 837, 838, 835, 836, 835, 839, 839, 840, 836, 839, 841, 840,
+	842, 843, 844, 844, 845, 842, 842, 845, 846, 846, 847, 842, 848, 849, 850, 851, 852, 848, 848, 850, 851, 852, 851, 853,
+	853, 854, 852, 853, 855, 856, 856, 854, 853, 855, 857, 858, 858, 856, 855, 859, 858, 857, 857, 860, 859, 860, 861, 859,
+	862, 863, 864, 865, 863, 862, 862, 866, 865, 867, 865, 866, 866, 868, 867, 867, 868, 869, 869, 870, 867, 870, 869, 871,
+	871, 872, 870, 872, 871, 873, 873, 874, 872, 874, 873, 875, 876, 877, 878, 878, 879, 876, 880, 876, 881, 879, 881, 876,
+	882, 883, 880, 880, 884, 882, 881, 884, 880, 885, 883, 882, 882, 886, 885, 885, 886, 887, 887, 888, 885, 887, 889, 890,
+	890, 888, 887, 890, 889, 891, 891, 892, 890, 893, 894, 895, 895, 896, 893, 897, 893, 898, 894, 893, 897, 898, 899, 897,
+	900, 899, 898, 898, 901, 900, 902, 903, 900, 900, 901, 902, 902, 904, 905, 905, 903, 902, 905, 904, 906, 906, 907, 905,
+	908, 907, 906, 906, 909, 908, 910, 911, 912, 911, 910, 913, 912, 911, 914, 915, 916, 912, 912, 914, 915, 916, 915, 917,
+	917, 918, 916, 918, 917, 919, 919, 920, 918, 920, 919, 921, 921, 922, 920, 923, 922, 921, 921, 924, 923, 925, 923, 924,
+	924, 926, 925, 927, 925, 926, 926, 928, 927, 929, 930, 927, 927, 928, 929, 930, 929, 931, 931, 932, 930, 933, 932, 931,
+	931, 934, 933, 934, 935, 933, 933, 935, 936, 937, 938, 939, 939, 940, 937, 941, 942, 938, 938, 943, 941, 938, 942, 939,
+	944, 941, 943, 943, 945, 944, 946, 944, 945, 945, 947, 946, 948, 946, 947, 947, 949, 948, 950, 951, 948, 948, 949, 950,
+	951, 950, 952, 952, 953, 951, 953, 952, 954, 954, 955, 953, 956, 955, 954, 954, 957, 956, 958, 956, 957, 957, 959, 958,
+	960, 961, 958, 958, 959, 960, 961, 960, 962, 960, 963, 962, 964, 965, 966, 967, 968, 969, 969, 970, 967, 971, 972, 973,
+	973, 974, 971, 975, 976, 977, 977, 978, 975, 979, 980, 981, 982, 980, 983, 980, 982, 981, 983, 984, 982, 984, 983, 985,
+	985, 986, 984, 985, 987, 988, 988, 986, 985, 989, 988, 987, 987, 990, 989, 991, 989, 990, 990, 992, 991, 992, 993, 991,
+	994, 995, 996, 996, 997, 994, 994, 997, 998, 998, 999, 994, 1000, 1001, 1002, 1002, 1003, 1000, 1004, 1002, 1005, 1002, 1004, 1003,
+	1006, 1007, 1003, 1003, 1004, 1006, 1008, 1009, 1004, 1005, 1008, 1004, 1010, 1011, 1006, 1012, 1007, 1006, 1006, 1011, 1012, 1013, 1014, 1015,
+	1015, 1016, 1013, 1013, 1016, 1017, 1018, 1015, 1014, 1014, 1019, 1018, 1020, 1021, 1018, 1018, 1019, 1020, 1021, 1020, 1022, 1022, 1023, 1021,
+	1023, 1022, 1024, 1024, 1025, 1023, 1026, 1025, 1024, 1016, 1027, 1017, 1028, 1029, 1030, 1030, 1031, 1028, 1032, 1033, 1034, 1034, 1035, 1032,
+	1036, 1037, 1038, 1039, 1040, 1041, 1041, 1040, 1042, 1042, 1043, 1041, 1043, 1042, 1044, 1044, 1045, 1043, 1045, 1044, 1046, 1046, 1047, 1045,
+	1046, 1048, 1049, 1049, 1047, 1046, 1048, 1050, 1051, 1051, 1049, 1048, 1050, 1052, 1051, 1053, 1054, 1055, 1055, 1056, 1053, 1057, 1058, 1059,
+	1059, 1060, 1057, 1061, 1062, 1063, 1063, 1064, 1061, 1065, 1066, 1067, 1067, 1068, 1065, 1069, 1070, 1071, 1072, 1071, 1070, 1070, 1073, 1072,
+	1074, 1072, 1073, 1073, 1075, 1074, 1075, 1076, 1074, 1076, 1075, 1077, 1077, 1078, 1076, 1078, 1077, 1079, 1079, 1080, 1078, 1080, 1079, 1081,
+	1082, 1083, 1084, 1084, 1085, 1082, 1085, 1084, 1086, 1086, 1087, 1085, 1087, 1086, 1088, 1088, 1089, 1087, 1089, 1088, 1090, 1090, 1091, 1089,
+	1091, 1090, 1092, 1092, 1093, 1091, 1093, 1092, 1094, 1094, 1095, 1093, 1096, 1095, 1094, 1094, 1097, 1096, 1098, 1096, 1097, 1097, 1099, 1098,
+	1100, 1098, 1099, 1101, 1102, 1103, 1103, 1104, 1101, 1105, 1101, 1104, 1104, 1106, 1105, 1107, 1108, 1109, 1109, 1110, 1107, 1108, 1107, 1111,
+	1111, 1112, 1108, 1113, 1114, 1115, 1115, 1116, 1113, 1114, 1113, 1117, 1117, 1118, 1114, 1117, 1119, 1120, 1120, 1118, 1117, 1119, 1121, 1122,
+	1122, 1120, 1119, 1121, 1123, 1124, 1124, 1122, 1121, 1116, 1115, 1125, 1125, 1126, 1116, 1127, 1128, 1129, 1129, 1130, 1127, 1131, 1127, 1130,
+	1128, 1132, 1133, 1133, 1129, 1128, 1130, 1134, 1131, 1131, 1134, 1135, 1135, 1136, 1131, 1136, 1135, 1137, 1137, 1138, 1136, 1138, 1137, 1139,
+	1139, 1140, 1138, 1141, 1142, 1143, 1143, 1144, 1141, 1145, 1142, 1141, 1141, 1146, 1145, 1147, 1148, 1149, 1149, 1150, 1147, 1151, 1147, 1150,
+	1149, 1148, 1152, 1152, 1153, 1149, 1153, 1152, 1154, 1154, 1155, 1153, 1155, 1154, 1156, 1156, 1157, 1155, 1157, 1156, 1158, 1158, 1159, 1157,
+	1160, 1159, 1158, 1161, 1159, 1160, 1160, 1162, 1161, 1161, 1162, 1163, 1164, 1161, 1163, 1163, 1165, 1164, 1150, 1166, 1151, 1151, 1166, 1167,
+	1168, 1167, 1169, 1167, 1168, 1151, 1169, 1170, 1168, 1170, 1169, 1171, 1171, 1172, 1170, 1172, 1171, 1173, 1173, 1174, 1172, 1174, 1173, 1175,
+	1175, 1176, 1174, 1176, 1175, 1177, 1177, 1178, 1176, 1179, 1178, 1177, 1177, 1180, 1179, 1181, 1179, 1180, 1180, 1182, 1181, 1181, 1182, 1183,
+	1183, 1184, 1181, 1184, 1183, 1185, 1185, 1186, 1184, 1186, 1185, 1187, 1187, 1188, 1186, 1188, 1187, 1189, 1189, 1190, 1188, 1189, 1191, 1192,
+	1192, 1193, 1189, 1190, 1189, 1193, 1194, 1195, 1191, 1191, 1196, 1194, 1195, 1192, 1191, 1197, 1198, 1199, 1199, 1200, 1197, 1201, 1202, 1203,
+	1203, 1204, 1201, 1205, 1201, 1204, 1204, 1206, 1205, 1207, 1208, 1209, 1209, 1210, 1207, 1211, 1212, 1213, 1213, 1214, 1211, 1215, 1216, 1217,
+	1217, 1218, 1215, 1219, 1215, 1218, 1218, 1220, 1219, 1221, 1222, 1223, 1223, 1224, 1221, 1222, 1225, 1226, 1226, 1223, 1222, 1225, 1227, 1228,
+	1228, 1226, 1225, 1227, 1229, 1230, 1230, 1228, 1227, 1229, 1231, 1232, 1232, 1230, 1229, 1231, 1233, 1234, 1234, 1232, 1231, 1233, 1235, 1236,
+	1236, 1234, 1233, 1235, 1237, 1238, 1238, 1236, 1235, 1239, 1240, 1241, 1241, 1242, 1239, 1243, 1244, 1245, 1245, 1246, 1243, 1247, 1248, 489,
+	489, 488, 1247, 1249, 1248, 1247, 1247, 1250, 1249, 1249, 1251, 1248, 1252, 1249, 1250, 1249, 1252, 1253, 1253, 1254, 1249, 1083, 1082, 1249,
+	1249, 1254, 1083, 1249, 1082, 1251, 1255, 1253, 1252, 1252, 1256, 1255, 1257, 1255, 1256, 1256, 1258, 1257, 1259, 1257, 1258, 1258, 1260, 1259,
+	1261, 1259, 1260, 1260, 1262, 1261, 1263, 1261, 1262, 1262, 1264, 1263, 1265, 1263, 1264, 1264, 1266, 1265, 1265, 1266, 1267, 1267, 1268, 1265,
+	1268, 1267, 1269, 1269, 1270, 1268, 1269, 1271, 1270, 1272, 1273, 1274, 1274, 1275, 1272, 1276, 1272, 1275, 1275, 1277, 1276, 1278, 1279, 1280,
+	1280, 1281, 1278, 1281, 1282, 1278, 1283, 1278, 1282, 1282, 1284, 1283, 1285, 1286, 1287, 1287, 1288, 1285, 215, 1289, 217, 217, 1289, 1290,
+	1291, 1292, 1293, 1293, 1294, 1291, 1292, 1295, 1296, 1296, 1293, 1292, 1297, 1298, 1299, 1299, 1300, 1297, 1301, 1297, 1300, 1300, 1302, 1301,
+	1303, 1304, 1305, 1305, 1306, 1303, 1304, 1303, 1307, 1307, 1308, 1304, 1309, 1310, 1311, 1311, 1312, 1309, 1310, 1309, 1313, 1313, 1314, 1310,
+	1314, 1313, 1315, 1315, 1316, 1314, 1316, 1315, 1317, 1317, 1318, 1316, 1318, 1317, 1319, 1319, 1320, 1318, 1319, 1321, 1322, 1322, 1320, 1319,
+	1322, 1321, 1323, 1323, 1324, 1322, 1323, 1325, 1326, 1326, 1324, 1323, 1325, 1327, 1328, 1328, 1326, 1325, 1327, 1329, 1330, 1330, 1328, 1327,
+	1329, 1331, 1332, 1332, 1330, 1329, 1333, 1332, 1331, 1331, 1334, 1333, 1335, 1333, 1334, 1334, 1336, 1335, 1335, 1336, 1337, 1337, 1336, 1338,
+	1338, 1339, 1337, 1339, 1338, 1340, 1341, 1340, 1338, 1338, 1342, 1341, 1343, 1344, 1341, 1341, 1342, 1343, 1345, 1346, 1343, 1343, 1347, 1345,
+	1343, 1346, 1344, 1347, 1348, 1345, 1348, 1347, 1312, 1312, 1311, 1348, 1349, 1350, 1351, 1351, 1352, 1349, 1349, 1353, 1354, 1354, 1355, 1349,
+	1349, 1355, 1356, 1356, 1350, 1349, 1351, 1357, 1358, 1358, 1352, 1351, 1359, 1355, 1354, 1360, 1361, 1362, 1362, 1363, 1360, 1361, 1360, 1364,
+	1364, 1365, 1361, 1365, 1364, 1366, 1366, 1367, 1365, 1368, 1367, 1366, 1368, 1366, 1369, 1369, 1370, 1368, 1370, 1369, 1371, 1371, 1372, 1370,
+	1371, 1373, 1374, 1374, 1372, 1371, 1374, 1373, 1375, 1375, 1376, 1374, 1376, 1375, 1377, 1377, 1378, 1376, 1378, 1377, 1379, 1379, 1380, 1378,
+	1379, 1381, 1382, 1382, 1380, 1379, 1382, 1381, 1383, 1383, 1384, 1382, 1385, 1386, 1387, 1387, 1388, 1385, 1389, 1385, 1388, 1388, 1390, 1389,
+	1391, 1389, 1390, 1390, 1392, 1391, 1393, 1391, 1392, 1394, 1391, 1393, 1393, 1395, 1394, 1396, 1394, 1395, 1395, 1397, 1396, 1396, 1397, 1398,
+	1398, 1399, 1396, 1400, 1399, 1398, 1398, 1401, 1400, 1402, 1400, 1401, 1401, 1403, 1402, 1404, 1402, 1403, 1403, 1405, 1404, 1404, 1405, 1406,
+	1406, 1407, 1404, 1408, 1407, 1406, 1406, 1409, 1408, 1410, 1411, 1412, 1412, 1413, 1410, 1414, 1415, 1416, 1414, 1417, 1418, 1414, 1418, 1415,
+	1419, 1415, 1420, 1421, 1415, 1418, 1420, 1415, 1421, 1415, 1419, 1416, 1422, 1423, 1418, 1418, 1417, 1422, 1418, 1423, 1424, 1424, 1425, 1418,
+	1418, 1425, 1421, 1421, 1426, 1420, 1420, 1426, 1427, 1420, 1428, 1419, 1429, 1428, 1420, 1420, 1430, 1429, 1427, 1430, 1420, 1427, 1431, 1432,
+	1432, 1430, 1427, 1430, 1432, 1433, 1433, 1429, 1430, 1433, 1432, 1434, 1434, 1432, 1431, 1431, 1435, 1434, 1434, 1436, 1433, 1436, 1434, 1437,
+	1434, 1435, 1438, 1438, 1437, 1434, 1437, 1439, 1436, 1439, 1437, 1440, 1437, 1438, 1441, 1441, 1440, 1437, 1440, 1442, 1439, 1442, 1440, 1443,
+	1443, 1440, 1441, 1441, 1444, 1443, 1443, 1445, 1442, 1445, 1443, 1446, 1447, 1446, 1443, 1443, 1448, 1447, 1448, 1443, 1444, 1444, 1449, 1448,
+	1450, 1448, 1449, 1447, 1448, 1450, 1450, 1451, 1447, 1452, 1447, 1451, 1446, 1447, 1452, 1446, 1453, 1445, 1452, 1454, 1446, 1453, 1446, 1454,
+	1451, 1455, 1452, 1452, 1455, 1456, 1456, 1457, 1452, 1454, 1452, 1457, 1458, 1451, 1450, 1451, 1458, 1459, 1459, 1455, 1451, 1450, 1460, 1458,
+	1460, 1450, 1461, 1449, 1461, 1450, 1462, 1463, 1458, 1458, 1460, 1462, 1459, 1458, 1463, 1462, 1460, 1464, 1464, 1460, 1465, 1461, 1465, 1460,
+	1464, 1466, 1462, 1466, 1464, 1423, 1424, 1423, 1464, 1464, 1467, 1424, 1465, 1467, 1464, 1423, 1422, 1466, 1463, 1468, 1459, 1459, 1468, 1469,
+	1469, 1470, 1459, 1470, 1469, 1471, 1459, 1470, 1472, 1472, 1470, 1473, 1471, 1473, 1470, 1473, 1471, 1474, 1473, 1475, 1472, 1476, 1475, 1473,
+	1473, 1477, 1476, 1474, 1477, 1473, 1472, 1478, 1459, 1478, 1456, 1455, 1455, 1459, 1478, 1476, 1477, 1479, 1477, 1474, 1480, 1479, 1477, 1480,
+	1479, 1481, 1476, 1482, 1481, 1479, 1479, 1483, 1482, 1484, 1479, 1480, 1479, 1485, 1486, 1486, 1483, 1479, 1484, 1485, 1479, 1487, 1488, 1482,
+	1482, 1483, 1487, 1487, 1483, 1486, 1486, 1489, 1487, 1487, 1490, 1491, 1491, 1488, 1487, 1490, 1487, 1489, 1489, 1492, 1490, 1493, 1491, 1490,
+	1490, 1494, 1493, 1495, 1494, 1490, 1490, 1492, 1495, 1496, 1497, 1493, 1493, 1494, 1496, 1494, 1495, 1498, 1498, 1496, 1494, 1497, 1496, 1499,
+	1500, 1499, 1496, 1496, 1498, 1500, 1499, 1501, 1497, 1502, 1501, 1499, 1499, 1454, 1502, 1499, 1500, 1503, 1503, 1454, 1499, 1457, 1502, 1454,
+	1454, 1503, 1453, 1504, 1505, 1506, 1506, 1507, 1504, 1508, 1506, 1505, 1505, 1509, 1508, 1510, 1511, 1512, 1512, 1513, 1510, 1511, 1510, 1514,
+	1514, 1515, 1511, 1516, 1517, 1518, 1518, 1519, 1516, 1517, 1516, 1520, 1520, 1521, 1517, 1522, 1519, 1518, 1518, 1523, 1522, 1524, 1525, 1522,
+	1522, 1523, 1524, 1526, 1525, 1524, 1524, 1527, 1526, 1528, 1526, 1527, 1527, 1529, 1528, 1530, 1531, 1532, 1532, 1533, 1530, 1534, 1530, 1533,
+	1532, 1531, 1535, 1535, 1536, 1532, 1537, 1536, 1535, 1535, 1538, 1537, 1539, 1540, 1537, 1537, 1538, 1539, 1540, 1539, 1541, 1541, 1542, 1540,
+	1533, 1543, 1534, 1544, 1545, 1546, 1547, 1545, 1544, 1548, 1545, 1547, 1549, 1548, 1547, 1549, 1547, 1550, 1549, 1551, 1548, 1551, 1552, 1548,
+	1551, 1549, 1553, 1550, 1553, 1549, 1553, 1550, 1554, 1555, 1553, 1556, 1553, 1555, 1551, 1554, 1556, 1553, 1556, 1557, 1555, 1558, 1559, 1560,
+	1561, 1562, 1563, 1563, 1564, 1561, 1565, 1561, 1564, 1564, 1566, 1565, 1567, 1568, 1569, 1569, 1570, 1567, 1571, 1572, 1573, 1573, 1574, 1571,
+	1574, 1573, 1575, 1575, 1576, 1574, 1577, 1578, 1579, 1580, 1581, 1582, 1583, 1584, 1585, 1585, 1586, 1583, 1584, 1583, 1587, 1587, 1588, 1584,
+	1589, 1588, 1587, 1587, 1590, 1589, 1591, 1586, 1585, 1585, 1592, 1591, 1593, 1591, 1592, 1592, 1594, 1593, 1595, 1596, 1593, 1593, 1594, 1595,
+	1596, 1595, 1597, 1597, 1598, 1596, 1598, 1597, 1599, 1599, 1600, 1598, 1601, 1600, 1599, 1599, 1602, 1601, 1603, 1604, 1601, 1601, 1602, 1603,
+	1604, 1603, 1605, 1605, 1606, 1604, 1607, 1606, 1605, 1605, 1608, 1607, 1609, 1610, 1611, 1611, 1612, 1609, 1613, 1609, 1612, 1611, 1610, 1614,
+	1614, 1615, 1611, 1616, 1615, 1614, 1614, 1617, 1616, 1618, 1616, 1617, 1617, 1619, 1618, 1620, 1621, 1618, 1618, 1619, 1620, 1612, 1622, 1613,
+	1623, 1613, 1622, 1622, 1624, 1623, 1623, 1624, 1625, 1625, 1626, 1623, 1627, 1628, 1629, 1628, 1627, 1630, 1630, 1631, 1628, 1631, 1630, 1632,
+	1632, 1633, 1631, 1634, 1633, 1632, 1632, 1635, 1634, 1636, 1634, 1635, 1635, 1637, 1636, 1636, 1637, 1638, 1638, 1639, 1636, 1639, 1638, 1640,
+	1640, 1641, 1639, 1641, 1640, 1642, 1642, 1643, 1641, 1643, 1642, 1644, 1644, 1645, 1643, 1644, 1646, 1647, 1647, 1645, 1644, 1646, 1648, 1649,
+	1649, 1647, 1646, 1648, 1650, 1651, 1651, 1649, 1648, 1650, 1652, 1653, 1653, 1651, 1650, 1653, 1652, 1654, 1654, 1655, 1653, 1655, 1654, 1656,
+	1656, 1657, 1655, 1656, 1658, 1659, 1659, 1657, 1656, 1660, 1659, 1658, 1658, 1661, 1660, 1660, 1661, 1662, 1663, 1664, 1665, 1665, 1666, 1663,
+	1663, 1666, 1667, 1667, 1668, 1663, 1668, 1667, 1669, 1670, 1671, 1672, 1672, 1673, 1670, 1673, 1672, 1674, 1674, 1675, 1673, 1675, 1674, 1676,
+	1676, 1677, 1675, 1677, 1676, 1678, 1678, 1679, 1677, 1678, 1680, 1681, 1681, 1679, 1678, 1682, 1681, 1680, 1680, 1683, 1682, 1684, 1685, 1682,
+	1682, 1683, 1684, 1685, 1684, 1686, 1686, 1687, 1685, 1687, 1686, 1688, 1688, 1689, 1687, 1689, 1688, 1690, 1690, 1691, 1689, 1692, 1693, 1694,
+	1694, 1695, 1692, 1696, 1697, 1698, 1698, 1699, 1696, 1700, 1696, 1699, 1701, 1699, 1702, 1699, 1701, 1700, 1703, 1700, 1701, 1702, 1704, 1701,
+	1705, 1701, 1704, 1701, 1705, 1703, 1704, 1702, 1706, 1707, 1704, 1708, 1706, 1708, 1704, 1704, 1707, 1705, 1709, 1705, 1707, 1705, 1709, 1703,
+	1703, 1709, 1710, 1711, 1710, 1709, 1709, 1712, 1711, 1707, 1712, 1709, 1708, 1713, 1707, 1712, 1707, 1713, 1713, 1708, 1714, 1708, 1706, 1715,
+	1715, 1714, 1708, 1714, 1716, 1713, 1713, 1717, 1712, 1717, 1713, 1716, 1718, 1711, 1712, 1712, 1719, 1718, 1719, 1712, 1717, 1717, 1720, 1719,
+	1720, 1717, 1721, 1716, 1721, 1717, 1716, 1714, 1722, 1722, 1723, 1716, 1721, 1716, 1723, 1722, 1714, 1715, 1723, 1724, 1721, 1721, 1725, 1720,
+	1724, 1725, 1721, 1726, 1727, 1728, 1728, 1729, 1726, 1730, 1726, 1729, 1728, 1727, 1731, 1731, 1732, 1728, 1732, 1731, 1733, 1733, 1734, 1732,
+	1735, 1734, 1733, 1733, 1736, 1735, 1737, 1735, 1736, 1736, 1738, 1737, 1739, 1737, 1738, 1738, 1740, 1739, 1741, 1742, 1739, 1739, 1740, 1741,
+	1743, 1742, 1741, 1741, 1744, 1743, 1729, 1745, 1730, 1746, 1730, 1745, 1745, 1747, 1746, 1748, 1749, 1750, 1750, 1751, 1748, 1749, 1748, 1752,
+	1752, 1753, 1749, 1753, 1752, 1754, 1754, 1755, 1753, 1755, 1754, 1756, 1757, 1756, 1754, 1758, 1756, 1757, 1757, 1759, 1758, 1758, 1759, 1760,
+	1760, 1761, 1758, 1761, 1760, 1762, 1762, 1763, 1761, 1751, 1750, 1764, 1764, 1765, 1751, 1766, 1765, 1764, 1764, 1767, 1766, 1768, 1769, 1770,
+	1770, 1771, 1768, 1772, 1773, 1768, 1768, 1774, 1772, 1775, 1769, 1768, 1768, 1773, 1775, 1774, 1768, 1771, 1771, 1770, 1776, 1776, 1777, 1771,
+	1778, 1771, 1777, 1771, 1778, 1774, 1777, 1779, 1778, 1780, 1781, 1782, 1782, 1783, 1780, 1781, 1780, 1784, 1784, 1785, 1781, 1786, 1787, 1788,
+	1788, 1789, 1786, 1788, 1787, 1790, 1790, 1791, 1788, 1792, 1793, 1794, 1794, 1795, 1792, 1796, 1795, 1794, 1794, 1797, 1796, 1798, 1799, 1800,
+	1800, 1801, 1798, 1802, 1798, 1801, 1799, 1803, 1804, 1804, 1800, 1799, 1801, 1805, 1802, 1806, 1807, 1808, 1808, 1809, 1806, 1806, 1809, 1810,
+	1810, 1811, 1806, 1812, 1813, 1814, 1814, 1815, 1812, 1815, 1814, 1816, 1816, 1817, 1815, 1818, 1819, 1820, 1820, 1821, 1818, 1822, 1818, 1821,
+	1819, 1823, 1824, 1824, 1820, 1819, 1824, 1823, 1825, 1825, 1826, 1824, 1821, 1827, 1822, 1828, 1822, 1827, 1827, 1829, 1828, 1829, 1830, 1828,
+	1831, 1828, 1830, 1831, 1830, 1832, 1832, 1833, 1831, 1832, 1834, 1835, 1835, 1833, 1832, 1834, 1836, 1837, 1837, 1835, 1834, 1838, 1839, 1840,
+	1840, 1841, 1838, 1841, 1840, 1842, 1842, 1843, 1841, 1844, 1843, 1842, 1842, 1845, 1844, 1846, 1844, 1845, 1845, 1847, 1846, 1848, 1849, 1850,
+	1851, 390, 389, 389, 1852, 1851, 1853, 1854, 1855, 1855, 1854, 1856, 1855, 1857, 1853, 1858, 1853, 1857, 1856, 1859, 1855, 1860, 1855, 1859,
+	1857, 1855, 1860, 1861, 1857, 1862, 1857, 1861, 1858, 1860, 1862, 1857, 1863, 1858, 1861, 1861, 1864, 1863, 1864, 1861, 1865, 1862, 1865, 1861,
+	1865, 1862, 1866, 1867, 1866, 1862, 1862, 1860, 1867, 1859, 1868, 1860, 1867, 1860, 1868, 1868, 1869, 1867, 1866, 1870, 1865, 1865, 1871, 1864,
+	1871, 1865, 1870, 1872, 1863, 1864, 1864, 1873, 1872, 1873, 1864, 1871, 1870, 1874, 1871, 1871, 1875, 1873, 1875, 1871, 1874, 1874, 1876, 1875,
+	1877, 1875, 1876, 1876, 1878, 1877, 1877, 1878, 1879, 1879, 1880, 1877, 1881, 1880, 1879, 1879, 1882, 1881, 1880, 1881, 1883, 1884, 1885, 1886,
+	1886, 1887, 1884, 1888, 1889, 1890, 1891, 1889, 1888, 1888, 1892, 1891, 1893, 1888, 1890, 1892, 1888, 1894, 1894, 1888, 1893, 1895, 1893, 1890,
+	1890, 1896, 1895, 1893, 1897, 1894, 1898, 1897, 1893, 1893, 1895, 1898, 1894, 1899, 1892, 1900, 1894, 1897, 1894, 1900, 1901, 1899, 1894, 1901,
+	1902, 1891, 1892, 1892, 1903, 1902, 1903, 1892, 1899, 1899, 1904, 1903, 1901, 1905, 1899, 1904, 1899, 1905, 1901, 1906, 1907, 1907, 1905, 1901,
+	1905, 1908, 1904, 1908, 1905, 1907, 1903, 1904, 1909, 1910, 1909, 1904, 1904, 1908, 1910, 1909, 1911, 1903, 1912, 1913, 1910, 1910, 1908, 1912,
+	1907, 1912, 1908, 1914, 1900, 1897, 1915, 1914, 1916, 1897, 1916, 1914, 1897, 1898, 1917, 1917, 1916, 1897, 1916, 1917, 1915, 1896, 1915, 1898,
+	1917, 1898, 1915, 1898, 1895, 1896, 139, 1918, 125, 1918, 1919, 124, 124, 125, 1918, 124, 1919, 1920, 1920, 122, 124, 122, 1920, 1921,
+	1921, 123, 122, 1921, 1922, 123, 106, 123, 1922, 97, 1922, 1923, 1922, 97, 106, 1923, 99, 97, 100, 1923, 1924, 99, 1923, 100,
+	1924, 1925, 100, 101, 100, 1925, 1924, 1926, 1927, 1927, 1925, 1924, 1928, 1929, 1925, 1925, 1927, 1928, 1925, 1930, 101, 1930, 1925, 1929,
+	1928, 1931, 1932, 1933, 1929, 1928, 1928, 1932, 1933, 1929, 1933, 1930, 1931, 1934, 1932, 1935, 1936, 1937, 1937, 1938, 1935, 1939, 1940, 1941,
+	1941, 1942, 1939, 1941, 1940, 1943, 1943, 1944, 1941, 1944, 1943, 1945, 1944, 1945, 1946, 1946, 1947, 1944, 1948, 1949, 1950, 1950, 1951, 1948,
+	1952, 1949, 1948, 1948, 1953, 1952, 1951, 1950, 1954, 1954, 1955, 1951, 1956, 1955, 1954, 1954, 1957, 1956, 1958, 1956, 1957, 1957, 1959, 1958,
+	1960, 1961, 1958, 1958, 1959, 1960, 1962, 1952, 1953, 1953, 1963, 1962, 1964, 1962, 1963, 1963, 1965, 1964, 1966, 1967, 1968, 1968, 1969, 1966,
+	1969, 1968, 1970, 1970, 1971, 1969, 1972, 1973, 1974, 1974, 1975, 1972, 1976, 1977, 1978, 1978, 1979, 1976, 1979, 1978, 1980, 1980, 1981, 1979,
+	1981, 1980, 1982, 1982, 1983, 1981, 1982, 1984, 1985, 1985, 1983, 1982, 1986, 1985, 1984, 1984, 1987, 1986, 1988, 1989, 1990, 1990, 1991, 1988,
+	1992, 1993, 1994, 1994, 1995, 1992, 1993, 1992, 1996, 1997, 1992, 1995, 1996, 1992, 1997, 1996, 1998, 1993, 1998, 1996, 1999, 1997, 2000, 1996,
+	1999, 1996, 2000, 1995, 2001, 1997, 1997, 2002, 2003, 2003, 2000, 1997, 2002, 1997, 2001, 2000, 2004, 1999, 2004, 2000, 2003, 1999, 2005, 1998,
+	2006, 2005, 1999, 1999, 2007, 2006, 2007, 1999, 2004, 2004, 2008, 2007, 2003, 2009, 2004, 2008, 2004, 2009, 2003, 2010, 2011, 2011, 2009, 2003,
+	2003, 2002, 2012, 2012, 2010, 2003, 2009, 2013, 2008, 2014, 2013, 2009, 2009, 2011, 2014, 2008, 2015, 2016, 2016, 2007, 2008, 2008, 2013, 2017,
+	2017, 2015, 2008, 2006, 2007, 2016, 2016, 2018, 2006, 2018, 2016, 2019, 2019, 2016, 2015, 2015, 2020, 2019, 2020, 2015, 2017, 2017, 2021, 2020,
+	2014, 2022, 2017, 2017, 2013, 2014, 2021, 2017, 2022, 2014, 2011, 2023, 2023, 2024, 2014, 2022, 2014, 2024, 2022, 2025, 2021, 2024, 2026, 2022,
+	2027, 2025, 2022, 2022, 2026, 2027, 2024, 2023, 2028, 2028, 2029, 2024, 2026, 2024, 2029, 2030, 2023, 2011, 2023, 2030, 2031, 2031, 2028, 2023,
+	2032, 2033, 2028, 2028, 2031, 2032, 2034, 2029, 2028, 2028, 2033, 2034, 2029, 2035, 2026, 2029, 2034, 2036, 2036, 2035, 2029, 2027, 2026, 2035,
+	2035, 2037, 2027, 2037, 2035, 2036, 2036, 2038, 2037, 2039, 2032, 2031, 2031, 2030, 2040, 2040, 2041, 2031, 2031, 2041, 2039, 2042, 2039, 2041,
+	2043, 2041, 2040, 2041, 2043, 2042, 2040, 2012, 2044, 2044, 2045, 2040, 2012, 2040, 2030, 2040, 2045, 2043, 2046, 2047, 2043, 2043, 2045, 2046,
+	2042, 2043, 2047, 2047, 2048, 2042, 2049, 2047, 2046, 2048, 2047, 2049, 2046, 2050, 2051, 2051, 2052, 2046, 2050, 2046, 2045, 2046, 2052, 2049,
+	2045, 2044, 2050, 2053, 2050, 2044, 2051, 2050, 2053, 2053, 2054, 2051, 2053, 2055, 2001, 2001, 2056, 2053, 2054, 2053, 2056, 2044, 2055, 2053,
+	2056, 2057, 2054, 2056, 2001, 1995, 1995, 2058, 2056, 2057, 2056, 2058, 2001, 2055, 2002, 2002, 2055, 2044, 2044, 2012, 2002, 2030, 2010, 2012,
+	2011, 2010, 2030, 2059, 2058, 1995, 2060, 2061, 2058, 2058, 2059, 2060, 2058, 2061, 2057, 1995, 1994, 2059, 2062, 2063, 2064, 2064, 2065, 2062,
+	2062, 2065, 2066, 2063, 2067, 2064, 2065, 2064, 2068, 2068, 2064, 2069, 2064, 2067, 2070, 2070, 2069, 2064, 2071, 2065, 2072, 2066, 2065, 2071,
+	2068, 2072, 2065, 2071, 2073, 2066, 2073, 2074, 2066, 2072, 2075, 2071, 2069, 2076, 2068, 2069, 2070, 2077, 2078, 2079, 2069, 2069, 2077, 2078,
+	2076, 2069, 2079, 2079, 2080, 2076, 2079, 2078, 2081, 2081, 2082, 2079, 2080, 2079, 2082, 2080, 2083, 2084, 2082, 2083, 2080, 2085, 2086, 2087,
+	2087, 2088, 2085, 2089, 2085, 2090, 2085, 2091, 2090, 2085, 2089, 2086, 2092, 2086, 2089, 2089, 2093, 2092, 2089, 2094, 2095, 2095, 2096, 2089,
+	2090, 2094, 2089, 2093, 2089, 2096, 2093, 2097, 2092, 2096, 2098, 2093, 2093, 2098, 2099, 2099, 2100, 2093, 2097, 2093, 2100, 2100, 2101, 2097,
+	2102, 2101, 2100, 2102, 2100, 2103, 2100, 2099, 2104, 2104, 2103, 2100, 2103, 2105, 2102, 2105, 2103, 2106, 2107, 2106, 2103, 2103, 2104, 2107,
+	2108, 2107, 2104, 2106, 2109, 2105, 2110, 2111, 2112, 2112, 2113, 2110, 2114, 2115, 2116, 2116, 2117, 2114, 2115, 2114, 2118, 2118, 2119, 2115,
+	2117, 2116, 2120, 2120, 2121, 2117, 2122, 2121, 2120, 2120, 2123, 2122, 2124, 2122, 2123, 2123, 2125, 2124, 2126, 2124, 2125, 2125, 2127, 2126,
+	2128, 2129, 2130, 2130, 2131, 2128, 2132, 2128, 2131, 2129, 2133, 2134, 2134, 2130, 2129, 2134, 2133, 2135, 2135, 2136, 2134, 2136, 2135, 2137,
+	2137, 2138, 2136, 2138, 2137, 2139, 2139, 2140, 2138, 2131, 2141, 2132, 2142, 2143, 2144, 2145, 2142, 2146, 2146, 2142, 2144, 2146, 2147, 2145,
+	2148, 2149, 2150, 2150, 2151, 2148, 2151, 2150, 2152, 2152, 2153, 2151, 2152, 2154, 2155, 2155, 2153, 2152, 2154, 2156, 2157, 2157, 2155, 2154,
+	2158, 2157, 2156, 2156, 2159, 2158, 2160, 2158, 2159, 2159, 2161, 2160, 2160, 2161, 2162, 2161, 2163, 2164, 2164, 2162, 2161, 2164, 2163, 2165,
+	2165, 2166, 2164, 2166, 2165, 2167, 2167, 2168, 2166, 2168, 2167, 2169, 2169, 2170, 2168, 2169, 2171, 2172, 2172, 2170, 2169, 2171, 2173, 2174,
+	2174, 2172, 2171, 2173, 2175, 2176, 2176, 2174, 2173, 2177, 2178, 2179, 2180, 2177, 2181, 2179, 2181, 2177, 2179, 2182, 2183, 2183, 2181, 2179,
+	2184, 2181, 2185, 2186, 2185, 2181, 2181, 2183, 2186, 2181, 2184, 2180, 2187, 2186, 2183, 2183, 2188, 2189, 2189, 2187, 2183, 2188, 2183, 2182,
+	2182, 2190, 2188, 2191, 2192, 2188, 2188, 2190, 2191, 2193, 2189, 2188, 2188, 2192, 2193, 2192, 2191, 2194, 2195, 2193, 2192, 2192, 2196, 2197,
+	2197, 2195, 2192, 2194, 2196, 2192, 2198, 2195, 2197, 2185, 2199, 2184, 2200, 2201, 2202, 2202, 2203, 2200, 2201, 2200, 2204, 2204, 2205, 2201,
+	2206, 2207, 2208, 2209, 2208, 2207, 2207, 2210, 2209, 2211, 2212, 2213, 2213, 2214, 2211, 2213, 2212, 2215, 2215, 2216, 2213, 2216, 2215, 2217,
+	2217, 2218, 2216, 2219, 2218, 2217, 2217, 2220, 2219, 2221, 2219, 2220, 2220, 2222, 2221, 2223, 2224, 2225, 2226, 2223, 2227, 2223, 2225, 2228,
+	2228, 2227, 2223, 2227, 2229, 2226, 2230, 2226, 2229, 2227, 2228, 2231, 2227, 2231, 2232, 2232, 2233, 2227, 2233, 2234, 2227, 2229, 2227, 2234,
+	2234, 2235, 2229, 2229, 2235, 2236, 2237, 2229, 2236, 2229, 2237, 2230, 2238, 2239, 2230, 2230, 2237, 2238, 2236, 2240, 2237, 2238, 2237, 2240,
+	2240, 2241, 2238, 2241, 2242, 2238, 2238, 2242, 2243, 2244, 2238, 2243, 2239, 2238, 2244, 2244, 2245, 2239, 2243, 2246, 2244, 2246, 2243, 2247,
+	2248, 2242, 2241, 2241, 2249, 2248, 2250, 2251, 2252, 2252, 2253, 2250, 2251, 2250, 2254, 2254, 2255, 2251, 2256, 2257, 2258, 2258, 2259, 2256,
+	2260, 2261, 2262, 2262, 2263, 2260, 2264, 2261, 2260, 2260, 2265, 2264, 2263, 2262, 2266, 2266, 2267, 2263, 2264, 2265, 2268, 2268, 2269, 2264,
+	2268, 2270, 2271, 2271, 2269, 2268, 2270, 2272, 2273, 2273, 2271, 2270, 2274, 2275, 2276, 2276, 2277, 2274, 2278, 2279, 2274, 2274, 2277, 2278,
+	2275, 2280, 2281, 2281, 2276, 2275, 2278, 2282, 2283, 2283, 2279, 2278, 2283, 2282, 2284, 2284, 2285, 2283, 2285, 2284, 2286, 2286, 2287, 2285,
+	2288, 2289, 2290, 2290, 2291, 2288, 2288, 2291, 2292, 2292, 2293, 2288, 2294, 2291, 2290, 2292, 2291, 2294, 2293, 2292, 2295, 2294, 2296, 2292,
+	2295, 2292, 2296, 2295, 2297, 2293, 2296, 2298, 2295, 2295, 2298, 2299, 2299, 2300, 2295, 2301, 2297, 2295, 2295, 2302, 2301, 2302, 2295, 2300,
+	2303, 2296, 2294, 2296, 2303, 2304, 2304, 2298, 2296, 2294, 2305, 2303, 2306, 2307, 2303, 2303, 2305, 2306, 2308, 2304, 2303, 2303, 2307, 2308,
+	2304, 2309, 2299, 2299, 2298, 2304, 2310, 2309, 2304, 2304, 2308, 2310, 2310, 2308, 2311, 2311, 2308, 2307, 2312, 2309, 2310, 2310, 2313, 2312,
+	2313, 2310, 2314, 2311, 2314, 2310, 2315, 2299, 2309, 2309, 2312, 2315, 2299, 2315, 2316, 2316, 2300, 2299, 2300, 2317, 2302, 2302, 2317, 2318,
+	2318, 2301, 2302, 2314, 2319, 2313, 2320, 2321, 2322, 2322, 2323, 2320, 2323, 2322, 2324, 2324, 2325, 2323, 2326, 2325, 2324, 2324, 2327, 2326,
+	2328, 2329, 2330, 2331, 2329, 2328, 2328, 2332, 2331, 2329, 2333, 2334, 2334, 2330, 2329, 2335, 2336, 2331, 2331, 2332, 2335, 2336, 2335, 2337,
+	2337, 2338, 2336, 2338, 2337, 2339, 2339, 2340, 2338, 2341, 2340, 2339, 2339, 2342, 2341, 2343, 2341, 2342, 2342, 2344, 2343, 2345, 2343, 2344,
+	2344, 2346, 2345, 2347, 2348, 2349, 2349, 2350, 2347, 2349, 2348, 2351, 2351, 2352, 2349, 2353, 2352, 2354, 2354, 2355, 2353, 2356, 2357, 2358,
+	2358, 2359, 2356, 2360, 2356, 2359, 2359, 2361, 2360, 2362, 2363, 2364, 2364, 2365, 2362, 2364, 2366, 2367, 2367, 2365, 2364, 2366, 2368, 2369,
+	2369, 2367, 2366, 2370, 2371, 2372, 2372, 2373, 2370, 2373, 2374, 2370, 2371, 2375, 2376, 2376, 2372, 2371, 2375, 2377, 2378, 2378, 2376, 2375,
+	2378, 2377, 2379, 2379, 2380, 2378, 2381, 2374, 2373, 2373, 2382, 2381, 2383, 2384, 2381, 2381, 2382, 2383, 2383, 2385, 2386, 2386, 2384, 2383,
+	2387, 2388, 2389, 2389, 2390, 2387, 2391, 2392, 2393, 2393, 2394, 2391, 2395, 2396, 2397, 2397, 2398, 2395, 2396, 2395, 2399, 2399, 2400, 2396,
+	2399, 2401, 2402, 2402, 2400, 2399, 2403, 2404, 2405, 2406, 2403, 2407, 2405, 2407, 2403, 2408, 2409, 2410, 2410, 2411, 2408, 2412, 2409, 2408,
+	2408, 2413, 2412, 2414, 2412, 2413, 2413, 2415, 2414, 2416, 2417, 2414, 2414, 2415, 2416, 2418, 2417, 2416, 2416, 2419, 2418, 2420, 2418, 2419,
+	2419, 2421, 2420, 2422, 2420, 2421, 2421, 2423, 2422, 2424, 2425, 2422, 2422, 2423, 2424, 2424, 2426, 2427, 2427, 2425, 2424, 2427, 2426, 2428,
+	2428, 2429, 2427, 2429, 2428, 2430, 2430, 2431, 2429, 2431, 2430, 2432, 2432, 2433, 2431, 2434, 2433, 2432, 2432, 2435, 2434, 2436, 2437, 2438,
+	2438, 2439, 2436, 2440, 2441, 2442, 2440, 2443, 2444, 2442, 2443, 2440, 2445, 2446, 2443, 2444, 2443, 2446, 2446, 2447, 2444, 2448, 2446, 2445,
+	2449, 2447, 2446, 2446, 2448, 2449, 2450, 2451, 2452, 2452, 2453, 2450, 2453, 2452, 2454, 2454, 2455, 2453, 2456, 2455, 2454, 2454, 2457, 2456,
+	2458, 2459, 2460, 2460, 2461, 2458, 2462, 2459, 2458, 2458, 2463, 2462, 2461, 2460, 2464, 2464, 2465, 2461, 2466, 2462, 2463, 2463, 2467, 2466,
+	2468, 2466, 2467, 2467, 2469, 2468, 2468, 2469, 2470, 2470, 2471, 2468, 2472, 2473, 2474, 2475, 2476, 2477, 2477, 2478, 2475, 2479, 2476, 2475,
+	2475, 2480, 2479, 2478, 2477, 2481, 2481, 2482, 2478, 2479, 2480, 2483, 2483, 2484, 2479, 2483, 2485, 2486, 2486, 2484, 2483, 2485, 2487, 2488,
+	2488, 2486, 2485, 2489, 2490, 2491, 2491, 2492, 2489, 2493, 2494, 2489, 2489, 2492, 2493, 2490, 2495, 2496, 2496, 2491, 2490, 2493, 2497, 2498,
+	2498, 2494, 2493, 2498, 2497, 2499, 2499, 2500, 2498, 2500, 2499, 2501, 2501, 2502, 2500, 2503, 2504, 2505, 2505, 2506, 2503, 2506, 2507, 2503,
+	2508, 2503, 2507, 2505, 2504, 2509, 2509, 2510, 2505, 2510, 2509, 2511, 2511, 2512, 2510, 2513, 2512, 2511, 2511, 2514, 2513, 2515, 2516, 2513,
+	2513, 2514, 2515, 2516, 2515, 2517, 2517, 2518, 2516, 2517, 2519, 2520, 2520, 2518, 2517, 2521, 2520, 2519, 2519, 2522, 2521, 2523, 2524, 2521,
+	2521, 2522, 2523, 2525, 2524, 2523, 2523, 2526, 2525, 2527, 2528, 2525, 2525, 2526, 2527, 2528, 2527, 2529, 2529, 2530, 2528, 2531, 2530, 2529,
+	2529, 2532, 2531, 2533, 2531, 2532, 2532, 2534, 2533, 2535, 2536, 2533, 2533, 2534, 2535, 2535, 2537, 2538, 2538, 2536, 2535, 2539, 2538, 2537,
+	2537, 2540, 2539, 2539, 2540, 2541, 2541, 2542, 2539, 2543, 2544, 2545, 2545, 2546, 2543, 2546, 2545, 2547, 2547, 2548, 2546, 2549, 2550, 2551,
+	2550, 2549, 2552, 2552, 2553, 2550, 2554, 2555, 2552, 2553, 2552, 2555, 751, 750, 2556, 2556, 2557, 751, 2557, 2556, 2558, 2558, 2559, 2557,
+	2559, 2558, 2560, 2561, 2559, 2560, 2560, 2562, 2561, 2563, 2564, 2565, 2565, 2566, 2563, 2567, 2568, 2569, 2569, 2570, 2567, 2568, 2571, 2572,
+	2572, 2569, 2568, 2571, 2573, 2574, 2574, 2572, 2571, 2575, 2576, 2577, 2577, 2578, 2575, 2578, 2577, 2579, 2579, 2580, 2578, 2580, 2579, 2581,
+	2581, 2582, 2580, 2583, 2584, 2585, 2585, 2586, 2583, 2587, 2588, 2589, 2589, 2590, 2587, 2591, 2592, 2593, 2593, 2594, 2591, 2595, 2592, 2591,
+	2591, 2596, 2595, 2593, 2597, 2594, 2597, 2593, 2598, 2599, 2595, 2596, 2596, 2600, 2599, 2601, 2602, 2599, 2599, 2600, 2601, 2602, 2601, 2603,
+	2603, 2604, 2602, 2603, 2605, 2606, 2606, 2604, 2603, 2606, 2605, 2607, 2607, 2608, 2606, 2609, 2610, 2611, 2611, 2612, 2609, 2613, 2614, 2609,
+	2609, 2612, 2613, 2611, 2610, 2615, 2615, 2616, 2611, 2614, 2613, 2617, 2617, 2618, 2614, 2619, 2618, 2617, 2617, 2620, 2619, 2621, 2619, 2620,
+	2620, 2622, 2621, 2621, 2622, 2623, 2623, 2624, 2621, 2625, 2623, 2626, 2623, 2625, 2624, 2627, 2628, 2629, 2629, 2630, 2627, 2631, 2627, 2630,
+	2632, 2629, 2628, 2628, 2633, 2632, 2632, 2633, 2634, 2634, 2635, 2632, 2635, 2634, 2636, 2636, 2637, 2635, 2638, 2637, 2636, 2636, 2639, 2638,
+	2640, 2638, 2639, 2639, 2641, 2640, 2642, 2643, 2640, 2640, 2641, 2642, 2643, 2642, 2644, 2644, 2645, 2643, 2645, 2644, 2646, 2646, 2647, 2645,
+	2647, 2646, 2648, 2648, 2649, 2647, 2649, 2648, 2650, 2650, 2651, 2649, 2651, 2650, 2652, 2652, 2653, 2651, 2653, 2652, 2654, 2654, 2655, 2653,
+	2655, 2654, 2656, 2656, 2657, 2655, 2657, 2656, 2658, 2658, 2659, 2657, 2658, 2660, 2661, 2661, 2659, 2658, 2662, 2661, 2660, 2660, 2663, 2662,
+	2664, 2662, 2663, 2663, 2665, 2664, 2666, 2664, 2665, 2665, 2667, 2666, 2668, 2666, 2667, 2667, 2669, 2668, 2670, 2668, 2669, 2669, 2631, 2670,
+	2630, 2670, 2631, 2671, 2672, 2673, 2673, 2674, 2671, 2673, 2672, 2675, 2675, 2676, 2673, 2677, 2678, 2679, 2679, 2680, 2677, 2681, 2680, 2679,
+	2679, 2682, 2681, 2683, 2684, 2685, 2685, 2686, 2683, 2685, 2684, 2687, 2687, 2688, 2685, 2689, 2690, 2691, 2691, 2692, 2689, 2693, 2692, 2691,
+	2691, 2694, 2693, 2695, 2696, 2697, 2697, 2698, 2695, 2699, 2700, 2701, 2702, 2703, 2704, 2704, 2705, 2702, 2706, 2707, 2702, 2702, 2705, 2706,
+	2704, 2703, 2708, 2708, 2709, 2704, 2709, 2708, 2710, 2710, 2711, 2709, 2711, 2710, 2712, 2712, 2713, 2711, 2713, 2712, 2714, 2714, 2715, 2713,
+	2715, 2714, 2716, 2716, 2717, 2715, 2717, 2716, 2718, 2718, 2719, 2717, 2719, 2718, 2720, 2720, 2721, 2719, 2721, 2720, 2722, 2722, 2723, 2721,
+	2723, 2722, 2724, 2724, 2725, 2723, 2725, 2724, 2726, 2726, 2727, 2725, 2727, 2726, 2728, 2728, 2729, 2727, 2729, 2728, 2707, 2707, 2706, 2729,
+	2730, 2731, 2732, 2732, 2733, 2730, 2730, 2734, 2735, 2735, 2731, 2730, 2733, 2732, 2736, 2736, 2737, 2733, 2737, 2736, 2738, 2738, 2739, 2737,
+	2739, 2738, 2740, 2740, 2741, 2739, 2741, 2740, 2742, 2742, 2743, 2741, 2743, 2742, 2744, 2744, 2745, 2743, 2745, 2744, 2746, 2746, 2747, 2745,
+	2747, 2746, 2748, 2748, 2749, 2747, 2749, 2748, 2750, 2750, 2751, 2749, 2751, 2750, 2752, 2752, 2753, 2751, 2753, 2752, 2754, 2754, 2755, 2753,
+	2755, 2754, 2756, 2756, 2757, 2755, 2757, 2756, 2735, 2735, 2734, 2757, 2758, 2759, 2760, 2760, 2761, 2758, 2759, 2762, 2763, 2763, 2760, 2759,
+	2763, 2762, 2764, 2764, 2765, 2763, 2766, 2765, 2764, 2767, 2768, 2769, 2770, 2771, 2772, 2772, 2773, 2770, 2771, 2770, 2774, 2774, 2775, 2771,
+	2774, 2776, 2777, 2777, 2775, 2774, 2776, 2778, 2777, 2776, 2779, 2780, 2780, 2778, 2776, 2780, 2779, 2781, 2781, 2782, 2780, 2782, 2781, 2783,
+	2783, 2784, 2782, 2785, 2784, 2783, 2783, 2786, 2785, 2787, 2785, 2786, 2786, 2788, 2787, 2789, 2787, 2788, 2788, 2790, 2789, 2790, 2791, 2789,
+	2792, 2791, 2790, 2790, 2793, 2792, 2794, 2792, 2793, 2793, 2773, 2794, 2772, 2794, 2773, 2795, 2796, 2797, 2797, 2798, 2795, 2799, 2800, 2801,
+	2801, 2802, 2799, 2803, 2804, 2805, 2805, 2806, 2803, 2804, 2803, 2807, 2804, 2807, 2808, 2808, 2809, 2804, 2810, 2809, 2808, 2808, 2811, 2810,
+	2812, 2806, 2805, 2805, 2813, 2812, 2814, 2812, 2813, 2813, 2815, 2814, 2816, 2814, 2815, 2815, 2817, 2816, 2818, 2819, 2816, 2816, 2817, 2818,
+	2820, 2821, 2822, 2822, 2823, 2820, 2822, 2821, 2824, 2824, 2825, 2822, 2826, 2827, 2828, 2828, 2829, 2826, 2830, 2829, 2828, 2828, 2831, 2830,
+	2832, 2833, 2834, 2834, 2835, 2832, 2834, 2833, 2836, 2836, 2837, 2834, 2838, 2834, 2837, 2839, 2835, 2834, 2834, 2840, 2839, 2841, 2840, 2834,
+	2834, 2838, 2841, 2837, 2842, 2838, 2843, 2838, 2842, 2841, 2838, 2843, 2843, 2844, 2841, 2842, 2845, 2843, 2846, 2847, 2848, 2848, 2849, 2846,
+	2850, 2846, 2851, 2846, 2850, 2847, 2849, 2848, 2852, 2852, 2848, 2853, 2853, 2854, 2852, 2855, 2852, 2854, 2854, 2856, 2855, 2851, 2857, 2850,
+	2858, 2859, 2860, 2860, 2861, 2858, 2862, 2863, 2864, 2864, 2865, 2862, 2865, 2864, 2866, 2866, 2867, 2865, 2868, 2866, 2869, 2867, 2866, 2868,
+	2869, 2870, 2868, 2871, 2872, 2873, 2873, 2874, 2871, 2871, 2874, 2875, 2872, 2876, 2877, 2877, 2873, 2872, 2877, 2876, 2878, 2878, 2879, 2877,
+	2880, 2875, 2874, 2874, 2881, 2880, 2882, 2880, 2881, 2881, 2883, 2882, 2884, 2885, 2886, 2887, 2888, 2884, 2884, 2889, 2887, 2889, 2884, 2886,
+	2886, 2890, 2889, 2888, 2887, 2891, 2891, 2892, 2888, 2893, 2894, 2891, 2891, 2895, 2893, 2891, 2894, 2892, 2896, 2897, 2898, 2899, 2900, 2896,
+	2896, 2901, 2899, 2897, 2896, 2900, 2900, 2902, 2897, 2903, 2899, 2901, 2901, 2904, 2903, 2905, 2906, 2903, 2903, 2907, 2905, 2903, 2904, 2907,
+	2908, 2909, 2910, 2911, 2912, 2913, 2913, 2914, 2911, 2915, 2911, 2914, 2916, 2913, 2912, 2912, 2917, 2916, 2918, 2916, 2917, 2917, 2919, 2918,
+	2920, 2918, 2919, 2919, 2921, 2920, 2922, 2923, 2920, 2920, 2921, 2922, 2914, 2924, 2915, 2925, 2915, 2924, 2924, 2926, 2925, 2927, 2928, 2929,
+	2930, 2929, 2928, 2931, 2929, 2930, 2930, 2932, 2931, 2933, 2931, 2934, 2931, 2932, 2934, 2934, 2935, 2933, 2936, 2937, 2938, 2938, 2939, 2936,
+	2937, 2936, 2940, 2940, 2941, 2937, 2942, 2939, 2938, 2938, 2943, 2944, 2944, 2942, 2938, 2945, 2944, 2943, 2946, 2945, 2943, 2943, 2947, 2946,
+	2948, 2949, 2950, 2950, 2951, 2948, 2952, 2953, 2954, 2954, 2955, 2952, 2956, 2957, 2952, 2952, 2955, 2956, 2957, 2956, 2958, 2958, 2959, 2957,
+	2960, 2959, 2958, 2958, 2961, 2960, 2962, 2963, 2960, 2960, 2961, 2962, 2963, 2962, 2964, 2964, 2965, 2963, 2966, 2967, 2968, 2968, 2969, 2966,
+	2970, 2968, 2967, 2967, 2971, 2970, 2972, 2970, 2971, 2971, 2973, 2972, 2974, 2975, 2976, 2976, 2977, 2974, 2974, 2978, 2979, 2979, 2975, 2974,
+	2977, 2976, 2980, 2980, 2981, 2977, 2982, 2979, 2978, 2978, 2983, 2982, 2984, 2982, 2983, 2982, 2984, 2985, 2985, 2986, 2982, 2987, 2986, 2985,
+	2985, 2988, 2987, 2989, 2987, 2990, 2990, 2987, 2988, 2987, 2989, 2991, 2991, 2992, 2987, 2992, 2991, 2993, 2994, 2992, 2993, 2993, 2995, 2994,
+	2996, 2997, 2998, 2998, 2999, 2996, 2996, 2999, 3000, 3000, 3001, 2996, 3002, 2998, 2997, 2997, 3003, 3002, 3004, 3005, 3001, 3001, 3000, 3004,
+	3006, 3005, 3004, 3004, 3007, 3008, 3008, 3006, 3004, 3008, 3007, 3009, 3009, 3010, 3008, 3011, 3012, 3009, 3012, 3010, 3009, 3009, 3013, 3014,
+	3014, 3011, 3009, 3013, 3015, 3014, 3015, 3013, 3016, 3016, 3017, 3015, 3018, 3019, 3020, 3020, 3021, 3018, 3022, 3019, 3018, 3018, 3023, 3022,
+	3024, 3025, 3018, 3018, 3021, 3024, 3018, 3025, 3026, 3026, 3023, 3018, 3027, 3028, 3019, 3019, 3022, 3027, 3023, 3029, 3022, 3027, 3022, 3029,
+	3029, 3023, 3026, 3026, 3030, 3029, 3030, 3026, 3025, 3025, 3031, 3030, 3032, 3029, 3030, 3030, 3033, 3032, 3030, 3031, 3034, 3034, 3033, 3030,
+	3027, 3029, 3032, 3032, 3035, 3027, 3036, 3028, 3027, 3027, 3035, 3036, 3037, 3032, 3038, 3037, 3035, 3032, 3032, 3039, 3038, 3033, 3039, 3032,
+	3039, 3033, 3040, 3040, 3033, 3034, 3040, 3041, 3039, 3038, 3039, 3041, 3038, 3042, 3043, 3043, 3037, 3038, 3041, 3042, 3038, 3037, 3043, 3044,
+	3044, 3035, 3037, 3035, 3044, 3036, 3045, 3044, 3043, 3046, 3045, 3043, 3043, 3042, 3046, 3046, 3042, 3041, 3041, 3047, 3046, 3040, 3047, 3041,
+	3048, 3046, 3047, 3046, 3048, 3045, 3045, 3048, 3049, 3049, 3050, 3045, 3051, 3048, 3052, 3048, 3053, 3052, 3053, 3048, 3047, 3049, 3048, 3054,
+	3054, 3048, 3051, 3047, 3055, 3053, 3051, 3056, 3057, 3057, 3058, 3051, 3052, 3056, 3051, 3051, 3059, 3054, 3060, 3059, 3051, 3051, 3058, 3060,
+	3049, 3054, 3061, 3062, 3060, 3058, 3057, 3062, 3058, 2507, 3063, 2508, 3063, 3064, 3065, 3065, 2508, 3063, 3066, 3065, 3064, 3064, 3067, 3066,
+	3068, 3069, 3070, 3070, 3071, 3068, 3071, 3070, 3072, 3072, 3073, 3071, 3074, 3075, 3076, 3076, 3077, 3074, 3078, 3074, 3077, 3077, 3079, 3078,
+	3080, 3078, 3079, 3079, 3081, 3080, 3082, 3083, 3084, 3084, 3085, 3082, 3086, 3087, 3088, 3088, 3089, 3086, 3088, 3087, 3090, 3091, 3088, 3090,
+	3092, 3088, 3091, 3089, 3088, 3092, 3092, 3093, 3089, 3091, 3094, 3092, 3095, 3093, 3092, 3092, 3096, 3095, 3097, 3096, 3092, 3092, 3094, 3097,
+	3090, 3098, 3091, 3099, 3100, 3101, 3100, 3102, 3103, 3103, 3101, 3100, 3104, 3105, 3106, 3106, 3107, 3104, 3108, 3109, 3110, 3110, 3111, 3108,
+	3112, 3111, 3110, 3113, 3111, 3112, 3112, 3114, 3113, 3114, 3115, 3113, 3113, 3115, 3116, 3116, 3117, 3113, 3117, 3116, 3118, 3119, 3120, 3117,
+	3117, 3118, 3119, 3120, 3119, 3121, 3122, 3120, 3121, 3121, 3123, 3122, 3122, 3123, 3124, 3125, 3126, 3127, 3127, 3128, 3125, 3129, 3127, 3126,
+	3129, 3126, 3130, 3130, 3131, 3129, 3131, 3130, 3132, 3130, 3133, 3134, 3134, 3132, 3130, 3133, 3135, 3134, 3136, 3135, 3133, 3133, 3137, 3136,
+	3137, 3138, 3136, 3138, 3137, 3139, 3139, 3140, 3138, 3139, 3141, 3140, 3142, 3143, 3144, 3144, 3145, 3142, 3146, 3147, 3148, 3148, 3149, 3146,
+	3149, 3148, 3150, 3150, 3151, 3149, 3152, 3153, 3154, 3154, 3155, 3152, 3156, 3157, 3158, 3158, 3159, 3156, 3157, 3156, 3160, 3160, 3161, 3157,
+	3161, 3160, 3162, 3162, 3163, 3161, 3164, 3163, 3162, 3162, 3165, 3164, 3166, 3167, 3164, 3164, 3165, 3166, 3168, 3169, 3170, 3170, 3171, 3168,
+	3172, 3173, 3174, 3174, 3175, 3172, 3173, 3176, 3177, 3177, 3174, 3173, 3176, 3178, 3179, 3179, 3177, 3176, 3180, 3179, 3178, 3178, 3181, 3180,
+	3182, 3183, 3184, 3185, 3186, 3187, 3187, 3188, 3185, 3189, 3185, 3188, 3187, 3186, 3190, 3190, 3191, 3187, 3188, 3192, 3189, 3193, 3194, 3189,
+	3189, 3192, 3193, 3195, 3196, 3197, 3197, 3198, 3195, 3199, 3200, 3201, 3201, 3202, 3199, 3199, 3203, 3200, 3202, 3201, 3204, 3205, 3206, 3207,
+	3207, 3208, 3205, 3209, 3210, 3207, 3210, 3209, 3211, 3211, 3212, 3210, 3212, 3211, 3213, 3213, 3214, 3212, 3215, 3216, 3217, 3218, 3219, 3220,
+	3220, 3221, 3218, 3222, 3223, 3218, 3218, 3221, 3222, 3219, 3224, 3220, 3224, 3225, 3220, 3220, 3225, 3226, 3226, 3227, 3220, 3226, 3228, 3229,
+	3229, 3227, 3226, 3228, 3230, 3231, 3231, 3229, 3228, 3230, 3232, 3231, 3223, 3222, 3233, 3233, 3234, 3223, 3234, 3233, 3235, 3235, 3236, 3234,
+	3236, 3235, 3237, 3237, 3238, 3236, 3238, 3237, 3239, 3239, 3240, 3238, 3240, 3239, 3241, 3241, 3242, 3240, 3241, 3243, 3242, 3244, 3245, 3246,
+	3246, 3247, 3244, 3248, 3249, 3244, 3244, 3247, 3248, 3250, 3249, 3248, 3251, 3252, 3253, 3253, 3254, 3251, 3255, 3256, 3257, 3257, 3258, 3255,
+	3259, 3260, 3261, 3261, 3262, 3259, 3263, 3264, 3265, 3265, 3266, 3263, 3267, 3265, 3264, 3264, 3268, 3267, 3269, 3267, 3268, 3270, 3271, 3267,
+	3267, 3269, 3270, 3270, 3272, 3271, 3273, 3274, 3275, 3275, 3276, 3273, 3277, 3278, 3273, 3273, 3276, 3277, 3275, 3274, 3279, 3279, 3280, 3275,
+	3277, 3281, 3282, 3282, 3278, 3277, 3282, 3281, 3283, 3283, 3284, 3282, 3283, 3285, 3286, 3286, 3284, 3283, 3287, 3288, 3289, 3289, 3290, 3287,
+	3291, 3288, 3287, 3287, 3292, 3291, 3289, 3293, 3294, 3294, 3290, 3289, 3291, 3292, 3295, 3295, 3296, 3291, 3295, 3297, 3298, 3298, 3296, 3295,
+	3298, 3297, 3299, 3299, 3300, 3298, 3301, 3302, 3303, 3303, 3304, 3301, 3305, 3301, 3304, 3306, 3303, 3302, 3306, 3302, 3307, 3305, 3304, 3308,
+	3308, 3309, 3305, 3310, 3309, 3308, 3311, 3310, 3308, 3308, 3312, 3311, 3313, 3311, 3312, 3314, 3315, 3312, 3313, 3312, 3315, 3315, 3316, 3313,
+	3315, 3317, 3316, 3318, 3319, 3320, 3320, 3321, 3318, 3322, 3323, 3324, 3324, 3325, 3322, 3326, 3323, 3322, 3322, 3327, 3326, 3328, 3329, 2954,
+	2954, 2953, 3328, 3329, 3328, 3330, 3330, 3331, 3329, 3330, 3332, 3333, 3333, 3331, 3330, 3334, 3333, 3332, 3332, 3335, 3334, 3336, 3337, 3334,
+	3334, 3335, 3336, 3336, 3338, 3339, 3339, 3337, 3336, 3340, 3339, 3338, 3338, 3341, 3340, 3340, 3341, 3342, 3342, 3343, 3340, 3342, 3344, 3345,
+	3345, 3343, 3342, 3346, 3345, 3344, 3344, 3347, 3346, 3348, 3349, 3350, 3351, 3352, 3348, 3348, 3350, 3351, 3353, 3354, 3355, 3355, 3356, 3353,
+	3353, 3357, 3358, 3358, 3354, 3353, 3355, 3359, 3360, 3360, 3356, 3355, 3359, 3361, 3362, 3362, 3360, 3359, 3362, 3361, 3363, 3363, 3364, 3362,
+	3363, 3365, 3366, 3366, 3364, 3363, 3365, 3367, 3368, 3368, 3366, 3365, 3367, 3369, 3370, 3370, 3368, 3367, 3370, 3369, 3371, 3371, 3372, 3370,
+	3371, 3373, 3372, 3374, 3372, 3373, 3373, 3375, 3374, 3376, 3374, 3375, 3377, 3374, 3376, 3376, 3378, 3377, 3357, 3377, 3378, 3378, 3358, 3357,
+	3379, 3380, 3381, 3381, 3382, 3379, 3383, 3384, 3385, 3385, 3386, 3383, 3387, 3388, 3389, 3388, 3390, 3391, 3391, 3389, 3388, 3392, 3393, 3394,
+	3394, 3395, 3392, 3396, 3392, 3395, 3395, 3397, 3396, 3396, 3397, 3398, 3398, 3399, 3396, 3400, 3401, 3402, 3402, 3403, 3400, 3401, 3400, 3404,
+	3404, 3405, 3401, 3404, 3406, 3407, 3407, 3405, 3404, 3408, 3409, 3410, 3411, 3412, 3413, 3413, 3414, 3411, 3411, 3414, 3415, 3415, 3416, 3411,
+	3417, 3413, 3412, 3412, 3418, 3417, 3419, 3417, 3418, 3418, 3420, 3419, 3421, 3422, 3423, 3423, 3424, 3421, 3421, 3424, 3425, 3425, 3426, 3421,
+	3424, 3423, 3427, 3428, 3427, 3423, 3423, 3429, 3428, 3427, 3430, 3424, 3424, 3430, 3431, 3431, 3425, 3424, 3426, 3425, 3432, 3432, 3425, 3431,
+	3432, 3433, 3426, 3434, 3433, 3432, 3432, 3435, 3434, 3431, 3436, 3432, 3437, 3435, 3432, 3432, 3436, 3437, 3438, 3431, 3430, 3431, 3438, 3439,
+	3439, 3436, 3431, 3440, 3430, 3427, 3430, 3440, 3438, 3441, 3438, 3440, 3442, 3439, 3438, 3438, 3441, 3442, 3443, 3444, 3439, 3439, 3442, 3443,
+	3436, 3439, 3444, 3444, 3437, 3436, 3437, 3445, 3446, 3446, 3435, 3437, 3437, 3444, 3447, 3447, 3445, 3437, 3448, 3447, 3444, 3444, 3443, 3448,
+	3448, 3443, 3449, 3443, 3442, 3450, 3450, 3449, 3443, 3442, 3441, 3451, 3451, 3450, 3442, 3452, 3451, 3441, 3440, 3453, 3441, 3441, 3453, 3452,
+	3454, 3452, 3453, 3453, 3440, 3455, 3455, 3456, 3453, 3453, 3456, 3454, 3457, 3454, 3456, 3456, 3455, 3458, 3458, 3459, 3456, 3456, 3459, 3457,
+	3428, 3458, 3455, 3455, 3427, 3428, 3427, 3455, 3440, 3449, 3460, 3448, 3461, 3448, 3460, 3460, 3462, 3461, 3461, 3463, 3447, 3447, 3448, 3461,
+	3445, 3447, 3463, 3463, 3464, 3445, 3445, 3464, 3465, 3465, 3446, 3445, 3466, 3446, 3465, 3465, 3467, 3466, 3435, 3446, 3466, 3468, 3434, 3466,
+	3466, 3469, 3468, 3469, 3466, 3467, 3466, 3434, 3435, 3467, 3470, 3469, 3469, 3471, 3472, 3472, 3468, 3469, 3473, 3471, 3469, 3469, 3470, 3473,
+	3433, 3434, 3468, 3473, 3474, 3475, 3475, 3471, 3473, 3471, 3475, 3476, 3476, 3472, 3471, 3477, 3475, 3474, 3478, 3476, 3475, 3475, 3477, 3478,
+	3474, 3479, 3477, 3477, 3480, 3481, 3481, 3478, 3477, 3480, 3477, 3479, 3478, 3481, 3482, 3483, 3481, 3480, 3481, 3483, 3484, 3484, 3482, 3481,
+	3485, 3480, 3486, 3479, 3486, 3480, 3480, 3485, 3483, 3487, 3484, 3483, 3483, 3488, 3487, 3488, 3483, 3485, 3489, 3490, 3484, 3484, 3487, 3489,
+	3482, 3484, 3490, 3490, 3489, 3491, 3486, 3492, 3485, 3485, 3493, 3488, 3493, 3485, 3492, 3492, 3494, 3493, 3495, 3496, 3497, 3497, 3498, 3495,
+	3499, 3495, 3498, 1872, 3495, 3499, 1873, 3496, 3495, 3495, 1872, 1873, 1880, 3497, 3496, 3496, 1877, 1880, 1875, 1877, 3496, 3496, 1873, 1875,
+	1883, 3497, 1880, 3500, 3498, 3497, 3497, 1883, 3500, 3498, 3501, 3499, 3502, 3501, 3498, 3498, 3500, 3502, 3503, 3499, 3501, 3499, 3504, 1872,
+	3504, 3499, 3503, 3501, 3505, 3503, 3506, 3505, 3501, 3501, 3502, 3506, 3503, 3505, 3507, 3507, 3508, 3503, 3503, 3509, 3504, 3509, 3503, 3508,
+	3504, 3510, 1863, 1863, 1872, 3504, 3510, 3504, 3509, 3508, 3511, 3509, 3512, 3509, 3511, 3509, 3512, 3510, 3513, 3514, 3508, 3508, 3507, 3513,
+	3515, 3511, 3508, 3508, 3514, 3515, 3516, 3511, 3515, 3511, 3516, 3512, 3517, 3512, 3516, 3518, 3510, 3512, 3512, 3517, 3518, 1858, 1863, 3510,
+	3510, 3518, 1858, 3518, 3519, 1853, 1853, 1858, 3518, 3519, 3518, 3517, 3516, 3520, 3517, 3521, 3517, 3520, 3517, 3521, 3519, 3520, 3516, 3522,
+	3515, 3522, 3516, 3523, 3515, 3514, 3522, 3515, 3523, 3524, 3522, 3525, 3522, 3524, 3520, 3523, 3525, 3522, 3526, 3520, 3524, 3520, 3526, 3521,
+	3527, 3519, 3521, 3521, 3528, 3527, 3528, 3521, 3526, 1854, 1853, 3519, 3519, 3527, 1854, 3527, 3529, 1856, 1856, 1854, 3527, 3529, 3527, 3528,
+	3530, 3531, 3528, 3528, 3532, 3530, 3528, 3531, 3529, 3526, 3532, 3528, 3524, 3533, 3526, 3532, 3526, 3533, 3525, 3534, 3524, 3533, 3524, 3534,
+	3534, 3535, 3533, 3533, 3536, 3532, 3536, 3533, 3535, 3532, 3536, 3537, 3537, 3530, 3532, 3538, 3537, 3536, 3536, 3539, 3538, 3535, 3539, 3536,
+	3540, 3541, 3535, 3535, 3534, 3540, 3539, 3535, 3541, 3534, 3525, 3542, 3542, 3540, 3534, 3543, 3542, 3525, 3525, 3523, 3543, 3544, 3545, 3543,
+	3543, 3523, 3544, 3514, 3544, 3523, 3546, 3544, 3514, 3545, 3544, 3546, 3546, 3547, 3545, 3514, 3513, 3546, 3546, 3513, 3548, 3548, 3549, 3546,
+	3547, 3546, 3549, 3549, 3550, 3547, 3507, 3551, 3548, 3548, 3513, 3507, 3551, 3507, 3505, 3505, 3506, 3551, 3552, 3553, 3554, 3554, 3555, 3552,
+	3556, 3557, 3558, 3559, 3560, 3561, 3561, 3562, 3559, 3563, 3564, 3565, 3565, 3566, 3563, 3567, 3566, 3565, 3565, 3568, 3567, 3569, 3570, 3571,
+	3571, 3572, 3569, 3570, 3569, 3573, 3573, 3574, 3570, 3575, 3574, 3573, 3573, 3576, 3575, 3577, 3572, 3571, 3571, 3578, 3577, 3579, 3580, 3581,
+	3581, 3582, 3579, 3582, 3581, 3583, 3583, 3584, 3582, 3585, 3586, 3587, 3587, 3588, 3585, 3589, 3586, 3585, 3585, 3590, 3589, 3591, 3592, 3589,
+	3589, 3590, 3591, 3592, 3591, 3593, 3593, 3594, 3592, 3595, 3596, 3597, 3597, 3598, 3595, 3599, 3598, 3597, 3597, 3600, 3599, 3599, 3600, 3601,
+	3601, 3602, 3599, 3602, 3601, 3603, 3603, 3604, 3602, 3605, 3606, 3607, 3607, 3608, 3605, 3609, 3606, 3605, 3605, 3610, 3609, 3611, 3605, 3608,
+	3610, 3605, 3611, 3612, 3607, 3606, 3606, 3613, 3612, 3613, 3606, 3609, 3609, 3614, 3613, 3609, 3610, 3615, 3614, 3609, 3615, 3611, 3616, 3610,
+	3610, 3616, 3617, 3617, 3615, 3610, 3608, 2554, 3611, 2552, 3611, 2554, 3616, 3611, 2552, 2552, 3618, 3616, 3616, 3618, 3619, 3619, 3617, 3616,
+	3620, 3617, 3619, 3621, 3615, 3617, 3617, 3620, 3621, 3615, 3622, 3614, 3623, 3622, 3615, 3615, 3621, 3623, 3613, 3614, 3624, 3624, 3614, 3622,
+	3622, 3625, 3624, 3626, 3625, 3622, 3622, 3623, 3626, 3623, 3627, 3626, 3627, 3623, 3621, 3621, 3628, 3627, 3620, 3628, 3621, 3619, 3629, 3620,
+	3628, 3620, 3629, 3630, 3619, 3618, 3629, 3619, 3630, 3630, 3631, 3629, 3629, 3632, 3628, 3632, 3629, 3631, 3618, 3633, 3630, 3633, 3634, 3630,
+	3635, 3630, 3634, 3631, 3630, 3635, 3635, 3636, 3631, 3631, 3637, 3632, 3636, 3637, 3631, 3634, 3638, 3635, 3639, 3635, 3638, 3636, 3635, 3639,
+	3634, 3633, 3640, 3640, 3641, 3634, 3638, 3634, 3641, 2552, 2549, 3633, 3633, 3618, 2552, 2549, 3640, 3633, 2551, 3640, 2549, 3641, 3640, 2551,
+	2551, 3642, 3641, 3643, 3641, 3642, 3641, 3643, 3638, 3644, 3638, 3643, 3638, 3644, 3639, 3642, 3645, 3643, 3643, 3646, 3644, 3646, 3643, 3645,
+	3647, 3644, 3646, 3644, 3647, 3639, 3645, 3648, 3646, 3649, 3646, 3648, 3646, 3649, 3647, 3650, 3647, 3649, 3647, 3650, 3651, 3651, 3639, 3647,
+	3648, 2406, 3649, 2407, 3649, 2406, 3649, 2407, 3650, 3652, 3650, 2407, 3650, 3652, 3653, 3653, 3651, 3650, 3654, 3651, 3653, 3655, 3639, 3651,
+	3651, 3654, 3655, 3639, 3655, 3636, 3655, 3656, 3637, 3637, 3636, 3655, 3656, 3655, 3654, 3653, 3657, 3654, 3654, 3658, 3656, 3657, 3658, 3654,
+	3659, 3653, 3652, 3657, 3653, 3659, 2407, 2405, 3652, 3660, 3652, 2405, 3652, 3660, 3659, 3660, 3661, 3659, 3661, 3662, 3659, 3663, 3659, 3662,
+	3664, 3659, 3663, 3659, 3664, 3657, 3658, 3657, 3664, 3664, 2769, 3658, 3663, 2767, 3664, 2769, 3664, 2767, 3662, 3665, 3663, 3666, 3663, 3665,
+	2767, 3663, 3666, 3667, 3668, 3662, 3662, 3661, 3667, 3665, 3662, 3668, 3669, 3667, 3661, 3661, 3660, 3669, 2405, 3669, 3660, 3667, 3669, 3670,
+	3669, 2405, 2404, 2404, 3670, 3669, 3668, 3667, 3671, 3670, 3671, 3667, 3668, 3672, 3673, 3673, 3674, 3668, 3671, 3672, 3668, 3668, 3674, 3665,
+	3674, 3673, 3675, 3675, 3676, 3674, 3665, 3674, 3676, 3676, 3675, 3677, 3676, 3678, 3665, 3679, 3680, 3676, 3676, 3677, 3679, 3676, 3680, 3681,
+	3681, 3678, 3676, 3665, 3678, 3666, 3678, 3681, 3682, 3682, 3666, 3678, 3683, 3681, 3680, 3681, 3683, 3684, 3684, 3682, 3681, 3680, 3679, 2449,
+	2449, 2448, 3680, 3680, 2448, 3683, 2445, 3683, 2448, 3683, 2445, 3685, 3685, 3684, 3683, 3686, 3684, 3685, 3687, 3682, 3684, 3684, 3686, 3687,
+	3688, 3666, 3682, 3682, 3687, 3688, 3666, 3688, 2767, 3688, 2768, 2767, 2768, 3688, 3687, 3687, 3689, 2768, 3686, 3689, 3687, 3685, 3690, 3686,
+	3689, 3686, 3690, 3691, 3685, 2445, 3690, 3685, 3691, 3691, 3692, 3690, 3690, 3693, 3689, 3693, 3690, 3692, 2445, 3694, 3691, 3695, 3691, 3694,
+	3692, 3691, 3695, 3695, 3696, 3692, 3692, 3697, 3693, 3696, 3697, 3692, 3694, 3698, 3695, 3699, 3695, 3698, 3696, 3695, 3699, 2443, 3694, 2445,
+	3698, 3694, 2443, 2443, 2442, 3698, 3700, 3701, 3698, 3698, 2442, 3700, 3698, 3701, 3699, 3702, 3699, 3701, 3703, 3699, 3702, 3699, 3703, 3696,
+	3697, 3696, 3703, 3703, 3704, 3697, 3702, 3705, 3703, 3705, 3704, 3703, 3701, 3706, 3702, 3706, 3707, 3702, 3708, 3702, 3707, 3705, 3702, 3708,
+	3701, 3700, 3709, 3709, 3706, 3701, 2441, 3710, 3700, 3700, 2442, 2441, 3709, 3700, 3710, 3710, 3711, 3709, 3709, 3711, 3712, 3712, 3713, 3709,
+	3707, 3706, 3709, 3709, 3713, 3707, 3714, 3715, 3707, 3707, 3713, 3714, 3707, 3715, 3708, 3716, 3708, 3715, 3717, 3708, 3716, 3708, 3717, 3705,
+	3704, 3705, 3717, 3716, 3718, 3717, 3717, 3719, 3704, 3718, 3719, 3717, 3715, 3720, 3716, 3721, 3716, 3720, 3718, 3716, 3721, 3720, 3715, 3714,
+	3722, 3723, 3720, 3720, 3724, 3722, 3714, 3724, 3720, 3720, 3723, 3721, 3725, 3721, 3723, 3726, 3721, 3725, 3721, 3726, 3718, 3719, 3718, 3726,
+	3726, 3727, 3719, 3725, 3728, 3726, 3728, 3727, 3726, 3723, 3729, 3725, 3730, 3725, 3729, 3728, 3725, 3730, 3729, 3723, 3722, 3731, 3729, 3732,
+	3722, 3732, 3729, 3729, 3731, 3730, 3733, 3730, 3731, 3734, 3730, 3733, 3730, 3734, 3728, 3727, 3728, 3734, 3734, 3735, 3727, 3733, 3736, 3734,
+	3736, 3735, 3734, 3731, 3737, 3733, 3737, 3738, 3733, 3739, 3733, 3738, 3736, 3733, 3739, 3732, 3740, 3731, 3731, 3740, 3741, 3741, 3737, 3731,
+	3732, 3722, 3742, 3742, 3743, 3732, 3743, 3740, 3732, 3741, 3740, 3743, 3743, 3744, 3741, 3745, 3741, 3744, 3738, 3737, 3741, 3741, 3745, 3738,
+	3746, 3738, 3745, 3738, 3746, 3739, 3739, 3747, 3736, 3735, 3736, 3747, 3747, 3748, 3735, 3745, 3749, 3746, 3744, 3750, 3745, 3749, 3745, 3750,
+	3750, 3751, 3749, 3752, 3742, 3722, 3722, 3724, 3752, 3753, 3752, 3724, 3724, 3714, 3753, 3712, 3753, 3714, 3714, 3713, 3712, 3754, 3755, 3756,
+	3756, 3757, 3754, 3756, 3755, 3758, 3758, 3759, 3756, 3758, 3760, 3761, 3761, 3759, 3758, 3762, 3763, 3764, 3764, 3765, 3762, 3766, 3767, 3762,
+	3762, 3765, 3766, 3768, 3767, 3766, 3766, 3769, 3768, 3770, 3771, 3772, 3772, 3773, 3770, 3771, 3774, 3775, 3775, 3772, 3771, 3776, 3777, 3778,
+	3778, 3779, 3776, 3780, 3781, 3782, 3782, 3783, 3780, 3782, 3784, 3785, 3785, 3783, 3782, 3785, 3784, 3786, 3786, 3787, 3785, 3788, 3789, 3790,
+	3790, 3791, 3788, 3789, 3788, 3792, 3792, 3793, 3789, 3794, 3795, 3796, 3796, 3797, 3794, 3797, 3798, 3794, 3796, 3795, 3799, 3800, 3796, 3799,
+	3799, 3801, 3800, 3802, 3800, 3801, 3801, 3803, 3802, 3804, 3798, 3797, 3797, 3805, 3804, 3804, 3805, 3806, 3804, 3806, 3807, 3808, 3809, 3810,
+	3810, 3811, 3808, 3812, 3808, 3811, 3813, 3811, 3810, 3810, 3814, 3813, 3813, 3814, 3815, 3815, 3816, 3813, 3813, 3816, 3817, 3818, 3819, 3820,
+	3820, 3821, 3818, 3822, 3818, 3821, 3819, 3823, 3820, 3821, 3824, 3822, 3822, 3825, 3826, 3826, 3827, 3822, 3825, 3822, 3824, 3825, 3824, 3828,
+	3828, 3829, 3825, 3830, 3829, 3828, 3829, 3830, 3831, 3830, 3832, 3831, 3833, 3834, 3827, 3827, 3826, 3833, 3835, 3836, 3837, 3837, 3838, 3835,
+	3836, 3835, 3839, 3839, 3840, 3836, 3626, 3627, 3841, 3841, 3842, 3626, 3625, 3626, 3842, 3842, 3843, 3625, 3625, 3843, 3844, 3844, 3624, 3625,
+	3624, 3844, 3845, 3624, 3846, 3613, 3845, 3846, 3624, 3845, 3847, 3848, 3848, 3846, 3845, 3846, 3848, 3612, 3612, 3613, 3846, 3849, 3850, 3851,
+	3851, 3852, 3849, 3853, 3849, 3852, 3851, 3850, 3854, 3854, 3855, 3851, 3852, 3851, 3855, 3852, 3856, 3853, 3857, 3856, 3852, 3852, 3858, 3857,
+	3855, 3858, 3852, 3859, 3853, 3856, 3856, 3860, 3859, 3856, 3857, 3861, 3861, 3860, 3856, 3861, 3857, 3862, 3857, 3858, 3863, 3863, 3862, 3857,
+	3863, 3858, 3855, 3864, 3855, 3854, 3855, 3864, 3863, 3854, 3865, 3864, 3864, 3865, 3866, 3866, 3863, 3864, 3867, 3862, 3863, 3863, 3866, 3867,
+	3868, 3869, 3862, 3862, 3867, 3868, 3862, 3869, 3861, 3870, 3861, 3869, 3859, 3860, 3861, 3861, 3870, 3859, 3871, 3869, 3868, 3869, 3871, 3870,
+	3872, 3873, 3874, 3874, 3875, 3872, 3874, 3873, 3876, 3876, 3877, 3874, 3876, 3878, 3879, 3879, 3880, 3876, 3880, 3877, 3876, 3881, 3882, 3883,
+	3883, 3884, 3881, 3884, 3885, 3881, 3882, 3886, 3887, 3887, 3883, 3882, 3888, 3889, 3890, 3891, 3892, 3893, 3894, 3895, 3896, 3896, 3897, 3894,
+	3894, 3898, 3899, 3899, 3895, 3894, 3898, 3900, 3901, 3901, 3899, 3898, 3902, 3903, 3904, 3904, 3905, 3902, 3902, 3905, 3906, 3906, 3907, 3902,
+	3907, 3906, 3908, 3908, 3909, 3907, 3910, 3911, 3912, 3913, 3914, 3910, 3910, 3915, 3913, 3915, 3910, 3912, 3912, 3916, 3915, 3914, 3913, 3917,
+	3917, 3918, 3914, 3919, 3920, 3917, 3917, 3921, 3919, 3917, 3920, 3918, 3922, 3923, 3924, 3925, 3926, 3922, 3922, 3927, 3925, 3923, 3922, 3926,
+	3926, 3928, 3923, 3929, 3925, 3927, 3927, 3930, 3929, 3931, 3932, 3929, 3929, 3933, 3931, 3929, 3930, 3933, 3934, 3935, 3936, 3936, 3935, 3937,
+	3937, 3935, 3938, 3939, 3938, 3935, 3937, 3940, 3936, 3938, 3941, 3937, 3942, 3943, 3944, 3944, 3945, 3942, 3946, 3943, 3942, 3942, 3947, 3946,
+	3948, 3949, 3950, 3951, 3952, 3953, 3953, 3954, 3951, 3952, 3951, 3955, 3956, 3957, 3958, 3958, 3959, 3956, 3956, 3959, 3960, 3960, 3961, 3956,
+	3962, 3963, 3964, 3964, 3965, 3962, 3962, 3966, 3967, 3967, 3963, 3962, 3968, 3969, 3970, 3970, 3971, 3968, 3972, 3968, 3971, 3971, 3973, 3972,
+	3974, 3975, 3976, 3977, 3978, 3979, 3980, 3981, 3982, 3982, 3983, 3980, 3983, 3982, 3984, 3984, 3985, 3983, 3986, 3987, 3988, 3988, 3987, 3989,
+	3989, 3990, 3988, 3991, 3992, 3993, 3993, 3994, 3991, 3995, 3996, 3991, 3991, 3994, 3995, 3996, 3995, 3997, 3997, 3998, 3996, 3999, 4000, 4001,
+	4000, 3999, 4002, 4002, 4003, 4000, 4004, 4005, 4006, 4006, 4007, 4004, 4004, 4007, 4008, 4005, 4009, 4006, 4010, 4006, 4009, 4009, 4011, 4010,
+	4010, 4011, 4012, 4012, 4013, 4010, 4013, 4012, 4014, 4014, 4015, 4013, 4016, 4008, 4007, 4007, 4017, 4016, 4018, 4019, 3977, 4019, 4018, 4020,
+	3979, 4018, 3977, 4020, 4021, 4019, 4020, 4022, 4023, 4023, 4024, 4020, 4025, 4020, 4024, 4021, 4020, 4025, 4023, 4022, 4026, 4026, 4027, 4023,
+	4026, 4028, 4029, 4029, 4030, 4026, 4027, 4026, 4030, 4031, 4029, 4028, 4028, 4032, 4031, 4031, 4032, 4033, 4033, 4034, 4031, 4034, 4033, 4035,
+	4035, 4036, 4034, 4037, 4038, 4039, 4040, 4037, 4039, 4038, 4037, 4041, 4041, 4042, 4038, 4039, 4043, 4040, 4040, 4044, 4045, 4045, 4046, 4040,
+	4047, 4044, 4040, 4043, 4047, 4040, 4048, 4046, 4045, 4045, 4049, 4048, 4048, 4050, 4051, 4051, 4052, 4048, 4049, 4050, 4048, 4052, 4051, 4053,
+	4053, 4054, 4052, 4053, 4055, 4056, 4056, 4054, 4053, 4057, 4056, 4055, 4055, 4058, 4057, 2049, 4059, 2048, 4060, 4061, 4062, 4062, 4063, 4060,
+	4064, 4065, 4060, 4060, 4063, 4064, 4066, 4067, 4068, 4068, 4069, 4066, 4068, 4067, 4070, 4071, 4068, 4070, 4070, 4072, 4073, 4072, 4070, 4074,
+	4070, 4073, 4071, 4074, 4075, 4072, 4076, 4075, 4074, 4074, 4077, 4078, 4078, 4076, 4074, 4078, 4077, 4079, 4079, 4077, 4080, 4080, 4081, 4079,
+	4082, 4083, 4084, 4084, 4085, 4082, 4084, 4086, 4085, 4086, 4084, 4087, 4086, 4088, 4089, 4090, 4086, 4089, 4087, 4088, 4086, 4089, 4091, 4090,
+	4092, 4090, 4091, 4090, 4092, 4093, 4093, 4094, 4090, 4093, 4095, 4094, 4096, 4094, 4095, 4095, 4097, 4096, 4098, 4099, 4100, 4100, 4101, 4098,
+	4102, 4103, 4098, 4098, 4101, 4102, 4104, 4105, 4106, 4107, 4104, 4106, 4106, 4105, 4108, 4108, 4109, 4106, 4106, 4110, 4107, 4107, 4110, 4111,
+	4111, 4110, 4112, 4112, 4113, 4111, 4112, 4114, 4113, 4112, 4115, 4116, 4116, 4114, 4112, 4116, 4115, 4117, 4117, 4118, 4116, 4119, 4118, 4117,
+	4119, 4120, 4118, 4121, 4122, 4109, 4109, 4108, 4121, 4122, 4121, 4123, 4124, 4125, 4122, 4122, 4123, 4124, 4124, 4126, 4125, 4127, 4128, 4125,
+	4125, 4126, 4127, 4129, 4128, 4127, 4129, 4130, 4128, 4129, 4131, 4130, 4132, 4133, 4134, 4134, 4135, 4132, 4136, 4132, 4135, 4135, 4137, 4136,
+	4137, 4138, 4136, 4139, 4140, 4141, 4141, 4142, 4139, 4143, 4144, 4139, 4139, 4142, 4143, 4143, 4145, 4146, 4146, 4144, 4143, 4147, 4146, 4145,
+	4145, 4148, 4147, 4149, 4150, 4151, 4151, 4152, 4149, 4150, 4149, 4153, 4153, 4154, 4150, 4153, 4155, 4156, 4156, 4154, 4153, 4157, 4156, 4155,
+	4155, 4158, 4157, 4159, 4160, 4161, 4161, 4162, 4159, 4163, 4164, 4165, 4165, 4166, 4163, 4167, 4168, 4169, 4169, 4170, 4167, 4171, 4168, 4167,
+	4167, 4172, 4171, 4173, 4171, 4172, 4172, 4174, 4173, 4175, 4173, 4174, 4174, 4176, 4175, 4177, 4175, 4176, 4176, 4178, 4177, 4177, 4178, 4179,
+	4179, 4180, 4177, 4180, 4179, 4181, 4181, 4182, 4180, 4183, 4182, 4181, 4181, 4184, 4183, 4185, 4183, 4184, 4184, 4186, 4185, 4185, 4186, 4187,
+	4187, 4188, 4185, 4188, 4187, 4189, 4189, 4190, 4188, 4191, 4190, 4189, 4189, 4192, 4191, 4191, 4192, 4193, 4193, 4194, 4191, 4194, 4193, 4195,
+	4195, 4196, 4194, 4197, 4196, 4195, 4195, 4198, 4197, 4199, 4197, 4198, 4198, 4200, 4199, 4201, 4202, 4199, 4199, 4200, 4201, 4202, 4201, 4203,
+	4203, 4204, 4202, 4205, 4204, 4203, 4203, 4206, 4205, 4207, 4205, 4206, 4206, 4208, 4207, 4207, 4208, 4209, 4209, 4210, 4207, 4210, 4209, 4211,
+	4211, 4212, 4210, 4213, 4212, 4211, 4211, 4214, 4213, 4215, 4213, 4214, 4214, 4216, 4215, 4217, 4215, 4216, 4216, 4218, 4217, 4219, 4220, 4217,
+	4217, 4218, 4219, 4221, 4220, 4219, 4219, 4222, 4221, 4223, 4221, 4222, 4222, 4224, 4223, 4225, 4226, 4223, 4223, 4224, 4225, 4227, 4226, 4225,
+	4225, 4228, 4227, 4229, 4230, 4227, 4227, 4228, 4229, 4230, 4229, 4231, 4231, 4232, 4230, 4231, 4233, 4234, 4234, 4232, 4231, 4234, 4233, 4235,
+	4235, 4236, 4234, 4237, 4236, 4235, 4235, 4238, 4237, 4239, 4237, 4238, 4238, 4240, 4239, 4241, 4239, 4240, 4240, 4242, 4241, 4243, 4244, 4245,
+	4245, 4246, 4243, 4247, 4243, 4246, 4246, 4248, 4247, 4249, 4250, 4251, 4251, 4252, 4249, 4250, 4253, 4254, 4254, 4251, 4250, 4255, 4254, 4253,
+	4253, 4256, 4255, 4257, 4255, 4256, 4256, 4258, 4257, 4259, 4260, 4257, 4257, 4258, 4259, 4260, 4259, 4261, 4261, 4262, 4260, 4262, 4261, 4263,
+	4261, 4264, 4265, 4265, 4263, 4261, 4266, 4267, 4268, 4268, 4269, 4266, 4269, 4268, 4270, 4270, 4271, 4269, 4271, 4270, 4272, 4272, 4273, 4271,
+	4273, 4272, 4274, 4274, 4275, 4273, 4275, 4274, 4276, 4276, 4277, 4275, 4278, 4279, 4280, 4280, 4281, 4278, 4282, 4280, 4279, 4279, 4283, 4282,
+	4284, 4285, 4286, 4286, 4287, 4284, 4287, 4286, 4288, 4288, 4289, 4287, 4290, 4291, 4292, 4292, 4293, 4290, 4290, 4293, 4294, 4294, 4295, 4290,
+	4296, 3422, 4290, 4290, 4295, 4296, 4290, 3422, 3421, 3421, 4291, 4290, 4291, 4297, 4298, 4298, 4292, 4291, 3426, 4297, 4291, 4291, 3421, 3426,
+	4292, 4299, 4300, 4300, 4293, 4292, 4299, 4292, 4298, 4293, 4300, 4301, 4301, 4294, 4293, 4302, 4301, 4300, 4300, 4303, 4302, 4303, 4300, 4299,
+	4304, 4299, 4305, 4299, 4304, 4303, 4298, 4305, 4299, 4298, 4297, 4306, 4306, 4307, 4298, 4305, 4298, 4307, 3433, 4306, 4297, 4297, 3426, 3433,
+	4307, 4306, 3468, 3468, 4306, 3433, 3468, 3472, 4307, 4308, 4307, 3472, 4307, 4308, 4305, 4309, 4305, 4308, 4305, 4309, 4304, 4310, 4304, 4309,
+	4304, 4310, 4311, 4311, 4303, 4304, 4303, 4311, 4312, 4312, 4302, 4303, 4313, 4311, 4310, 4311, 4313, 4314, 4314, 4312, 4311, 4309, 4315, 4310,
+	4316, 4310, 4315, 4310, 4316, 4313, 4308, 4317, 4309, 4315, 4309, 4317, 4317, 4308, 3476, 3472, 3476, 4308, 3476, 3478, 4317, 3482, 4317, 3478,
+	4317, 3482, 4315, 3490, 4315, 3482, 4315, 3490, 4316, 3491, 4316, 3490, 4318, 4313, 4316, 4316, 3491, 4318, 4319, 4314, 4313, 4313, 4318, 4319,
+	4314, 4319, 4320, 4320, 4321, 4314, 4312, 4314, 4321, 4321, 4320, 4322, 4322, 4323, 4321, 4321, 4324, 4312, 4324, 4321, 4323, 4323, 4322, 4325,
+	4325, 4326, 4323, 4323, 4327, 4324, 4327, 4323, 4326, 4302, 4312, 4324, 4324, 4328, 4302, 4328, 4324, 4327, 4327, 4329, 4328, 4329, 4327, 4330,
+	4326, 4330, 4327, 4331, 4332, 4326, 4326, 4325, 4331, 4330, 4326, 4332, 4330, 4333, 4329, 4333, 4330, 4334, 4332, 4334, 4330, 4329, 4335, 4336,
+	4336, 4328, 4329, 4335, 4329, 4333, 4328, 4336, 4301, 4301, 4302, 4328, 4294, 4301, 4336, 4336, 4337, 4294, 4337, 4336, 4335, 4333, 4338, 4335,
+	4335, 4339, 4337, 4339, 4335, 4338, 4338, 4333, 4340, 4334, 4340, 4333, 4340, 4334, 4341, 4334, 4332, 4342, 4342, 4341, 4334, 4340, 4343, 4338,
+	4343, 4340, 4344, 4341, 4344, 4340, 4338, 4345, 4339, 4345, 4338, 4343, 4346, 4337, 4339, 4339, 4347, 4346, 4339, 4345, 4348, 4348, 4347, 4339,
+	4337, 4346, 4295, 4295, 4294, 4337, 4349, 4346, 4347, 4346, 4349, 4296, 4296, 4295, 4346, 4347, 4350, 4349, 4347, 4348, 4351, 4351, 4350, 4347,
+	4352, 4348, 4345, 4351, 4348, 4352, 4345, 4353, 4352, 4343, 4353, 4345, 4352, 4354, 4351, 4355, 4352, 4353, 4354, 4352, 4355, 4356, 4351, 4354,
+	4351, 4356, 4357, 4357, 4350, 4351, 4350, 4357, 4358, 4358, 4349, 4350, 4296, 4349, 4358, 4358, 4359, 4296, 4296, 3429, 3423, 3423, 3422, 4296,
+	4358, 4357, 4360, 4360, 4361, 4358, 4359, 4358, 4361, 4362, 4360, 4357, 4357, 4356, 4362, 4354, 4363, 4356, 4364, 4362, 4356, 4356, 4363, 4364,
+	4365, 4362, 4364, 4362, 4365, 4366, 4366, 4360, 4362, 4360, 4366, 4367, 4367, 4361, 4360, 4361, 4368, 4359, 4361, 4367, 4369, 4369, 4368, 4361,
+	4370, 4369, 4367, 4367, 4371, 4370, 4371, 4367, 4366, 4366, 4372, 4371, 4372, 4366, 4365, 4364, 4373, 4365, 4365, 4374, 4372, 4374, 4365, 4373,
+	4375, 4364, 4363, 4373, 4364, 4375, 4375, 4376, 4373, 4373, 4377, 4374, 4377, 4373, 4376, 4372, 4374, 4378, 4379, 4378, 4374, 4374, 4377, 4379,
+	4371, 4372, 4380, 4378, 4380, 4372, 4370, 4371, 4381, 4380, 4381, 4371, 4381, 4382, 4370, 4383, 4379, 4377, 4376, 4384, 4377, 4377, 4384, 4383,
+	4384, 4376, 4385, 4386, 4385, 4376, 4376, 4375, 4386, 4385, 3988, 4384, 3990, 4383, 4384, 4384, 3988, 3990, 4387, 3986, 4385, 4385, 4386, 4387,
+	3988, 4385, 3986, 4388, 4386, 4375, 4387, 4386, 4388, 4388, 4389, 4387, 4390, 4389, 4388, 4388, 4391, 4390, 4391, 4388, 4392, 4375, 4392, 4388,
+	4363, 4392, 4375, 4392, 4393, 4391, 4393, 4392, 4363, 4394, 4391, 4393, 4390, 4391, 4394, 4394, 4395, 4390, 4394, 4396, 4397, 4397, 4395, 4394,
+	4394, 4355, 4398, 4398, 4396, 4394, 4393, 4355, 4394, 4355, 4393, 4354, 4363, 4354, 4393, 4353, 4398, 4355, 4399, 4398, 4353, 4398, 4399, 4400,
+	4400, 4396, 4398, 4396, 4400, 4401, 4401, 4397, 4396, 4402, 4400, 4399, 4403, 4401, 4400, 4400, 4402, 4403, 4344, 4399, 4343, 4399, 4344, 4402,
+	4353, 4343, 4399, 4404, 4402, 4344, 4402, 4404, 4405, 4405, 4403, 4402, 4344, 4341, 4404, 4406, 4404, 4341, 4404, 4406, 4407, 4407, 4405, 4404,
+	4341, 4342, 4406, 4408, 4406, 4342, 4409, 4407, 4406, 4406, 4408, 4409, 4410, 4342, 4332, 4342, 4410, 4408, 4332, 4331, 4410, 4411, 4412, 4413,
+	4413, 4414, 4411, 4414, 4413, 4415, 4415, 4416, 4414, 4416, 4415, 4417, 4417, 4418, 4416, 4418, 4417, 4419, 4419, 4420, 4418, 4421, 4422, 4423,
+	4423, 4424, 4421, 4425, 4423, 4422, 4422, 4426, 4425, 4427, 4428, 4429, 4429, 4430, 4427, 4431, 4432, 4433, 4433, 4434, 4431, 4434, 4433, 4435,
+	4435, 4436, 4434, 4437, 4438, 4439, 4439, 4440, 4437, 4441, 4438, 4437, 4437, 4442, 4441, 4443, 4444, 4445, 4445, 4446, 4443, 4446, 4445, 4447,
+	4447, 4448, 4446, 4447, 4449, 4448, 4450, 4451, 4452, 4452, 4453, 4450, 4454, 4450, 4453, 4453, 4455, 4454, 4456, 4454, 4455, 4456, 4455, 4457,
+	4457, 4458, 4456, 4458, 4457, 4459, 4460, 4459, 4457, 4457, 4461, 4460, 4460, 4461, 4462, 4462, 4463, 4460, 4464, 4465, 4466, 4466, 4467, 4464,
+	4464, 4467, 4468, 4468, 4469, 4464, 4468, 4470, 4469, 4470, 4468, 4471, 4471, 4472, 4470, 4472, 4471, 4473, 4473, 4474, 4472, 4475, 4476, 4477,
+	4477, 4478, 4475, 4476, 4479, 4480, 4480, 4477, 4476, 4480, 4479, 4481, 4481, 4482, 4480, 4481, 4483, 4484, 4484, 4482, 4481, 4484, 4483, 4485,
+	4485, 4486, 4484, 4487, 4488, 4489, 4489, 4490, 4487, 4491, 4488, 4487, 4487, 4492, 4491, 4493, 4494, 4495, 4495, 4496, 4493, 4497, 4494, 4493,
+	4497, 4493, 4496, 4496, 4495, 4498, 4498, 4499, 4496, 4496, 4500, 4497, 4496, 4499, 4501, 4501, 4500, 4496, 4499, 4498, 4502, 4502, 4503, 4499,
+	4504, 4499, 4503, 4499, 4504, 4501, 4503, 4502, 4505, 4505, 4506, 4503, 4507, 4503, 4506, 4503, 4507, 4504, 4508, 4509, 4510, 4510, 4511, 4508,
+	4512, 4513, 4514, 4514, 4515, 4512, 4514, 4516, 4517, 4517, 4515, 4514, 4518, 4519, 4520, 4521, 4522, 4518, 4518, 4520, 4521, 4523, 4524, 4525,
+	4525, 4526, 4523, 4523, 4527, 4528, 4528, 4524, 4523, 4527, 4529, 4530, 4530, 4528, 4527, 4529, 4531, 4532, 4532, 4530, 4529, 4533, 4534, 4535,
+	4536, 4537, 4538, 4538, 4539, 4536, 4540, 4541, 4542, 4542, 4543, 4540, 4544, 4540, 4543, 4543, 4545, 4544, 4546, 4547, 4548, 4548, 4549, 4546,
+	4550, 4551, 4552, 4552, 4553, 4550, 4554, 4555, 4556, 4556, 4557, 4554, 4554, 4558, 4559, 4559, 4555, 4554, 4560, 4561, 4562, 4562, 4563, 4560,
+	4560, 4563, 4564, 4564, 4565, 4560, 4566, 4567, 4568, 4569, 4570, 4571, 4571, 4572, 4569, 4573, 4570, 4569, 4569, 4574, 4573, 4571, 4570, 4575,
+	4575, 4570, 4573, 4575, 4576, 4571, 4573, 4577, 4575, 4575, 4578, 4579, 4579, 4576, 4575, 4578, 4575, 4577, 4574, 4580, 4573, 4577, 4581, 4578,
+	4578, 4582, 4583, 4583, 4579, 4578, 4584, 4582, 4578, 4578, 4581, 4584, 4583, 4582, 4585, 4585, 4582, 4584, 4585, 4586, 4583, 4587, 4588, 4585,
+	4585, 4589, 4587, 4586, 4585, 4588, 4584, 4589, 4585, 4588, 4590, 4586, 4591, 4592, 4588, 4588, 4587, 4591, 4588, 4592, 4593, 4593, 4590, 4588,
+	4594, 4591, 4595, 4591, 4594, 4596, 4596, 4592, 4591, 4593, 4592, 4596, 4596, 4597, 4593, 4598, 4599, 4600, 4600, 4601, 4598, 4602, 4603, 4598,
+	4598, 4601, 4602, 4604, 4601, 4600, 4600, 4605, 4604, 4602, 4601, 4604, 4604, 4606, 4602, 4603, 4602, 4607, 4604, 4605, 4608, 4608, 4609, 4604,
+	4606, 4604, 4609, 4609, 4610, 4606, 4609, 4608, 4611, 4611, 4612, 4609, 4613, 4610, 4609, 4609, 4612, 4613, 4614, 4612, 4611, 4611, 4615, 4614,
+	4613, 4612, 4614, 4614, 4616, 4613, 4617, 4616, 4614, 4614, 4618, 4617, 4618, 4614, 4615, 4615, 4619, 4618, 4620, 4617, 4618, 4618, 4621, 4620,
+	4618, 4619, 4622, 4622, 4621, 4618, 4623, 4624, 4620, 4620, 4621, 4625, 4625, 4623, 4620, 4625, 4621, 4622, 4622, 4626, 4625, 4627, 4628, 4629,
+	4629, 4630, 4627, 4631, 4632, 4633, 4633, 4634, 4631, 4635, 4636, 4637, 4637, 4638, 4635, 4639, 4640, 4641, 4640, 4639, 4533, 4639, 4534, 4533,
+	4533, 4642, 4640, 4641, 4640, 4643, 4643, 4644, 4641, 4645, 4644, 4643, 4643, 4646, 4645, 4647, 4645, 4646, 4646, 4648, 4647, 4649, 4647, 4648,
+	4648, 4650, 4649, 4642, 4533, 4651, 4651, 4652, 4642, 4535, 4651, 4533, 4651, 4535, 4653, 4653, 4654, 4651, 4652, 4651, 4654, 4654, 4655, 4652,
+	4656, 4654, 4653, 4657, 4655, 4654, 4654, 4656, 4657, 4653, 4658, 4656, 4659, 4656, 4658, 4656, 4659, 4660, 4660, 4657, 4656, 4658, 4661, 4659,
+	4662, 4660, 4659, 4659, 4661, 4662, 4662, 4661, 4663, 4663, 4664, 4662, 4664, 4663, 4665, 4665, 4666, 4664, 4667, 4666, 4665, 4665, 4668, 4667,
+	4669, 4670, 4667, 4667, 4668, 4669, 4671, 4672, 4673, 4673, 4674, 4671, 4675, 4672, 4671, 4671, 4676, 4675, 4673, 4677, 4678, 4678, 4674, 4673,
+	4679, 4675, 4676, 4676, 4680, 4679, 4681, 4682, 4679, 4679, 4680, 4681, 4681, 4680, 4683, 4682, 4681, 4684, 4683, 4684, 4681, 4684, 4685, 4682,
+	4685, 4684, 4686, 4684, 4683, 4687, 4687, 4686, 4684, 4686, 4688, 4685, 4686, 4689, 4690, 4690, 4688, 4686, 4689, 4686, 4687, 4687, 4691, 4689,
+	4689, 4692, 4693, 4693, 4690, 4689, 4692, 4689, 4691, 4691, 4694, 4692, 4694, 4695, 4692, 4696, 4693, 4692, 4692, 4695, 4696, 4696, 4695, 4697,
+	4697, 4698, 4696, 4698, 4697, 4699, 4699, 4700, 4698, 4700, 4699, 4701, 4701, 4702, 4700, 4702, 4701, 4703, 4703, 4704, 4702, 4705, 4706, 4707,
+	4707, 4708, 4705, 4705, 4708, 4709, 4709, 4710, 4705, 4706, 4711, 4712, 4712, 4707, 4706, 4710, 4709, 4713, 4713, 4714, 4710, 4714, 4713, 4715,
+	4715, 4716, 4714, 4717, 4718, 4719, 4719, 4720, 4717, 4721, 4718, 4717, 4717, 4722, 4721, 4723, 4721, 4722, 4722, 4724, 4723, 4725, 4723, 4724,
+	4724, 4726, 4725, 4726, 4727, 4725, 4728, 4729, 4725, 4725, 4727, 4728, 4730, 4729, 4728, 4728, 4731, 4730, 4732, 4730, 4731, 4732, 4733, 4730,
+	4733, 4732, 4734, 4734, 4735, 4733, 4735, 4734, 4736, 4736, 4737, 4735, 4737, 4736, 4738, 4738, 4739, 4737, 4738, 4740, 4741, 4741, 4739, 4738,
+	4741, 4740, 4742, 4742, 4743, 4741, 4744, 4743, 4742, 4742, 4745, 4744, 4746, 4744, 4747, 4744, 4745, 4747, 4747, 4748, 4746, 4749, 4750, 4746,
+	4746, 4748, 4749, 4750, 4749, 4751, 4751, 4752, 4750, 4751, 4753, 4754, 4754, 4752, 4751, 4754, 4753, 4755, 4755, 4756, 4754, 4756, 4755, 4757,
+	4757, 4758, 4756, 4757, 4759, 4760, 4760, 4758, 4757, 4759, 4761, 4762, 4762, 4760, 4759, 4761, 4763, 4764, 4764, 4762, 4761, 4764, 4763, 4765,
+	4765, 4766, 4764, 4766, 4765, 4767, 4767, 4768, 4766, 4769, 4768, 4767, 4767, 4770, 4769, 4769, 4770, 4771, 4771, 4772, 4769, 4772, 4771, 4773,
+	4773, 4774, 4772, 4774, 4773, 4775, 4775, 4776, 4774, 4776, 4775, 4777, 4777, 4778, 4776, 4778, 4777, 4779, 4779, 4780, 4778, 4779, 4781, 4782,
+	4782, 4780, 4779, 4782, 4781, 4783, 4783, 4784, 4782, 4785, 4784, 4783, 4783, 4786, 4785, 4787, 4785, 4786, 4786, 4788, 4787, 4787, 4788, 4789,
+	4789, 4790, 4787, 4791, 4792, 4793, 4793, 4794, 4791, 4793, 4792, 4795, 4795, 4796, 4793, 4795, 4797, 4798, 4798, 4796, 4795, 4799, 4800, 4801,
+	4801, 4802, 4799, 4803, 4804, 4805, 4805, 4806, 4803, 4807, 4808, 4809, 4809, 4810, 4807, 4811, 4812, 4813, 4813, 4814, 4811, 4813, 4812, 4815,
+	4815, 4816, 4813, 4817, 4818, 4819, 4819, 4820, 4817, 4821, 4820, 4819, 4819, 4822, 4821, 4823, 4824, 4825, 4825, 4826, 4823, 4827, 4828, 4829,
+	4829, 4830, 4827, 4831, 4832, 4833, 4834, 4835, 4836, 4836, 4837, 4834, 4838, 4839, 4840, 4840, 4841, 4838, 4842, 4843, 4844, 4844, 4845, 4842,
+	4843, 4846, 4847, 4847, 4844, 4843, 4848, 4849, 4850, 4850, 4851, 4848, 4852, 4853, 4854, 4854, 4855, 4852, 4855, 4854, 4856, 4856, 4857, 4855,
+	4858, 4859, 4860, 4860, 4861, 4858, 4859, 4858, 4862, 4863, 4859, 4862, 4864, 4865, 4862, 4862, 4866, 4864, 4862, 4865, 4863, 4863, 4865, 4867,
+	4867, 4865, 4868, 4869, 4867, 4868, 4869, 4868, 4870, 4871, 4869, 4870, 4872, 4861, 4870, 4870, 4873, 4872, 4871, 4870, 4861, 4860, 4871, 4861,
+	4874, 4872, 4873, 4873, 4875, 4874, 4876, 4874, 4875, 4875, 4877, 4876, 4878, 4864, 4866, 4866, 4879, 4878, 4880, 4881, 4878, 4878, 4879, 4880,
+	4882, 4883, 4884, 4884, 4885, 4882, 4884, 4883, 4886, 4886, 4887, 4884, 4887, 4886, 4888, 4888, 4889, 4887, 4888, 4890, 4891, 4891, 4889, 4888,
+	4890, 4892, 4893, 4893, 4891, 4890, 4893, 4892, 4894, 4894, 4895, 4893, 4896, 4897, 4898, 4898, 4899, 4896, 4900, 4899, 4898, 4898, 4901, 4900,
+	4902, 4900, 4901, 4901, 4903, 4902, 4902, 4903, 4904, 4904, 4905, 4902, 4905, 4904, 4906, 4906, 4907, 4905, 4908, 4907, 4906, 4906, 4909, 4908,
+	4910, 4911, 4912, 4912, 4913, 4910, 4914, 4915, 4916, 4914, 4916, 4917, 4918, 4914, 4917, 4914, 4919, 4915, 4915, 4920, 4921, 4921, 4922, 4915,
+	4916, 4915, 4922, 4922, 4923, 4916, 4923, 4924, 4916, 4917, 4916, 4924, 4925, 4922, 4921, 4923, 4922, 4925, 4921, 4926, 4927, 4927, 4928, 4921,
+	4926, 4921, 4920, 4921, 4928, 4925, 4925, 4928, 4929, 4929, 4930, 4925, 4925, 4930, 4931, 4925, 4931, 4923, 4924, 4923, 4931, 4931, 4932, 4924,
+	4933, 4924, 4932, 4924, 4933, 4917, 4931, 4930, 4934, 4934, 4935, 4931, 4932, 4931, 4935, 4930, 4929, 4934, 4934, 4936, 4937, 4934, 4937, 4938,
+	4935, 4934, 4938, 4938, 4939, 4935, 4939, 4940, 4935, 4935, 4940, 4932, 4938, 4941, 4942, 4942, 4939, 4938, 4943, 4939, 4942, 4940, 4939, 4943,
+	4932, 4940, 4944, 4943, 4944, 4940, 4945, 4943, 4942, 4944, 4943, 4945, 4942, 4946, 4945, 4946, 4947, 4945, 4945, 4948, 4944, 4944, 4949, 4932,
+	4950, 4949, 4944, 4944, 4948, 4950, 4949, 4951, 4932, 4952, 4951, 4949, 4949, 4950, 4952, 4932, 4951, 4933, 4953, 4933, 4951, 4951, 4952, 4953,
+	4917, 4933, 4953, 4953, 4954, 4917, 4917, 4955, 4918, 4955, 4917, 4954, 4955, 4956, 4918, 4957, 4958, 4959, 4959, 4960, 4957, 4958, 4957, 4961,
+	4961, 4962, 4958, 4963, 4964, 4965, 4965, 4966, 4963, 4964, 4963, 4967, 4967, 4968, 4964, 4965, 4964, 4969, 4964, 4968, 4970, 4970, 4969, 4964,
+	4969, 4971, 4965, 4972, 4970, 4968, 4973, 4974, 4968, 4968, 4967, 4973, 4968, 4974, 4972, 4974, 4975, 4972, 4974, 4973, 4975, 4976, 4977, 4978,
+	4978, 4979, 4976, 4980, 4976, 4979, 4981, 4979, 4978, 4978, 4982, 4981, 4979, 4983, 4980, 4979, 4981, 4984, 4984, 4983, 4979, 4985, 4980, 4983,
+	4983, 4986, 4985, 4987, 4986, 4983, 4983, 4984, 4987, 4986, 4988, 4985, 4986, 4987, 4988, 4989, 4990, 4991, 4991, 4992, 4989, 4989, 4992, 4993,
+	4993, 4994, 4989, 4991, 4990, 4995, 4995, 4996, 4991, 4991, 4996, 4997, 4997, 4998, 4991, 4992, 4991, 4998, 4998, 4999, 4992, 4993, 4992, 4999,
+	4999, 5000, 4993, 5001, 5002, 4993, 4993, 5000, 5001, 5003, 4994, 4993, 4993, 5002, 5003, 5002, 5001, 5004, 5004, 5005, 5002, 5003, 5002, 5005,
+	5005, 5006, 5003, 5005, 5004, 5007, 5007, 5008, 5005, 5005, 5008, 5009, 5009, 5006, 5005, 5008, 5007, 5010, 5010, 5011, 5008, 5011, 5009, 5008,
+	5012, 4997, 4996, 4996, 5013, 5012, 5013, 4996, 4995, 5014, 5015, 5016, 5016, 5017, 5014, 5014, 5018, 5015, 5019, 5018, 5014, 5020, 5021, 5014,
+	5014, 5017, 5020, 5019, 5014, 5021, 5022, 5017, 5016, 5020, 5017, 5022, 5022, 5023, 5020, 5024, 5020, 5023, 5020, 5024, 5025, 5025, 5021, 5020,
+	5026, 5019, 5021, 5026, 5021, 5027, 5027, 5021, 5025, 5025, 5028, 5027, 5025, 5024, 5029, 5029, 5030, 5025, 5025, 5030, 5028, 5031, 5029, 5024,
+	5032, 5031, 5024, 5024, 5033, 5032, 5023, 5033, 5024, 5033, 5023, 5034, 5034, 5023, 5022, 5034, 5035, 5033, 5036, 5032, 5033, 5033, 5035, 5036,
+	5034, 5037, 5035, 5038, 5037, 5034, 5034, 5039, 5038, 5040, 5041, 5034, 5022, 5040, 5034, 5041, 5039, 5034, 5042, 5036, 5035, 5035, 5037, 5042,
+	5037, 5043, 5042, 5037, 5038, 5043, 5044, 5041, 5040, 5045, 5046, 5040, 5040, 5022, 5045, 5046, 5047, 5040, 5048, 5040, 5047, 5040, 5048, 5044,
+	5016, 5045, 5022, 5045, 5016, 5049, 5049, 5050, 5045, 5045, 5050, 5051, 5051, 5046, 5045, 5047, 5046, 5051, 5051, 5052, 5047, 5047, 5053, 5048,
+	5047, 5052, 5054, 5054, 5053, 5047, 5055, 5049, 5016, 5056, 5055, 5016, 5016, 5015, 5056, 5057, 5056, 5015, 5015, 5058, 5057, 5058, 5015, 5059,
+	5018, 5059, 5015, 5060, 5061, 5062, 5062, 5063, 5060, 5060, 5063, 5064, 5064, 5065, 5060, 5066, 5060, 5065, 5067, 5061, 5060, 5060, 5068, 5067,
+	5069, 5068, 5060, 5060, 5066, 5069, 5062, 5061, 5070, 5070, 5061, 5067, 5067, 5071, 5070, 5071, 5067, 5072, 5067, 5068, 5073, 5073, 5072, 5067,
+	5074, 5068, 5069, 5075, 5068, 5074, 5075, 5073, 5068, 5073, 5076, 5077, 5077, 5078, 5073, 5073, 5078, 5079, 5079, 5072, 5073, 5075, 5076, 5073,
+	5080, 5072, 5079, 5081, 5082, 5072, 5072, 5080, 5081, 5072, 5082, 5071, 5083, 5071, 5082, 5070, 5071, 5083, 5082, 5084, 5083, 5085, 5084, 5082,
+	5082, 5081, 5085, 5083, 5084, 5086, 5087, 5088, 5083, 5083, 5086, 5087, 5089, 5083, 5088, 5083, 5089, 5070, 5090, 5086, 5084, 5084, 5085, 5090,
+	5086, 5090, 5091, 5091, 5087, 5086, 5070, 5092, 5062, 5092, 5070, 5089, 5089, 5093, 5092, 5093, 5089, 5094, 5094, 5089, 5095, 5095, 5089, 5096,
+	5088, 5096, 5089, 5092, 5097, 5098, 5098, 5062, 5092, 5092, 5093, 5099, 5099, 5097, 5092, 5100, 5063, 5062, 5062, 5098, 5100, 5063, 5100, 5101,
+	5101, 5102, 5063, 5102, 5064, 5063, 5099, 5093, 5094, 5094, 5103, 5099, 5104, 5103, 5094, 5094, 5105, 5104, 5095, 5105, 5094, 5106, 5107, 5108,
+	5108, 5107, 5109, 5109, 5110, 5108, 5109, 5111, 5110, 5112, 5113, 5114, 5114, 5115, 5112, 5112, 5116, 5117, 5117, 5113, 5112, 5113, 5118, 5119,
+	5119, 5114, 5113, 5118, 5113, 5117, 5114, 5120, 5121, 5121, 5115, 5114, 5114, 5119, 5122, 5122, 5120, 5114, 5123, 5121, 5120, 5120, 5122, 5124,
+	5124, 5123, 5120, 5117, 5125, 5118, 5126, 5125, 5117, 5117, 5127, 5126, 5128, 5127, 5117, 5117, 5116, 5128, 5129, 5126, 5127, 5127, 5130, 5129,
+	5130, 5127, 5128, 5128, 5131, 5130, 5130, 5132, 5133, 5133, 5129, 5130, 5130, 5131, 5134, 5134, 5132, 5130, 5132, 5135, 5136, 5136, 5133, 5132,
+	5135, 5132, 5134, 5137, 5138, 5139, 5139, 5140, 5137, 5138, 5137, 5141, 5141, 5142, 5138, 5142, 5141, 5143, 5143, 5144, 5142, 5143, 5145, 5146,
+	5146, 5144, 5143, 5145, 5147, 5148, 5148, 5146, 5145, 5149, 5150, 5151, 5151, 5152, 5149, 5153, 5149, 5152, 5152, 5154, 5153, 5155, 5153, 5154,
+	5154, 5156, 5155, 5155, 5156, 5157, 5157, 5158, 5155, 5158, 5157, 5159, 5159, 5160, 5158, 5161, 5162, 5163, 5164, 5165, 5166, 5166, 5167, 5164,
+	5165, 5164, 5168, 5168, 5169, 5165, 5168, 5170, 5171, 5171, 5169, 5168, 5171, 5170, 5172, 5172, 5173, 5171, 5173, 5172, 5174, 5174, 5175, 5173,
+	5175, 5174, 5176, 5176, 5177, 5175, 5177, 5176, 5178, 5178, 5179, 5177, 5179, 5178, 5180, 5180, 5181, 5179, 5181, 5180, 5182, 5182, 5183, 5181,
+	5183, 5182, 5184, 5184, 5185, 5183, 5185, 5184, 5186, 5186, 5187, 5185, 5187, 5186, 5188, 5188, 5189, 5187, 5188, 5190, 5191, 5191, 5189, 5188,
+	5191, 5190, 5167, 5167, 5166, 5191, 5192, 5193, 5194, 5194, 5195, 5192, 5192, 5196, 5197, 5197, 5193, 5192, 5195, 5194, 5198, 5198, 5199, 5195,
+	5199, 5198, 5200, 5200, 5201, 5199, 5202, 5201, 5200, 5200, 5203, 5202, 5202, 5203, 5204, 5204, 5205, 5202, 5205, 5204, 5206, 5206, 5207, 5205,
+	5207, 5206, 5208, 5208, 5209, 5207, 5209, 5208, 5210, 5210, 5211, 5209, 5211, 5210, 5212, 5212, 5213, 5211, 5213, 5212, 5214, 5214, 5215, 5213,
+	5215, 5214, 5216, 5216, 5217, 5215, 5217, 5216, 5218, 5218, 5219, 5217, 5219, 5218, 5197, 5197, 5196, 5219, 5220, 5221, 5222, 5222, 5223, 5220,
+	5224, 5221, 5220, 5220, 5225, 5224, 5223, 5222, 5226, 5226, 5227, 5223, 5228, 5227, 5226, 5226, 5229, 5228, 5230, 5228, 5229, 5229, 5231, 5230,
+	5232, 5233, 5230, 5230, 5231, 5232, 5234, 5224, 5225, 5225, 5235, 5234, 5236, 5234, 5235, 5235, 5237, 5236, 5238, 5239, 5240, 5240, 5241, 5238,
+	5241, 5240, 5242, 5242, 5243, 5241, 5244, 5245, 5246, 5246, 5247, 5244, 5245, 5248, 5249, 5249, 5246, 5245, 2019, 5250, 2018, 5251, 5252, 5253,
+	5253, 5254, 5251, 5252, 5251, 5255, 5255, 5256, 5252, 5257, 5258, 5259, 5259, 5260, 5257, 5261, 5257, 5260, 5260, 5262, 5261, 5263, 5264, 5265,
+	5266, 5263, 5267, 5267, 5263, 5265, 5268, 5264, 5263, 5263, 5269, 5268, 5270, 5269, 5263, 5263, 5266, 5270, 5265, 5271, 5267, 5267, 5272, 5266,
+	5273, 5274, 5275, 5276, 5273, 5277, 5274, 5273, 5276, 5278, 5279, 5273, 5273, 5275, 5278, 5280, 5277, 5273, 5273, 5279, 5280, 5276, 5281, 5274,
+	5277, 5282, 5276, 5283, 5284, 5285, 5285, 5286, 5283, 5287, 5288, 5289, 5289, 5290, 5287, 5287, 5291, 5292, 5292, 5288, 5287, 5293, 5292, 5291,
+	5294, 5295, 5296, 5296, 5297, 5294, 5298, 5295, 5294, 5294, 5299, 5298, 5300, 5301, 5302, 5302, 5303, 5300, 5304, 5305, 5300, 5300, 5303, 5304,
+	5306, 5307, 5308, 5308, 5309, 5306, 5307, 5306, 5310, 5310, 5311, 5307, 5312, 5309, 5308, 5308, 5313, 5312, 5314, 5315, 5312, 5312, 5313, 5314,
+	5316, 5315, 5314, 5314, 5317, 5316, 5318, 5316, 5317, 5317, 5319, 5318, 5320, 5321, 5322, 5322, 5323, 5320, 5324, 5320, 5323, 5322, 5321, 5325,
+	5325, 5326, 5322, 5327, 5326, 5325, 5325, 5328, 5327, 5329, 5330, 5327, 5327, 5328, 5329, 5330, 5329, 5331, 5331, 5332, 5330, 5323, 5333, 5324,
+	5334, 5335, 5336, 5337, 5334, 5336, 5334, 5337, 5338, 5338, 5339, 5334, 5336, 5340, 5337, 5341, 5337, 5340, 5342, 5337, 5341, 5343, 5338, 5337,
+	5337, 5342, 5343, 5338, 5344, 5345, 5345, 5339, 5338, 5344, 5338, 5343, 5346, 5343, 5347, 5347, 5343, 5342, 5343, 5346, 5344, 5348, 5349, 5342,
+	5341, 5348, 5342, 5350, 5342, 5349, 5342, 5350, 5347, 5347, 5350, 5351, 5351, 5352, 5347, 5353, 5347, 5352, 5347, 5353, 5346, 5346, 5353, 5354,
+	5354, 5355, 5346, 5344, 5346, 5355, 5355, 5356, 5344, 5345, 5344, 5356, 5356, 5357, 5345, 5358, 5356, 5355, 5357, 5356, 5358, 5359, 5355, 5354,
+	5355, 5359, 5358, 5360, 5361, 5354, 5354, 5353, 5360, 5362, 5363, 5354, 5354, 5361, 5362, 5354, 5363, 5359, 5352, 5360, 5353, 5364, 5352, 5351,
+	5365, 5364, 5351, 5351, 5350, 5366, 5366, 5367, 5351, 5349, 5366, 5350, 5360, 5368, 5362, 5362, 5361, 5360, 5362, 5368, 5369, 5370, 5369, 5371,
+	5372, 5369, 5370, 5369, 5372, 5362, 5373, 5374, 5370, 5370, 5375, 5373, 5376, 5377, 5370, 5370, 5374, 5376, 5371, 5375, 5370, 5370, 5377, 5372,
+	5378, 5372, 5377, 5379, 5372, 5378, 5372, 5379, 5380, 5362, 5372, 5380, 5381, 5377, 5376, 5377, 5381, 5378, 5376, 5382, 5381, 5381, 5383, 5378,
+	5384, 5378, 5383, 5379, 5378, 5384, 5384, 5380, 5379, 5380, 5385, 5362, 5386, 5363, 5362, 5362, 5385, 5386, 5385, 5387, 5388, 5388, 5386, 5385,
+	5389, 5390, 5386, 5386, 5388, 5389, 5359, 5363, 5386, 5386, 5390, 5359, 5391, 5390, 5389, 5392, 5391, 5389, 5389, 5393, 5392, 5390, 5394, 5358,
+	5358, 5359, 5390, 5391, 5394, 5390, 5394, 5391, 5392, 5393, 5395, 5392, 5392, 5396, 5394, 5397, 5358, 5394, 5394, 5396, 5397, 5358, 5397, 5357,
+	5398, 5399, 5400, 5400, 5401, 5398, 5402, 5403, 5404, 5404, 2206, 5402, 2208, 5402, 2206, 5403, 5405, 5406, 5406, 5404, 5403, 5407, 5406, 5405,
+	5405, 5408, 5407, 5409, 5407, 5408, 5408, 5410, 5409, 5411, 5409, 5410, 5410, 5412, 5411, 5413, 5411, 5412, 5412, 5414, 5413, 5415, 5413, 5414,
+	5414, 5416, 5415, 5415, 5416, 5417, 5417, 5418, 5415, 5418, 5417, 5419, 5419, 5420, 5418, 5421, 5420, 5419, 5419, 5422, 5421, 5423, 5421, 5422,
+	5422, 5424, 5423, 5423, 5424, 5425, 5425, 5426, 5423, 5426, 5425, 5427, 5427, 5428, 5426, 5428, 5427, 5429, 5429, 5430, 5428, 5430, 5429, 5431,
+	5431, 5432, 5430, 5432, 5431, 5433, 5433, 5434, 5432, 5434, 5433, 5435, 5435, 5436, 5434, 5436, 5435, 5437, 5437, 5438, 5436, 5438, 5437, 5439,
+	5439, 5440, 5438, 5440, 5439, 5441, 5441, 5442, 5440, 5443, 4926, 5444, 5443, 4927, 4926, 5445, 5446, 5443, 5447, 5443, 5446, 5444, 5445, 5443,
+	5447, 4927, 5443, 5445, 5448, 5446, 5449, 5446, 5450, 5446, 5449, 5447, 5450, 5446, 5448, 5448, 5451, 5450, 5450, 5452, 5449, 5453, 5454, 5455,
+	5455, 5456, 5453, 5456, 5455, 5457, 5457, 5458, 5456, 5459, 5460, 5461, 5461, 5462, 5459, 5460, 5463, 5464, 5464, 5461, 5460, 5465, 5466, 5467,
+	5467, 5468, 5465, 5465, 5468, 5469, 5469, 5470, 5465, 5469, 5471, 5470, 5470, 5471, 5472, 5472, 5473, 5470, 5473, 5472, 5474, 5474, 5475, 5473,
+	3541, 5476, 3539, 3539, 5476, 5477, 5477, 3538, 3539, 5478, 5479, 4567, 4567, 4566, 5478, 5479, 5478, 5480, 5480, 5481, 5479, 5481, 5480, 5482,
+	5482, 5483, 5481, 5484, 5483, 5482, 5482, 5485, 5484, 5486, 5487, 5484, 5484, 5485, 5486, 5487, 5486, 5488, 5488, 5489, 5487, 5488, 5490, 5491,
+	5491, 5489, 5488, 5491, 5490, 5492, 5492, 5493, 5491, 5493, 5492, 5494, 5494, 5495, 5493, 5494, 5496, 5497, 5497, 5495, 5494, 5498, 5497, 5496,
+	5496, 5499, 5498, 5498, 5499, 5500, 5500, 5501, 5498, 5500, 5502, 5503, 5503, 5501, 5500, 5504, 5503, 5502, 5502, 5505, 5504, 5506, 5507, 5504,
+	5504, 5505, 5506, 5506, 5508, 5509, 5509, 5507, 5506, 5510, 5509, 5508, 5508, 5511, 5510, 5512, 5510, 5511, 5511, 5513, 5512, 5512, 5513, 5514,
+	5515, 5516, 5517, 5517, 5518, 5515, 5519, 5516, 5515, 5515, 5520, 5519, 5516, 5519, 5521, 5522, 5523, 5516, 5516, 5521, 5522, 5524, 5517, 5516,
+	5516, 5523, 5524, 5525, 5526, 5527, 5527, 5528, 5525, 5529, 5530, 5525, 5525, 5528, 5529, 5528, 5527, 5531, 5528, 5532, 5529, 5533, 5532, 5528,
+	5528, 5534, 5533, 5531, 5534, 5528, 5535, 5536, 5537, 5537, 5538, 5535, 5539, 5535, 5538, 5538, 5537, 5540, 5538, 5541, 5539, 5541, 5538, 5542,
+	5540, 5542, 5538, 5543, 5539, 5541, 5541, 5544, 5543, 5542, 5545, 5541, 5545, 5544, 5541, 5542, 5540, 5546, 5546, 5545, 5542, 5547, 5545, 5546,
+	5544, 5545, 5547, 5547, 5543, 5544, 5546, 5548, 5547, 5548, 5546, 5549, 5550, 5551, 5552, 5552, 5553, 5550, 5554, 5555, 5556, 5556, 5557, 5554,
+	5383, 5558, 5384, 5559, 5560, 5561, 5561, 5562, 5559, 5563, 5564, 5565, 5565, 5566, 5563, 5566, 5567, 5563, 5565, 5564, 5568, 5569, 5570, 5571,
+	5571, 5572, 5569, 5570, 5569, 5573, 5573, 5574, 5570, 5575, 5576, 5577, 5577, 5578, 5575, 5579, 5575, 5578, 5578, 5580, 5579, 5581, 5582, 5583,
+	5583, 5584, 5581, 5585, 5582, 5581, 5581, 5586, 5585, 5585, 5586, 5587, 5587, 5588, 5585, 5589, 5588, 5587, 5587, 5590, 5589, 5591, 5589, 5590,
+	5590, 5592, 5591, 5593, 5591, 5592, 5592, 5594, 5593, 5595, 5593, 5594, 5594, 5596, 5595, 5595, 5596, 5597, 5597, 5598, 5595, 5597, 5599, 5600,
+	5600, 5598, 5597, 5600, 5599, 5601, 5601, 5602, 5600, 5603, 5604, 5605, 5605, 5606, 5603, 5604, 5603, 5607, 5607, 5608, 5604, 5608, 5607, 5609,
+	5610, 5611, 5612, 5612, 5613, 5610, 5614, 5615, 5616, 5616, 5617, 5614, 5618, 5619, 5620, 5619, 5618, 5621, 5621, 5622, 5619, 5623, 5624, 5625,
+	5625, 5626, 5623, 5627, 5624, 5623, 5623, 5628, 5627, 5629, 5630, 5631, 5631, 5632, 5629, 5633, 5630, 5629, 5629, 5634, 5633, 5635, 5633, 5634,
+	5634, 5636, 5635, 5637, 5638, 5639, 5639, 5640, 5637, 5641, 5642, 5637, 5637, 5640, 5641, 5642, 5641, 5643, 5643, 5644, 5642, 5645, 5646, 5647,
+	5647, 5648, 5645, 5646, 5645, 5649, 5649, 5650, 5646, 5648, 5647, 5651, 5651, 5652, 5648, 5653, 5654, 5655, 5655, 5656, 5653, 5654, 5657, 5658,
+	5658, 5655, 5654, 5659, 5656, 5660, 5659, 5661, 5656, 5662, 5663, 5664, 5664, 5665, 5662, 5665, 5664, 5666, 5665, 5666, 5667, 5668, 5669, 5670,
+	5670, 5671, 5668, 5672, 5668, 5671, 5673, 5670, 5669, 5669, 5674, 5673, 5674, 5669, 5675, 5676, 5673, 5674, 5674, 5677, 5676, 5676, 5677, 5678,
+	5678, 5679, 5676, 5679, 5678, 5680, 5680, 5678, 5681, 5681, 5682, 5680, 5682, 5681, 5683, 5683, 5684, 5682, 5684, 5683, 5685, 5671, 5686, 5672,
+	5686, 5687, 5672, 5688, 5689, 5690, 5690, 5691, 5688, 5692, 5693, 5694, 5694, 5695, 5692, 5693, 5692, 5696, 5696, 5697, 5693, 5697, 5696, 5698,
+	5699, 5695, 5694, 5700, 5701, 5695, 5695, 5699, 5700, 5700, 5702, 5703, 5703, 5701, 5700, 5702, 5704, 5703, 5705, 5703, 5704, 5704, 5706, 5705,
+	5707, 5705, 5706, 5706, 5708, 5707, 5708, 5709, 5707, 5710, 5711, 5712, 5712, 5713, 5710, 5710, 5713, 5714, 5714, 5715, 5710, 5712, 5711, 5716,
+	5716, 5717, 5712, 5718, 5719, 5715, 5715, 5714, 5718, 5718, 5720, 5721, 5721, 5719, 5718, 5722, 5721, 5720, 5720, 5723, 5722, 5722, 5723, 5724,
+	5724, 5725, 5722, 5724, 5726, 5727, 5727, 5725, 5724, 5728, 5729, 5730, 5730, 5731, 5728, 5728, 5732, 5733, 5733, 5729, 5728, 5730, 5734, 5735,
+	5735, 5731, 5730, 5736, 5733, 5732, 5732, 5737, 5736, 5736, 5737, 5738, 5738, 5739, 5736, 5739, 5738, 5740, 5740, 5741, 5739, 5740, 5742, 5743,
+	5743, 5741, 5740, 5743, 5742, 5744, 5744, 5745, 5743, 5746, 5747, 5748, 5748, 5749, 5746, 5750, 5746, 5749, 5747, 5751, 5752, 5752, 5748, 5747,
+	5751, 5753, 5754, 5754, 5752, 5751, 5753, 5755, 5756, 5756, 5754, 5753, 5755, 5757, 5758, 5758, 5756, 5755, 5757, 5759, 5760, 5760, 5758, 5757,
+	5759, 5750, 5761, 5761, 5760, 5759, 5749, 5761, 5750, 5762, 5763, 5764, 5764, 5765, 5762, 5766, 5762, 5765, 5764, 5763, 5767, 5767, 5768, 5764,
+	5768, 5767, 5769, 5769, 5770, 5768, 5769, 5771, 5772, 5772, 5770, 5769, 5773, 5772, 5771, 5771, 5774, 5773, 5775, 5773, 5774, 5774, 5776, 5775,
+	5775, 5777, 5778, 5778, 5779, 5775, 5775, 5780, 5777, 5775, 5776, 5780, 5779, 5778, 5781, 5782, 5783, 5779, 5779, 5781, 5782, 5783, 5782, 5784,
+	5784, 5785, 5783, 5784, 5786, 5785, 5787, 5788, 5785, 5785, 5786, 5787, 5787, 5789, 5788, 5788, 5789, 5790, 5790, 5791, 5788, 5791, 5790, 5792,
+	5792, 5793, 5791, 5792, 5794, 5795, 5795, 5793, 5792, 5796, 5795, 5794, 5794, 5797, 5796, 5798, 5796, 5797, 5797, 5766, 5798, 5765, 5798, 5766,
+	5799, 5800, 5801, 5801, 5802, 5799, 5800, 5799, 5803, 5803, 5804, 5800, 5804, 5803, 5805, 5805, 5806, 5804, 5806, 5805, 5807, 5807, 5808, 5806,
+	5808, 5807, 5809, 5809, 5810, 5808, 5809, 5811, 5812, 5812, 5810, 5809, 5813, 5812, 5811, 5811, 5814, 5813, 5815, 5813, 5816, 5816, 5813, 5814,
+	5817, 5815, 5818, 5816, 5819, 5815, 5818, 5815, 5819, 5820, 5817, 5821, 5818, 5821, 5817, 5822, 5820, 5823, 5821, 5824, 5820, 5820, 5824, 5823,
+	5822, 5825, 5826, 5826, 5827, 5822, 5823, 5828, 5822, 5822, 5828, 5829, 5822, 5829, 5825, 5827, 5826, 5830, 5830, 5831, 5827, 5831, 5830, 5832,
+	5832, 5833, 5831, 5834, 5833, 5832, 5832, 5835, 5834, 5801, 5834, 5835, 5835, 5802, 5801, 5836, 5837, 5838, 5838, 5839, 5836, 5840, 5836, 5839,
+	5837, 5841, 5842, 5842, 5838, 5837, 5841, 5843, 5844, 5844, 5842, 5841, 5843, 5845, 5846, 5846, 5844, 5843, 5845, 5847, 5848, 5848, 5846, 5845,
+	5839, 5849, 5840, 5850, 5840, 5849, 5849, 5851, 5850, 5852, 5850, 5851, 5851, 5853, 5852, 5854, 5855, 5856, 5856, 5857, 5854, 5858, 5854, 5857,
+	5857, 5859, 5858, 5860, 5861, 5862, 5862, 5863, 5860, 5860, 5863, 5864, 5862, 5861, 5865, 5866, 5867, 5862, 5862, 5865, 5866, 5868, 5862, 5867,
+	5863, 5862, 5868, 5863, 5869, 5870, 5870, 5864, 5863, 5868, 5871, 5863, 5869, 5863, 5871, 5867, 5872, 5868, 5873, 5874, 5868, 5868, 5872, 5873,
+	5868, 5875, 5876, 5876, 5871, 5868, 5868, 5874, 5875, 5867, 5866, 5877, 5877, 5878, 5867, 5872, 5867, 5878, 5872, 5879, 5880, 5880, 5873, 5872,
+	5878, 5879, 5872, 5878, 5877, 5881, 5881, 5882, 5878, 5879, 5878, 5882, 5880, 5879, 5883, 5882, 5883, 5879, 5884, 5885, 5880, 5886, 5884, 5880,
+	5880, 5887, 5886, 5883, 5887, 5880, 5873, 5880, 5885, 5883, 5882, 5888, 5888, 5887, 5883, 5882, 5881, 5889, 5889, 5888, 5882, 5890, 5891, 5888,
+	5888, 5889, 5890, 5887, 5888, 5891, 5886, 5887, 5891, 5891, 5890, 5886, 5885, 5892, 5873, 5873, 5892, 5893, 5873, 5893, 5894, 5894, 5874, 5873,
+	5874, 5894, 5895, 5896, 5875, 5874, 5874, 5895, 5896, 5896, 5897, 5875, 5876, 5875, 5897, 5897, 5898, 5876, 5899, 5876, 5900, 5901, 5871, 5876,
+	5876, 5899, 5901, 5898, 5902, 5876, 5902, 5900, 5876, 5900, 5903, 5899, 5904, 5899, 5905, 5906, 5899, 5904, 5899, 5906, 5907, 5901, 5899, 5907,
+	5903, 5905, 5899, 5907, 5869, 5901, 5871, 5901, 5869, 5907, 5908, 5870, 5870, 5869, 5907, 5908, 5907, 5906, 5906, 5909, 5908, 5904, 5910, 5906,
+	5911, 5909, 5906, 5906, 5910, 5911, 5910, 5904, 5912, 5905, 5912, 5904, 5913, 5911, 5910, 5912, 5913, 5910, 5914, 5915, 5916, 5917, 5918, 5914,
+	5914, 5916, 5917, 5915, 5919, 5916, 5920, 5916, 5546, 5916, 5920, 5921, 5921, 5917, 5916, 5549, 5546, 5916, 5916, 5919, 5549, 5922, 5917, 5923,
+	5923, 5917, 5921, 5917, 5922, 5918, 5921, 5920, 5924, 5924, 5925, 5921, 5921, 5925, 5926, 5926, 5927, 5921, 5921, 5927, 5923, 5546, 5540, 5920,
+	5920, 5540, 5537, 5537, 5924, 5920, 5924, 5537, 5536, 5536, 5928, 5924, 5925, 5924, 5928, 5929, 5926, 5925, 5925, 5930, 5929, 5925, 5931, 5930,
+	5928, 5931, 5925, 5929, 5932, 5926, 5926, 5932, 5933, 5933, 5934, 5926, 5927, 5926, 5934, 5923, 5927, 5935, 5934, 5935, 5927, 5936, 5934, 5933,
+	5935, 5934, 5936, 5933, 5937, 5936, 5938, 5936, 5937, 5939, 5936, 5938, 5936, 5939, 5935, 5935, 5939, 5923, 5940, 5939, 5941, 5941, 5939, 5938,
+	5939, 5940, 5942, 5923, 5939, 5942, 5937, 5943, 5938, 5938, 5944, 5941, 5945, 5944, 5938, 5938, 5943, 5945, 5946, 5941, 5944, 5941, 5947, 5940,
+	5941, 5946, 5947, 5948, 5944, 5945, 5944, 5948, 5946, 5942, 5949, 5923, 5950, 5923, 5949, 5951, 5923, 5950, 5923, 5951, 5922, 5952, 5953, 5954,
+	5954, 5955, 5952, 5953, 5956, 5957, 5957, 5954, 5953, 5957, 5956, 5958, 5958, 5959, 5957, 5959, 5958, 5960, 5960, 5961, 5959, 5962, 5961, 5960,
+	5960, 5963, 5962, 5964, 5965, 5962, 5962, 5963, 5964, 5964, 5966, 5967, 5967, 5965, 5964, 5966, 5968, 5969, 5969, 5967, 5966, 5969, 5968, 5970,
+	5970, 5971, 5969, 5972, 5971, 5970, 5970, 5973, 5972, 5974, 5975, 5972, 5972, 5973, 5974, 5975, 5974, 5976, 5976, 5977, 5975, 5976, 5978, 5979,
+	5979, 5977, 5976, 5979, 5978, 5980, 5980, 5981, 5979, 5980, 5982, 5983, 5983, 5981, 5980, 5982, 5984, 5985, 5985, 5983, 5982, 5985, 5984, 5986,
+	5986, 5987, 5985, 5987, 5986, 5988, 5988, 5989, 5987, 5990, 5991, 5992, 5992, 5993, 5990, 5994, 5990, 5993, 5992, 5991, 5995, 5996, 5997, 5992,
+	5992, 5995, 5996, 5997, 5996, 5998, 5999, 5997, 5998, 5998, 6000, 5999, 5999, 6000, 6001, 5993, 5999, 6001, 6001, 5994, 5993, 6002, 6003, 6004,
+	6004, 6005, 6002, 6006, 6003, 6002, 6002, 6007, 6006, 6002, 6008, 6009, 6009, 6007, 6002, 6010, 6008, 6002, 6002, 6005, 6010, 6011, 6006, 6007,
+	6007, 6012, 6011, 6007, 6009, 6013, 6013, 6012, 6007, 6011, 6012, 6014, 6014, 6015, 6011, 6012, 6013, 6016, 6016, 6014, 6012, 6015, 6014, 6017,
+	6017, 6014, 6018, 6018, 6014, 6016, 6016, 6019, 6018, 6018, 6020, 6017, 6020, 6018, 6021, 6021, 6018, 6019, 6019, 6022, 6021, 6021, 6023, 6020,
+	6023, 6021, 6024, 6024, 6021, 6022, 6022, 6025, 6024, 6024, 6026, 6023, 6026, 6024, 6027, 6027, 6024, 6025, 6025, 6028, 6027, 6027, 6029, 6026,
+	6029, 6027, 6030, 6030, 6027, 6028, 6028, 6031, 6030, 6030, 6032, 6029, 6032, 6030, 6033, 6033, 6030, 6031, 6031, 6034, 6033, 6033, 6035, 6032,
+	6036, 6035, 6033, 6033, 6037, 6036, 6033, 6034, 6038, 6038, 6037, 6033, 6036, 6037, 6039, 6039, 6040, 6036, 6039, 6037, 6038, 6038, 6041, 6039,
+	6040, 6039, 6042, 6042, 6039, 6041, 6042, 6043, 6040, 6041, 6044, 6042, 6045, 6046, 6047, 6047, 6048, 6045, 6049, 6048, 6047, 6047, 6050, 6049,
+	6049, 6050, 6051, 6051, 6052, 6049, 6052, 6051, 6053, 6053, 6054, 6052, 6055, 6054, 6053, 6053, 6056, 6055, 6057, 6055, 6056, 6056, 6058, 6057,
+	6059, 6060, 6057, 6057, 6058, 6059, 6059, 6061, 6062, 6062, 6060, 6059, 6063, 6064, 6065, 6065, 65, 6063, 67, 6063, 65, 6065, 6064, 6066,
+	6066, 6067, 6065, 6067, 6066, 6068, 6068, 6069, 6067, 6069, 6068, 6070, 6070, 6071, 6069, 6071, 6070, 6072, 6072, 6073, 6071, 6074, 6073, 6072,
+	6072, 6075, 6074, 6076, 6074, 6075, 6075, 6077, 6076, 6078, 6076, 6077, 6077, 6079, 6078, 6080, 6078, 6079, 6079, 6081, 6080, 6082, 6083, 6080,
+	6080, 6081, 6082, 6083, 6082, 6084, 6084, 6085, 6083, 6085, 6084, 6086, 6086, 6087, 6085, 6088, 6089, 6090, 6090, 6091, 6088, 6092, 6093, 6094,
+	6094, 6095, 6092, 6096, 6097, 6098, 6099, 6100, 6096, 6096, 6098, 6099, 6100, 6099, 6101, 6102, 6103, 6104, 6104, 6105, 6102, 6106, 6102, 6105,
+	6104, 6103, 6107, 6107, 6108, 6104, 6105, 6109, 6106, 6110, 6111, 6112, 6112, 6113, 6110, 6111, 6110, 6114, 6114, 6115, 6111, 6116, 6115, 6114,
+	6114, 6117, 6116, 6118, 6116, 6117, 6117, 6119, 6118, 6120, 6121, 6118, 6118, 6119, 6120, 6121, 6120, 6122, 6122, 6123, 6121, 6122, 6124, 6125,
+	6125, 6123, 6122, 6126, 6125, 6124, 6124, 6127, 6126, 20, 23, 26, 19, 17, 20, 26, 19, 20, 26, 23, 5, 23, 27, 5,
+	5, 6, 26, 6, 41, 26, 6, 5, 7, 7, 8, 6, 41, 6, 8, 41, 8, 43, 8, 7, 9, 9, 10, 8,
+	27, 32, 7, 34, 7, 32, 10, 9, 11, 14, 10, 11, 1018, 14, 1097, 1097, 14, 1017, 14, 1027, 1017, 47, 1094, 1018,
+	1092, 1021, 1018, 1018, 1094, 1092, 1091, 1092, 1094, 1096, 1091, 1094, 1094, 1097, 1096, 1100, 1096, 1097, 1090, 1091, 1087, 1091, 1090, 1092,
+	1087, 1086, 1090, 1083, 1087, 4692, 1087, 1083, 1086, 1083, 4692, 489, 489, 17, 1083, 4692, 4688, 4691, 4691, 4695, 4692, 4692, 4695, 489,
+	489, 4533, 1253, 489, 4639, 4533, 1255, 1253, 4533, 4639, 4535, 4533, 4657, 1255, 4533, 4535, 4657, 4533, 1255, 1260, 1257, 1259, 1257, 1260,
+	1260, 1264, 1259, 987, 990, 1259, 1263, 1259, 1264, 1265, 1263, 1264, 1265, 1264, 1267, 985, 1265, 36, 987, 1265, 985, 1267, 1268, 1265,
+	1268, 1267, 1271, 1268, 980, 983, 980, 1268, 981, 979, 980, 981, 6120, 15, 981, 6120, 981, 6110, 6120, 59, 56, 6120, 6044, 4677,
+	6110, 6044, 6120, 62, 6110, 52, 1271, 6043, 6110, 6044, 6043, 6040, 6040, 6033, 6044, 6044, 6033, 4677, 4682, 4672, 4677, 4677, 4680, 4682,
+	6033, 6031, 4677, 6032, 6031, 6033, 6040, 6032, 6033, 6029, 6028, 6031, 6031, 6032, 6029, 6021, 6029, 6023, 6029, 6021, 6028, 6022, 6028, 6021,
+	6023, 6018, 6021, 6021, 6018, 6022, 6018, 6023, 6017, 4700, 6018, 6017, 6018, 4700, 6016, 6016, 6022, 6018, 4683, 4682, 4680, 4683, 4688, 4682,
+	4683, 4691, 4688, 36, 983, 985, 4657, 4535, 4658, 4662, 4657, 4658, 4661, 4662, 4658, 4662, 4661, 4668, 4668, 4666, 4662, 4670, 4666, 4668,
+	4670, 4668, 4669, 1822, 68, 1820, 1820, 68, 2947, 68, 6063, 6071, 1820, 1924, 1822, 1924, 1923, 1822, 1923, 1922, 1822, 3821, 1822, 1922,
+	1924, 1820, 1925, 101, 1923, 1924, 1924, 1925, 101, 93, 1922, 1923, 93, 1923, 101, 3821, 1922, 1921, 1921, 1922, 106, 1922, 93, 106,
+	1921, 88, 3821, 6073, 3821, 88, 3821, 3828, 2941, 124, 88, 1921, 1921, 106, 124, 98, 106, 93, 106, 98, 107, 107, 117, 106,
+	117, 124, 106, 117, 118, 124, 126, 124, 118, 124, 126, 139, 139, 1919, 124, 117, 107, 115, 118, 117, 115, 107, 98, 105,
+	105, 92, 107, 115, 107, 92, 98, 93, 96, 96, 105, 98, 105, 96, 109, 92, 105, 109, 131, 92, 109, 96, 103, 109,
+	109, 112, 110, 109, 103, 112, 109, 110, 131, 96, 93, 102, 103, 96, 102, 101, 102, 93, 102, 113, 103, 102, 101, 1738,
+	1738, 5964, 102, 5966, 1742, 102, 102, 5964, 5966, 112, 103, 113, 113, 114, 112, 5966, 1606, 1742, 5971, 5966, 5970, 179, 1606, 177,
+	194, 1606, 197, 1602, 1606, 1601, 177, 176, 179, 174, 176, 177, 145, 1601, 1598, 145, 1602, 1601, 135, 145, 137, 145, 135, 144,
+	137, 145, 147, 144, 159, 145, 1598, 147, 145, 147, 1598, 5982, 147, 140, 137, 148, 140, 147, 147, 149, 148, 147, 150, 149,
+	5982, 150, 147, 5982, 5984, 156, 156, 150, 5982, 5979, 5976, 5982, 150, 156, 149, 148, 149, 5988, 149, 156, 5988, 1752, 148, 6087,
+	1752, 140, 148, 5988, 6087, 148, 140, 138, 137, 140, 1752, 138, 1757, 138, 1752, 126, 137, 138, 139, 126, 138, 139, 138, 1757,
+	137, 126, 129, 135, 137, 129, 126, 118, 119, 119, 129, 126, 128, 129, 119, 129, 128, 135, 130, 135, 128, 130, 144, 135,
+	119, 120, 128, 130, 128, 120, 115, 119, 118, 120, 119, 115, 120, 131, 130, 131, 134, 130, 160, 144, 130, 134, 160, 130,
+	159, 144, 160, 160, 161, 159, 139, 1757, 3828, 139, 3828, 6073, 2883, 2941, 3828, 6087, 3828, 3831, 6073, 79, 139, 6082, 6087, 6080,
+	6079, 6082, 6080, 6080, 6074, 6079, 2941, 3595, 3597, 2941, 2883, 3588, 3588, 3834, 2941, 3595, 3596, 3597, 2879, 156, 5984, 5975, 5974, 5976,
+	5979, 5975, 5976, 5974, 5975, 5971, 5970, 5974, 5971, 197, 195, 194, 194, 195, 192, 5962, 5960, 5964, 5960, 5962, 5958, 1933, 5956, 5958,
+	5958, 1930, 1933, 101, 1930, 5958, 5958, 1738, 101, 2947, 5956, 1933, 5952, 1933, 1925, 1930, 1925, 1933, 1925, 1930, 101, 1925, 3073, 2947,
+	201, 199, 204, 724, 201, 721, 201, 204, 3312, 3311, 3312, 204, 3308, 3312, 3311, 3311, 3309, 3308, 3306, 3308, 3302, 3309, 3302, 3308,
+	3306, 3302, 3307, 721, 722, 723, 723, 724, 721, 723, 722, 732, 258, 261, 732, 259, 258, 732, 259, 254, 258, 258, 260, 261,
+	261, 260, 266, 266, 267, 261, 266, 268, 269, 269, 267, 266, 269, 268, 271, 271, 244, 269, 244, 271, 241, 241, 242, 244,
+	241, 243, 242, 241, 247, 243, 241, 248, 247, 242, 243, 1362, 1364, 1365, 1362, 1365, 1364, 1366, 1366, 1367, 1365, 1367, 1366, 1371,
+	1371, 1370, 1367, 1371, 1372, 1370, 1371, 1373, 1374, 1374, 1372, 1371, 1373, 1376, 1374, 1376, 1373, 1379, 1379, 1380, 1376, 1384, 1380, 1379,
+	251, 247, 248, 248, 250, 251, 251, 250, 252, 252, 253, 251, 252, 254, 253, 253, 254, 259, 207, 208, 206, 209, 206, 208,
+	210, 207, 206, 206, 211, 210, 208, 237, 209, 236, 209, 237, 237, 232, 236, 231, 236, 232, 229, 231, 232, 232, 233, 229,
+	229, 226, 225, 228, 226, 229, 233, 228, 229, 233, 273, 228, 273, 277, 272, 276, 272, 277, 278, 276, 277, 277, 279, 278,
+	278, 279, 280, 280, 281, 278, 282, 281, 280, 280, 283, 282, 284, 282, 283, 283, 285, 284, 284, 285, 286, 286, 288, 284,
+	293, 288, 286, 212, 293, 210, 293, 212, 215, 210, 211, 212, 215, 212, 219, 221, 215, 219, 221, 219, 220, 223, 221, 220,
+	220, 222, 223, 223, 222, 225, 225, 226, 223, 298, 295, 296, 295, 313, 296, 296, 303, 298, 298, 303, 306, 303, 296, 308,
+	302, 308, 296, 302, 296, 311, 313, 311, 296, 310, 306, 303, 303, 308, 310, 311, 312, 302, 322, 317, 577, 318, 577, 317,
+	321, 317, 322, 323, 324, 317, 317, 321, 323, 317, 324, 318, 577, 574, 322, 607, 609, 577, 331, 322, 574, 574, 344, 331,
+	579, 582, 574, 332, 322, 331, 331, 341, 332, 341, 331, 344, 322, 332, 330, 330, 332, 333, 333, 332, 341, 321, 330, 328,
+	330, 321, 322, 333, 334, 330, 328, 330, 334, 323, 328, 327, 328, 323, 321, 334, 335, 328, 328, 335, 336, 336, 327, 328,
+	318, 324, 327, 327, 528, 318, 324, 323, 327, 336, 338, 327, 327, 338, 528, 5822, 528, 522, 528, 5822, 529, 529, 532, 528,
+	522, 5827, 5822, 5822, 5820, 5823, 522, 519, 5833, 5833, 5831, 522, 5831, 5827, 522, 5833, 519, 517, 517, 516, 5833, 5833, 5835, 5834,
+	516, 517, 515, 515, 514, 516, 514, 515, 513, 513, 5800, 514, 5800, 513, 511, 511, 5804, 5800, 5800, 5834, 5835, 5835, 5802, 5800,
+	5804, 511, 509, 509, 5806, 5804, 5806, 509, 507, 507, 5808, 5806, 507, 502, 5812, 5812, 5810, 507, 507, 5810, 5808, 502, 499, 5813,
+	5813, 5812, 502, 492, 499, 493, 499, 492, 5813, 5813, 5818, 5815, 5817, 5815, 5818, 5818, 5824, 5817, 5820, 5817, 5824, 5820, 5824, 5823,
+	492, 493, 494, 494, 531, 492, 494, 532, 531, 532, 529, 531, 579, 583, 582, 583, 587, 582, 582, 587, 588, 588, 589, 582,
+	589, 588, 590, 590, 591, 589, 591, 590, 592, 592, 593, 591, 593, 592, 594, 594, 595, 593, 595, 594, 596, 596, 597, 595,
+	597, 596, 598, 598, 600, 597, 598, 603, 600, 600, 603, 606, 607, 606, 609, 611, 346, 353, 346, 611, 349, 353, 346, 350,
+	351, 350, 346, 346, 352, 351, 349, 352, 346, 353, 610, 611, 616, 611, 615, 610, 353, 356, 353, 350, 358, 358, 359, 353,
+	356, 353, 359, 350, 351, 360, 360, 358, 350, 361, 351, 352, 361, 360, 351, 361, 352, 349, 349, 542, 361, 360, 361, 366,
+	366, 361, 364, 361, 542, 364, 367, 358, 360, 360, 368, 367, 366, 368, 360, 369, 359, 358, 358, 367, 369, 371, 359, 369,
+	359, 371, 356, 356, 357, 610, 357, 356, 371, 610, 642, 645, 642, 635, 636, 636, 638, 642, 642, 638, 641, 642, 641, 645,
+	635, 633, 634, 634, 636, 635, 633, 631, 632, 632, 634, 633, 631, 629, 630, 630, 632, 631, 629, 627, 628, 628, 630, 629,
+	627, 624, 625, 625, 628, 627, 619, 622, 624, 624, 622, 625, 616, 615, 619, 542, 539, 541, 541, 5775, 542, 547, 542, 5775,
+	538, 539, 535, 538, 541, 539, 533, 538, 535, 535, 536, 533, 5788, 533, 572, 536, 572, 533, 568, 5791, 5788, 5788, 572, 568,
+	5785, 5784, 5788, 5791, 568, 563, 563, 5793, 5791, 563, 561, 5796, 5796, 5795, 563, 5795, 5793, 563, 561, 559, 5798, 5798, 5796, 561,
+	559, 557, 5765, 5765, 5798, 559, 557, 555, 556, 556, 5765, 557, 5765, 5763, 5767, 5767, 5768, 5765, 5768, 5767, 5770, 547, 5772, 5770,
+	5770, 552, 547, 553, 552, 5770, 5770, 554, 553, 5775, 5773, 547, 547, 5773, 5772, 5778, 5779, 5775, 5779, 5778, 5781, 5781, 5783, 5779,
+	5783, 5781, 5784, 5784, 5785, 5783, 555, 553, 554, 554, 556, 555, 5584, 1415, 388, 388, 1415, 1420, 1420, 1428, 388, 5584, 5581, 1415,
+	1421, 1415, 5581, 1420, 1415, 1421, 1421, 1426, 1420, 1420, 1426, 1431, 746, 1428, 1420, 1420, 1430, 746, 1431, 1430, 1420, 750, 1428, 746,
+	1428, 750, 2556, 2556, 2557, 1428, 752, 750, 746, 746, 1436, 752, 1430, 1431, 746, 746, 1431, 1436, 1431, 1435, 1436, 752, 1436, 1439,
+	1436, 1435, 1438, 1438, 1439, 1436, 1439, 757, 752, 757, 1439, 756, 1439, 1438, 1441, 1441, 1442, 1439, 757, 756, 758, 758, 759, 757,
+	759, 758, 760, 760, 761, 759, 761, 760, 762, 762, 763, 761, 763, 762, 1500, 1500, 765, 763, 765, 1500, 1498, 1500, 1501, 1498,
+	1501, 1500, 1503, 1498, 767, 765, 767, 1498, 769, 1498, 1497, 1493, 1493, 1495, 1498, 1497, 1498, 1501, 1501, 1454, 1502, 1503, 1454, 1501,
+	1454, 1503, 405, 1457, 1454, 1443, 405, 1443, 1454, 1457, 1502, 1454, 405, 408, 407, 1443, 405, 404, 1442, 1441, 1443, 1441, 5169, 1443,
+	1443, 404, 1442, 1443, 1448, 1447, 1448, 1443, 5169, 1443, 1447, 1457, 1457, 1447, 1451, 1457, 1451, 5199, 1447, 1448, 1451, 5169, 5165, 1448,
+	1451, 1448, 5165, 5169, 5170, 5171, 5171, 5170, 5172, 5172, 5173, 5171, 5173, 5172, 5174, 5174, 5175, 5173, 5175, 5174, 5176, 5176, 5179, 5175,
+	5179, 5176, 5180, 5180, 5181, 5179, 5181, 5180, 5182, 5182, 5183, 5181, 5182, 5187, 5183, 5187, 5182, 5186, 5187, 5186, 5188, 5188, 5189, 5187,
+	5188, 5190, 5191, 5191, 5189, 5188, 5191, 5190, 5167, 5167, 5166, 5191, 5166, 5167, 5165, 5165, 1461, 1451, 1460, 1451, 1461, 1461, 1465, 1460,
+	1451, 5592, 1459, 1451, 1460, 5592, 1478, 5199, 1451, 1451, 1459, 1478, 5592, 1460, 5590, 5590, 1460, 1467, 1467, 1460, 1465, 5592, 5594, 1459,
+	1459, 5594, 5596, 5596, 5597, 1459, 1459, 5597, 1472, 1472, 1478, 1459, 1472, 5597, 1475, 1475, 5597, 5599, 1475, 5599, 1476, 1476, 5599, 1479,
+	1479, 5599, 5601, 1479, 1481, 1476, 1482, 1481, 1479, 1479, 1483, 1482, 1479, 422, 1486, 1486, 1483, 1479, 5601, 422, 1479, 1482, 1483, 1487,
+	1493, 1482, 1487, 1487, 1483, 1486, 1486, 775, 771, 771, 1492, 1486, 775, 1486, 776, 1486, 1492, 1487, 1487, 1492, 1493, 1492, 1495, 1493,
+	769, 1492, 771, 413, 769, 412, 769, 413, 415, 776, 777, 775, 777, 776, 781, 1467, 5587, 5590, 5587, 1467, 1424, 1424, 5586, 5587,
+	5586, 1424, 5581, 1424, 1421, 5581, 5195, 5194, 5199, 5200, 5201, 5199, 5194, 5195, 5192, 5192, 5193, 5194, 5192, 5196, 5197, 5197, 5193, 5192,
+	5197, 5196, 5219, 5219, 5218, 5197, 5218, 5219, 5217, 5217, 5216, 5218, 5216, 5217, 5213, 5213, 5210, 5216, 5210, 5213, 5211, 5209, 5208, 5210,
+	5210, 5211, 5209, 5206, 5209, 5205, 5209, 5206, 5208, 5205, 5204, 5206, 5204, 5205, 5202, 5202, 5203, 5204, 5202, 5201, 5200, 5200, 5203, 5202,
+	402, 401, 404, 399, 401, 402, 407, 408, 409, 2556, 2562, 2557, 2562, 2556, 2795, 2795, 1775, 2797, 2797, 2798, 2795, 1775, 1769, 1774,
+	1774, 1773, 1775, 1774, 1769, 1770, 1770, 1778, 1774, 1772, 1773, 1774, 1778, 1770, 1776, 1776, 1779, 1778, 2799, 2800, 1772, 1772, 2802, 2799,
+	428, 454, 450, 454, 428, 459, 446, 459, 428, 446, 428, 450, 450, 454, 452, 454, 459, 456, 459, 458, 456, 459, 446, 447,
+	1710, 1544, 462, 462, 463, 1710, 1710, 1701, 1713, 1701, 1710, 1703, 1710, 1712, 1711, 1713, 1712, 1710, 1699, 1701, 4930, 1703, 4930, 1701,
+	1713, 1701, 1708, 1699, 1708, 1701, 1713, 1708, 1716, 1712, 1713, 1716, 1712, 1719, 1711, 1719, 1712, 1725, 1716, 1725, 1712, 1722, 1716, 1708,
+	1725, 1716, 1722, 1708, 1699, 1722, 1698, 1699, 1696, 4930, 1696, 1699, 4925, 4928, 4930, 4925, 4930, 4931, 4931, 4930, 4934, 4923, 4921, 4925,
+	4921, 4928, 4925, 4925, 4931, 4923, 4927, 4928, 4921, 4915, 4920, 4921, 4914, 4915, 4921, 4921, 4923, 4914, 4921, 4926, 4927, 4926, 4921, 4920,
+	4923, 4924, 4914, 4924, 4923, 4931, 4931, 4932, 4924, 4934, 4935, 4931, 4932, 4931, 4935, 4934, 4936, 4938, 4935, 4934, 4938, 4938, 4942, 4935,
+	4942, 4940, 4935, 4935, 4940, 4932, 4933, 4924, 4932, 4940, 4950, 4932, 4950, 4952, 4932, 4932, 4952, 4933, 4917, 4914, 4924, 4924, 4933, 4917,
+	4953, 4933, 4952, 4917, 4933, 4953, 4918, 4914, 4917, 4953, 4955, 4917, 4917, 4955, 4918, 4955, 4956, 4918, 4914, 4919, 4915, 4915, 5615, 5466,
+	5465, 5466, 5467, 5467, 5468, 5465, 5465, 5468, 5469, 5469, 5472, 5465, 4940, 4945, 4950, 4940, 4942, 4945, 4942, 4946, 4945, 4946, 4947, 4945,
+	4938, 483, 4942, 787, 4938, 692, 784, 788, 787, 1032, 787, 1034, 692, 1060, 787, 692, 693, 694, 694, 695, 692, 693, 697, 694,
+	697, 693, 699, 699, 693, 700, 698, 694, 697, 697, 699, 710, 698, 697, 710, 700, 709, 699, 699, 709, 710, 700, 715, 709,
+	709, 715, 711, 715, 720, 711, 1349, 788, 1354, 1349, 1350, 1351, 1351, 1352, 1349, 1351, 1357, 1358, 1358, 1352, 1351, 785, 814, 784,
+	1203, 1204, 784, 1205, 784, 1204, 812, 814, 810, 812, 810, 481, 481, 810, 1144, 792, 1144, 810, 481, 485, 484, 1204, 481, 1205,
+	792, 793, 1144, 793, 795, 794, 5443, 4926, 5445, 5443, 4927, 4926, 5445, 5446, 5443, 5447, 5443, 5446, 5447, 4927, 5443, 5445, 5448, 5446,
+	5445, 5665, 5448, 5665, 5445, 5666, 5449, 5446, 5450, 5446, 5449, 5447, 5450, 5446, 5448, 5448, 1555, 5450, 5450, 1550, 5449, 1549, 1547, 1550,
+	1550, 1556, 1549, 1549, 1548, 1547, 1549, 1551, 1548, 1551, 1549, 1556, 1548, 833, 1547, 833, 1548, 806, 1551, 1552, 1548, 4439, 1548, 1552,
+	1556, 1555, 1551, 1552, 4286, 4439, 4441, 4286, 1552, 1552, 3245, 4441, 4284, 4439, 4286, 3272, 4286, 3197, 4286, 4287, 4284, 4286, 3272, 4287,
+	3264, 3272, 3271, 3264, 3266, 3263, 4134, 4287, 3938, 4136, 3938, 4287, 4287, 4138, 4136, 3938, 3939, 4134, 4843, 3935, 3938, 3939, 3938, 3935,
+	3938, 3941, 4843, 2547, 2548, 4843, 3983, 3935, 4843, 4843, 3985, 3983, 4843, 4845, 4842, 3980, 3935, 3983, 806, 744, 833, 806, 801, 796,
+	796, 831, 806, 797, 831, 796, 1281, 797, 1280, 5665, 5666, 5667, 1696, 1697, 1698, 647, 646, 663, 663, 646, 665, 666, 654, 647,
+	647, 663, 666, 663, 655, 656, 666, 663, 656, 665, 664, 663, 658, 654, 666, 666, 659, 660, 656, 659, 666, 660, 668, 666,
+	678, 669, 671, 688, 669, 678, 689, 678, 671, 679, 678, 689, 686, 687, 678, 678, 687, 688, 671, 677, 689, 689, 677, 680,
+	682, 683, 689, 689, 683, 679, 689, 690, 682, 733, 738, 736, 738, 733, 737, 738, 737, 739, 739, 740, 738, 739, 741, 742,
+	742, 740, 739, 816, 818, 815, 819, 1009, 816, 816, 1009, 1004, 1214, 816, 1004, 1004, 1003, 1214, 1003, 1004, 1006, 1006, 824, 1003,
+	1028, 1003, 1001, 1010, 1011, 1006, 1296, 824, 1006, 1006, 1011, 1296, 825, 1246, 824, 828, 824, 1001, 1001, 1031, 1028, 1240, 1246, 840,
+	1244, 1246, 1243, 1011, 838, 1240, 1240, 840, 1011, 1220, 1240, 994, 1571, 838, 1574, 994, 995, 844, 844, 1218, 994, 994, 1218, 1220,
+	844, 2290, 842, 842, 2290, 847, 2289, 2290, 2292, 2292, 2290, 2294, 1810, 847, 1809, 1809, 1807, 1808, 2294, 2296, 2292, 2303, 2296, 2294,
+	2294, 2305, 2303, 2292, 2293, 2289, 2293, 2292, 2295, 2295, 2292, 2296, 2296, 2298, 2295, 2296, 2303, 2304, 2304, 2298, 2296, 2306, 2307, 2303,
+	2303, 2305, 2306, 2303, 2307, 2304, 3942, 2305, 3944, 3946, 2305, 3942, 3789, 3840, 3942, 3789, 3942, 3944, 3942, 3947, 3946, 3944, 3793, 3789,
+	3789, 3885, 2697, 3882, 3884, 3885, 5561, 3885, 5362, 3882, 3886, 3970, 3970, 3973, 3882, 3972, 3882, 3973, 5360, 5362, 5354, 5362, 5363, 5354,
+	5360, 5368, 5362, 5362, 5368, 5369, 5369, 5372, 5362, 5362, 5372, 5380, 5389, 5363, 5362, 5362, 5387, 5389, 5362, 5560, 5561, 5360, 5347, 5352,
+	5347, 5360, 5346, 5346, 5360, 5354, 5346, 5339, 5347, 5347, 5339, 5341, 5347, 5341, 5366, 5351, 5352, 5347, 5351, 5347, 5366, 5364, 5352, 5351,
+	1244, 5364, 5351, 5341, 5334, 5336, 5334, 5341, 5339, 5339, 5346, 5345, 5354, 5355, 5346, 5355, 5357, 5346, 5345, 5346, 5357, 5359, 5355, 5354,
+	5354, 5363, 5359, 5358, 5357, 5355, 5355, 5359, 5358, 5358, 5397, 5357, 5389, 5394, 5358, 5358, 5359, 5389, 5397, 5358, 5394, 5359, 5363, 5389,
+	5389, 5393, 5392, 5392, 5394, 5389, 5394, 5392, 5397, 5393, 5395, 5392, 5334, 5335, 5336, 5560, 5372, 5383, 5560, 5383, 5384, 5372, 5369, 5377,
+	5383, 5372, 5377, 5369, 5373, 5377, 2299, 2312, 5377, 2299, 5377, 2316, 2314, 5377, 2312, 2295, 2298, 2299, 2299, 2300, 2295, 2299, 2298, 2304,
+	2310, 2299, 2304, 2312, 2299, 2310, 2316, 2300, 2299, 2312, 2310, 2314, 2310, 2304, 2314, 2314, 2304, 2307, 2302, 2295, 2300, 2300, 2318, 2302,
+	2295, 2302, 1898, 1896, 2295, 1898, 2302, 1900, 1893, 1893, 1898, 2302, 1898, 1893, 1889, 1889, 1896, 1898, 1899, 1889, 1893, 1900, 1899, 1893,
+	1900, 5107, 1907, 1907, 1899, 1900, 1892, 1889, 1899, 1903, 1892, 1899, 1899, 1904, 1903, 1904, 1899, 1907, 1889, 1892, 1891, 1902, 1891, 1892,
+	1892, 1903, 1902, 1903, 1904, 1911, 1913, 1911, 1904, 1907, 1913, 1904, 5109, 5110, 5107, 851, 852, 848, 848, 849, 851, 852, 851, 853,
+	853, 854, 852, 853, 855, 854, 858, 854, 855, 855, 857, 858, 861, 858, 857, 865, 864, 862, 862, 866, 865, 867, 865, 866,
+	866, 868, 867, 868, 870, 867, 870, 868, 871, 871, 872, 870, 872, 871, 875, 876, 877, 878, 878, 879, 876, 882, 883, 880,
+	885, 883, 882, 882, 886, 885, 885, 886, 888, 2138, 2140, 892, 892, 4619, 2138, 2137, 2138, 2136, 2138, 2137, 2139, 2139, 2140, 2138,
+	4615, 2136, 2138, 2138, 4619, 4615, 4615, 4619, 4617, 4620, 4617, 4619, 4622, 4620, 4619, 2134, 2136, 4615, 4615, 3278, 2134, 4615, 4613, 4611,
+	4617, 4613, 4615, 2135, 2136, 2134, 2136, 2135, 2137, 2129, 2133, 2134, 2134, 2130, 2129, 2134, 2133, 2135, 2134, 3278, 3273, 3273, 2130, 2134,
+	2268, 2135, 2264, 2271, 2135, 2268, 2264, 2479, 2268, 2268, 2270, 2271, 2483, 2268, 2479, 2270, 2268, 2483, 2264, 2261, 2260, 2260, 2479, 2264,
+	2479, 2260, 2475, 2475, 2618, 2479, 2479, 2618, 2483, 2483, 2485, 2270, 2270, 2488, 2139, 2139, 2271, 2270, 2488, 2270, 2485, 2485, 2624, 2488,
+	2622, 2624, 2621, 2622, 3001, 2624, 2620, 2622, 2621, 3001, 2622, 2626, 2621, 2619, 2620, 2617, 2620, 2619, 2619, 2618, 2617, 2617, 2618, 2614,
+	2614, 2613, 2617, 2613, 2614, 2609, 2609, 2612, 2613, 2477, 2609, 2475, 2609, 2477, 2481, 2481, 2610, 2609, 2609, 2610, 2611, 2611, 2612, 2609,
+	2262, 2477, 2260, 2477, 2262, 2266, 2266, 2481, 2477, 2475, 2260, 2477, 2260, 2261, 2262, 2266, 2128, 2131, 2131, 2141, 2266, 2128, 2129, 2130,
+	2130, 2131, 2128, 3273, 4605, 2131, 2131, 2130, 3273, 2131, 4605, 4600, 4600, 4024, 2131, 4600, 4605, 4604, 4604, 4605, 4608, 4067, 4600, 4066,
+	4600, 4602, 4599, 4604, 4602, 4600, 4604, 4606, 4602, 4606, 4604, 4608, 4608, 4610, 4606, 4611, 4613, 4608, 4613, 4610, 4608, 4602, 4603, 4599,
+	4603, 4602, 4607, 4071, 4067, 4070, 4067, 5311, 5307, 4070, 4072, 4071, 4070, 4076, 4072, 4079, 4076, 4070, 4079, 4070, 4080, 4080, 4555, 4079,
+	4559, 4555, 4557, 4033, 4559, 4029, 4559, 4033, 4035, 4035, 4800, 4559, 4029, 4028, 4033, 3910, 4028, 4029, 4029, 4023, 3910, 3921, 4028, 3910,
+	3910, 4020, 3912, 3910, 3916, 3913, 3916, 3910, 3912, 3910, 3913, 3921, 4020, 3910, 4023, 4023, 4024, 4020, 4019, 4018, 4020, 4020, 4021, 4019,
+	4025, 4020, 4024, 4021, 4020, 4025, 4018, 4019, 3977, 3979, 4018, 3977, 3977, 5524, 3979, 5524, 5139, 5516, 5516, 5522, 5524, 5137, 5142, 5139,
+	5139, 5140, 5137, 5520, 5516, 5139, 5516, 5520, 5522, 5142, 5137, 5141, 5142, 5141, 5681, 5681, 5146, 5142, 5681, 5678, 5146, 5721, 5678, 5681,
+	5681, 5684, 5721, 5684, 5681, 5683, 5148, 5146, 5678, 5678, 5147, 5148, 5719, 5677, 5678, 5678, 5721, 5719, 5722, 5721, 5726, 5719, 5715, 5669,
+	5669, 5677, 5719, 5717, 5715, 5710, 4525, 5669, 4527, 5668, 5669, 4999, 1513, 4525, 3106, 4527, 4528, 4525, 5285, 5286, 4525, 4527, 4529, 4528,
+	3009, 4528, 4529, 4529, 4531, 3009, 2896, 2897, 3009, 3008, 2896, 3009, 3011, 3012, 3009, 3012, 3008, 3009, 2897, 3015, 3009, 2899, 2902, 2896,
+	2897, 2896, 2902, 2906, 2899, 2896, 2896, 2904, 2906, 3000, 2896, 3008, 3015, 2897, 3016, 3016, 5270, 3015, 5270, 5268, 5272, 5272, 5268, 5271,
+	3000, 3008, 3001, 2998, 3000, 3001, 3001, 2997, 2998, 3002, 2998, 2997, 2997, 4638, 3002, 4638, 4636, 4637, 3106, 3107, 1513, 1510, 1515, 1513,
+	1515, 1510, 1514, 4998, 4999, 4992, 4993, 4992, 4999, 4999, 5000, 4993, 4999, 5686, 5668, 4991, 4995, 4998, 4992, 4991, 4998, 5686, 4998, 4995,
+	4991, 4992, 4989, 4989, 4992, 4993, 4993, 4994, 4989, 5001, 5003, 4993, 4993, 5000, 5001, 5003, 4994, 4993, 4989, 4995, 4991, 4995, 4624, 5686,
+	5672, 5668, 5686, 5686, 5687, 5672, 4623, 4624, 4620, 4626, 4623, 4620, 4626, 4620, 4622, 5003, 5001, 5004, 5009, 5003, 5004, 5009, 5004, 5684,
+	5684, 5685, 5009, 5684, 5683, 5685, 2611, 2610, 2616, 893, 894, 895, 895, 896, 893, 898, 901, 900, 900, 901, 902, 902, 903, 900,
+	904, 903, 902, 910, 911, 916, 911, 910, 913, 916, 911, 915, 916, 915, 917, 917, 920, 916, 920, 917, 921, 921, 922, 920,
+	923, 922, 921, 921, 924, 923, 925, 923, 924, 924, 926, 925, 927, 925, 926, 926, 928, 927, 927, 928, 931, 931, 932, 927,
+	933, 932, 931, 931, 935, 933, 933, 935, 936, 937, 943, 939, 939, 940, 937, 943, 941, 939, 944, 941, 943, 943, 947, 944,
+	946, 944, 947, 948, 946, 947, 947, 949, 948, 950, 951, 948, 948, 949, 950, 951, 950, 952, 952, 953, 951, 953, 952, 954,
+	954, 955, 953, 958, 955, 954, 954, 959, 958, 960, 962, 958, 958, 959, 960, 960, 963, 962, 967, 968, 969, 969, 970, 967,
+	971, 972, 973, 973, 974, 971, 1039, 1040, 1041, 1041, 1040, 1042, 1042, 1043, 1041, 1043, 1042, 1044, 1044, 1045, 1043, 1044, 1049, 1045,
+	1044, 1048, 1049, 1051, 1049, 1048, 1048, 1052, 1051, 1061, 1062, 1064, 1067, 1068, 1065, 1069, 1073, 1071, 1072, 1071, 1073, 1074, 1072, 1073,
+	1073, 1075, 1074, 1074, 1075, 1077, 1077, 1078, 1074, 1078, 1077, 1079, 1079, 1081, 1078, 1101, 3393, 1103, 1106, 1101, 1103, 3393, 5463, 5464,
+	5464, 5462, 3393, 1109, 3403, 1107, 1109, 1107, 1112, 5454, 5458, 3403, 5458, 5454, 5457, 1113, 1114, 1115, 1115, 1116, 1113, 1114, 1113, 1117,
+	1117, 1118, 1114, 1120, 1118, 1117, 1120, 1121, 1122, 1124, 1122, 1121, 1116, 1115, 1126, 1127, 1128, 1129, 1129, 1130, 1127, 1131, 1127, 1130,
+	1132, 1129, 1128, 1130, 1134, 1131, 1131, 1134, 1135, 1137, 1138, 1135, 1138, 1137, 1139, 1151, 1148, 1150, 1150, 1148, 1152, 1150, 1167, 1151,
+	1167, 1170, 1151, 1152, 1155, 1150, 1155, 1152, 1154, 1155, 1154, 1156, 1156, 1157, 1155, 1157, 1156, 1158, 1162, 1157, 1158, 1164, 1162, 1163,
+	1163, 1165, 1164, 1170, 1167, 1169, 1170, 1169, 1171, 1171, 1172, 1170, 1172, 1171, 1173, 1173, 1174, 1172, 1174, 1173, 1175, 1175, 1178, 1174,
+	1178, 1175, 1177, 1181, 1178, 1177, 1177, 1180, 1181, 1180, 1182, 1181, 1182, 1184, 1181, 1184, 1182, 1185, 1185, 1186, 1184, 1186, 1185, 1187,
+	1187, 1188, 1186, 1187, 1190, 1188, 1187, 1196, 1192, 1192, 1190, 1187, 1194, 1195, 1196, 1195, 1192, 1196, 1198, 1200, 1197, 1207, 1668, 1209,
+	1209, 1210, 1207, 1667, 1668, 1664, 1665, 1667, 1664, 1609, 1664, 1611, 1611, 1664, 1614, 1611, 1612, 1609, 1623, 1609, 1612, 1614, 1615, 1611,
+	1618, 1615, 1614, 1614, 1619, 1618, 1620, 1621, 1618, 1618, 1619, 1620, 1612, 1622, 1623, 1623, 1622, 1625, 1625, 1626, 1623, 1221, 1222, 1224,
+	1222, 1225, 1226, 1226, 1224, 1222, 5836, 5837, 1222, 1222, 1237, 5836, 1225, 1222, 5837, 1225, 1227, 1226, 5837, 5841, 1225, 1227, 1225, 5841,
+	1230, 1226, 1227, 1227, 1231, 1230, 5841, 5843, 1227, 1231, 1227, 5843, 1234, 1230, 1231, 1231, 1233, 1234, 5843, 5845, 1231, 5845, 5847, 1231,
+	1233, 1231, 5852, 1233, 1237, 1234, 1238, 1234, 1237, 1237, 1233, 5850, 5852, 5850, 1233, 5850, 5840, 1237, 5840, 5836, 1237, 1272, 1273, 1274,
+	1274, 1275, 1272, 1276, 1272, 1275, 1275, 1277, 1276, 1302, 1297, 1298, 1306, 1303, 1308, 4041, 1308, 4038, 4038, 4037, 4041, 4037, 4038, 4039,
+	4040, 4037, 4039, 4039, 4043, 4040, 3922, 3923, 4040, 4040, 4044, 4045, 4045, 3922, 4040, 4047, 4044, 4040, 4043, 4047, 4040, 3923, 3922, 3928,
+	3925, 3928, 3922, 3932, 3925, 3922, 3922, 4052, 3932, 3922, 4045, 4051, 4051, 4052, 3922, 4056, 4052, 4051, 4051, 4564, 4056, 4057, 4056, 4564,
+	4564, 4806, 4057, 4561, 4563, 4564, 4095, 4563, 4096, 4086, 4092, 4095, 4096, 4086, 4095, 4086, 4085, 4087, 4087, 4089, 4086, 4089, 4092, 4086,
+	4082, 4571, 4085, 5323, 5333, 4085, 2115, 4044, 4571, 4571, 4576, 2115, 4572, 4573, 4571, 4571, 4573, 4575, 4575, 4576, 4571, 2114, 2115, 2116,
+	2115, 2114, 2281, 2281, 2119, 2115, 3287, 2116, 2115, 2115, 4576, 3287, 4579, 4576, 4575, 4573, 4577, 4575, 4579, 4575, 4577, 4572, 4574, 4573,
+	4574, 4580, 4573, 5134, 4580, 5136, 5129, 5134, 5136, 5129, 5128, 5134, 5129, 5136, 5707, 5136, 5709, 5707, 5129, 5126, 5128, 5738, 5129, 5705,
+	5707, 5705, 5129, 5117, 5128, 5126, 5117, 5116, 5128, 5126, 5125, 5117, 5112, 5116, 5117, 5117, 5113, 5112, 5118, 5113, 5117, 5117, 5125, 5118,
+	5112, 5113, 5114, 5114, 5121, 5112, 5113, 5118, 5119, 5119, 5114, 5113, 5692, 5697, 5118, 5118, 5695, 5692, 5697, 5692, 5696, 5121, 5119, 5697,
+	5697, 4595, 5121, 5697, 5696, 5698, 5119, 5121, 5114, 4594, 4591, 4595, 4591, 4594, 4597, 4590, 4587, 4591, 4590, 4591, 4593, 4593, 4591, 4597,
+	4586, 4590, 2125, 2125, 4590, 4593, 4587, 4590, 4586, 4586, 4584, 4587, 2120, 3292, 4586, 4586, 2123, 2120, 2125, 2123, 4586, 4583, 4584, 4586,
+	2123, 2125, 2124, 2126, 2124, 2125, 2125, 2127, 2126, 4593, 2127, 2125, 2120, 2123, 2122, 2124, 2122, 2123, 2122, 2121, 2120, 2278, 2122, 2283,
+	2283, 2122, 2284, 2120, 2121, 2117, 2116, 2117, 2114, 2117, 2116, 2120, 2120, 2116, 3287, 3287, 3292, 2120, 2284, 2285, 2283, 2285, 2284, 2126,
+	2126, 2501, 2285, 2498, 2283, 2285, 2285, 2500, 2498, 2500, 2285, 2501, 2283, 2493, 2278, 2493, 2283, 2498, 2278, 2493, 2274, 2274, 2277, 2278,
+	2493, 2600, 2489, 2489, 2274, 2493, 2498, 2600, 2493, 2274, 2491, 2276, 2276, 2277, 2274, 2491, 2274, 2489, 2489, 2591, 2491, 2491, 2496, 2281,
+	2281, 2276, 2491, 2496, 2491, 2591, 2591, 2594, 2496, 2591, 2592, 2593, 2593, 2594, 2591, 2595, 2592, 2591, 2591, 2596, 2595, 2593, 2598, 2594,
+	2599, 2595, 2596, 2596, 2600, 2599, 2599, 2600, 2601, 2601, 2602, 2599, 2602, 2601, 2603, 2603, 2604, 2602, 2603, 2605, 2604, 2604, 2605, 2978,
+	2978, 2608, 2604, 2501, 2605, 2500, 2978, 2979, 2976, 2976, 2977, 2978, 2978, 2985, 2979, 2985, 2884, 2979, 2987, 2884, 2985, 2990, 2987, 2985,
+	2884, 2987, 2886, 2884, 2890, 2887, 2890, 2884, 2886, 2884, 2887, 2895, 2895, 2892, 2884, 2989, 2987, 2990, 2886, 2987, 2993, 2994, 2886, 2993,
+	2993, 5280, 2994, 5282, 5278, 5280, 5282, 5281, 4712, 5282, 4712, 5278, 5695, 4711, 4712, 4712, 4707, 5695, 4710, 5695, 4707, 5737, 5701, 5695,
+	5695, 5732, 5737, 4707, 4709, 4710, 4709, 4714, 4710, 4714, 4709, 5254, 5254, 4716, 4714, 5737, 5738, 5703, 5703, 5701, 5737, 5705, 5703, 5738,
+	5157, 5703, 5705, 5703, 5157, 5159, 5159, 5160, 5703, 5705, 5153, 5154, 5154, 5157, 5705, 5153, 5149, 5154, 5151, 5154, 5149, 5149, 5150, 5151,
+	5151, 5528, 5530, 5528, 5151, 5531, 5528, 5533, 5530, 5531, 5533, 5528, 5728, 5732, 5734, 2977, 2976, 2980, 2980, 4632, 2977, 4633, 4634, 4632,
+	4579, 4584, 4583, 4579, 4581, 4584, 4577, 4581, 4579, 1309, 3340, 1312, 3340, 1309, 1313, 3340, 1313, 2532, 2532, 2534, 3340, 3340, 2534, 2535,
+	2535, 1312, 3340, 1312, 3345, 1347, 3345, 1312, 2535, 2535, 2540, 3344, 2535, 3344, 3345, 1347, 3345, 3344, 1341, 1342, 1347, 2866, 1347, 2865,
+	1347, 2866, 2636, 3344, 3347, 1347, 3347, 3344, 2540, 3347, 2540, 2541, 2865, 2541, 2864, 3046, 3034, 2541, 2541, 5439, 3046, 2865, 2864, 2866,
+	3036, 3034, 3046, 3044, 3036, 3046, 3046, 3045, 3044, 3051, 3046, 5439, 3046, 3051, 3045, 2636, 3034, 3036, 2636, 3031, 3034, 2636, 3028, 1336,
+	3036, 3028, 2636, 1336, 1342, 1341, 2964, 2962, 1336, 1334, 1336, 2962, 2932, 1336, 2931, 2509, 2962, 2964, 2964, 2965, 2509, 2962, 2509, 2511,
+	2511, 1334, 2962, 1334, 2958, 1331, 2958, 1334, 2511, 2511, 2514, 2958, 1329, 1331, 2958, 2515, 1329, 2958, 2958, 2514, 2515, 1329, 2515, 2517,
+	2517, 1327, 1329, 2517, 2519, 1325, 1325, 1327, 2517, 2523, 3332, 2519, 2519, 1321, 1325, 1321, 2519, 3332, 2523, 2527, 3332, 3333, 1321, 3332,
+	1317, 3333, 3332, 3332, 2527, 1317, 3333, 1317, 1321, 2529, 1315, 1317, 1317, 2527, 2529, 2529, 2532, 1313, 1313, 1315, 2529, 1628, 2507, 2509,
+	2507, 3045, 2209, 3045, 3051, 3064, 3045, 3064, 2209, 4256, 2209, 3064, 2209, 5408, 2927, 3051, 4250, 3064, 4274, 3051, 5439, 3325, 4250, 3051,
+	4274, 3325, 3051, 3083, 4250, 4256, 5439, 5441, 4274, 5441, 4272, 4274, 5436, 5431, 5439, 5439, 5438, 5436, 5431, 5436, 5432, 5430, 5429, 5431,
+	5431, 5432, 5430, 5429, 5430, 5428, 5428, 5427, 5429, 5427, 5428, 5426, 5426, 5425, 5427, 5425, 5426, 5423, 5423, 5424, 5425, 5423, 5420, 5419,
+	5419, 5424, 5423, 5419, 5420, 5415, 5415, 5416, 5419, 5415, 5413, 5414, 5414, 5416, 5415, 5413, 5411, 5412, 5412, 5414, 5413, 5411, 5409, 5410,
+	5410, 5412, 5411, 5409, 5407, 5408, 5408, 5410, 5409, 5407, 5406, 5408, 5406, 2927, 5408, 2930, 2929, 2927, 2931, 2929, 2930, 2930, 2932, 2931,
+	1387, 1390, 1389, 1391, 1389, 1390, 1390, 1392, 1391, 1393, 1391, 1392, 1396, 1391, 1393, 1393, 1395, 1396, 1395, 1397, 1396, 1396, 1397, 1398,
+	1398, 1399, 1396, 1398, 1401, 1399, 1404, 1399, 1401, 1401, 1405, 1404, 1404, 1405, 1409, 2092, 1846, 1410, 1846, 1844, 1845, 4007, 1846, 2092,
+	1845, 1844, 1841, 2092, 1845, 1841, 1838, 2095, 1841, 2089, 2092, 1841, 2089, 1841, 2095, 2095, 2096, 2089, 2089, 2093, 2092, 2093, 2089, 2096,
+	2096, 2098, 2093, 2093, 2098, 2099, 2099, 2100, 2093, 2092, 2093, 2100, 2100, 2099, 2104, 2100, 2335, 2092, 2100, 2109, 2335, 2109, 2100, 2106,
+	2108, 2106, 2100, 2100, 2104, 2108, 2335, 2329, 2330, 2336, 2335, 2339, 4013, 4011, 2335, 4013, 2335, 4014, 2330, 4011, 4007, 4007, 2092, 2330,
+	4013, 4007, 4011, 4014, 4015, 4013, 4016, 4008, 4007, 4007, 4017, 4016, 2339, 3075, 2336, 2341, 3075, 2339, 3075, 3077, 3074, 3080, 3074, 3077,
+	3077, 3081, 3080, 2341, 2108, 2345, 2916, 2341, 2920, 2920, 2341, 2922, 2916, 2924, 2911, 2924, 2926, 2925, 2922, 2923, 2920, 1507, 1580, 1508,
+	1518, 1519, 1516, 1522, 1519, 1518, 1524, 1525, 1522, 1526, 1525, 1524, 1524, 1527, 1526, 1528, 1526, 1527, 1530, 1531, 1532, 1532, 1531, 1535,
+	1535, 1538, 1537, 1537, 1538, 1539, 1539, 1540, 1537, 1540, 1539, 1541, 2196, 2194, 1569, 1569, 2373, 2196, 2192, 2196, 2430, 2194, 2196, 2192,
+	2192, 2191, 2194, 2191, 2192, 2188, 2188, 2192, 2193, 2430, 2193, 2192, 2431, 2426, 2430, 2431, 2430, 2434, 2426, 2431, 2427, 2189, 2426, 2427,
+	2427, 2422, 2189, 2183, 2188, 2189, 2189, 2186, 2183, 2193, 2189, 2188, 2422, 2186, 2189, 2188, 2183, 2182, 2182, 2190, 2188, 2188, 2190, 2191,
+	2179, 2182, 2183, 2183, 2181, 2179, 2181, 2183, 2186, 2186, 2199, 2181, 2416, 2186, 2420, 2422, 2420, 2186, 2184, 2178, 2181, 2179, 2181, 2178,
+	2184, 2181, 2199, 2413, 2184, 2412, 2412, 2184, 2416, 2416, 3194, 2412, 2420, 3194, 2416, 2413, 2412, 2410, 2410, 2178, 2413, 3189, 3188, 3194,
+	3189, 3190, 3188, 3190, 3191, 3188, 2373, 2434, 2701, 3563, 3568, 2434, 2373, 2371, 2372, 2381, 2373, 2383, 2371, 2375, 2376, 2376, 2372, 2371,
+	2375, 2379, 2376, 2379, 2380, 2376, 2383, 2385, 2386, 2386, 2381, 2383, 1780, 1785, 1782, 1782, 1783, 1780, 1785, 1780, 1784, 1788, 1789, 1786,
+	1788, 1786, 1790, 1790, 1791, 1788, 1792, 1793, 1794, 1796, 1792, 1794, 1794, 1797, 1796, 1799, 1805, 1798, 1802, 1798, 1805, 1799, 1803, 1804,
+	1813, 1815, 1812, 1815, 1813, 1816, 1816, 1817, 1815, 1853, 1854, 1859, 1859, 1861, 1853, 1863, 1853, 1861, 1853, 1863, 3510, 3510, 3519, 1853,
+	1854, 1853, 3519, 1859, 1854, 1856, 3519, 3527, 1854, 1856, 1854, 3527, 1861, 1859, 1868, 1868, 1865, 1861, 1865, 1871, 1861, 1861, 1873, 1863,
+	1873, 1861, 1871, 1863, 3495, 3499, 3495, 1863, 1873, 3499, 3510, 1863, 1871, 1875, 1873, 3495, 1873, 3497, 1880, 3497, 1873, 1873, 1877, 1880,
+	1875, 1877, 1873, 1871, 1865, 1874, 1875, 1871, 1874, 1869, 1866, 1865, 1865, 1868, 1869, 1866, 1874, 1865, 1874, 1876, 1875, 1877, 1875, 1876,
+	1879, 1880, 1877, 3544, 1877, 3543, 1877, 3544, 3546, 3546, 3547, 1877, 1881, 1880, 1879, 1879, 1882, 1881, 1880, 1881, 3500, 3500, 3497, 1880,
+	3500, 3498, 3497, 3500, 3501, 3498, 3501, 3500, 3506, 3497, 3498, 3495, 3499, 3495, 3498, 3498, 3501, 3499, 3503, 3499, 3501, 3501, 3505, 3503,
+	3506, 3505, 3501, 3505, 3506, 3551, 3503, 3505, 3507, 3551, 3507, 3505, 3510, 3499, 3503, 3507, 3508, 3503, 3503, 3512, 3510, 3512, 3503, 3508,
+	3508, 3507, 3548, 3507, 3551, 3548, 3508, 3511, 3512, 3548, 3514, 3508, 3515, 3511, 3508, 3508, 3514, 3515, 3511, 3516, 3512, 3517, 3512, 3516,
+	3512, 3517, 3510, 3519, 3510, 3517, 3516, 3520, 3517, 3521, 3517, 3520, 3517, 3521, 3519, 3516, 3511, 3515, 3520, 3516, 3522, 3515, 3522, 3516,
+	3525, 3515, 3514, 3522, 3515, 3525, 3514, 3544, 3525, 3546, 3544, 3514, 3514, 3548, 3546, 3548, 3549, 3546, 3547, 3546, 3549, 3549, 3550, 3547,
+	3543, 3525, 3544, 3533, 3522, 3525, 3525, 3535, 3533, 3535, 3525, 3542, 3543, 3542, 3525, 3522, 3533, 3520, 3526, 3520, 3533, 3532, 3526, 3533,
+	3533, 3536, 3532, 3536, 3533, 3535, 3535, 3538, 3536, 3542, 3541, 3535, 3538, 3535, 3541, 3532, 3536, 3537, 3538, 3537, 3536, 3528, 3532, 3531,
+	3526, 3532, 3528, 3537, 3531, 3532, 3520, 3526, 3521, 3528, 3521, 3526, 3521, 3528, 3527, 3531, 3527, 3528, 3527, 3531, 1856, 3527, 3519, 3521,
+	3541, 5477, 3538, 2228, 1936, 1937, 3253, 2228, 2224, 2223, 2224, 2228, 2228, 2229, 2223, 2229, 2228, 2231, 2224, 1975, 3253, 2229, 2231, 2232,
+	2395, 2231, 2398, 2231, 2395, 2399, 2399, 2232, 2231, 2232, 2234, 2229, 2234, 2232, 2399, 2230, 2223, 2229, 2234, 2760, 2229, 2237, 2229, 2760,
+	2229, 2237, 2230, 2399, 2401, 2234, 2760, 2234, 2401, 2760, 2240, 2237, 2401, 2759, 2760, 2760, 2759, 2764, 2764, 2240, 2760, 2230, 2237, 2238,
+	2238, 2237, 2240, 2238, 2239, 2230, 2240, 2241, 2238, 2238, 2241, 1981, 1984, 2238, 1981, 2239, 2238, 1984, 2241, 2240, 2764, 2241, 2764, 4457,
+	4457, 1976, 2241, 1976, 4457, 1980, 4454, 4455, 4457, 4463, 4457, 4462, 1980, 1981, 1976, 1981, 1980, 1984, 1984, 1987, 2239, 4452, 4455, 4454,
+	4454, 4451, 4452, 2804, 2398, 2809, 1939, 1940, 1942, 1942, 1940, 1945, 1948, 1949, 1950, 1950, 1951, 1948, 1952, 1949, 1948, 1948, 1963, 1952,
+	1951, 1950, 1954, 1954, 1955, 1951, 1954, 1959, 1955, 1958, 1955, 1959, 1958, 1959, 1960, 1960, 1961, 1958, 1964, 1952, 1963, 1963, 1965, 1964,
+	1992, 1993, 1994, 1994, 1995, 1992, 1993, 1992, 1996, 1997, 1992, 1995, 1996, 1992, 1997, 1996, 1998, 1993, 1998, 1996, 1999, 1997, 2000, 1996,
+	1999, 1996, 2000, 1995, 2001, 1997, 1997, 2012, 2003, 2003, 2000, 1997, 2012, 1997, 2001, 2053, 2001, 1995, 1995, 1994, 2053, 2057, 2053, 1994,
+	1994, 2060, 2057, 2053, 2050, 2044, 2051, 2050, 2053, 2053, 2057, 2051, 2053, 2044, 2001, 2001, 2044, 2012, 2012, 2010, 2003, 2040, 2012, 2044,
+	2040, 2010, 2012, 2040, 2044, 2043, 2043, 2044, 2046, 2050, 2046, 2044, 2046, 2050, 2051, 2051, 2052, 2046, 2046, 2048, 2043, 2049, 2048, 2046,
+	2046, 2052, 2049, 2043, 2041, 2040, 2041, 2043, 2042, 2042, 2043, 2048, 2040, 2023, 2011, 2023, 2040, 2031, 2040, 2041, 2031, 2011, 2010, 2040,
+	2003, 2010, 2011, 2011, 2009, 2003, 2009, 2011, 2014, 2014, 2011, 2023, 2023, 2024, 2014, 2024, 2023, 2028, 2031, 2028, 2023, 2028, 2031, 2032,
+	2031, 2041, 2032, 2042, 2032, 2041, 2032, 2033, 2028, 2028, 2029, 2024, 2033, 2029, 2028, 2022, 2014, 2024, 2024, 2026, 2022, 2026, 2024, 2029,
+	2014, 2013, 2009, 2022, 2013, 2014, 2003, 2009, 2004, 2008, 2004, 2009, 2009, 2013, 2008, 2004, 2000, 2003, 2000, 2004, 1999, 2006, 1999, 2004,
+	2004, 2008, 2006, 2008, 2020, 5250, 5250, 2006, 2008, 2008, 2013, 2022, 2022, 2020, 2008, 2022, 2025, 2020, 2027, 2025, 2022, 2022, 2026, 2027,
+	2029, 2035, 2026, 2027, 2026, 2035, 2035, 2037, 2027, 2036, 2035, 2029, 2037, 2035, 2036, 2036, 2038, 2037, 2029, 2033, 2036, 2006, 2005, 1999,
+	1999, 2005, 1998, 2049, 4059, 2048, 2155, 2067, 2064, 2068, 2064, 2069, 2064, 2067, 2077, 2077, 2069, 2064, 2071, 2064, 2072, 2155, 2064, 2071,
+	2068, 2072, 2064, 2150, 2154, 2155, 2160, 2155, 2154, 2149, 2150, 3762, 3762, 2150, 3769, 2072, 2149, 2071, 2154, 2161, 2160, 2160, 2161, 2077,
+	2069, 2077, 2078, 2166, 2077, 2161, 2161, 2165, 2166, 2165, 2078, 2166, 2069, 2078, 2081, 2078, 2165, 2169, 2169, 2081, 2078, 2081, 2082, 2069,
+	2082, 2081, 2169, 2169, 2171, 2082, 2080, 2069, 2082, 2080, 2082, 2084, 2173, 2082, 2171, 2069, 2080, 2068, 2173, 2175, 2084, 2813, 2817, 2173,
+	2204, 2205, 2202, 2217, 2218, 2215, 2221, 2218, 2217, 2252, 2253, 2251, 2320, 2321, 2322, 2322, 2323, 2320, 2326, 2323, 2322, 2322, 2327, 2326,
+	2361, 2357, 2358, 2362, 2363, 2366, 2366, 2367, 2362, 2366, 2368, 2369, 2369, 2367, 2366, 2389, 2390, 2388, 2388, 2683, 2687, 2394, 2392, 2393,
+	2693, 2689, 2394, 2403, 2404, 3652, 4193, 2403, 2407, 3652, 2407, 2403, 3669, 3652, 2404, 2404, 4201, 3669, 3652, 3651, 2407, 3658, 3651, 3652,
+	3658, 3652, 3659, 3652, 3660, 3659, 3652, 3669, 3660, 2407, 3647, 3649, 3647, 2407, 3651, 2407, 3649, 4193, 3648, 4193, 3649, 4741, 4192, 4193,
+	4744, 4193, 4200, 3649, 3646, 3648, 3646, 3649, 3647, 3638, 3647, 3656, 3638, 3646, 3647, 3651, 3656, 3647, 3651, 3658, 3656, 3659, 2768, 3658,
+	2768, 3659, 3666, 2768, 3666, 3689, 3666, 3659, 3662, 3662, 3674, 3666, 3674, 3676, 3666, 3689, 3666, 3676, 3676, 3681, 3689, 3681, 3683, 3689,
+	3693, 3689, 3683, 4212, 3676, 3674, 3679, 3680, 3676, 3676, 4759, 3679, 3676, 3680, 3681, 3674, 3662, 3668, 4208, 3674, 3668, 3674, 4208, 4212,
+	4211, 4212, 4208, 3679, 4212, 4211, 3680, 3679, 2449, 4218, 3679, 4211, 3683, 3681, 3680, 2449, 3683, 3680, 2445, 3683, 2449, 3683, 2445, 3693,
+	3691, 3693, 2445, 3691, 3697, 3693, 4219, 3694, 2445, 2445, 4218, 4219, 2449, 4218, 2445, 2445, 3694, 3691, 4762, 4218, 4764, 3697, 3691, 3694,
+	3694, 3698, 3697, 3698, 3719, 3697, 4222, 3694, 4219, 3698, 3694, 4222, 4222, 4224, 3698, 3709, 3701, 3698, 3702, 3698, 3701, 3719, 3698, 3702,
+	3709, 3698, 4224, 3719, 3702, 3707, 3707, 3715, 3719, 3720, 3719, 3715, 3719, 3720, 3729, 3729, 3727, 3719, 3701, 3706, 3702, 3706, 3707, 3702,
+	3709, 3706, 3701, 3707, 3706, 3709, 4229, 3707, 3709, 3715, 3707, 4229, 4224, 4225, 3709, 4225, 3711, 3709, 3709, 3711, 4229, 4229, 4231, 3715,
+	4776, 4225, 4229, 3715, 4233, 3720, 4233, 3715, 4231, 3722, 3729, 3720, 3720, 4233, 3722, 4233, 4235, 3722, 3729, 3722, 4235, 4235, 3749, 3729,
+	3751, 3749, 4235, 4235, 4240, 3751, 3731, 3749, 3739, 3749, 3731, 3729, 3729, 3731, 3727, 3739, 3727, 3731, 3739, 3735, 3727, 3739, 3748, 3735,
+	4240, 4426, 4425, 3668, 3672, 4208, 4754, 4206, 4208, 3667, 3668, 3662, 3668, 3667, 3672, 4201, 3672, 3667, 3662, 3660, 3667, 3669, 3667, 3660,
+	3667, 3669, 4201, 3660, 3662, 3659, 4746, 4200, 4201, 4201, 4206, 4754, 4746, 4744, 4200, 3656, 3636, 3638, 3637, 3636, 3656, 3636, 3630, 3634,
+	3637, 3630, 3636, 3634, 3638, 3636, 3638, 3634, 4187, 4187, 4189, 3638, 3646, 3638, 4189, 3633, 3634, 3630, 3634, 3633, 2551, 2551, 4187, 3634,
+	3630, 3632, 3618, 3630, 3637, 3632, 3618, 3633, 3630, 2552, 2549, 3633, 3633, 3618, 2552, 2551, 3633, 2549, 2549, 4181, 2551, 4181, 4187, 2551,
+	4181, 2549, 2552, 2552, 2553, 4181, 2554, 4179, 2552, 2553, 2552, 4179, 2552, 3611, 2554, 2552, 3618, 3611, 3611, 3618, 3632, 3632, 3628, 3611,
+	3611, 3605, 3608, 3605, 3611, 3628, 3608, 2554, 3611, 3606, 3605, 3628, 3614, 3606, 3628, 3627, 3614, 3628, 3605, 3606, 3612, 3612, 3608, 3605,
+	3608, 3612, 4174, 3606, 3614, 3612, 3612, 3614, 3845, 4174, 3612, 4170, 3614, 3843, 3845, 3841, 3843, 3614, 3614, 3627, 3841, 4099, 3845, 4103,
+	3845, 4170, 4718, 4723, 4174, 4725, 4174, 4178, 4725, 4725, 4178, 4179, 4179, 4181, 4730, 4189, 3648, 3646, 4189, 4192, 4741, 4792, 2457, 2456,
+	3808, 3775, 4792, 4792, 3811, 3808, 3813, 3811, 4792, 4792, 3815, 3813, 4792, 4794, 4791, 4792, 4797, 4798, 3771, 3774, 3775, 3775, 3808, 3771,
+	3770, 3771, 3808, 3808, 3812, 3770, 3812, 3808, 3811, 3813, 3815, 3817, 2466, 2465, 2463, 2463, 2471, 2466, 2568, 2570, 2567, 2571, 2573, 2574,
+	2575, 2576, 2578, 2581, 2582, 2580, 2585, 2586, 2584, 2677, 2584, 2682, 2682, 2681, 2677, 2590, 2588, 2589, 2676, 2590, 2671, 2671, 2675, 2676,
+	2704, 2706, 2703, 2706, 2728, 2703, 2704, 2703, 2708, 2708, 2709, 2704, 2709, 2708, 2710, 2710, 2711, 2709, 2711, 2710, 2712, 2712, 2713, 2711,
+	2713, 2712, 2714, 2714, 2715, 2713, 2715, 2714, 2716, 2716, 2717, 2715, 2717, 2716, 2718, 2718, 2719, 2717, 2719, 2718, 2720, 2720, 2721, 2719,
+	2721, 2720, 2722, 2722, 2723, 2721, 2723, 2722, 2726, 2726, 2727, 2723, 2727, 2726, 2728, 2728, 2729, 2727, 2728, 2706, 2729, 2734, 2731, 2736,
+	2756, 2731, 2734, 2736, 2733, 2734, 2756, 2734, 2757, 2736, 2737, 2733, 2737, 2736, 2738, 2738, 2739, 2737, 2739, 2738, 2742, 2742, 2743, 2739,
+	2743, 2742, 2744, 2744, 2745, 2743, 2745, 2744, 2746, 2746, 2747, 2745, 2747, 2746, 2748, 2748, 2749, 2747, 2749, 2748, 2750, 2750, 2751, 2749,
+	2751, 2750, 2752, 2752, 2753, 2751, 2753, 2752, 2754, 2754, 2755, 2753, 2755, 2754, 2756, 2756, 2757, 2755, 2771, 2773, 2770, 2771, 2770, 2774,
+	2774, 2775, 2771, 2771, 2792, 2773, 2790, 2773, 2792, 2792, 2791, 2790, 2788, 2790, 2787, 2790, 2791, 2787, 2786, 2788, 2787, 2787, 2785, 2786,
+	2783, 2786, 2785, 2785, 2784, 2783, 2782, 2779, 2783, 2783, 2784, 2782, 2779, 2782, 2780, 2776, 2779, 2780, 2780, 2778, 2776, 2774, 2776, 2777,
+	2776, 2778, 2777, 2777, 2775, 2774, 2822, 2823, 2820, 2822, 2820, 2824, 2824, 2825, 2822, 2826, 2827, 2828, 2830, 2826, 2828, 2828, 2831, 2830,
+	2832, 2836, 2835, 2836, 2837, 2835, 2841, 2840, 2835, 2837, 2845, 2835, 2843, 2835, 2845, 2841, 2835, 2843, 2843, 2844, 2841, 2908, 2909, 2910,
+	2966, 2967, 2968, 2968, 2969, 2966, 2970, 2968, 2967, 2967, 2973, 2970, 2972, 2970, 2973, 3086, 3087, 3090, 3090, 3093, 3086, 3095, 3090, 3094,
+	3093, 3090, 3095, 3090, 3098, 3094, 3097, 3096, 3095, 3095, 3094, 3097, 3099, 3100, 3101, 3100, 3102, 3103, 3103, 3101, 3100, 3110, 3117, 3108,
+	3110, 3114, 3117, 3117, 3114, 3118, 3117, 3118, 3119, 3122, 3117, 3119, 3119, 3124, 3122, 3125, 3133, 3127, 3133, 3131, 3127, 3135, 3131, 3133,
+	3136, 3135, 3133, 3136, 3133, 3139, 3139, 3141, 3136, 3142, 3143, 3144, 3144, 3145, 3142, 3152, 3153, 3154, 3154, 3155, 3152, 3168, 3169, 3170,
+	3170, 3171, 3168, 3205, 3206, 3207, 3210, 3207, 3211, 3211, 3212, 3210, 3212, 3211, 3213, 3213, 3214, 3212, 3255, 3256, 3257, 3257, 3258, 3255,
+	3259, 3260, 3261, 3261, 3262, 3259, 3318, 3319, 3320, 3320, 3321, 3318, 3348, 3349, 3350, 3351, 3352, 3348, 3348, 3350, 3351, 3353, 3354, 3355,
+	3355, 3360, 3353, 3353, 3357, 3354, 3378, 3354, 3357, 3357, 3374, 3375, 3375, 3378, 3357, 3374, 3372, 3373, 3373, 3375, 3374, 3369, 3372, 3370,
+	3369, 3373, 3372, 3367, 3369, 3370, 3370, 3368, 3367, 3365, 3367, 3368, 3368, 3366, 3365, 3363, 3365, 3366, 3363, 3366, 3362, 3362, 3361, 3363,
+	3359, 3361, 3362, 3362, 3360, 3359, 3355, 3359, 3360, 3383, 4520, 3385, 3385, 3386, 3383, 4520, 4832, 6102, 4832, 4553, 6090, 6090, 6091, 4832,
+	6106, 6102, 4832, 6096, 6097, 4553, 6096, 4553, 5162, 5162, 6100, 6096, 6094, 5162, 4509, 4509, 6093, 6094, 3561, 4509, 3559, 3559, 3560, 3561,
+	3399, 3395, 3398, 3407, 3401, 3406, 3408, 3409, 3410, 3416, 3418, 3417, 3423, 3424, 3421, 3421, 3424, 3426, 4290, 3423, 3421, 3421, 4291, 4290,
+	4291, 3421, 3426, 3424, 3423, 3427, 3458, 3427, 3423, 3423, 3429, 3458, 4296, 3423, 4290, 4296, 3429, 3423, 3427, 3430, 3424, 3424, 3430, 3431,
+	3431, 3426, 3424, 3433, 3426, 3431, 3426, 4297, 4291, 4297, 3426, 3433, 4290, 4291, 4292, 4291, 4297, 4298, 4298, 4292, 4291, 4298, 4297, 4306,
+	3433, 4306, 4297, 4299, 4292, 4298, 4304, 4299, 4298, 4306, 4308, 4298, 4309, 4298, 4308, 4298, 4309, 4304, 4292, 4293, 4290, 4292, 4299, 4300,
+	4300, 4293, 4292, 4303, 4300, 4299, 4299, 4304, 4303, 4315, 4304, 4309, 4304, 4315, 4303, 4308, 3482, 4309, 4315, 4309, 3482, 4308, 4306, 3468,
+	3482, 4308, 3476, 3468, 3476, 4308, 3468, 4306, 3433, 3468, 3434, 3466, 3466, 3469, 3468, 3469, 3471, 3468, 3433, 3434, 3468, 3476, 3468, 3471,
+	3471, 3475, 3476, 3475, 3477, 3476, 3481, 3476, 3477, 3476, 3481, 3482, 3473, 3471, 3469, 3475, 3471, 3473, 3469, 3466, 3467, 3467, 3470, 3469,
+	3469, 3470, 3473, 3473, 3474, 3475, 3477, 3475, 3474, 3474, 3479, 3477, 3477, 3480, 3481, 3480, 3477, 3479, 3483, 3481, 3480, 3481, 3483, 3487,
+	3487, 3482, 3481, 3493, 3480, 3486, 3479, 3486, 3480, 3480, 3493, 3483, 3483, 3488, 3487, 3488, 3483, 3493, 3482, 3487, 3489, 3489, 4315, 3482,
+	4315, 3489, 4318, 4318, 4303, 4315, 4303, 4318, 4319, 4300, 4303, 4302, 4303, 4319, 4320, 4320, 4324, 4303, 4302, 4303, 4324, 4293, 4300, 4301,
+	4302, 4301, 4300, 4324, 4328, 4302, 4301, 4302, 4328, 4324, 4320, 4325, 4325, 4327, 4324, 4328, 4324, 4327, 4327, 4329, 4328, 4336, 4328, 4329,
+	4328, 4336, 4301, 4301, 4294, 4293, 4294, 4301, 4336, 4290, 4293, 4294, 4294, 4296, 4290, 4336, 4337, 4294, 4296, 4294, 4337, 4329, 4339, 4336,
+	4337, 4336, 4339, 4329, 4327, 4330, 4330, 4333, 4329, 4339, 4329, 4333, 4327, 4325, 4331, 4331, 4330, 4327, 4330, 4331, 4410, 4333, 4330, 4334,
+	4410, 4334, 4330, 4333, 4345, 4339, 4345, 4333, 4340, 4334, 4340, 4333, 4349, 4337, 4339, 4339, 4347, 4349, 4339, 4345, 4348, 4348, 4347, 4339,
+	4337, 4349, 4296, 4349, 4359, 4296, 4347, 4350, 4349, 4349, 4350, 4360, 4360, 4361, 4349, 4359, 4349, 4361, 4347, 4348, 4351, 4351, 4350, 4347,
+	4352, 4348, 4345, 4351, 4348, 4352, 4340, 4353, 4345, 4345, 4353, 4352, 4352, 4354, 4351, 4355, 4352, 4353, 4354, 4352, 4355, 4362, 4351, 4354,
+	4351, 4362, 4350, 4362, 4360, 4350, 4380, 4360, 4362, 4360, 4380, 4381, 4381, 4361, 4360, 4361, 4368, 4359, 4361, 4381, 4369, 4369, 4368, 4361,
+	4370, 4369, 4381, 4381, 4382, 4370, 4362, 4378, 4380, 4354, 4363, 4362, 4362, 4363, 4364, 4378, 4362, 4364, 4355, 4392, 4354, 4363, 4354, 4392,
+	4375, 4364, 4363, 4363, 4392, 4375, 4375, 4376, 4364, 4364, 4379, 4378, 4379, 4364, 4376, 4376, 4375, 4386, 4388, 4386, 4375, 4375, 4392, 4388,
+	4394, 4388, 4392, 4392, 4355, 4394, 4387, 4386, 4388, 4388, 4390, 4387, 4388, 4394, 4390, 4386, 4385, 4376, 4385, 4386, 4387, 4376, 4383, 4379,
+	4383, 4376, 4385, 4385, 3990, 4383, 4387, 3986, 4385, 3990, 4385, 3986, 3986, 3987, 3990, 3990, 3987, 3989, 4394, 4395, 4390, 4397, 4395, 4394,
+	4394, 4396, 4397, 4401, 4397, 4396, 4398, 4396, 4394, 4400, 4396, 4398, 4396, 4400, 4401, 4403, 4401, 4400, 4402, 4400, 4398, 4400, 4402, 4403,
+	4394, 4355, 4398, 4353, 4398, 4355, 4344, 4398, 4353, 4398, 4344, 4402, 4404, 4402, 4344, 4402, 4404, 4405, 4405, 4403, 4402, 4353, 4340, 4344,
+	4341, 4344, 4340, 4344, 4341, 4404, 4408, 4404, 4341, 4404, 4408, 3493, 3493, 4405, 4404, 4340, 4334, 4341, 4342, 4341, 4334, 4341, 4342, 4408,
+	4342, 4410, 4408, 4334, 4410, 4342, 3465, 3467, 3466, 3445, 3464, 3465, 3465, 3446, 3445, 3466, 3446, 3465, 3435, 3446, 3466, 3466, 3434, 3435,
+	3437, 3445, 3446, 3446, 3435, 3437, 3460, 3445, 3437, 3461, 3464, 3445, 3445, 3460, 3461, 3437, 3435, 3433, 3433, 3436, 3437, 3449, 3437, 3436,
+	3437, 3449, 3460, 3433, 3435, 3434, 3431, 3436, 3433, 3450, 3436, 3431, 3436, 3450, 3449, 3430, 3452, 3431, 3431, 3452, 3450, 3452, 3430, 3427,
+	3427, 3454, 3452, 3454, 3427, 3458, 3458, 3459, 3454, 3454, 3459, 3457, 3460, 3462, 3461, 3552, 3553, 3554, 3554, 3555, 3552, 3556, 3557, 3558,
+	3569, 3570, 3571, 3571, 3572, 3569, 3570, 3569, 3573, 3573, 3574, 3570, 3575, 3574, 3573, 3573, 3576, 3575, 3577, 3572, 3571, 3571, 3578, 3577,
+	3833, 3586, 3587, 3589, 3586, 3833, 3798, 3795, 3796, 3800, 3796, 3795, 3795, 3803, 3800, 3796, 3797, 3798, 3804, 3798, 3797, 3797, 3805, 3804,
+	3804, 3805, 3806, 3804, 3806, 3807, 3849, 3854, 3855, 3853, 3849, 3855, 3865, 3855, 3854, 3857, 3853, 3855, 3862, 3857, 3855, 3855, 3865, 3862,
+	3853, 3857, 3861, 3861, 3859, 3853, 3861, 3857, 3862, 3866, 3862, 3865, 3862, 3866, 3867, 3862, 3867, 3868, 3862, 3868, 3861, 3870, 3861, 3868,
+	3861, 3870, 3859, 3868, 3871, 3870, 3872, 3873, 3874, 3874, 3875, 3872, 3874, 3873, 3878, 3953, 3954, 3952, 3961, 3957, 3958, 3958, 3959, 3961,
+	3966, 3963, 3964, 3964, 3965, 3966, 4060, 4061, 4062, 4062, 4063, 4060, 4064, 4065, 4060, 4060, 4063, 4064, 4107, 4105, 4106, 4106, 4105, 4108,
+	4106, 4110, 4107, 4107, 4110, 4111, 4108, 4109, 4106, 4108, 4122, 4109, 4122, 4108, 4126, 4126, 4125, 4122, 4126, 4128, 4125, 4129, 4128, 4126,
+	4129, 4130, 4128, 4129, 4131, 4130, 4111, 4110, 4115, 4115, 4116, 4111, 4116, 4115, 4119, 4119, 4118, 4116, 4119, 4120, 4118, 4141, 4142, 4140,
+	4143, 4144, 4140, 4140, 4142, 4143, 4143, 4145, 4146, 4146, 4144, 4143, 4147, 4146, 4145, 4145, 4148, 4147, 4149, 4150, 4151, 4151, 4152, 4149,
+	4150, 4149, 4153, 4153, 4156, 4150, 4157, 4156, 4153, 4153, 4158, 4157, 4247, 4244, 4245, 4282, 4281, 4278, 4278, 4283, 4282, 4411, 4412, 4413,
+	4413, 4414, 4411, 4414, 4413, 4419, 4419, 4420, 4414, 4435, 4436, 4431, 4443, 4444, 4445, 4445, 4446, 4443, 4446, 4445, 4447, 4447, 4449, 4446,
+	4466, 4468, 4465, 4468, 4470, 4465, 4470, 4468, 4473, 4473, 4474, 4470, 4475, 4476, 4480, 4480, 4478, 4475, 4480, 4476, 4481, 4481, 4482, 4480,
+	4481, 4485, 4482, 4485, 4486, 4482, 4487, 4488, 4489, 4489, 4490, 4487, 4491, 4488, 4487, 4487, 4492, 4491, 4496, 4494, 4495, 4497, 4494, 4496,
+	4496, 4495, 4498, 4501, 4497, 4496, 4496, 4498, 4505, 4505, 4503, 4496, 4504, 4496, 4503, 4496, 4504, 4501, 4507, 4503, 4505, 4503, 4507, 4504,
+	4543, 4541, 4542, 4546, 4547, 4548, 4548, 5292, 4546, 5292, 4628, 4629, 5287, 5291, 5292, 5292, 5288, 5287, 5287, 5288, 5289, 5289, 5290, 5287,
+	4811, 4812, 4813, 4813, 4814, 4811, 4813, 4812, 4815, 4815, 4816, 4813, 4817, 4818, 4819, 4819, 4820, 4817, 4821, 4820, 4819, 4819, 4822, 4821,
+	4823, 4824, 4825, 4825, 4826, 4823, 4827, 4828, 4829, 4829, 4830, 4827, 4852, 4853, 4854, 4854, 4855, 4852, 4855, 4854, 4856, 4856, 4857, 4855,
+	4858, 4859, 4860, 4860, 4861, 4858, 4859, 4858, 4862, 4863, 4859, 4862, 4862, 4879, 4865, 4862, 4865, 4863, 4863, 4865, 4867, 4878, 4865, 4879,
+	4878, 4879, 4880, 4880, 4881, 4878, 4869, 4867, 4870, 4871, 4869, 4870, 4870, 4875, 4861, 4871, 4870, 4861, 4860, 4871, 4861, 4876, 4861, 4875,
+	4875, 4877, 4876, 4957, 4958, 4959, 4959, 4960, 4957, 4958, 4957, 4961, 4961, 4962, 4958, 4965, 4966, 4967, 4967, 4974, 4965, 4965, 4974, 4970,
+	4970, 4969, 4965, 4969, 4971, 4965, 4974, 4967, 4973, 4972, 4970, 4974, 4974, 4975, 4972, 4974, 4973, 4975, 4980, 4977, 4978, 4978, 4986, 4980,
+	4985, 4980, 4986, 4978, 4982, 4981, 4978, 4981, 4984, 4984, 4986, 4978, 4986, 4984, 4987, 4986, 4988, 4985, 4986, 4987, 4988, 5017, 5018, 5016,
+	5022, 5017, 5016, 5016, 5045, 5022, 5045, 5016, 5049, 5056, 5049, 5016, 5057, 5056, 5016, 5016, 5059, 5057, 5018, 5059, 5016, 5020, 5021, 5017,
+	5018, 5017, 5021, 5020, 5017, 5022, 5026, 5018, 5021, 5025, 5021, 5020, 5026, 5021, 5025, 5022, 5023, 5020, 5033, 5020, 5023, 5020, 5033, 5025,
+	5025, 5028, 5026, 5025, 5033, 5030, 5025, 5030, 5028, 5032, 5030, 5033, 5033, 5023, 5034, 5034, 5035, 5033, 5033, 5035, 5032, 5034, 5023, 5022,
+	5034, 5037, 5035, 5039, 5037, 5034, 5040, 5041, 5034, 5022, 5040, 5034, 5041, 5039, 5034, 5042, 5032, 5035, 5035, 5037, 5042, 5037, 5043, 5042,
+	5037, 5039, 5043, 5040, 5053, 5041, 5045, 5046, 5040, 5040, 5022, 5045, 5053, 5040, 5046, 5054, 5053, 5046, 5051, 5046, 5045, 5046, 5051, 5054,
+	5049, 5050, 5045, 5045, 5050, 5051, 5065, 5070, 5062, 5065, 5062, 5064, 5070, 5092, 5062, 5098, 5062, 5092, 5062, 5098, 5101, 5101, 5064, 5062,
+	5067, 5070, 5065, 5065, 5068, 5067, 5069, 5068, 5065, 5067, 5071, 5070, 5071, 5067, 5082, 5067, 5068, 5073, 5073, 5082, 5067, 5076, 5068, 5069,
+	5076, 5073, 5068, 5073, 5076, 5077, 5077, 5078, 5073, 5073, 5078, 5080, 5080, 5082, 5073, 5082, 5080, 5081, 5083, 5071, 5082, 5082, 5084, 5083,
+	5081, 5084, 5082, 5070, 5071, 5083, 5083, 5084, 5086, 5083, 5086, 5088, 5089, 5083, 5088, 5083, 5089, 5070, 5090, 5086, 5084, 5084, 5081, 5090,
+	5086, 5090, 5091, 5091, 5088, 5086, 5095, 5089, 5088, 5092, 5070, 5089, 5089, 5093, 5092, 5093, 5089, 5095, 5093, 5095, 5104, 5092, 5093, 5099,
+	5104, 5099, 5093, 5092, 5097, 5098, 5099, 5097, 5092, 5220, 5221, 5222, 5222, 5223, 5220, 5234, 5221, 5220, 5236, 5234, 5220, 5220, 5237, 5236,
+	5223, 5222, 5226, 5226, 5227, 5223, 5230, 5227, 5226, 5226, 5231, 5230, 5232, 5233, 5230, 5230, 5231, 5232, 5242, 5243, 5238, 5244, 5248, 5249,
+	5255, 5256, 5252, 5260, 5262, 5261, 5535, 5928, 5537, 5539, 5535, 5537, 5924, 5537, 5928, 5925, 5924, 5928, 5928, 5931, 5925, 5537, 5541, 5539,
+	5541, 5537, 5540, 5920, 5540, 5537, 5537, 5924, 5920, 5543, 5539, 5541, 5546, 5541, 5540, 5547, 5541, 5546, 5547, 5543, 5541, 5546, 5540, 5920,
+	5920, 5916, 5546, 5916, 5920, 5921, 5921, 5920, 5924, 5924, 5925, 5921, 5921, 5917, 5916, 5923, 5917, 5921, 5921, 5925, 5926, 5926, 5927, 5921,
+	5921, 5927, 5923, 5914, 5915, 5916, 5914, 5916, 5917, 5548, 5546, 5916, 5916, 5915, 5548, 5546, 5548, 5547, 5922, 5917, 5923, 5917, 5922, 5914,
+	5923, 5951, 5922, 5923, 5927, 5935, 5935, 5939, 5923, 5923, 5939, 5940, 5951, 5923, 5940, 5927, 5926, 5934, 5934, 5935, 5927, 5935, 5934, 5938,
+	5938, 5939, 5935, 5940, 5939, 5941, 5941, 5939, 5938, 5941, 5946, 5940, 5945, 5941, 5938, 5948, 5941, 5945, 5941, 5948, 5946, 5938, 5934, 5932,
+	5932, 5937, 5938, 5938, 5937, 5945, 5932, 5934, 5926, 5929, 5932, 5926, 5929, 5926, 5925, 5925, 5930, 5929, 5925, 5931, 5930, 5550, 5551, 5552,
+	5552, 5553, 5550, 5554, 5555, 5556, 5556, 5557, 5554, 5569, 5570, 5572, 5570, 5569, 5573, 5573, 5574, 5570, 5576, 5578, 5575, 5579, 5575, 5578,
+	5578, 5580, 5579, 5603, 5604, 5605, 5605, 5606, 5603, 5604, 5603, 5607, 5607, 5608, 5604, 5608, 5607, 5609, 5623, 5624, 5625, 5625, 5626, 5623,
+	5627, 5624, 5623, 5623, 5628, 5627, 5631, 5632, 5634, 5635, 5631, 5634, 5634, 5636, 5635, 5642, 5638, 5639, 5642, 5639, 5643, 5643, 5644, 5642,
+	5645, 5649, 5651, 5651, 5652, 5645, 5653, 5657, 5658, 5658, 5660, 5653, 5659, 5653, 5660, 5688, 5689, 5690, 5690, 5691, 5688, 5854, 5855, 5856,
+	5856, 5857, 5854, 5858, 5854, 5857, 5857, 5859, 5858, 5860, 5861, 5862, 5862, 5863, 5860, 5860, 5863, 5864, 5862, 5861, 5865, 5866, 5867, 5862,
+	5862, 5865, 5866, 5868, 5862, 5867, 5863, 5862, 5868, 5863, 5869, 5864, 5868, 5871, 5863, 5869, 5863, 5871, 5906, 5908, 5864, 5864, 5869, 5906,
+	5906, 5869, 5901, 5871, 5901, 5869, 5876, 5871, 5868, 5901, 5871, 5876, 5876, 5899, 5901, 5901, 5899, 5906, 5906, 5899, 5904, 5911, 5908, 5906,
+	5906, 5904, 5911, 5899, 5876, 5900, 5900, 5905, 5899, 5904, 5899, 5905, 5876, 5868, 5897, 5897, 5900, 5876, 5894, 5897, 5868, 5873, 5894, 5868,
+	5873, 5892, 5894, 5868, 5872, 5873, 5880, 5873, 5872, 5873, 5880, 5892, 5886, 5892, 5880, 5872, 5879, 5880, 5880, 5888, 5886, 5879, 5888, 5880,
+	5867, 5872, 5868, 5872, 5867, 5878, 5878, 5879, 5872, 5879, 5878, 5888, 5889, 5888, 5878, 5888, 5889, 5890, 5888, 5890, 5886, 5866, 5878, 5867,
+	5878, 5866, 5881, 5878, 5881, 5889, 5905, 5912, 5904, 5912, 5913, 5904, 5913, 5911, 5904, 5990, 5991, 5992, 5992, 5993, 5990, 5994, 5990, 5993,
+	5992, 5991, 5995, 5996, 5997, 5992, 5992, 5995, 5996, 5997, 5996, 5998, 5999, 5997, 5998, 5998, 6000, 5999, 5999, 6000, 6001, 5993, 5999, 6001,
+	6001, 5994, 5993, 19, 27, 26, 489, 4535, 19, 4657, 19, 4535, 19, 1260, 1259, 26, 27, 5, 27, 1264, 5, 5, 1091, 26,
+	1091, 5, 8, 8, 5, 9, 985, 5, 1264, 1260, 1264, 1259, 985, 1264, 1267, 1267, 980, 985, 980, 1267, 981, 1017, 980, 981,
+	6120, 1017, 981, 1096, 14, 1017, 1018, 14, 1096, 1096, 1092, 1018, 1096, 1091, 1092, 10, 9, 14, 9, 10, 8, 1091, 8, 43,
+	1087, 1086, 1091, 1087, 1083, 1086, 1083, 4688, 489, 4691, 4700, 4688, 4691, 4688, 4682, 4691, 4682, 4680, 4682, 4672, 4677, 4677, 4680, 4682,
+	4670, 6031, 4677, 59, 6120, 4670, 6029, 6031, 4670, 4662, 4658, 4670, 4670, 4666, 4662, 6029, 6022, 6031, 6029, 6023, 6022, 6023, 4700, 6022,
+	4662, 4657, 4658, 4657, 4535, 4658, 1092, 1021, 1018, 5956, 101, 68, 101, 106, 68, 3821, 68, 106, 5956, 68, 2947, 5956, 5960, 101,
+	93, 106, 101, 101, 5964, 93, 5964, 101, 5960, 3821, 106, 117, 106, 93, 115, 115, 117, 106, 3821, 3828, 2941, 117, 6073, 3821,
+	117, 126, 3828, 3828, 6073, 117, 126, 117, 115, 115, 93, 105, 105, 92, 115, 115, 137, 126, 130, 137, 115, 115, 120, 130,
+	105, 93, 5964, 103, 105, 5964, 5970, 103, 5964, 92, 105, 109, 105, 103, 109, 130, 92, 109, 137, 130, 135, 130, 144, 135,
+	109, 144, 130, 135, 5976, 137, 137, 5976, 5982, 5982, 1752, 137, 126, 137, 1752, 3828, 126, 1752, 5982, 5984, 1752, 1752, 5984, 5988,
+	5988, 3586, 1752, 3586, 3828, 1752, 3586, 2941, 3828, 2941, 3586, 2947, 2947, 3586, 3587, 5976, 144, 5974, 5976, 135, 144, 5974, 144, 5970,
+	109, 103, 144, 103, 5970, 144, 3311, 3312, 204, 266, 268, 204, 204, 721, 266, 204, 268, 271, 271, 739, 204, 3308, 3312, 3311,
+	3306, 3308, 3302, 5873, 3308, 5894, 5886, 3308, 5873, 3306, 3302, 3307, 5873, 5894, 5868, 5868, 5872, 5873, 5872, 5878, 5873, 5873, 5888, 5886,
+	5878, 5888, 5873, 5894, 5897, 5868, 5868, 5863, 5867, 5868, 5871, 5863, 5900, 5871, 5868, 5900, 5868, 5897, 5867, 5872, 5868, 5872, 5867, 5878,
+	5881, 5888, 5878, 5866, 5878, 5867, 5878, 5866, 5881, 5888, 5881, 5890, 5888, 5890, 5886, 5866, 5867, 5863, 5863, 5861, 5866, 5864, 5861, 5863,
+	5863, 5869, 5864, 5869, 5863, 5871, 5871, 5899, 5869, 5899, 5871, 5900, 5900, 5905, 5899, 5906, 5869, 5899, 5906, 5899, 5911, 5905, 5912, 5899,
+	5912, 5913, 5899, 5913, 5911, 5899, 5864, 5869, 5906, 5906, 5908, 5864, 5911, 5908, 5906, 739, 271, 241, 241, 243, 739, 739, 243, 1362,
+	739, 736, 3798, 241, 247, 243, 241, 248, 247, 253, 247, 248, 248, 250, 253, 250, 260, 253, 253, 260, 259, 260, 722, 732,
+	259, 260, 732, 722, 260, 266, 871, 260, 867, 266, 721, 722, 867, 865, 868, 867, 868, 871, 864, 868, 865, 3798, 3795, 3796,
+	3798, 3806, 3804, 3803, 3796, 3795, 3804, 3806, 3807, 1364, 1365, 1362, 1365, 1364, 1366, 1366, 1367, 1365, 1367, 1366, 1373, 1373, 1370, 1367,
+	1373, 1372, 1370, 1376, 1372, 1373, 1376, 1373, 1379, 1379, 1380, 1376, 1384, 1380, 1379, 284, 208, 206, 209, 206, 208, 288, 284, 206,
+	206, 211, 288, 284, 282, 283, 282, 278, 283, 208, 278, 236, 229, 236, 278, 278, 228, 229, 278, 273, 228, 273, 278, 272,
+	236, 209, 208, 228, 226, 229, 229, 226, 225, 225, 226, 221, 221, 222, 225, 221, 215, 211, 221, 211, 222, 293, 211, 215,
+	211, 293, 288, 853, 211, 858, 852, 851, 853, 853, 854, 852, 858, 854, 853, 851, 852, 849, 306, 752, 296, 752, 311, 296,
+	302, 771, 296, 302, 296, 311, 310, 306, 296, 296, 771, 310, 746, 1431, 752, 1431, 5175, 752, 752, 5175, 2708, 2708, 1439, 752,
+	1439, 757, 752, 746, 2557, 1420, 1420, 1431, 746, 1152, 746, 1150, 746, 1152, 1156, 1156, 2557, 746, 2562, 2557, 2795, 2557, 1156, 1162,
+	388, 2562, 1420, 1420, 2562, 1421, 1421, 1426, 1420, 1420, 1426, 1431, 1424, 1421, 5584, 3086, 1421, 1424, 1421, 3086, 2728, 2728, 1431, 1421,
+	5586, 1467, 1424, 5586, 1424, 5584, 2722, 1424, 1467, 1424, 2722, 3086, 3090, 3093, 3086, 3090, 1467, 2719, 1467, 3090, 2722, 3093, 3090, 3094,
+	3090, 3098, 3094, 1467, 5590, 1465, 1467, 5586, 5590, 5590, 1451, 2716, 2716, 1465, 5590, 1451, 5590, 5594, 1443, 5165, 1451, 1443, 1451, 1457,
+	1457, 1451, 5199, 5165, 2716, 1451, 2746, 5199, 1451, 1451, 5594, 2746, 5191, 5190, 2716, 5188, 5190, 5191, 1472, 2746, 5594, 1472, 2744, 2746,
+	5594, 5597, 1472, 1472, 5597, 1476, 2744, 1472, 2742, 1476, 5597, 5601, 1476, 5601, 1479, 1479, 1482, 1476, 5601, 422, 1479, 1482, 1479, 1487,
+	1487, 1479, 776, 1493, 1482, 1487, 2736, 1482, 1493, 776, 771, 1487, 1487, 771, 1493, 1774, 776, 781, 1184, 1182, 776, 1184, 776, 1188,
+	2795, 1769, 1774, 1774, 2799, 2795, 1769, 1779, 1774, 2802, 2799, 1774, 1779, 1769, 1776, 1188, 1196, 1192, 1194, 1192, 1196, 5550, 1194, 5552,
+	5552, 5553, 5550, 1182, 1178, 1177, 1175, 1178, 1172, 1178, 1175, 1177, 1172, 760, 1175, 1167, 1172, 1150, 1172, 1167, 760, 757, 758, 760,
+	1441, 757, 1439, 757, 1441, 1443, 1443, 404, 757, 1439, 2708, 1441, 1441, 5169, 1443, 2713, 1441, 2708, 1457, 405, 1443, 1443, 405, 404,
+	5165, 1443, 5169, 1501, 405, 1457, 2750, 1457, 2749, 2750, 2753, 1457, 1501, 765, 405, 765, 1501, 767, 2756, 767, 1501, 2756, 1501, 2753,
+	2753, 2750, 2756, 767, 2756, 1493, 2756, 2731, 1493, 771, 767, 1493, 1493, 2731, 2736, 5210, 2736, 5209, 2841, 2739, 2736, 5209, 5206, 5210,
+	5206, 5209, 2742, 5206, 2742, 5203, 2739, 2841, 2742, 2841, 2840, 2835, 2841, 2835, 2843, 2836, 2845, 2835, 2843, 2835, 2845, 2749, 3365, 3366,
+	2749, 3366, 3360, 3360, 3361, 2749, 3365, 3367, 3368, 3368, 3366, 3365, 3367, 3369, 3368, 3369, 3372, 3368, 3372, 3375, 3374, 3357, 3374, 3375,
+	3375, 3378, 3357, 3354, 3360, 3357, 3378, 3354, 3357, 3354, 3361, 3360, 2704, 2703, 2708, 2704, 1431, 2703, 1431, 2728, 2703, 2715, 2713, 2779,
+	2774, 2779, 2713, 2713, 2775, 2774, 2779, 2782, 2715, 2782, 2779, 2783, 2783, 2719, 2782, 2786, 2719, 2783, 2786, 2790, 2787, 2790, 2773, 2792,
+	2771, 2773, 2774, 2771, 2792, 2773, 2774, 2775, 2771, 3094, 3096, 3093, 1164, 1162, 1165, 5554, 5555, 1165, 1165, 5557, 5554, 322, 317, 5817,
+	318, 5817, 317, 330, 317, 322, 323, 318, 317, 317, 330, 323, 5817, 5815, 322, 5815, 344, 322, 341, 322, 344, 330, 322, 5804,
+	5804, 322, 341, 5804, 5800, 330, 323, 330, 5800, 5800, 335, 323, 323, 335, 336, 318, 323, 336, 336, 528, 318, 528, 5822, 318,
+	336, 5831, 528, 515, 5800, 336, 594, 595, 5800, 595, 594, 597, 5833, 5831, 597, 5822, 528, 5831, 341, 5806, 5804, 5806, 341, 5810,
+	5815, 5810, 344, 582, 5810, 589, 579, 582, 5815, 344, 499, 5815, 5783, 346, 353, 346, 5783, 349, 353, 346, 358, 351, 358, 346,
+	346, 349, 351, 353, 5785, 5783, 5798, 353, 358, 371, 353, 5798, 353, 357, 5785, 357, 353, 371, 5765, 358, 351, 358, 5765, 5798,
+	366, 351, 349, 351, 368, 5765, 366, 368, 351, 349, 542, 366, 349, 5775, 542, 366, 542, 5772, 366, 5765, 555, 5765, 629, 630,
+	627, 630, 629, 627, 5772, 5770, 5772, 542, 5775, 5798, 5796, 371, 5793, 371, 5796, 635, 5793, 642, 357, 5793, 5785, 5785, 642, 645,
+	5785, 572, 357, 446, 447, 452, 452, 447, 458, 481, 810, 1144, 810, 481, 787, 801, 810, 787, 792, 1144, 810, 2951, 787, 4942,
+	806, 801, 787, 787, 833, 806, 1544, 787, 692, 4935, 4934, 2951, 2951, 4942, 4935, 4942, 4950, 4935, 4950, 4942, 4945, 4942, 485, 4945,
+	4934, 4935, 4931, 4952, 4931, 4935, 4935, 4950, 4952, 4931, 4930, 4934, 4931, 1699, 4930, 4923, 4926, 4931, 4926, 1699, 4931, 4953, 4923, 4931,
+	4931, 4952, 4953, 1699, 1701, 4930, 1703, 4930, 1701, 1701, 1699, 1722, 5447, 1699, 4926, 4915, 4920, 4926, 4914, 4915, 4926, 4926, 4923, 4914,
+	5447, 4926, 5445, 4923, 4953, 4914, 4955, 4914, 4953, 4918, 4914, 4955, 4955, 4956, 4918, 5445, 5449, 5447, 5445, 5448, 5449, 5445, 5665, 5448,
+	5665, 5445, 5666, 5450, 5449, 5448, 5450, 1550, 5449, 5448, 1555, 5450, 1556, 1555, 1551, 1550, 1556, 1549, 1551, 1549, 1556, 1549, 1547, 1550,
+	1549, 4439, 1547, 1549, 1551, 4439, 1551, 1552, 4439, 4439, 833, 1547, 4284, 4439, 1552, 3272, 1552, 3245, 1552, 4136, 4284, 1552, 3272, 4136,
+	4136, 3935, 4284, 4843, 3935, 4136, 3983, 3935, 4843, 3980, 3935, 3983, 4843, 3985, 3983, 4843, 4845, 4915, 5665, 5666, 5667, 1719, 1713, 1722,
+	1722, 1713, 1701, 1713, 1719, 1710, 1710, 1701, 1713, 1701, 1710, 1703, 694, 695, 692, 692, 698, 694, 698, 692, 699, 699, 692, 700,
+	698, 699, 710, 700, 709, 699, 699, 709, 710, 700, 720, 709, 709, 720, 711, 658, 646, 663, 663, 646, 665, 658, 663, 666,
+	666, 663, 655, 655, 660, 666, 678, 669, 680, 688, 669, 678, 689, 678, 680, 686, 687, 678, 678, 687, 688, 689, 682, 678,
+	794, 3569, 3571, 3571, 4497, 794, 3569, 3570, 3571, 3570, 3569, 3573, 3575, 3570, 3573, 3573, 3576, 3575, 4497, 4495, 4498, 4501, 4497, 4498,
+	4504, 4498, 4505, 4498, 4504, 4501, 4505, 4507, 4504, 816, 824, 1274, 816, 819, 1004, 824, 816, 1004, 1296, 824, 1004, 825, 1889, 824,
+	5334, 5335, 824, 838, 1296, 1004, 1296, 995, 2294, 2294, 2290, 1296, 1296, 2290, 1889, 1889, 2292, 1898, 1899, 1889, 1898, 1891, 1889, 1899,
+	2289, 2290, 2292, 2292, 2290, 2294, 2294, 2296, 2292, 2295, 2292, 2296, 2292, 2295, 1898, 2295, 2302, 1898, 2302, 1899, 1898, 1907, 1899, 2302,
+	1902, 1891, 1899, 1899, 1907, 1902, 2302, 2295, 1907, 2296, 2304, 2295, 2295, 2304, 1907, 2303, 2296, 2294, 2296, 2303, 2304, 2310, 1907, 2304,
+	2310, 2304, 2303, 5369, 1907, 5377, 5377, 1907, 2310, 1902, 1907, 1911, 5561, 5362, 2310, 5561, 2310, 2303, 2310, 5362, 5377, 2294, 2697, 2303,
+	3942, 2697, 2294, 3793, 3942, 2294, 3793, 3885, 2697, 3793, 3840, 3942, 5561, 3885, 5362, 4792, 3885, 3811, 3811, 3885, 3886, 4792, 3811, 3771,
+	3771, 3774, 4792, 3770, 3771, 3811, 5360, 5362, 5346, 5362, 5360, 5369, 5362, 5387, 5389, 5346, 5362, 5397, 5397, 5362, 5389, 5362, 5369, 5377,
+	5360, 5347, 5352, 5347, 5360, 5346, 5346, 5339, 5347, 5347, 5339, 5334, 5347, 5334, 5366, 5364, 5352, 5347, 5364, 5347, 5366, 5339, 5346, 5345,
+	5345, 5346, 5357, 5397, 5357, 5346, 5389, 5392, 5397, 5389, 5393, 5392, 5393, 5395, 5392, 1274, 1277, 1272, 1276, 1272, 1277, 1939, 840, 1942,
+	1298, 4024, 876, 4600, 4024, 4605, 4028, 4024, 3913, 3913, 4024, 3916, 4019, 4018, 4024, 5569, 5574, 4024, 3921, 4028, 3913, 4076, 4067, 4028,
+	4028, 4555, 4076, 4559, 4555, 4028, 4033, 4559, 4028, 4067, 4076, 4072, 4605, 4067, 2266, 2477, 2262, 2266, 2266, 2481, 2477, 2266, 2262, 4605,
+	2613, 2614, 2477, 2477, 2612, 2613, 2477, 2481, 2616, 2616, 2612, 2477, 2262, 2477, 2475, 2477, 1531, 1532, 2475, 2129, 2262, 2262, 2129, 4608,
+	4608, 4605, 2262, 4605, 4606, 4600, 4606, 4605, 4608, 4615, 4613, 4608, 2134, 4608, 2129, 2134, 4615, 4608, 4608, 4613, 4606, 2129, 2264, 2134,
+	2264, 2129, 2475, 2475, 2618, 2264, 2134, 2264, 2135, 2268, 2135, 2264, 2619, 2268, 2264, 2264, 2618, 2619, 2135, 4615, 2134, 2137, 4617, 4615,
+	4617, 4613, 4615, 4615, 2135, 2137, 2137, 2135, 2268, 2268, 2485, 2137, 2485, 2268, 2619, 2621, 2619, 2620, 2617, 2620, 2619, 2619, 2618, 2617,
+	2617, 2618, 2614, 2614, 2613, 2617, 2620, 2622, 2621, 2622, 2624, 2621, 2622, 3000, 2624, 3000, 2622, 2626, 2485, 2624, 2139, 2139, 2137, 2485,
+	2139, 4622, 2137, 892, 4617, 2137, 4995, 4617, 4998, 4998, 4617, 5672, 4626, 4623, 4617, 4626, 4617, 4622, 4626, 4622, 3009, 4622, 3008, 3009,
+	4527, 4626, 3009, 3009, 3008, 2902, 5272, 3009, 2902, 2899, 2902, 3008, 2906, 2899, 3008, 3008, 3000, 2906, 2902, 5270, 5272, 5270, 5268, 5272,
+	5272, 5268, 4527, 1510, 4527, 3107, 5268, 5677, 4527, 5454, 4527, 3403, 1515, 1510, 1514, 5678, 5677, 5522, 5719, 5677, 5678, 5668, 5677, 5719,
+	5520, 5683, 5678, 5678, 5009, 5721, 5009, 5678, 5683, 5522, 5520, 5678, 5678, 5721, 5719, 5520, 5522, 5524, 5524, 5139, 5520, 4600, 5520, 5139,
+	5520, 4600, 5683, 4018, 4019, 5524, 3916, 4018, 5524, 4606, 4603, 4600, 4603, 4606, 5009, 5722, 5721, 5009, 5009, 5003, 5004, 4993, 5003, 4989,
+	5001, 5003, 4993, 5003, 5001, 5004, 4993, 4992, 4999, 4999, 5000, 4993, 4989, 4992, 4993, 4993, 5000, 5001, 4989, 4995, 4992, 4998, 4999, 4992,
+	4992, 4995, 4998, 4999, 4998, 5668, 5672, 5668, 4998, 5719, 5715, 5668, 2998, 4638, 2906, 4638, 2998, 4637, 3964, 2998, 3000, 3000, 3963, 3964,
+	3000, 3133, 3127, 3135, 3127, 3133, 3141, 3135, 3133, 1532, 1531, 1535, 4559, 4033, 3921, 3921, 4800, 4559, 893, 4044, 1306, 4044, 4037, 4039,
+	3925, 3928, 4044, 3925, 4044, 4052, 4576, 4044, 4571, 4044, 5580, 5575, 5531, 4037, 3928, 4037, 5531, 4039, 5530, 5151, 5531, 5531, 5159, 5530,
+	5703, 5707, 5530, 5530, 5159, 5703, 5707, 4571, 5530, 5151, 5530, 4571, 4571, 4577, 4576, 4571, 4574, 4577, 4579, 4576, 4577, 4574, 5134, 4577,
+	4577, 4584, 4579, 2276, 4576, 4579, 4579, 4584, 4586, 4579, 2117, 2276, 2117, 4579, 2120, 4579, 4586, 2120, 4586, 4584, 4587, 4586, 4587, 2124,
+	2120, 4586, 2122, 2124, 2122, 4586, 2122, 2278, 2120, 2120, 2278, 2117, 2489, 2117, 2278, 2276, 2117, 2489, 4576, 2276, 2281, 2489, 2491, 2276,
+	2281, 2276, 2491, 2278, 2600, 2489, 2278, 2122, 2283, 2278, 2283, 2601, 2601, 2600, 2278, 2283, 2122, 2124, 2124, 2500, 2283, 2601, 2283, 2500,
+	2599, 2600, 2601, 2601, 2602, 2599, 2602, 2601, 2603, 2596, 2600, 2599, 2599, 2595, 2596, 2491, 2596, 2595, 2595, 2592, 2491, 2491, 2592, 2598,
+	2598, 2496, 2491, 2491, 2496, 2281, 2281, 4085, 4576, 4052, 4085, 4092, 4089, 4092, 4085, 3925, 4052, 3932, 4052, 4564, 4056, 4052, 4563, 4564,
+	4092, 4563, 4052, 3932, 4056, 4564, 4564, 4806, 3932, 1518, 1519, 2491, 1522, 1519, 1518, 2603, 2604, 2602, 2603, 2605, 2604, 2604, 2605, 2979,
+	2979, 2608, 2604, 2126, 2605, 2500, 2124, 4593, 2126, 2500, 2124, 2126, 2124, 4587, 4593, 4593, 4587, 4597, 4593, 2987, 2985, 4597, 2987, 4593,
+	5119, 4587, 5121, 5119, 5696, 4587, 4587, 4594, 4597, 5254, 4597, 4710, 4710, 5462, 3393, 5282, 4710, 4712, 4712, 4710, 5701, 2890, 2987, 5282,
+	5282, 5280, 2890, 5282, 4712, 5280, 2985, 2890, 2887, 2890, 2985, 2987, 2985, 2887, 2895, 2895, 2979, 2985, 2895, 4632, 2976, 3110, 3117, 2979,
+	2979, 2976, 3958, 3958, 3959, 2979, 4633, 2976, 4632, 3117, 3110, 3118, 3117, 3118, 3124, 5701, 5732, 5737, 5703, 5701, 5737, 5737, 5740, 5703,
+	5707, 5703, 5129, 5129, 5134, 5707, 5129, 5128, 5134, 5116, 5128, 5129, 5129, 5125, 5116, 5118, 5112, 5116, 5116, 5125, 5118, 5112, 5118, 5119,
+	5119, 5118, 5696, 1803, 1805, 5118, 1802, 5118, 1805, 5119, 5121, 5112, 5159, 2582, 2580, 910, 911, 916, 911, 910, 913, 916, 911, 915,
+	916, 915, 917, 917, 920, 916, 920, 917, 921, 923, 920, 921, 921, 924, 923, 924, 928, 923, 927, 923, 928, 927, 928, 931,
+	931, 932, 927, 931, 935, 932, 932, 935, 936, 937, 943, 939, 939, 940, 937, 943, 941, 939, 943, 947, 941, 948, 941, 947,
+	947, 950, 948, 950, 951, 948, 950, 955, 951, 955, 950, 954, 958, 955, 954, 954, 959, 958, 959, 962, 958, 959, 963, 962,
+	1043, 1039, 1042, 1043, 1042, 1044, 1044, 1045, 1043, 1044, 1049, 1045, 1044, 1048, 1049, 1051, 1049, 1048, 1074, 1069, 1073, 1073, 1075, 1074,
+	1074, 1075, 1077, 1077, 1078, 1074, 1078, 1077, 1079, 1198, 1200, 4546, 4548, 5292, 4546, 5292, 4628, 1209, 5292, 5289, 5291, 1207, 1668, 1209,
+	1667, 1668, 1664, 1665, 1667, 1664, 1609, 1664, 1611, 1664, 1615, 1611, 1615, 1664, 1620, 1611, 1622, 1609, 1609, 1622, 1625, 1625, 1626, 1609,
+	1620, 1621, 1615, 5289, 5290, 5291, 5221, 5223, 5289, 5234, 5221, 5289, 5236, 5234, 5289, 5289, 5237, 5236, 5223, 5221, 5226, 5226, 5227, 5223,
+	5226, 5231, 5227, 5232, 5233, 5227, 5227, 5231, 5232, 5836, 5837, 1222, 1222, 1227, 1226, 5837, 5843, 1222, 1227, 1222, 5843, 1231, 1222, 1234,
+	1226, 1234, 1222, 1222, 1231, 5850, 5850, 5836, 1222, 1230, 1226, 1227, 1227, 1231, 1230, 1231, 1227, 5843, 5843, 5850, 1231, 1234, 1230, 1231,
+	2532, 5429, 1309, 1309, 5429, 5431, 5431, 1312, 1309, 2529, 2532, 1309, 1309, 1317, 2529, 5428, 5425, 5429, 5425, 5428, 5426, 5425, 5426, 5424,
+	5419, 5424, 1317, 1317, 5424, 2529, 5419, 1317, 2519, 2519, 1317, 1325, 5415, 5416, 5419, 5415, 5413, 5416, 5412, 5416, 5413, 5413, 5411, 5412,
+	5410, 5412, 5411, 2511, 5410, 1331, 1331, 5410, 2515, 5410, 5407, 5408, 1334, 5408, 2511, 1331, 1334, 2511, 1331, 2515, 2517, 2517, 1325, 1331,
+	2517, 2519, 1325, 5408, 1334, 1336, 1336, 2507, 5408, 2209, 5408, 2927, 3044, 1336, 1342, 3044, 3031, 3046, 3046, 2209, 3044, 1342, 3031, 3044,
+	3046, 3325, 2209, 3325, 4250, 2209, 3046, 3031, 5439, 3325, 3046, 5439, 4274, 3325, 5439, 5431, 5439, 1347, 1347, 5439, 2866, 5439, 5441, 4274,
+	5441, 4272, 4274, 1347, 2866, 1342, 1347, 1312, 5431, 1387, 1390, 1389, 1391, 1389, 1390, 1395, 1391, 1390, 1399, 1391, 1395, 1395, 1397, 1399,
+	1399, 1397, 1401, 1404, 1399, 1401, 1401, 1405, 1404, 1404, 1405, 1409, 1525, 1527, 1526, 1528, 1526, 1527, 1539, 1540, 1538, 1540, 1539, 1541,
+	1569, 2373, 2434, 2434, 2190, 1569, 2381, 2373, 2385, 2386, 2381, 2385, 2190, 2434, 2188, 2188, 2183, 2190, 2179, 2190, 2183, 2431, 2188, 2434,
+	2183, 2188, 2427, 2431, 2427, 2188, 2427, 4480, 2183, 4480, 2416, 2183, 2184, 2178, 2183, 2179, 2183, 2178, 2184, 2183, 2416, 2416, 4480, 2420,
+	4480, 4478, 4475, 4481, 4485, 4480, 4485, 4486, 4480, 3189, 2184, 2416, 2416, 3194, 3189, 2420, 3194, 2416, 2184, 3189, 2178, 3190, 2178, 3189,
+	4452, 4457, 1580, 1580, 2760, 4452, 4457, 1980, 2241, 4463, 4457, 4462, 2230, 2241, 1980, 1984, 2230, 1980, 2241, 2237, 2760, 2237, 2241, 2230,
+	2401, 2760, 2229, 2237, 2229, 2760, 4419, 2760, 4414, 2229, 2237, 2230, 2230, 2223, 2229, 2239, 2230, 1984, 1984, 1987, 2239, 3253, 2229, 2223,
+	2229, 3253, 2399, 2399, 2401, 2229, 2223, 2224, 3253, 2224, 1975, 3253, 4419, 4414, 4411, 4411, 4412, 4419, 4961, 1785, 4869, 4869, 4960, 4961,
+	4869, 4867, 4870, 4869, 4870, 4860, 4867, 4859, 4862, 4867, 4862, 4880, 4880, 4881, 4867, 4859, 1813, 1816, 1816, 4857, 4859, 4858, 4859, 4860,
+	4859, 4858, 4862, 4876, 4860, 4870, 4870, 4877, 4876, 1791, 1786, 1790, 1796, 1792, 1797, 2092, 1841, 1838, 1838, 2098, 2092, 2092, 1844, 1841,
+	2098, 2100, 2092, 2100, 2335, 2092, 2092, 2335, 4007, 4016, 2092, 4007, 2100, 2098, 2104, 2100, 2339, 2335, 2108, 2339, 2100, 2100, 2104, 2108,
+	4015, 4007, 2335, 2339, 3075, 2335, 4247, 4244, 2335, 4007, 4017, 4016, 3074, 3075, 2339, 3074, 2108, 3080, 2916, 3074, 2922, 1856, 1861, 1853,
+	3510, 1853, 1861, 1853, 3531, 1856, 1853, 3510, 3517, 3517, 3521, 1853, 3531, 1853, 3521, 1861, 1856, 1868, 1868, 1874, 1861, 1861, 1873, 3510,
+	1873, 1861, 1874, 3510, 3500, 3499, 3500, 3510, 1873, 3510, 3499, 3503, 3503, 3517, 3510, 1874, 1881, 1873, 1881, 3500, 1873, 1874, 1868, 1869,
+	1874, 3525, 1881, 3514, 1881, 3525, 1881, 3514, 3548, 1881, 3548, 3549, 3549, 3550, 1881, 3525, 3515, 3514, 3522, 3515, 3525, 3533, 3522, 3525,
+	3525, 3535, 3533, 3535, 3525, 3542, 3548, 3514, 3508, 3508, 3514, 3515, 3508, 3507, 3548, 3507, 3506, 3548, 3507, 3508, 3503, 3517, 3503, 3508,
+	3517, 3508, 3515, 3515, 3522, 3517, 3526, 3517, 3522, 3522, 3533, 3526, 3532, 3526, 3533, 3533, 3537, 3532, 3537, 3533, 3535, 3535, 5477, 3537,
+	3542, 5477, 3535, 3537, 3531, 3532, 3526, 3532, 3531, 3521, 3517, 3526, 3531, 3521, 3526, 3503, 3499, 3501, 3501, 3505, 3503, 3503, 3505, 3507,
+	3506, 3507, 3505, 3501, 3500, 3506, 3506, 3505, 3501, 3500, 3501, 3499, 1948, 1952, 1950, 1948, 1963, 1952, 1948, 1950, 1954, 1954, 1955, 1948,
+	1964, 1952, 1963, 1963, 1965, 1964, 1958, 1955, 1954, 1958, 1954, 1960, 1960, 1961, 1958, 1992, 1993, 1994, 1993, 1992, 1996, 1997, 1992, 1994,
+	1996, 1992, 1997, 1996, 2005, 1993, 2005, 1996, 1999, 1997, 2000, 1996, 1999, 1996, 2000, 1994, 2001, 1997, 1997, 2012, 2000, 2012, 1997, 2001,
+	1994, 2046, 2044, 2051, 2046, 1994, 1994, 2060, 2051, 1994, 2044, 2001, 2001, 2044, 2012, 2012, 2044, 2043, 2043, 2041, 2012, 2012, 2023, 2011,
+	2023, 2012, 2041, 2000, 2012, 2011, 2011, 2004, 2000, 2000, 2004, 1999, 2004, 2011, 2013, 2013, 2011, 2023, 2023, 2024, 2013, 2024, 2023, 2028,
+	2041, 2028, 2023, 2041, 2043, 2048, 2028, 2041, 2032, 2048, 2032, 2041, 2043, 2044, 2046, 2046, 2048, 2043, 2049, 2048, 2046, 2049, 2036, 2048,
+	2046, 2051, 2049, 2036, 2035, 2029, 2037, 2035, 2036, 2029, 2033, 2036, 2029, 2035, 2026, 2025, 2026, 2035, 2035, 2037, 2025, 2028, 2029, 2024,
+	2033, 2029, 2028, 2026, 2024, 2029, 2022, 2013, 2024, 2024, 2026, 2022, 2022, 2026, 2025, 2022, 2025, 5250, 2008, 2013, 2022, 2022, 5250, 2008,
+	5250, 2006, 2008, 2004, 2013, 2008, 2004, 2008, 2006, 2006, 1999, 2004, 2006, 2005, 1999, 2032, 2033, 2028, 2154, 2161, 2064, 2068, 2064, 2069,
+	2064, 2161, 2165, 2165, 2069, 2064, 2150, 2064, 2072, 2154, 2064, 2150, 2068, 2072, 2064, 2069, 2080, 2068, 2069, 2165, 2967, 2080, 2069, 2967,
+	2966, 2967, 2165, 2080, 2967, 2084, 2813, 2967, 2175, 2967, 2973, 2972, 2072, 2149, 2150, 2322, 2323, 2321, 2326, 2323, 2322, 2322, 2327, 2326,
+	2362, 2363, 2366, 5104, 2366, 5092, 2366, 2368, 5092, 5092, 5095, 5104, 5070, 5092, 5098, 5092, 5070, 5083, 5092, 5083, 5095, 5092, 2368, 5098,
+	5095, 5083, 5088, 5083, 5070, 5082, 5083, 5082, 5086, 5083, 5086, 5088, 5064, 5070, 5098, 5064, 5069, 5070, 5070, 5069, 5073, 5073, 5082, 5070,
+	5101, 5064, 5098, 5080, 5082, 5073, 5082, 5080, 5081, 5090, 5086, 5082, 5082, 5081, 5090, 5086, 5090, 5091, 5091, 5088, 5086, 5073, 5077, 5080,
+	5073, 5069, 5077, 2371, 2375, 2376, 5049, 2371, 5045, 5045, 2371, 5051, 2375, 2379, 2376, 2379, 2380, 2376, 5045, 5051, 5054, 5054, 5053, 5045,
+	5034, 5053, 5039, 5053, 5034, 5045, 5033, 5022, 5034, 5034, 5037, 5033, 5039, 5037, 5034, 5034, 5022, 5045, 5037, 5039, 5043, 5033, 5037, 5042,
+	5037, 5043, 5042, 5033, 5020, 5022, 5020, 5033, 5025, 5025, 5033, 5030, 5032, 5030, 5033, 5042, 5032, 5033, 5022, 5020, 5045, 5020, 5018, 5045,
+	5026, 5018, 5020, 5026, 5020, 5025, 5025, 5028, 5026, 5025, 5030, 5028, 5045, 5018, 5057, 5057, 5049, 5045, 2388, 2683, 2687, 2693, 2689, 2394,
+	2445, 3683, 4218, 3683, 2445, 3697, 4219, 3694, 2445, 2445, 4218, 4219, 2445, 3694, 3697, 3697, 3689, 3683, 3683, 3689, 3679, 4218, 3683, 3679,
+	4218, 3679, 4211, 4211, 3679, 3689, 3689, 2768, 4211, 3674, 4211, 2768, 3674, 4206, 4211, 3658, 3652, 2768, 3662, 3674, 2768, 3652, 3662, 2768,
+	4206, 3674, 3662, 3662, 3652, 4206, 4201, 4206, 3652, 3652, 4193, 4200, 4201, 3652, 4200, 3652, 3658, 4193, 3647, 4193, 3658, 3638, 3647, 3658,
+	3658, 3637, 3638, 4741, 4189, 4193, 4193, 3647, 3648, 3647, 3638, 4189, 4189, 3648, 3647, 3638, 3637, 4189, 3637, 2549, 2551, 2551, 4189, 3637,
+	3632, 2549, 3637, 4179, 4189, 2551, 2549, 4179, 2551, 2549, 3632, 4179, 4179, 3632, 4178, 3632, 3628, 4178, 4174, 4178, 3628, 4174, 3628, 4103,
+	3628, 3841, 4103, 3694, 3698, 3697, 3698, 3719, 3697, 3698, 3694, 4219, 4219, 4224, 3698, 3709, 3698, 4224, 3698, 3709, 3719, 4233, 3719, 3715,
+	3719, 4233, 3749, 3749, 3748, 3719, 3709, 3715, 3719, 4229, 3715, 3709, 4224, 4225, 3709, 3709, 4225, 4229, 4233, 3715, 4229, 4235, 3749, 4233,
+	4426, 3749, 4235, 4235, 4240, 4426, 2677, 2584, 2681, 2675, 2590, 2671, 2908, 2909, 2910, 3103, 3099, 3100, 3100, 3102, 3103, 3142, 3143, 3144,
+	3144, 3410, 3142, 3152, 3153, 3154, 3154, 3155, 3152, 4553, 3168, 3552, 3552, 4832, 4553, 3205, 3206, 3207, 3213, 3214, 3207, 3255, 4430, 4427,
+	4427, 3258, 3255, 4521, 3259, 3383, 3383, 4520, 4521, 4509, 3321, 4508, 4509, 5990, 5993, 6001, 4509, 5993, 5990, 5995, 5992, 5992, 5993, 5990,
+	5993, 5999, 6001, 5999, 6000, 6001, 5999, 5997, 5998, 5998, 6000, 5999, 5998, 5997, 5992, 5992, 5995, 5998, 3348, 3349, 3350, 3351, 3352, 3348,
+	3348, 3350, 3351, 3423, 3452, 4291, 4293, 3423, 4291, 3452, 3423, 3454, 3458, 3454, 3423, 3423, 3429, 3458, 4296, 3423, 4293, 4296, 3429, 3423,
+	4291, 3452, 3426, 4306, 3426, 3452, 3452, 3450, 4306, 3426, 4297, 4291, 4291, 4297, 4298, 4291, 4298, 4293, 4297, 3426, 4306, 4298, 4297, 4306,
+	4309, 4298, 4306, 4306, 3487, 4309, 3487, 4306, 3476, 3468, 3476, 4306, 4306, 3450, 3437, 4306, 3437, 3468, 3449, 3437, 3450, 3437, 3445, 3466,
+	3466, 3468, 3437, 3460, 3445, 3437, 3437, 3449, 3460, 3466, 3471, 3468, 3476, 3468, 3471, 3471, 3475, 3476, 3475, 3477, 3476, 3481, 3476, 3477,
+	3476, 3481, 3487, 3489, 4309, 3487, 3481, 3488, 3487, 3477, 3480, 3481, 3488, 3481, 3480, 3477, 3475, 3474, 3474, 4402, 3477, 3480, 3477, 4402,
+	3475, 3471, 3473, 3473, 3474, 3475, 3473, 3471, 3466, 3466, 3467, 3473, 3466, 3445, 3467, 3445, 3458, 3467, 3462, 3458, 3445, 3458, 3457, 3454,
+	3445, 3460, 3462, 3462, 4144, 4145, 4145, 3457, 3462, 4156, 3462, 3457, 4381, 4144, 4140, 4381, 4145, 4144, 4360, 4381, 4349, 4359, 4349, 4381,
+	4360, 4380, 4381, 4382, 4369, 4381, 4140, 4142, 4381, 4141, 4142, 4140, 4380, 4351, 4352, 4351, 4380, 4350, 4380, 4360, 4350, 4352, 4364, 4380,
+	4379, 4380, 4364, 4349, 4350, 4360, 4339, 4350, 4349, 4345, 4350, 4339, 4350, 4345, 4351, 4351, 4345, 4352, 4340, 4352, 4345, 4398, 4375, 4352,
+	4364, 4352, 4375, 4341, 4398, 4352, 4352, 4340, 4341, 4375, 4376, 4364, 4379, 4364, 4376, 4376, 3990, 4379, 4376, 4375, 4386, 4386, 3990, 4376,
+	4394, 4386, 4375, 4375, 4398, 4394, 4398, 4396, 4394, 4400, 4396, 4398, 4402, 4400, 4398, 4398, 4341, 4402, 4404, 4402, 4341, 4408, 4404, 4341,
+	4340, 4410, 4341, 4408, 4341, 4410, 4402, 3493, 3480, 4402, 4401, 4400, 4402, 4404, 3493, 4396, 4400, 4401, 4394, 4396, 4397, 4401, 4397, 4396,
+	4397, 4390, 4394, 4387, 4386, 4394, 4394, 4390, 4387, 3990, 4386, 4387, 4387, 3989, 3990, 3480, 3493, 3488, 4404, 4408, 3493, 4333, 4325, 4410,
+	4410, 4340, 4333, 4325, 4333, 4329, 4339, 4329, 4333, 4333, 4345, 4339, 4345, 4333, 4340, 4336, 4320, 4325, 4325, 4329, 4336, 4329, 4339, 4336,
+	4349, 4336, 4339, 4320, 4336, 4303, 4301, 4303, 4336, 4294, 4301, 4336, 4296, 4294, 4336, 4336, 4349, 4296, 4303, 4318, 4320, 4298, 4309, 4303,
+	4303, 4293, 4298, 3489, 4303, 4309, 4318, 4303, 3489, 4303, 4301, 4293, 4301, 4294, 4293, 4294, 4296, 4293, 4349, 4359, 4296, 4150, 4152, 4156,
+	4152, 4150, 4151, 3556, 5162, 3558, 3849, 3854, 3865, 3853, 3849, 3865, 3862, 3853, 3865, 3866, 3862, 3865, 3870, 3859, 3853, 3870, 3853, 3862,
+	3862, 3866, 3871, 3862, 3871, 3870, 3872, 3878, 3875, 4060, 4061, 4062, 4062, 4063, 4060, 4064, 4065, 4060, 4060, 4063, 4064, 4111, 4108, 4106,
+	4106, 4110, 4111, 4108, 4122, 4106, 4111, 4110, 4115, 4115, 4116, 4111, 4116, 4115, 4119, 4119, 4120, 4116, 4122, 4108, 4126, 4126, 4128, 4122,
+	4131, 4128, 4126, 4131, 4130, 4128, 4283, 4281, 4278, 4435, 4436, 4431, 4444, 4446, 4443, 4446, 4444, 4447, 4447, 4449, 4446, 4466, 4468, 4465,
+	4468, 4470, 4465, 4470, 4468, 4473, 4473, 4474, 4470, 4487, 4488, 4489, 4489, 4490, 4487, 4491, 4488, 4487, 4487, 4492, 4491, 4811, 4812, 4813,
+	4813, 4814, 4811, 4813, 4812, 4815, 4815, 4816, 4813, 4817, 4818, 4819, 4819, 4820, 4817, 4821, 4820, 4819, 4819, 4822, 4821, 4823, 4824, 4825,
+	4825, 4826, 4823, 4827, 4828, 4829, 4829, 4830, 4827, 4965, 4966, 4967, 4967, 4975, 4965, 4965, 4975, 4970, 4970, 4971, 4965, 4975, 4967, 4973,
+	4972, 4970, 4975, 4980, 4977, 4978, 4978, 4988, 4980, 4985, 4980, 4988, 4978, 4982, 4984, 4984, 4988, 4978, 4988, 4984, 4987, 5180, 5182, 5176,
+	5197, 5194, 5192, 5465, 5466, 5467, 5467, 5468, 5465, 5465, 5468, 5469, 5469, 5472, 5465, 5535, 5928, 5537, 5537, 5541, 5535, 5543, 5535, 5541,
+	5926, 5537, 5928, 5928, 5930, 5926, 5541, 5537, 5548, 5920, 5548, 5537, 5921, 5920, 5537, 5537, 5926, 5921, 5548, 5543, 5541, 5920, 5916, 5548,
+	5916, 5915, 5548, 5916, 5920, 5921, 5921, 5917, 5916, 5923, 5917, 5921, 5926, 5927, 5921, 5921, 5927, 5923, 5927, 5926, 5934, 5932, 5934, 5926,
+	5930, 5932, 5926, 5923, 5927, 5935, 5934, 5935, 5927, 5951, 5917, 5923, 5923, 5935, 5940, 5951, 5923, 5940, 5915, 5916, 5917, 5917, 5951, 5915,
+	5940, 5935, 5941, 5941, 5948, 5940, 5935, 5934, 5938, 5941, 5935, 5938, 5938, 5934, 5932, 5932, 5937, 5938, 5945, 5941, 5938, 5938, 5937, 5945,
+	5948, 5941, 5945, 5605, 5606, 5607, 5607, 5609, 5605, 5623, 5627, 5625, 5623, 5628, 5627, 5690, 5691, 5688, 5854, 5855, 5856, 5858, 5854, 5856,
+	5856, 5859, 5858, 19, 1260, 26, 489, 4658, 19, 4657, 19, 4658, 26, 1260, 5, 5, 1091, 26, 985, 5, 4657, 1091, 5, 9,
+	985, 4657, 981, 4657, 4658, 4670, 9, 981, 1096, 4682, 4672, 981, 981, 4680, 4682, 1096, 1091, 9, 4691, 1086, 1091, 4691, 1083, 1086,
+	1083, 4691, 489, 4691, 4682, 4680, 6029, 6031, 4670, 6029, 6022, 6031, 6029, 4700, 6022, 106, 93, 92, 92, 117, 106, 126, 117, 92,
+	92, 137, 126, 130, 137, 92, 92, 93, 130, 5956, 106, 3821, 93, 106, 5956, 3821, 106, 117, 5956, 5964, 93, 93, 5964, 130,
+	130, 5976, 137, 130, 5964, 5976, 137, 5976, 5984, 126, 137, 5984, 117, 126, 3821, 3821, 126, 5984, 5956, 3821, 2947, 5952, 3821, 5984,
+	284, 282, 206, 4116, 284, 206, 206, 211, 4116, 236, 206, 282, 282, 278, 236, 278, 228, 236, 228, 226, 236, 236, 226, 222,
+	853, 854, 236, 278, 273, 228, 943, 228, 939, 943, 947, 228, 948, 228, 947, 937, 943, 939, 939, 5940, 5945, 5926, 5940, 5927,
+	4122, 5927, 5940, 5940, 5926, 5945, 5945, 5926, 5932, 5932, 5937, 5945, 5926, 5537, 5928, 5928, 5930, 5926, 5537, 5926, 5921, 5926, 5927, 5921,
+	5930, 5932, 5926, 4122, 5921, 5927, 4110, 4122, 4106, 4126, 4130, 4122, 5921, 4122, 4110, 5548, 5537, 5921, 4110, 5548, 5921, 5535, 5928, 5537,
+	5537, 5543, 5535, 5543, 5537, 5548, 947, 950, 948, 950, 955, 948, 955, 950, 954, 959, 955, 954, 959, 963, 962, 1401, 959, 1404,
+	1404, 959, 1409, 1399, 1395, 1401, 1404, 1399, 1401, 1399, 1391, 1395, 1395, 1391, 1389, 211, 854, 853, 221, 215, 211, 221, 211, 222,
+	293, 211, 215, 211, 293, 4116, 222, 226, 221, 4119, 4120, 4116, 739, 243, 1362, 243, 868, 247, 3312, 266, 739, 739, 736, 3795,
+	3308, 3312, 5868, 5900, 5868, 3312, 3312, 3796, 3795, 3795, 3806, 3807, 1074, 1364, 3796, 3796, 1077, 1074, 1077, 1079, 1074, 1364, 1367, 1362,
+	1367, 1364, 1366, 1367, 1366, 1373, 1373, 1372, 1367, 1376, 1372, 1373, 1376, 1373, 1380, 253, 260, 1380, 1380, 260, 732, 247, 250, 253,
+	250, 260, 253, 260, 722, 732, 722, 260, 266, 867, 868, 260, 266, 721, 722, 867, 247, 868, 5873, 3308, 5868, 5868, 5863, 5878,
+	5868, 5900, 5863, 5878, 5873, 5868, 5886, 3308, 5873, 5873, 5878, 5886, 3306, 3308, 3302, 5878, 935, 5886, 5878, 5866, 5881, 5878, 5881, 935,
+	5866, 5878, 5863, 931, 935, 932, 927, 928, 931, 931, 932, 927, 927, 923, 928, 924, 928, 923, 923, 920, 924, 920, 917, 924,
+	917, 920, 916, 916, 911, 917, 913, 911, 916, 5863, 5861, 5866, 5864, 5861, 5863, 5863, 5869, 5864, 5869, 5863, 5900, 5869, 5908, 5864,
+	5869, 5900, 5913, 5913, 5908, 5869, 746, 752, 296, 752, 760, 296, 771, 296, 760, 1182, 746, 296, 746, 5175, 752, 388, 5175, 746,
+	1156, 2557, 746, 771, 1769, 746, 2704, 757, 752, 5169, 757, 2704, 2713, 2704, 2774, 2704, 2773, 2774, 2704, 1421, 2773, 757, 5169, 405,
+	5165, 405, 5169, 405, 5165, 1451, 405, 1451, 1457, 1501, 405, 1457, 1501, 765, 405, 5165, 2719, 1451, 5590, 1451, 2719, 1451, 5590, 5594,
+	1457, 1451, 5199, 2746, 5199, 1451, 1451, 5594, 2746, 1501, 1457, 2756, 1457, 1472, 1493, 2749, 1472, 1457, 3354, 1457, 1493, 2756, 765, 1501,
+	765, 2756, 1493, 771, 765, 1493, 1493, 1482, 1487, 1487, 771, 1493, 2841, 1493, 1472, 1493, 3372, 1482, 776, 771, 1487, 1769, 771, 776,
+	1487, 1482, 776, 5597, 5601, 1482, 5601, 422, 1482, 2841, 5597, 1482, 5597, 2841, 1472, 5594, 5597, 1472, 1472, 2746, 5594, 2749, 3365, 1472,
+	2562, 1769, 776, 776, 5555, 2562, 781, 5555, 776, 388, 2562, 1421, 388, 1421, 5175, 5586, 1421, 5584, 1467, 3093, 1421, 1467, 1421, 5586,
+	1467, 5586, 5590, 3093, 1467, 2715, 1467, 2719, 2715, 2715, 3096, 3093, 2774, 2715, 2713, 5188, 5590, 5191, 2557, 1156, 1164, 1175, 1182, 760,
+	1167, 760, 1150, 322, 317, 5815, 5822, 5815, 317, 5800, 317, 322, 323, 5822, 317, 317, 5800, 323, 5815, 5810, 322, 5800, 322, 5810,
+	5800, 336, 323, 5822, 323, 336, 336, 5831, 5822, 5785, 346, 353, 346, 5785, 5775, 353, 346, 5765, 351, 5765, 346, 346, 5775, 351,
+	353, 5793, 5785, 5793, 353, 5765, 351, 366, 5765, 366, 351, 5775, 366, 5775, 5772, 452, 446, 458, 481, 810, 1144, 806, 810, 481,
+	481, 692, 806, 792, 1144, 810, 4439, 692, 1547, 692, 698, 694, 698, 692, 710, 692, 709, 710, 1547, 1551, 4439, 1551, 3272, 4439,
+	3935, 4439, 3272, 1551, 1547, 1550, 1551, 5448, 5666, 1550, 1555, 1551, 1551, 5666, 4915, 1550, 5449, 5448, 5448, 1555, 1550, 5447, 4926, 5448,
+	5448, 5449, 5447, 4923, 4926, 4931, 4926, 1698, 4931, 4914, 4915, 4926, 4926, 4923, 4914, 4953, 4923, 4931, 4923, 4953, 4914, 4950, 4931, 4935,
+	4931, 4950, 4953, 1698, 4935, 4931, 1710, 4935, 1698, 2951, 4942, 4935, 4942, 4950, 4935, 4950, 4942, 485, 485, 3569, 5627, 3569, 4449, 4443,
+	4449, 3569, 3576, 4955, 4914, 4953, 4918, 4914, 4955, 3272, 4843, 3935, 3980, 3935, 4843, 4843, 3985, 3980, 658, 646, 663, 663, 646, 665,
+	658, 663, 666, 666, 663, 655, 655, 660, 666, 678, 669, 680, 678, 687, 669, 689, 678, 680, 689, 682, 678, 794, 4495, 4505,
+	4501, 794, 4505, 4505, 4507, 4501, 816, 824, 3871, 816, 819, 1004, 824, 816, 1004, 1296, 824, 1004, 838, 1296, 1004, 1296, 838, 2294,
+	2292, 1296, 2294, 2294, 2303, 2292, 2294, 2697, 2303, 3886, 2697, 2294, 1907, 825, 2292, 2295, 2292, 2303, 2295, 1907, 2292, 2303, 2304, 2295,
+	2310, 2304, 2303, 5561, 2310, 2303, 2295, 2304, 1907, 1902, 825, 1907, 2310, 1907, 2304, 5360, 1907, 2310, 5360, 5366, 825, 5360, 5362, 5345,
+	5362, 5360, 2310, 5366, 5360, 5345, 5561, 5362, 2310, 5362, 5561, 5389, 5345, 5362, 5397, 5397, 5362, 5389, 5366, 5345, 5334, 5389, 5393, 5397,
+	3811, 3947, 3886, 4792, 3947, 3811, 4792, 3811, 3774, 3770, 3774, 3811, 3871, 1277, 1272, 3862, 3866, 3871, 3862, 3871, 3859, 1276, 1272, 1277,
+	3859, 3849, 3862, 3862, 3849, 4065, 3866, 3862, 4065, 4065, 4061, 4062, 4491, 4065, 4492, 1044, 1049, 1043, 1044, 1051, 1049, 1198, 1200, 4546,
+	4548, 5292, 4546, 5292, 4628, 1209, 5292, 5289, 5291, 1207, 1668, 1209, 1667, 1668, 1664, 1665, 1667, 1664, 1664, 1622, 1665, 1665, 1622, 1625,
+	5289, 5290, 5291, 5236, 5221, 5289, 5289, 5221, 5226, 5226, 5290, 5289, 5290, 5226, 5232, 5837, 5843, 1230, 1231, 5837, 1230, 5843, 1231, 1230,
+	5837, 1231, 5850, 5843, 5850, 1231, 1317, 5429, 1309, 1347, 1309, 5429, 5425, 5429, 1317, 5416, 5425, 1317, 5416, 1317, 1325, 5429, 5441, 1347,
+	2209, 1347, 3046, 1336, 1347, 2209, 3046, 1347, 5441, 3325, 3046, 5441, 5441, 4272, 4276, 3046, 3325, 2209, 3325, 4250, 2209, 4264, 1331, 1336,
+	1331, 5412, 1325, 5412, 5416, 1325, 1522, 1519, 2491, 2491, 4579, 2600, 4579, 2491, 4052, 2491, 2596, 2592, 2491, 2592, 2598, 2598, 4052, 2491,
+	4044, 4577, 4579, 4577, 4584, 4579, 4579, 4584, 4586, 4586, 2600, 4579, 4052, 4085, 4579, 2601, 2600, 4586, 2599, 2600, 2601, 2596, 2600, 2599,
+	2599, 2592, 2596, 2601, 2604, 2599, 2124, 2601, 4586, 2124, 2603, 2601, 2604, 2601, 2603, 4586, 4584, 4587, 4586, 4587, 2124, 2124, 4587, 2985,
+	2603, 2124, 2985, 2603, 2979, 2604, 2985, 2979, 2603, 2979, 2608, 2604, 2895, 2979, 2985, 2979, 2895, 3959, 2985, 4587, 4710, 4710, 5531, 2985,
+	2985, 5280, 2887, 2985, 2887, 2895, 5119, 4587, 5121, 5119, 4710, 4587, 5280, 4710, 5125, 5531, 5125, 5530, 5129, 5125, 5116, 5116, 5125, 5119,
+	5125, 1805, 5119, 3925, 5531, 4044, 5530, 4044, 5531, 4044, 5530, 4577, 5530, 5134, 4577, 5737, 5740, 5530, 5129, 5134, 5530, 5116, 5134, 5129,
+	5119, 5121, 5116, 3925, 4044, 4052, 3925, 4052, 3932, 4052, 4564, 3932, 4052, 4563, 4564, 4564, 4806, 3932, 4977, 2895, 4632, 4980, 4977, 4978,
+	4978, 4988, 4980, 4978, 4982, 4984, 4984, 4988, 4978, 2477, 1531, 1535, 4028, 2477, 4608, 2612, 2614, 2477, 2477, 4028, 2616, 2616, 2612, 2477,
+	2618, 4608, 2477, 4028, 4024, 3913, 3921, 4028, 3913, 4559, 4555, 4028, 3921, 4559, 4028, 4608, 4067, 4028, 3913, 4024, 5524, 4608, 4606, 4024,
+	5524, 4024, 5009, 4606, 5009, 4024, 5524, 4527, 3008, 5721, 5719, 5524, 5524, 5009, 5721, 5003, 5001, 5009, 5003, 4989, 4998, 4998, 5000, 5003,
+	5003, 5000, 5001, 4989, 4995, 4998, 4995, 4617, 4998, 4617, 4527, 4998, 2137, 4617, 4613, 4626, 4617, 2137, 4617, 1792, 1797, 4613, 2619, 2137,
+	2619, 2621, 2137, 3008, 2137, 2621, 3008, 4626, 2137, 4608, 4613, 4606, 2619, 4613, 4608, 4608, 2618, 2619, 2621, 2619, 2622, 2617, 2622, 2619,
+	2619, 2618, 2617, 2622, 3000, 2621, 2621, 3000, 3008, 4527, 4626, 3008, 2899, 5270, 3008, 2906, 2899, 3008, 3008, 3000, 2906, 3000, 2622, 2626,
+	3963, 2906, 3000, 4638, 2906, 4966, 4965, 4966, 4967, 4967, 4975, 4965, 4965, 4975, 4970, 4970, 4971, 4965, 5270, 5719, 4527, 5719, 5710, 4527,
+	2617, 2618, 2614, 2614, 2612, 2617, 3921, 4800, 4559, 2431, 2190, 1569, 2183, 2190, 2431, 2431, 4480, 2183, 2179, 2190, 2183, 4480, 3194, 2183,
+	2179, 2183, 3190, 3190, 2183, 3194, 3194, 4480, 4478, 4961, 1785, 4869, 4869, 4960, 4961, 4869, 4824, 4825, 4825, 4860, 4869, 4859, 1813, 1816,
+	1948, 1952, 1813, 1813, 1955, 1948, 1955, 1813, 1960, 4859, 4830, 4867, 1816, 4857, 4859, 4830, 4859, 4829, 1960, 1961, 1955, 1964, 1952, 1948,
+	1948, 1965, 1964, 1838, 2098, 2092, 2092, 2380, 1838, 2092, 2098, 2104, 4017, 2092, 4007, 2092, 2339, 4007, 3080, 2339, 2092, 2092, 2104, 3080,
+	2339, 4244, 4007, 1868, 1861, 1853, 3510, 1853, 1861, 1853, 3531, 1868, 1853, 3510, 3517, 3531, 1853, 3517, 1868, 1874, 1861, 3535, 1868, 3537,
+	3542, 1868, 3535, 1861, 1881, 3510, 1881, 1861, 1874, 3510, 3500, 3499, 3500, 3510, 1881, 3510, 3499, 3503, 3503, 3517, 3510, 1874, 3522, 1881,
+	3514, 1881, 3522, 1881, 3514, 3548, 3548, 3550, 1881, 3535, 3522, 3542, 3514, 3522, 3517, 3526, 3517, 3522, 3522, 3535, 3526, 3537, 3526, 3535,
+	3526, 3537, 3531, 3531, 3517, 3526, 3517, 3503, 3508, 3517, 3508, 3514, 3507, 3508, 3503, 3503, 3499, 3500, 3500, 3506, 3503, 3503, 3506, 3507,
+	3548, 3514, 3508, 3508, 3507, 3548, 3507, 3506, 3548, 2230, 4457, 1980, 2323, 2230, 1980, 2229, 4457, 2230, 2230, 2223, 2229, 2323, 1987, 2230,
+	4452, 4457, 2229, 3253, 2229, 2223, 2229, 3253, 2399, 2399, 4452, 2229, 2223, 3206, 3253, 1997, 1993, 1994, 1996, 1993, 1997, 1996, 2005, 1993,
+	1997, 2000, 1996, 1997, 2012, 2000, 2012, 1997, 1994, 1994, 2046, 2044, 2051, 2046, 1994, 1994, 2060, 2051, 1994, 2044, 2012, 2012, 2044, 2048,
+	2048, 2041, 2012, 2012, 2023, 2011, 2023, 2012, 2041, 2000, 2012, 2011, 2005, 1996, 2000, 2011, 2004, 2000, 2000, 2004, 2005, 2006, 2005, 2004,
+	2004, 2011, 2013, 2004, 2013, 2006, 2013, 2011, 2023, 2023, 2024, 2013, 2024, 2023, 2028, 2041, 2028, 2023, 2028, 2041, 2048, 2028, 2029, 2024,
+	2036, 2029, 2028, 2048, 2036, 2028, 2035, 2024, 2029, 5250, 2013, 2024, 2024, 2035, 5250, 2006, 2013, 5250, 5250, 2035, 2025, 2036, 2035, 2029,
+	2037, 2035, 2036, 2035, 2037, 2025, 2049, 2036, 2048, 2049, 2048, 2046, 2046, 2051, 2049, 2048, 2044, 2046, 2154, 4468, 2064, 2064, 4468, 2165,
+	2150, 2064, 2068, 2154, 2064, 2150, 2064, 2080, 2068, 2064, 2165, 2967, 2080, 2064, 2967, 2068, 2149, 2150, 2080, 2967, 2973, 5037, 5039, 2205,
+	5033, 5037, 2205, 2205, 5032, 5033, 5022, 5037, 5033, 5039, 5037, 5022, 5022, 5053, 5039, 5053, 5022, 5045, 5022, 5018, 5045, 5026, 5018, 5022,
+	5026, 5022, 5033, 5033, 5028, 5026, 5033, 5032, 5028, 5045, 5018, 4485, 5045, 2371, 5054, 5054, 5053, 5045, 4485, 2371, 5045, 4465, 2366, 5092,
+	2366, 2368, 5092, 5092, 5095, 4465, 5070, 5092, 5098, 5092, 5070, 5095, 5092, 2368, 5098, 5095, 5070, 4281, 5070, 5081, 5090, 5070, 5090, 4281,
+	5064, 5070, 5098, 5064, 5069, 5070, 5070, 5069, 5080, 5080, 5081, 5070, 4463, 5064, 5098, 5080, 5069, 4411, 3637, 2549, 4189, 2549, 4179, 4189,
+	2549, 3637, 4179, 3658, 3637, 4189, 3637, 3841, 4179, 4193, 3647, 4189, 3647, 3658, 4189, 3658, 3652, 2768, 3652, 3658, 4193, 3647, 4193, 3658,
+	3652, 4193, 4200, 3652, 3674, 2768, 3674, 3652, 4206, 4200, 4206, 3652, 3689, 2768, 4211, 3674, 4211, 2768, 3674, 4206, 4211, 4218, 3689, 4211,
+	3689, 4218, 3697, 4219, 3697, 4218, 4224, 3748, 3697, 4224, 3697, 4219, 4229, 3748, 4224, 4233, 3748, 4229, 4240, 3748, 4233, 4426, 3748, 4240,
+	4103, 4179, 3841, 3103, 3099, 3100, 3100, 3102, 3103, 5691, 3143, 3144, 3144, 3410, 5691, 3152, 3153, 3154, 3154, 3155, 3152, 4553, 3168, 4552,
+	3255, 4430, 4427, 3351, 3352, 3348, 3348, 3349, 3351, 3423, 3452, 4291, 4293, 3423, 4291, 3452, 3423, 3457, 3423, 4359, 3457, 4359, 3423, 4293,
+	3452, 3450, 4306, 3452, 4298, 4291, 4298, 3452, 4306, 4291, 4298, 4293, 4293, 4303, 4336, 4294, 4293, 4336, 4303, 4293, 4298, 4294, 4359, 4293,
+	4359, 4349, 4380, 4359, 4294, 4336, 4336, 4349, 4359, 4336, 4318, 4325, 4325, 4339, 4336, 4349, 4336, 4339, 4318, 4336, 4303, 4298, 3487, 4303,
+	4318, 4303, 3487, 3487, 4298, 4306, 3487, 4306, 3476, 4306, 3450, 3476, 3476, 3488, 3487, 3445, 3476, 3450, 3445, 3471, 3476, 3471, 3475, 3476,
+	3475, 3477, 3476, 3488, 3476, 3477, 3488, 3477, 4402, 4402, 3493, 3488, 3477, 3475, 3474, 3474, 4402, 3477, 3475, 3471, 3473, 3473, 3474, 3475,
+	3473, 3471, 3445, 3445, 3467, 3473, 3445, 3457, 3467, 3449, 3445, 3450, 3462, 3457, 3445, 3445, 3449, 3462, 3462, 4144, 3457, 4380, 3457, 4144,
+	4142, 4152, 3457, 4380, 4144, 4140, 4140, 4142, 4380, 4380, 4351, 4352, 4351, 4380, 4350, 4352, 4379, 4380, 4349, 4350, 4380, 4350, 4345, 4351,
+	4351, 4345, 4352, 4339, 4350, 4349, 4345, 4350, 4339, 4410, 4352, 4345, 4325, 4345, 4339, 4345, 4325, 4410, 4352, 4410, 4408, 4352, 4408, 4402,
+	3493, 4402, 4408, 4402, 4396, 4352, 4396, 4402, 4401, 4396, 3990, 4375, 4375, 4352, 4396, 4401, 4397, 4396, 4397, 4390, 4396, 4387, 3990, 4396,
+	4396, 4390, 4387, 4379, 4375, 3990, 4387, 3989, 3990, 4379, 4352, 4375, 5162, 4509, 5993, 5993, 5999, 5162, 5998, 5162, 5999, 5992, 5993, 4520,
+	4520, 4832, 5992, 5998, 5997, 5992, 5992, 4832, 5998, 5999, 5997, 5998, 4811, 4812, 4813, 4813, 4812, 4815, 4815, 4816, 4813, 4819, 4820, 4817,
+	4821, 4820, 4819, 4819, 4822, 4821, 5469, 5472, 5468, 5605, 5606, 5609, 5858, 5855, 5856, 5856, 5859, 5858, 489, 4658, 26, 1086, 4682, 489,
+	26, 4658, 5, 985, 5, 4658, 985, 4658, 981, 5, 1091, 26, 1091, 5, 9, 981, 1091, 9, 6029, 4682, 4670, 6029, 4700, 4682,
+	106, 5964, 92, 92, 117, 106, 92, 5976, 117, 92, 5964, 5976, 5964, 106, 5952, 5952, 106, 117, 117, 5976, 5984, 5952, 117, 5984,
+	4116, 284, 206, 278, 206, 284, 221, 959, 206, 221, 206, 222, 293, 206, 959, 206, 293, 4116, 4119, 4120, 4116, 959, 955, 5537,
+	959, 963, 962, 959, 1399, 1401, 955, 948, 5537, 5537, 948, 5926, 5537, 5926, 4110, 5548, 5537, 4110, 5537, 5543, 5535, 5543, 5537, 5548,
+	948, 5937, 5926, 4122, 5926, 5945, 5945, 5926, 5937, 5926, 4122, 4110, 222, 1049, 4122, 278, 226, 222, 222, 226, 221, 943, 226, 278,
+	278, 937, 943, 1395, 1391, 943, 1399, 1395, 1401, 1399, 1391, 1395, 3795, 243, 1362, 243, 868, 917, 3312, 266, 3795, 3795, 3806, 3807,
+	1074, 1364, 3795, 3795, 1077, 1074, 3312, 5863, 5878, 3312, 5900, 5863, 5878, 5873, 3312, 3306, 3312, 5873, 5863, 924, 5878, 917, 924, 5863,
+	5863, 5869, 917, 5869, 5863, 5900, 5878, 935, 5873, 5878, 928, 931, 931, 935, 5878, 5878, 924, 928, 5869, 5900, 5913, 5869, 911, 917,
+	5913, 911, 5869, 917, 1074, 253, 253, 266, 1380, 1074, 266, 253, 1380, 266, 732, 266, 721, 732, 1376, 1373, 1380, 1376, 1372, 1373,
+	1373, 1372, 1367, 1364, 1367, 1362, 5831, 5810, 317, 336, 317, 5810, 597, 5831, 317, 346, 5793, 5772, 5793, 346, 366, 346, 5772, 627,
+	757, 5165, 405, 405, 5165, 1451, 405, 1451, 1457, 1501, 405, 1457, 1501, 765, 405, 746, 757, 760, 746, 5175, 757, 5165, 757, 2704,
+	5165, 5590, 1451, 1451, 5590, 5594, 1457, 1451, 5594, 1457, 5597, 1493, 5594, 5597, 1457, 1501, 1457, 1493, 765, 1501, 1493, 771, 765, 1493,
+	1493, 1482, 771, 1482, 1493, 5597, 5597, 5601, 1482, 771, 1482, 781, 771, 2562, 746, 2562, 771, 781, 1182, 746, 760, 5584, 5175, 746,
+	1175, 1182, 760, 5586, 2704, 5584, 2704, 5586, 2715, 5586, 5590, 2715, 806, 4495, 485, 485, 694, 806, 694, 485, 4931, 485, 4950, 4931,
+	4495, 4439, 3272, 3272, 4955, 4495, 794, 4495, 4505, 1547, 1551, 4439, 1551, 3272, 4439, 1551, 1547, 1550, 1547, 4931, 710, 1551, 5448, 5612,
+	5448, 1551, 1550, 1550, 5449, 5448, 5449, 5612, 5448, 5612, 710, 4931, 698, 694, 710, 4953, 4915, 4931, 4931, 4950, 4953, 4955, 4915, 4953,
+	4501, 794, 4505, 4505, 4507, 4501, 658, 646, 663, 658, 663, 666, 666, 663, 655, 655, 660, 666, 678, 669, 680, 678, 687, 669,
+	689, 678, 680, 689, 682, 678, 819, 840, 3871, 838, 1296, 819, 3859, 3849, 3871, 3871, 3849, 4065, 3866, 3871, 4065, 4491, 4065, 1276,
+	2292, 1296, 3886, 3886, 2303, 2292, 1907, 825, 2292, 2303, 2310, 2292, 2292, 2310, 1907, 3886, 2697, 2303, 3770, 3947, 3886, 5561, 2310, 2303,
+	5360, 1907, 2310, 5561, 5360, 2310, 1902, 825, 1907, 825, 5360, 5345, 825, 5345, 5334, 5360, 5561, 5345, 5345, 5561, 5397, 5397, 5561, 5393,
+	4791, 3947, 3770, 1347, 1317, 4267, 5416, 4267, 1317, 5416, 1317, 1331, 2209, 1347, 5441, 4264, 1331, 1347, 3325, 2209, 5441, 3325, 4250, 2209,
+	5441, 4272, 4276, 3190, 1569, 4480, 3190, 4480, 4436, 4480, 2371, 5022, 5022, 2371, 3417, 5039, 5032, 5022, 5022, 3417, 5039, 5026, 5018, 5022,
+	5026, 5022, 5032, 5032, 5039, 2205, 1667, 4857, 1664, 1665, 1667, 1664, 4960, 1782, 1813, 4869, 4960, 1785, 1785, 5289, 5291, 5289, 4867, 5291,
+	5125, 1805, 5121, 5280, 4710, 5125, 5531, 5125, 5134, 5134, 5125, 5116, 5116, 5125, 5121, 5121, 4710, 4587, 2985, 4587, 4710, 4710, 5531, 2985,
+	4806, 5531, 4044, 5134, 4044, 5531, 4044, 5134, 4577, 4044, 4577, 4584, 4806, 4044, 2598, 2592, 4584, 2600, 4584, 2592, 2598, 4587, 2600, 4584,
+	2598, 4085, 4584, 2604, 2600, 4587, 2985, 2604, 4587, 2985, 2608, 2604, 4632, 2608, 2985, 2985, 5280, 4632, 2599, 2600, 2604, 2599, 2592, 2600,
+	2092, 1838, 3080, 3080, 2339, 2092, 2339, 4244, 2092, 1868, 1881, 3531, 1868, 1874, 1881, 3535, 1868, 3531, 3542, 1868, 3535, 3510, 3531, 1881,
+	3500, 3510, 1881, 1874, 3522, 1881, 3548, 1881, 3522, 3548, 3550, 1881, 3531, 3510, 3517, 3531, 3526, 3535, 3531, 3517, 3526, 3535, 3522, 3542,
+	3522, 3535, 3526, 3548, 3522, 3517, 3526, 3517, 3522, 3517, 3508, 3548, 3508, 3506, 3548, 3503, 3517, 3510, 3517, 3503, 3508, 3510, 3500, 3503,
+	3500, 3506, 3503, 3506, 3508, 3503, 4457, 1987, 2230, 4452, 4457, 2230, 2230, 2223, 4452, 5092, 2223, 4281, 4281, 2368, 5092, 5092, 2368, 5064,
+	5064, 5069, 5092, 5092, 5069, 2080, 2064, 2080, 2068, 2064, 2165, 2080, 2149, 2064, 2068, 2165, 2064, 2149, 1997, 2000, 1993, 2012, 1997, 1993,
+	1993, 2046, 2012, 2060, 2046, 1993, 2006, 1993, 2000, 1997, 2012, 2000, 2000, 2012, 2023, 2023, 2004, 2000, 2000, 2004, 2006, 2048, 2041, 2012,
+	2023, 2012, 2041, 2048, 2012, 2046, 2049, 2048, 2046, 2046, 2060, 2049, 2028, 2041, 2048, 2048, 2036, 2028, 2049, 2036, 2048, 2041, 2028, 2023,
+	2004, 2023, 2013, 2023, 2024, 2013, 2024, 2023, 2028, 2004, 2013, 2006, 2006, 2013, 5250, 5250, 2013, 2024, 2035, 2024, 2028, 2024, 2035, 5250,
+	2036, 2035, 2028, 2037, 2035, 2036, 2035, 2037, 5250, 2616, 2612, 4613, 2618, 4613, 2612, 2618, 2612, 2617, 2616, 4024, 4800, 4613, 4067, 2616,
+	4613, 4606, 4024, 2622, 4617, 4613, 4613, 2619, 2622, 4613, 2618, 2619, 2619, 2618, 2617, 2617, 2622, 2619, 3008, 4617, 2622, 2622, 2626, 3008,
+	4995, 4617, 4998, 4617, 4527, 4998, 4527, 4617, 3008, 5524, 4527, 3008, 4638, 5270, 3008, 3008, 2626, 4638, 5270, 5710, 4527, 5003, 5710, 5524,
+	4800, 4024, 5524, 5524, 4024, 5009, 5524, 5009, 5003, 5003, 4995, 4998, 4606, 5009, 4024, 3103, 3099, 4552, 4552, 4553, 3103, 3152, 4520, 4521,
+	4521, 3155, 3152, 4509, 3349, 3351, 3351, 4508, 4509, 4427, 3410, 5691, 5691, 4430, 4427, 3445, 3476, 3450, 3473, 3476, 3445, 3445, 3467, 3473,
+	3445, 3457, 3467, 3990, 3457, 3445, 3445, 3450, 3990, 3488, 3450, 3476, 3488, 3476, 3475, 3475, 3476, 3473, 4298, 3452, 3450, 3488, 4298, 3450,
+	4298, 3488, 4318, 3488, 3475, 4402, 3488, 4402, 4410, 4396, 4402, 3475, 3473, 4396, 3475, 4352, 4410, 4402, 4402, 4396, 4352, 4410, 4352, 4325,
+	4352, 3990, 4380, 4380, 4325, 4352, 3990, 4352, 4396, 4382, 3990, 4396, 4397, 4390, 4396, 4396, 4390, 4382, 4336, 4318, 4325, 4349, 4336, 4325,
+	4325, 4380, 4349, 4293, 4318, 4336, 4318, 4293, 4298, 4359, 4293, 4336, 4336, 4349, 4359, 4359, 4349, 4380, 4380, 3457, 4140, 4140, 4142, 4380,
+	3452, 4359, 3457, 4142, 4152, 3457, 4359, 3452, 4293, 4293, 3452, 4291, 4291, 4298, 4293, 3452, 4298, 4291, 3637, 4179, 4189, 3658, 3637, 4189,
+	3637, 3841, 4179, 4103, 4179, 3841, 4189, 4193, 3658, 3658, 4193, 4200, 4200, 4206, 3658, 3697, 3658, 4211, 4206, 4211, 3658, 4218, 3697, 4211,
+	4224, 3748, 3697, 4224, 3697, 4218, 4426, 3748, 4224, 5605, 4061, 5609, 4813, 4811, 4815, 4821, 4817, 4819, 4967, 4975, 4966, 4966, 4975, 4970,
+	4970, 4971, 4966, 4977, 4988, 4980, 4977, 4982, 4984, 4984, 4988, 4977, 5858, 5855, 5856, 5856, 5859, 5858, 
+};
+
+inline const MeshLod alliance_mesh_lods[] = {
+	{ 0, 18273, 0.0f },
+	{ 18273, 9138, 0.00234731799f },
+	{ 27411, 4560, 0.00664766459f },
+	{ 31971, 2271, 0.0134796584f },
+	{ 34242, 1128, 0.0236580372f },
+};
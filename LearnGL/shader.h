@@ -7,20 +7,44 @@
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
 
+#include <chrono>
 #include <iostream>
 #include <string>
 #include <fstream>
 #include <sstream>
+#include <vector>
 
+#include "camerabuffer.h"
+#include "instanceformat.h"
+#include "parallelcompile.h"
+#include "programcache.h"
+#include "uniforms.h"
+
+
+// Deferred only submits the program, poll() or a ShaderBatch finishes it once the driver is done
+enum class ShaderCompile
+{
+    Immediate,
+    Deferred
+};
 
 class Shader
 {
+private:
+    UniformTable uniformTable;
+    unsigned int vertex;
+    unsigned int fragment;
+    uint64_t cacheKey;
+    double compileSeconds;      // blocking GL work only, not the time a deferred program waited for finish()
+    bool pending;
+    bool linked;
+
 public:
     unsigned int ID;
 
     // From Files
-    Shader(const char* vertexPath, const char* fragmentPath)
-        : ID(0)
+    Shader(const char* vertexPath, const char* fragmentPath, ShaderCompile mode = ShaderCompile::Immediate)
+        : vertex(0), fragment(0), cacheKey(0), compileSeconds(0.0), pending(false), linked(false), ID(0)
     {
 
         std::string vertexCode;
@@ -57,107 +81,94 @@ public:
             return;
         }
 
-        const char* vShaderCode = vertexCode.c_str();
-        const char* fShaderCode = fragmentCode.c_str();
+        submit(vertexCode, fragmentCode);
+        if (mode == ShaderCompile::Immediate)
+            finish();
+    }
 
-        unsigned int vertex, fragment;
-        int success;
-        char infoLog[512];
+    // From Strings
+    Shader(std::string& vertexData, std::string& fragmentData, ShaderCompile mode = ShaderCompile::Immediate)
+        : vertex(0), fragment(0), cacheKey(0), compileSeconds(0.0), pending(false), linked(false), ID(0)
+    {
+        submit(vertexData, fragmentData);
+        if (mode == ShaderCompile::Immediate)
+            finish();
+    }
 
-        // Compile vertex shader
-        vertex = glCreateShader(GL_VERTEX_SHADER);
-        glShaderSource(vertex, 1, &vShaderCode, nullptr);
-        glCompileShader(vertex);
-        glGetShaderiv(vertex, GL_COMPILE_STATUS, &success);
-        if (!success)
-        {
-            glGetShaderInfoLog(vertex, 512, nullptr, infoLog);
-            std::cerr << "Vertex shader compilation failed\n" << infoLog << std::endl;
-            return;
-        }
+    // Linked and usable
+    bool isReady() const
+    {
+        return !pending && linked;
+    }
 
-        // Compile fragment shader
-        fragment = glCreateShader(GL_FRAGMENT_SHADER);
-        glShaderSource(fragment, 1, &fShaderCode, nullptr);
-        glCompileShader(fragment);
-        glGetShaderiv(fragment, GL_COMPILE_STATUS, &success);
-        if (!success)
-        {
-            glGetShaderInfoLog(fragment, 512, nullptr, infoLog);
-            std::cerr << "Fragment shader compilation failed\n" << infoLog << std::endl;
-            return;
-        }
+    // Submitted and not finished yet
+    bool isPending() const
+    {
+        return pending;
+    }
 
-        // Create shader program and link shaders
-        ID = glCreateProgram();
-        glAttachShader(ID, vertex);
-        glAttachShader(ID, fragment);
-        glLinkProgram(ID);
-        glGetProgramiv(ID, GL_LINK_STATUS, &success);
-        if (!success)
+    // Finishes the program once the driver is done with it and returns true, false while it is still compiling.
+    // Only blocks without GL_KHR_parallel_shader_compile, which leaves nothing to ask the driver but the result.
+    bool poll()
+    {
+        if (!pending)
+            return true;
+        if (parallelShaderCompileSupported())
         {
-            glGetProgramInfoLog(ID, 512, nullptr, infoLog);
-            std::cerr << "Shader program linking failed\n" << infoLog << std::endl;
-            return;
+            GLint complete = 0;
+            glGetProgramiv(ID, GL_COMPLETION_STATUS_KHR, &complete);
+            if (!complete)
+                return false;
         }
-
-        // Delete shaders
-        glDeleteShader(vertex);
-        glDeleteShader(fragment);
+        finish();
+        return true;
     }
 
-    // From Strings
-    Shader(std::string& vertexData, std::string& fragmentData)
-        : ID(0)
+    // Checks the compile and link results, waiting for the driver when it has not finished yet
+    void finish()
     {
+        if (!pending)
+            return;
+        pending = false;
 
-        const char* vShaderCode = vertexData.c_str();
-        const char* fShaderCode = fragmentData.c_str();
-
-        unsigned int vertex, fragment;
         int success;
         char infoLog[512];
 
-        // Compile vertex shader
-        vertex = glCreateShader(GL_VERTEX_SHADER);
-        glShaderSource(vertex, 1, &vShaderCode, nullptr);
-        glCompileShader(vertex);
+        // The first status query is where the driver makes us wait for the compile
+        auto start = std::chrono::steady_clock::now();
         glGetShaderiv(vertex, GL_COMPILE_STATUS, &success);
         if (!success)
         {
             glGetShaderInfoLog(vertex, 512, nullptr, infoLog);
             std::cerr << "Vertex shader compilation failed\n" << infoLog << std::endl;
+            release(true);
             return;
         }
 
-        // Compile fragment shader
-        fragment = glCreateShader(GL_FRAGMENT_SHADER);
-        glShaderSource(fragment, 1, &fShaderCode, nullptr);
-        glCompileShader(fragment);
         glGetShaderiv(fragment, GL_COMPILE_STATUS, &success);
         if (!success)
         {
             glGetShaderInfoLog(fragment, 512, nullptr, infoLog);
             std::cerr << "Fragment shader compilation failed\n" << infoLog << std::endl;
+            release(true);
             return;
         }
 
-        // Create shader program and link shaders
-        ID = glCreateProgram();
-        glAttachShader(ID, vertex);
-        glAttachShader(ID, fragment);
-        glLinkProgram(ID);
         glGetProgramiv(ID, GL_LINK_STATUS, &success);
+        compileSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
         if (!success)
         {
             glGetProgramInfoLog(ID, 512, nullptr, infoLog);
             std::cerr << "Shader program linking failed\n" << infoLog << std::endl;
+            release(false);
             return;
         }
+        linked = true;
+        uniformTable.reflect(ID);
+        CameraBuffer::bindBlock(ID);
+        release(false);
 
-        // Delete shaders
-        glDeleteShader(vertex);
-        glDeleteShader(fragment);
+        ProgramCache::shared().store(cacheKey, ID, compileSeconds);
     }
 
     void use()
@@ -170,63 +181,216 @@ public:
         glUseProgram(0);
     }
 
+    // Active uniforms as reflected at link time, the setters look names up here instead of asking the driver
+    const UniformTable& getUniforms() const
+    {
+        return uniformTable;
+    }
+
+    // Resolves a uniform once for set(), invalid when the program does not use it or declares another type
+    template<typename T>
+    Uniform<T> uniform(UniformName name) const
+    {
+        Uniform<T> handle;
+        const UniformInfo* info = uniformTable.find(name);
+        if (!info)
+            return handle;
+        if (!uniformTypeMatches<T>(info->type))
+        {
+            std::cerr << "Uniform " << name.text << " has another type (0x" << std::hex << info->type << std::dec << ')' << std::endl;
+            return handle;
+        }
+        handle.location = info->location;
+        return handle;
+    }
+
+    template<typename T>
+    void set(Uniform<T> handle, const T& value) const
+    {
+        setUniform(handle.location, value);
+    }
+
     // utility uniform functions
     // ------------------------------------------------------------------------
-    void setBool(const std::string& name, bool value) const
+    void setBool(UniformName name, bool value) const
     {
-        glUniform1i(glGetUniformLocation(ID, name.c_str()), (int)value);
+        glUniform1i(uniformTable.location(name), (int)value);
     }
     // ------------------------------------------------------------------------
-    void setInt(const std::string& name, int value) const
+    void setInt(UniformName name, int value) const
     {
-        glUniform1i(glGetUniformLocation(ID, name.c_str()), value);
+        glUniform1i(uniformTable.location(name), value);
     }
     // ------------------------------------------------------------------------
-    void setFloat(const std::string& name, float value) const
+    void setFloat(UniformName name, float value) const
     {
-        glUniform1f(glGetUniformLocation(ID, name.c_str()), value);
+        glUniform1f(uniformTable.location(name), value);
     }
     // ------------------------------------------------------------------------
-    void setVec2(const std::string& name, const glm::vec2& value) const
+    void setVec2(UniformName name, const glm::vec2& value) const
     {
-        glUniform2fv(glGetUniformLocation(ID, name.c_str()), 1, &value[0]);
+        glUniform2fv(uniformTable.location(name), 1, &value[0]);
     }
-    void setVec2(const std::string& name, float x, float y) const
+    void setVec2(UniformName name, float x, float y) const
     {
-        glUniform2f(glGetUniformLocation(ID, name.c_str()), x, y);
+        glUniform2f(uniformTable.location(name), x, y);
     }
     // ------------------------------------------------------------------------
-    void setVec3(const std::string& name, const glm::vec3& value) const
+    void setVec3(UniformName name, const glm::vec3& value) const
     {
-        glUniform3fv(glGetUniformLocation(ID, name.c_str()), 1, &value[0]);
+        glUniform3fv(uniformTable.location(name), 1, &value[0]);
     }
-    void setVec3(const std::string& name, float x, float y, float z) const
+    void setVec3(UniformName name, float x, float y, float z) const
     {
-        glUniform3f(glGetUniformLocation(ID, name.c_str()), x, y, z);
+        glUniform3f(uniformTable.location(name), x, y, z);
     }
     // ------------------------------------------------------------------------
-    void setVec4(const std::string& name, const glm::vec4& value) const
+    void setVec4(UniformName name, const glm::vec4& value) const
     {
-        glUniform4fv(glGetUniformLocation(ID, name.c_str()), 1, &value[0]);
+        glUniform4fv(uniformTable.location(name), 1, &value[0]);
     }
-    void setVec4(const std::string& name, float x, float y, float z, float w) const
+    void setVec4(UniformName name, float x, float y, float z, float w) const
     {
-        glUniform4f(glGetUniformLocation(ID, name.c_str()), x, y, z, w);
+        glUniform4f(uniformTable.location(name), x, y, z, w);
     }
     // ------------------------------------------------------------------------
-    void setMat2(const std::string& name, const glm::mat2& mat) const
+    void setMat2(UniformName name, const glm::mat2& mat) const
     {
-        glUniformMatrix2fv(glGetUniformLocation(ID, name.c_str()), 1, GL_FALSE, &mat[0][0]);
+        glUniformMatrix2fv(uniformTable.location(name), 1, GL_FALSE, &mat[0][0]);
     }
     // ------------------------------------------------------------------------
-    void setMat3(const std::string& name, const glm::mat3& mat) const
+    void setMat3(UniformName name, const glm::mat3& mat) const
     {
-        glUniformMatrix3fv(glGetUniformLocation(ID, name.c_str()), 1, GL_FALSE, &mat[0][0]);
+        glUniformMatrix3fv(uniformTable.location(name), 1, GL_FALSE, &mat[0][0]);
     }
     // ------------------------------------------------------------------------
-    void setMat4(const std::string& name, const glm::mat4& mat) const
+    void setMat4(UniformName name, const glm::mat4& mat) const
     {
-        glUniformMatrix4fv(glGetUniformLocation(ID, name.c_str()), 1, GL_FALSE, &mat[0][0]);
+        glUniformMatrix4fv(uniformTable.location(name), 1, GL_FALSE, &mat[0][0]);
+    }
+
+private:
+    // Loads the program from the program cache, or starts compiling and linking it without asking for any
+    // status, so the driver can work on every submitted program at once
+    void submit(const std::string& vertexData, const std::string& fragmentData)
+    {
+        ProgramCache& cache = ProgramCache::shared();
+        cacheKey = ProgramCache::key({ vertexData, fragmentData });
+        ID = cache.load(cacheKey);
+        if (ID)
+        {
+            linked = true;
+            uniformTable.reflect(ID);
+            CameraBuffer::bindBlock(ID);
+            return;
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        const char* vShaderCode = vertexData.c_str();
+        const char* fShaderCode = fragmentData.c_str();
+
+        vertex = glCreateShader(GL_VERTEX_SHADER);
+        glShaderSource(vertex, 1, &vShaderCode, nullptr);
+        glCompileShader(vertex);
+
+        fragment = glCreateShader(GL_FRAGMENT_SHADER);
+        glShaderSource(fragment, 1, &fShaderCode, nullptr);
+        glCompileShader(fragment);
+
+        // Linking failed stages fails too, finish() reports the stage's log instead
+        ID = glCreateProgram();
+        glAttachShader(ID, vertex);
+        glAttachShader(ID, fragment);
+        cache.prepare(ID);
+        glLinkProgram(ID);
+        compileSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        pending = true;
+    }
+
+    // Deletes the stages, and the program too when a stage failed to compile
+    void release(bool deleteProgram)
+    {
+        glDeleteShader(vertex);
+        glDeleteShader(fragment);
+        vertex = fragment = 0;
+        if (deleteProgram)
+        {
+            glDeleteProgram(ID);
+            ID = 0;
+        }
+    }
+};
+
+struct ShaderBatchStats
+{
+    size_t submitted = 0;
+    size_t ready = 0;
+    size_t failed = 0;
+    bool parallel = false;          // GL_KHR_parallel_shader_compile, otherwise poll() finishes everything at once
+    double milliseconds = 0.0;      // from the first add() until the last program finished
+};
+
+// Deferred programs being compiled together. poll() once a frame finishes whichever the driver is done with and
+// never waits on the others, draw with a placeholder until a program isReady().
+class ShaderBatch
+{
+private:
+    std::vector<Shader*> pending;
+    std::chrono::steady_clock::time_point start;
+    ShaderBatchStats stats;
+
+public:
+    // The shader has to outlive the batch or be finished first
+    void add(Shader& shader)
+    {
+        if (stats.submitted == stats.ready + stats.failed)
+            start = std::chrono::steady_clock::now();
+        stats.parallel = parallelShaderCompileSupported();
+        ++stats.submitted;
+        pending.push_back(&shader);
+        // Programs loaded from the program cache are done already
+        poll();
+    }
+
+    // Number of programs still compiling
+    size_t poll()
+    {
+        size_t kept = 0;
+        for (Shader* shader : pending)
+        {
+            if (!shader->poll())
+            {
+                pending[kept++] = shader;
+                continue;
+            }
+            if (shader->isReady())
+                ++stats.ready;
+            else
+                ++stats.failed;
+        }
+        bool finished = kept < pending.size();
+        pending.resize(kept);
+        if (finished && pending.empty())
+            stats.milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        return pending.size();
+    }
+
+    // Waits for every program
+    void finish()
+    {
+        for (Shader* shader : pending)
+            shader->finish();
+        poll();
+    }
+
+    bool done() const
+    {
+        return pending.empty();
+    }
+
+    const ShaderBatchStats& getStats() const
+    {
+        return stats;
     }
 };
 
@@ -242,12 +406,18 @@ layout (location = 3) in mat4 aModelMatrix;
 out vec3 fragColor;
 out vec2 texCoord; // Pass texture coordinates to fragment shader
 
-uniform mat4 view;
-uniform mat4 projection;
+layout (std140) uniform Camera
+{
+    mat4 view;
+    mat4 projection;
+    mat4 viewProjection;
+    vec4 cameraPosition;
+    float time;
+};
 
 void main()
 {
-    gl_Position = projection * view * aModelMatrix * vec4(aPosition, 1.0);
+    gl_Position = viewProjection * (aModelMatrix * vec4(aPosition, 1.0));
     fragColor = vec3(1.0, 0.5, 0.2); // Our color
     texCoord = aTexCoord; // Pass texture coordinates to fragment shader
 }
@@ -255,6 +425,189 @@ void main()
 
 )";
 
+// Same as vshader for VertexFormat::Compact meshes, the dequantization comes from constant attributes 7-9
+std::string vshaderCompact = R"(
+#version 330 core
+
+layout (location = 0) in vec3 aPosition;        // unorm16 inside the mesh bounds
+layout (location = 1) in vec2 aTexCoord;        // unorm16 inside the texCoord bounds
+layout (location = 2) in vec2 aNormal;          // octahedral snorm16
+layout (location = 3) in mat4 aModelMatrix;
+layout (location = 7) in vec3 aPositionScale;
+layout (location = 8) in vec3 aPositionOffset;
+layout (location = 9) in vec4 aTexCoordTransform;
+
+out vec3 fragColor;
+out vec2 texCoord;
+out vec3 normal;
+
+layout (std140) uniform Camera
+{
+    mat4 view;
+    mat4 projection;
+    mat4 viewProjection;
+    vec4 cameraPosition;
+    float time;
+};
+
+vec3 octahedralDecode(vec2 e)
+{
+    vec3 n = vec3(e, 1.0 - abs(e.x) - abs(e.y));
+    float t = max(-n.z, 0.0);
+    n.xy += vec2(n.x >= 0.0 ? -t : t, n.y >= 0.0 ? -t : t);
+    return normalize(n);
+}
+
+void main()
+{
+    vec3 position = aPositionOffset + aPosition * aPositionScale;
+    gl_Position = viewProjection * (aModelMatrix * vec4(position, 1.0));
+    fragColor = vec3(1.0, 0.5, 0.2);
+    texCoord = aTexCoordTransform.zw + aTexCoord * aTexCoordTransform.xy;
+    normal = mat3(aModelMatrix) * octahedralDecode(aNormal);
+}
+)";
+
+// Source of ShaderVariants, the vshader/vshaderCompact/fshader programs are its TEXTURED | INSTANCED variants
+std::string vshaderVariants = R"(
+#version 330 core
+#pragma features TEXTURED INSTANCED VERTEX_COLOR COMPACT_TRANSFORM COMPACT_VERTICES
+
+layout (location = 0) in vec3 aPosition;
+
+#ifdef TEXTURED
+layout (location = 1) in vec2 aTexCoord;
+out vec2 texCoord;
+#endif
+
+#ifdef VERTEX_COLOR
+out vec3 fragColor;
+#endif
+
+#ifdef COMPACT_VERTICES
+layout (location = 7) in vec3 aPositionScale;
+layout (location = 8) in vec3 aPositionOffset;
+layout (location = 9) in vec4 aTexCoordTransform;
+#endif
+
+#if defined(INSTANCED) && defined(COMPACT_TRANSFORM)
+)" + std::string(quatScaleInstanceGlsl) + R"(
+mat4 modelMatrix()
+{
+    return instanceModelMatrix();
+}
+#elif defined(INSTANCED)
+layout (location = 3) in mat4 aModelMatrix;
+
+mat4 modelMatrix()
+{
+    return aModelMatrix;
+}
+#else
+uniform mat4 model;
+
+mat4 modelMatrix()
+{
+    return model;
+}
+#endif
+
+layout (std140) uniform Camera
+{
+    mat4 view;
+    mat4 projection;
+    mat4 viewProjection;
+    vec4 cameraPosition;
+    float time;
+};
+
+void main()
+{
+#ifdef COMPACT_VERTICES
+    vec3 position = aPositionOffset + aPosition * aPositionScale;
+#else
+    vec3 position = aPosition;
+#endif
+    gl_Position = viewProjection * (modelMatrix() * vec4(position, 1.0));
+
+#if defined(TEXTURED) && defined(COMPACT_VERTICES)
+    texCoord = aTexCoordTransform.zw + aTexCoord * aTexCoordTransform.xy;
+#elif defined(TEXTURED)
+    texCoord = aTexCoord;
+#endif
+#ifdef VERTEX_COLOR
+    fragColor = vec3(1.0, 0.5, 0.2);
+#endif
+}
+)";
+
+std::string fshaderVariants = R"(
+#version 330 core
+#pragma features TEXTURED VERTEX_COLOR
+
+#ifdef TEXTURED
+in vec2 texCoord;
+uniform sampler2D ourTexture;
+#endif
+
+#ifdef VERTEX_COLOR
+in vec3 fragColor;
+#endif
+
+out vec4 FragColor;
+
+void main()
+{
+    vec4 color = vec4(1.0);
+#ifdef TEXTURED
+    color *= texture(ourTexture, texCoord);
+#endif
+#ifdef VERTEX_COLOR
+    color.rgb *= fragColor;
+#endif
+    FragColor = color;
+}
+)";
+
+// Flat colour drawn instead of the real programs while they compile, small enough to build immediately.
+// Set compactPositions for VertexFormat::Compact meshes.
+std::string vshaderPlaceholder = R"(
+#version 330 core
+
+layout (location = 0) in vec3 aPosition;
+layout (location = 3) in mat4 aModelMatrix;
+layout (location = 7) in vec3 aPositionScale;
+layout (location = 8) in vec3 aPositionOffset;
+
+uniform bool compactPositions;
+
+layout (std140) uniform Camera
+{
+    mat4 view;
+    mat4 projection;
+    mat4 viewProjection;
+    vec4 cameraPosition;
+    float time;
+};
+
+void main()
+{
+    vec3 position = compactPositions ? aPositionOffset + aPosition * aPositionScale : aPosition;
+    gl_Position = viewProjection * (aModelMatrix * vec4(position, 1.0));
+}
+)";
+
+std::string fshaderPlaceholder = R"(
+#version 330 core
+
+out vec4 FragColor;
+
+void main()
+{
+    FragColor = vec4(0.5, 0.5, 0.5, 1.0);
+}
+)";
+
 std::string fshader = R"(
 #version 330 core
 
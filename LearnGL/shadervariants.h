@@ -0,0 +1,148 @@
+#pragma once
+
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "shader.h"
+
+// Feature bits of a variant key, bit i is defined as name(i)
+struct ShaderFeature
+{
+	static constexpr uint32_t Textured = 1 << 0;			// samples ourTexture at the texture coordinate
+	static constexpr uint32_t Instanced = 1 << 1;			// model matrix per instance at locations 3-6, otherwise the model uniform
+	static constexpr uint32_t VertexColor = 1 << 2;			// colour from the vertex stage
+	static constexpr uint32_t CompactTransform = 1 << 3;	// with Instanced, InstanceFormat::QuatScale(Half) at locations 3-4
+	static constexpr uint32_t CompactVertices = 1 << 4;		// VertexFormat::Compact, dequantized from attributes 7-9
+	static constexpr uint32_t count = 5;
+
+	static const char* name(uint32_t bit)
+	{
+		static const char* names[count] = { "TEXTURED", "INSTANCED", "VERTEX_COLOR", "COMPACT_TRANSFORM", "COMPACT_VERTICES" };
+		return bit < count ? names[bit] : "";
+	}
+};
+
+// Every specialization of one vertex and fragment source pair. The sources list the keywords they react to in a
+//     #pragma features TEXTURED INSTANCED
+// line, which GLSL compilers ignore, and test them with #ifdef. A variant is the sources with a #define per set
+// bit injected after #version, features neither source declares are dropped from the key so they never make a
+// duplicate program. Variants sit in a table indexed by key, get() builds missing ones on first use and
+// precompile() submits them to a ShaderBatch ahead of time. The program cache keeps them across runs.
+class ShaderVariants
+{
+private:
+	std::string vertexSource;
+	std::string fragmentSource;
+	uint32_t declared;
+	std::vector<std::unique_ptr<Shader>> variants;	// 1 << ShaderFeature::count, indexed by key
+
+public:
+	ShaderVariants(const std::string& vertex, const std::string& fragment)
+		: vertexSource(vertex), fragmentSource(fragment), declared(0), variants(size_t(1) << ShaderFeature::count)
+	{
+		declared = declaredFeatures(vertex) | declaredFeatures(fragment);
+	}
+
+	ShaderVariants(const ShaderVariants&) = delete;
+	ShaderVariants& operator=(const ShaderVariants&) = delete;
+
+	// Features the sources declare
+	uint32_t getDeclared() const
+	{
+		return declared;
+	}
+
+	uint32_t key(uint32_t features) const
+	{
+		return features & declared;
+	}
+
+	// Variant for the features, compiled now if it does not exist yet. Might still be compiling after precompile().
+	Shader& get(uint32_t features)
+	{
+		std::unique_ptr<Shader>& variant = variants[key(features)];
+		if (!variant)
+			variant = create(key(features), ShaderCompile::Immediate);
+		return *variant;
+	}
+
+	// nullptr when the variant was never built
+	Shader* find(uint32_t features) const
+	{
+		return variants[key(features)].get();
+	}
+
+	// Submits the variant without waiting for it, the batch finishes it
+	Shader& precompile(uint32_t features, ShaderBatch& batch)
+	{
+		std::unique_ptr<Shader>& variant = variants[key(features)];
+		if (!variant)
+		{
+			variant = create(key(features), ShaderCompile::Deferred);
+			batch.add(*variant);
+		}
+		return *variant;
+	}
+
+	// Number of variants built or submitted so far
+	size_t size() const
+	{
+		size_t built = 0;
+		for (const std::unique_ptr<Shader>& variant : variants)
+			built += variant ? 1 : 0;
+		return built;
+	}
+
+	// The source a variant compiles, with its defines after the #version line
+	static std::string specialize(const std::string& source, uint32_t features)
+	{
+		std::string defines;
+		for (uint32_t bit = 0; bit < ShaderFeature::count; ++bit)
+			if (features & (1u << bit))
+				defines += std::string("#define ") + ShaderFeature::name(bit) + " 1\n";
+
+		// #version has to stay the first directive
+		size_t at = source.find("#version");
+		at = at == std::string::npos ? 0 : source.find('\n', at);
+		at = at == std::string::npos ? source.size() : at + 1;
+		std::string result = source;
+		result.insert(at, defines);
+		return result;
+	}
+
+	// Bits of the keywords on the source's #pragma features lines
+	static uint32_t declaredFeatures(const std::string& source)
+	{
+		static const std::string directive = "#pragma features";
+		uint32_t features = 0;
+		for (size_t at = source.find(directive); at != std::string::npos; at = source.find(directive, at + 1))
+		{
+			size_t end = source.find('\n', at);
+			std::istringstream line(source.substr(at + directive.size(), end == std::string::npos ? std::string::npos : end - at - directive.size()));
+			std::string keyword;
+			while (line >> keyword)
+			{
+				uint32_t bit = 0;
+				while (bit < ShaderFeature::count && keyword != ShaderFeature::name(bit))
+					++bit;
+				if (bit < ShaderFeature::count)
+					features |= 1u << bit;
+				else
+					std::cerr << "Unknown shader feature " << keyword << std::endl;
+			}
+		}
+		return features;
+	}
+
+private:
+	std::unique_ptr<Shader> create(uint32_t features, ShaderCompile mode) const
+	{
+		std::string vertex = specialize(vertexSource, features);
+		std::string fragment = specialize(fragmentSource, features);
+		return std::unique_ptr<Shader>(new Shader(vertex, fragment, mode));
+	}
+};
@@ -0,0 +1,357 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "meshopt.h"
+#include "objloader.h"
+
+// One level of detail, a range of the shared index buffer drawn with the same vertices
+struct MeshLod
+{
+	uint32_t firstIndex;
+	uint32_t indexCount;
+	// Furthest the surface may have moved from the full mesh, in mesh units
+	float error;
+};
+
+// Symmetric 4x4 matrix summing squared distances to a set of weighted planes (Garland and Heckbert 1997)
+struct Quadric
+{
+	double a00 = 0, a01 = 0, a02 = 0, a03 = 0;
+	double a11 = 0, a12 = 0, a13 = 0;
+	double a22 = 0, a23 = 0;
+	double a33 = 0;
+	double weight = 0;
+
+	static Quadric plane(const glm::dvec3& normal, double distance, double weight)
+	{
+		Quadric q;
+		q.a00 = weight * normal.x * normal.x;
+		q.a01 = weight * normal.x * normal.y;
+		q.a02 = weight * normal.x * normal.z;
+		q.a03 = weight * normal.x * distance;
+		q.a11 = weight * normal.y * normal.y;
+		q.a12 = weight * normal.y * normal.z;
+		q.a13 = weight * normal.y * distance;
+		q.a22 = weight * normal.z * normal.z;
+		q.a23 = weight * normal.z * distance;
+		q.a33 = weight * distance * distance;
+		q.weight = weight;
+		return q;
+	}
+
+	Quadric& operator+=(const Quadric& other)
+	{
+		a00 += other.a00; a01 += other.a01; a02 += other.a02; a03 += other.a03;
+		a11 += other.a11; a12 += other.a12; a13 += other.a13;
+		a22 += other.a22; a23 += other.a23;
+		a33 += other.a33;
+		weight += other.weight;
+		return *this;
+	}
+
+	// Weighted mean squared distance of p to the planes
+	double error(const glm::vec3& p) const
+	{
+		double x = p.x, y = p.y, z = p.z;
+		double sum =
+			a00 * x * x + 2 * a01 * x * y + 2 * a02 * x * z + 2 * a03 * x +
+			a11 * y * y + 2 * a12 * y * z + 2 * a13 * y +
+			a22 * z * z + 2 * a23 * z +
+			a33;
+		return weight > 0 ? std::max(sum, 0.0) / weight : 0.0;
+	}
+};
+
+// Quadric error metric edge collapse onto existing vertices, so every level shares one vertex buffer
+class MeshSimplifier
+{
+public:
+	// Collapses edges until at most targetIndexCount indices are left or no collapse is possible
+	// without folding a triangle over. error receives how far the surface moved, in mesh units.
+	static std::vector<unsigned int> simplify(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices,
+		size_t targetIndexCount, float* error = nullptr)
+	{
+		std::vector<unsigned int> result(indices.begin(), indices.begin() + indices.size() / 3 * 3);
+		size_t vertexCount = vertices.size();
+		double maxError = 0.0;
+
+		// Collapses work on positions, vertices that only differ in normal or texCoord move together
+		std::vector<unsigned int> positionIds = MeshOptimizer::weldPositions(vertices.data(), vertexCount);
+		std::vector<size_t> siblingStart(vertexCount + 1, 0);
+		for (size_t vertex = 0; vertex < vertexCount; ++vertex)
+			++siblingStart[positionIds[vertex] + 1];
+		for (size_t position = 0; position < vertexCount; ++position)
+			siblingStart[position + 1] += siblingStart[position];
+		std::vector<unsigned int> siblings(vertexCount);
+		std::vector<size_t> fill(siblingStart.begin(), siblingStart.end() - 1);
+		for (size_t vertex = 0; vertex < vertexCount; ++vertex)
+			siblings[fill[positionIds[vertex]]++] = static_cast<unsigned int>(vertex);
+
+		std::vector<Quadric> quadrics = computeQuadrics(vertices, positionIds, result);
+
+		std::vector<Collapse> collapses;
+		std::vector<size_t> adjacencyStart;
+		std::vector<unsigned int> adjacency;
+		std::vector<unsigned int> positionRemap(vertexCount);
+		std::vector<unsigned int> vertexRemap(vertexCount);
+		std::vector<char> locked(vertexCount);
+
+		while (result.size() > targetIndexCount)
+		{
+			size_t triangleCount = result.size() / 3;
+			buildAdjacency(result, positionIds, vertexCount, adjacencyStart, adjacency);
+			findCollapses(vertices, positionIds, result, quadrics, collapses);
+			std::sort(collapses.begin(), collapses.end(), [](const Collapse& a, const Collapse& b) { return a.cost < b.cost; });
+
+			for (size_t position = 0; position < vertexCount; ++position)
+				positionRemap[position] = static_cast<unsigned int>(position);
+			std::fill(locked.begin(), locked.end(), 0);
+
+			// Cheapest first, each collapse removes about two triangles. Locks turn many of the cheapest
+			// collapses down, so allow a bit more than the cost of the last one that would be needed.
+			size_t removable = (triangleCount - targetIndexCount / 3 + 1) / 2 + 1;
+			double costLimit = removable < collapses.size() ? collapses[removable].cost * 1.5 : collapses.empty() ? 0.0 : collapses.back().cost;
+			size_t accepted = 0;
+			for (const Collapse& collapse : collapses)
+			{
+				if (accepted == removable || collapse.cost > costLimit)
+					break;
+				if (locked[collapse.from] || locked[collapse.to])
+					continue;
+				if (flipsTriangle(vertices, positionIds, result, adjacencyStart, adjacency, collapse))
+					continue;
+
+				// Lock the whole neighbourhood so later flip checks still see the geometry they test against
+				for (size_t a = adjacencyStart[collapse.from]; a < adjacencyStart[collapse.from + 1]; ++a)
+					for (int corner = 0; corner < 3; ++corner)
+						locked[positionIds[result[adjacency[a] * 3 + corner]]] = 1;
+				locked[collapse.to] = 1;
+
+				positionRemap[collapse.from] = collapse.to;
+				quadrics[collapse.to] += quadrics[collapse.from];
+				maxError = std::max(maxError, collapse.cost);
+				++accepted;
+			}
+			if (accepted == 0)
+				break;
+
+			// Every vertex of a collapsed position moves to the vertex at the target with the closest attributes
+			for (size_t vertex = 0; vertex < vertexCount; ++vertex)
+			{
+				unsigned int target = positionRemap[positionIds[vertex]];
+				vertexRemap[vertex] = target == positionIds[vertex] ? static_cast<unsigned int>(vertex) :
+					closestSibling(vertices, vertices[vertex], siblings.data() + siblingStart[target], siblingStart[target + 1] - siblingStart[target]);
+			}
+
+			size_t kept = 0;
+			for (size_t triangle = 0; triangle < triangleCount; ++triangle)
+			{
+				unsigned int a = vertexRemap[result[triangle * 3 + 0]];
+				unsigned int b = vertexRemap[result[triangle * 3 + 1]];
+				unsigned int c = vertexRemap[result[triangle * 3 + 2]];
+				if (positionIds[a] == positionIds[b] || positionIds[b] == positionIds[c] || positionIds[a] == positionIds[c])
+					continue;
+				result[kept++] = a;
+				result[kept++] = b;
+				result[kept++] = c;
+			}
+			result.resize(kept);
+		}
+
+		if (error)
+			*error = static_cast<float>(std::sqrt(maxError));
+		return result;
+	}
+
+	// Appends up to maxLevels - 1 simplified levels, each about ratio times the previous one, to indices.
+	// The first level is the indices passed in. Stops early once a level no longer shrinks by at least 10%.
+	static std::vector<MeshLod> buildLodChain(const std::vector<Vertex>& vertices, std::vector<unsigned int>& indices,
+		unsigned int maxLevels = 5, float ratio = 0.5f)
+	{
+		std::vector<MeshLod> lods;
+		lods.push_back({ 0, static_cast<uint32_t>(indices.size()), 0.f });
+
+		std::vector<unsigned int> previous = indices;
+		for (unsigned int level = 1; level < maxLevels; ++level)
+		{
+			size_t target = static_cast<size_t>(previous.size() / 3 * ratio) * 3;
+			float levelError = 0.f;
+			std::vector<unsigned int> simplified = simplify(vertices, previous, target, &levelError);
+			if (simplified.empty() || simplified.size() > previous.size() * 9 / 10)
+				break;
+
+			MeshOptimizer::optimizeVertexCache(simplified, vertices.size());
+			lods.push_back({ static_cast<uint32_t>(indices.size()), static_cast<uint32_t>(simplified.size()), lods.back().error + levelError });
+			indices.insert(indices.end(), simplified.begin(), simplified.end());
+			previous.swap(simplified);
+		}
+		return lods;
+	}
+
+private:
+	struct Collapse
+	{
+		unsigned int from;
+		unsigned int to;
+		double cost;
+	};
+
+	// Area weighted triangle planes, plus planes along open edges so borders keep their outline
+	static std::vector<Quadric> computeQuadrics(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& positionIds, const std::vector<unsigned int>& indices)
+	{
+		std::vector<Quadric> quadrics(vertices.size());
+		std::vector<uint64_t> edges;
+		edges.reserve(indices.size());
+
+		for (size_t first = 0; first + 3 <= indices.size(); first += 3)
+		{
+			unsigned int corners[3] = { positionIds[indices[first]], positionIds[indices[first + 1]], positionIds[indices[first + 2]] };
+			glm::dvec3 a = vertices[corners[0]].position, b = vertices[corners[1]].position, c = vertices[corners[2]].position;
+			glm::dvec3 normal = glm::cross(b - a, c - a);
+			double length = glm::length(normal);
+			if (length == 0.0)
+				continue;
+			normal /= length;
+
+			Quadric q = Quadric::plane(normal, -glm::dot(normal, a), length * 0.5);
+			for (unsigned int corner : corners)
+				quadrics[corner] += q;
+			for (int edge = 0; edge < 3; ++edge)
+				edges.push_back(static_cast<uint64_t>(corners[edge]) << 32 | corners[(edge + 1) % 3]);
+		}
+
+		std::sort(edges.begin(), edges.end());
+		for (size_t first = 0; first + 3 <= indices.size(); first += 3)
+		{
+			unsigned int corners[3] = { positionIds[indices[first]], positionIds[indices[first + 1]], positionIds[indices[first + 2]] };
+			glm::dvec3 a = vertices[corners[0]].position, b = vertices[corners[1]].position, c = vertices[corners[2]].position;
+			glm::dvec3 normal = glm::cross(b - a, c - a);
+			if (glm::length(normal) == 0.0)
+				continue;
+
+			for (int edge = 0; edge < 3; ++edge)
+			{
+				unsigned int from = corners[edge], to = corners[(edge + 1) % 3];
+				if (std::binary_search(edges.begin(), edges.end(), static_cast<uint64_t>(to) << 32 | from))
+					continue;
+
+				glm::dvec3 p0 = vertices[from].position, p1 = vertices[to].position;
+				glm::dvec3 border = glm::cross(p1 - p0, normal);
+				double length = glm::length(border);
+				if (length == 0.0)
+					continue;
+				border /= length;
+
+				Quadric q = Quadric::plane(border, -glm::dot(border, p0), glm::dot(p1 - p0, p1 - p0) * 10.0);
+				quadrics[from] += q;
+				quadrics[to] += q;
+			}
+		}
+		return quadrics;
+	}
+
+	// Triangles around every position, flattened into one array
+	static void buildAdjacency(const std::vector<unsigned int>& indices, const std::vector<unsigned int>& positionIds, size_t vertexCount,
+		std::vector<size_t>& adjacencyStart, std::vector<unsigned int>& adjacency)
+	{
+		adjacencyStart.assign(vertexCount + 1, 0);
+		for (unsigned int index : indices)
+			++adjacencyStart[positionIds[index] + 1];
+		for (size_t position = 0; position < vertexCount; ++position)
+			adjacencyStart[position + 1] += adjacencyStart[position];
+
+		adjacency.resize(indices.size());
+		std::vector<size_t> fill(adjacencyStart.begin(), adjacencyStart.end() - 1);
+		for (size_t i = 0; i < indices.size(); ++i)
+			adjacency[fill[positionIds[indices[i]]]++] = static_cast<unsigned int>(i / 3);
+	}
+
+	// Every edge once, collapsed in whichever direction costs less
+	static void findCollapses(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& positionIds, const std::vector<unsigned int>& indices,
+		const std::vector<Quadric>& quadrics, std::vector<Collapse>& collapses)
+	{
+		std::vector<uint64_t> edges;
+		edges.reserve(indices.size());
+		for (size_t first = 0; first + 3 <= indices.size(); first += 3)
+		{
+			for (int edge = 0; edge < 3; ++edge)
+			{
+				unsigned int a = positionIds[indices[first + edge]];
+				unsigned int b = positionIds[indices[first + (edge + 1) % 3]];
+				edges.push_back(static_cast<uint64_t>(std::min(a, b)) << 32 | std::max(a, b));
+			}
+		}
+		std::sort(edges.begin(), edges.end());
+		edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+
+		collapses.clear();
+		collapses.reserve(edges.size());
+		for (uint64_t edge : edges)
+		{
+			unsigned int a = static_cast<unsigned int>(edge >> 32);
+			unsigned int b = static_cast<unsigned int>(edge & 0xffffffffu);
+			Quadric combined = quadrics[a];
+			combined += quadrics[b];
+
+			double toA = combined.error(vertices[a].position);
+			double toB = combined.error(vertices[b].position);
+			if (toB <= toA)
+				collapses.push_back({ a, b, toB });
+			else
+				collapses.push_back({ b, a, toA });
+		}
+	}
+
+	// True if moving collapse.from onto collapse.to turns any surviving triangle around
+	static bool flipsTriangle(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& positionIds, const std::vector<unsigned int>& indices,
+		const std::vector<size_t>& adjacencyStart, const std::vector<unsigned int>& adjacency, const Collapse& collapse)
+	{
+		const glm::vec3& target = vertices[collapse.to].position;
+		for (size_t a = adjacencyStart[collapse.from]; a < adjacencyStart[collapse.from + 1]; ++a)
+		{
+			unsigned int corners[3] = {
+				positionIds[indices[adjacency[a] * 3 + 0]],
+				positionIds[indices[adjacency[a] * 3 + 1]],
+				positionIds[indices[adjacency[a] * 3 + 2]] };
+			if (corners[0] == collapse.to || corners[1] == collapse.to || corners[2] == collapse.to)
+				continue;
+
+			glm::vec3 before[3], after[3];
+			for (int corner = 0; corner < 3; ++corner)
+			{
+				before[corner] = vertices[corners[corner]].position;
+				after[corner] = corners[corner] == collapse.from ? target : before[corner];
+			}
+			glm::vec3 normalBefore = glm::cross(before[1] - before[0], before[2] - before[0]);
+			glm::vec3 normalAfter = glm::cross(after[1] - after[0], after[2] - after[0]);
+			if (glm::dot(normalBefore, normalAfter) <= 0.25f * glm::length(normalBefore) * glm::length(normalAfter))
+				return true;
+		}
+		return false;
+	}
+
+	static unsigned int closestSibling(const std::vector<Vertex>& vertices, const Vertex& vertex, const unsigned int* candidates, size_t count)
+	{
+		unsigned int best = candidates[0];
+		float bestDistance = -1.f;
+		for (size_t i = 0; i < count; ++i)
+		{
+			const Vertex& candidate = vertices[candidates[i]];
+			glm::vec2 texCoord = candidate.texCoord - vertex.texCoord;
+			glm::vec3 normal = candidate.normal - vertex.normal;
+			float distance = glm::dot(texCoord, texCoord) + glm::dot(normal, normal);
+			if (bestDistance < 0.f || distance < bestDistance)
+			{
+				best = candidates[i];
+				bestDistance = distance;
+			}
+		}
+		return best;
+	}
+};
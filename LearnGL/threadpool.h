@@ -0,0 +1,154 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Fixed set of worker threads that split an indexed batch of tasks with the calling thread
+class ThreadPool
+{
+private:
+	std::vector<std::thread> workers;
+	std::mutex mutex;
+	std::mutex runMutex;
+	std::condition_variable wake;
+	std::condition_variable done;
+
+	const std::function<void(size_t)>* task;
+	size_t taskCount;
+	std::atomic<size_t> nextTask;
+	size_t finishedWorkers;
+	unsigned long long generation;
+	bool stopping;
+
+public:
+	// threadCount includes the calling thread, 0 picks one per hardware thread
+	ThreadPool(unsigned int threadCount = 0)
+		: task(nullptr), taskCount(0), nextTask(0), finishedWorkers(0), generation(0), stopping(false)
+	{
+		if (threadCount == 0)
+			threadCount = std::thread::hardware_concurrency();
+		if (threadCount == 0)
+			threadCount = 1;
+
+		for (unsigned int i = 1; i < threadCount; ++i)
+			workers.emplace_back(&ThreadPool::workerLoop, this);
+	}
+
+	~ThreadPool()
+	{
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			stopping = true;
+		}
+		wake.notify_all();
+		for (std::thread& worker : workers)
+			worker.join();
+	}
+
+	ThreadPool(const ThreadPool&) = delete;
+	ThreadPool& operator=(const ThreadPool&) = delete;
+
+	static ThreadPool& shared()
+	{
+		static ThreadPool pool;
+		return pool;
+	}
+
+	unsigned int getThreadCount() const
+	{
+		return static_cast<unsigned int>(workers.size()) + 1;
+	}
+
+	// Calls fn(i) for every i in [0, count) and returns once all of them have finished.
+	// Tasks must not call run() on the same pool.
+	void run(size_t count, const std::function<void(size_t)>& fn)
+	{
+		if (count == 0)
+			return;
+
+		if (workers.empty() || count == 1)
+		{
+			for (size_t i = 0; i < count; ++i)
+				fn(i);
+			return;
+		}
+
+		std::lock_guard<std::mutex> runLock(runMutex);
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			task = &fn;
+			taskCount = count;
+			nextTask = 0;
+			finishedWorkers = 0;
+			++generation;
+		}
+		wake.notify_all();
+
+		drain(fn, count);
+
+		// Every worker has to check in, otherwise a late one could still read this batch's task
+		std::unique_lock<std::mutex> lock(mutex);
+		done.wait(lock, [this] { return finishedWorkers == workers.size(); });
+		task = nullptr;
+	}
+
+	// Splits [0, count) into contiguous ranges and calls fn(begin, end) for each
+	void parallelFor(size_t count, size_t minRange, const std::function<void(size_t, size_t)>& fn)
+	{
+		if (count == 0)
+			return;
+		if (minRange == 0)
+			minRange = 1;
+
+		size_t rangeCount = getThreadCount() * 4;
+		if (rangeCount > (count + minRange - 1) / minRange)
+			rangeCount = (count + minRange - 1) / minRange;
+		size_t rangeSize = (count + rangeCount - 1) / rangeCount;
+
+		run(rangeCount, [&](size_t range)
+		{
+			size_t begin = range * rangeSize;
+			size_t end = begin + rangeSize < count ? begin + rangeSize : count;
+			if (begin < end)
+				fn(begin, end);
+		});
+	}
+
+private:
+	void drain(const std::function<void(size_t)>& fn, size_t count)
+	{
+		for (size_t i = nextTask.fetch_add(1); i < count; i = nextTask.fetch_add(1))
+			fn(i);
+	}
+
+	void workerLoop()
+	{
+		unsigned long long seenGeneration = 0;
+		while (true)
+		{
+			const std::function<void(size_t)>* current;
+			size_t count;
+			{
+				std::unique_lock<std::mutex> lock(mutex);
+				wake.wait(lock, [&] { return stopping || generation != seenGeneration; });
+				if (stopping)
+					return;
+				seenGeneration = generation;
+				current = task;
+				count = taskCount;
+			}
+
+			drain(*current, count);
+
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				++finishedWorkers;
+			}
+			done.notify_one();
+		}
+	}
+};
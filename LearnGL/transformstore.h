@@ -0,0 +1,603 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+#include "instancebatch.h"
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define TRANSFORM_SIMD_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+// MSVC emits VEX code for AVX intrinsics without /arch:AVX2
+#define TRANSFORM_TARGET_AVX2
+#else
+#define TRANSFORM_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+enum class TransformComposer
+{
+	Scalar,
+	Sse,
+	Avx2
+};
+
+// Instances composed in the last compose() call
+struct ComposeRange
+{
+	size_t first = 0;
+	size_t end = 0;
+	size_t composed = 0;
+};
+
+// Translation, rotation and scale of every instance in structure of arrays form, plus the model
+// matrices built from them. Setters only mark the instance's block of blockSize dirty, compose()
+// rebuilds the matrices of dirty blocks in one SIMD pass, blockSize instances at a time.
+// setMatrix() keeps matrices that are not translation * rotation * scale, sheared or projective ones,
+// exactly as given, compose() writes them over the composed ones.
+class TransformStore
+{
+public:
+	static const size_t blockSize = 8;
+
+private:
+	size_t count;
+	// Padded to a whole number of blocks so SIMD loads never run past the end
+	std::vector<float> positionX, positionY, positionZ;
+	std::vector<float> rotationX, rotationY, rotationZ, rotationW;
+	std::vector<float> scaleX, scaleY, scaleZ;
+	std::vector<glm::mat4> matrices;
+	std::vector<char> exact;					// per slot, 1 when exactMatrices holds its matrix
+	std::vector<glm::mat4> exactMatrices;		// empty until the first matrix that does not split
+	std::vector<char> dirtyBlocks;
+	size_t firstDirtyBlock;
+	size_t endDirtyBlock;
+	TransformComposer composer;
+
+public:
+	TransformStore()
+		: count(0), firstDirtyBlock(0), endDirtyBlock(0), composer(bestComposer())
+	{
+	}
+
+	size_t size() const
+	{
+		return count;
+	}
+
+	bool isDirty() const
+	{
+		return firstDirtyBlock < endDirtyBlock;
+	}
+
+	// Model matrices as of the last compose(), only the first size() are instances, the rest is block padding
+	const std::vector<glm::mat4>& getMatrices() const
+	{
+		return matrices;
+	}
+
+	const glm::mat4& getMatrix(size_t index) const
+	{
+		return matrices[index];
+	}
+
+	glm::vec3 getPosition(size_t index) const
+	{
+		return glm::vec3(positionX[index], positionY[index], positionZ[index]);
+	}
+
+	glm::quat getRotation(size_t index) const
+	{
+		return glm::quat(rotationW[index], rotationX[index], rotationY[index], rotationZ[index]);
+	}
+
+	glm::vec3 getScale(size_t index) const
+	{
+		return glm::vec3(scaleX[index], scaleY[index], scaleZ[index]);
+	}
+
+	TransformComposer getComposer() const
+	{
+		return composer;
+	}
+
+	// Falls back to the best supported composer when the requested one is not
+	void setComposer(TransformComposer requested)
+	{
+		composer = supports(requested) ? requested : bestComposer();
+	}
+
+	void reserve(size_t capacity)
+	{
+		size_t padded = paddedSize(capacity);
+		for (std::vector<float>* array : arrays())
+			array->reserve(padded);
+		matrices.reserve(padded);
+		exact.reserve(padded);
+		dirtyBlocks.reserve(padded / blockSize);
+	}
+
+	size_t add(const glm::vec3& position, const glm::quat& rotation = glm::quat(1.f, 0.f, 0.f, 0.f), const glm::vec3& scale = glm::vec3(1.f))
+	{
+		size_t index = count;
+		resize(count + 1);
+		set(index, position, rotation, scale);
+		return index;
+	}
+
+	size_t add(const glm::mat4& matrix)
+	{
+		size_t index = count;
+		resize(count + 1);
+		setMatrix(index, matrix);
+		return index;
+	}
+
+	// Appends count instances with one resize, null rotations or scales mean identity and unit scale
+	size_t addMany(const glm::vec3* positions, const glm::quat* rotations, const glm::vec3* scales, size_t added)
+	{
+		size_t first = count;
+		resize(count + added);
+		for (size_t i = 0; i < added; ++i)
+			write(first + i, positions[i], rotations ? rotations[i] : glm::quat(1.f, 0.f, 0.f, 0.f), scales ? scales[i] : glm::vec3(1.f));
+		markDirty(first, count);
+		return first;
+	}
+
+	// Swap and pop, the last instance moves into index and only that slot is recomposed
+	void remove(size_t index)
+	{
+		if (index >= count)
+			return;
+		size_t last = count - 1;
+		if (index != last)
+		{
+			for (std::vector<float>* array : arrays())
+				(*array)[index] = (*array)[last];
+			exact[index] = exact[last];
+			if (exact[index])
+				exactMatrices[index] = exactMatrices[last];
+			markDirty(index, index + 1);
+		}
+		exact[last] = 0;
+		resize(last);
+	}
+
+	// sortedIds ascending without duplicates, removed highest first so the ids still to go never move
+	void removeMany(const std::vector<uint32_t>& sortedIds)
+	{
+		if (sortedIds.empty() || sortedIds.back() >= count)
+			return;
+		for (size_t i = sortedIds.size(); i-- > 0;)
+			remove(sortedIds[i]);
+	}
+
+	// Reorders the instances so slot i takes old slot order[i], only the span of slots that changed is moved and recomposed
+	void permute(const uint32_t* order)
+	{
+		size_t first = 0, end = count;
+		while (first < end && order[first] == first)
+			++first;
+		while (end > first && order[end - 1] == end - 1)
+			--end;
+		if (first == end)
+			return;
+
+		std::vector<float> moved(end - first);
+		for (std::vector<float>* array : arrays())
+		{
+			for (size_t i = first; i < end; ++i)
+				moved[i - first] = (*array)[order[i]];
+			std::copy(moved.begin(), moved.end(), array->begin() + first);
+		}
+		std::vector<char> movedExact(end - first);
+		for (size_t i = first; i < end; ++i)
+			movedExact[i - first] = exact[order[i]];
+		if (!exactMatrices.empty())
+		{
+			std::vector<glm::mat4> movedMatrices(end - first);
+			for (size_t i = first; i < end; ++i)
+				movedMatrices[i - first] = exactMatrices[order[i]];
+			std::copy(movedMatrices.begin(), movedMatrices.end(), exactMatrices.begin() + first);
+		}
+		std::copy(movedExact.begin(), movedExact.end(), exact.begin() + first);
+		markDirty(first, end);
+	}
+
+	void clear()
+	{
+		resize(0);
+		firstDirtyBlock = endDirtyBlock = 0;
+	}
+
+	void set(size_t index, const glm::vec3& position, const glm::quat& rotation, const glm::vec3& scale)
+	{
+		write(index, position, rotation, scale);
+		markDirty(index, index + 1);
+	}
+
+	// Overwrites the components given for every id, null arrays leave that component as it is. Only the
+	// blocks holding ids are recomposed, the dirty range is widened once for the whole batch.
+	void setMany(const uint32_t* ids, size_t idCount, const glm::vec3* positions, const glm::quat* rotations, const glm::vec3* scales)
+	{
+		if (idCount == 0)
+			return;
+		size_t first = ids[0], last = ids[0];
+		for (size_t i = 0; i < idCount; ++i)
+		{
+			size_t index = ids[i];
+			if (positions)
+			{
+				positionX[index] = positions[i].x;
+				positionY[index] = positions[i].y;
+				positionZ[index] = positions[i].z;
+				if (exact[index])
+					exactMatrices[index][3] = glm::vec4(positions[i], exactMatrices[index][3].w);
+			}
+			// A new rotation or scale replaces an exact matrix with the components
+			if (rotations || scales)
+				exact[index] = 0;
+			if (rotations)
+			{
+				rotationX[index] = rotations[i].x;
+				rotationY[index] = rotations[i].y;
+				rotationZ[index] = rotations[i].z;
+				rotationW[index] = rotations[i].w;
+			}
+			if (scales)
+			{
+				scaleX[index] = scales[i].x;
+				scaleY[index] = scales[i].y;
+				scaleZ[index] = scales[i].z;
+			}
+			dirtyBlocks[index / blockSize] = 1;
+			first = glm::min(first, index);
+			last = glm::max(last, index);
+		}
+		widenDirtyRange(first / blockSize, last / blockSize + 1);
+	}
+
+	void setPosition(size_t index, const glm::vec3& position)
+	{
+		positionX[index] = position.x;
+		positionY[index] = position.y;
+		positionZ[index] = position.z;
+		if (exact[index])
+			exactMatrices[index][3] = glm::vec4(position, exactMatrices[index][3].w);
+		markDirty(index, index + 1);
+	}
+
+	// Replaces an exact matrix with the components
+	void setRotation(size_t index, const glm::quat& rotation)
+	{
+		exact[index] = 0;
+		rotationX[index] = rotation.x;
+		rotationY[index] = rotation.y;
+		rotationZ[index] = rotation.z;
+		rotationW[index] = rotation.w;
+		markDirty(index, index + 1);
+	}
+
+	// Replaces an exact matrix with the components
+	void setScale(size_t index, const glm::vec3& scale)
+	{
+		exact[index] = 0;
+		scaleX[index] = scale.x;
+		scaleY[index] = scale.y;
+		scaleZ[index] = scale.z;
+		markDirty(index, index + 1);
+	}
+
+	// Splits the matrix into translation, rotation and scale. When those do not compose back to it the matrix
+	// is kept exactly, the components then only approximate it for whatever reads them, such as spatial
+	// sorting and the quaternion instance formats.
+	void setMatrix(size_t index, const glm::mat4& matrix)
+	{
+		glm::vec3 scale(glm::length(glm::vec3(matrix[0])), glm::length(glm::vec3(matrix[1])), glm::length(glm::vec3(matrix[2])));
+		glm::mat3 rotation(
+			scale.x > 0.f ? glm::vec3(matrix[0]) / scale.x : glm::vec3(1.f, 0.f, 0.f),
+			scale.y > 0.f ? glm::vec3(matrix[1]) / scale.y : glm::vec3(0.f, 1.f, 0.f),
+			scale.z > 0.f ? glm::vec3(matrix[2]) / scale.z : glm::vec3(0.f, 0.f, 1.f));
+		if (glm::determinant(rotation) < 0.f)
+		{
+			scale.x = -scale.x;
+			rotation[0] = -rotation[0];
+		}
+		glm::quat orientation = glm::normalize(glm::quat_cast(rotation));
+		write(index, glm::vec3(matrix[3]), orientation, scale);
+		if (!splitsExactly(matrix, orientation, scale))
+		{
+			if (exactMatrices.empty())
+				exactMatrices.resize(matrices.size(), glm::mat4(1.f));
+			exact[index] = 1;
+			exactMatrices[index] = matrix;
+		}
+		markDirty(index, index + 1);
+	}
+
+	// Whether translation, rotation and scale compose back to matrix within float precision
+	static bool splitsExactly(const glm::mat4& matrix, const glm::quat& rotation, const glm::vec3& scale)
+	{
+		glm::mat3 basis = glm::mat3_cast(rotation);
+		float magnitude = 1.f;
+		for (int column = 0; column < 4; ++column)
+			magnitude = glm::max(magnitude, glm::length(matrix[column]));
+		float tolerance = 1e-4f * magnitude;
+		for (int column = 0; column < 3; ++column)
+		{
+			glm::vec4 composed(basis[column] * scale[column], 0.f);
+			if (glm::any(glm::greaterThan(glm::abs(composed - matrix[column]), glm::vec4(tolerance))))
+				return false;
+		}
+		return matrix[3].w == 1.f;
+	}
+
+	// Rebuilds the matrices of every dirty block
+	ComposeRange compose()
+	{
+		ComposeRange range;
+		if (!isDirty())
+			return range;
+
+		range.first = firstDirtyBlock * blockSize;
+		range.end = glm::min(endDirtyBlock * blockSize, count);
+		for (size_t block = firstDirtyBlock; block < endDirtyBlock; ++block)
+		{
+			if (!dirtyBlocks[block])
+				continue;
+			dirtyBlocks[block] = 0;
+			composeBlock(block * blockSize);
+			if (!exactMatrices.empty())
+				for (size_t i = block * blockSize; i < (block + 1) * blockSize; ++i)
+					if (exact[i])
+						matrices[i] = exactMatrices[i];
+			range.composed += blockSize;
+		}
+		range.composed = glm::min(range.composed, range.end - range.first);
+		firstDirtyBlock = endDirtyBlock = 0;
+		return range;
+	}
+
+	// Marks every instance dirty, for benchmarks and after switching composers
+	void markAllDirty()
+	{
+		markDirty(0, count);
+	}
+
+	static bool supports(TransformComposer requested)
+	{
+		if (requested == TransformComposer::Scalar)
+			return true;
+#ifdef TRANSFORM_SIMD_X86
+		if (requested == TransformComposer::Sse)
+			return true;
+		return cpuHasAvx2();
+#else
+		return false;
+#endif
+	}
+
+	static TransformComposer bestComposer()
+	{
+		if (supports(TransformComposer::Avx2))
+			return TransformComposer::Avx2;
+		if (supports(TransformComposer::Sse))
+			return TransformComposer::Sse;
+		return TransformComposer::Scalar;
+	}
+
+	static const char* composerName(TransformComposer composer)
+	{
+		switch (composer)
+		{
+		case TransformComposer::Avx2: return "AVX2";
+		case TransformComposer::Sse: return "SSE";
+		default: return "scalar";
+		}
+	}
+
+private:
+	std::array<std::vector<float>*, 10> arrays()
+	{
+		return { &positionX, &positionY, &positionZ, &rotationX, &rotationY, &rotationZ, &rotationW, &scaleX, &scaleY, &scaleZ };
+	}
+
+	static size_t paddedSize(size_t size)
+	{
+		return (size + blockSize - 1) / blockSize * blockSize;
+	}
+
+	void resize(size_t newCount)
+	{
+		count = newCount;
+		size_t padded = paddedSize(count);
+		for (std::vector<float>* array : arrays())
+			array->resize(padded, 0.f);
+		matrices.resize(padded, glm::mat4(1.f));
+		exact.resize(padded, 0);
+		if (!exactMatrices.empty())
+			exactMatrices.resize(padded, glm::mat4(1.f));
+		dirtyBlocks.resize(padded / blockSize, 0);
+		endDirtyBlock = glm::min(endDirtyBlock, dirtyBlocks.size());
+		firstDirtyBlock = glm::min(firstDirtyBlock, endDirtyBlock);
+	}
+
+	void write(size_t index, const glm::vec3& position, const glm::quat& rotation, const glm::vec3& scale)
+	{
+		exact[index] = 0;
+		positionX[index] = position.x;
+		positionY[index] = position.y;
+		positionZ[index] = position.z;
+		rotationX[index] = rotation.x;
+		rotationY[index] = rotation.y;
+		rotationZ[index] = rotation.z;
+		rotationW[index] = rotation.w;
+		scaleX[index] = scale.x;
+		scaleY[index] = scale.y;
+		scaleZ[index] = scale.z;
+	}
+
+	void markDirty(size_t first, size_t end)
+	{
+		if (first >= end)
+			return;
+		size_t firstBlock = first / blockSize;
+		size_t endBlock = (end + blockSize - 1) / blockSize;
+		for (size_t block = firstBlock; block < endBlock; ++block)
+			dirtyBlocks[block] = 1;
+		widenDirtyRange(firstBlock, endBlock);
+	}
+
+	void widenDirtyRange(size_t firstBlock, size_t endBlock)
+	{
+		if (firstDirtyBlock == endDirtyBlock)
+		{
+			firstDirtyBlock = firstBlock;
+			endDirtyBlock = endBlock;
+			return;
+		}
+		firstDirtyBlock = glm::min(firstDirtyBlock, firstBlock);
+		endDirtyBlock = glm::max(endDirtyBlock, endBlock);
+	}
+
+	void composeBlock(size_t first)
+	{
+#ifdef TRANSFORM_SIMD_X86
+		if (composer == TransformComposer::Avx2)
+		{
+			composeAvx2(first);
+			return;
+		}
+		if (composer == TransformComposer::Sse)
+		{
+			for (size_t offset = 0; offset < blockSize; offset += 4)
+				composeSse(first + offset);
+			return;
+		}
+#endif
+		for (size_t i = first; i < first + blockSize; ++i)
+			composeScalar(i);
+	}
+
+	// M = T * R * S, the columns are the rotation's columns times the scale, then the translation
+	void composeScalar(size_t i)
+	{
+		float x = rotationX[i], y = rotationY[i], z = rotationZ[i], w = rotationW[i];
+		float xx = x * x, yy = y * y, zz = z * z;
+		float xy = x * y, xz = x * z, yz = y * z;
+		float wx = w * x, wy = w * y, wz = w * z;
+
+		glm::mat4& m = matrices[i];
+		m[0] = glm::vec4((1.f - 2.f * (yy + zz)) * scaleX[i], 2.f * (xy + wz) * scaleX[i], 2.f * (xz - wy) * scaleX[i], 0.f);
+		m[1] = glm::vec4(2.f * (xy - wz) * scaleY[i], (1.f - 2.f * (xx + zz)) * scaleY[i], 2.f * (yz + wx) * scaleY[i], 0.f);
+		m[2] = glm::vec4(2.f * (xz + wy) * scaleZ[i], 2.f * (yz - wx) * scaleZ[i], (1.f - 2.f * (xx + yy)) * scaleZ[i], 0.f);
+		m[3] = glm::vec4(positionX[i], positionY[i], positionZ[i], 1.f);
+	}
+
+#ifdef TRANSFORM_SIMD_X86
+	static bool cpuHasAvx2()
+	{
+#if defined(_MSC_VER)
+		int info[4];
+		__cpuid(info, 0);
+		if (info[0] < 7)
+			return false;
+		__cpuid(info, 1);
+		bool osSavesAvx = (info[2] & (1 << 27)) && (info[2] & (1 << 28)) && (_xgetbv(0) & 6) == 6;
+		__cpuidex(info, 7, 0);
+		return osSavesAvx && (info[1] & (1 << 5));
+#else
+		return __builtin_cpu_supports("avx2");
+#endif
+	}
+
+	// Four instances, the 4x4 transposes turn lanes (one per instance) into matrix columns
+	void composeSse(size_t i)
+	{
+		__m128 x = _mm_loadu_ps(&rotationX[i]), y = _mm_loadu_ps(&rotationY[i]), z = _mm_loadu_ps(&rotationZ[i]), w = _mm_loadu_ps(&rotationW[i]);
+		__m128 sx = _mm_loadu_ps(&scaleX[i]), sy = _mm_loadu_ps(&scaleY[i]), sz = _mm_loadu_ps(&scaleZ[i]);
+		__m128 one = _mm_set1_ps(1.f), two = _mm_set1_ps(2.f), zero = _mm_setzero_ps();
+
+		__m128 xx = _mm_mul_ps(x, x), yy = _mm_mul_ps(y, y), zz = _mm_mul_ps(z, z);
+		__m128 xy = _mm_mul_ps(x, y), xz = _mm_mul_ps(x, z), yz = _mm_mul_ps(y, z);
+		__m128 wx = _mm_mul_ps(w, x), wy = _mm_mul_ps(w, y), wz = _mm_mul_ps(w, z);
+
+		__m128 c0x = _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(yy, zz))), sx);
+		__m128 c0y = _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(xy, wz)), sx);
+		__m128 c0z = _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(xz, wy)), sx);
+		__m128 c1x = _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(xy, wz)), sy);
+		__m128 c1y = _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, zz))), sy);
+		__m128 c1z = _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(yz, wx)), sy);
+		__m128 c2x = _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(xz, wy)), sz);
+		__m128 c2y = _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(yz, wx)), sz);
+		__m128 c2z = _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, yy))), sz);
+		__m128 c3x = _mm_loadu_ps(&positionX[i]), c3y = _mm_loadu_ps(&positionY[i]), c3z = _mm_loadu_ps(&positionZ[i]);
+
+		storeColumnsSse(i, 0, c0x, c0y, c0z, zero);
+		storeColumnsSse(i, 1, c1x, c1y, c1z, zero);
+		storeColumnsSse(i, 2, c2x, c2y, c2z, zero);
+		storeColumnsSse(i, 3, c3x, c3y, c3z, one);
+	}
+
+	void storeColumnsSse(size_t i, int column, __m128 a, __m128 b, __m128 c, __m128 d)
+	{
+		_MM_TRANSPOSE4_PS(a, b, c, d);
+		_mm_storeu_ps(&matrices[i + 0][column][0], a);
+		_mm_storeu_ps(&matrices[i + 1][column][0], b);
+		_mm_storeu_ps(&matrices[i + 2][column][0], c);
+		_mm_storeu_ps(&matrices[i + 3][column][0], d);
+	}
+
+	// Eight instances, each 128 bit half goes through the same transpose as the SSE path
+	TRANSFORM_TARGET_AVX2 void composeAvx2(size_t i)
+	{
+		__m256 x = _mm256_loadu_ps(&rotationX[i]), y = _mm256_loadu_ps(&rotationY[i]), z = _mm256_loadu_ps(&rotationZ[i]), w = _mm256_loadu_ps(&rotationW[i]);
+		__m256 sx = _mm256_loadu_ps(&scaleX[i]), sy = _mm256_loadu_ps(&scaleY[i]), sz = _mm256_loadu_ps(&scaleZ[i]);
+		__m256 one = _mm256_set1_ps(1.f), two = _mm256_set1_ps(2.f), zero = _mm256_setzero_ps();
+
+		__m256 xx = _mm256_mul_ps(x, x), yy = _mm256_mul_ps(y, y), zz = _mm256_mul_ps(z, z);
+		__m256 xy = _mm256_mul_ps(x, y), xz = _mm256_mul_ps(x, z), yz = _mm256_mul_ps(y, z);
+		__m256 wx = _mm256_mul_ps(w, x), wy = _mm256_mul_ps(w, y), wz = _mm256_mul_ps(w, z);
+
+		__m256 c0x = _mm256_mul_ps(_mm256_sub_ps(one, _mm256_mul_ps(two, _mm256_add_ps(yy, zz))), sx);
+		__m256 c0y = _mm256_mul_ps(_mm256_mul_ps(two, _mm256_add_ps(xy, wz)), sx);
+		__m256 c0z = _mm256_mul_ps(_mm256_mul_ps(two, _mm256_sub_ps(xz, wy)), sx);
+		__m256 c1x = _mm256_mul_ps(_mm256_mul_ps(two, _mm256_sub_ps(xy, wz)), sy);
+		__m256 c1y = _mm256_mul_ps(_mm256_sub_ps(one, _mm256_mul_ps(two, _mm256_add_ps(xx, zz))), sy);
+		__m256 c1z = _mm256_mul_ps(_mm256_mul_ps(two, _mm256_add_ps(yz, wx)), sy);
+		__m256 c2x = _mm256_mul_ps(_mm256_mul_ps(two, _mm256_add_ps(xz, wy)), sz);
+		__m256 c2y = _mm256_mul_ps(_mm256_mul_ps(two, _mm256_sub_ps(yz, wx)), sz);
+		__m256 c2z = _mm256_mul_ps(_mm256_sub_ps(one, _mm256_mul_ps(two, _mm256_add_ps(xx, yy))), sz);
+		__m256 c3x = _mm256_loadu_ps(&positionX[i]), c3y = _mm256_loadu_ps(&positionY[i]), c3z = _mm256_loadu_ps(&positionZ[i]);
+
+		storeColumnsAvx2(i, 0, c0x, c0y, c0z, zero);
+		storeColumnsAvx2(i, 1, c1x, c1y, c1z, zero);
+		storeColumnsAvx2(i, 2, c2x, c2y, c2z, zero);
+		storeColumnsAvx2(i, 3, c3x, c3y, c3z, one);
+	}
+
+	TRANSFORM_TARGET_AVX2 void storeColumnsAvx2(size_t i, int column, __m256 a, __m256 b, __m256 c, __m256 d)
+	{
+		__m256 ab0 = _mm256_unpacklo_ps(a, b), ab1 = _mm256_unpackhi_ps(a, b);
+		__m256 cd0 = _mm256_unpacklo_ps(c, d), cd1 = _mm256_unpackhi_ps(c, d);
+		__m256 columns[4] = {
+			_mm256_shuffle_ps(ab0, cd0, _MM_SHUFFLE(1, 0, 1, 0)),
+			_mm256_shuffle_ps(ab0, cd0, _MM_SHUFFLE(3, 2, 3, 2)),
+			_mm256_shuffle_ps(ab1, cd1, _MM_SHUFFLE(1, 0, 1, 0)),
+			_mm256_shuffle_ps(ab1, cd1, _MM_SHUFFLE(3, 2, 3, 2)) };
+		for (int k = 0; k < 4; ++k)
+		{
+			_mm_storeu_ps(&matrices[i + k][column][0], _mm256_castps256_ps128(columns[k]));
+			_mm_storeu_ps(&matrices[i + 4 + k][column][0], _mm256_extractf128_ps(columns[k], 1));
+		}
+	}
+#endif
+};
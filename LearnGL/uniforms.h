@@ -0,0 +1,197 @@
+#pragma once
+
+#include <glad/glad.h>
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+// FNV-1a, constexpr so names known at compile time can be hashed there
+constexpr uint32_t uniformHash(const char* name)
+{
+	uint32_t hash = 2166136261u;
+	for (; *name; ++name)
+		hash = (hash ^ static_cast<unsigned char>(*name)) * 16777619u;
+	return hash;
+}
+
+// A uniform's name with its hash, converts implicitly from literals and strings so setters take either.
+// For a literal the hash folds to a constant, static constexpr names make sure of it.
+struct UniformName
+{
+	uint32_t hash;
+	const char* text;
+
+	constexpr UniformName(const char* name)
+		: hash(uniformHash(name)), text(name)
+	{
+	}
+
+	UniformName(const std::string& name)
+		: hash(uniformHash(name.c_str())), text(name.c_str())
+	{
+	}
+};
+
+// Location resolved once with Shader::uniform(), checked against the uniform's declared type
+template<typename T>
+struct Uniform
+{
+	GLint location = -1;
+
+	bool valid() const
+	{
+		return location >= 0;
+	}
+};
+
+template<typename T> bool uniformTypeMatches(GLenum type);
+template<> inline bool uniformTypeMatches<float>(GLenum type) { return type == GL_FLOAT; }
+template<> inline bool uniformTypeMatches<glm::vec2>(GLenum type) { return type == GL_FLOAT_VEC2; }
+template<> inline bool uniformTypeMatches<glm::vec3>(GLenum type) { return type == GL_FLOAT_VEC3; }
+template<> inline bool uniformTypeMatches<glm::vec4>(GLenum type) { return type == GL_FLOAT_VEC4; }
+template<> inline bool uniformTypeMatches<glm::mat2>(GLenum type) { return type == GL_FLOAT_MAT2; }
+template<> inline bool uniformTypeMatches<glm::mat3>(GLenum type) { return type == GL_FLOAT_MAT3; }
+template<> inline bool uniformTypeMatches<glm::mat4>(GLenum type) { return type == GL_FLOAT_MAT4; }
+template<> inline bool uniformTypeMatches<bool>(GLenum type) { return type == GL_BOOL; }
+// Samplers are set as ints too
+template<> inline bool uniformTypeMatches<int>(GLenum type)
+{
+	return type == GL_INT || type == GL_BOOL || type == GL_SAMPLER_1D || type == GL_SAMPLER_2D || type == GL_SAMPLER_3D ||
+		type == GL_SAMPLER_CUBE || type == GL_SAMPLER_2D_ARRAY || type == GL_SAMPLER_2D_SHADOW || type == GL_SAMPLER_BUFFER ||
+		type == GL_INT_SAMPLER_2D || type == GL_UNSIGNED_INT_SAMPLER_2D;
+}
+
+inline void setUniform(GLint location, float value) { glUniform1f(location, value); }
+inline void setUniform(GLint location, int value) { glUniform1i(location, value); }
+inline void setUniform(GLint location, bool value) { glUniform1i(location, static_cast<int>(value)); }
+inline void setUniform(GLint location, const glm::vec2& value) { glUniform2fv(location, 1, &value[0]); }
+inline void setUniform(GLint location, const glm::vec3& value) { glUniform3fv(location, 1, &value[0]); }
+inline void setUniform(GLint location, const glm::vec4& value) { glUniform4fv(location, 1, &value[0]); }
+inline void setUniform(GLint location, const glm::mat2& value) { glUniformMatrix2fv(location, 1, GL_FALSE, &value[0][0]); }
+inline void setUniform(GLint location, const glm::mat3& value) { glUniformMatrix3fv(location, 1, GL_FALSE, &value[0][0]); }
+inline void setUniform(GLint location, const glm::mat4& value) { glUniformMatrix4fv(location, 1, GL_FALSE, &value[0][0]); }
+
+struct UniformInfo
+{
+	uint32_t hash = 0;		// 0 marks an empty slot
+	std::string name;		// compared on a hash match, so a name the program lacks never takes another's slot
+	GLint location = -1;
+	GLenum type = 0;
+	GLint size = 0;			// array length, 1 otherwise
+};
+
+// Every active uniform of a linked program in an open addressing table keyed by name hash, filled once
+// from glGetActiveUniform. Arrays are entered under their name, name[0] and every name[i]. Names sharing
+// a hash probe on like any other collision.
+class UniformTable
+{
+private:
+	std::vector<UniformInfo> slots;		// power of two, at most half full
+	uint32_t mask;
+	size_t count;
+
+public:
+	UniformTable()
+		: mask(0), count(0)
+	{
+	}
+
+	size_t size() const
+	{
+		return count;
+	}
+
+	void reflect(unsigned int program)
+	{
+		GLint active = 0, maxLength = 0;
+		glGetProgramiv(program, GL_ACTIVE_UNIFORMS, &active);
+		glGetProgramiv(program, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxLength);
+
+		std::vector<std::pair<std::string, UniformInfo>> found;
+		std::vector<char> buffer(glm::max(maxLength, 1));
+		for (GLint i = 0; i < active; ++i)
+		{
+			GLsizei length = 0;
+			UniformInfo info;
+			glGetActiveUniform(program, static_cast<GLuint>(i), maxLength, &length, &info.size, &info.type, buffer.data());
+			std::string name(buffer.data(), length);
+			info.location = glGetUniformLocation(program, name.c_str());
+			// Block members have no location and are set through their buffer
+			if (info.location < 0)
+				continue;
+
+			size_t bracket = name.find("[0]");
+			if (bracket == std::string::npos || bracket + 3 != name.size())
+			{
+				found.emplace_back(name, info);
+				continue;
+			}
+			std::string base = name.substr(0, bracket);
+			found.emplace_back(base, info);
+			found.emplace_back(name, info);
+			UniformInfo element = info;
+			element.size = 1;
+			for (GLint k = 1; k < info.size; ++k)
+			{
+				std::string elementName = base + '[' + std::to_string(k) + ']';
+				element.location = glGetUniformLocation(program, elementName.c_str());
+				found.emplace_back(elementName, element);
+			}
+		}
+
+		size_t capacity = 16;
+		while (capacity < found.size() * 2)
+			capacity *= 2;
+		slots.assign(capacity, UniformInfo());
+		mask = static_cast<uint32_t>(capacity - 1);
+		count = 0;
+		for (std::pair<std::string, UniformInfo>& entry : found)
+		{
+			entry.second.hash = hashOf(entry.first.c_str());
+			entry.second.name = entry.first;
+			insert(entry.second);
+		}
+	}
+
+	const UniformInfo* find(UniformName name) const
+	{
+		if (slots.empty())
+			return nullptr;
+		uint32_t hash = name.hash ? name.hash : 1;
+		for (uint32_t slot = hash & mask; slots[slot].hash; slot = (slot + 1) & mask)
+			if (slots[slot].hash == hash && std::strcmp(slots[slot].name.c_str(), name.text) == 0)
+				return &slots[slot];
+		return nullptr;
+	}
+
+	// -1 for names the program does not use, which glUniform* ignores like it did glGetUniformLocation's
+	GLint location(UniformName name) const
+	{
+		const UniformInfo* info = find(name);
+		return info ? info->location : -1;
+	}
+
+private:
+	static uint32_t hashOf(const char* name)
+	{
+		uint32_t hash = uniformHash(name);
+		return hash ? hash : 1;
+	}
+
+	// False when the name is in the table already
+	bool insert(const UniformInfo& info)
+	{
+		uint32_t slot = info.hash & mask;
+		for (; slots[slot].hash; slot = (slot + 1) & mask)
+			if (slots[slot].hash == info.hash && slots[slot].name == info.name)
+				return false;
+		slots[slot] = info;
+		++count;
+		return true;
+	}
+};
@@ -0,0 +1,229 @@
+#pragma once
+
+#include <glad/glad.h>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "objloader.h"
+
+enum class VertexFormat
+{
+	Full,		// Vertex, 32 bytes of floats
+	Compact		// CompactVertex, 16 bytes
+};
+
+// Position as unorm16 inside the mesh bounds, octahedral snorm16 normal, unorm16 texCoord inside the texCoord bounds
+struct CompactVertex
+{
+	uint16_t position[4];	// w only keeps the normal 4 byte aligned
+	int16_t normal[2];
+	uint16_t texCoord[2];
+};
+
+// Maps the normalized compact attributes back to mesh space
+struct VertexDequantization
+{
+	glm::vec3 positionScale = glm::vec3(1.f);
+	glm::vec3 positionOffset = glm::vec3(0.f);
+	glm::vec4 texCoordTransform = glm::vec4(1.f, 1.f, 0.f, 0.f);	// scale in xy, offset in zw
+};
+
+// Largest difference between the source and the decoded compact vertices
+struct QuantizationError
+{
+	float position = 0.f;			// mesh units
+	float normalDegrees = 0.f;
+	float texCoord = 0.f;
+	size_t bytesPerVertex = sizeof(Vertex);
+	size_t bytesSaved = 0;
+};
+
+// Generic attribute locations the compact vertex shader reads its dequantization from
+const GLuint positionScaleLocation = 7;
+const GLuint positionOffsetLocation = 8;
+const GLuint texCoordTransformLocation = 9;
+
+inline glm::vec2 octahedralEncode(const glm::vec3& normal)
+{
+	glm::vec3 n = normal / (std::abs(normal.x) + std::abs(normal.y) + std::abs(normal.z));
+	if (n.z >= 0.f)
+		return glm::vec2(n.x, n.y);
+
+	// Fold the lower hemisphere over the diagonals
+	return glm::vec2(
+		(1.f - std::abs(n.y)) * (n.x >= 0.f ? 1.f : -1.f),
+		(1.f - std::abs(n.x)) * (n.y >= 0.f ? 1.f : -1.f));
+}
+
+inline glm::vec3 octahedralDecode(const glm::vec2& encoded)
+{
+	glm::vec3 n(encoded.x, encoded.y, 1.f - std::abs(encoded.x) - std::abs(encoded.y));
+	float t = glm::max(-n.z, 0.f);
+	n.x += n.x >= 0.f ? -t : t;
+	n.y += n.y >= 0.f ? -t : t;
+	return glm::normalize(n);
+}
+
+class VertexQuantizer
+{
+public:
+	// Fills compact with one CompactVertex per vertex and returns what the shader needs to undo it
+	static VertexDequantization quantize(const Vertex* vertices, size_t vertexCount, const glm::vec3& boundsMin, const glm::vec3& boundsMax,
+		std::vector<CompactVertex>& compact, QuantizationError* error = nullptr)
+	{
+		VertexDequantization dequantization;
+		compact.resize(vertexCount);
+		if (vertexCount == 0)
+			return dequantization;
+
+		glm::vec2 texCoordMin = vertices[0].texCoord;
+		glm::vec2 texCoordMax = texCoordMin;
+		for (size_t i = 0; i < vertexCount; ++i)
+		{
+			texCoordMin = glm::min(texCoordMin, vertices[i].texCoord);
+			texCoordMax = glm::max(texCoordMax, vertices[i].texCoord);
+		}
+
+		glm::vec3 positionExtent = boundsMax - boundsMin;
+		glm::vec2 texCoordExtent = texCoordMax - texCoordMin;
+		dequantization.positionScale = positionExtent;
+		dequantization.positionOffset = boundsMin;
+		dequantization.texCoordTransform = glm::vec4(texCoordExtent, texCoordMin);
+
+		for (size_t i = 0; i < vertexCount; ++i)
+		{
+			const Vertex& vertex = vertices[i];
+			CompactVertex& packed = compact[i];
+
+			for (int axis = 0; axis < 3; ++axis)
+				packed.position[axis] = quantizeUnorm(vertex.position[axis] - boundsMin[axis], positionExtent[axis]);
+			packed.position[3] = 0;
+
+			for (int axis = 0; axis < 2; ++axis)
+				packed.texCoord[axis] = quantizeUnorm(vertex.texCoord[axis] - texCoordMin[axis], texCoordExtent[axis]);
+
+			float length = glm::length(vertex.normal);
+			glm::vec2 encoded = length > 0.f ? octahedralEncode(vertex.normal / length) : glm::vec2(0.f);
+			packed.normal[0] = quantizeSnorm(encoded.x);
+			packed.normal[1] = quantizeSnorm(encoded.y);
+		}
+
+		if (error)
+			*error = measureError(vertices, compact.data(), vertexCount, dequantization);
+		return dequantization;
+	}
+
+	// Same decoding the compact vertex shader does
+	static Vertex decode(const CompactVertex& packed, const VertexDequantization& dequantization)
+	{
+		Vertex vertex;
+		glm::vec3 position(packed.position[0], packed.position[1], packed.position[2]);
+		vertex.position = dequantization.positionOffset + position / 65535.f * dequantization.positionScale;
+
+		glm::vec2 texCoord(packed.texCoord[0], packed.texCoord[1]);
+		vertex.texCoord = glm::vec2(dequantization.texCoordTransform.z, dequantization.texCoordTransform.w) +
+			texCoord / 65535.f * glm::vec2(dequantization.texCoordTransform.x, dequantization.texCoordTransform.y);
+
+		glm::vec2 normal = glm::max(glm::vec2(packed.normal[0], packed.normal[1]) / 32767.f, glm::vec2(-1.f));
+		vertex.normal = octahedralDecode(normal);
+		return vertex;
+	}
+
+	static QuantizationError measureError(const Vertex* vertices, const CompactVertex* compact, size_t vertexCount, const VertexDequantization& dequantization)
+	{
+		QuantizationError error;
+		error.bytesPerVertex = sizeof(CompactVertex);
+		error.bytesSaved = vertexCount * (sizeof(Vertex) - sizeof(CompactVertex));
+
+		float minCosine = 1.f;
+		for (size_t i = 0; i < vertexCount; ++i)
+		{
+			Vertex decoded = decode(compact[i], dequantization);
+			glm::vec3 positionError = glm::abs(decoded.position - vertices[i].position);
+			glm::vec2 texCoordError = glm::abs(decoded.texCoord - vertices[i].texCoord);
+			error.position = glm::max(error.position, glm::max(positionError.x, glm::max(positionError.y, positionError.z)));
+			error.texCoord = glm::max(error.texCoord, glm::max(texCoordError.x, texCoordError.y));
+
+			float length = glm::length(vertices[i].normal);
+			if (length > 0.f)
+				minCosine = glm::min(minCosine, glm::dot(decoded.normal, vertices[i].normal / length));
+		}
+		error.normalDegrees = glm::degrees(std::acos(glm::clamp(minCosine, -1.f, 1.f)));
+		return error;
+	}
+
+private:
+	static uint16_t quantizeUnorm(float value, float extent)
+	{
+		if (extent <= 0.f)
+			return 0;
+		return static_cast<uint16_t>(glm::clamp(value / extent, 0.f, 1.f) * 65535.f + 0.5f);
+	}
+
+	static int16_t quantizeSnorm(float value)
+	{
+		return static_cast<int16_t>(std::lround(glm::clamp(value, -1.f, 1.f) * 32767.f));
+	}
+};
+
+// Attribute pointers 0-2 for the vertex buffer bound to GL_ARRAY_BUFFER
+inline void setVertexAttributes(VertexFormat format)
+{
+	glEnableVertexAttribArray(0);
+	glEnableVertexAttribArray(1);
+	glEnableVertexAttribArray(2);
+
+	if (format == VertexFormat::Compact)
+	{
+		glVertexAttribPointer(0, 3, GL_UNSIGNED_SHORT, GL_TRUE, sizeof(CompactVertex), (void*)offsetof(CompactVertex, position));
+		glVertexAttribPointer(1, 2, GL_UNSIGNED_SHORT, GL_TRUE, sizeof(CompactVertex), (void*)offsetof(CompactVertex, texCoord));
+		glVertexAttribPointer(2, 2, GL_SHORT, GL_TRUE, sizeof(CompactVertex), (void*)offsetof(CompactVertex, normal));
+		return;
+	}
+
+	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, position));
+	glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, texCoord));
+	glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, normal));
+}
+
+// Per instance model matrix in attributes 3-6, read from the bound GL_ARRAY_BUFFER starting at firstInstance
+inline void setInstanceAttributes(size_t firstInstance = 0)
+{
+	for (unsigned int i = 0; i < 4; ++i)
+	{
+		glEnableVertexAttribArray(3 + i);
+		glVertexAttribPointer(3 + i, 4, GL_FLOAT, GL_FALSE, sizeof(glm::mat4), (void*)(firstInstance * sizeof(glm::mat4) + sizeof(glm::vec4) * i));
+		glVertexAttribDivisor(3 + i, 1);
+	}
+}
+
+// Uploads the mesh vertices to the bound GL_ARRAY_BUFFER in the given format
+inline VertexDequantization uploadVertices(const Vertex* vertices, size_t vertexCount, const glm::vec3& boundsMin, const glm::vec3& boundsMax,
+	VertexFormat format, QuantizationError* error = nullptr)
+{
+	if (format == VertexFormat::Compact)
+	{
+		std::vector<CompactVertex> compact;
+		VertexDequantization dequantization = VertexQuantizer::quantize(vertices, vertexCount, boundsMin, boundsMax, compact, error);
+		glBufferData(GL_ARRAY_BUFFER, compact.size() * sizeof(CompactVertex), compact.data(), GL_STATIC_DRAW);
+		return dequantization;
+	}
+
+	if (error)
+		*error = QuantizationError();
+	glBufferData(GL_ARRAY_BUFFER, vertexCount * sizeof(Vertex), vertices, GL_STATIC_DRAW);
+	return VertexDequantization();
+}
+
+// Current generic attribute values are not part of the VAO, so they are set before every compact draw
+inline void setDequantization(const VertexDequantization& dequantization)
+{
+	glVertexAttrib3fv(positionScaleLocation, &dequantization.positionScale[0]);
+	glVertexAttrib3fv(positionOffsetLocation, &dequantization.positionOffset[0]);
+	glVertexAttrib4fv(texCoordTransformLocation, &dequantization.texCoordTransform[0]);
+}
@@ -0,0 +1,145 @@
+// Bakes OBJ files into headers with ready-to-upload vertex and index arrays
+//
+// Usage: ObjBake <input.obj> <output.h> [name]
+//
+// The header defines <name>_vertices (position, texCoord, normal as 8 floats per vertex),
+// <name>_indices (16-bit when the vertex count allows it) holding every level of detail
+// one after the other, and <name>_lods locating the levels in it. The three can be passed
+// straight to the Object and Model array constructors.
+
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "meshopt.h"
+#include "objloader.h"
+#include "simplify.h"
+
+// Bump whenever the output or the processing behind it changes, headers with another stamp are rebaked
+static const int bakeVersion = 2;
+
+// 9 significant digits round-trip every float exactly
+static void writeFloat(FILE* file, float value)
+{
+	char text[32];
+	std::snprintf(text, sizeof(text), "%.9g", value);
+	bool hasPoint = std::strpbrk(text, ".e") != nullptr;
+	std::fprintf(file, "%s%sf", text, hasPoint ? "" : ".0");
+}
+
+static void writeFloats(FILE* file, const float* values, size_t count)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		writeFloat(file, values[i]);
+		std::fprintf(file, ",%s", (i % 8 == 7) ? "\n\t" : " ");
+	}
+}
+
+static std::string versionStamp()
+{
+	return "// ObjBake format " + std::to_string(bakeVersion);
+}
+
+// The header is current when it carries this version's stamp and is newer than both the OBJ and the tool
+// itself, a rebuilt ObjBake rebakes even if the format number was not bumped
+static bool isUpToDate(const char* inputPath, const char* outputPath, const char* toolPath)
+{
+	std::error_code error;
+	if (!std::filesystem::exists(outputPath, error))
+		return false;
+	auto outputTime = std::filesystem::last_write_time(outputPath, error);
+	if (error || outputTime < std::filesystem::last_write_time(inputPath, error) || error)
+		return false;
+	// argv[0] is not always a path to the binary, skip the check when it cannot be found
+	auto toolTime = std::filesystem::last_write_time(toolPath, error);
+	if (!error && outputTime < toolTime)
+		return false;
+
+	FILE* file = std::fopen(outputPath, "r");
+	if (!file)
+		return false;
+	std::string stamp = versionStamp();
+	bool stamped = false;
+	char line[256];
+	for (int i = 0; i < 4 && !stamped && std::fgets(line, sizeof(line), file); ++i)
+		stamped = std::strncmp(line, stamp.c_str(), stamp.size()) == 0 && (line[stamp.size()] == '\n' || line[stamp.size()] == '\0');
+	std::fclose(file);
+	return stamped;
+}
+
+int main(int argc, char** argv)
+{
+	if (argc < 3)
+	{
+		std::cerr << "Usage: ObjBake <input.obj> <output.h> [name]" << std::endl;
+		return 1;
+	}
+
+	const char* inputPath = argv[1];
+	const char* outputPath = argv[2];
+	std::string name = argc > 3 ? argv[3] : std::filesystem::path(inputPath).stem().string() + "_mesh";
+
+	// Only rewrite the header when it is stale, so the build does not recompile it every time
+	if (isUpToDate(inputPath, outputPath, argv[0]))
+	{
+		std::cout << outputPath << " is up to date" << std::endl;
+		return 0;
+	}
+
+	std::vector<Vertex> vertices;
+	std::vector<unsigned int> indices;
+	if (!ObjLoader::loadFile(inputPath, vertices, indices))
+		return 1;
+
+	VertexCacheStats before, after;
+	MeshOptimizer::optimize(vertices, indices, &before, &after);
+	std::cout << inputPath << ": ACMR " << before.acmr << " -> " << after.acmr << ", ATVR " << before.atvr << " -> " << after.atvr << std::endl;
+	std::vector<MeshLod> lods = MeshSimplifier::buildLodChain(vertices, indices);
+
+	FILE* file = std::fopen(outputPath, "w");
+	if (!file)
+	{
+		std::cerr << "Failed to write " << outputPath << std::endl;
+		return 1;
+	}
+
+	bool shortIndices = vertices.size() <= 65536;
+	std::string fileName = std::filesystem::path(inputPath).filename().string();
+
+	std::fprintf(file, "#pragma once\n\n");
+	std::fprintf(file, "%s\n", versionStamp().c_str());
+	std::fprintf(file, "// Generated by ObjBake from %s, do not edit\n", fileName.c_str());
+	std::fprintf(file, "// %zu vertices, %zu indices in %zu levels of detail\n\n", vertices.size(), indices.size(), lods.size());
+	std::fprintf(file, "#include \"simplify.h\"\n\n");
+
+	std::fprintf(file, "inline const float %s_vertices[] = {\n\t", name.c_str());
+	writeFloats(file, reinterpret_cast<const float*>(vertices.data()), vertices.size() * sizeof(Vertex) / sizeof(float));
+	std::fprintf(file, "\n};\n\n");
+
+	std::fprintf(file, "inline const %s %s_indices[] = {\n\t", shortIndices ? "unsigned short" : "unsigned int", name.c_str());
+	for (size_t i = 0; i < indices.size(); ++i)
+		std::fprintf(file, "%u,%s", indices[i], (i % 24 == 23) ? "\n\t" : " ");
+	std::fprintf(file, "\n};\n\n");
+
+	std::fprintf(file, "inline const MeshLod %s_lods[] = {\n", name.c_str());
+	for (const MeshLod& lod : lods)
+	{
+		std::fprintf(file, "\t{ %u, %u, ", lod.firstIndex, lod.indexCount);
+		writeFloat(file, lod.error);
+		std::fprintf(file, " },\n");
+	}
+	std::fprintf(file, "};\n");
+
+	if (std::fclose(file) != 0)
+	{
+		std::cerr << "Failed to write " << outputPath << std::endl;
+		return 1;
+	}
+
+	std::cout << "Baked " << inputPath << " -> " << outputPath << " (" << vertices.size() << " vertices, " << indices.size() << " indices, " << lods.size() << " levels)" << std::endl;
+	return 0;
+}